@@ -79,6 +79,21 @@ struct HeapStatistics final {
     std::vector<size_t> free_size;
   };
 
+  /**
+   * Statistics of the linear allocation buffer (used only in non-large object
+   * spaces). Objects are bump-allocated from the buffer; only refills go
+   * through the freelist or allocate a new page. Heaps are bound to a single
+   * thread, so these are the statistics of the allocating thread.
+   */
+  struct LinearAllocationStatistics {
+    /** Number of refills taken from the freelist. */
+    size_t refills_from_free_list = 0;
+    /** Number of refills that allocated a new page. */
+    size_t refills_from_new_pages = 0;
+    /** Overall amount of memory handed out by refills. */
+    size_t refilled_bytes = 0;
+  };
+
   /**
    * Space granularity statistics. For each space the statistics record the
    * space name, the amount of allocated memory and overall used memory for the
@@ -98,6 +113,8 @@ struct HeapStatistics final {
     std::vector<PageStatistics> page_stats;
     /** Statistics for the freelist of the space. */
     FreeListStatistics free_list_stats;
+    /** Statistics for the linear allocation buffer of the space. */
+    LinearAllocationStatistics linear_allocation_stats;
   };
 
   /** Overall committed amount of memory for the heap. */
@@ -23,6 +23,14 @@ struct HasFinalizeGarbageCollectedObject<
     std::void_t<decltype(std::declval<T>().FinalizeGarbageCollectedObject())>>
     : std::true_type {};
 
+template <typename T, typename = void>
+struct IsConcurrentlyFinalizable : std::false_type {};
+
+template <typename T>
+struct IsConcurrentlyFinalizable<
+    T, std::void_t<typename T::IsConcurrentlyFinalizableTypeMarker>>
+    : std::true_type {};
+
 // The FinalizerTraitImpl specifies how to finalize objects.
 template <typename T, bool isFinalized>
 struct FinalizerTraitImpl;
@@ -82,6 +90,11 @@ struct FinalizerTrait {
   // The callback used to finalize an object of type T.
   static constexpr FinalizationCallback kCallback =
       kNonTrivialFinalizer ? Finalize : nullptr;
+
+  // Whether the callback may be invoked on a concurrent sweeper thread, see
+  // CPPGC_FINALIZE_CONCURRENTLY().
+  static constexpr bool kFinalizeConcurrently =
+      kNonTrivialFinalizer && IsConcurrentlyFinalizable<T>::value;
 };
 
 template <typename T>
@@ -36,9 +36,11 @@ struct V8_EXPORT EnsureGCInfoIndexTrait final {
 
   static GCInfoIndex V8_PRESERVE_MOST
   EnsureGCInfoIndex(std::atomic<GCInfoIndex>&, TraceCallback,
-                    FinalizationCallback, NameCallback);
-  static GCInfoIndex V8_PRESERVE_MOST EnsureGCInfoIndex(
-      std::atomic<GCInfoIndex>&, TraceCallback, FinalizationCallback);
+                    FinalizationCallback, NameCallback,
+                    bool finalize_concurrently);
+  static GCInfoIndex V8_PRESERVE_MOST
+  EnsureGCInfoIndex(std::atomic<GCInfoIndex>&, TraceCallback,
+                    FinalizationCallback, bool finalize_concurrently);
   static GCInfoIndex V8_PRESERVE_MOST
   EnsureGCInfoIndex(std::atomic<GCInfoIndex>&, TraceCallback, NameCallback);
   static GCInfoIndex V8_PRESERVE_MOST
@@ -55,25 +57,27 @@ struct V8_EXPORT EnsureGCInfoIndexTrait final {
     }                                                            \
   };
 
-// ------------------------------------------------------- //
-// DISPATCH(has_finalizer, has_non_hidden_name, function)  //
-// ------------------------------------------------------- //
-DISPATCH(true, true,                                       //
-         EnsureGCInfoIndex(registered_index,               //
-                           TraceTrait<T>::Trace,           //
-                           FinalizerTrait<T>::kCallback,   //
-                           NameTrait<T>::GetName))         //
-DISPATCH(true, false,                                      //
-         EnsureGCInfoIndex(registered_index,               //
-                           TraceTrait<T>::Trace,           //
-                           FinalizerTrait<T>::kCallback))  //
-DISPATCH(false, true,                                      //
-         EnsureGCInfoIndex(registered_index,               //
-                           TraceTrait<T>::Trace,           //
-                           NameTrait<T>::GetName))         //
-DISPATCH(false, false,                                     //
-         EnsureGCInfoIndex(registered_index,               //
-                           TraceTrait<T>::Trace))          //
+// ------------------------------------------------------------------- //
+// DISPATCH(has_finalizer, has_non_hidden_name, function)              //
+// ------------------------------------------------------------------- //
+DISPATCH(true, true,                                                   //
+         EnsureGCInfoIndex(registered_index,                           //
+                           TraceTrait<T>::Trace,                       //
+                           FinalizerTrait<T>::kCallback,               //
+                           NameTrait<T>::GetName,                      //
+                           FinalizerTrait<T>::kFinalizeConcurrently))  //
+DISPATCH(true, false,                                                  //
+         EnsureGCInfoIndex(registered_index,                           //
+                           TraceTrait<T>::Trace,                       //
+                           FinalizerTrait<T>::kCallback,               //
+                           FinalizerTrait<T>::kFinalizeConcurrently))  //
+DISPATCH(false, true,                                                  //
+         EnsureGCInfoIndex(registered_index,                           //
+                           TraceTrait<T>::Trace,                       //
+                           NameTrait<T>::GetName))                     //
+DISPATCH(false, false,                                                 //
+         EnsureGCInfoIndex(registered_index,                           //
+                           TraceTrait<T>::Trace))                      //
 
 #undef DISPATCH
 
@@ -18,6 +18,16 @@ namespace cppgc {
   void* operator new(size_t) = delete;                            \
   static_assert(true, "Force semicolon.")
 
+// Use CPPGC_FINALIZE_CONCURRENTLY if the finalizer of a garbage-collected type
+// may run on a concurrent sweeper thread instead of the mutator thread. The
+// destructor (or FinalizeGarbageCollectedObject()) of such a type must be
+// thread-safe and must neither touch thread-affine state nor other
+// garbage-collected objects. The annotation is inherited by subclasses.
+#define CPPGC_FINALIZE_CONCURRENTLY()                           \
+ public:                                                        \
+  using IsConcurrentlyFinalizableTypeMarker CPPGC_UNUSED = int; \
+  static_assert(true, "Force semicolon.")
+
 // Use CPPGC_STACK_ALLOCATED if the object is only stack allocated.
 // Add the CPPGC_STACK_ALLOCATED_IGNORE annotation on a case-by-case basis when
 // enforcement of CPPGC_STACK_ALLOCATED should be suppressed.
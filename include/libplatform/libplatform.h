@@ -25,6 +25,8 @@ enum class MessageLoopBehavior : bool {
 
 enum class PriorityMode : bool { kDontApply, kApply };
 
+enum class WorkerScheduling : bool { kSharedQueue, kWorkStealing };
+
 /**
  * Returns a new instance of the default v8::Platform implementation.
  *
@@ -40,6 +42,10 @@ enum class PriorityMode : bool { kDontApply, kApply };
  * If |priority_mode| is PriorityMode::kApply, the default platform will use
  * multiple task queues executed by threads different system-level priorities
  * (where available) to schedule tasks.
+ * If |worker_scheduling| is WorkerScheduling::kWorkStealing, every worker
+ * thread gets its own task queue and idle workers steal from busy ones,
+ * preferring workers on the same NUMA node, instead of all workers sharing a
+ * single queue.
  */
 V8_PLATFORM_EXPORT std::unique_ptr<v8::Platform> NewDefaultPlatform(
     int thread_pool_size = 0,
@@ -47,7 +53,8 @@ V8_PLATFORM_EXPORT std::unique_ptr<v8::Platform> NewDefaultPlatform(
     InProcessStackDumping in_process_stack_dumping =
         InProcessStackDumping::kDisabled,
     std::unique_ptr<v8::TracingController> tracing_controller = {},
-    PriorityMode priority_mode = PriorityMode::kDontApply);
+    PriorityMode priority_mode = PriorityMode::kDontApply,
+    WorkerScheduling worker_scheduling = WorkerScheduling::kSharedQueue);
 
 /**
  * The same as NewDefaultPlatform but disables the worker thread pool.
@@ -70,6 +77,26 @@ V8_PLATFORM_EXPORT std::unique_ptr<v8::JobHandle> NewDefaultJobHandle(
     v8::Platform* platform, v8::TaskPriority priority,
     std::unique_ptr<v8::JobTask> job_task, size_t num_worker_threads);
 
+/**
+ * Makes the jobs of |isolate| share the worker threads of |platform| with the
+ * jobs of other isolates configured this way, in proportion to |weight|, and
+ * never run on more than |max_worker_threads| worker threads at a time (0 for
+ * no cap). This applies to jobs created afterwards on threads attributed to
+ * |isolate| with SetCurrentThreadJobIsolate(), and to jobs created from within
+ * those jobs.
+ */
+V8_PLATFORM_EXPORT void SetIsolateJobScheduling(v8::Platform* platform,
+                                                v8::Isolate* isolate,
+                                                uint32_t weight,
+                                                size_t max_worker_threads);
+
+/**
+ * Attributes jobs created on the current thread to |isolate|, or to no isolate
+ * if |isolate| is nullptr. See SetIsolateJobScheduling().
+ */
+V8_PLATFORM_EXPORT void SetCurrentThreadJobIsolate(v8::Platform* platform,
+                                                   v8::Isolate* isolate);
+
 /**
  * Pumps the message loop for the given isolate.
  *
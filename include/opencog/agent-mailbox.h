@@ -0,0 +1,94 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_AGENT_MAILBOX_H_
+#define V8_OPENCOG_AGENT_MAILBOX_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "include/opencog/agent.h"
+
+namespace v8 {
+namespace opencog {
+
+// Bounded lock-free message queue of a single agent.
+//
+// Any number of threads may push. Messages are popped by whichever thread
+// currently runs the agent, and, under kDropOldest, by producers evicting the
+// oldest message, so the ring is a bounded MPMC queue (Vyukov's design): each
+// slot carries a sequence number that tells producers and consumers whether
+// it is free or filled for the current lap.
+class AgentMailbox {
+ public:
+  // What Push() does with a full mailbox.
+  enum class OverflowPolicy {
+    kBlock,       // Wait for space. Falls back to kReject where waiting could
+                  // deadlock, see Push().
+    kDropOldest,  // Evict the oldest queued message.
+    kReject,      // Refuse the new message.
+  };
+
+  enum class PushResult {
+    kDelivered,
+    kDeliveredAfterDrop,
+    kRejected,
+  };
+
+  static constexpr size_t kDefaultCapacity = 4096;
+
+  // |capacity| is rounded up to a power of two.
+  AgentMailbox(size_t capacity, OverflowPolicy policy);
+
+  AgentMailbox(const AgentMailbox&) = delete;
+  AgentMailbox& operator=(const AgentMailbox&) = delete;
+
+  // Queues |message| according to the overflow policy. kBlock only waits if
+  // |may_block| is set; callers running inside an agent callback must pass
+  // false, because the thread that would make room may be their own.
+  PushResult Push(const AgentMessage& message, bool may_block);
+  bool TryPop(AgentMessage* message);
+
+  bool IsEmpty() const {
+    return enqueue_pos_.load() == dequeue_pos_.load();
+  }
+  // Queued messages. Approximate while messages are pushed or popped.
+  size_t size() const {
+    // The dequeue position never passes the enqueue one read after it.
+    size_t dequeue_pos = dequeue_pos_.load();
+    return enqueue_pos_.load() - dequeue_pos;
+  }
+  size_t capacity() const { return mask_ + 1; }
+  OverflowPolicy policy() const { return policy_; }
+
+ private:
+  struct Slot {
+    std::atomic<size_t> sequence;
+    AgentMessage message;
+  };
+
+  bool TryPush(const AgentMessage& message);
+  bool IsFull() const {
+    return enqueue_pos_.load() - dequeue_pos_.load() >= capacity();
+  }
+
+  const OverflowPolicy policy_;
+  const size_t mask_;
+  std::unique_ptr<Slot[]> slots_;
+  alignas(64) std::atomic<size_t> enqueue_pos_{0};
+  alignas(64) std::atomic<size_t> dequeue_pos_{0};
+
+  // Slow path for kBlock producers waiting for space.
+  std::mutex space_mutex_;
+  std::condition_variable space_cv_;
+  std::atomic<size_t> blocked_producers_{0};
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_AGENT_MAILBOX_H_
@@ -5,23 +5,57 @@
 #ifndef V8_OPENCOG_AGENT_ORCHESTRATOR_H_
 #define V8_OPENCOG_AGENT_ORCHESTRATOR_H_
 
-#include <map>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <shared_mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
+#include "include/opencog/agent-mailbox.h"
+#include "include/opencog/agent-scheduler.h"
+#include "include/opencog/agent-table.h"
 #include "include/opencog/agent.h"
+#include "include/opencog/work-stealing-executor.h"
 
 namespace v8 {
 namespace opencog {
 
-// Multi-agent orchestration workbench
+// Multi-agent orchestration workbench.
+//
+// Messages go straight into the recipient's bounded AgentMailbox, and
+// scheduled runs are counted on the agent. The first piece of work for an
+// idle agent queues an activation, which delivers the agent's mail and runs
+// it. An agent has at most one activation queued or running, so its
+// OnMessage() and Execute() never run concurrently with each other.
+//
+// Queued activations are ordered by an AgentScheduler: by priority class,
+// weighted fair share between tenants and deadline within a tenant. They run
+// on the orchestrator thread, which sleeps on a condition variable until one
+// is queued, or with Options::worker_threads set, on a WorkStealingExecutor.
+// Each executor task dispatches whichever activation the scheduler puts
+// first at that moment, so priorities hold in both modes.
 class AgentOrchestrator {
  public:
+  struct Options {
+    // Number of worker threads; 0 runs every agent on the single
+    // orchestrator thread.
+    size_t worker_threads = 0;
+    size_t mailbox_capacity = AgentMailbox::kDefaultCapacity;
+    AgentMailbox::OverflowPolicy overflow_policy =
+        AgentMailbox::OverflowPolicy::kBlock;
+    // Batch activations waiting longer than this are dispatched ahead of
+    // interactive ones.
+    std::chrono::milliseconds starvation_threshold{100};
+  };
+
   AgentOrchestrator();
+  explicit AgentOrchestrator(const Options& options);
   ~AgentOrchestrator();
 
   // Agent management
@@ -34,29 +68,111 @@ class AgentOrchestrator {
   // Orchestration control
   void Start();
   void Stop();
-  bool IsRunning() const { return running_; }
+  bool IsRunning() const { return running_.load(std::memory_order_acquire); }
 
-  // Message routing
-  void RouteMessage(const AgentMessage& message);
+  // Message routing. Returns false if there is no such agent or its mailbox
+  // rejected the message. Recipients are looked up by interned name, without
+  // hashing or comparing the id string, and without taking a lock.
+  bool RouteMessage(const AgentMessage& message);
+  // Same as RouteMessage() for a recipient the caller already holds, without
+  // the agent lookup.
+  bool DeliverMessage(const std::shared_ptr<Agent>& agent,
+                      const AgentMessage& message);
+  // Sends to every other registered agent. All recipients share |payload|.
   void BroadcastMessage(const std::string& from_agent_id,
-                        const std::string& type,
-                        const std::string& payload);
+                        const std::string& type, AgentPayload payload);
+
+  // Topic subscriptions. Publish() reaches only the subscribers of |topic|,
+  // except the sender, and all recipients share |payload|. Returns the number
+  // of recipients whose mailbox accepted the message.
+  bool Subscribe(const std::string& agent_id, const std::string& topic);
+  bool Unsubscribe(const std::string& agent_id, const std::string& topic);
+  size_t Publish(const std::string& from_agent_id, const std::string& topic,
+                 const std::string& type, AgentPayload payload);
 
   // Agent execution
   void ScheduleAgent(const std::string& agent_id);
+  // Schedules |agent_id| once |delay| has passed. Timers fire only while the
+  // orchestrator is running; those due during a Stop() fire after the next
+  // Start().
+  void ScheduleAgentAfter(const std::string& agent_id,
+                          std::chrono::steady_clock::duration delay);
+  // Relative share of activations for the agents of |tenant_id|.
+  void SetTenantWeight(const std::string& tenant_id, uint32_t weight);
+  // See AgentScheduler::SetTenantThrottle().
+  void SetTenantThrottle(const std::string& tenant_id, uint32_t factor);
+  // Sum of Agent::run_time() over the registered agents of |tenant_id|.
+  std::chrono::nanoseconds TenantRunTime(const std::string& tenant_id) const;
+  AgentScheduler::Stats scheduler_stats() const;
+
+  // Messages lost to full mailboxes since construction.
+  uint64_t dropped_message_count() const {
+    return dropped_messages_.load(std::memory_order_relaxed);
+  }
+  uint64_t rejected_message_count() const {
+    return rejected_messages_.load(std::memory_order_relaxed);
+  }
 
  private:
   void OrchestratorLoop();
-  void ProcessMessageQueue();
+  void TimerLoop();
+  void StopTimerThread();
+  static void RunAgent(Agent* agent);
+
+  // Queues an activation for |agent| unless one is already queued.
+  void MaybeActivate(const std::shared_ptr<Agent>& agent);
+  void SubmitActivation(const std::shared_ptr<Agent>& agent);
+  void ActivateAgent(const std::shared_ptr<Agent>& agent);
+  // Executor task: activates the agent the scheduler picks next.
+  void RunNextActivation();
 
-  bool running_;
+  using SubscriberList = std::vector<std::shared_ptr<Agent>>;
+
+  // Delivers a copy of |message| addressed to each of |recipients|.
+  size_t FanOut(const SubscriberList& recipients, const InternedName& from,
+                AgentMessage message);
+
+  const Options options_;
+  std::atomic<bool> running_;
   std::thread orchestrator_thread_;
-  mutable std::mutex agents_mutex_;
-  mutable std::mutex messages_mutex_;
-  
-  std::map<std::string, std::shared_ptr<Agent>> agents_;
-  std::queue<AgentMessage> message_queue_;
-  std::queue<std::string> scheduled_agents_;
+  AgentTable agents_;
+
+  // Subscriber lists are copy-on-write: Publish() grabs the current list
+  // under a shared lock and delivers without holding it.
+  std::shared_mutex topics_mutex_;
+  std::unordered_map<std::string, std::shared_ptr<const SubscriberList>>
+      topics_;
+
+  // Queued activations. In worker mode the executor holds one task per
+  // activation queued while it runs; activations queued before Start() or
+  // after Stop() get their tasks on the next Start().
+  mutable std::mutex ready_mutex_;
+  // Signalled under |ready_mutex_| whenever an activation is queued or Stop()
+  // is called.
+  std::condition_variable work_available_;
+  AgentScheduler scheduler_;
+
+  struct Timer {
+    std::chrono::steady_clock::time_point due;
+    std::weak_ptr<Agent> agent;
+
+    bool operator>(const Timer& other) const { return due > other.due; }
+  };
+
+  // Pending ScheduleAgentAfter() calls, fired by |timer_thread_|.
+  std::mutex timers_mutex_;
+  std::condition_variable timers_changed_;
+  std::priority_queue<Timer, std::vector<Timer>, std::greater<>> timers_;
+  std::thread timer_thread_;
+
+  // Held shared while activations are submitted to |executor_| and
+  // exclusively while worker mode is switched on or off.
+  std::shared_mutex dispatch_mutex_;
+  bool direct_dispatch_ = false;
+  std::unique_ptr<WorkStealingExecutor> executor_;
+
+  std::atomic<uint64_t> dropped_messages_{0};
+  std::atomic<uint64_t> rejected_messages_{0};
 };
 
 }  // namespace opencog
@@ -0,0 +1,123 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_AGENT_SCHEDULER_H_
+#define V8_OPENCOG_AGENT_SCHEDULER_H_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+
+#include "include/opencog/agent.h"
+
+namespace v8 {
+namespace opencog {
+
+// Orders pending agent activations. Not thread safe; the orchestrator guards
+// it with its ready queue lock.
+//
+// Pop() picks, in order:
+//  1. the oldest batch activation that has waited longer than the starvation
+//     threshold,
+//  2. an interactive activation, if any,
+//  3. a batch activation.
+// Within a priority class, tenants share dispatches by weighted fair queueing:
+// the tenant with the smallest virtual time goes next, and every dispatch
+// advances the tenant's virtual time by 1 / weight. Within a tenant,
+// activations run earliest deadline first; activations without a deadline
+// follow in FIFO order.
+class AgentScheduler {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Stats {
+    uint64_t dispatched = 0;
+    // Batch activations dispatched ahead of interactive work because they
+    // had waited past the starvation threshold.
+    uint64_t starvation_promotions = 0;
+    uint64_t deadline_misses = 0;
+    Clock::duration max_wait{0};
+  };
+
+  static constexpr uint32_t kDefaultWeight = 1;
+
+  explicit AgentScheduler(Clock::duration starvation_threshold);
+  AgentScheduler(const AgentScheduler&) = delete;
+  AgentScheduler& operator=(const AgentScheduler&) = delete;
+
+  void Push(std::shared_ptr<Agent> agent);
+  // Returns nullptr if nothing is queued.
+  std::shared_ptr<Agent> Pop();
+
+  bool empty() const { return size_ == 0; }
+  size_t size() const { return size_; }
+
+  // Relative share of dispatches for |tenant_id|. Weights below 1 are
+  // treated as 1.
+  void SetTenantWeight(const std::string& tenant_id, uint32_t weight);
+  // Divides the share of |tenant_id| by |factor| on top of its weight; 1
+  // lifts the throttle. Throttled tenants still run when no other tenant has
+  // work, and starved batch work is promoted as usual.
+  void SetTenantThrottle(const std::string& tenant_id, uint32_t factor);
+  const Stats& stats() const { return stats_; }
+
+ private:
+  static constexpr size_t kPriorityCount = 2;
+
+  struct Entry {
+    Clock::time_point deadline;
+    uint64_t sequence;
+    Clock::time_point enqueued;
+    std::shared_ptr<Agent> agent;
+
+    bool operator<(const Entry& other) const {
+      if (deadline != other.deadline) return deadline < other.deadline;
+      return sequence < other.sequence;
+    }
+  };
+
+  struct Tenant {
+    uint32_t weight = kDefaultWeight;
+    uint32_t throttle = 1;
+    double virtual_time = 0;
+    std::array<std::set<Entry>, kPriorityCount> queues;
+    size_t size() const { return queues[0].size() + queues[1].size(); }
+  };
+
+  // Batch activations across all tenants, oldest first, for starvation
+  // detection.
+  struct WaitingEntry {
+    Clock::time_point enqueued;
+    uint64_t sequence;
+    Tenant* tenant;
+    Clock::time_point deadline;
+
+    bool operator<(const WaitingEntry& other) const {
+      return sequence < other.sequence;
+    }
+  };
+
+  std::shared_ptr<Agent> Take(Tenant* tenant, size_t priority,
+                              std::set<Entry>::iterator entry);
+  Tenant* NextTenant(size_t priority);
+
+  const Clock::duration starvation_threshold_;
+  std::unordered_map<std::string, Tenant> tenants_;
+  std::set<WaitingEntry> waiting_batch_;
+  // Virtual time of the most recent dispatch. A tenant that becomes active
+  // starts from here, so idle periods do not bank credit.
+  double virtual_clock_ = 0;
+  uint64_t next_sequence_ = 0;
+  size_t size_ = 0;
+  Stats stats_;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_AGENT_SCHEDULER_H_
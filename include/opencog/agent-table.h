@@ -0,0 +1,123 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_AGENT_TABLE_H_
+#define V8_OPENCOG_AGENT_TABLE_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "include/opencog/agent.h"
+#include "include/opencog/reader-epochs.h"
+
+namespace v8 {
+namespace opencog {
+
+// The registered agents of an AgentOrchestrator, by name and by tenant.
+//
+// Agents sit in a dense table of slots, and an agent's slot number is its
+// handle. Slots come in fixed chunks that never move, and the slots of
+// removed agents are reused. An open-addressing hash index maps names to
+// handles; as names are interned, probing compares pointers, never strings.
+// A per-tenant list of handles answers GetByTenant() without visiting the
+// agents of other tenants.
+//
+// Find() and ForEach() take no lock, so routing does not serialize on the
+// table. Writers are serialized by a mutex. Removing an agent, and growing
+// the index, wait until no lookup can still see the old state (see
+// ReaderEpochs), which suits registration rates.
+class AgentTable {
+ public:
+  using Handle = uint32_t;
+  static constexpr Handle kNoHandle = 0xFFFFFFFF;
+
+  AgentTable();
+  ~AgentTable();
+
+  AgentTable(const AgentTable&) = delete;
+  AgentTable& operator=(const AgentTable&) = delete;
+
+  // Registers |agent| under its name unless another agent has it. |prepare|,
+  // if given, runs under the writer lock once the name is known to be free
+  // and before lookups can find the agent.
+  bool Insert(std::shared_ptr<Agent> agent,
+              const std::function<void(Agent*)>& prepare = nullptr);
+  // Unregisters the agent named |name| and hands it back, if any.
+  std::shared_ptr<Agent> Remove(const InternedName& name);
+
+  std::shared_ptr<Agent> Find(const InternedName& name) const;
+  Handle FindHandle(const InternedName& name) const;
+  std::shared_ptr<Agent> Get(Handle handle) const;
+
+  // Calls |visitor| with every registered agent, by handle. Agents inserted
+  // or removed meanwhile may or may not be visited.
+  void ForEach(const std::function<void(const std::shared_ptr<Agent>&)>&
+                   visitor) const;
+  std::vector<std::shared_ptr<Agent>> GetByTenant(
+      const std::string& tenant_id) const;
+
+  size_t size() const { return size_.load(std::memory_order_relaxed); }
+
+ private:
+  static constexpr size_t kChunkBits = 10;
+  static constexpr size_t kChunkSize = size_t{1} << kChunkBits;
+  static constexpr size_t kMaxChunks = 4096;
+
+  struct Slot {
+    // Set while |agent| may be read by lookups.
+    std::atomic<bool> live{false};
+    std::shared_ptr<Agent> agent;
+  };
+
+  // An entry keeps its name once set. Removing the agent only clears the
+  // handle, and re-registering the name reuses the entry.
+  struct IndexEntry {
+    std::atomic<const void*> name{nullptr};
+    std::atomic<Handle> handle{kNoHandle};
+  };
+
+  struct Index {
+    explicit Index(size_t capacity)
+        : mask(capacity - 1), entries(new IndexEntry[capacity]) {}
+    const size_t mask;
+    std::unique_ptr<IndexEntry[]> entries;
+    // Entries with a name, written under |write_mutex_|.
+    size_t used = 0;
+  };
+
+  Slot* SlotAt(Handle handle) const {
+    return &chunks_[handle >> kChunkBits].load(std::memory_order_acquire)
+                [handle & (kChunkSize - 1)];
+  }
+  // The entry of |name|, or the free entry where it would go. The caller
+  // must be in a read scope or hold |write_mutex_|.
+  static IndexEntry* Probe(const Index* index, const InternedName& name);
+  // The following expect |write_mutex_| to be held.
+  Handle AllocateSlot();
+  void GrowIndex();
+
+  ReaderEpochs epochs_;
+  std::atomic<Index*> index_;
+  std::array<std::atomic<Slot*>, kMaxChunks> chunks_{};
+  // Slots below this have been handed out at some point.
+  std::atomic<Handle> slot_limit_{0};
+  std::atomic<size_t> size_{0};
+
+  mutable std::mutex write_mutex_;
+  std::vector<Handle> free_slots_;
+  std::unordered_map<std::string, std::vector<Handle>> tenants_;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_AGENT_TABLE_H_
@@ -5,10 +5,15 @@
 #ifndef V8_OPENCOG_AGENT_H_
 #define V8_OPENCOG_AGENT_H_
 
+#include <atomic>
+#include <chrono>
 #include <functional>
+#include <iosfwd>
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include "include/opencog/atomspace.h"
@@ -17,7 +22,9 @@ namespace v8 {
 namespace opencog {
 
 // Forward declarations
+class AgentMailbox;
 class AgentOrchestrator;
+struct SerializedValueTransfers;
 
 // Agent states
 enum class AgentState {
@@ -28,20 +35,142 @@ enum class AgentState {
   FAILED
 };
 
-// Message for inter-agent communication
+// Dispatch class of an agent. Interactive agents are activated ahead of
+// batch agents unless a batch activation has waited past the orchestrator's
+// starvation threshold.
+enum class AgentPriority {
+  kInteractive,
+  kBatch,
+};
+
+// Immutable, reference counted message body. Copies share one buffer, so a
+// message fanned out to many agents is stored once.
+//
+// The body is either text or a JavaScript value written by
+// v8::ValueSerializer, which agents in different isolates exchange without
+// going through JSON. Shared objects of a serialized value, such as
+// SharedArrayBuffers and shared structs, travel by reference in the
+// SerializedValueTransfers; see OpenCogBindings::SerializePayload().
+class AgentPayload {
+ public:
+  enum class Encoding { kText, kSerializedValue };
+
+  AgentPayload() = default;
+  AgentPayload(std::string data)  // NOLINT(runtime/explicit)
+      : data_(std::make_shared<const std::string>(std::move(data))) {}
+  AgentPayload(const char* data)  // NOLINT(runtime/explicit)
+      : AgentPayload(std::string(data)) {}
+
+  static AgentPayload FromSerializedValue(
+      std::string data,
+      std::shared_ptr<const SerializedValueTransfers> transfers) {
+    AgentPayload payload(std::move(data));
+    payload.encoding_ = Encoding::kSerializedValue;
+    payload.transfers_ = std::move(transfers);
+    return payload;
+  }
+
+  Encoding encoding() const { return encoding_; }
+  // Null for text and for serialized values without shared objects.
+  const std::shared_ptr<const SerializedValueTransfers>& transfers() const {
+    return transfers_;
+  }
+
+  const std::string& str() const { return data_ ? *data_ : EmptyString(); }
+  operator const std::string&() const { return str(); }  // NOLINT
+  size_t size() const { return str().size(); }
+  bool empty() const { return str().empty(); }
+
+  bool SharesBufferWith(const AgentPayload& other) const {
+    return data_ != nullptr && data_ == other.data_;
+  }
+
+  friend bool operator==(const AgentPayload& a, const std::string& b) {
+    return a.str() == b;
+  }
+  friend bool operator==(const AgentPayload& a, const char* b) {
+    return a.str() == b;
+  }
+  friend bool operator==(const AgentPayload& a, const AgentPayload& b) {
+    return a.data_ == b.data_ ||
+           (a.encoding_ == b.encoding_ && a.transfers_ == b.transfers_ &&
+            a.str() == b.str());
+  }
+
+ private:
+  static const std::string& EmptyString();
+
+  std::shared_ptr<const std::string> data_;
+  std::shared_ptr<const SerializedValueTransfers> transfers_;
+  Encoding encoding_ = Encoding::kText;
+};
+
+std::ostream& operator<<(std::ostream& os, const AgentPayload& payload);
+
+// Agent id, message type or topic, interned process-wide.
+//
+// Every distinct string is stored once and never freed, and a name is a
+// pointer to that copy. Names copy without allocating and compare by
+// pointer, so messages carry and route by them cheaply. Interning takes a
+// hash lookup; hot senders should keep the names they reuse.
+class InternedName {
+ public:
+  InternedName() : value_(&EmptyString()) {}
+  InternedName(std::string_view name)  // NOLINT(runtime/explicit)
+      : value_(Intern(name)) {}
+  InternedName(const std::string& name)  // NOLINT(runtime/explicit)
+      : InternedName(std::string_view(name)) {}
+  InternedName(const char* name)  // NOLINT(runtime/explicit)
+      : InternedName(std::string_view(name)) {}
+
+  // Looks |name| up without interning it. Returns false if it never was, in
+  // which case no agent, type or topic can carry it.
+  static bool Find(std::string_view name, InternedName* result);
+
+  const std::string& str() const { return *value_; }
+  operator const std::string&() const { return *value_; }  // NOLINT
+  bool empty() const { return value_->empty(); }
+  // Identifies the name: equal names have equal ids.
+  const void* id() const { return value_; }
+  size_t hash() const { return std::hash<const std::string*>()(value_); }
+
+  friend bool operator==(const InternedName& a, const InternedName& b) {
+    return a.value_ == b.value_;
+  }
+  friend bool operator==(const InternedName& a, const std::string& b) {
+    return *a.value_ == b;
+  }
+  friend bool operator==(const InternedName& a, const char* b) {
+    return *a.value_ == b;
+  }
+
+ private:
+  static const std::string& EmptyString();
+  static const std::string* Intern(std::string_view name);
+
+  const std::string* value_;
+};
+
+std::ostream& operator<<(std::ostream& os, const InternedName& name);
+
+// Message for inter-agent communication. Apart from the payload, which
+// shares its buffer, copying a message does not allocate.
 struct AgentMessage {
-  std::string from_agent_id;
-  std::string to_agent_id;
-  std::string type;
-  std::string payload;
-  uint64_t timestamp;
+  InternedName from_agent_id;
+  InternedName to_agent_id;
+  InternedName type;
+  AgentPayload payload;
+  // When the message was sent.
+  std::chrono::steady_clock::time_point timestamp;
+  // Topic the message was published to, empty for direct messages.
+  InternedName topic;
 };
 
 // Base Agent class for autonomous behavior
 class Agent {
  public:
   Agent(const std::string& agent_id, const std::string& tenant_id);
-  virtual ~Agent() = default;
+  virtual ~Agent();
 
   // Agent lifecycle
   virtual bool Initialize();
@@ -50,8 +179,10 @@ class Agent {
 
   // Message handling
   virtual void OnMessage(const AgentMessage& message);
-  void SendMessage(const std::string& to_agent_id, const std::string& type,
-                   const std::string& payload);
+  // Returns false if the message was not queued: there is no orchestrator,
+  // no such agent, or the recipient's mailbox rejected it.
+  bool SendMessage(const std::string& to_agent_id, const std::string& type,
+                   AgentPayload payload);
 
   // State management
   AgentState state() const { return state_; }
@@ -59,19 +190,54 @@ class Agent {
 
   // Agent properties
   const std::string& agent_id() const { return agent_id_; }
+  // |agent_id_| interned, as messages carry it.
+  const InternedName& agent_name() const { return agent_name_; }
   const std::string& tenant_id() const { return tenant_id_; }
   std::shared_ptr<AtomSpace> atomspace() const { return atomspace_; }
 
+  // Scheduling parameters, read whenever the agent is queued for activation.
+  // A non-zero relative deadline orders the agent's activations earliest
+  // deadline first among the activations of its tenant.
+  AgentPriority priority() const { return priority_; }
+  void set_priority(AgentPriority priority) { priority_ = priority; }
+  std::chrono::microseconds relative_deadline() const {
+    return relative_deadline_;
+  }
+  void set_relative_deadline(std::chrono::microseconds deadline) {
+    relative_deadline_ = deadline;
+  }
+
   void set_orchestrator(AgentOrchestrator* orchestrator) {
     orchestrator_ = orchestrator;
   }
 
+  // Time spent in activations by the orchestrator, that is delivering mail
+  // and running Execute(), since construction.
+  std::chrono::nanoseconds run_time() const {
+    return std::chrono::nanoseconds(
+        run_time_ns_.load(std::memory_order_relaxed));
+  }
+
  protected:
   std::string agent_id_;
+  InternedName agent_name_;
   std::string tenant_id_;
   AgentState state_;
   std::shared_ptr<AtomSpace> atomspace_;
   AgentOrchestrator* orchestrator_;
+  AgentPriority priority_ = AgentPriority::kBatch;
+  std::chrono::microseconds relative_deadline_{0};
+
+ private:
+  friend class AgentOrchestrator;
+
+  // Work queued by the orchestrator. While |activation_queued_| is set,
+  // exactly one activation owns the agent and delivers this work, so calls
+  // into the agent never overlap.
+  std::unique_ptr<AgentMailbox> mailbox_;
+  std::atomic<uint32_t> pending_runs_{0};
+  std::atomic<bool> activation_queued_{false};
+  std::atomic<int64_t> run_time_ns_{0};
 };
 
 // Agent factory for creating different agent types
@@ -95,4 +261,11 @@ class AgentFactory {
 }  // namespace opencog
 }  // namespace v8
 
+template <>
+struct std::hash<v8::opencog::InternedName> {
+  size_t operator()(const v8::opencog::InternedName& name) const {
+    return name.hash();
+  }
+};
+
 #endif  // V8_OPENCOG_AGENT_H_
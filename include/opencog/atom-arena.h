@@ -0,0 +1,147 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_ATOM_ARENA_H_
+#define V8_OPENCOG_ATOM_ARENA_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "include/opencog/atom.h"
+
+namespace v8 {
+namespace opencog {
+
+// Per-AtomSpace slab storage for atoms.
+//
+// Atoms are carved out of large slabs grouped by size class, so that atoms of
+// the same kind sit next to each other in memory and adding an atom never goes
+// through the general purpose allocator. The arena also owns the handle table
+// that maps compact AtomHandles to atoms. Handle resolution is lock free.
+class AtomArena {
+ public:
+  static constexpr size_t kSlabSize = 64 * 1024;
+  static constexpr size_t kSizeClassGranularity = 16;
+  static constexpr size_t kMaxSlabAllocation = 512;
+
+  AtomArena() : AtomArena(0) {}
+  // Hands out handles starting at |first_handle|, so that the handles of an
+  // AtomSpace layered on another one do not collide with the base's.
+  explicit AtomArena(uint32_t first_handle);
+  ~AtomArena();
+
+  AtomArena(const AtomArena&) = delete;
+  AtomArena& operator=(const AtomArena&) = delete;
+
+  // Raw storage for objects of |size| bytes. Sizes above kMaxSlabAllocation
+  // fall back to operator new.
+  void* Allocate(size_t size);
+  void Deallocate(void* ptr, size_t size);
+
+  // Handle table management.
+  AtomHandle Register(Atom* atom);
+  void Unregister(AtomHandle handle);
+  Atom* Resolve(AtomHandle handle) const {
+    if (!handle.is_valid() || handle.value() < first_handle_) return nullptr;
+    const uint32_t index = handle.value() - first_handle_;
+    const Directory* directory = directory_.load(std::memory_order_acquire);
+    size_t chunk_index = index >> kChunkBits;
+    if (chunk_index >= directory->capacity) return nullptr;
+    const Chunk* chunk =
+        directory->chunks[chunk_index].load(std::memory_order_acquire);
+    if (chunk == nullptr) return nullptr;
+    return chunk->slots[index & kChunkMask].load(std::memory_order_acquire);
+  }
+
+  size_t slab_bytes() const;
+  size_t live_handles() const;
+  // Upper bound (exclusive) of every handle handed out so far.
+  uint32_t handle_limit() const;
+
+ private:
+  static constexpr size_t kChunkBits = 12;
+  static constexpr size_t kChunkSize = size_t{1} << kChunkBits;
+  static constexpr size_t kChunkMask = kChunkSize - 1;
+  static constexpr size_t kSizeClassCount =
+      kMaxSlabAllocation / kSizeClassGranularity;
+
+  struct Chunk {
+    std::array<std::atomic<Atom*>, kChunkSize> slots{};
+  };
+
+  struct Directory {
+    explicit Directory(size_t capacity);
+    size_t capacity;
+    std::unique_ptr<std::atomic<Chunk*>[]> chunks;
+  };
+
+  struct SizeClass {
+    std::vector<void*> free_list;
+    char* top = nullptr;
+    char* limit = nullptr;
+  };
+
+  static size_t SizeClassIndex(size_t size) {
+    return (size + kSizeClassGranularity - 1) / kSizeClassGranularity - 1;
+  }
+
+  mutable std::mutex allocation_mutex_;
+  std::array<SizeClass, kSizeClassCount> size_classes_;
+  std::vector<std::unique_ptr<char[]>> slabs_;
+
+  const uint32_t first_handle_;
+  mutable std::mutex handle_mutex_;
+  std::atomic<Directory*> directory_;
+  // Directories replaced by a larger one. Readers may still hold pointers to
+  // them, so they are only freed together with the arena.
+  std::vector<std::unique_ptr<Directory>> retired_directories_;
+  std::vector<std::unique_ptr<Chunk>> chunks_;
+  // Table indexes, that is handle values minus |first_handle_|.
+  std::vector<uint32_t> free_handles_;
+  uint32_t next_handle_ = 0;
+  size_t live_handles_ = 0;
+};
+
+// STL allocator that places objects in an AtomArena. Each allocation keeps the
+// arena alive, so atoms may safely outlive the AtomSpace that created them.
+template <typename T>
+class AtomArenaAllocator {
+ public:
+  using value_type = T;
+
+  explicit AtomArenaAllocator(std::shared_ptr<AtomArena> arena)
+      : arena_(std::move(arena)) {}
+  template <typename U>
+  AtomArenaAllocator(const AtomArenaAllocator<U>& other)  // NOLINT
+      : arena_(other.arena()) {}
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(arena_->Allocate(n * sizeof(T)));
+  }
+  void deallocate(T* ptr, size_t n) { arena_->Deallocate(ptr, n * sizeof(T)); }
+
+  const std::shared_ptr<AtomArena>& arena() const { return arena_; }
+
+  template <typename U>
+  bool operator==(const AtomArenaAllocator<U>& other) const {
+    return arena_ == other.arena();
+  }
+  template <typename U>
+  bool operator!=(const AtomArenaAllocator<U>& other) const {
+    return arena_ != other.arena();
+  }
+
+ private:
+  std::shared_ptr<AtomArena> arena_;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_ATOM_ARENA_H_
@@ -0,0 +1,75 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_ATOM_BATCH_H_
+#define V8_OPENCOG_ATOM_BATCH_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/opencog/atom.h"
+
+namespace v8 {
+namespace opencog {
+
+// Builder for bulk inserts through AtomSpace::Commit().
+//
+// Atoms are described up front and refer to each other by batch-local
+// references, so a whole knowledge base fragment can be published to the
+// AtomSpace under a single critical section instead of one per atom.
+class AtomBatch {
+ public:
+  // Index of an entry in the batch; also its index in the vector returned by
+  // AtomSpace::Commit().
+  using Ref = size_t;
+
+  enum class EntryKind { kNode, kLink, kExisting };
+
+  struct Entry {
+    EntryKind kind;
+    AtomType type;
+    std::string name;
+    std::vector<Ref> outgoing;
+    std::shared_ptr<Atom> existing;
+  };
+
+  AtomBatch() = default;
+  explicit AtomBatch(size_t expected_size) { entries_.reserve(expected_size); }
+
+  Ref AddNode(AtomType type, std::string name) {
+    entries_.push_back({EntryKind::kNode, type, std::move(name), {}, nullptr});
+    return entries_.size() - 1;
+  }
+
+  // |outgoing| must only contain references returned earlier by this batch.
+  Ref AddLink(AtomType type, std::string name, std::vector<Ref> outgoing) {
+    entries_.push_back({EntryKind::kLink, type, std::move(name),
+                        std::move(outgoing), nullptr});
+    return entries_.size() - 1;
+  }
+
+  // Makes an atom that is already in the AtomSpace available as an outgoing
+  // target for links in this batch.
+  Ref AddExisting(std::shared_ptr<Atom> atom) {
+    AtomType type = atom->type();
+    entries_.push_back(
+        {EntryKind::kExisting, type, std::string(), {}, std::move(atom)});
+    return entries_.size() - 1;
+  }
+
+  const std::vector<Entry>& entries() const { return entries_; }
+  size_t size() const { return entries_.size(); }
+  bool empty() const { return entries_.empty(); }
+  void Clear() { entries_.clear(); }
+
+ private:
+  std::vector<Entry> entries_;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_ATOM_BATCH_H_
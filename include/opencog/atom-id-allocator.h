@@ -0,0 +1,54 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_ATOM_ID_ALLOCATOR_H_
+#define V8_OPENCOG_ATOM_ID_ALLOCATOR_H_
+
+#include <atomic>
+#include <cstdint>
+
+namespace v8 {
+namespace opencog {
+
+// Hands out atom ids for one id space, usually one AtomSpace.
+//
+// Threads reserve blocks of kBlockSize consecutive ids with a single atomic
+// add and then allocate from a thread-local cursor, so concurrent ingest
+// threads do not share the counter's cache line on every insert. Ids are
+// unique within the id space and never zero; they are dense per block but not
+// globally sequential.
+class AtomIdAllocator {
+ public:
+  static constexpr uint64_t kBlockSize = 1024;
+  static constexpr uint64_t kInvalidId = 0;
+
+  AtomIdAllocator() : AtomIdAllocator(1) {}
+  // Starts the id space at |first_id|, which must not be kInvalidId.
+  explicit AtomIdAllocator(uint64_t first_id);
+
+  AtomIdAllocator(const AtomIdAllocator&) = delete;
+  AtomIdAllocator& operator=(const AtomIdAllocator&) = delete;
+
+  uint64_t Allocate();
+
+  // Upper bound (exclusive) of every id handed out so far.
+  uint64_t high_water_mark() const {
+    return next_block_.load(std::memory_order_relaxed);
+  }
+
+  // Id space for atoms created outside of an AtomSpace.
+  static AtomIdAllocator* Default();
+
+ private:
+  // Unique per allocator instance, so that a thread-local block cached for a
+  // destroyed allocator can never be mistaken for one of a new allocator that
+  // happens to reuse its address.
+  const uint64_t serial_;
+  std::atomic<uint64_t> next_block_;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_ATOM_ID_ALLOCATOR_H_
@@ -0,0 +1,70 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_ATOM_NAME_H_
+#define V8_OPENCOG_ATOM_NAME_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace v8 {
+namespace opencog {
+
+// Name of an atom, stored once per process in a shared pool.
+//
+// Every AtomName with the same text refers to the same pool entry, so atoms
+// and indexes that carry a name cost a pointer rather than a copy of it, and
+// equal names compare by pointer. Entries are reference counted and leave
+// the pool with their last AtomName. Each entry holds a std::string, whose
+// inline buffer keeps short names in the entry's single allocation. The
+// empty name, which most links carry, is a static entry and not counted.
+class AtomName {
+ public:
+  // Process-wide usage of the pool.
+  struct PoolStats {
+    size_t names = 0;
+    // Entry and character storage of those names.
+    size_t bytes = 0;
+  };
+
+  AtomName();
+  explicit AtomName(std::string_view name);
+  AtomName(const AtomName& other);
+  AtomName(AtomName&& other) noexcept;
+  AtomName& operator=(AtomName other) noexcept;
+  ~AtomName();
+
+  const std::string& str() const { return entry_->value; }
+  bool empty() const { return entry_->value.empty(); }
+  // Bytes of pool storage behind this name, 0 for the empty name.
+  size_t allocated_bytes() const;
+
+  bool operator==(const AtomName& other) const {
+    return entry_ == other.entry_;
+  }
+
+  static PoolStats GetPoolStats();
+
+ private:
+  friend struct AtomNamePool;
+
+  struct Entry {
+    // Unused by the static empty entry.
+    std::atomic<uint32_t> refs{1};
+    std::string value;
+  };
+
+  static Entry* EmptyEntry();
+  static void Release(Entry* entry);
+
+  Entry* entry_;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_ATOM_NAME_H_
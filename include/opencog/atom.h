@@ -5,11 +5,14 @@
 #ifndef V8_OPENCOG_ATOM_H_
 #define V8_OPENCOG_ATOM_H_
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <vector>
 #include <cstdint>
 
+#include "include/opencog/atom-name.h"
+
 namespace v8 {
 namespace opencog {
 
@@ -29,6 +32,34 @@ enum class AtomType {
   EXECUTION_LINK   // Execution context
 };
 
+// Number of AtomType values, for tables indexed by type.
+constexpr size_t kAtomTypeCount =
+    static_cast<size_t>(AtomType::EXECUTION_LINK) + 1;
+
+// Compact reference to an atom inside the AtomSpace that owns it. Handles are
+// dense 32-bit indexes into the owning AtomSpace's atom table and are only
+// meaningful for that AtomSpace. A handle stays valid while the atom remains in
+// the AtomSpace; it may be reused after the atom is removed.
+class AtomHandle {
+ public:
+  constexpr AtomHandle() : value_(kInvalidValue) {}
+  constexpr explicit AtomHandle(uint32_t value) : value_(value) {}
+
+  constexpr uint32_t value() const { return value_; }
+  constexpr bool is_valid() const { return value_ != kInvalidValue; }
+
+  constexpr bool operator==(const AtomHandle& other) const {
+    return value_ == other.value_;
+  }
+  constexpr bool operator!=(const AtomHandle& other) const {
+    return value_ != other.value_;
+  }
+
+ private:
+  static constexpr uint32_t kInvalidValue = 0xFFFFFFFF;
+  uint32_t value_;
+};
+
 // Truth value for probabilistic reasoning
 struct TruthValue {
   double strength;    // Probability [0, 1]
@@ -41,12 +72,20 @@ struct TruthValue {
 // Base Atom class
 class Atom {
  public:
-  Atom(AtomType type, const std::string& name);
+  Atom(AtomType type, const std::string& name, uint64_t id);
   virtual ~Atom() = default;
 
   AtomType type() const { return type_; }
-  const std::string& name() const { return name_; }
+  const std::string& name() const { return name_.str(); }
+  // The pooled name, shared by every atom of the same name.
+  const AtomName& pooled_name() const { return name_; }
   uint64_t id() const { return id_; }
+  // Structural hash over the atom's content: type and name for nodes, type
+  // and outgoing content hashes for links. Computed once at construction.
+  size_t content_hash() const { return content_hash_; }
+  // Handle in the owning AtomSpace, or an invalid handle if the atom has not
+  // been added to an AtomSpace.
+  AtomHandle handle() const { return handle_; }
   
   const TruthValue& truth_value() const { return truth_value_; }
   void set_truth_value(const TruthValue& tv) { truth_value_ = tv; }
@@ -56,21 +95,36 @@ class Atom {
 
  protected:
   AtomType type_;
-  std::string name_;
+  AtomName name_;
   uint64_t id_;
+  size_t content_hash_ = 0;
   TruthValue truth_value_;
+  AtomHandle handle_;
+  // Position of this atom in the owning AtomSpace's per-type index.
+  uint32_t type_index_slot_ = 0;
 
  private:
-  static uint64_t next_id_;
+  static constexpr uint64_t kNoVersion = ~uint64_t{0};
+
+  // Versions of the owning AtomSpace that added and removed the atom, as
+  // seen by AtomSpace::ReadView. kNoVersion until that happens.
+  std::atomic<uint64_t> added_version_{kNoVersion};
+  std::atomic<uint64_t> removed_version_{kNoVersion};
+
+  friend class AtomSpace;
 };
 
 // Node atoms represent concepts, predicates, or variables
 class Node : public Atom {
  public:
+  // Atoms created without an id draw one from AtomIdAllocator::Default().
   Node(AtomType type, const std::string& name);
+  Node(AtomType type, const std::string& name, uint64_t id);
   ~Node() override = default;
 
   bool IsNode() const override { return true; }
+
+  static size_t ContentHash(AtomType type, const std::string& name);
 };
 
 // Link atoms connect other atoms
@@ -78,15 +132,32 @@ class Link : public Atom {
  public:
   Link(AtomType type, const std::string& name, 
        const std::vector<std::shared_ptr<Atom>>& outgoing);
+  Link(AtomType type, const std::string& name,
+       const std::vector<std::shared_ptr<Atom>>& outgoing, uint64_t id);
   ~Link() override = default;
 
   bool IsLink() const override { return true; }
+
+  static size_t ContentHash(AtomType type,
+                            const std::vector<std::shared_ptr<Atom>>& outgoing);
+  // The same from the content hashes of the outgoing atoms.
+  static size_t ContentHash(AtomType type,
+                            const std::vector<size_t>& outgoing_hashes);
+
   const std::vector<std::shared_ptr<Atom>>& outgoing() const { 
     return outgoing_; 
   }
+  // Handles of the outgoing atoms, parallel to outgoing(). Entries are invalid
+  // for outgoing atoms that do not live in this link's AtomSpace.
+  const std::vector<AtomHandle>& outgoing_handles() const {
+    return outgoing_handles_;
+  }
 
  private:
+  friend class AtomSpace;
+
   std::vector<std::shared_ptr<Atom>> outgoing_;
+  std::vector<AtomHandle> outgoing_handles_;
 };
 
 }  // namespace opencog
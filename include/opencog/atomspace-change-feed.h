@@ -0,0 +1,135 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_ATOMSPACE_CHANGE_FEED_H_
+#define V8_OPENCOG_ATOMSPACE_CHANGE_FEED_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "include/opencog/atom.h"
+#include "include/opencog/atomspace.h"
+#include "include/opencog/pattern.h"
+
+namespace v8 {
+namespace opencog {
+
+class AgentOrchestrator;
+
+// One change to the atoms an AtomSpaceChangeFeed subscription covers.
+struct AtomChange {
+  enum class Kind : uint8_t {
+    kAdded,
+    kRemoved,
+    kTruthValueChanged,
+    // The AtomSpace was cleared; |atom| is null.
+    kCleared,
+    // More changes arrived than the subscription buffers and were dropped;
+    // |atom| is null and the subscriber has to rescan. Always the last change
+    // of its batch.
+    kOverflowed,
+  };
+
+  Kind kind;
+  std::shared_ptr<Atom> atom;
+};
+
+// Pushes the changes of one AtomSpace to the agents that subscribed to them,
+// so that incremental reasoning costs O(changes) rather than a rescan of the
+// AtomSpace on every Execute().
+//
+// A subscription names an agent and an AtomPattern, and collects the added,
+// removed and truth value changes of the atoms matching the pattern, in the
+// order they happened. The first change after the subscriber took its batch
+// schedules the agent through AgentOrchestrator::ScheduleAgent(); further
+// changes only join the pending batch, which the agent collects in
+// Execute() with TakeChanges(). Without an orchestrator, subscribers poll
+// TakeChanges() themselves.
+//
+// Subscription patterns are matched on the thread changing the AtomSpace,
+// under its locks, so their filters must be cheap and must not call back
+// into the AtomSpace. The AtomSpace and the orchestrator must outlive the
+// feed. Thread-safe.
+class AtomSpaceChangeFeed : public AtomSpace::Observer {
+ public:
+  using SubscriptionId = uint64_t;
+
+  // Which kinds of changes a subscription collects. kCleared and kOverflowed
+  // are always delivered.
+  enum Events : uint8_t {
+    kAdded = 1 << 0,
+    kRemoved = 1 << 1,
+    kTruthValueChanged = 1 << 2,
+    kAllEvents = kAdded | kRemoved | kTruthValueChanged,
+  };
+
+  struct Options {
+    // Changes buffered per subscription before the batch collapses into a
+    // single kOverflowed.
+    size_t max_pending = 1 << 16;
+  };
+
+  AtomSpaceChangeFeed(AtomSpace* space, AgentOrchestrator* orchestrator);
+  AtomSpaceChangeFeed(AtomSpace* space, AgentOrchestrator* orchestrator,
+                      const Options& options);
+  ~AtomSpaceChangeFeed() override;
+
+  AtomSpaceChangeFeed(const AtomSpaceChangeFeed&) = delete;
+  AtomSpaceChangeFeed& operator=(const AtomSpaceChangeFeed&) = delete;
+
+  // Subscribes |agent_id| to the changes of the atoms matching |pattern|.
+  // Ids are never reused.
+  SubscriptionId Subscribe(const std::string& agent_id, AtomPattern pattern,
+                           uint8_t events = kAllEvents);
+  SubscriptionId SubscribeToType(const std::string& agent_id, AtomType type,
+                                 uint8_t events = kAllEvents);
+  // Drops the subscription and its pending changes.
+  bool Unsubscribe(SubscriptionId id);
+
+  // Hands over the changes collected for |id| since the last call, oldest
+  // first. The next change schedules the agent again.
+  std::vector<AtomChange> TakeChanges(SubscriptionId id);
+  size_t PendingCount(SubscriptionId id) const;
+  size_t subscription_count() const;
+
+  // AtomSpace::Observer implementation.
+  void OnAtomAdded(const std::shared_ptr<Atom>& atom) override;
+  void OnAtomRemoved(const std::shared_ptr<Atom>& atom) override;
+  void OnTruthValueChanged(const std::shared_ptr<Atom>& atom) override;
+  void OnCleared() override;
+
+ private:
+  struct Subscription {
+    std::string agent_id;
+    AtomPattern pattern;
+    uint8_t events;
+    std::vector<AtomChange> pending;
+    bool overflowed = false;
+  };
+
+  void Record(AtomChange::Kind kind, uint8_t event,
+              const std::shared_ptr<Atom>& atom);
+  // Appends |change| and returns whether the batch was empty before. Expects
+  // |mutex_| to be held.
+  bool Append(Subscription* subscription, AtomChange change);
+  void Notify(const std::vector<std::string>& agent_ids);
+
+  AtomSpace* const space_;
+  AgentOrchestrator* const orchestrator_;
+  const Options options_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<SubscriptionId, Subscription> subscriptions_;
+  SubscriptionId next_id_ = 1;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_ATOMSPACE_CHANGE_FEED_H_
@@ -0,0 +1,145 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_ATOMSPACE_JOURNAL_H_
+#define V8_OPENCOG_ATOMSPACE_JOURNAL_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "include/opencog/atomspace.h"
+
+namespace v8 {
+namespace opencog {
+
+// Durable, incremental persistence for one AtomSpace.
+//
+// Every mutation made through the AtomSpace (AddNode, AddLink, Commit,
+// RemoveAtom, SetTruthValue, Clear) is encoded as a checksummed record and
+// appended to an in-memory buffer. A background thread group-commits the
+// buffer to a write-ahead log and syncs it, so a mutation only pays for the
+// encoding. Once the log grows past a threshold it is compacted into a fresh
+// AtomSpaceSnapshot and started over.
+//
+// Records name atoms by content (type and name, or type and outgoing set)
+// rather than by id, and every record is idempotent, so replaying a log on
+// top of a snapshot that already contains some of its effects is harmless.
+//
+// Files in the journal directory:
+//   snapshot.bin     Last checkpoint.
+//   journal.old.log  Log being compacted by an in-progress checkpoint.
+//   journal.log      Current log.
+class AtomSpaceJournal : public AtomSpace::Observer {
+ public:
+  struct Options {
+    // The log is written and synced once this many bytes are buffered, or
+    // after |group_commit_interval|, whichever comes first.
+    size_t group_commit_bytes = 64 * 1024;
+    std::chrono::milliseconds group_commit_interval{5};
+    // A checkpoint starts once the current log reaches this size.
+    size_t checkpoint_log_bytes = 64 * 1024 * 1024;
+    // Flushes file data to stable storage after every group commit.
+    bool sync = true;
+  };
+
+  // Recovers the state in |directory| (which must exist) into |space| and
+  // starts journaling it. Returns nullptr if the directory is unusable.
+  static std::unique_ptr<AtomSpaceJournal> Open(AtomSpace* space,
+                                                const std::string& directory,
+                                                const Options& options);
+  static std::unique_ptr<AtomSpaceJournal> Open(AtomSpace* space,
+                                                const std::string& directory) {
+    return Open(space, directory, Options());
+  }
+
+  ~AtomSpaceJournal() override;
+
+  AtomSpaceJournal(const AtomSpaceJournal&) = delete;
+  AtomSpaceJournal& operator=(const AtomSpaceJournal&) = delete;
+
+  // Blocks until every mutation observed so far is durable.
+  void Flush();
+  // Compacts the log into a new snapshot. Blocks until it is written.
+  void Checkpoint();
+
+  uint64_t log_bytes() const;
+  uint64_t checkpoint_count() const;
+
+  // AtomSpace::Observer implementation.
+  void OnAtomAdded(const std::shared_ptr<Atom>& atom) override;
+  void OnAtomRemoved(const std::shared_ptr<Atom>& atom) override;
+  void OnTruthValueChanged(const std::shared_ptr<Atom>& atom) override;
+  void OnCleared() override;
+
+ private:
+  enum class RecordType : uint8_t {
+    kAddAtom = 1,
+    kRemoveAtom = 2,
+    kSetTruthValue = 3,
+    kClear = 4,
+  };
+
+  AtomSpaceJournal(AtomSpace* space, const std::string& directory,
+                   const Options& options);
+
+  std::string SnapshotPath() const { return directory_ + "/snapshot.bin"; }
+  std::string LogPath() const { return directory_ + "/journal.log"; }
+  std::string OldLogPath() const { return directory_ + "/journal.old.log"; }
+
+  // Replays the log at |path| into |space_|. Stops at the first torn or
+  // corrupt record. Returns false if the log had a damaged tail.
+  bool Replay(const std::string& path);
+
+  // Replaces the snapshot with the current AtomSpace state.
+  bool WriteSnapshot();
+  bool OpenLog(bool truncate);
+
+  void Append(RecordType type, const std::vector<uint8_t>& payload);
+  void WriterLoop();
+  // Writes |buffer| to the log. Requires |log_mutex_|.
+  void WriteLocked(const std::vector<uint8_t>& buffer);
+  void CheckpointLoop();
+
+  AtomSpace* space_;
+  std::string directory_;
+  Options options_;
+
+  // Serializes checkpoints.
+  std::mutex checkpoint_mutex_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable writer_cv_;
+  std::condition_variable flushed_cv_;
+  std::condition_variable checkpoint_cv_;
+  std::vector<uint8_t> buffer_;
+  // Sequence numbers of appended and durable records.
+  uint64_t appended_ = 0;
+  uint64_t durable_ = 0;
+  size_t flush_waiters_ = 0;
+  bool stopping_ = false;
+  bool checkpoint_requested_ = false;
+  bool checkpoint_running_ = false;
+  uint64_t checkpoints_ = 0;
+
+  // Guards the log file. Held while writing a group commit and while the
+  // log is rotated by a checkpoint.
+  mutable std::mutex log_mutex_;
+  std::FILE* log_ = nullptr;
+  uint64_t log_bytes_ = 0;
+
+  std::thread writer_thread_;
+  std::thread checkpoint_thread_;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_ATOMSPACE_JOURNAL_H_
@@ -0,0 +1,121 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_ATOMSPACE_SNAPSHOT_H_
+#define V8_OPENCOG_ATOMSPACE_SNAPSHOT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "include/opencog/atom.h"
+
+namespace v8 {
+namespace opencog {
+
+class AtomSpace;
+
+// Compact, position independent binary image of an AtomSpace.
+//
+// The image is designed to be mapped into memory and queried in place: atoms
+// are fixed-size records addressed by their index in the image, names live in
+// a shared string table, records are grouped into one contiguous section per
+// AtomType, and a content-hash table allows node lookups without building any
+// index. Mutating an atom goes through Promote(), which copies it (and its
+// outgoing set) into a live AtomSpace; the image itself is never written.
+//
+// Images use the native byte order of the machine that wrote them.
+class AtomSpaceSnapshot {
+ public:
+  static constexpr uint32_t kFormatVersion = 1;
+  static constexpr uint32_t kNoAtom = 0xFFFFFFFF;
+
+  // Read-only view of one atom record.
+  struct AtomView {
+    uint32_t index;
+    AtomType type;
+    bool is_link;
+    std::string_view name;
+    TruthValue truth_value;
+    size_t content_hash;
+    // Record indexes of the outgoing atoms. kNoAtom marks an outgoing atom
+    // that did not belong to the serialized AtomSpace.
+    const uint32_t* outgoing;
+    uint32_t outgoing_count;
+  };
+
+  ~AtomSpaceSnapshot();
+
+  AtomSpaceSnapshot(const AtomSpaceSnapshot&) = delete;
+  AtomSpaceSnapshot& operator=(const AtomSpaceSnapshot&) = delete;
+
+  // Serializes every atom of |space|.
+  static std::vector<uint8_t> Serialize(const AtomSpace& space);
+  // Serializes what a layered |space| adds to its base: the atoms of the
+  // layer, the inherited atoms it gave another truth value and the inherited
+  // atoms its links point at. Loading the image into a fresh layer over the
+  // same base restores the view, except for removed inherited atoms, which
+  // the format cannot express. Same as Serialize() without a base.
+  static std::vector<uint8_t> SerializeLayer(const AtomSpace& space);
+  static bool WriteToFile(const AtomSpace& space, const std::string& path);
+
+  // Validates and adopts an image. Returns nullptr if the image is malformed.
+  static std::unique_ptr<AtomSpaceSnapshot> FromBuffer(
+      std::vector<uint8_t> buffer);
+  // Maps the image at |path| read-only. Pages are shared between every
+  // process that maps the same file.
+  static std::unique_ptr<AtomSpaceSnapshot> Open(const std::string& path);
+
+  uint32_t atom_count() const;
+  AtomView GetAtom(uint32_t index) const;
+
+  // Record indexes of the atoms of |type| are the contiguous range
+  // [first, first + count).
+  struct TypeSection {
+    uint32_t first;
+    uint32_t count;
+  };
+  TypeSection GetTypeSection(AtomType type) const;
+
+  std::optional<uint32_t> FindNode(AtomType type, std::string_view name) const;
+
+  // Copies the atom at |index| and, for links, its outgoing set into |space|
+  // so that it can be mutated. Promotion is idempotent thanks to interning.
+  std::shared_ptr<Atom> Promote(uint32_t index, AtomSpace* space) const;
+
+  // Materializes the whole image into |space| with a single batch commit.
+  void LoadInto(AtomSpace* space) const;
+
+ private:
+  struct Header;
+  struct AtomRecord;
+
+  AtomSpaceSnapshot(const uint8_t* data, size_t size);
+
+  // |atoms| must be grouped by type.
+  static std::vector<uint8_t> SerializeAtoms(
+      const AtomSpace& space, const std::vector<std::shared_ptr<Atom>>& atoms);
+
+  static bool Validate(const uint8_t* data, size_t size);
+
+  const Header& header() const;
+  const AtomRecord& record(uint32_t index) const;
+
+  const uint8_t* data_;
+  size_t size_;
+  // Owned storage for images created with FromBuffer().
+  std::vector<uint8_t> buffer_;
+  // Mapping for images created with Open().
+  void* mapping_ = nullptr;
+  size_t mapping_size_ = 0;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_ATOMSPACE_SNAPSHOT_H_
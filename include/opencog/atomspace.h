@@ -5,56 +5,455 @@
 #ifndef V8_OPENCOG_ATOMSPACE_H_
 #define V8_OPENCOG_ATOMSPACE_H_
 
+#include <array>
+#include <atomic>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 
+#include "include/opencog/atom-arena.h"
+#include "include/opencog/atom-batch.h"
+#include "include/opencog/atom-id-allocator.h"
 #include "include/opencog/atom.h"
+#include "include/opencog/pattern.h"
+#include "include/opencog/tenant-registry.h"
 
 namespace v8 {
 namespace opencog {
 
-// Multi-tenant AtomSpace for neuro-symbolic knowledge representation
+class AtomSpaceNode;
+class AtomSpaceTransport;
+class DistributedAtomSpace;
+
+// Multi-tenant AtomSpace for neuro-symbolic knowledge representation.
+//
+// Atoms are interned: a node is identified by (type, name) and a link by
+// (type, outgoing). Adding an atom that already exists returns the existing
+// one, so repeated inserts are idempotent.
+//
+// The indexes are split into independently locked shards so that concurrent
+// readers never serialize on a single lock. Each shard is guarded by a
+// reader-writer lock; lookups take a shared lock on exactly one shard and only
+// block while a writer is mutating that same shard. Writers acquire shard
+// locks in a fixed order (link shard, name shard, id shard, type bucket) to
+// stay deadlock free.
+//
+// An AtomSpace may be layered over a shared base AtomSpace, which must no
+// longer be mutated. The layer holds only the delta: lookups resolve in the
+// base first and then in the layer, atoms added to the layer intern against
+// the base, and removing or updating the truth value of an inherited atom
+// shadows it in the layer without touching the base. Ids and handles of the
+// layer continue where the base's stop, so both form one id and handle space.
 class AtomSpace {
  public:
+  // Number of shards for the id and name indexes. Must be a power of two.
+  static constexpr size_t kShardCount = 16;
+
+  // Receives a notification for every mutation made through this AtomSpace.
+  // Callbacks run on the mutating thread while the index locks covering the
+  // atom are held, so notifications for one atom arrive in mutation order.
+  // Callbacks must be cheap and must not mutate the AtomSpace.
+  class Observer {
+   public:
+    virtual ~Observer() = default;
+    virtual void OnAtomAdded(const std::shared_ptr<Atom>& atom) {}
+    virtual void OnAtomRemoved(const std::shared_ptr<Atom>& atom) {}
+    virtual void OnTruthValueChanged(const std::shared_ptr<Atom>& atom) {}
+    virtual void OnCleared() {}
+  };
+
   explicit AtomSpace(const std::string& tenant_id);
+  AtomSpace(const std::string& tenant_id,
+            std::shared_ptr<const AtomSpace> base);
   ~AtomSpace() = default;
 
+  void AddObserver(Observer* observer);
+  void RemoveObserver(Observer* observer);
+
   // Atom management
   std::shared_ptr<Node> AddNode(AtomType type, const std::string& name);
   std::shared_ptr<Link> AddLink(AtomType type, const std::string& name,
                                  const std::vector<std::shared_ptr<Atom>>& outgoing);
   
+  // Interning lookups; these never create atoms.
+  std::shared_ptr<Node> GetNode(AtomType type, const std::string& name) const;
+  std::shared_ptr<Link> GetLink(
+      AtomType type, const std::vector<std::shared_ptr<Atom>>& outgoing) const;
+
+  // Bulk insert. Publishes every atom of |batch| under one critical section
+  // with index capacity reserved up front. Interning applies as for single
+  // inserts. Returns the atom for each batch entry, in entry order.
+  std::vector<std::shared_ptr<Atom>> Commit(const AtomBatch& batch);
+
   std::shared_ptr<Atom> GetAtom(uint64_t id) const;
+  // Returns the oldest atom bound to |name|, if any.
   std::shared_ptr<Atom> GetAtomByName(const std::string& name) const;
+  // Every atom bound to |name|, oldest first.
+  std::vector<std::shared_ptr<Atom>> GetAtomsByName(
+      const std::string& name) const;
   std::vector<std::shared_ptr<Atom>> GetAtomsByType(AtomType type) const;
+  size_t CountAtomsByType(AtomType type) const;
+
+  // Calls |visitor| with every atom of |type| without materializing a vector.
+  // The type bucket is read locked for the duration of the visit, so |visitor|
+  // must not add or remove atoms of |type|. Inherited atoms come first.
+  template <typename Visitor>
+  void ForEachAtomOfType(AtomType type, Visitor&& visitor) const {
+    if (base_ && !has_hidden_.load(std::memory_order_acquire)) {
+      base_->ForEachAtomOfType(type, visitor);
+    } else if (base_) {
+      // Type erased, so that the base does not instantiate another wrapper.
+      std::unordered_set<uint64_t> hidden = HiddenIds();
+      std::function<void(const std::shared_ptr<Atom>&)> visible =
+          [&hidden, &visitor](const std::shared_ptr<Atom>& atom) {
+            if (hidden.count(atom->id()) == 0) visitor(atom);
+          };
+      base_->ForEachAtomOfType(type, visible);
+    }
+    ForEachDeltaAtomOfType(type, visitor);
+  }
+  // As ForEachAtomOfType(), but only visits the atoms stored in this layer.
+  template <typename Visitor>
+  void ForEachDeltaAtomOfType(AtomType type, Visitor&& visitor) const {
+    const TypeBucket& bucket = type_bucket(type);
+    std::shared_lock<std::shared_mutex> lock(bucket.mutex);
+    for (const auto& atom : bucket.atoms) visitor(atom);
+  }
   
   bool RemoveAtom(uint64_t id);
+  // Removes the atoms with |ids| together with every link containing one of
+  // them, transitively through the incoming sets, so that no link is left
+  // pointing at a removed atom. Inherited atoms are hidden as by
+  // RemoveAtom(). The whole set goes in one critical section: each index
+  // shard is purged in a single pass, the passes spread over |parallelism|
+  // threads, and purged shards then release the capacity they no longer
+  // need. Returns the number of atoms removed.
+  size_t RemoveAtoms(const std::vector<uint64_t>& ids, size_t parallelism = 1);
   void Clear();
-  
+
+  // Updates the truth value of |atom| and notifies observers. Mutations made
+  // directly through Atom::set_truth_value() are not observed, and would
+  // leak into the base for inherited atoms.
+  void SetTruthValue(const std::shared_ptr<Atom>& atom, const TruthValue& tv);
+  // As SetTruthValue() but without notifying observers, for restoring state
+  // that observers have seen before, such as snapshots and journal replay.
+  void RestoreTruthValue(const std::shared_ptr<Atom>& atom,
+                         const TruthValue& tv);
+  // The truth value of |atom| as seen through this AtomSpace, which differs
+  // from Atom::truth_value() for inherited atoms updated in this layer.
+  TruthValue GetTruthValue(const Atom& atom) const;
+
+  // Non-owning view of the atom behind |handle|, or nullptr if the handle is
+  // not in use. The pointer stays valid while the atom is in this AtomSpace.
+  const Atom* Resolve(AtomHandle handle) const {
+    if (handle.value() < base_handle_limit_) return ResolveInherited(handle);
+    const Atom* atom = arena_->Resolve(handle);
+    // Removed atoms keep their handle while read views can see them.
+    if (atom != nullptr && atom->removed_version_.load(
+                               std::memory_order_acquire) != Atom::kNoVersion) {
+      return nullptr;
+    }
+    return atom;
+  }
+
   size_t Size() const;
+  // Atoms stored in this layer itself, that is Size() without inherited atoms.
+  size_t DeltaSize() const;
+  // Bytes of atom storage held by this layer. Index and name storage is not
+  // included; see GetMemoryStats().
+  size_t ArenaBytes() const { return arena_->slab_bytes(); }
+
+  // Bytes held by this layer, by what holds them. Inherited atoms count for
+  // the base. Hash index sizes are estimated from their bucket and entry
+  // counts.
+  struct MemoryStats {
+    // Arena slabs of the atoms, and the outgoing sets of links.
+    size_t atom_bytes = 0;
+    size_t id_index_bytes = 0;
+    size_t name_index_bytes = 0;
+    size_t link_index_bytes = 0;
+    size_t type_index_bytes = 0;
+    size_t incoming_index_bytes = 0;
+    // Pooled names of the atoms; see AtomName. A name that atoms of other
+    // AtomSpaces share counts in each of them.
+    size_t string_bytes = 0;
+    size_t distinct_names = 0;
+
+    size_t index_bytes() const {
+      return id_index_bytes + name_index_bytes + link_index_bytes +
+             type_index_bytes + incoming_index_bytes;
+    }
+    size_t total_bytes() const {
+      return atom_bytes + index_bytes() + string_bytes;
+    }
+  };
+  // Visits every index shard, one at a time under a shared lock, so this
+  // costs a scan of the layer.
+  MemoryStats GetMemoryStats() const;
   const std::string& tenant_id() const { return tenant_id_; }
+  const AtomIdAllocator& id_allocator() const { return id_allocator_; }
+
+  const std::shared_ptr<const AtomSpace>& base() const { return base_; }
+  // Whether |atom| belongs to the base rather than to this layer.
+  bool IsInherited(const Atom& atom) const {
+    return atom.handle().value() < base_handle_limit_;
+  }
+  // Inherited atoms whose truth value this layer overrides.
+  std::vector<std::shared_ptr<Atom>> GetOverriddenAtoms() const;
+  // Number of inherited atoms removed from this layer's view.
+  size_t HiddenCount() const {
+    return hidden_count_.load(std::memory_order_relaxed);
+  }
+
+  // Links that contain the atom with |id| in their outgoing set.
+  std::vector<std::shared_ptr<Link>> GetIncomingSet(uint64_t id) const;
+  size_t IncomingSetSize(uint64_t id) const;
 
   // Pattern matching and queries
   std::vector<std::shared_ptr<Atom>> Query(
       const std::function<bool(const std::shared_ptr<Atom>&)>& predicate) const;
 
+  // Indexed pattern matching. PlanQuery() picks the most selective index for
+  // |pattern| (name, incoming set, type) and Match() evaluates the pattern
+  // starting from that index, so the cost follows the candidate count rather
+  // than the size of the AtomSpace.
+  QueryPlan PlanQuery(const AtomPattern& pattern) const;
+  std::vector<std::shared_ptr<Atom>> Match(const AtomPattern& pattern) const;
+
+  // Consistent view of the atoms of an AtomSpace as of one version, for long
+  // scans that must neither block writers nor see them half done.
+  //
+  // Opening a view pins the current version. Atoms added afterwards stay
+  // invisible to it and atoms removed afterwards stay visible; the memory
+  // of the latter is reclaimed once no open view can reach them anymore.
+  // Iterating takes no locks. Truth values are not versioned, so a view
+  // reads them as they are now. Views must not outlive their AtomSpace.
+  class ReadView {
+   public:
+    ~ReadView();
+
+    ReadView(const ReadView&) = delete;
+    ReadView& operator=(const ReadView&) = delete;
+
+    uint64_t version() const { return version_; }
+
+    // Calls |visitor| with every atom of the view as a const Atom&, which
+    // stays valid while the view is open. Inherited atoms come first.
+    template <typename Visitor>
+    void ForEachAtom(Visitor&& visitor) const {
+      if (base_) {
+        // Type-erased, so that visiting the base does not instantiate this
+        // once per layer.
+        base_->ForEachAtom(
+            std::function<void(const Atom&)>([this, &visitor](const Atom& a) {
+              if (hidden_.count(a.id()) == 0) visitor(a);
+            }));
+      }
+      const AtomArena& arena = *space_->arena_;
+      for (uint32_t handle = first_handle_; handle < handle_limit_; ++handle) {
+        const Atom* atom = arena.Resolve(AtomHandle(handle));
+        if (atom != nullptr && Sees(*atom)) visitor(*atom);
+      }
+    }
+    template <typename Visitor>
+    void ForEachAtomOfType(AtomType type, Visitor&& visitor) const {
+      ForEachAtom([type, &visitor](const Atom& atom) {
+        if (atom.type() == type) visitor(atom);
+      });
+    }
+
+    std::vector<const Atom*> Query(
+        const std::function<bool(const Atom&)>& predicate) const;
+    size_t Size() const;
+
+   private:
+    friend class AtomSpace;
+
+    ReadView(const AtomSpace* space, uint64_t version, uint64_t sequence);
+
+    bool Sees(const Atom& atom) const {
+      return atom.added_version_.load(std::memory_order_acquire) <=
+                 version_ &&
+             atom.removed_version_.load(std::memory_order_acquire) > version_;
+    }
+
+    const AtomSpace* const space_;
+    const uint64_t version_;
+    const uint64_t sequence_;
+    // Handles of this layer's atoms as of the pinned version.
+    uint32_t first_handle_ = 0;
+    uint32_t handle_limit_ = 0;
+    // Inherited atoms hidden at the pinned version, and a view of the base.
+    std::unordered_set<uint64_t> hidden_;
+    std::unique_ptr<ReadView> base_;
+  };
+
+  std::unique_ptr<ReadView> OpenReadView() const;
+
  private:
+  struct alignas(64) IdShard {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<uint64_t, std::shared_ptr<Atom>> atoms;
+    // Incoming sets of the atoms whose id maps to this shard.
+    std::unordered_map<uint64_t, std::vector<std::shared_ptr<Link>>> incoming;
+  };
+
+  // Maps a name to every atom carrying it, oldest first. Doubles as the node
+  // interning table since a node's (type, name) key hashes by name. Keys view
+  // the pooled name of their atoms, which lives as long as they do.
+  struct alignas(64) NameShard {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<std::string_view, std::vector<std::shared_ptr<Atom>>>
+        atoms;
+  };
+
+  // Link interning table keyed by Link::content_hash().
+  struct alignas(64) LinkShard {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<size_t, std::vector<std::shared_ptr<Link>>> links;
+  };
+
+  // Dense per-type index. Atoms store their slot in the bucket so that
+  // removal is a constant time swap with the last element.
+  struct alignas(64) TypeBucket {
+    mutable std::shared_mutex mutex;
+    std::vector<std::shared_ptr<Atom>> atoms;
+  };
+
+  TypeBucket& type_bucket(AtomType type) const {
+    return type_buckets_[static_cast<size_t>(type)];
+  }
+  IdShard& id_shard(uint64_t id) const {
+    return id_shards_[id & (kShardCount - 1)];
+  }
+  NameShard& name_shard(const std::string& name) const {
+    return name_shards_[std::hash<std::string>{}(name) & (kShardCount - 1)];
+  }
+  LinkShard& link_shard(size_t content_hash) const {
+    return link_shards_[content_hash & (kShardCount - 1)];
+  }
+
+  static std::shared_ptr<Node> FindNodeLocked(const NameShard& shard,
+                                              AtomType type,
+                                              const std::string& name);
+  static std::shared_ptr<Link> FindLinkLocked(
+      const LinkShard& shard, size_t content_hash, AtomType type,
+      const std::vector<std::shared_ptr<Atom>>& outgoing);
+
+  // Inserts |atom| into the id and type indexes. The caller must hold the
+  // exclusive lock of the name shard for |atom->name()|, and for links also
+  // the lock of the link shard for |atom->content_hash()|.
+  void InsertLocked(const std::shared_ptr<Atom>& atom);
+  void AddToIncomingSets(const std::shared_ptr<Link>& link);
+  void RemoveFromIncomingSets(const Link& link);
+
+  std::shared_ptr<Node> NewNode(AtomType type, const std::string& name);
+  std::shared_ptr<Link> NewLink(
+      AtomType type, const std::string& name,
+      const std::vector<std::shared_ptr<Atom>>& outgoing);
+
+  // Calls |callback| with every outgoing atom of |link| that has an incoming
+  // set entry: atoms of this AtomSpace, each at most once.
+  template <typename Callback>
+  static void ForEachIndexedTarget(const Link& link, Callback&& callback);
+
+  template <typename Callback>
+  void NotifyObservers(Callback&& callback) const {
+    if (!has_observers_.load(std::memory_order_acquire)) return;
+    std::shared_lock<std::shared_mutex> lock(observers_mutex_);
+    for (Observer* observer : observers_) callback(observer);
+  }
+
+  // Exclusively locks every index shard in lock order.
+  std::vector<std::unique_lock<std::shared_mutex>> LockAllShards() const;
+
+  // Lookups in the base, skipping atoms this layer hides.
+  std::shared_ptr<Node> InheritedNode(AtomType type,
+                                      const std::string& name) const;
+  std::shared_ptr<Link> InheritedLink(
+      AtomType type, const std::vector<std::shared_ptr<Atom>>& outgoing) const;
+  const Atom* ResolveInherited(AtomHandle handle) const;
+  bool IsHidden(uint64_t id) const;
+  std::unordered_set<uint64_t> HiddenIds() const;
+  bool HideInherited(const std::shared_ptr<Atom>& atom);
+
+  // Stamp atoms with a new version, as one step for read views. Removed
+  // atoms keep their handle until no open view can resolve them anymore.
+  // Retire() expects a shared lock of |version_mutex_| to be held.
+  void PublishAdded(const std::shared_ptr<Atom>* atoms, size_t count);
+  void Retire(std::vector<std::shared_ptr<Atom>> atoms);
+  void CloseReadView(uint64_t sequence) const;
+  // Expects |views_mutex_| to be held.
+  void ReclaimLocked() const;
+
   std::string tenant_id_;
-  std::unordered_map<uint64_t, std::shared_ptr<Atom>> atoms_by_id_;
-  std::unordered_map<std::string, std::shared_ptr<Atom>> atoms_by_name_;
-  std::multimap<AtomType, std::shared_ptr<Atom>> atoms_by_type_;
-  mutable std::mutex mutex_;
+  std::shared_ptr<const AtomSpace> base_;
+  // Handles and ids below these belong to the base. Zero without a base.
+  uint32_t base_handle_limit_ = 0;
+  uint64_t base_id_limit_ = 0;
+  std::shared_ptr<AtomArena> arena_;
+  AtomIdAllocator id_allocator_;
+  mutable std::array<IdShard, kShardCount> id_shards_;
+  mutable std::array<NameShard, kShardCount> name_shards_;
+  mutable std::array<LinkShard, kShardCount> link_shards_;
+  mutable std::array<TypeBucket, kAtomTypeCount> type_buckets_;
+
+  std::atomic<size_t> size_{0};
+
+  // Shadows of inherited atoms. Never held while taking another lock.
+  mutable std::shared_mutex shadow_mutex_;
+  std::unordered_set<uint64_t> hidden_;
+  std::array<size_t, kAtomTypeCount> hidden_per_type_{};
+  std::unordered_map<uint64_t, TruthValue> truth_overrides_;
+  std::atomic<size_t> hidden_count_{0};
+  std::atomic<bool> has_hidden_{false};
+
+  mutable std::shared_mutex observers_mutex_;
+  std::vector<Observer*> observers_;
+  std::atomic<bool> has_observers_{false};
+
+  // Multi-version reads. Writers stamp atoms under a shared lock of
+  // |version_mutex_| and OpenReadView() pins a version under an exclusive
+  // one, so every stamp at or below a pinned version is complete. Taken
+  // before |shadow_mutex_| and |views_mutex_|.
+  mutable std::shared_mutex version_mutex_;
+  std::atomic<uint64_t> version_{0};
+  mutable std::atomic<size_t> open_views_{0};
+
+  struct RetiredAtom {
+    std::shared_ptr<Atom> atom;
+    // Set once the handle is unregistered: the last view sequence number
+    // handed out by then. Views up to it may still hold a pointer.
+    bool unregistered = false;
+    uint64_t last_sequence = 0;
+  };
+  mutable std::mutex views_mutex_;
+  // Pinned version of every open view, by sequence number. Versions never
+  // decrease along sequence numbers.
+  mutable std::map<uint64_t, uint64_t> views_;
+  mutable uint64_t view_sequence_ = 0;
+  mutable std::vector<RetiredAtom> retired_;
 };
 
-// Global multi-tenant AtomSpace manager
+// Global multi-tenant AtomSpace manager. Tenant lookups are wait-free; see
+// TenantRegistry.
 class AtomSpaceManager {
  public:
   static AtomSpaceManager* GetInstance();
 
+  // AtomSpaces created from now on are layered over |base|, which must no
+  // longer be mutated. Existing tenants keep their layering; nullptr goes
+  // back to independent AtomSpaces.
+  void SetSharedBase(std::shared_ptr<const AtomSpace> base);
+  std::shared_ptr<const AtomSpace> shared_base() const;
+
   std::shared_ptr<AtomSpace> GetOrCreateAtomSpace(const std::string& tenant_id);
   std::shared_ptr<AtomSpace> GetAtomSpace(const std::string& tenant_id) const;
   bool RemoveAtomSpace(const std::string& tenant_id);
@@ -62,12 +461,26 @@ class AtomSpaceManager {
   std::vector<std::string> GetTenantIds() const;
   size_t TenantCount() const;
 
+  // Spreads every tenant over the nodes of |transport|, with this process as
+  // node |self|; nullptr turns distribution off again. The AtomSpace of a
+  // tenant then holds this node's partition rather than all of its atoms,
+  // and GetOrCreateDistributedAtomSpace() returns the view over every node.
+  // The transport must deliver this node's requests to node().
+  void SetTransport(AtomSpaceTransport* transport, size_t self);
+  std::shared_ptr<AtomSpaceNode> node() const;
+  // nullptr without a transport.
+  std::shared_ptr<DistributedAtomSpace> GetOrCreateDistributedAtomSpace(
+      const std::string& tenant_id);
+
  private:
   AtomSpaceManager() = default;
   ~AtomSpaceManager() = default;
   
-  mutable std::mutex mutex_;
-  std::unordered_map<std::string, std::shared_ptr<AtomSpace>> atomspaces_;
+  TenantRegistry<AtomSpace> atomspaces_;
+  mutable std::mutex shared_base_mutex_;
+  std::shared_ptr<const AtomSpace> shared_base_;
+  mutable std::mutex node_mutex_;
+  std::shared_ptr<AtomSpaceNode> node_;
 };
 
 }  // namespace opencog
@@ -0,0 +1,117 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_ATTENTION_BANK_H_
+#define V8_OPENCOG_ATTENTION_BANK_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include "include/opencog/atom.h"
+#include "include/opencog/atomspace.h"
+
+namespace v8 {
+namespace opencog {
+
+class WorkStealingExecutor;
+
+// Short- and long-term importance of an atom, as in ECAN.
+struct AttentionValue {
+  float sti = 0;
+  float lti = 0;
+};
+
+// Economic attention allocation over the atoms of one AtomSpace.
+//
+// Importance lives in two columns indexed by AtomHandle::value(), like
+// TruthValueColumn, so that whole-space passes stream over contiguous floats.
+// STI is bounded to [-max_sti, max_sti] and that range is cut into equal
+// buckets; every atom with an attention value sits in the bucket of its STI.
+// The attentional focus, the atoms with the highest STI, is read off the top
+// buckets in O(k) rather than by sorting the AtomSpace, and every update
+// keeps the index current.
+//
+// The bank observes its AtomSpace, which must outlive it, and forgets the
+// attention values of removed atoms.
+class AttentionBank : public AtomSpace::Observer {
+ public:
+  struct Options {
+    // STI is clamped to [-max_sti, max_sti].
+    float max_sti = 1000;
+    // Resolution of the focus index over the STI range.
+    size_t bucket_count = 256;
+    // Fraction of its STI an atom hands to its neighbours per Diffuse().
+    float diffusion_rate = 0.2f;
+    // Atoms with an STI at or below this do not spread importance.
+    float diffusion_threshold = 0;
+    // Spreading atoms per diffusion task.
+    size_t diffusion_batch_size = 1024;
+  };
+
+  explicit AttentionBank(AtomSpace* space);
+  AttentionBank(AtomSpace* space, const Options& options);
+  ~AttentionBank() override;
+
+  AttentionBank(const AttentionBank&) = delete;
+  AttentionBank& operator=(const AttentionBank&) = delete;
+
+  // Zero for atoms that never got attention.
+  AttentionValue Get(AtomHandle handle) const;
+  void Set(AtomHandle handle, const AttentionValue& av);
+  // Adds |amount| to the STI of |handle|, within the bounds.
+  void Stimulate(AtomHandle handle, float amount);
+
+  // The |k| atoms with the highest STI, bucket by bucket from the top. The
+  // set is exact; within a bucket the atoms are in no particular order.
+  std::vector<AtomHandle> GetAttentionalFocus(size_t k) const;
+
+  // One round of importance diffusion: every atom above the threshold hands
+  // Options::diffusion_rate of its STI, in equal parts, to the atoms of its
+  // outgoing and incoming sets. The spreading atoms are split into batches
+  // that collect their transfers in parallel on |executor|, or on the
+  // calling thread without one. Transfers are then applied in batch order,
+  // so the outcome does not depend on scheduling. Returns the STI moved.
+  double Diffuse(WorkStealingExecutor* executor = nullptr);
+  // Moves every LTI towards its STI: lti += rate * (sti - lti).
+  void UpdateLongTermImportance(float rate);
+  // Scales every STI by |factor|, which must be in [0, 1].
+  void DecayShortTermImportance(float factor);
+
+  // Number of atoms with an attention value.
+  size_t size() const;
+
+  // AtomSpace::Observer implementation.
+  void OnAtomRemoved(const std::shared_ptr<Atom>& atom) override;
+  void OnCleared() override;
+
+ private:
+  static constexpr uint32_t kNotIndexed = 0xFFFFFFFF;
+
+  uint32_t BucketOf(float sti) const;
+  // The following expect |mutex_| to be held exclusively.
+  void Place(uint32_t slot, float sti);
+  void Unindex(uint32_t slot);
+  void RemoveFromBucket(uint32_t slot);
+  void Reindex();
+
+  AtomSpace* const space_;
+  const Options options_;
+
+  mutable std::shared_mutex mutex_;
+  std::vector<float> sti_;
+  std::vector<float> lti_;
+  // Per slot: the bucket holding it, or kNotIndexed, and its position there.
+  std::vector<uint32_t> bucket_of_;
+  std::vector<uint32_t> position_;
+  std::vector<std::vector<uint32_t>> buckets_;
+  size_t size_ = 0;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_ATTENTION_BANK_H_
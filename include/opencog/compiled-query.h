@@ -0,0 +1,168 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_COMPILED_QUERY_H_
+#define V8_OPENCOG_COMPILED_QUERY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "include/opencog/atom.h"
+#include "include/opencog/pattern.h"
+
+namespace v8 {
+namespace opencog {
+
+class AtomSpace;
+
+// The atom bound to each variable of a PatternQuery, by variable number.
+using QueryBindings = std::vector<std::shared_ptr<Atom>>;
+
+// A PatternQuery compiled into a join plan for its shape.
+//
+// The clauses are joined one at a time, as nested loops. Compile() orders
+// them greedily by the number of candidates each would produce given the
+// variables bound by the clauses before it, estimated from the index
+// cardinalities of the AtomSpace, and picks the index every step draws its
+// candidates from. Each step's checks are lowered to a short instruction
+// sequence in which binding a variable and comparing against an earlier
+// binding are decided statically, so a candidate costs a few compares and
+// no lookups.
+//
+// A plan only refers to the constants of its query by position, so it runs
+// any query of the same shape, with that query's constants.
+class CompiledQuery {
+ public:
+  // How a step finds its candidates.
+  enum class Access : uint8_t {
+    kBound,        // The atom already bound to the clause's variable.
+    kNameLookup,   // The atoms carrying the clause's name.
+    kIncomingSet,  // The incoming set of a constant or bound outgoing atom.
+    kTypeScan,     // Every atom of the clause's type.
+    kFullScan,     // Every atom in the AtomSpace.
+  };
+
+  static std::unique_ptr<CompiledQuery> Compile(const AtomSpace& space,
+                                                const PatternQuery& query);
+
+  // Runs the plan against |space| with the constants of |query|, which must
+  // have the shape this plan was compiled for. Returns every binding of the
+  // variables under which all clauses match.
+  std::vector<QueryBindings> Execute(const AtomSpace& space,
+                                     const PatternQuery& query) const;
+
+  // Identifies the shape of |query|: clause structure, types, arities and
+  // variables, but not the atoms and names it mentions.
+  static std::string ShapeOf(const PatternQuery& query);
+
+  const std::string& shape() const { return shape_; }
+  size_t variable_count() const { return variable_count_; }
+  // Query clause joined at each step.
+  std::vector<size_t> ClauseOrder() const;
+  Access AccessAt(size_t step) const { return steps_[step].access; }
+  // Atoms in the AtomSpace when the plan was compiled.
+  size_t compiled_for_size() const { return compiled_for_size_; }
+
+ private:
+  enum class Op : uint8_t {
+    kCheckType,              // operand: AtomType
+    kCheckName,              // operand: name constant
+    kCheckArity,             // operand: arity; also checks IsLink()
+    kCheckOutgoingAtom,      // index: position, operand: atom constant
+    kCheckOutgoingVariable,  // index: position, operand: variable
+    kBindOutgoing,           // index: position, operand: variable
+    kCheckSelf,              // operand: variable
+    kBindSelf,               // operand: variable
+  };
+
+  struct Instruction {
+    Op op;
+    uint32_t index;
+    uint32_t operand;
+  };
+
+  struct Step {
+    size_t clause;
+    Access access;
+    // kBound: variable. kNameLookup: name constant. kIncomingSet: atom
+    // constant, or variable with |anchor_is_variable|. kTypeScan: AtomType.
+    uint32_t anchor = 0;
+    bool anchor_is_variable = false;
+    std::vector<Instruction> program;
+  };
+
+  // The constants of a query, in the order ShapeOf() visits them.
+  struct Constants {
+    std::vector<std::shared_ptr<Atom>> atoms;
+    std::vector<const std::string*> names;
+  };
+  static Constants ConstantsOf(const PatternQuery& query);
+
+  CompiledQuery() = default;
+
+  std::vector<std::shared_ptr<Atom>> Candidates(
+      const AtomSpace& space, const Step& step, const Constants& constants,
+      const QueryBindings& bindings) const;
+  static bool Run(const std::vector<Instruction>& program,
+                  const std::shared_ptr<Atom>& atom,
+                  const Constants& constants, QueryBindings* bindings);
+  void Join(const AtomSpace& space, size_t step, const Constants& constants,
+            QueryBindings* bindings, std::vector<QueryBindings>* results) const;
+
+  std::string shape_;
+  size_t variable_count_ = 0;
+  size_t atom_count_ = 0;
+  size_t name_count_ = 0;
+  size_t compiled_for_size_ = 0;
+  std::vector<Step> steps_;
+};
+
+// Compiled plans of one AtomSpace, by query shape, so that a query shape is
+// planned once and then only executed. A plan is recompiled once the
+// AtomSpace has grown or shrunk by more than Options::replan_factor since it
+// was compiled, as its join order may no longer fit. Thread-safe.
+class QueryCache {
+ public:
+  struct Options {
+    // Shapes kept; the cache is emptied when a new shape would exceed it.
+    size_t capacity = 256;
+    size_t replan_factor = 2;
+  };
+
+  explicit QueryCache(const AtomSpace* space);
+  QueryCache(const AtomSpace* space, const Options& options);
+
+  QueryCache(const QueryCache&) = delete;
+  QueryCache& operator=(const QueryCache&) = delete;
+
+  std::shared_ptr<const CompiledQuery> Get(const PatternQuery& query);
+  std::vector<QueryBindings> Execute(const PatternQuery& query) {
+    return Get(query)->Execute(*space_, query);
+  }
+
+  size_t size() const;
+  size_t hits() const;
+  size_t compilations() const;
+
+ private:
+  bool IsStale(const CompiledQuery& plan) const;
+
+  const AtomSpace* const space_;
+  const Options options_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, std::shared_ptr<const CompiledQuery>> plans_;
+  size_t hits_ = 0;
+  size_t compilations_ = 0;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_COMPILED_QUERY_H_
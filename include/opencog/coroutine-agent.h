@@ -0,0 +1,148 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_COROUTINE_AGENT_H_
+#define V8_OPENCOG_COROUTINE_AGENT_H_
+
+#include <chrono>
+#include <coroutine>
+#include <deque>
+#include <exception>
+#include <string>
+
+#include "include/opencog/agent.h"
+
+namespace v8 {
+namespace opencog {
+
+// Coroutine frame of a CoroutineAgent. Created suspended; owns the frame.
+class AgentTask {
+ public:
+  struct promise_type {
+    AgentTask get_return_object() {
+      return AgentTask(Handle::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+    void return_void() {}
+    void unhandled_exception() { exception = std::current_exception(); }
+
+    std::exception_ptr exception;
+  };
+
+  AgentTask() = default;
+  AgentTask(AgentTask&& other) noexcept;
+  AgentTask& operator=(AgentTask&& other) noexcept;
+  AgentTask(const AgentTask&) = delete;
+  AgentTask& operator=(const AgentTask&) = delete;
+  ~AgentTask();
+
+  bool valid() const { return static_cast<bool>(handle_); }
+  bool done() const { return !handle_ || handle_.done(); }
+
+  // Runs the coroutine up to its next suspension point. Rethrows an
+  // exception that escaped the coroutine body.
+  void Resume();
+
+ private:
+  using Handle = std::coroutine_handle<promise_type>;
+
+  explicit AgentTask(Handle handle) : handle_(handle) {}
+
+  Handle handle_;
+};
+
+// Agent written as a single coroutine. Run() suspends on
+//
+//   co_await ReceiveMessage()   the next message, in arrival order,
+//   co_await SleepFor(delay)    a timer on the orchestrator,
+//   co_await Yield()            a fresh activation behind other queued work,
+//
+// and holds no thread while suspended, so many mostly idle agents share a few
+// orchestrator threads. The coroutine is always resumed from within one of
+// the agent's activations, so Run() never races with itself. AtomSpace calls
+// are synchronous; a long query should Yield() between chunks.
+//
+// The first ScheduleAgent() starts Run(). Messages arriving before Run()
+// waits for one are buffered in arrival order.
+class CoroutineAgent : public Agent {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  CoroutineAgent(const std::string& agent_id, const std::string& tenant_id);
+  ~CoroutineAgent() override;
+
+  // Starts Run() or resumes it if its timer has expired or it yielded.
+  void Execute() final;
+  void OnMessage(const AgentMessage& message) final;
+
+  // Whether Run() has returned or thrown.
+  bool finished() const { return task_.valid() && task_.done(); }
+
+ protected:
+  virtual AgentTask Run() = 0;
+
+  class MessageAwaiter {
+   public:
+    explicit MessageAwaiter(CoroutineAgent* agent) : agent_(agent) {}
+    bool await_ready() const { return !agent_->inbox_.empty(); }
+    void await_suspend(std::coroutine_handle<>) {
+      agent_->waiting_ = Wait::kMessage;
+    }
+    AgentMessage await_resume();
+
+   private:
+    CoroutineAgent* agent_;
+  };
+
+  class SleepAwaiter {
+   public:
+    SleepAwaiter(CoroutineAgent* agent, Clock::duration delay)
+        : agent_(agent), delay_(delay) {}
+    // Without an orchestrator there is no timer, and the sleep is skipped.
+    bool await_ready() const {
+      return delay_ <= Clock::duration::zero() ||
+             agent_->orchestrator_ == nullptr;
+    }
+    void await_suspend(std::coroutine_handle<>);
+    void await_resume() const {}
+
+   private:
+    CoroutineAgent* agent_;
+    Clock::duration delay_;
+  };
+
+  class YieldAwaiter {
+   public:
+    explicit YieldAwaiter(CoroutineAgent* agent) : agent_(agent) {}
+    bool await_ready() const { return false; }
+    void await_suspend(std::coroutine_handle<>);
+    void await_resume() const {}
+
+   private:
+    CoroutineAgent* agent_;
+  };
+
+  MessageAwaiter ReceiveMessage() { return MessageAwaiter(this); }
+  SleepAwaiter SleepFor(Clock::duration delay) {
+    return SleepAwaiter(this, delay);
+  }
+  YieldAwaiter Yield() { return YieldAwaiter(this); }
+
+ private:
+  // What the suspended coroutine waits for.
+  enum class Wait { kNone, kMessage, kTimer, kYield };
+
+  void Resume();
+
+  AgentTask task_;
+  Wait waiting_ = Wait::kNone;
+  Clock::time_point wake_time_;
+  std::deque<AgentMessage> inbox_;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_COROUTINE_AGENT_H_
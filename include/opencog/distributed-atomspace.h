@@ -0,0 +1,349 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_DISTRIBUTED_ATOMSPACE_H_
+#define V8_OPENCOG_DISTRIBUTED_ATOMSPACE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "include/opencog/atom-batch.h"
+#include "include/opencog/atom.h"
+#include "include/opencog/atomspace.h"
+#include "include/opencog/pattern.h"
+#include "include/opencog/tenant-registry.h"
+
+namespace v8 {
+namespace opencog {
+
+// A request to the partition of one tenant on one node.
+//
+// Atoms are named by content, never by id or handle: the entries of |batch|
+// and the outgoing atoms of |pattern| may belong to any AtomSpace, and the
+// receiver looks up or creates its own atom with the same content. Every
+// field can therefore be encoded like an AtomSpaceJournal record.
+struct PartitionRequest {
+  enum class Kind {
+    kAdd,            // Creates the atoms of |batch|.
+    kGet,            // Looks up the atoms of |batch|.
+    kRemove,         // Removes the atoms of |batch|.
+    kSetTruthValue,  // Sets |truth_values| on the atoms of |batch|.
+    kMatch,          // Matches |pattern|; its filter is not sent.
+    kSize            // Counts the atoms the receiver owns.
+  };
+
+  std::string tenant_id;
+  Kind kind = Kind::kGet;
+  AtomBatch batch;
+  std::vector<TruthValue> truth_values;
+  AtomPattern pattern;
+};
+
+struct PartitionResponse {
+  // kAdd and kGet: the receiver's atom for every batch entry, or nullptr.
+  // kMatch: the matching atoms the receiver owns.
+  std::vector<std::shared_ptr<Atom>> atoms;
+  // Parallel to |atoms|; default for nullptr entries.
+  std::vector<TruthValue> truth_values;
+  // kRemove: atoms removed. kSize: atoms owned.
+  size_t count = 0;
+};
+
+// Tells the other nodes that atoms of a tenant owned by |from| were removed
+// or changed their truth value, so that cached copies must be dropped.
+struct PartitionInvalidation {
+  std::string tenant_id;
+  size_t from = 0;
+  std::vector<size_t> content_hashes;
+  // Every cached atom of |from| is stale, e.g. after a Clear().
+  bool all = false;
+};
+
+// Hash partitioning of atoms over nodes. The owner follows from the content
+// hash alone, so every node agrees on it without asking. Content hashes
+// build on std::hash, hence all nodes must run the same build.
+class AtomPartitioner {
+ public:
+  explicit AtomPartitioner(size_t node_count)
+      : node_count_(node_count == 0 ? 1 : node_count) {}
+
+  size_t node_count() const { return node_count_; }
+
+  size_t OwnerOf(size_t content_hash) const {
+    // HashCombine leaves the low bits poorly mixed; finish like splitmix64.
+    uint64_t x = content_hash;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return static_cast<size_t>((x ^ (x >> 31)) % node_count_);
+  }
+  size_t OwnerOf(const Atom& atom) const {
+    return OwnerOf(atom.content_hash());
+  }
+
+ private:
+  size_t node_count_;
+};
+
+// Carries PartitionRequests and PartitionInvalidations between the nodes of
+// a cluster. Implementations decide the encoding and the wire; nodes are
+// numbered from zero.
+class AtomSpaceTransport {
+ public:
+  // The receiving side of a node, for all its tenants.
+  class Endpoint {
+   public:
+    virtual ~Endpoint() = default;
+    virtual PartitionResponse HandlePartitionRequest(
+        const PartitionRequest& request) = 0;
+    virtual void HandleInvalidation(
+        const PartitionInvalidation& invalidation) = 0;
+  };
+
+  virtual ~AtomSpaceTransport() = default;
+
+  virtual size_t node_count() const = 0;
+
+  // Sends |request| to |node| and waits for its response.
+  virtual PartitionResponse Call(size_t node,
+                                 const PartitionRequest& request) = 0;
+  // Sends every (node, request) pair and returns the responses in the same
+  // order. Fan-out goes through here, so transports that can have several
+  // requests in flight should override the default, which calls Call() for
+  // one pair after the other.
+  virtual std::vector<PartitionResponse> CallEach(
+      const std::vector<std::pair<size_t, PartitionRequest>>& calls);
+
+  // Delivers |invalidation| to every node but invalidation.from. Delivery
+  // may be asynchronous but must keep the order of one sender.
+  virtual void Broadcast(const PartitionInvalidation& invalidation) = 0;
+};
+
+// Transport between nodes of one process, e.g. one per isolate, calling
+// their endpoints directly. Attach every node before the first request.
+class LoopbackTransport : public AtomSpaceTransport {
+ public:
+  explicit LoopbackTransport(size_t node_count)
+      : endpoints_(node_count, nullptr) {}
+
+  void Attach(size_t node, Endpoint* endpoint) { endpoints_[node] = endpoint; }
+
+  // Requests sent so far, for tests and statistics.
+  size_t call_count() const {
+    return call_count_.load(std::memory_order_relaxed);
+  }
+
+  // AtomSpaceTransport implementation.
+  size_t node_count() const override { return endpoints_.size(); }
+  PartitionResponse Call(size_t node,
+                         const PartitionRequest& request) override;
+  void Broadcast(const PartitionInvalidation& invalidation) override;
+
+ private:
+  std::vector<Endpoint*> endpoints_;
+  std::atomic<size_t> call_count_{0};
+};
+
+// The partition of one tenant held by one node: the atoms the node owns,
+// plus replicas of the outgoing atoms of its links that other nodes own.
+// Replicas let links be interned and matched locally; they are not atoms
+// of the partition and their truth values are meaningless.
+//
+// The partition observes its AtomSpace and broadcasts an invalidation for
+// every owned atom that is removed or gets a new truth value.
+class AtomSpacePartition : public AtomSpace::Observer {
+ public:
+  AtomSpacePartition(std::shared_ptr<AtomSpace> space,
+                     AtomSpaceTransport* transport, size_t self);
+  ~AtomSpacePartition() override;
+
+  AtomSpacePartition(const AtomSpacePartition&) = delete;
+  AtomSpacePartition& operator=(const AtomSpacePartition&) = delete;
+
+  PartitionResponse Handle(const PartitionRequest& request);
+
+  // Broadcasts the invalidations collected since the last flush. Handle()
+  // flushes by itself; call this after mutating space() directly.
+  void FlushInvalidations();
+
+  bool Owns(const Atom& atom) const {
+    return partitioner_.OwnerOf(atom) == self_;
+  }
+  // This partition's atom with the content of |atom|, if any.
+  std::shared_ptr<Atom> Find(const std::shared_ptr<Atom>& atom) const;
+  size_t OwnedCount() const;
+
+  const std::shared_ptr<AtomSpace>& space() const { return space_; }
+  const AtomPartitioner& partitioner() const { return partitioner_; }
+  size_t self() const { return self_; }
+
+  // AtomSpace::Observer implementation.
+  void OnAtomRemoved(const std::shared_ptr<Atom>& atom) override;
+  void OnTruthValueChanged(const std::shared_ptr<Atom>& atom) override;
+  void OnCleared() override;
+
+ private:
+  // This partition's atoms for the entries of |batch|, created if |create|.
+  std::vector<std::shared_ptr<Atom>> Resolve(const AtomBatch& batch,
+                                             bool create);
+  void Invalidate(const Atom& atom);
+
+  const std::shared_ptr<AtomSpace> space_;
+  AtomSpaceTransport* const transport_;
+  const size_t self_;
+  const AtomPartitioner partitioner_;
+
+  std::mutex pending_mutex_;
+  std::vector<size_t> pending_;
+  bool pending_all_ = false;
+};
+
+// One tenant's AtomSpace spread over the nodes of a transport, as used by
+// the code running on one of them.
+//
+// The methods follow AtomSpace. Each atom lives on the node its content
+// hashes to: requests for atoms of this node go straight to the local
+// partition, the others become one request per owning node, so a Commit()
+// or Match() costs a round trip to each node involved rather than one per
+// atom. Queries fan out to every node.
+//
+// Atoms read from other nodes are copied into a local cache AtomSpace along
+// with their truth value and served from there until the owner invalidates
+// them. Returned atoms thus belong to the local partition or to the cache;
+// they identify the distributed atom by content and can be passed back in.
+class DistributedAtomSpace {
+ public:
+  struct Options {
+    // Atoms of other nodes kept in the cache, oldest evicted first.
+    size_t cache_capacity = 64 * 1024;
+  };
+
+  DistributedAtomSpace(std::shared_ptr<AtomSpacePartition> local,
+                       AtomSpaceTransport* transport);
+  DistributedAtomSpace(std::shared_ptr<AtomSpacePartition> local,
+                       AtomSpaceTransport* transport, const Options& options);
+
+  DistributedAtomSpace(const DistributedAtomSpace&) = delete;
+  DistributedAtomSpace& operator=(const DistributedAtomSpace&) = delete;
+
+  std::shared_ptr<Node> AddNode(AtomType type, const std::string& name);
+  std::shared_ptr<Link> AddLink(
+      AtomType type, const std::string& name,
+      const std::vector<std::shared_ptr<Atom>>& outgoing);
+  // Sends every owning node its share of |batch|, together with the entries
+  // its links refer to, in one request.
+  std::vector<std::shared_ptr<Atom>> Commit(const AtomBatch& batch);
+
+  std::shared_ptr<Node> GetNode(AtomType type, const std::string& name);
+  std::shared_ptr<Link> GetLink(
+      AtomType type, const std::vector<std::shared_ptr<Atom>>& outgoing);
+  // Looks up the entries of |batch| with one request per owning node,
+  // bypassing the cache. Entries without an atom come back as nullptr.
+  std::vector<std::shared_ptr<Atom>> Fetch(const AtomBatch& batch);
+
+  bool RemoveAtom(const std::shared_ptr<Atom>& atom);
+  void SetTruthValue(const std::shared_ptr<Atom>& atom, const TruthValue& tv);
+  TruthValue GetTruthValue(const std::shared_ptr<Atom>& atom);
+
+  // Sends |pattern| to every node at once and applies its filter here.
+  std::vector<std::shared_ptr<Atom>> Match(const AtomPattern& pattern);
+  size_t Size();
+
+  // Drops the cached atoms named by |invalidation|.
+  void Invalidate(const PartitionInvalidation& invalidation);
+  size_t cached_count() const;
+
+  const std::string& tenant_id() const { return local_->space()->tenant_id(); }
+  const std::shared_ptr<AtomSpacePartition>& partition() const {
+    return local_;
+  }
+
+ private:
+  using Calls = std::vector<std::pair<size_t, PartitionRequest>>;
+
+  // Serves the calls for this node from the local partition and the rest
+  // through the transport.
+  std::vector<PartitionResponse> CallEach(const Calls& calls);
+  // Sends every entry of |batch| to its owner, together with the entries
+  // its links refer to, as one request of |kind| per owner. Returns the
+  // atom for every entry.
+  std::vector<std::shared_ptr<Atom>> RouteAndCall(
+      const AtomBatch& batch, PartitionRequest::Kind kind);
+  // Turns an atom received from |node| into the one to hand out: itself for
+  // this node, or the cache copy, which is remembered unless an
+  // invalidation arrived since |epoch|.
+  std::shared_ptr<Atom> Receive(size_t node, const std::shared_ptr<Atom>& atom,
+                                const TruthValue& tv, uint64_t epoch);
+  // |copy| if it is the valid cache copy for |content_hash|.
+  std::shared_ptr<Atom> FindCached(size_t content_hash,
+                                   std::shared_ptr<Atom> copy) const;
+  uint64_t epoch() const;
+  void Drop(size_t content_hash);
+  // The following expect |cache_mutex_| to be held.
+  void DropLocked(size_t content_hash);
+  void EvictLocked();
+
+  const std::shared_ptr<AtomSpacePartition> local_;
+  AtomSpaceTransport* const transport_;
+  const Options options_;
+
+  // The cache. |cache_| holds the copies, including the outgoing atoms of
+  // cached links; |cached_| the copies that are valid, by content hash.
+  AtomSpace cache_;
+  mutable std::mutex cache_mutex_;
+  std::unordered_map<size_t, std::shared_ptr<Atom>> cached_;
+  std::deque<size_t> cache_order_;
+  // Bumped by every invalidation, so that responses that crossed one are
+  // not cached.
+  uint64_t epoch_ = 0;
+};
+
+// The tenants of one node: the partition each one keeps here and the
+// DistributedAtomSpace through which this node uses it. Serves as the
+// node's transport endpoint.
+class AtomSpaceNode : public AtomSpaceTransport::Endpoint {
+ public:
+  using AtomSpaceFactory =
+      std::function<std::shared_ptr<AtomSpace>(const std::string& tenant_id)>;
+
+  // Partitions are kept in AtomSpaces from |factory|, or fresh ones.
+  AtomSpaceNode(AtomSpaceTransport* transport, size_t self);
+  AtomSpaceNode(AtomSpaceTransport* transport, size_t self,
+                AtomSpaceFactory factory);
+
+  AtomSpaceNode(const AtomSpaceNode&) = delete;
+  AtomSpaceNode& operator=(const AtomSpaceNode&) = delete;
+
+  std::shared_ptr<DistributedAtomSpace> GetOrCreate(
+      const std::string& tenant_id);
+  std::shared_ptr<DistributedAtomSpace> Find(
+      const std::string& tenant_id) const;
+  bool Remove(const std::string& tenant_id);
+
+  size_t self() const { return self_; }
+
+  // AtomSpaceTransport::Endpoint implementation.
+  PartitionResponse HandlePartitionRequest(
+      const PartitionRequest& request) override;
+  void HandleInvalidation(const PartitionInvalidation& invalidation) override;
+
+ private:
+  AtomSpaceTransport* const transport_;
+  const size_t self_;
+  const AtomSpaceFactory factory_;
+  TenantRegistry<DistributedAtomSpace> tenants_;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_DISTRIBUTED_ATOMSPACE_H_
@@ -0,0 +1,202 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_EMBEDDING_INDEX_H_
+#define V8_OPENCOG_EMBEDDING_INDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <shared_mutex>
+#include <vector>
+
+#include "include/opencog/atom.h"
+#include "include/opencog/atomspace.h"
+
+namespace v8 {
+namespace opencog {
+
+// Approximate nearest-neighbour index over embeddings attached to the atoms
+// of one AtomSpace, for hybrid symbolic and vector retrieval ("the ConceptNodes
+// closest to this embedding") without a separate vector store.
+//
+// Embeddings are fixed-size float vectors, set per AtomHandle. They are
+// stored in one contiguous column and indexed by a hierarchical navigable
+// small world graph (HNSW): Search() descends the sparse upper layers
+// greedily and runs a bounded best-first search on the dense bottom layer,
+// so a query visits O(ef * log n) vectors instead of all of them. Distance
+// kernels are SIMD.
+//
+// The index observes its AtomSpace, which must outlive it, and drops the
+// embedding of every removed atom. Removal only marks the graph node, which
+// keeps observer callbacks cheap; marked nodes still route searches but are
+// never returned, and the graph is rebuilt from the live embeddings by the
+// next Set() once Options::max_deleted_fraction of it is marked.
+//
+// Search() and SearchBatch() may run concurrently with each other; updates
+// are exclusive.
+class EmbeddingIndex : public AtomSpace::Observer {
+ public:
+  enum class Metric : uint8_t {
+    // Squared Euclidean distance.
+    kL2,
+    // 1 - cos(a, b). Embeddings are normalized when they are set.
+    kCosine,
+  };
+
+  struct Options {
+    Metric metric = Metric::kCosine;
+    // Neighbours per node on the upper layers; the bottom layer keeps twice
+    // as many.
+    size_t max_neighbors = 16;
+    // Candidate list size while inserting. Larger builds a better graph,
+    // more slowly.
+    size_t ef_construction = 128;
+    // Default candidate list size while searching, raised to k if smaller.
+    size_t ef_search = 64;
+    // Marked nodes that make the next Set() rebuild the graph.
+    double max_deleted_fraction = 0.5;
+    // Seeds the layer assignment, so that builds are reproducible.
+    uint32_t seed = 42;
+  };
+
+  struct Neighbor {
+    AtomHandle handle;
+    float distance;
+  };
+
+  EmbeddingIndex(AtomSpace* space, size_t dimension);
+  EmbeddingIndex(AtomSpace* space, size_t dimension, const Options& options);
+  ~EmbeddingIndex() override;
+
+  EmbeddingIndex(const EmbeddingIndex&) = delete;
+  EmbeddingIndex& operator=(const EmbeddingIndex&) = delete;
+
+  size_t dimension() const { return dimension_; }
+  Metric metric() const { return options_.metric; }
+
+  // Sets the embedding of |handle| to the dimension() floats at |vector|,
+  // replacing any previous one. Returns false, and changes nothing, if the
+  // handle does not name an atom of the AtomSpace, or if a cosine embedding
+  // is all zero.
+  bool Set(AtomHandle handle, const float* vector);
+  bool Set(AtomHandle handle, const std::vector<float>& vector) {
+    return vector.size() == dimension_ && Set(handle, vector.data());
+  }
+  bool Remove(AtomHandle handle);
+  bool Contains(AtomHandle handle) const;
+  // The stored embedding of |handle|, which is normalized for kCosine. Empty
+  // if there is none.
+  std::vector<float> Get(AtomHandle handle) const;
+  // Number of atoms with an embedding.
+  size_t size() const;
+
+  // The |k| atoms nearest to the dimension() floats at |query|, nearest
+  // first. |ef| trades speed for recall; 0 uses Options::ef_search.
+  std::vector<Neighbor> Search(const float* query, size_t k,
+                               size_t ef = 0) const;
+  // Answers |count| queries stored back to back at |queries| under one lock,
+  // sharing the search scratch space between them.
+  std::vector<std::vector<Neighbor>> SearchBatch(const float* queries,
+                                                 size_t count, size_t k,
+                                                 size_t ef = 0) const;
+  // Exact answer by scanning every embedding, to measure recall against.
+  std::vector<Neighbor> SearchExact(const float* query, size_t k) const;
+
+  // Rebuilds the graph from the live embeddings only.
+  void Compact();
+
+  // AtomSpace::Observer implementation.
+  void OnAtomRemoved(const std::shared_ptr<Atom>& atom) override;
+  void OnCleared() override;
+
+ private:
+  static constexpr uint32_t kNoNode = 0xFFFFFFFF;
+
+  struct GraphNode {
+    AtomHandle handle;
+    bool deleted = false;
+    // Neighbour lists, one per layer from the bottom up.
+    std::vector<std::vector<uint32_t>> links;
+  };
+
+  // Marks of the nodes visited by one search. Clearing is O(1) by epoch, so
+  // a batch reuses one set for all of its queries.
+  class VisitedSet {
+   public:
+    explicit VisitedSet(size_t size) : marks_(size, 0) {}
+    void Reset();
+    // Returns true if |node| was not visited yet.
+    bool Visit(uint32_t node);
+
+   private:
+    std::vector<uint32_t> marks_;
+    uint32_t epoch_ = 1;
+  };
+
+  struct Candidate {
+    float distance;
+    uint32_t node;
+    bool operator<(const Candidate& other) const {
+      return distance < other.distance;
+    }
+    bool operator>(const Candidate& other) const {
+      return distance > other.distance;
+    }
+  };
+
+  const float* vector_of(uint32_t node) const {
+    return vectors_.data() + static_cast<size_t>(node) * dimension_;
+  }
+  float Distance(const float* a, const float* b) const;
+  // Copies |vector| into |out|, normalized for kCosine. Returns false for a
+  // zero cosine vector.
+  bool Prepare(const float* vector, float* out) const;
+
+  // The following expect |mutex_| to be held exclusively.
+  void Insert(AtomHandle handle, const float* prepared);
+  void Mark(uint32_t slot);
+  void Rebuild();
+  void Reset();
+  size_t MaxLinks(int layer) const;
+  // Keeps the |max| candidates that are closer to the base than to any
+  // neighbour kept before them, so that links spread in every direction.
+  std::vector<uint32_t> SelectNeighbors(std::vector<Candidate> candidates,
+                                        size_t max) const;
+
+  // The following expect |mutex_| to be held.
+  // Best-first search of |layer| from |entry|, keeping the |ef| nearest
+  // nodes, or nearest live nodes with |skip_deleted|. Returns them nearest
+  // first.
+  std::vector<Candidate> SearchLayer(const float* query, uint32_t entry,
+                                     size_t ef, int layer, VisitedSet* visited,
+                                     bool skip_deleted) const;
+  // Walks greedily from the entry point down to |to_layer| and returns the
+  // node nearest to |query| found there.
+  uint32_t GreedyDescend(const float* query, int to_layer) const;
+  std::vector<Neighbor> SearchLocked(const float* prepared, size_t k, size_t ef,
+                                     VisitedSet* visited) const;
+
+  AtomSpace* const space_;
+  const size_t dimension_;
+  const Options options_;
+  const double level_multiplier_;
+
+  mutable std::shared_mutex mutex_;
+  // Embedding of each graph node, dimension_ floats each.
+  std::vector<float> vectors_;
+  std::vector<GraphNode> nodes_;
+  // Graph node of each atom slot, or kNoNode.
+  std::vector<uint32_t> node_of_;
+  uint32_t entry_ = kNoNode;
+  int max_level_ = -1;
+  size_t deleted_ = 0;
+  std::mt19937 rng_;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_EMBEDDING_INDEX_H_
@@ -0,0 +1,99 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_FORWARD_CHAINER_H_
+#define V8_OPENCOG_FORWARD_CHAINER_H_
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "include/opencog/atom-batch.h"
+#include "include/opencog/atom.h"
+#include "include/opencog/atomspace.h"
+#include "include/opencog/pattern.h"
+
+namespace v8 {
+namespace opencog {
+
+class WorkStealingExecutor;
+
+// What a rule concludes from one or more premises: atoms to add, and the
+// truth values to give the ones that turn out to be new.
+struct RuleConclusions {
+  AtomBatch batch;
+  std::vector<std::pair<AtomBatch::Ref, TruthValue>> truth_values;
+};
+
+struct InferenceRule {
+  std::string name;
+  // The atoms the rule fires on.
+  AtomPattern premise;
+  // Adds the conclusions drawn from |premise| to |conclusions|. Runs
+  // concurrently for different premises, so it may only read |space|.
+  std::function<void(const std::shared_ptr<Atom>& premise,
+                     const AtomSpace& space, RuleConclusions* conclusions)>
+      rewrite;
+};
+
+// Forward chaining: applies rules to their premises, adds the conclusions
+// and repeats with the atoms that were new, until no rule concludes anything
+// new or Options::max_steps is reached.
+//
+// Each step has a parallel and a sequential phase. Premises are split into
+// batches, which the workers of the executor match and rewrite into batch
+// local RuleConclusions without writing to the AtomSpace. The batches are
+// then committed one after the other, each with a single
+// AtomSpace::Commit(), so the AtomSpace is locked once per batch instead of
+// once per conclusion and the outcome does not depend on scheduling.
+//
+// The first step considers every atom matching a premise pattern, later
+// steps only the atoms added by the previous one. A rule combining premises
+// should therefore also fire when any of them is the new atom, e.g.
+// deduction looking both ways along an inheritance chain.
+class ForwardChainer {
+ public:
+  struct Options {
+    size_t max_steps = 16;
+    // Premises per matching task.
+    size_t batch_size = 256;
+  };
+
+  struct Result {
+    size_t steps = 0;
+    // Rule applications, summed over the steps.
+    size_t rule_applications = 0;
+    size_t atoms_added = 0;
+    // Whether the last step added nothing, as opposed to hitting max_steps.
+    bool saturated = false;
+  };
+
+  // |executor| may be nullptr to run every step on the calling thread. Both
+  // must outlive the chainer.
+  ForwardChainer(AtomSpace* space, WorkStealingExecutor* executor);
+  ForwardChainer(AtomSpace* space, WorkStealingExecutor* executor,
+                 const Options& options);
+
+  ForwardChainer(const ForwardChainer&) = delete;
+  ForwardChainer& operator=(const ForwardChainer&) = delete;
+
+  void AddRule(InferenceRule rule);
+  size_t rule_count() const { return rules_.size(); }
+
+  Result Run();
+
+ private:
+  AtomSpace* const space_;
+  WorkStealingExecutor* const executor_;
+  const Options options_;
+  std::vector<InferenceRule> rules_;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_FORWARD_CHAINER_H_
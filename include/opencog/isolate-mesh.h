@@ -5,17 +5,28 @@
 #ifndef V8_OPENCOG_ISOLATE_MESH_H_
 #define V8_OPENCOG_ISOLATE_MESH_H_
 
-#include <map>
+#include <chrono>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
+#include "include/v8-array-buffer.h"
 #include "include/v8-isolate.h"
 #include "include/v8-context.h"
 #include "include/v8-platform.h"
+#include "include/v8-snapshot.h"
 #include "include/opencog/atomspace.h"
 #include "include/opencog/agent-orchestrator.h"
+#include "include/opencog/isolate-shard-executor.h"
+#include "include/opencog/tenant-registry.h"
 
 namespace v8 {
 namespace opencog {
@@ -25,24 +36,162 @@ struct IsolateConfig {
   size_t heap_size_limit;
   bool enable_wasm;
   bool enable_inspector;
+  // Budgets for TenantMetrics::memory_bytes(), enforced by
+  // IsolateMesh::EnforceBudget(). 0 disables a budget.
+  size_t soft_memory_budget;
+  size_t hard_memory_budget;
+  // The IsolateGroup the tenant's isolate joins. Tenants of one group share
+  // its pointer compression cage, read-only and shared spaces and shared
+  // string table, which saves memory per tenant and lets shared structs
+  // pass between them; tenants that must stay apart need different groups.
+  // Empty defers to IsolateMesh::Options::isolate_group_for_tenant, and
+  // failing that to V8's default group. Builds that support a single group
+  // put every tenant into it.
+  std::string isolate_group;
+  // Passed to v8::Isolate::SetPriority(). Best-effort tenants have V8 favour
+  // memory over speed, and are the first whose memory
+  // IsolateMesh::ReduceIdleTenantMemory() reduces.
+  v8::Isolate::Priority priority;
+  // Caps the concurrent marking of the tenant's major GCs at one worker
+  // thread, through v8::Isolate::SetBatterySaverMode(), which also makes V8
+  // tier up less eagerly. Keeps bulk tenants that mark at the same time
+  // from saturating the platform's worker threads.
+  bool limit_gc_threads;
   
   IsolateConfig() 
       : heap_size_limit(0),
         enable_wasm(true),
-        enable_inspector(false) {}
+        enable_inspector(false),
+        soft_memory_budget(0),
+        hard_memory_budget(0),
+        priority(v8::Isolate::Priority::kUserVisible),
+        limit_gc_threads(false) {}
 };
 
-// Tenant isolate context
+// Resource usage of one tenant.
+struct TenantMetrics {
+  // From Isolate::GetHeapStatistics().
+  size_t heap_used_bytes = 0;
+  size_t heap_total_bytes = 0;
+  size_t heap_limit_bytes = 0;
+  size_t external_memory_bytes = 0;
+  // The tenant's own AtomSpace layer; atoms inherited from a shared base are
+  // not charged to the tenant.
+  size_t atomspace_bytes = 0;
+  size_t atom_count = 0;
+  // Agent::run_time() summed over the tenant's agents.
+  std::chrono::nanoseconds agent_run_time{0};
+
+  // What the memory budgets are checked against.
+  size_t memory_bytes() const {
+    return heap_used_bytes + external_memory_bytes + atomspace_bytes;
+  }
+};
+
+enum class BudgetState { kWithinBudget, kOverSoftBudget, kOverHardBudget };
+
+// Keeps isolates with a tenant context ready for new tenants, so that
+// onboarding neither calls Isolate::New() nor bootstraps a context on the
+// request path. A background thread refills the pool up to Options::size.
+//
+// Pooled isolates share one ArrayBuffer allocator. With
+// Options::use_startup_snapshot they are deserialized from a startup snapshot
+// whose default context is a tenant context with the OpenCog bindings
+// installed: the blob made by the opencog_snapshot build target if given, or
+// one the pool thread builds once.
+//
+// Isolates are handed between threads without v8::Locker: the pool thread
+// has exited an isolate before publishing it under |mutex_|, and whoever
+// acquires it becomes its only user.
+class IsolatePool {
+ public:
+  struct Options {
+    // Number of isolates kept ready; 0 disables the background thread.
+    size_t size = 2;
+    // Limits of the pooled isolates. Tenants asking for other limits get a
+    // freshly created isolate.
+    IsolateConfig config;
+    bool use_startup_snapshot = true;
+    // Blob written by opencog_mksnapshot, owned by the caller and alive for
+    // as long as any isolate created from it.
+    const v8::StartupData* startup_snapshot = nullptr;
+  };
+
+  // An isolate and its tenant context, ready to be adopted by a
+  // TenantIsolate.
+  struct WarmIsolate {
+    v8::Isolate* isolate = nullptr;
+    v8::Global<v8::Context> context;
+    // The blob |isolate| was deserialized from; V8 reads it again whenever a
+    // context is created.
+    std::shared_ptr<const v8::StartupData> snapshot;
+  };
+
+  IsolatePool();
+  explicit IsolatePool(const Options& options);
+  ~IsolatePool();
+
+  IsolatePool(const IsolatePool&) = delete;
+  IsolatePool& operator=(const IsolatePool&) = delete;
+
+  // Takes a ready isolate created with |config|'s limits, without waiting.
+  // Pooled isolates belong to the default IsolateGroup.
+  std::optional<WarmIsolate> TryAcquire(const IsolateConfig& config);
+  // Creates an isolate and its tenant context on the calling thread, in the
+  // default IsolateGroup or in |group|.
+  WarmIsolate CreateIsolate(const IsolateConfig& config);
+  WarmIsolate CreateIsolate(const IsolateConfig& config,
+                            const v8::IsolateGroup& group);
+
+  size_t available() const;
+
+ private:
+  void RefillLoop();
+  static void Dispose(WarmIsolate* warm);
+
+  const Options options_;
+  const std::shared_ptr<v8::ArrayBuffer::Allocator> allocator_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable refill_needed_;
+  std::vector<WarmIsolate> ready_;
+  std::shared_ptr<const v8::StartupData> snapshot_;
+  bool stopping_ = false;
+  std::thread refill_thread_;
+};
+
+// Tenant isolate context. Owns the isolate and disposes of it when the last
+// reference goes away.
 class TenantIsolate {
  public:
   TenantIsolate(const std::string& tenant_id,
                 v8::Isolate* isolate,
                 const IsolateConfig& config);
+  // Adopts an isolate whose context is already set up.
+  TenantIsolate(const std::string& tenant_id,
+                IsolatePool::WarmIsolate warm,
+                const IsolateConfig& config);
   ~TenantIsolate();
 
+  TenantIsolate(const TenantIsolate&) = delete;
+  TenantIsolate& operator=(const TenantIsolate&) = delete;
+
+  // Creates a context with the OpenCog bindings in the current HandleScope.
+  // |isolate| must be entered.
+  static v8::Local<v8::Context> NewContext(v8::Isolate* isolate);
+
   v8::Isolate* isolate() const { return isolate_; }
   const std::string& tenant_id() const { return tenant_id_; }
+  const IsolateConfig& config() const { return config_; }
   std::shared_ptr<AtomSpace> atomspace() const { return atomspace_; }
+
+  // Heap and AtomSpace usage. Reads the isolate's heap statistics, so it
+  // must be called on the thread using the isolate, or while none does.
+  TenantMetrics CollectMetrics() const;
+  // As last determined by IsolateMesh::EnforceBudget().
+  BudgetState budget_state() const { return budget_state_; }
+  // Time since the mesh last handed out this tenant isolate.
+  std::chrono::steady_clock::duration idle_time() const;
   
   void SetupContext();
   v8::Local<v8::Context> GetContext();
@@ -53,39 +202,158 @@ class TenantIsolate {
   IsolateConfig config_;
   v8::Global<v8::Context> context_;
   std::shared_ptr<AtomSpace> atomspace_;
+  std::shared_ptr<const v8::StartupData> snapshot_;
+  BudgetState budget_state_ = BudgetState::kWithinBudget;
+  std::atomic<std::chrono::steady_clock::rep> last_used_;
+  // When IsolateMesh::ReduceIdleTenantMemory() last picked this tenant.
+  std::atomic<std::chrono::steady_clock::rep> last_memory_reduction_{0};
+
+  void Touch();
+  void ApplyGCConfig();
+
+  friend class IsolateMesh;
 };
 
 // Isolate mesh for managing multiple V8 isolates
 class IsolateMesh {
  public:
+  using BudgetCallback =
+      std::function<void(const std::string& tenant_id, BudgetState state,
+                         const TenantMetrics& metrics)>;
+
+  struct Options {
+    IsolatePool::Options isolate_pool;
+    // Throttle factor for the agents of tenants over their hard budget; see
+    // AgentScheduler::SetTenantThrottle().
+    uint32_t hard_budget_throttle = 8;
+    // Called by EnforceBudget() on every budget state change, after the
+    // mesh's own reaction.
+    BudgetCallback on_budget_change;
+    // Idle time after which HibernateIdleTenants() hibernates a tenant.
+    // Zero disables hibernation.
+    std::chrono::steady_clock::duration hibernate_after{};
+    // Threads of shard_executor(); 0 uses one per hardware thread.
+    size_t isolate_shards = 0;
+    // Names the IsolateGroup of tenants whose IsolateConfig names none, for
+    // instance one shared group for trusted tenants and the tenant id for
+    // untrusted ones. Unset, or an empty name, means the default group.
+    std::function<std::string(const std::string& tenant_id)>
+        isolate_group_for_tenant;
+    // Idle time after which ReduceIdleTenantMemory() may reduce a tenant's
+    // memory. Zero disables it.
+    std::chrono::steady_clock::duration reduce_memory_after{};
+    // Tenants ReduceIdleTenantMemory() reduces per call, across the mesh.
+    size_t memory_reductions_per_call = 1;
+  };
+
   IsolateMesh();
+  explicit IsolateMesh(const Options& options);
   ~IsolateMesh();
 
-  // Isolate lifecycle management
+  // Isolate lifecycle management. Isolates are taken from the pool or
+  // created before registering them, and lookups never wait for
+  // registration; see TenantRegistry. Looking up a hibernated tenant, or
+  // creating it again, wakes it up.
   std::shared_ptr<TenantIsolate> CreateTenantIsolate(
       const std::string& tenant_id, const IsolateConfig& config);
-  std::shared_ptr<TenantIsolate> GetTenantIsolate(
-      const std::string& tenant_id) const;
+  std::shared_ptr<TenantIsolate> GetTenantIsolate(const std::string& tenant_id);
+  // Removing a hibernated tenant puts its AtomSpace back into the
+  // AtomSpaceManager, as it stays there for a resident tenant.
   bool RemoveTenantIsolate(const std::string& tenant_id);
 
-  // Mesh operations
+  // Hibernation. A hibernated tenant holds no isolate and no AtomSpace, only
+  // an AtomSpaceSnapshot image of its AtomSpace layer. Waking it up loads
+  // the image into a new AtomSpace and gives it an isolate with a fresh
+  // tenant context, from the pool if possible. Contexts are not preserved:
+  // V8 can only snapshot an isolate that was set up by a SnapshotCreator
+  // from its creation on, so JavaScript state outside the AtomSpace is lost.
+  //
+  // A tenant is only hibernated while the mesh and the AtomSpaceManager hold
+  // the only references to its isolate and AtomSpace, and when its layer
+  // removed no inherited atoms, which the image cannot express.
+  bool HibernateTenant(const std::string& tenant_id);
+  // Hibernates every tenant idle for at least Options::hibernate_after, to
+  // be called periodically. Returns the number of tenants hibernated.
+  size_t HibernateIdleTenants();
+  bool IsHibernated(const std::string& tenant_id) const;
+
+  // Memory reduction of idle tenants, to be called periodically. Each call
+  // sends a moderate memory pressure notification, which starts a memory
+  // reducing incremental GC, to at most Options::memory_reductions_per_call
+  // tenants idle for at least Options::reduce_memory_after and used since
+  // their last reduction. Best-effort tenants go first, then those idle the
+  // longest. Run with V8's --no-memory-reducer, this replaces the per-isolate
+  // memory reducer, whose GCs tend to start in many tenants at once when
+  // load drops across the mesh, by GCs spread over successive calls.
+  // Returns the number of tenants notified.
+  size_t ReduceIdleTenantMemory();
+  size_t HibernatedCount() const { return hibernated_.size(); }
+
+  // Mesh operations. Hibernated tenants are included.
   std::vector<std::string> GetTenantIds() const;
   size_t TenantCount() const;
+  // Name of the IsolateGroup |tenant_id|'s isolate is in, empty for the
+  // default group, or nothing for unknown tenants.
+  std::optional<std::string> GetIsolateGroup(const std::string& tenant_id);
+  // Named IsolateGroups created so far.
+  size_t IsolateGroupCount() const;
+
+  // Resource accounting. GetTenantMetrics() adds the agent run time from
+  // the orchestrator, if any, to TenantIsolate::CollectMetrics() and has the
+  // same threading requirements. Returns nothing for unknown tenants.
+  std::optional<TenantMetrics> GetTenantMetrics(
+      const std::string& tenant_id) const;
+  // Checks |tenant_id| against its budgets and reacts to state changes:
+  // crossing the soft budget sends a moderate memory pressure notification,
+  // crossing the hard budget a critical one and throttles the tenant's
+  // agents, and dropping below the hard budget lifts the throttle. Returns
+  // the new state, kWithinBudget for unknown tenants.
+  BudgetState EnforceBudget(const std::string& tenant_id);
 
   // Agent orchestration integration
   void SetAgentOrchestrator(std::shared_ptr<AgentOrchestrator> orchestrator);
   std::shared_ptr<AgentOrchestrator> agent_orchestrator() const {
     return orchestrator_;
   }
+  // Runs JavaScript for the mesh's tenants, for instance for JsAgents, on
+  // isolate-pinned threads. Created on first use.
+  IsolateShardExecutor* shard_executor();
 
   // Platform management
   static void InitializePlatform(v8::Platform* platform);
   static v8::Platform* GetPlatform();
 
  private:
-  mutable std::mutex mutex_;
-  std::map<std::string, std::shared_ptr<TenantIsolate>> tenant_isolates_;
+  struct HibernatedTenant {
+    IsolateConfig config;
+    BudgetState budget_state;
+    std::vector<uint8_t> atomspace_image;
+  };
+
+  std::shared_ptr<TenantIsolate> NewTenantIsolate(
+      const std::string& tenant_id, const IsolateConfig& config);
+  // The group called |name|, created on first use. The default group for
+  // an empty name or where V8 supports no other groups.
+  v8::IsolateGroup GetOrCreateIsolateGroup(const std::string& name);
+  bool Hibernate(const std::string& tenant_id,
+                 std::chrono::steady_clock::duration min_idle_time);
+  // Returns the resident tenant isolate after waking |tenant_id| up if it is
+  // hibernated, nullptr for unknown tenants. Expects |hibernation_mutex_| to
+  // be held.
+  std::shared_ptr<TenantIsolate> Wake(const std::string& tenant_id);
+
+  const Options options_;
+  IsolatePool isolate_pool_;
+  TenantRegistry<TenantIsolate> tenant_isolates_;
+  // Serializes hibernation against waking up and creating tenants, so that
+  // a tenant is never resident and hibernated, or neither, to those.
+  std::mutex hibernation_mutex_;
+  TenantRegistry<HibernatedTenant> hibernated_;
   std::shared_ptr<AgentOrchestrator> orchestrator_;
+  mutable std::mutex isolate_groups_mutex_;
+  std::unordered_map<std::string, v8::IsolateGroup> isolate_groups_;
+  std::once_flag shard_executor_created_;
+  std::unique_ptr<IsolateShardExecutor> shard_executor_;
   static v8::Platform* platform_;
 };
 
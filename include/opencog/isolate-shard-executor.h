@@ -0,0 +1,85 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_ISOLATE_SHARD_EXECUTOR_H_
+#define V8_OPENCOG_ISOLATE_SHARD_EXECUTOR_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "include/v8-context.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+
+namespace v8 {
+namespace opencog {
+
+class TenantIsolate;
+
+// Runs JavaScript work for tenant isolates on a fixed set of threads.
+//
+// Tenants are hashed onto shards, and each shard has one thread. Every task
+// for a tenant runs on that tenant's shard thread, so an isolate is used by
+// only one thread and needs no v8::Locker, and tasks for the same tenant
+// run in the order they were posted. Once a tenant's isolate runs work here,
+// all JavaScript in it has to go through the executor.
+//
+// A shard thread takes all of its queued tasks at once. It enters each
+// tenant's isolate, HandleScope and context once for all of that tenant's
+// tasks, and then performs one microtask checkpoint. Isolates that run here
+// are switched to explicit microtask checkpoints for this.
+class IsolateShardExecutor {
+ public:
+  using Task =
+      std::function<void(v8::Isolate* isolate, v8::Local<v8::Context>)>;
+
+  // |shard_count| threads; 0 uses one per hardware thread.
+  explicit IsolateShardExecutor(size_t shard_count);
+  // Runs the tasks still queued, then joins the threads.
+  ~IsolateShardExecutor();
+
+  IsolateShardExecutor(const IsolateShardExecutor&) = delete;
+  IsolateShardExecutor& operator=(const IsolateShardExecutor&) = delete;
+
+  // Queues |task| to run in |tenant|'s context on the tenant's shard thread.
+  void Post(std::shared_ptr<TenantIsolate> tenant, Task task);
+  // Blocks until every task posted before the call has run. Must not be
+  // called from a task.
+  void Drain();
+
+  size_t ShardOf(const std::string& tenant_id) const;
+  size_t shard_count() const { return shards_.size(); }
+
+ private:
+  struct Work {
+    std::shared_ptr<TenantIsolate> tenant;
+    Task task;
+  };
+
+  struct Shard {
+    std::mutex mutex;
+    std::condition_variable work_available;
+    std::condition_variable idle;
+    std::vector<Work> queue;
+    bool busy = false;
+    bool stopping = false;
+    std::thread thread;
+  };
+
+  void Run(Shard* shard);
+  static void RunBatch(std::vector<Work>* batch);
+
+  std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_ISOLATE_SHARD_EXECUTOR_H_
@@ -0,0 +1,85 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_JS_AGENT_H_
+#define V8_OPENCOG_JS_AGENT_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "include/opencog/agent.h"
+
+namespace v8 {
+namespace opencog {
+
+class IsolateShardExecutor;
+class TenantIsolate;
+
+// Agent implemented in JavaScript in its tenant's context.
+//
+// Execute() calls the global function Options::execute_function. Each
+// message is passed to Options::message_function as an object
+// {from, to, type, topic, payload}, where the payload is a string, or the
+// deserialized value for payloads from OpenCogBindings::SerializePayload().
+// A function the context does not define is skipped.
+//
+// The calls run on the tenant's thread of an IsolateShardExecutor, not on
+// the orchestrator's: Execute() and OnMessage() only queue them and return,
+// so orchestrator threads never wait for an isolate. Calls queued while
+// earlier ones wait for the shard thread join their batch, which runs in
+// order under one HandleScope and one microtask checkpoint.
+//
+// The executor must outlive the agent.
+class JsAgent : public Agent {
+ public:
+  struct Options {
+    std::string execute_function = "execute";
+    std::string message_function = "onMessage";
+  };
+
+  JsAgent(const std::string& agent_id, std::shared_ptr<TenantIsolate> tenant,
+          IsolateShardExecutor* executor);
+  JsAgent(const std::string& agent_id, std::shared_ptr<TenantIsolate> tenant,
+          IsolateShardExecutor* executor, const Options& options);
+  ~JsAgent() override;
+
+  void Execute() override;
+  void OnMessage(const AgentMessage& message) override;
+
+  // JavaScript calls made, and those that threw.
+  uint64_t call_count() const;
+  uint64_t exception_count() const;
+
+ private:
+  // An Execute() call, or the delivery of |message|.
+  struct Call {
+    bool execute;
+    AgentMessage message;
+  };
+
+  // Shared with the tasks on the shard thread, which may outlive the agent.
+  struct State {
+    Options options;
+    std::shared_ptr<TenantIsolate> tenant;
+    std::mutex mutex;
+    // Calls for the batch task that is posted whenever this is non-empty.
+    std::vector<Call> pending;
+    std::atomic<uint64_t> calls{0};
+    std::atomic<uint64_t> exceptions{0};
+  };
+
+  void Queue(Call call);
+
+  const std::shared_ptr<State> state_;
+  IsolateShardExecutor* const executor_;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_JS_AGENT_H_
@@ -0,0 +1,121 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_OPENCOG_BINDINGS_H_
+#define V8_OPENCOG_OPENCOG_BINDINGS_H_
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <vector>
+
+#include "include/opencog/agent.h"
+#include "include/opencog/atomspace.h"
+#include "include/opencog/truth-value-column.h"
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-isolate.h"
+#include "include/v8-maybe.h"
+#include "include/v8-snapshot.h"
+#include "include/v8-value-serializer.h"
+
+namespace v8 {
+namespace opencog {
+
+// The shared objects of a JavaScript value serialized into an AgentPayload,
+// which the receiving isolate gets by reference: the backing stores of
+// SharedArrayBuffers, and the conveyor of shared structs and other values
+// of the shared heap, which only isolates sharing it can read.
+struct SerializedValueTransfers {
+  std::vector<std::shared_ptr<v8::BackingStore>> shared_array_buffers;
+  std::optional<v8::SharedValueConveyor> shared_values;
+};
+
+// JavaScript API of tenant contexts: a global |opencog| object operating on
+// the AtomSpace attached to the isolate.
+//
+//   opencog.addNode(type, name)         -> atom id
+//   opencog.addLink(type, name, [ids])  -> atom id
+//   opencog.getTruthValue(id)           -> [strength, confidence] | undefined
+//   opencog.getStrength(id)             -> number, NaN if no such atom
+//   opencog.getConfidence(id)           -> number, NaN if no such atom
+//   opencog.getType(id)                 -> atom type, -1 if no such atom
+//   opencog.setTruthValue(id, s, c)     -> whether the atom exists
+//   opencog.countAtomsByType(type)      -> number
+//   opencog.size()                      -> number
+//
+// The scalar accessors (getStrength through size) also have Fast API
+// callbacks, which optimized code calls directly instead of going through
+// FunctionCallbackInfo. Both paths share their implementation, so they throw
+// the same errors and return the same values.
+//
+// The JS prelude adds |opencog.AtomType| and convenience helpers on top.
+//
+// Building the templates and running the prelude happens once, in
+// CreateStartupSnapshot(); isolates deserialized from that blob start with
+// the API already in their default context. Such isolates must be created
+// with ExternalReferences() as CreateParams::external_references.
+class OpenCogBindings {
+ public:
+  OpenCogBindings() = delete;
+
+  // Isolate data slot holding the AtomSpace* the callbacks operate on. Set
+  // when a tenant adopts the isolate, never serialized.
+  static constexpr uint32_t kAtomSpaceDataSlot = 0;
+
+  // Null-terminated addresses of every native callback of the API,
+  // including the fast callbacks and their type information.
+  static const intptr_t* ExternalReferences();
+
+  // Creates a context with the API installed and the prelude run, in the
+  // current HandleScope. |isolate| must be entered.
+  static v8::Local<v8::Context> NewContext(v8::Isolate* isolate);
+
+  // Points the API of every context of |isolate| at |atomspace|, which must
+  // outlive the isolate or be detached with nullptr first.
+  static void AttachAtomSpace(v8::Isolate* isolate, AtomSpace* atomspace);
+
+  // Memory resource drawing from a process-wide V8 ArrayBuffer allocator.
+  // Memory from it lies inside the V8 sandbox, when that is enabled, so it
+  // can back ArrayBuffers in place.
+  static std::pmr::memory_resource* ArrayBufferMemoryResource();
+
+  // Returns {strengths, confidences} as typed arrays sharing |column|'s
+  // memory: Float64Arrays for TruthValueColumn, Float32Arrays for
+  // CompactTruthValueColumn. The arrays keep |column| alive. |column| must be
+  // allocated from ArrayBufferMemoryResource(), otherwise the result is
+  // empty, and must not be resized while the arrays are reachable.
+  static v8::MaybeLocal<v8::Object> NewTruthValueViews(
+      v8::Isolate* isolate, v8::Local<v8::Context> context,
+      std::shared_ptr<TruthValueColumn> column);
+  static v8::MaybeLocal<v8::Object> NewTruthValueViews(
+      v8::Isolate* isolate, v8::Local<v8::Context> context,
+      std::shared_ptr<CompactTruthValueColumn> column);
+
+  // Writes |value| with v8::ValueSerializer into a payload that isolates of
+  // this process can read back with DeserializePayload(), so structured
+  // agent messages need no JSON.stringify() and JSON.parse(). Values are
+  // cloned as by structuredClone(), except that SharedArrayBuffers and
+  // shared structs are passed by reference. Returns Nothing with an
+  // exception pending if |value| cannot be cloned.
+  static v8::Maybe<AgentPayload> SerializePayload(
+      v8::Isolate* isolate, v8::Local<v8::Context> context,
+      v8::Local<v8::Value> value);
+  // The value of a payload from SerializePayload(), or a string for text
+  // payloads. Every call yields a new clone.
+  static v8::MaybeLocal<v8::Value> DeserializePayload(
+      v8::Isolate* isolate, v8::Local<v8::Context> context,
+      const AgentPayload& payload);
+
+  // Serializes an isolate whose default context came from NewContext().
+  // Returns an empty blob on failure; the caller owns |data| otherwise.
+  static v8::StartupData CreateStartupSnapshot(
+      std::shared_ptr<v8::ArrayBuffer::Allocator> allocator);
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_OPENCOG_BINDINGS_H_
@@ -0,0 +1,109 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_PATTERN_H_
+#define V8_OPENCOG_PATTERN_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "include/opencog/atom.h"
+
+namespace v8 {
+namespace opencog {
+
+// Declarative description of the atoms a query is looking for. All set fields
+// must match. Unlike an opaque predicate, the indexed fields let the AtomSpace
+// pick the cheapest index to start from.
+struct AtomPattern {
+  std::optional<AtomType> type;
+  std::optional<std::string> name;
+
+  // If non-empty, only links with exactly this arity match. A nullptr entry is
+  // a wildcard; any other entry must be the very atom at that position.
+  std::vector<std::shared_ptr<Atom>> outgoing;
+
+  // Residual filter applied to the candidates produced by the index.
+  std::function<bool(const std::shared_ptr<Atom>&)> filter;
+
+  // Whether |atom| satisfies every set field, including |filter|.
+  bool Matches(const std::shared_ptr<Atom>& atom) const;
+};
+
+// How an AtomPattern is evaluated.
+struct QueryPlan {
+  enum class Strategy {
+    kNameLookup,   // Single candidate from the name index.
+    kIncomingSet,  // Incoming set of the most selective bound outgoing atom.
+    kTypeScan,     // Every atom of the pattern's type.
+    kFullScan      // Every atom in the AtomSpace.
+  };
+
+  Strategy strategy = Strategy::kFullScan;
+  // Estimated number of candidates the strategy visits.
+  size_t estimated_candidates = 0;
+  // For kIncomingSet, the atom whose incoming set is scanned.
+  std::shared_ptr<Atom> anchor;
+};
+
+// One position of a PatternClause's outgoing set.
+struct PatternTerm {
+  enum class Kind : uint8_t {
+    kAny,       // Matches every atom.
+    kAtom,      // Must be the very atom |atom|.
+    kVariable,  // Binds variable |variable|, or must equal its binding.
+  };
+
+  static PatternTerm Any() { return PatternTerm(); }
+  static PatternTerm Of(std::shared_ptr<Atom> atom) {
+    PatternTerm term;
+    term.kind = Kind::kAtom;
+    term.atom = std::move(atom);
+    return term;
+  }
+  static PatternTerm Variable(uint32_t variable) {
+    PatternTerm term;
+    term.kind = Kind::kVariable;
+    term.variable = variable;
+    return term;
+  }
+
+  Kind kind = Kind::kAny;
+  uint32_t variable = 0;
+  std::shared_ptr<Atom> atom;
+};
+
+// An AtomPattern whose outgoing positions, and the matched atom itself, may
+// be variables shared with the other clauses of a PatternQuery.
+struct PatternClause {
+  std::optional<AtomType> type;
+  std::optional<std::string> name;
+  // If non-empty, only links with exactly this arity match.
+  std::vector<PatternTerm> outgoing;
+  // Variable bound to the matched atom, if any.
+  std::optional<uint32_t> variable;
+};
+
+// Conjunctive query: every clause must match, with each variable bound to
+// the same atom in all clauses. Variables are numbered from zero.
+//
+// The atoms and names in a query are its constants; the rest is its shape.
+// Queries of the same shape share one CompiledQuery, see QueryCache.
+struct PatternQuery {
+  std::vector<PatternClause> clauses;
+
+  // One more than the highest variable used.
+  size_t variable_count() const;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_PATTERN_H_
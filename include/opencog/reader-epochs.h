@@ -0,0 +1,86 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_READER_EPOCHS_H_
+#define V8_OPENCOG_READER_EPOCHS_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <thread>
+
+namespace v8 {
+namespace opencog {
+
+// Grace periods for structures whose readers take no lock.
+//
+// Readers open a Scope around every access. A writer that unpublished some
+// memory calls Synchronize(), which returns once every Scope that might
+// still see it has closed, and then frees it. Scopes never wait; a
+// Synchronize() costs the longest concurrent read.
+//
+// Readers announce themselves on one of several cache-line sized counters,
+// picked per thread, for the current of two epochs. Synchronize() flips the
+// epoch twice and drains the counters of the epoch it left each time; a
+// reader that announced itself too late for a drain is ordered after the
+// unpublishing store and cannot hold the old memory.
+class ReaderEpochs {
+ public:
+  class Scope {
+   public:
+    explicit Scope(const ReaderEpochs* epochs) {
+      size_t epoch = epochs->epoch_.load(std::memory_order_seq_cst);
+      readers_ = &epochs->stripes_[epoch][StripeIndex()].readers;
+      readers_->fetch_add(1, std::memory_order_seq_cst);
+    }
+    ~Scope() { readers_->fetch_sub(1, std::memory_order_release); }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    std::atomic<size_t>* readers_;
+  };
+
+  ReaderEpochs() = default;
+  ReaderEpochs(const ReaderEpochs&) = delete;
+  ReaderEpochs& operator=(const ReaderEpochs&) = delete;
+
+  // Must be called with seq_cst stores unpublishing the memory in question
+  // before it, and by one writer at a time.
+  void Synchronize() {
+    for (int flip = 0; flip < 2; ++flip) {
+      size_t epoch = epoch_.load(std::memory_order_relaxed);
+      epoch_.store(epoch ^ 1, std::memory_order_seq_cst);
+      for (const ReaderStripe& stripe : stripes_[epoch]) {
+        while (stripe.readers.load(std::memory_order_seq_cst) != 0) {
+          std::this_thread::yield();
+        }
+      }
+    }
+  }
+
+ private:
+  static constexpr size_t kReaderStripes = 32;
+
+  struct alignas(64) ReaderStripe {
+    std::atomic<size_t> readers{0};
+  };
+
+  static size_t StripeIndex() {
+    static thread_local const size_t index =
+        std::hash<std::thread::id>{}(std::this_thread::get_id()) %
+        kReaderStripes;
+    return index;
+  }
+
+  std::atomic<size_t> epoch_{0};
+  mutable std::array<std::array<ReaderStripe, kReaderStripes>, 2> stripes_;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_READER_EPOCHS_H_
@@ -0,0 +1,119 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_TENANT_REGISTRY_H_
+#define V8_OPENCOG_TENANT_REGISTRY_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "include/opencog/reader-epochs.h"
+
+namespace v8 {
+namespace opencog {
+
+// Read-mostly map from tenant id to a shared per-tenant object.
+//
+// The map is copy-on-write. Lookups read the current copy without taking a
+// lock and never wait, so resolving the tenant of a request does not
+// serialize requests. Writers are serialized by a mutex, publish a modified
+// copy and then wait until no reader can still see the previous copy before
+// freeing it. A mutation therefore costs a copy of the map plus the longest
+// concurrent lookup, which suits onboarding and removal rates; see
+// ReaderEpochs.
+template <typename T>
+class TenantRegistry {
+ public:
+  using Map = std::unordered_map<std::string, std::shared_ptr<T>>;
+
+  TenantRegistry() : map_(new Map()) {}
+  ~TenantRegistry() { delete map_.load(std::memory_order_relaxed); }
+
+  TenantRegistry(const TenantRegistry&) = delete;
+  TenantRegistry& operator=(const TenantRegistry&) = delete;
+
+  std::shared_ptr<T> Find(const std::string& tenant_id) const {
+    ReaderEpochs::Scope scope(&epochs_);
+    const Map* map = map_.load(std::memory_order_seq_cst);
+    auto it = map->find(tenant_id);
+    return (it != map->end()) ? it->second : nullptr;
+  }
+
+  // Calls |visitor| with every (tenant id, object) pair of one consistent
+  // copy of the map. |visitor| must not mutate the registry.
+  template <typename Visitor>
+  void ForEach(Visitor&& visitor) const {
+    ReaderEpochs::Scope scope(&epochs_);
+    const Map* map = map_.load(std::memory_order_seq_cst);
+    for (const auto& pair : *map) visitor(pair.first, pair.second);
+  }
+
+  size_t size() const {
+    ReaderEpochs::Scope scope(&epochs_);
+    return map_.load(std::memory_order_seq_cst)->size();
+  }
+
+  // Returns the object of |tenant_id|, registering |value| if there is none.
+  std::shared_ptr<T> Insert(const std::string& tenant_id,
+                            std::shared_ptr<T> value) {
+    return FindOrInsert(tenant_id, [&value]() { return std::move(value); });
+  }
+
+  // As Insert(), but creates the object with |factory| and only if the
+  // tenant is missing. |factory| runs under the writer lock.
+  template <typename Factory>
+  std::shared_ptr<T> FindOrInsert(const std::string& tenant_id,
+                                  Factory&& factory) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    const Map* map = map_.load(std::memory_order_relaxed);
+    auto it = map->find(tenant_id);
+    if (it != map->end()) return it->second;
+    std::shared_ptr<T> value = factory();
+    auto next = std::make_unique<Map>(*map);
+    next->emplace(tenant_id, value);
+    Publish(std::move(next));
+    return value;
+  }
+
+  // Unregisters |tenant_id| and hands back its object, if any, so that the
+  // caller decides where the last reference is dropped.
+  std::shared_ptr<T> Remove(const std::string& tenant_id) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    const Map* map = map_.load(std::memory_order_relaxed);
+    auto it = map->find(tenant_id);
+    if (it == map->end()) return nullptr;
+    std::shared_ptr<T> removed = it->second;
+    auto next = std::make_unique<Map>(*map);
+    next->erase(tenant_id);
+    Publish(std::move(next));
+    return removed;
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    Publish(std::make_unique<Map>());
+  }
+
+ private:
+  // Replaces the map with |next| and frees the previous one once no reader
+  // can see it anymore. The caller must hold |write_mutex_|.
+  void Publish(std::unique_ptr<Map> next) {
+    std::unique_ptr<const Map> previous(
+        map_.exchange(next.release(), std::memory_order_seq_cst));
+    epochs_.Synchronize();
+  }
+
+  std::atomic<const Map*> map_;
+  ReaderEpochs epochs_;
+  std::mutex write_mutex_;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_TENANT_REGISTRY_H_
@@ -0,0 +1,100 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_TRUTH_VALUE_COLUMN_H_
+#define V8_OPENCOG_TRUTH_VALUE_COLUMN_H_
+
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
+
+#include "include/opencog/atom.h"
+
+namespace v8 {
+namespace opencog {
+
+class AtomSpace;
+
+// Structure-of-arrays copy of the truth values of an AtomSpace, indexed by
+// AtomHandle::value(). Whole-space passes (PLN revision, confidence decay,
+// threshold scans) run over the two contiguous columns with SIMD kernels
+// instead of visiting every heap Atom.
+//
+// Atoms keep their inline TruthValue, which stays authoritative. A pass
+// Load()s the column once, runs any number of kernels over it and Store()s the
+// result back, which routes changed values through AtomSpace::SetTruthValue()
+// so observers such as the journal see them.
+//
+// Slots without an atom hold (0, 0). Zero confidence is the identity of every
+// kernel, so empty slots never need to be skipped and are never reported.
+template <typename T>
+class BasicTruthValueColumn {
+ public:
+  static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+                "truth values are stored as float or double");
+
+  BasicTruthValueColumn() = default;
+  explicit BasicTruthValueColumn(size_t size) { Resize(size); }
+  // Allocates the columns from |resource|, which must outlive the column.
+  explicit BasicTruthValueColumn(std::pmr::memory_resource* resource)
+      : strengths_(resource), confidences_(resource) {}
+
+  size_t size() const { return strengths_.size(); }
+  std::pmr::memory_resource* memory_resource() const {
+    return strengths_.get_allocator().resource();
+  }
+  // Grows or shrinks the column. New slots are empty.
+  void Resize(size_t size);
+
+  // Returns (0, 0) for empty slots and handles outside the column.
+  TruthValue Get(AtomHandle handle) const;
+  // Grows the column to cover |handle| if needed.
+  void Set(AtomHandle handle, const TruthValue& tv);
+  void Reset(AtomHandle handle);
+  bool Contains(AtomHandle handle) const {
+    return handle.is_valid() && handle.value() < size() &&
+           confidences_[handle.value()] > 0;
+  }
+
+  const T* strengths() const { return strengths_.data(); }
+  const T* confidences() const { return confidences_.data(); }
+  // Writable columns, for memory shared with kernels outside this class.
+  // Writes must keep empty slots at zero confidence.
+  T* mutable_strengths() { return strengths_.data(); }
+  T* mutable_confidences() { return confidences_.data(); }
+
+  // Replaces the column contents with the truth values of |space|.
+  void Load(const AtomSpace& space);
+  // Writes every occupied slot whose value differs from its atom back into
+  // |space|. Returns the number of atoms updated.
+  size_t Store(AtomSpace* space) const;
+
+  // Confidence-weighted revision with |evidence|, slot by slot:
+  //   s = (s1 * c1 + s2 * c2) / (c1 + c2),  c = c1 + c2 - c1 * c2.
+  // Slots past the end of |evidence| are left unchanged.
+  void Revise(const BasicTruthValueColumn& evidence);
+  // Scales every confidence by |factor|, which must be in [0, 1].
+  void Decay(double factor);
+  // Handles of the occupied slots with strength >= |min_strength| and
+  // confidence >= |min_confidence|, in handle order.
+  std::vector<AtomHandle> Filter(double min_strength,
+                                 double min_confidence) const;
+
+ private:
+  std::pmr::vector<T> strengths_;
+  std::pmr::vector<T> confidences_;
+};
+
+extern template class BasicTruthValueColumn<float>;
+extern template class BasicTruthValueColumn<double>;
+
+using TruthValueColumn = BasicTruthValueColumn<double>;
+// Half the memory traffic, at float precision.
+using CompactTruthValueColumn = BasicTruthValueColumn<float>;
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_TRUTH_VALUE_COLUMN_H_
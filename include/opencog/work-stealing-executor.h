@@ -0,0 +1,80 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_OPENCOG_WORK_STEALING_EXECUTOR_H_
+#define V8_OPENCOG_WORK_STEALING_EXECUTOR_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace v8 {
+namespace opencog {
+
+// Fixed pool of worker threads with one task deque per worker.
+//
+// A task submitted from a worker goes to the back of that worker's deque and
+// is popped LIFO, which keeps follow-up work on the core that produced it.
+// Tasks submitted from other threads are spread round-robin. A worker whose
+// deque is empty steals the oldest task from the front of another worker's
+// deque before going to sleep.
+class WorkStealingExecutor {
+ public:
+  using Task = std::function<void()>;
+
+  explicit WorkStealingExecutor(size_t worker_count);
+  ~WorkStealingExecutor();
+
+  WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+  WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+  void Submit(Task task);
+
+  // Calls |body| with every index in [0, count) and returns once all calls
+  // have returned. The calling thread takes part, so this may be called from
+  // a task without starving the pool. |body| must not throw.
+  void ParallelFor(size_t count, const std::function<void(size_t)>& body);
+
+  // Runs every queued task, including tasks submitted by running tasks, then
+  // joins the workers. Submit() must not be called afterwards.
+  void Shutdown();
+
+  size_t worker_count() const { return workers_.size(); }
+  uint64_t steal_count() const {
+    return steals_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct alignas(64) Worker {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+  };
+
+  bool TryPop(size_t index, Task* task);
+  bool TrySteal(size_t thief, Task* task);
+  void WorkerLoop(size_t index);
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::thread> threads_;
+  std::atomic<size_t> next_worker_{0};
+  // Tasks that are queued but not yet taken by a worker.
+  std::atomic<size_t> queued_{0};
+  std::atomic<size_t> sleepers_{0};
+  std::atomic<uint64_t> steals_{0};
+
+  std::mutex idle_mutex_;
+  std::condition_variable idle_cv_;
+  bool stopping_ = false;
+};
+
+}  // namespace opencog
+}  // namespace v8
+
+#endif  // V8_OPENCOG_WORK_STEALING_EXECUTOR_H_
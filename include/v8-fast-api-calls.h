@@ -235,6 +235,7 @@ class CTypeInfo {
     kPointer,
     kV8Value,
     kSeqOneByteString,
+    kSeqTwoByteString,
     kApiObject,  // This will be deprecated once all users have
                  // migrated from v8::ApiObject to v8::Local<v8::Value>.
     kAny,        // This is added to enable untyped representation of fast
@@ -301,6 +302,14 @@ struct FastOneByteString {
   uint32_t length;
 };
 
+// A view of the characters of a flat, sequential two-byte string. The view
+// is only valid for the duration of the fast call; the callback must not
+// allocate on the V8 heap or call back into JavaScript while holding it.
+struct FastTwoByteString {
+  const uint16_t* data;
+  uint32_t length;
+};
+
 class V8_EXPORT CFunctionInfo {
  public:
   enum class Int64Representation : uint8_t {
@@ -373,6 +382,7 @@ union V8_TRIVIAL_ABI AnyCType {
   Local<Object> object_value;
   Local<Array> sequence_value;
   const FastOneByteString* string_value;
+  const FastTwoByteString* two_byte_string_value;
   FastApiCallbackOptions* options_value;
 };
 
@@ -591,6 +601,15 @@ struct TypeInfoHelper<const FastOneByteString&> {
   }
 };
 
+template <>
+struct TypeInfoHelper<const FastTwoByteString&> {
+  static constexpr CTypeInfo::Flags Flags() { return CTypeInfo::Flags::kNone; }
+
+  static constexpr CTypeInfo::Type Type() {
+    return CTypeInfo::Type::kSeqTwoByteString;
+  }
+};
+
 #define STATIC_ASSERT_IMPLIES(COND, ASSERTION, MSG) \
   static_assert(((COND) == 0) || (ASSERTION), MSG)
 
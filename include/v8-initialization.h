@@ -261,6 +261,19 @@ class V8_EXPORT V8 {
    */
   static bool EnableWebAssemblyTrapHandler(bool use_v8_signal_handler);
 
+  /**
+   * Returns whether the garbage collector scans native stacks conservatively
+   * (--conservative-stack-scanning). Objects referenced from a stack are then
+   * kept alive and pinned, so they do not move.
+   *
+   * In builds with V8_ENABLE_DIRECT_HANDLE, which always scan conservatively,
+   * a Local<> is the object pointer itself and does not occupy a slot in a
+   * HandleScope. Bindings on hot paths may then create Locals without opening
+   * a HandleScope of their own; V8 still requires one to be open, as it is in
+   * every callback.
+   */
+  static bool IsConservativeStackScanningEnabled();
+
 #if defined(V8_OS_WIN)
   /**
    * On Win64, by default V8 does not emit unwinding data for jitted code,
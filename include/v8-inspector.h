@@ -303,6 +303,12 @@ class V8_EXPORT V8InspectorClient {
     consoleAPIMessage(contextGroupId, level, message, url, lineNumber,
                       columnNumber, stackTrace);
   }
+  // Whether console messages are kept so that they can be reported to a
+  // session that enables the Runtime domain later. Embedders that consume
+  // console messages only through consoleAPIMessage() can return false: while
+  // no session listens, the logged values are then neither retained nor
+  // wrapped for the protocol, and only the message text is built.
+  virtual bool retainConsoleMessages(int contextGroupId) { return true; }
   virtual v8::MaybeLocal<v8::Value> memoryInfo(v8::Isolate*,
                                                v8::Local<v8::Context>) {
     return v8::MaybeLocal<v8::Value>();
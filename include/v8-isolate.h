@@ -35,6 +35,7 @@ namespace v8 {
 class CppHeap;
 class HeapProfiler;
 class MicrotaskQueue;
+class PersistentCompilationCache;
 class StartupData;
 class ScriptOrModule;
 class SharedArrayBuffer;
@@ -1699,6 +1700,12 @@ class V8_EXPORT Isolate {
   void SetModifyCodeGenerationFromStringsCallback(
       ModifyCodeGenerationFromStringsCallback2 callback);
 
+  /**
+   * Sets the embedder's persistent tier of the compilation cache, or removes
+   * it for nullptr. The cache must outlive the isolate or be removed first.
+   */
+  void SetPersistentCompilationCache(PersistentCompilationCache* cache);
+
   /**
    * Set the callback to invoke to check if wasm code generation should
    * be allowed.
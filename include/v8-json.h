@@ -8,12 +8,14 @@
 #include <optional>
 
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
 #include "v8-message.h"       // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
 
 class Context;
+class OutputStream;
 class Value;
 class String;
 
@@ -47,6 +49,22 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Like Stringify, but writes the result as UTF-8 to |stream| while the
+   * object is serialized, instead of creating a string. The chunks are at
+   * most |stream->GetChunkSize()| bytes long. EndOfStream is called after the
+   * last chunk.
+   *
+   * \param json_object The JSON-serializable object to stringify.
+   * \param stream The stream to write the result to.
+   * \return True if the result was written, false if |json_object| has no
+   * JSON representation or the stream aborted, and nothing if an exception
+   * was thrown.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToStream(
+      Local<Context> context, Local<Value> json_object, OutputStream* stream,
+      Local<String> gap = Local<String>());
 };
 
 }  // namespace v8
@@ -8,6 +8,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <array>
 #include <optional>
 #include <vector>
 
@@ -82,6 +83,23 @@ struct GarbageCollectionFullCycle {
   int64_t total_duration_since_last_mark_compact = -1;
 };
 
+// The part of a full garbage collection cycle that is attributed to the
+// context it is reported for. Reported with --gc-per-context-cost right after
+// the GarbageCollectionFullCycle event of the cycle, once for every context
+// that had objects marked. The cycle's marking and sweeping times are split
+// between the contexts in proportion to the bytes marked for each of them.
+// Objects of contexts that were never passed to Recorder::GetContextId(), and
+// objects that belong to no context, are reported under the empty ContextId.
+struct GarbageCollectionFullCycleContextCost {
+  int64_t marked_bytes = -1;
+  // Share of all bytes marked in the cycle, between 0 and 1.
+  double marked_bytes_share = -1.0;
+  int64_t total_mark_wall_clock_duration_in_us = -1;
+  int64_t total_sweep_wall_clock_duration_in_us = -1;
+  int64_t main_thread_mark_wall_clock_duration_in_us = -1;
+  int64_t main_thread_sweep_wall_clock_duration_in_us = -1;
+};
+
 struct GarbageCollectionFullMainThreadIncrementalMark {
   int64_t wall_clock_duration_in_us = -1;
   int64_t cpp_wall_clock_duration_in_us = -1;
@@ -164,6 +182,16 @@ struct WasmModulesPerIsolate {
   const size_t count;
 };
 
+// Recorded when a function repeatedly deoptimized at the same bytecode for the
+// same reason, and V8 generalized the feedback of that bytecode to stop the
+// deopt loop.
+struct DeoptimizationLoop {
+  // Number of deopts at that bytecode that led to the detection.
+  const int deopt_count;
+  // Whether the bytecode had feedback that could be generalized.
+  const bool feedback_generalized;
+};
+
 /**
  * This class serves as a base class for recording event-based metrics in V8.
  * There a two kinds of metrics, those which are expected to be thread-safe and
@@ -208,6 +236,7 @@ class V8_EXPORT Recorder {
 #define ADD_MAIN_THREAD_EVENT(E) \
   virtual void AddMainThreadEvent(const E&, ContextId) {}
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullCycle)
+  ADD_MAIN_THREAD_EVENT(GarbageCollectionFullCycleContextCost)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadIncrementalMark)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadBatchedIncrementalMark)
   ADD_MAIN_THREAD_EVENT(GarbageCollectionFullMainThreadIncrementalSweep)
@@ -216,6 +245,7 @@ class V8_EXPORT Recorder {
   ADD_MAIN_THREAD_EVENT(WasmModuleDecoded)
   ADD_MAIN_THREAD_EVENT(WasmModuleCompiled)
   ADD_MAIN_THREAD_EVENT(WasmModuleInstantiated)
+  ADD_MAIN_THREAD_EVENT(DeoptimizationLoop)
 #undef ADD_MAIN_THREAD_EVENT
 
   // Thread-safe events are not allowed to access the context and therefore do
@@ -266,6 +296,104 @@ struct V8_EXPORT LongTaskStats {
   int64_t v8_execute_us = 0;
 };
 
+/**
+ * A histogram of non-negative integer values with buckets laid out like in
+ * HdrHistogram: values below 2 * kSubBucketCount get a bucket each, and every
+ * power-of-two range above is split into kSubBucketCount buckets. A value
+ * reported for a percentile is thus at most 1 / kSubBucketCount larger than
+ * the exact one. Values above kMaxValue are counted as kMaxValue.
+ */
+class V8_EXPORT LatencyHistogram {
+ public:
+  static constexpr int kSubBucketBits = 4;
+  static constexpr int64_t kSubBucketCount = int64_t{1} << kSubBucketBits;
+  static constexpr int kMaxValueBits = 36;
+  static constexpr int64_t kMaxValue = (int64_t{1} << kMaxValueBits) - 1;
+  static constexpr size_t kBucketCount =
+      (kMaxValueBits - kSubBucketBits + 1) * kSubBucketCount;
+
+  /**
+   * Returns the largest value that is counted in the bucket at `index`.
+   */
+  static int64_t BucketUpperBound(size_t index);
+
+  void Record(int64_t value);
+  void Merge(const LatencyHistogram& other);
+
+  /**
+   * Returns the upper bound of the bucket that holds the value below which
+   * `percentile` percent of the recorded values fall, or 0 if nothing was
+   * recorded.
+   */
+  int64_t ValueAtPercentile(double percentile) const;
+
+  uint64_t count() const { return count_; }
+  int64_t max() const { return max_; }
+  int64_t sum() const { return sum_; }
+  uint64_t bucket(size_t index) const { return buckets_[index]; }
+
+ private:
+  static size_t BucketIndex(int64_t value);
+
+  std::array<uint64_t, kBucketCount> buckets_{};
+  uint64_t count_ = 0;
+  int64_t max_ = 0;
+  int64_t sum_ = 0;
+};
+
+/**
+ * Latency distributions of the garbage collector of an isolate since it was
+ * created or since the last Reset(). Only collected with
+ * --gc-latency-histograms; otherwise all histograms are empty. Get() and
+ * Reset() may be called from any thread. Durations are in microseconds.
+ */
+struct V8_EXPORT GCLatencyHistograms {
+  static GCLatencyHistograms Get(Isolate* isolate);
+  static void Reset(Isolate* isolate);
+
+  // Time from requesting a safepoint until all threads of the isolate, or of
+  // all isolates for a global safepoint, have stopped.
+  LatencyHistogram time_to_safepoint_us;
+  // Pauses of young generation GCs.
+  LatencyHistogram young_pause_us;
+  // Atomic pauses of full GCs, and the phases within them.
+  LatencyHistogram full_atomic_pause_us;
+  LatencyHistogram full_atomic_mark_us;
+  LatencyHistogram full_atomic_weak_us;
+  LatencyHistogram full_atomic_compact_us;
+  LatencyHistogram full_atomic_sweep_us;
+  // Incremental marking and sweeping steps on the main thread.
+  LatencyHistogram full_incremental_step_us;
+  // Share of the time between two full GCs in which the mutator ran, in
+  // percent. Recorded once per full GC.
+  LatencyHistogram mutator_utilization_percent;
+};
+
+/**
+ * Samples of the runtime call stats counter that was active on the main
+ * thread of an isolate, taken every --runtime-call-stats-sampling-interval
+ * microseconds since the isolate was created or since the last Reset().
+ * Only collected with --runtime-call-stats-sampling in builds with runtime
+ * call stats; otherwise there are no samples. Get() and Reset() may be
+ * called from any thread.
+ */
+struct V8_EXPORT RuntimeCallStatsSamples {
+  static RuntimeCallStatsSamples Get(Isolate* isolate);
+  static void Reset(Isolate* isolate);
+
+  struct Counter {
+    // Name of the counter as in --runtime-call-stats output, e.g.
+    // "LoadIC_Miss". Valid for the lifetime of the process.
+    const char* name;
+    uint64_t samples;
+  };
+  // Counters with at least one sample.
+  std::vector<Counter> counters;
+  // All samples, including those taken while no counter was active, e.g.
+  // while running JavaScript or while the isolate was idle.
+  uint64_t total_samples = 0;
+};
+
 }  // namespace metrics
 }  // namespace v8
 
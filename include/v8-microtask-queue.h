@@ -97,6 +97,31 @@ class V8_EXPORT MicrotaskQueue {
    */
   virtual int GetMicrotasksScopeDepth() const = 0;
 
+  /**
+   * Queue depth and throughput statistics, see GetStatistics().
+   */
+  struct Statistics {
+    /** The number of microtasks that are currently queued. */
+    size_t pending_microtask_count = 0;
+    /** The largest number of queued microtasks at the start of a checkpoint. */
+    size_t max_pending_microtask_count = 0;
+    /** The number of microtasks that ran so far. */
+    size_t finished_microtask_count = 0;
+    /** The number of checkpoints that ran at least one microtask. */
+    size_t checkpoint_count = 0;
+    /**
+     * The largest number of microtasks that ran in a single checkpoint,
+     * including the ones that were queued while it ran.
+     */
+    size_t max_microtasks_per_checkpoint = 0;
+  };
+
+  /**
+   * Returns statistics about the microtasks run on this MicrotaskQueue
+   * instance since it was created.
+   */
+  virtual Statistics GetStatistics() const = 0;
+
   MicrotaskQueue(const MicrotaskQueue&) = delete;
   MicrotaskQueue& operator=(const MicrotaskQueue&) = delete;
 
@@ -5,6 +5,10 @@
 #ifndef INCLUDE_V8_PRIMITIVE_H_
 #define INCLUDE_V8_PRIMITIVE_H_
 
+#include <stddef.h>
+
+#include <memory>
+
 #include "v8-data.h"          // NOLINT(build/include_directory)
 #include "v8-internal.h"      // NOLINT(build/include_directory)
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
@@ -548,6 +552,42 @@ class V8_EXPORT String : public Name {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalOneByte(
       Isolate* isolate, ExternalOneByteStringResource* resource);
 
+  /**
+   * A range of characters in a buffer passed to NewExternalOneByteSlices or
+   * NewExternalTwoByteSlices. Both |offset| and |length| count characters.
+   */
+  struct ExternalSlice {
+    size_t offset;
+    size_t length;
+  };
+
+  /**
+   * Creates one external string per slice of |data| without copying the
+   * characters, e.g. for the headers in a network buffer taken from a pool.
+   * Every string keeps a reference to |owner|, which is dropped when the
+   * string is no longer live on V8's heap. |data| must neither be deallocated
+   * nor modified until the last reference to |owner| is gone, so releasing
+   * |owner| is the point at which the buffer can return to its pool. Very
+   * short slices are copied onto V8's heap instead, where they are cheaper
+   * than an external string.
+   *
+   * With NewStringType::kNormal the strings are only internalized once they
+   * are first used as property keys, which is the cheapest option for values
+   * that most likely are never looked up. NewStringType::kInternalized
+   * internalizes them right away.
+   *
+   * |result| must have room for |count| strings. Returns false without
+   * creating any string if one of the slices exceeds String::kMaxLength.
+   */
+  static V8_WARN_UNUSED_RESULT bool NewExternalOneByteSlices(
+      Isolate* isolate, std::shared_ptr<void> owner, const char* data,
+      const ExternalSlice* slices, size_t count, Local<String>* result,
+      NewStringType type = NewStringType::kNormal);
+  static V8_WARN_UNUSED_RESULT bool NewExternalTwoByteSlices(
+      Isolate* isolate, std::shared_ptr<void> owner, const uint16_t* data,
+      const ExternalSlice* slices, size_t count, Local<String>* result,
+      NewStringType type = NewStringType::kNormal);
+
   /**
    * Associate an external string resource with this string by transforming it
    * in place so that existing references to this string in the JavaScript heap
@@ -422,6 +422,45 @@ class V8_EXPORT CpuProfilingOptions {
   CpuProfileSource profile_source_;
 };
 
+/**
+ * Output format of continuous profiling.
+ */
+enum class ContinuousProfileFormat {
+  // One "root;...;leaf <count>" line per distinct stack, as consumed by
+  // flame graph tools.
+  kFoldedStacks,
+  // An uncompressed pprof Profile protocol buffer.
+  kPprof,
+};
+
+/**
+ * Receives the aggregated samples of a continuous profiling session, see
+ * CpuProfiler::StartContinuousProfiling. Flushes happen on the profiler
+ * thread, except for the last one, which happens on the thread calling
+ * CpuProfiler::StopContinuousProfiling.
+ */
+class V8_EXPORT ContinuousProfileDelegate {
+ public:
+  virtual ~ContinuousProfileDelegate() = default;
+
+  /**
+   * Called with the samples taken since the previous flush. |data| is only
+   * valid for the duration of the call.
+   */
+  virtual void OnProfileFlush(const char* data, size_t size) = 0;
+};
+
+struct ContinuousProfilingOptions {
+  ContinuousProfileFormat format = ContinuousProfileFormat::kFoldedStacks;
+  // Time between two samples.
+  int sampling_interval_us = 10000;
+  // Time between two flushes to the delegate.
+  int flush_interval_ms = 60000;
+  // Maximum number of distinct stacks kept between two flushes. Samples of
+  // further stacks are dropped and only counted.
+  size_t max_stacks = 4096;
+};
+
 /**
  * Interface for controlling CPU profiling. Instance of the
  * profiler can be created using v8::CpuProfiler::New method.
@@ -550,6 +589,24 @@ class V8_EXPORT CpuProfiler {
    */
   CpuProfile* StopProfiling(Local<String> title);
 
+  /**
+   * Starts sampling without building a profile tree. Samples are aggregated
+   * by stack on the profiler thread and handed to |delegate| in |options|'
+   * format every flush interval, so the memory used stays bounded however
+   * long profiling runs. Continuous profiling cannot be combined with the
+   * regular profiles of the same CpuProfiler; kErrorTooManyProfilers is
+   * returned when either is already active.
+   */
+  CpuProfilingStatus StartContinuousProfiling(
+      std::unique_ptr<ContinuousProfileDelegate> delegate,
+      ContinuousProfilingOptions options = {});
+
+  /**
+   * Stops continuous profiling, after flushing the remaining samples to the
+   * delegate.
+   */
+  void StopContinuousProfiling();
+
   /**
    * Generate more detailed source positions to code objects. This results in
    * better results when mapping profiling samples to script source.
@@ -830,6 +887,16 @@ class V8_EXPORT AllocationProfile {
      * what samples were added or removed between two snapshots.
      */
     uint64_t sample_id;
+
+    /**
+     * Time of the allocation, in milliseconds since the isolate was created.
+     */
+    double allocation_time_ms = 0;
+
+    /**
+     * The number of garbage collections the sampled object has survived.
+     */
+    uint32_t survived_gc_count = 0;
   };
 
   /**
@@ -996,6 +1063,9 @@ class V8_EXPORT HeapProfiler {
     kSamplingForceGC = 1 << 0,
     kSamplingIncludeObjectsCollectedByMajorGC = 1 << 1,
     kSamplingIncludeObjectsCollectedByMinorGC = 1 << 2,
+    // Record allocations and deaths of sampled objects for
+    // WriteSamplingHeapProfileDelta.
+    kSamplingRecordLifetimes = 1 << 3,
   };
 
   /**
@@ -1164,6 +1234,19 @@ class V8_EXPORT HeapProfiler {
   const HeapSnapshot* TakeHeapSnapshot(
       const HeapSnapshotOptions& options = HeapSnapshotOptions());
 
+  /**
+   * Writes a heap snapshot to |stream| while the heap is walked, without
+   * retaining a HeapSnapshot. The output is a compact binary object graph
+   * rather than the JSON produced by HeapSnapshot::Serialize, see
+   * src/profiler/heap-snapshot-streamer.h for the format. Only the
+   * |stack_state| of |options| is used.
+   *
+   * \returns false if |stream| aborted the snapshot.
+   */
+  bool StreamHeapSnapshot(
+      OutputStream* stream,
+      const HeapSnapshotOptions& options = HeapSnapshotOptions());
+
   /**
    * Takes a heap snapshot. See `HeapSnapshotOptions` for details on the
    * parameters.
@@ -1267,6 +1350,18 @@ class V8_EXPORT HeapProfiler {
    */
   AllocationProfile* GetAllocationProfile();
 
+  /**
+   * Writes the sampled allocations and deaths since the previous call, or
+   * since StartSamplingHeapProfiler, to |stream| as an uncompressed pprof
+   * profile, and forgets them. Deaths carry the lifetime and the number of
+   * garbage collections survived by the object as labels, which tells
+   * short-lived churn from long-lived allocations per allocation site.
+   *
+   * Returns false if the sampling heap profiler is not active or was not
+   * started with kSamplingRecordLifetimes.
+   */
+  bool WriteSamplingHeapProfileDelta(OutputStream* stream);
+
   /**
    * Deletes all snapshots taken. All previously returned pointers to
    * snapshots and their contents become invalid after this call.
@@ -365,7 +365,10 @@ class V8_EXPORT Module : public Data {
 class V8_EXPORT CompileHintsCollector : public Data {
  public:
   /**
-   * Returns the positions of lazy functions which were compiled and executed.
+   * Returns the positions of lazy functions which were compiled and executed,
+   * in the order in which they were first compiled. With
+   * --produce-compile-hints-time-limit, only functions compiled early enough
+   * are included.
    */
   std::vector<int> GetCompileHints(Isolate* isolate) const;
 };
@@ -609,6 +612,14 @@ class V8_EXPORT ScriptCompiler {
 
     StreamedSource(std::unique_ptr<ExternalSourceStream> source_stream,
                    Encoding encoding);
+
+    /**
+     * Streams a source that is already complete, e.g. a large inline script or
+     * a string passed to eval. The characters are copied, so the streaming
+     * task does not need to access the heap.
+     */
+    StreamedSource(Isolate* isolate, Local<String> source_string);
+
     ~StreamedSource();
 
     internal::ScriptStreamingData* impl() const { return impl_.get(); }
@@ -799,11 +810,45 @@ class V8_EXPORT ScriptCompiler {
       CompileHintCallback compile_hint_callback = nullptr,
       void* compile_hint_callback_data = nullptr);
 
+  /**
+   * Like StartStreaming above, for a StreamedSource created from
+   * |source_string|. Returns NULL if the compilation cache already has a
+   * script for |source_string| and |origin|. In that case there is no work to
+   * do off the main thread, and Compile and CompileUnboundScript below return
+   * the cached script.
+   */
+  static ScriptStreamingTask* StartStreaming(
+      Isolate* isolate, StreamedSource* source, Local<String> source_string,
+      const ScriptOrigin& origin, ScriptType type = ScriptType::kClassic,
+      CompileOptions options = kNoCompileOptions);
+
+  /**
+   * A CompileHintCallback for the compile hints returned by
+   * CompileHintsCollector::GetCompileHints. |data| must point to a
+   * std::vector<int> of those positions, sorted in ascending order. The vector
+   * is only read, so it can be shared by the streaming task and the main
+   * thread.
+   */
+  static bool CompileHintFromPositions(int position, void* data);
+
   static ConsumeCodeCacheTask* StartConsumingCodeCache(
       Isolate* isolate, std::unique_ptr<CachedData> source);
   static ConsumeCodeCacheTask* StartConsumingCodeCacheOnBackground(
       Isolate* isolate, std::unique_ptr<CachedData> source);
 
+  /**
+   * Runs a batch of ConsumeCodeCacheTasks on the platform's worker threads and
+   * blocks until all of them have finished. Tasks for which
+   * SourceTextAvailable was called beforehand and which need to be merged
+   * into an existing script are also merged as part of the batch. Each task is
+   * then finalized on the main thread as usual, by compiling the
+   * ScriptCompiler::Source that contains it.
+   *
+   * Must be called on the thread where |isolate| is entered.
+   */
+  static void RunConsumeCodeCacheTasks(
+      Isolate* isolate, MemorySpan<ConsumeCodeCacheTask* const> tasks);
+
   /**
    * Compiles a streamed script (bound to current context).
    *
@@ -815,6 +860,17 @@ class V8_EXPORT ScriptCompiler {
       Local<Context> context, StreamedSource* source,
       Local<String> full_source_string, const ScriptOrigin& origin);
 
+  /**
+   * Compiles a streamed script, not bound to any context.
+   *
+   * Like Compile above, this can only be called after the streaming has
+   * finished. If no streaming task was started for |source|, the script is
+   * compiled on the calling thread.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<UnboundScript> CompileUnboundScript(
+      Isolate* isolate, StreamedSource* source,
+      Local<String> full_source_string, const ScriptOrigin& origin);
+
   /**
    * Return a version tag for CachedData for the current V8 version & flags.
    *
@@ -890,6 +946,18 @@ class V8_EXPORT ScriptCompiler {
   static CachedData* CreateCodeCache(
       Local<UnboundModuleScript> unbound_module_script);
 
+  /**
+   * Creates and returns a scope cache for the specified unbound_script. A
+   * scope cache is a code cache that only holds the top-level code of the
+   * script together with the boundaries and preparse data of its inner
+   * functions, but none of their bytecode. It stays small no matter how much
+   * of the script has run, and is consumed like any other code cache, with
+   * kConsumeCodeCache.
+   * This will return nullptr if the script cannot be serialized. The
+   * CachedData returned by this function should be owned by the caller.
+   */
+  static CachedData* CreateScopeCache(Local<UnboundScript> unbound_script);
+
   /**
    * Creates and returns code cache for the specified function that was
    * previously produced by CompileFunction.
@@ -911,6 +979,47 @@ class V8_EXPORT ScriptCompiler {
       Local<ScriptOrModule>* script_or_module_out);
 };
 
+/**
+ * An embedder-provided store of code caches that outlives the isolate, such
+ * as one on disk, used as a second tier behind the in-memory compilation
+ * cache.
+ *
+ * When a script compiled without CachedData misses the in-memory cache, V8
+ * looks its code cache up here before compiling. After compiling a script it
+ * produces a code cache from a task posted to the isolate's foreground task
+ * runner, so that the functions the script ran first are included, and hands
+ * it to Store(). Data produced by another V8 version or flag configuration is
+ * rejected, and the script is compiled as if Lookup() had missed.
+ *
+ * Both methods are called on the isolate's thread. Only classic and module
+ * scripts are cached; eval, new Function and ScriptCompiler::CompileFunction
+ * code is not.
+ */
+class V8_EXPORT PersistentCompilationCache {
+ public:
+  struct Key {
+    // Hash of the source text. The hash is stable across processes and
+    // independent of the string's representation in the heap.
+    uint64_t source_hash;
+    uint32_t source_length;
+    ScriptOriginOptions origin_options;
+  };
+
+  virtual ~PersistentCompilationCache() = default;
+
+  /**
+   * Returns the code cache stored for |key|, or nullptr.
+   */
+  virtual std::unique_ptr<ScriptCompiler::CachedData> Lookup(
+      Isolate* isolate, const Key& key) = 0;
+
+  /**
+   * Takes a freshly produced code cache for |key|.
+   */
+  virtual void Store(Isolate* isolate, const Key& key,
+                     std::unique_ptr<ScriptCompiler::CachedData> data) = 0;
+};
+
 ScriptCompiler::Source::Source(Local<String> string, const ScriptOrigin& origin,
                                CachedData* data,
                                ConsumeCodeCacheTask* consume_cache_task)
@@ -231,12 +231,14 @@ class V8_EXPORT HeapCodeStatistics {
   size_t bytecode_and_metadata_size() { return bytecode_and_metadata_size_; }
   size_t external_script_source_size() { return external_script_source_size_; }
   size_t cpu_profiler_metadata_size() { return cpu_profiler_metadata_size_; }
+  size_t feedback_vector_size() { return feedback_vector_size_; }
 
  private:
   size_t code_and_metadata_size_;
   size_t bytecode_and_metadata_size_;
   size_t external_script_source_size_;
   size_t cpu_profiler_metadata_size_;
+  size_t feedback_vector_size_;
 
   friend class Isolate;
 };
@@ -18,6 +18,7 @@
 namespace v8 {
 
 class ArrayBuffer;
+class BackingStore;
 class Isolate;
 class Object;
 class SharedArrayBuffer;
@@ -109,6 +110,25 @@ class V8_EXPORT ValueSerializer {
     virtual Maybe<uint32_t> GetSharedArrayBufferId(
         Isolate* isolate, Local<SharedArrayBuffer> shared_array_buffer);
 
+    /**
+     * Called when the ValueSerializer is going to serialize an ArrayBuffer
+     * whose byte length is at least the threshold passed to
+     * ValueSerializer::SetBackingStoreReferenceThreshold. Instead of copying
+     * the contents into the serialized data, only an ID for the backing store
+     * is written. When deserializing, this ID will be passed to
+     * ValueDeserializer::GetBackingStoreFromId.
+     *
+     * The embedder must keep |backing_store| alive until the data has been
+     * deserialized, and is responsible for any copy semantics the clone
+     * requires, e.g. by copying all referenced backing stores in one go when
+     * the message is sent.
+     *
+     * If the object cannot be serialized, an
+     * exception should be thrown and Nothing<uint32_t>() returned.
+     */
+    virtual Maybe<uint32_t> GetBackingStoreId(
+        Isolate* isolate, std::shared_ptr<BackingStore> backing_store);
+
     virtual Maybe<uint32_t> GetWasmModuleTransferId(
         Isolate* isolate, Local<WasmModuleObject> module);
 
@@ -190,6 +210,16 @@ class V8_EXPORT ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /**
+   * Serialize ArrayBuffers of at least |min_byte_length| bytes by reference,
+   * i.e. pass their backing stores to Delegate::GetBackingStoreId instead of
+   * copying their contents. Resizable ArrayBuffers are always copied. This
+   * should not be called when no Delegate was passed.
+   *
+   * The default is to copy the contents of all ArrayBuffers.
+   */
+  void SetBackingStoreReferenceThreshold(size_t min_byte_length);
+
   /**
    * Write raw data in various common formats to the buffer.
    * Note that integer types are written in base-128 varint format, not with a
@@ -239,6 +269,17 @@ class V8_EXPORT ValueDeserializer {
     virtual MaybeLocal<SharedArrayBuffer> GetSharedArrayBufferFromId(
         Isolate* isolate, uint32_t clone_id);
 
+    /**
+     * Get the backing store for an ID previously provided by
+     * ValueSerializer::Delegate::GetBackingStoreId. The new ArrayBuffer adopts
+     * the returned backing store without copying it.
+     *
+     * If the backing store is not available, an exception should be thrown
+     * and nullptr returned.
+     */
+    virtual std::shared_ptr<BackingStore> GetBackingStoreFromId(
+        Isolate* isolate, uint32_t id);
+
     /**
      * Get the SharedValueConveyor previously provided by
      * ValueSerializer::Delegate::AdoptSharedValueConveyor.
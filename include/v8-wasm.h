@@ -48,6 +48,29 @@ class V8_EXPORT CompiledWasmModule {
    */
   OwnedBuffer Serialize();
 
+  /**
+   * Serialize the TurboFan code of all functions of the compiled module that
+   * was not serialized by a previous call to this method, e.g. from the
+   * callback set by {WasmStreaming::SetMoreFunctionsCanBeSerializedCallback}.
+   * The buffers of consecutive calls can be appended to each other and used
+   * in place of the result of {Serialize}. The code of a function in such data
+   * is only deserialized when the function is called first. Returns an empty
+   * buffer if there is no new code. The serialized data does not include the
+   * wire bytes.
+   */
+  OwnedBuffer SerializeNewFunctions();
+
+  /**
+   * Get compilation hints describing which functions of the module were
+   * executed and which were tiered up so far, e.g. when called from the
+   * callback set by {WasmStreaming::SetMoreFunctionsCanBeSerializedCallback}.
+   * The result is a "metadata.code.compilation_priority" custom section. When
+   * it is appended to the wire bytes of a later compilation with compilation
+   * hints enabled, the executed functions are compiled eagerly and the tiered
+   * up ones are also optimized in the background.
+   */
+  OwnedBuffer GetCompilationHints();
+
   /**
    * Get the (wasm-encoded) wire bytes that were used to compile this module.
    */
@@ -238,6 +261,19 @@ class V8_EXPORT WasmStreaming final {
   void SetMoreFunctionsCanBeSerializedCallback(
       std::function<void(CompiledWasmModule)>);
 
+  /**
+   * Sets a callback which asks the embedder to stop passing bytes to
+   * {OnBytesReceived} when called with {true}, and to continue when called
+   * with {false}. V8 asks to pause while the received function bodies that
+   * background threads did not process yet exceed {max_pending_bytes}, and to
+   * continue once they dropped to half of that. This bounds the work that
+   * piles up when bytes arrive faster than they can be validated.
+   * The callback can be called on any thread and must not call into V8. This
+   * must be called before {OnBytesReceived}.
+   */
+  void SetBackPressureCallback(size_t max_pending_bytes,
+                               std::function<void(bool pause)> callback);
+
   /*
    * Sets the UTF-8 encoded source URL for the {Script} object. This must be
    * called before {Finish}.
@@ -2,17 +2,25 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cstring>
+#include <fstream>
 #include <iostream>
 #include <memory>
 
 #include "include/libplatform/libplatform.h"
+#include "include/libplatform/v8-tracing.h"
 #include "include/v8-initialization.h"
 #include "include/opencog/atomspace.h"
 #include "include/opencog/agent.h"
 #include "include/opencog/agent-orchestrator.h"
 #include "include/opencog/isolate-mesh.h"
 
+#if defined(V8_USE_PERFETTO)
+#include "src/tracing/perfetto-sdk.h"
+#endif
+
 using namespace v8::opencog;
+namespace platform_tracing = v8::platform::tracing;
 
 // Example cognitive agent
 class CognitiveAgent : public Agent {
@@ -22,8 +30,8 @@ class CognitiveAgent : public Agent {
 
   void Execute() override {
     // Add some knowledge to the AtomSpace
-    auto concept = atomspace_->AddNode(AtomType::CONCEPT_NODE, "TestConcept");
-    concept->set_truth_value(TruthValue(0.9, 0.8));
+    auto node = atomspace_->AddNode(AtomType::CONCEPT_NODE, "TestConcept");
+    node->set_truth_value(TruthValue(0.9, 0.8));
     
     std::cout << "Agent " << agent_id_ << " executed. AtomSpace size: "
               << atomspace_->Size() << std::endl;
@@ -35,28 +43,86 @@ class CognitiveAgent : public Agent {
   }
 };
 
+// Writes trace events to |trace_file|, in the Perfetto format when V8 is
+// built with Perfetto and as JSON otherwise.
+std::unique_ptr<platform_tracing::TracingController> NewTracingController(
+    std::ofstream* trace_file) {
+  auto controller = std::make_unique<platform_tracing::TracingController>();
+#if defined(V8_USE_PERFETTO)
+  perfetto::TracingInitArgs init_args;
+  init_args.backends = perfetto::BackendType::kInProcessBackend;
+  perfetto::Tracing::Initialize(init_args);
+  controller->InitializeForPerfetto(trace_file);
+#else
+  controller->Initialize(
+      platform_tracing::TraceBuffer::CreateTraceBufferRingBuffer(
+          platform_tracing::TraceBuffer::kRingBufferChunks,
+          platform_tracing::TraceWriter::CreateJSONTraceWriter(*trace_file)));
+#endif
+  return controller;
+}
+
+// Records agent and AtomSpace events together with GC and compiler activity,
+// so that they line up in one timeline.
+void StartTracing(platform_tracing::TracingController* controller) {
+  auto* config = new platform_tracing::TraceConfig();
+  config->AddIncludedCategory("opencog");
+  config->AddIncludedCategory("v8");
+  config->AddIncludedCategory("disabled-by-default-v8.gc");
+  config->AddIncludedCategory("disabled-by-default-v8.compile");
+  controller->StartTracing(config);
+}
+
 int main(int argc, char* argv[]) {
+  // --trace-file=<path> writes a trace of the run.
+  const char* trace_path = nullptr;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strncmp(argv[i], "--trace-file=", 13) == 0) {
+      trace_path = argv[i] + 13;
+    }
+  }
+  std::ofstream trace_file;
+  std::unique_ptr<platform_tracing::TracingController> tracing_controller;
+  if (trace_path) {
+    trace_file.open(trace_path);
+    if (!trace_file.good()) {
+      std::cerr << "Cannot open trace file " << trace_path << std::endl;
+      return 1;
+    }
+    tracing_controller = NewTracingController(&trace_file);
+  }
+  // The platform takes ownership.
+  platform_tracing::TracingController* tracing_controller_ptr =
+      tracing_controller.get();
+
   // Initialize V8
   v8::V8::InitializeICUDefaultLocation(argv[0]);
   v8::V8::InitializeExternalStartupData(argv[0]);
-  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform(
+      0, v8::platform::IdleTaskSupport::kDisabled,
+      v8::platform::InProcessStackDumping::kDisabled,
+      std::move(tracing_controller));
   v8::V8::InitializePlatform(platform.get());
   v8::V8::Initialize();
+  if (tracing_controller_ptr) StartTracing(tracing_controller_ptr);
 
   std::cout << "OpenCog Multi-Tenant Neuro-Symbolic Architecture Demo" << std::endl;
   std::cout << "======================================================" << std::endl;
 
-  // Initialize IsolateMesh
+  IsolateConfig config;
+  config.heap_size_limit = 256 * 1024 * 1024; // 256 MB
+
+  // Initialize IsolateMesh, with pre-warmed isolates for the tenants below
   IsolateMesh::InitializePlatform(platform.get());
-  auto mesh = std::make_shared<IsolateMesh>();
+  IsolateMesh::Options mesh_options;
+  mesh_options.isolate_pool.config = config;
+  auto mesh = std::make_shared<IsolateMesh>(mesh_options);
 
   // Create agent orchestrator
   auto orchestrator = std::make_shared<AgentOrchestrator>();
   mesh->SetAgentOrchestrator(orchestrator);
 
   // Create tenant isolates
-  IsolateConfig config;
-  config.heap_size_limit = 256 * 1024 * 1024; // 256 MB
   
   std::cout << "\nCreating tenant isolates..." << std::endl;
   auto tenant1 = mesh->CreateTenantIsolate("tenant1", config);
@@ -117,6 +183,10 @@ int main(int argc, char* argv[]) {
   // Cleanup
   std::cout << "\nShutting down..." << std::endl;
   orchestrator->Stop();
+  if (tracing_controller_ptr) {
+    tracing_controller_ptr->StopTracing();
+    std::cout << "Trace written to " << trace_path << std::endl;
+  }
 
   // Dispose V8
   v8::V8::Dispose();
@@ -34,6 +34,7 @@
 #include "src/api/api-arguments.h"
 #include "src/api/api-inl.h"
 #include "src/api/api-natives.h"
+#include "src/base/bits.h"
 #include "src/base/hashing.h"
 #include "src/base/logging.h"
 #include "src/base/numerics/safe_conversions.h"
@@ -68,6 +69,7 @@
 #include "src/handles/persistent-handles.h"
 #include "src/handles/shared-object-conveyor-handles.h"
 #include "src/handles/traced-handles-inl.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap-layout-inl.h"
 #include "src/heap/heap-write-barrier.h"
@@ -146,10 +148,12 @@
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/debug/debug-wasm-objects.h"
 #include "src/trap-handler/trap-handler.h"
+#include "src/wasm/compilation-hints-generation.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/value-type.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-js.h"
+#include "src/wasm/wasm-module-builder.h"
 #include "src/wasm/wasm-objects-inl.h"
 #include "src/wasm/wasm-result.h"
 #include "src/wasm/wasm-serialization.h"
@@ -1843,6 +1847,52 @@ ScriptCompiler::StreamedSource::StreamedSource(
     std::unique_ptr<ExternalSourceStream> stream, Encoding encoding)
     : impl_(new i::ScriptStreamingData(std::move(stream), encoding)) {}
 
+namespace {
+
+// Returns the characters of a complete source string in one chunk.
+class StringSourceStream final : public ScriptCompiler::ExternalSourceStream {
+ public:
+  explicit StringSourceStream(i::DirectHandle<i::String> source)
+      : one_byte_(source->IsOneByteRepresentation()),
+        length_(source->length()) {
+    i::DisallowGarbageCollection no_gc;
+    if (one_byte_) {
+      auto buffer = std::make_unique<uint8_t[]>(length_);
+      i::String::WriteToFlat(*source, buffer.get(), 0, length_);
+      buffer_.reset(buffer.release());
+    } else {
+      auto buffer = std::make_unique<uint16_t[]>(length_);
+      i::String::WriteToFlat(*source, buffer.get(), 0, length_);
+      buffer_.reset(reinterpret_cast<uint8_t*>(buffer.release()));
+    }
+  }
+
+  bool one_byte() const { return one_byte_; }
+
+  size_t GetMoreData(const uint8_t** src) override {
+    if (!buffer_) return 0;
+    *src = buffer_.release();
+    return one_byte_ ? length_ : length_ * sizeof(uint16_t);
+  }
+
+ private:
+  const bool one_byte_;
+  const uint32_t length_;
+  std::unique_ptr<uint8_t[]> buffer_;
+};
+
+}  // namespace
+
+ScriptCompiler::StreamedSource::StreamedSource(Isolate* v8_isolate,
+                                               Local<String> source_string) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i::DirectHandle<i::String> str =
+      i::String::Flatten(i_isolate, Utils::OpenHandle(*source_string));
+  auto stream = std::make_unique<StringSourceStream>(str);
+  Encoding encoding = stream->one_byte() ? ONE_BYTE : TWO_BYTE;
+  impl_.reset(new i::ScriptStreamingData(std::move(stream), encoding));
+}
+
 ScriptCompiler::StreamedSource::~StreamedSource() = default;
 
 Local<Script> UnboundScript::BindToCurrentContext() {
@@ -2648,6 +2698,38 @@ ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreaming(
   return new ScriptCompiler::ScriptStreamingTask(data);
 }
 
+ScriptCompiler::ScriptStreamingTask* ScriptCompiler::StartStreaming(
+    Isolate* v8_isolate, StreamedSource* source, Local<String> source_string,
+    const ScriptOrigin& origin, v8::ScriptType type, CompileOptions options) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  if (type == ScriptType::kClassic && options == kNoCompileOptions) {
+    // Compiling a cached script on the main thread is only a lookup, which
+    // is cheaper than parsing it again in the background.
+    i::DisallowJavascriptExecutionDebugOnly no_execution(i_isolate);
+    i::DisallowExceptionsDebugOnly no_exceptions(i_isolate);
+    i::HandleScope scope(i_isolate);
+    auto str = Utils::OpenHandle(*source_string);
+    i::ScriptDetails script_details =
+        GetScriptDetails(i_isolate, origin.ResourceName(), origin.LineOffset(),
+                         origin.ColumnOffset(), origin.SourceMapUrl(),
+                         origin.GetHostDefinedOptions(), origin.Options());
+    i::CompilationCacheScript::LookupResult lookup_result =
+        i_isolate->compilation_cache()->LookupScript(
+            str, script_details,
+            i::construct_language_mode(i::v8_flags.use_strict));
+    if (!lookup_result.toplevel_sfi().is_null()) return nullptr;
+  }
+  return StartStreaming(v8_isolate, source, type, options);
+}
+
+// static
+bool ScriptCompiler::CompileHintFromPositions(int position, void* data) {
+  const std::vector<int>* positions =
+      reinterpret_cast<const std::vector<int>*>(data);
+  DCHECK(std::is_sorted(positions->begin(), positions->end()));
+  return std::binary_search(positions->begin(), positions->end(), position);
+}
+
 ScriptCompiler::ConsumeCodeCacheTask::ConsumeCodeCacheTask(
     std::unique_ptr<i::BackgroundDeserializeTask> impl)
     : impl_(std::move(impl)) {}
@@ -2706,6 +2788,16 @@ ScriptCompiler::StartConsumingCodeCacheOnBackground(
                                                      std::move(cached_data)));
 }
 
+void ScriptCompiler::RunConsumeCodeCacheTasks(
+    Isolate* v8_isolate, MemorySpan<ConsumeCodeCacheTask* const> tasks) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i::DisallowJavascriptExecutionDebugOnly no_execution(i_isolate);
+  std::vector<i::BackgroundDeserializeTask*> impls;
+  impls.reserve(tasks.size());
+  for (ConsumeCodeCacheTask* task : tasks) impls.push_back(task->impl_.get());
+  i::BackgroundDeserializeTask::RunBatch(i_isolate, base::VectorOf(impls));
+}
+
 namespace {
 i::MaybeDirectHandle<i::SharedFunctionInfo> CompileStreamedSource(
     i::Isolate* i_isolate, ScriptCompiler::StreamedSource* v8_source,
@@ -2716,6 +2808,14 @@ i::MaybeDirectHandle<i::SharedFunctionInfo> CompileStreamedSource(
                        origin.ColumnOffset(), origin.SourceMapUrl(),
                        origin.GetHostDefinedOptions(), origin.Options());
   i::ScriptStreamingData* data = v8_source->impl();
+  if (!data->task) {
+    // Streaming was not started, e.g. because the script was found in the
+    // compilation cache, so compile it here.
+    return i::Compiler::GetSharedFunctionInfoForScript(
+        i_isolate, str, script_details, ScriptCompiler::kNoCompileOptions,
+        ScriptCompiler::kNoCacheNoReason, i::NOT_NATIVES_CODE,
+        &v8_source->compilation_details());
+  }
   i::IsCompiledScope is_compiled_scope;
   return i::Compiler::GetSharedFunctionInfoForStreamedScript(
       i_isolate, str, script_details, data, &is_compiled_scope,
@@ -2745,6 +2845,27 @@ MaybeLocal<Script> ScriptCompiler::Compile(Local<Context> context,
   return api_scope.Escape(generic->BindToCurrentContext());
 }
 
+MaybeLocal<UnboundScript> ScriptCompiler::CompileUnboundScript(
+    Isolate* v8_isolate, StreamedSource* v8_source,
+    Local<String> full_source_string, const ScriptOrigin& origin) {
+  Utils::ApiCheck(
+      !origin.Options().IsModule(), "v8::ScriptCompiler::CompileUnboundScript",
+      "v8::ScriptCompiler::CompileModule must be used to compile modules");
+  auto i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  TRACE_EVENT_CALL_STATS_SCOPED(i_isolate, "v8", "V8.ScriptCompiler");
+  EnterV8NoScriptScope<InternalEscapableScope> api_scope{
+      i_isolate, v8_isolate->GetCurrentContext(),
+      RCCId::kAPI_ScriptCompiler_CompileUnbound};
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.CompileStreamedScript");
+  i::DirectHandle<i::SharedFunctionInfo> sfi;
+  if (!CompileStreamedSource(i_isolate, v8_source, full_source_string, origin)
+           .ToHandle(&sfi)) {
+    return {};
+  }
+  return api_scope.Escape(ToApiHandle<UnboundScript>(sfi));
+}
+
 MaybeLocal<Module> ScriptCompiler::CompileModule(
     Local<Context> context, StreamedSource* v8_source,
     Local<String> full_source_string, const ScriptOrigin& origin) {
@@ -2782,6 +2903,19 @@ ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
   return i::CodeSerializer::Serialize(i_isolate, shared);
 }
 
+// static
+ScriptCompiler::CachedData* ScriptCompiler::CreateScopeCache(
+    Local<UnboundScript> unbound_script) {
+  auto shared = Utils::OpenHandle(*unbound_script);
+  i::Isolate* i_isolate = i::Isolate::Current();
+  Utils::ApiCheck(!i_isolate->serializer_enabled(),
+                  "ScriptCompiler::CreateScopeCache",
+                  "Cannot create scope cache while creating a snapshot");
+  i::DisallowJavascriptExecutionDebugOnly no_execution(i_isolate);
+  DCHECK(shared->is_toplevel());
+  return i::CodeSerializer::SerializeScopeCache(i_isolate, shared);
+}
+
 // static
 ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
     Local<UnboundModuleScript> unbound_module_script) {
@@ -3313,6 +3447,28 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   return api_scope.EscapeMaybe(i::Object::ToString(i_isolate, maybe));
 }
 
+Maybe<bool> JSON::StringifyToStream(Local<Context> context,
+                                    Local<Value> json_object,
+                                    OutputStream* stream, Local<String> gap) {
+  PrepareForExecutionScope api_scope{context, RCCId::kAPI_JSON_Stringify};
+  i::Isolate* i_isolate = api_scope.i_isolate();
+  i::Handle<i::JSAny> object;
+  if (!Utils::ApiCheck(
+          i::TryCast<i::JSAny>(Utils::OpenHandle(*json_object), &object),
+          "JSON::StringifyToStream",
+          "Invalid object, must be a JSON-serializable object.")) {
+    return Nothing<bool>();
+  }
+  Utils::ApiCheck(stream != nullptr, "JSON::StringifyToStream",
+                  "Invalid stream.");
+  i::Handle<i::Undefined> replacer = i_isolate->factory()->undefined_value();
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? i_isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  return i::JsonStringifyToStream(i_isolate, object, replacer, gap_string,
+                                  stream);
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 SharedValueConveyor::SharedValueConveyor(SharedValueConveyor&& other) noexcept
@@ -3359,6 +3515,15 @@ Maybe<uint32_t> ValueSerializer::Delegate::GetSharedArrayBufferId(
   return {};
 }
 
+Maybe<uint32_t> ValueSerializer::Delegate::GetBackingStoreId(
+    Isolate* v8_isolate, std::shared_ptr<BackingStore> backing_store) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i_isolate->Throw(*i_isolate->factory()->NewError(
+      i_isolate->error_function(), i::MessageTemplate::kDataCloneError,
+      i_isolate->factory()->NewStringFromAsciiChecked("ArrayBuffer")));
+  return {};
+}
+
 Maybe<uint32_t> ValueSerializer::Delegate::GetWasmModuleTransferId(
     Isolate* v8_isolate, Local<WasmModuleObject> module) {
   return {};
@@ -3406,6 +3571,11 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   private_->serializer.SetTreatArrayBufferViewsAsHostObjects(mode);
 }
 
+void ValueSerializer::SetBackingStoreReferenceThreshold(
+    size_t min_byte_length) {
+  private_->serializer.SetBackingStoreReferenceThreshold(min_byte_length);
+}
+
 Maybe<bool> ValueSerializer::WriteValue(Local<Context> context,
                                         Local<Value> value) {
   auto i_isolate = i::Isolate::Current();
@@ -3469,6 +3639,16 @@ ValueDeserializer::Delegate::GetSharedArrayBufferFromId(Isolate* v8_isolate,
   return {};
 }
 
+std::shared_ptr<BackingStore>
+ValueDeserializer::Delegate::GetBackingStoreFromId(Isolate* v8_isolate,
+                                                   uint32_t id) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i_isolate->Throw(*i_isolate->factory()->NewError(
+      i_isolate->error_function(),
+      i::MessageTemplate::kDataCloneDeserializationError));
+  return nullptr;
+}
+
 const SharedValueConveyor* ValueDeserializer::Delegate::GetSharedValueConveyor(
     Isolate* v8_isolate) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
@@ -6291,6 +6471,10 @@ bool V8::EnableWebAssemblyTrapHandler(bool use_v8_signal_handler) {
 #endif
 }
 
+bool V8::IsConservativeStackScanningEnabled() {
+  return i::v8_flags.conservative_stack_scanning;
+}
+
 #if defined(V8_OS_WIN)
 void V8::SetUnhandledExceptionCallback(
     UnhandledExceptionCallback unhandled_exception_callback) {
@@ -6359,7 +6543,8 @@ HeapCodeStatistics::HeapCodeStatistics()
     : code_and_metadata_size_(0),
       bytecode_and_metadata_size_(0),
       external_script_source_size_(0),
-      cpu_profiler_metadata_size_(0) {}
+      cpu_profiler_metadata_size_(0),
+      feedback_vector_size_(0) {}
 
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
@@ -7146,6 +7331,97 @@ metrics::LongTaskStats metrics::LongTaskStats::Get(v8::Isolate* v8_isolate) {
   return *i_isolate->GetCurrentLongTaskStats();
 }
 
+// static
+size_t metrics::LatencyHistogram::BucketIndex(int64_t value) {
+  if (value < 2 * kSubBucketCount) {
+    return value < 0 ? 0 : static_cast<size_t>(value);
+  }
+  value = std::min(value, kMaxValue);
+  const int msb =
+      63 - base::bits::CountLeadingZeros(static_cast<uint64_t>(value));
+  const int shift = msb - kSubBucketBits;
+  return static_cast<size_t>(shift * kSubBucketCount + (value >> shift));
+}
+
+// static
+int64_t metrics::LatencyHistogram::BucketUpperBound(size_t index) {
+  DCHECK_LT(index, kBucketCount);
+  const int64_t i = static_cast<int64_t>(index);
+  if (i < 2 * kSubBucketCount) return i;
+  const int shift = static_cast<int>(i / kSubBucketCount) - 1;
+  const int64_t sub_bucket = i - shift * kSubBucketCount;
+  return ((sub_bucket + 1) << shift) - 1;
+}
+
+void metrics::LatencyHistogram::Record(int64_t value) {
+  buckets_[BucketIndex(value)]++;
+  count_++;
+  max_ = std::max(max_, value);
+  sum_ += std::max(value, int64_t{0});
+}
+
+void metrics::LatencyHistogram::Merge(const LatencyHistogram& other) {
+  for (size_t i = 0; i < kBucketCount; i++) buckets_[i] += other.buckets_[i];
+  count_ += other.count_;
+  max_ = std::max(max_, other.max_);
+  sum_ += other.sum_;
+}
+
+int64_t metrics::LatencyHistogram::ValueAtPercentile(double percentile) const {
+  if (count_ == 0) return 0;
+  percentile = std::clamp(percentile, 0.0, 100.0);
+  const uint64_t rank = std::max<uint64_t>(
+      1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * count_)));
+  uint64_t seen = 0;
+  for (size_t i = 0; i < kBucketCount; i++) {
+    seen += buckets_[i];
+    if (seen >= rank) return std::min(BucketUpperBound(i), max_);
+  }
+  return max_;
+}
+
+// static
+metrics::GCLatencyHistograms metrics::GCLatencyHistograms::Get(
+    v8::Isolate* v8_isolate) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  return i_isolate->heap()->tracer()->GetLatencyHistograms();
+}
+
+// static
+void metrics::GCLatencyHistograms::Reset(v8::Isolate* v8_isolate) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i_isolate->heap()->tracer()->ResetLatencyHistograms();
+}
+
+// static
+metrics::RuntimeCallStatsSamples metrics::RuntimeCallStatsSamples::Get(
+    v8::Isolate* v8_isolate) {
+  RuntimeCallStatsSamples result;
+#ifdef V8_RUNTIME_CALL_STATS
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i::RuntimeCallStatsSampler* sampler =
+      i_isolate->counters()->runtime_call_stats_sampler();
+  if (sampler == nullptr) return result;
+  result.total_samples = sampler->total_samples();
+  for (int i = 0; i < i::RuntimeCallStats::kNumberOfCounters; i++) {
+    uint64_t samples = sampler->samples(i);
+    if (samples == 0) continue;
+    result.counters.push_back({sampler->counter_name(i), samples});
+  }
+#endif  // V8_RUNTIME_CALL_STATS
+  return result;
+}
+
+// static
+void metrics::RuntimeCallStatsSamples::Reset(v8::Isolate* v8_isolate) {
+#ifdef V8_RUNTIME_CALL_STATS
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i::RuntimeCallStatsSampler* sampler =
+      i_isolate->counters()->runtime_call_stats_sampler();
+  if (sampler != nullptr) sampler->Reset();
+#endif  // V8_RUNTIME_CALL_STATS
+}
+
 namespace {
 i::ValueHelper::InternalRepresentationType GetSerializedDataFromFixedArray(
     i::Isolate* i_isolate, i::Tagged<i::FixedArray> list, size_t index) {
@@ -7517,6 +7793,104 @@ MaybeLocal<String> v8::String::NewExternalOneByte(
   return Utils::ToLocal(string);
 }
 
+namespace {
+
+// Slices shorter than this are copied: an external string and its resource
+// take more memory than copying the characters would.
+constexpr size_t kMinExternalSliceLength = 16;
+
+// A resource for a slice of an embedder buffer that keeps the buffer alive
+// through a shared owner.
+template <typename Base, typename Char>
+class ExternalSliceResource final : public Base {
+ public:
+  ExternalSliceResource(std::shared_ptr<void> owner, const Char* data,
+                        size_t length)
+      : owner_(std::move(owner)), data_(data), length_(length) {}
+
+  const Char* data() const override { return data_; }
+  size_t length() const override { return length_; }
+
+ private:
+  const std::shared_ptr<void> owner_;
+  const Char* const data_;
+  const size_t length_;
+};
+
+i::MaybeHandle<i::String> NewExternalString(
+    i::Factory* factory, v8::String::ExternalOneByteStringResource* resource) {
+  return factory->NewExternalStringFromOneByte(resource);
+}
+
+i::MaybeHandle<i::String> NewExternalString(
+    i::Factory* factory, v8::String::ExternalStringResource* resource) {
+  return factory->NewExternalStringFromTwoByte(resource);
+}
+
+template <typename Resource, typename Char, typename CopiedChar>
+bool NewExternalSlices(i::Isolate* i_isolate, std::shared_ptr<void> owner,
+                       const Char* data,
+                       const v8::String::ExternalSlice* slices, size_t count,
+                       Local<String>* result, NewStringType type) {
+  for (size_t i = 0; i < count; i++) {
+    if (slices[i].length > static_cast<size_t>(i::String::kMaxLength)) {
+      return false;
+    }
+  }
+  i::Factory* factory = i_isolate->factory();
+  for (size_t i = 0; i < count; i++) {
+    const Char* start = data + slices[i].offset;
+    size_t length = slices[i].length;
+    i::DirectHandle<i::String> string;
+    if (length < kMinExternalSliceLength) {
+      string =
+          NewString(factory, type,
+                    base::Vector<const CopiedChar>(
+                        reinterpret_cast<const CopiedChar*>(start), length))
+              .ToHandleChecked();
+    } else {
+      string = NewExternalString(factory, new Resource(owner, start, length))
+                   .ToHandleChecked();
+      if (type == NewStringType::kInternalized) {
+        string = factory->InternalizeString(string);
+      }
+    }
+    result[i] = Utils::ToLocal(string);
+  }
+  return true;
+}
+
+}  // namespace
+
+bool v8::String::NewExternalOneByteSlices(
+    Isolate* v8_isolate, std::shared_ptr<void> owner, const char* data,
+    const ExternalSlice* slices, size_t count, Local<String>* result,
+    NewStringType type) {
+  CHECK(count == 0 || (data && slices && result));
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  EnterV8NoScriptNoExceptionScope api_scope(i_isolate);
+  ApiRuntimeCallStatsScope rcs_scope(
+      i_isolate, RCCId::kAPI_String_NewExternalOneByteSlices);
+  return NewExternalSlices<
+      ExternalSliceResource<ExternalOneByteStringResource, char>, char,
+      uint8_t>(i_isolate, std::move(owner), data, slices, count, result, type);
+}
+
+bool v8::String::NewExternalTwoByteSlices(
+    Isolate* v8_isolate, std::shared_ptr<void> owner, const uint16_t* data,
+    const ExternalSlice* slices, size_t count, Local<String>* result,
+    NewStringType type) {
+  CHECK(count == 0 || (data && slices && result));
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  EnterV8NoScriptNoExceptionScope api_scope(i_isolate);
+  ApiRuntimeCallStatsScope rcs_scope(
+      i_isolate, RCCId::kAPI_String_NewExternalTwoByteSlices);
+  return NewExternalSlices<
+      ExternalSliceResource<ExternalStringResource, uint16_t>, uint16_t,
+      uint16_t>(i_isolate, std::move(owner), data, slices, count, result,
+                type);
+}
+
 bool v8::String::MakeExternal(v8::String::ExternalStringResource* resource) {
   v8::Isolate* isolate = v8::Isolate::GetCurrent();
   return MakeExternal(isolate, resource);
@@ -8675,6 +9049,35 @@ OwnedBuffer CompiledWasmModule::Serialize() {
 #endif  // V8_ENABLE_WEBASSEMBLY
 }
 
+OwnedBuffer CompiledWasmModule::SerializeNewFunctions() {
+#if V8_ENABLE_WEBASSEMBLY
+  TRACE_EVENT0("v8.wasm", "wasm.SerializeNewFunctions");
+  i::wasm::IncrementalWasmSerializer wasm_serializer(native_module_.get());
+  size_t buffer_size = wasm_serializer.GetSerializedSize();
+  if (buffer_size == 0) return {};
+  std::unique_ptr<uint8_t[]> buffer(new uint8_t[buffer_size]);
+  if (!wasm_serializer.Serialize({buffer.get(), buffer_size})) return {};
+  return {std::move(buffer), buffer_size};
+#else
+  UNREACHABLE();
+#endif  // V8_ENABLE_WEBASSEMBLY
+}
+
+OwnedBuffer CompiledWasmModule::GetCompilationHints() {
+#if V8_ENABLE_WEBASSEMBLY
+  TRACE_EVENT0("v8.wasm", "wasm.GetCompilationHints");
+  i::AccountingAllocator allocator;
+  i::Zone zone(&allocator, ZONE_NAME);
+  i::wasm::ZoneBuffer hints(&zone);
+  i::wasm::EmitProfiledCompilationHintsToBuffer(hints, native_module_.get());
+  std::unique_ptr<uint8_t[]> buffer(new uint8_t[hints.size()]);
+  memcpy(buffer.get(), hints.data(), hints.size());
+  return {std::move(buffer), hints.size()};
+#else
+  UNREACHABLE();
+#endif  // V8_ENABLE_WEBASSEMBLY
+}
+
 MemorySpan<const uint8_t> CompiledWasmModule::GetWireBytesRef() {
 #if V8_ENABLE_WEBASSEMBLY
   base::Vector<const uint8_t> bytes_vec = native_module_->wire_bytes();
@@ -10341,6 +10744,7 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
       i_isolate->external_script_source_size();
   code_statistics->cpu_profiler_metadata_size_ =
       i::CpuProfiler::GetAllProfilersMemorySize(i_isolate);
+  code_statistics->feedback_vector_size_ = i_isolate->feedback_vector_size();
 
   return true;
 }
@@ -10695,6 +11099,8 @@ CALLBACK_SETTER(FatalErrorHandler, FatalErrorCallback, exception_behavior)
 CALLBACK_SETTER(ModifyCodeGenerationFromStringsCallback,
                 ModifyCodeGenerationFromStringsCallback2,
                 modify_code_gen_callback)
+CALLBACK_SETTER(PersistentCompilationCache, PersistentCompilationCache*,
+                persistent_compilation_cache)
 CALLBACK_SETTER(AllowWasmCodeGenerationCallback,
                 AllowWasmCodeGenerationCallback, allow_wasm_code_gen_callback)
 
@@ -11485,6 +11891,17 @@ CpuProfile* CpuProfiler::Stop(ProfilerId id) {
       reinterpret_cast<i::CpuProfiler*>(this)->StopProfiling(id));
 }
 
+CpuProfilingStatus CpuProfiler::StartContinuousProfiling(
+    std::unique_ptr<ContinuousProfileDelegate> delegate,
+    ContinuousProfilingOptions options) {
+  return reinterpret_cast<i::CpuProfiler*>(this)->StartContinuousProfiling(
+      std::move(delegate), options);
+}
+
+void CpuProfiler::StopContinuousProfiling() {
+  reinterpret_cast<i::CpuProfiler*>(this)->StopContinuousProfiling();
+}
+
 void CpuProfiler::UseDetailedSourcePositionsForProfiling(Isolate* v8_isolate) {
   reinterpret_cast<i::Isolate*>(v8_isolate)
       ->SetDetailedSourcePositionsForProfiling(true);
@@ -11727,6 +12144,12 @@ const HeapSnapshot* HeapProfiler::TakeHeapSnapshot(
       reinterpret_cast<i::HeapProfiler*>(this)->TakeSnapshot(options));
 }
 
+bool HeapProfiler::StreamHeapSnapshot(OutputStream* stream,
+                                      const HeapSnapshotOptions& options) {
+  return reinterpret_cast<i::HeapProfiler*>(this)->StreamSnapshot(options,
+                                                                  stream);
+}
+
 const HeapSnapshot* HeapProfiler::TakeHeapSnapshot(ActivityControl* control,
                                                    ObjectNameResolver* resolver,
                                                    bool hide_internals,
@@ -11805,6 +12228,11 @@ AllocationProfile* HeapProfiler::GetAllocationProfile() {
   return reinterpret_cast<i::HeapProfiler*>(this)->GetAllocationProfile();
 }
 
+bool HeapProfiler::WriteSamplingHeapProfileDelta(OutputStream* stream) {
+  return reinterpret_cast<i::HeapProfiler*>(this)
+      ->WriteSamplingHeapProfileDelta(stream);
+}
+
 void HeapProfiler::DeleteAllHeapSnapshots() {
   reinterpret_cast<i::HeapProfiler*>(this)->DeleteAllSnapshots();
 }
@@ -11969,6 +12397,11 @@ void WasmStreaming::SetMoreFunctionsCanBeSerializedCallback(
   UNREACHABLE();
 }
 
+void WasmStreaming::SetBackPressureCallback(size_t,
+                                            std::function<void(bool)>) {
+  UNREACHABLE();
+}
+
 void WasmStreaming::SetUrl(const char* url, size_t length) { UNREACHABLE(); }
 
 // static
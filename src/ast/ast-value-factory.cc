@@ -27,12 +27,15 @@
 
 #include "src/ast/ast-value-factory.h"
 
+#include <vector>
+
 #include "src/base/hashmap-entry.h"
 #include "src/base/logging.h"
 #include "src/common/globals.h"
 #include "src/heap/factory-inl.h"
 #include "src/heap/local-factory-inl.h"
 #include "src/objects/string-inl.h"
+#include "src/objects/string-table.h"
 #include "src/roots/roots.h"
 #include "src/strings/string-hasher.h"
 #include "src/utils/utils-inl.h"
@@ -374,15 +377,48 @@ AstConsString* AstValueFactory::NewConsString(const AstRawString* str1,
 template <typename IsolateT>
 void AstValueFactory::Internalize(IsolateT* isolate) {
   // Strings need to be internalized before values, because values refer to
-  // strings.
+  // strings. They are looked up in one batch per encoding, so that adding the
+  // new ones takes the string table's write lock only twice.
+  std::vector<AstRawString*> one_byte_strings;
+  std::vector<AstRawString*> two_byte_strings;
   for (AstRawString* current = strings_; current != nullptr;) {
     AstRawString* next = current->next();
-    current->Internalize(isolate);
+    if (current->literal_bytes_.empty()) {
+      current->set_string(isolate->factory()->empty_string());
+    } else if (current->is_one_byte()) {
+      one_byte_strings.push_back(current);
+    } else {
+      two_byte_strings.push_back(current);
+    }
     current = next;
   }
+  InternalizeBatch<uint8_t>(isolate, base::VectorOf(one_byte_strings));
+  InternalizeBatch<uint16_t>(isolate, base::VectorOf(two_byte_strings));
 
   ResetStrings();
 }
+
+template <typename Char, typename IsolateT>
+void AstValueFactory::InternalizeBatch(IsolateT* isolate,
+                                       base::Vector<AstRawString*> strings) {
+  if (strings.empty()) return;
+  std::vector<StringTable::SequentialStringData<Char>> data;
+  data.reserve(strings.size());
+  for (AstRawString* string : strings) {
+    DCHECK(!string->has_string_);
+    data.push_back({string->raw_hash_field_,
+                    base::Vector<const Char>::cast(string->literal_bytes_)});
+  }
+  std::vector<IndirectHandle<String>> results(strings.size());
+  isolate->string_table()->LookupStrings(
+      isolate, base::VectorOf<const StringTable::SequentialStringData<Char>>(
+                   data.data(), data.size()),
+      base::VectorOf(results));
+  for (size_t i = 0; i < strings.size(); i++) {
+    strings[i]->set_string(results[i]);
+  }
+}
+
 template EXPORT_TEMPLATE_DEFINE(
     V8_EXPORT_PRIVATE) void AstValueFactory::Internalize(Isolate* isolate);
 template EXPORT_TEMPLATE_DEFINE(
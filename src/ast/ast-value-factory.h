@@ -413,6 +413,8 @@ class AstValueFactory {
     strings_ = nullptr;
     strings_end_ = &strings_;
   }
+  template <typename Char, typename IsolateT>
+  void InternalizeBatch(IsolateT* isolate, base::Vector<AstRawString*> strings);
   V8_EXPORT_PRIVATE const AstRawString* GetOneByteStringInternal(
       base::Vector<const uint8_t> literal);
   const AstRawString* GetTwoByteStringInternal(
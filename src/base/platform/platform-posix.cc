@@ -766,6 +766,23 @@ bool OS::HasLazyCommits() {
 #endif
 }
 #endif  // !V8_OS_ZOS
+
+bool OS::AdviseHugePages(void* address, size_t size) {
+#if V8_OS_LINUX && defined(MADV_HUGEPAGE)
+  // Transparent huge pages are PMD sized, which is 2 MB on the architectures
+  // V8 cares about.
+  constexpr uintptr_t kTransparentHugePageSize = uintptr_t{2} * 1024 * 1024;
+  const uintptr_t start =
+      RoundUp(reinterpret_cast<uintptr_t>(address), kTransparentHugePageSize);
+  const uintptr_t end = RoundDown(reinterpret_cast<uintptr_t>(address) + size,
+                                  kTransparentHugePageSize);
+  if (end <= start) return false;
+  return madvise(reinterpret_cast<void*>(start), end - start, MADV_HUGEPAGE) ==
+         0;
+#else
+  return false;
+#endif
+}
 #endif  // !V8_OS_CYGWIN && !V8_OS_FUCHSIA
 
 const char* OS::GetGCFakeMMapFile() {
@@ -922,6 +939,17 @@ int OS::GetCurrentThreadIdInternal() {
 #endif
 }
 
+int OS::GetCurrentNumaNode() {
+#if V8_OS_LINUX && defined(__NR_getcpu)
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (syscall(__NR_getcpu, &cpu, &node, nullptr) == 0) {
+    return static_cast<int>(node);
+  }
+#endif
+  return 0;
+}
+
 void OS::ExitProcess(int exit_code) {
   // Use _exit instead of exit to avoid races between isolate
   // threads and static destructors.
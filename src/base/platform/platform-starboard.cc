@@ -225,6 +225,8 @@ bool OS::HasLazyCommits() {
   return false;
 }
 
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
 void OS::Sleep(TimeDelta interval) { SbThreadSleep(interval.InMicroseconds()); }
 
 void OS::Abort() { SbSystemBreakIntoDebugger(); }
@@ -267,6 +269,8 @@ int OS::GetCurrentProcessId() {
 
 int OS::GetCurrentThreadIdInternal() { return SbThreadGetId(); }
 
+int OS::GetCurrentNumaNode() { return 0; }
+
 int OS::GetLastError() { return SbSystemGetLastError(); }
 
 // ----------------------------------------------------------------------------
@@ -544,6 +544,14 @@ int OS::GetCurrentThreadIdInternal() {
   return static_cast<int>(::GetCurrentThreadId());
 }
 
+int OS::GetCurrentNumaNode() {
+  PROCESSOR_NUMBER processor;
+  ::GetCurrentProcessorNumberEx(&processor);
+  USHORT node = 0;
+  if (!::GetNumaProcessorNodeEx(&processor, &node)) return 0;
+  return static_cast<int>(node);
+}
+
 void OS::ExitProcess(int exit_code) {
   // Use TerminateProcess to avoid races between isolate threads and
   // static destructors.
@@ -1189,6 +1197,11 @@ bool OS::HasLazyCommits() {
   return false;
 }
 
+bool OS::AdviseHugePages(void* address, size_t size) {
+  // Large pages on Windows need to be allocated as such up front.
+  return false;
+}
+
 void OS::Sleep(TimeDelta interval) {
   ::Sleep(static_cast<DWORD>(interval.InMilliseconds()));
 }
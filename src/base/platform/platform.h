@@ -234,6 +234,12 @@ class V8_BASE_EXPORT OS {
 
   static bool HasLazyCommits();
 
+  // Asks the OS to back the huge-page-aligned part of the given region with
+  // transparent huge pages once it is committed. Returns false if nothing was
+  // advised, e.g. because the region holds no aligned huge page or the OS does
+  // not support this.
+  static bool AdviseHugePages(void* address, size_t size);
+
   // Sleep for a specified time interval.
   static void Sleep(TimeDelta interval);
 
@@ -314,6 +320,10 @@ class V8_BASE_EXPORT OS {
 
   static int GetCurrentThreadId();
 
+  // Returns the NUMA node of the processor the calling thread runs on, or 0
+  // where that is not known. The thread may migrate right after the call.
+  static int GetCurrentNumaNode();
+
   static void AdjustSchedulingParams();
 
   using Address = uintptr_t;
@@ -285,6 +285,13 @@ void BaselineBatchCompiler::EnqueueSFI(Tagged<SharedFunctionInfo> shared) {
   }
 }
 
+void BaselineBatchCompiler::FlushBatch() {
+  if (!v8_flags.concurrent_sparkplug || !is_enabled()) return;
+  if (last_index_ == 0) return;
+  concurrent_compiler_->CompileBatch(compilation_queue_, last_index_);
+  ClearBatch();
+}
+
 void BaselineBatchCompiler::Enqueue(DirectHandle<SharedFunctionInfo> shared) {
   EnsureQueueCapacity();
   compilation_queue_->set(last_index_++, MakeWeak(*shared));
@@ -26,6 +26,9 @@ class BaselineBatchCompiler {
   // Enqueues SharedFunctionInfo of |function| for compilation.
   void EnqueueFunction(DirectHandle<JSFunction> function);
   void EnqueueSFI(Tagged<SharedFunctionInfo> shared);
+  // Compiles the functions enqueued so far on a background thread, without
+  // waiting for the batch to reach the size threshold.
+  void FlushBatch();
 
   void set_enabled(bool enabled) { enabled_ = enabled; }
   bool is_enabled() { return enabled_; }
@@ -0,0 +1,261 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/baseline/baseline-code-cache.h"
+
+#include <cstring>
+#include <utility>
+
+#include "src/base/lazy-instance.h"
+#include "src/baseline/baseline-compiler.h"
+#include "src/codegen/assembler-inl.h"
+#include "src/codegen/reloc-info-inl.h"
+#include "src/execution/isolate.h"
+#include "src/execution/local-isolate-inl.h"
+#include "src/heap/local-factory-inl.h"
+#include "src/objects/bytecode-array-inl.h"
+#include "src/objects/code-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/roots/roots-inl.h"
+#include "src/utils/memcopy.h"
+
+namespace v8 {
+namespace internal {
+namespace baseline {
+
+namespace {
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(BaselineCodeCache, GetProcessWideCodeCache)
+
+template <typename T>
+void AppendToKey(BaselineCodeCache::Key* key, T value) {
+  key->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+// An assembler that generates nothing and only provides the embedded object
+// and code target tables that the relocation of a cached entry reads from.
+class CachedCodeOrigin final : public Assembler {
+ public:
+  explicit CachedCodeOrigin(Zone* zone)
+      : Assembler(zone, AssemblerOptions{},
+                  NewAssemblerBuffer(AssemblerBase::kMinimalBufferSize)) {}
+
+  // Every handle is a fresh one, so that neither table deduplicates entries
+  // and the indices match the ones of the isolate that compiled the code.
+  void AddObject(IndirectHandle<HeapObject> object) {
+    USE(AddEmbeddedObject(object));
+  }
+  void AddBuiltin(IndirectHandle<Code> code) { USE(AddCodeTarget(code)); }
+};
+
+// Returns whether the code needs nothing from the isolate it was compiled in
+// beyond what the embedded object and code target tables describe.
+bool IsShareable(Isolate* isolate, const CodeDesc& desc) {
+  const Address isolate_start = reinterpret_cast<Address>(isolate);
+  const Address isolate_end = isolate_start + sizeof(Isolate);
+  base::Vector<uint8_t> instructions(desc.buffer, desc.instr_size);
+  base::Vector<const uint8_t> reloc_info(desc.buffer + desc.reloc_offset,
+                                         desc.reloc_size);
+  for (RelocIterator it(instructions, reloc_info, 0); !it.done(); it.next()) {
+    switch (it.rinfo()->rmode()) {
+      case RelocInfo::CODE_TARGET:
+      case RelocInfo::COMPRESSED_EMBEDDED_OBJECT:
+      case RelocInfo::NEAR_BUILTIN_ENTRY:
+      case RelocInfo::INTERNAL_REFERENCE:
+      case RelocInfo::INTERNAL_REFERENCE_ENCODED:
+      case RelocInfo::CONST_POOL:
+      case RelocInfo::VENEER_POOL:
+        break;
+      case RelocInfo::EXTERNAL_REFERENCE: {
+        // C++ functions are the same in every isolate, per-isolate data is
+        // not.
+        Address target = it.rinfo()->target_external_reference();
+        if (target >= isolate_start && target < isolate_end) return false;
+        break;
+      }
+      default:
+        // Full embedded objects are referred to by handle location rather
+        // than by index, and off-heap targets depend on where the isolate
+        // mapped the embedded builtins.
+        if (RelocInfo::IsRealRelocMode(it.rinfo()->rmode())) return false;
+        break;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+// static
+BaselineCodeCache* BaselineCodeCache::Get() {
+  return GetProcessWideCodeCache();
+}
+
+// static
+BaselineCodeCache::Key BaselineCodeCache::KeyFor(
+    LocalIsolate* isolate, Tagged<SharedFunctionInfo> shared,
+    Tagged<BytecodeArray> bytecode) {
+  DisallowGarbageCollection no_gc;
+  Key key;
+  AppendToKey(&key,
+              isolate->GetMainThreadIsolateUnsafe()
+                  ->is_short_builtin_calls_enabled());
+  AppendToKey(&key, shared->has_duplicate_parameters());
+  AppendToKey(&key, bytecode->frame_size());
+  AppendToKey(&key, bytecode->parameter_count());
+  AppendToKey(&key, bytecode->max_arguments());
+  AppendToKey(&key, bytecode->incoming_new_target_or_generator_register()
+                        .ToOperand());
+  AppendToKey(&key, bytecode->length());
+  key.append(
+      reinterpret_cast<const char*>(bytecode->GetFirstBytecodeAddress()),
+      bytecode->length());
+  Tagged<TrustedByteArray> handler_table = bytecode->handler_table();
+  AppendToKey(&key, handler_table->length());
+  key.append(reinterpret_cast<const char*>(handler_table->begin()),
+             handler_table->length());
+  // Smis in the constant pool, such as jump table offsets, are baked into the
+  // code. Everything else is only referred to by index.
+  Tagged<TrustedFixedArray> constant_pool = bytecode->constant_pool();
+  AppendToKey(&key, constant_pool->length());
+  for (int i = 0; i < constant_pool->length(); i++) {
+    Tagged<Object> constant = constant_pool->get(i);
+    AppendToKey(&key, IsSmi(constant) ? constant.ptr() : kNullAddress);
+  }
+  return key;
+}
+
+std::shared_ptr<const BaselineCodeCache::Entry> BaselineCodeCache::Lookup(
+    const Key& key) {
+  base::MutexGuard guard(&mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) return nullptr;
+  return it->second;
+}
+
+void BaselineCodeCache::Insert(Key key, LocalIsolate* isolate,
+                               const CodeDesc& desc, const Assembler& origin,
+                               base::Vector<const uint8_t> offset_table,
+                               DirectHandle<SharedFunctionInfo> shared,
+                               DirectHandle<BytecodeArray> bytecode) {
+  if (desc.unwinding_info_size != 0) return;
+  if (!IsShareable(isolate->GetMainThreadIsolateUnsafe(), desc)) return;
+
+  auto entry = std::make_shared<Entry>();
+  {
+    DisallowGarbageCollection no_gc;
+    Tagged<TrustedFixedArray> constant_pool = bytecode->constant_pool();
+    for (IndirectHandle<HeapObject> object : origin.embedded_objects()) {
+      // Null handles stand for heap numbers that are allocated later.
+      if (object.is_null()) return;
+      Entry::ObjectRef ref;
+      if (*object == *shared) {
+        ref.kind = Entry::ObjectRef::Kind::kSharedFunctionInfo;
+      } else if (*object == *bytecode) {
+        ref.kind = Entry::ObjectRef::Kind::kBytecodeArray;
+      } else {
+        int index = 0;
+        while (index < constant_pool->length() &&
+               constant_pool->get(index) != *object) {
+          index++;
+        }
+        if (index < constant_pool->length()) {
+          ref.kind = Entry::ObjectRef::Kind::kConstantPoolEntry;
+          ref.constant_pool_index = index;
+        } else {
+          ReadOnlyRoots roots(isolate);
+          RootIndex root = RootIndex::kFirstReadOnlyRoot;
+          while (root <= RootIndex::kLastReadOnlyRoot &&
+                 roots.object_at(root) != *object) {
+            ++root;
+          }
+          if (root > RootIndex::kLastReadOnlyRoot) return;
+          ref.kind = Entry::ObjectRef::Kind::kReadOnlyRoot;
+          ref.root_index = root;
+        }
+      }
+      entry->embedded_objects_.push_back(ref);
+    }
+    for (IndirectHandle<Code> target : origin.code_targets()) {
+      if (target.is_null() || !target->is_builtin()) return;
+      entry->code_targets_.push_back(target->builtin_id());
+    }
+  }
+
+  entry->desc_ = desc;
+  entry->desc_.buffer = nullptr;
+  entry->desc_.buffer_size = 0;
+  entry->desc_.reloc_offset = 0;
+  entry->desc_.reloc_size = 0;
+  entry->desc_.unwinding_info = nullptr;
+  entry->desc_.origin = nullptr;
+  entry->instructions_.assign(desc.buffer, desc.buffer + desc.instr_size);
+  entry->reloc_info_.assign(desc.buffer + desc.reloc_offset,
+                            desc.buffer + desc.reloc_offset + desc.reloc_size);
+  entry->offset_table_.assign(offset_table.begin(), offset_table.end());
+
+  const size_t entry_size = key.size() + entry->size();
+  base::MutexGuard guard(&mutex_);
+  if (size_ + entry_size > kMaxSize) return;
+  if (entries_.try_emplace(std::move(key), std::move(entry)).second) {
+    size_ += entry_size;
+  }
+}
+
+MaybeHandle<Code> BaselineCodeCache::Entry::Instantiate(
+    LocalIsolate* isolate, Handle<SharedFunctionInfo> shared,
+    Handle<BytecodeArray> bytecode) const {
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  CachedCodeOrigin origin(&zone);
+  Tagged<TrustedFixedArray> constant_pool = bytecode->constant_pool();
+  for (const ObjectRef& ref : embedded_objects_) {
+    Tagged<HeapObject> object;
+    switch (ref.kind) {
+      case ObjectRef::Kind::kSharedFunctionInfo:
+        object = *shared;
+        break;
+      case ObjectRef::Kind::kBytecodeArray:
+        object = *bytecode;
+        break;
+      case ObjectRef::Kind::kConstantPoolEntry:
+        object = Cast<HeapObject>(constant_pool->get(ref.constant_pool_index));
+        break;
+      case ObjectRef::Kind::kReadOnlyRoot:
+        object = Cast<HeapObject>(ReadOnlyRoots(isolate).object_at(
+            ref.root_index));
+        break;
+    }
+    origin.AddObject(handle(object, isolate));
+  }
+  Builtins* builtins = isolate->GetMainThreadIsolateUnsafe()->builtins();
+  for (Builtin builtin : code_targets_) {
+    origin.AddBuiltin(handle(builtins->code(builtin), isolate));
+  }
+
+  // Relocation rewrites the buffer, so every instantiation needs its own copy.
+  std::vector<uint8_t> buffer(instructions_.size() + reloc_info_.size());
+  std::memcpy(buffer.data(), instructions_.data(), instructions_.size());
+  std::memcpy(buffer.data() + instructions_.size(), reloc_info_.data(),
+              reloc_info_.size());
+  CodeDesc desc = desc_;
+  desc.buffer = buffer.data();
+  desc.buffer_size = static_cast<int>(buffer.size());
+  desc.reloc_offset = static_cast<int>(instructions_.size());
+  desc.reloc_size = static_cast<int>(reloc_info_.size());
+  desc.origin = &origin;
+
+  Handle<TrustedByteArray> offset_table =
+      isolate->factory()->empty_trusted_byte_array();
+  if (!offset_table_.empty()) {
+    offset_table = isolate->factory()->NewTrustedByteArray(
+        static_cast<int>(offset_table_.size()));
+    MemCopy(offset_table->begin(), offset_table_.data(), offset_table_.size());
+  }
+  return BaselineCompiler::BuildCode(isolate, shared, bytecode, desc,
+                                     offset_table);
+}
+
+}  // namespace baseline
+}  // namespace internal
+}  // namespace v8
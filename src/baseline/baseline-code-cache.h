@@ -0,0 +1,120 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_BASELINE_BASELINE_CODE_CACHE_H_
+#define V8_BASELINE_BASELINE_CODE_CACHE_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/platform/mutex.h"
+#include "src/base/vector.h"
+#include "src/builtins/builtins.h"
+#include "src/codegen/code-desc.h"
+#include "src/common/globals.h"
+#include "src/handles/handles.h"
+#include "src/roots/roots.h"
+
+namespace v8 {
+namespace internal {
+
+class Assembler;
+class BytecodeArray;
+class Code;
+class LocalIsolate;
+class SharedFunctionInfo;
+
+namespace baseline {
+
+// A process-wide cache of Sparkplug code, shared by all isolates, so that an
+// isolate running a script that another isolate already ran does not compile
+// the same functions again.
+//
+// Sparkplug code is a function of the bytecode it was compiled from, with
+// heap objects referenced only through the constant pool or a few fixed
+// slots. An entry stores the generated code before relocation together with
+// a description of every object and builtin it refers to, and is rebuilt
+// into a fresh Code object against the objects of the isolate that looks it
+// up. Entries are keyed by the bytecode itself rather than by a hash, so a
+// hit is always exact. Code that refers to anything that cannot be described
+// this way (e.g. off-heap builtin targets or external references into the
+// isolate) is not cached.
+class BaselineCodeCache final {
+ public:
+  // Everything the generated code depends on, serialized.
+  using Key = std::string;
+
+  class Entry;
+
+  static BaselineCodeCache* Get();
+
+  static Key KeyFor(LocalIsolate* isolate, Tagged<SharedFunctionInfo> shared,
+                    Tagged<BytecodeArray> bytecode);
+
+  std::shared_ptr<const Entry> Lookup(const Key& key);
+
+  // Records the code in |desc|, assembled by |origin| from |bytecode|, unless
+  // it refers to objects that no other isolate could provide.
+  void Insert(Key key, LocalIsolate* isolate, const CodeDesc& desc,
+              const Assembler& origin, base::Vector<const uint8_t> offset_table,
+              DirectHandle<SharedFunctionInfo> shared,
+              DirectHandle<BytecodeArray> bytecode);
+
+ private:
+  // Upper bound on the size of all entries, to keep processes that run many
+  // different scripts from growing without bound.
+  static constexpr size_t kMaxSize = 64 * MB;
+
+  base::Mutex mutex_;
+  std::unordered_map<Key, std::shared_ptr<const Entry>> entries_;
+  size_t size_ = 0;
+};
+
+class BaselineCodeCache::Entry final {
+ public:
+  // Builds the code of this entry for |shared| and |bytecode| of |isolate|.
+  MaybeHandle<Code> Instantiate(LocalIsolate* isolate,
+                                Handle<SharedFunctionInfo> shared,
+                                Handle<BytecodeArray> bytecode) const;
+
+  size_t size() const {
+    return instructions_.size() + reloc_info_.size() + offset_table_.size() +
+           sizeof(ObjectRef) * embedded_objects_.size() +
+           sizeof(Builtin) * code_targets_.size();
+  }
+
+ private:
+  friend class BaselineCodeCache;
+
+  // How an embedded object of the cached code is found in another isolate.
+  struct ObjectRef {
+    enum class Kind : uint8_t {
+      kSharedFunctionInfo,
+      kBytecodeArray,
+      kConstantPoolEntry,
+      kReadOnlyRoot,
+    };
+    Kind kind;
+    int constant_pool_index = 0;
+    RootIndex root_index = RootIndex::kFirstReadOnlyRoot;
+  };
+
+  // Layout of the code, with buffer, reloc info and origin cleared.
+  CodeDesc desc_;
+  std::vector<uint8_t> instructions_;
+  std::vector<uint8_t> reloc_info_;
+  std::vector<uint8_t> offset_table_;
+  // In the order of the embedded object and code target indices used by the
+  // instructions.
+  std::vector<ObjectRef> embedded_objects_;
+  std::vector<Builtin> code_targets_;
+};
+
+}  // namespace baseline
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_BASELINE_BASELINE_CODE_CACHE_H_
@@ -256,6 +256,11 @@ AssemblerOptions BaselineAssemblerOptions(Isolate* isolate) {
       isolate->is_short_builtin_calls_enabled()
           ? BuiltinCallJumpMode::kPCRelative
           : kFallbackBuiltinCallJumpModeForBaseline;
+  // The shared code cache must see every external reference to decide whether
+  // the code can be used by other isolates.
+  if (v8_flags.shared_baseline_code_cache) {
+    options.record_reloc_info_for_serialization = true;
+  }
   return options;
 }
 
@@ -303,6 +308,13 @@ BaselineCompiler::BaselineCompiler(
 }
 
 void BaselineCompiler::GenerateCode() {
+  if (v8_flags.shared_baseline_code_cache) {
+    cache_key_ = BaselineCodeCache::KeyFor(local_isolate_,
+                                           *shared_function_info_, *bytecode_);
+    cached_entry_ = BaselineCodeCache::Get()->Lookup(*cache_key_);
+    if (cached_entry_) return;
+  }
+
   {
     RCS_BASELINE_SCOPE(PreVisit);
     // Mark exception handlers as valid indirect jump targets. This is required
@@ -338,23 +350,45 @@ void BaselineCompiler::GenerateCode() {
 
 MaybeHandle<Code> BaselineCompiler::Build() {
   RCS_BASELINE_SCOPE(Build);
+  if (cached_entry_) {
+    return cached_entry_->Instantiate(local_isolate_, shared_function_info_,
+                                      bytecode_);
+  }
+
   CodeDesc desc;
   __ GetCode(local_isolate_, &desc);
 
+  if (cache_key_) {
+    BaselineCodeCache::Get()->Insert(
+        std::move(*cache_key_), local_isolate_, desc, masm_,
+        bytecode_offset_table_builder_.bytes(), shared_function_info_,
+        bytecode_);
+  }
+
   // Allocate the bytecode offset table.
   Handle<TrustedByteArray> bytecode_offset_table =
       bytecode_offset_table_builder_.ToBytecodeOffsetTable(local_isolate_);
 
-  Factory::CodeBuilder code_builder(local_isolate_, desc, CodeKind::BASELINE);
+  return BuildCode(local_isolate_, shared_function_info_, bytecode_, desc,
+                   bytecode_offset_table);
+}
+
+// static
+MaybeHandle<Code> BaselineCompiler::BuildCode(
+    LocalIsolate* local_isolate,
+    Handle<SharedFunctionInfo> shared_function_info,
+    Handle<BytecodeArray> bytecode, const CodeDesc& desc,
+    Handle<TrustedByteArray> bytecode_offset_table) {
+  Factory::CodeBuilder code_builder(local_isolate, desc, CodeKind::BASELINE);
   code_builder.set_bytecode_offset_table(bytecode_offset_table);
-  if (shared_function_info_->HasInterpreterData(local_isolate_)) {
+  if (shared_function_info->HasInterpreterData(local_isolate)) {
     code_builder.set_interpreter_data(
-        handle(shared_function_info_->interpreter_data(local_isolate_),
-               local_isolate_));
+        handle(shared_function_info->interpreter_data(local_isolate),
+               local_isolate));
   } else {
-    code_builder.set_interpreter_data(bytecode_);
+    code_builder.set_interpreter_data(bytecode);
   }
-  code_builder.set_parameter_count(bytecode_->parameter_count());
+  code_builder.set_parameter_count(bytecode->parameter_count());
   return code_builder.TryBuild();
 }
 
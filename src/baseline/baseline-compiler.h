@@ -5,11 +5,16 @@
 #ifndef V8_BASELINE_BASELINE_COMPILER_H_
 #define V8_BASELINE_BASELINE_COMPILER_H_
 
+#include <memory>
+#include <optional>
+
 #include "src/base/logging.h"
 #include "src/base/pointer-with-payload.h"
 #include "src/base/threaded-list.h"
+#include "src/base/vector.h"
 #include "src/base/vlq.h"
 #include "src/baseline/baseline-assembler.h"
+#include "src/baseline/baseline-code-cache.h"
 #include "src/execution/local-isolate.h"
 #include "src/handles/handles.h"
 #include "src/interpreter/bytecode-array-iterator.h"
@@ -42,6 +47,8 @@ class BytecodeOffsetTableBuilder {
 
   void Reserve(size_t size) { bytes_.reserve(size); }
 
+  base::Vector<const uint8_t> bytes() const { return base::VectorOf(bytes_); }
+
  private:
   size_t previous_pc_ = 0;
   std::vector<uint8_t> bytes_;
@@ -57,6 +64,13 @@ class BaselineCompiler {
   MaybeHandle<Code> Build();
   static int EstimateInstructionSize(Tagged<BytecodeArray> bytecode);
 
+  // Allocates the baseline Code object for |desc|, generated from |bytecode|.
+  static MaybeHandle<Code> BuildCode(
+      LocalIsolate* local_isolate,
+      Handle<SharedFunctionInfo> shared_function_info,
+      Handle<BytecodeArray> bytecode, const CodeDesc& desc,
+      Handle<TrustedByteArray> bytecode_offset_table);
+
  private:
   void Prologue();
   void PrologueFillFrame();
@@ -183,6 +197,11 @@ class BaselineCompiler {
   BaselineAssembler basm_;
   interpreter::BytecodeArrayIterator iterator_;
   BytecodeOffsetTableBuilder bytecode_offset_table_builder_;
+  // Set in GenerateCode() if --shared-baseline-code-cache is enabled. When
+  // the cache already has the code, nothing is generated and Build()
+  // instantiates the cached entry instead.
+  std::optional<BaselineCodeCache::Key> cache_key_;
+  std::shared_ptr<const BaselineCodeCache::Entry> cached_entry_;
 
   // Mark location as a jump target reachable via indirect branches, required
   // for CFI.
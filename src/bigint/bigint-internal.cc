@@ -18,7 +18,12 @@ bool kAdvancedAlgorithmsEnabledInLibrary = false;
 
 ProcessorImpl::ProcessorImpl(Platform* platform) : platform_(platform) {}
 
-ProcessorImpl::~ProcessorImpl() { delete platform_; }
+ProcessorImpl::ProcessorImpl(ProcessorImpl* parent)
+    : platform_(parent->platform_), parent_(parent) {}
+
+ProcessorImpl::~ProcessorImpl() {
+  if (parent_ == nullptr) delete platform_;
+}
 
 Status ProcessorImpl::get_and_clear_status() {
   Status result = status_;
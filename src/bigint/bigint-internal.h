@@ -5,7 +5,9 @@
 #ifndef V8_BIGINT_BIGINT_INTERNAL_H_
 #define V8_BIGINT_BIGINT_INTERNAL_H_
 
+#include <atomic>
 #include <memory>
+#include <thread>
 
 #include "src/bigint/bigint.h"
 
@@ -16,6 +18,9 @@ constexpr uint32_t kKaratsubaThreshold = 34;
 constexpr uint32_t kToomThreshold = 193;
 constexpr uint32_t kFftThreshold = 1500;
 constexpr uint32_t kFftInnerThreshold = 200;
+// Multiplications with a longer factor may split work across the Platform's
+// worker threads.
+constexpr uint32_t kParallelMultiplyThreshold = 20000;
 
 constexpr uint32_t kBurnikelThreshold = 57;
 constexpr uint32_t kNewtonInversionThreshold = 50;
@@ -29,6 +34,11 @@ class ProcessorImpl : public Processor {
   explicit ProcessorImpl(Platform* platform);
   ~ProcessorImpl();
 
+  // Creates a processor for one of {parent}'s parallel tasks. It uses, but
+  // does not own, {parent}'s platform, and propagates interrupts through
+  // {parent}.
+  explicit ProcessorImpl(ProcessorImpl* parent);
+
   Status get_and_clear_status();
 
   void Multiply(RWDigits Z, Digits X, Digits Y);
@@ -78,6 +88,20 @@ class ProcessorImpl : public Processor {
 
   bool should_terminate() { return status_ == Status::kInterrupted; }
 
+  // Returns how many parallel tasks a multiplication with a longer factor of
+  // {len} digits should be split into. Processors of parallel tasks never
+  // split their work further.
+  uint32_t ParallelismFor(uint32_t len) {
+    if (parent_ != nullptr || len < kParallelMultiplyThreshold) return 1;
+    return platform_->MaxConcurrency();
+  }
+
+  // Calls {callback(i, worker)} for every {i} in [0, count) through the
+  // platform, where {worker} is a processor private to that call. Afterwards,
+  // {should_terminate()} reports whether any of the calls were interrupted.
+  template <typename Callback>
+  void ParallelFor(uint32_t count, const Callback& callback);
+
   // Each unit is supposed to represent approximately one CPU {mul} instruction.
   // Doesn't need to be accurate; we just want to make sure to check for
   // interrupt requests every now and then (roughly every 10-100 ms; often
@@ -89,6 +113,7 @@ class ProcessorImpl : public Processor {
     work_estimate_ += estimate;
     if (work_estimate_ >= kWorkEstimateThreshold) {
       work_estimate_ = 0;
+      if (parent_ != nullptr) return PollParentInterrupt();
       if (platform_->InterruptRequested()) {
         status_ = Status::kInterrupted;
       }
@@ -96,9 +121,25 @@ class ProcessorImpl : public Processor {
   }
 
  private:
+  // The platform may only be asked for interrupts on the thread that called
+  // into the root processor; other workers just pick up the shared result.
+  void PollParentInterrupt() {
+    if (std::this_thread::get_id() == parent_->parallel_thread_ &&
+        platform_->InterruptRequested()) {
+      parent_->workers_interrupted_.store(true, std::memory_order_relaxed);
+    }
+    if (parent_->workers_interrupted_.load(std::memory_order_relaxed)) {
+      status_ = Status::kInterrupted;
+    }
+  }
+
   uintptr_t work_estimate_{0};
   Status status_{Status::kOk};
   Platform* platform_;
+  ProcessorImpl* parent_{nullptr};
+  // Only used while this processor runs parallel tasks.
+  std::thread::id parallel_thread_;
+  std::atomic<bool> workers_interrupted_{false};
 };
 
 // Prevent computations of scratch space and number of bits from overflowing.
@@ -156,6 +197,38 @@ class ScratchDigits : public RWDigits {
   Storage storage_;
 };
 
+template <typename Callback>
+void ProcessorImpl::ParallelFor(uint32_t count, const Callback& callback) {
+  class Task : public Platform::ParallelTask {
+   public:
+    Task(ProcessorImpl* parent, const Callback& callback)
+        : parent_(parent), callback_(callback) {}
+
+    void Run(uint32_t index) override {
+      if (parent_->workers_interrupted_.load(std::memory_order_relaxed)) {
+        return;
+      }
+      ProcessorImpl worker(parent_);
+      callback_(index, &worker);
+      if (worker.should_terminate()) {
+        parent_->workers_interrupted_.store(true, std::memory_order_relaxed);
+      }
+    }
+
+   private:
+    ProcessorImpl* parent_;
+    const Callback& callback_;
+  };
+  DCHECK(parent_ == nullptr);
+  Task task(this, callback);
+  parallel_thread_ = std::this_thread::get_id();
+  workers_interrupted_.store(false, std::memory_order_relaxed);
+  platform_->RunInParallel(&task, count);
+  if (workers_interrupted_.load(std::memory_order_relaxed)) {
+    status_ = Status::kInterrupted;
+  }
+}
+
 }  // namespace bigint
 }  // namespace v8
 
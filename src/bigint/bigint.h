@@ -204,6 +204,27 @@ class Platform {
   // a Platform subclass that overrides this method. It will be queried
   // every now and then by long-running operations.
   virtual bool InterruptRequested() { return false; }
+
+  // A unit of work that can be split into independent, numbered pieces.
+  class ParallelTask {
+   public:
+    virtual ~ParallelTask() = default;
+    virtual void Run(uint32_t index) = 0;
+  };
+
+  // If you want very large multiplications (and the divisions and string
+  // conversions built on them) to use several threads, implement a Platform
+  // subclass that overrides these two methods.
+  // {MaxConcurrency} is the number of threads worth splitting work for; the
+  // default of 1 keeps everything on the calling thread.
+  // {RunInParallel} must call {task->Run(i)} exactly once for every {i} in
+  // [0, count), from any number of threads, and return only when all of
+  // these calls have returned. {InterruptRequested} is only ever queried on
+  // the thread that called into the Processor.
+  virtual uint32_t MaxConcurrency() { return 1; }
+  virtual void RunInParallel(ParallelTask* task, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) task->Run(i);
+  }
 };
 
 // These are the operations that this library supports.
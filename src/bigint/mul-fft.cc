@@ -465,7 +465,8 @@ class FFTContainer {
 
   void PointwiseMultiply(const FFTContainer& other);
   void DoPointwiseMultiplication(const FFTContainer& other, uint32_t start,
-                                 uint32_t end, digit_t* temp);
+                                 uint32_t end, digit_t* temp,
+                                 ProcessorImpl* processor);
 
  private:
   const uint32_t n_;       // Number of parts.
@@ -724,7 +725,8 @@ void MultiplyFFT_Inner(RWDigits Z, Digits X, Digits Y, const Parameters& params,
 // Actual implementation of pointwise multiplications.
 void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
                                              uint32_t start, uint32_t end,
-                                             digit_t* temp) {
+                                             digit_t* temp,
+                                             ProcessorImpl* processor) {
   // The (K_ & 3) != 0 condition makes sure that the inner FFT gets
   // to split the work into at least 4 chunks.
   bool use_fft = length_ >= kFftInnerThreshold && (K_ & 3) == 0;
@@ -735,11 +737,11 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
     Digits A(part_[i], length_);
     Digits B(other.part_[i], length_);
     if (use_fft) {
-      MultiplyFFT_Inner(result, A, B, params, processor_);
+      MultiplyFFT_Inner(result, A, B, params, processor);
     } else {
-      processor_->Multiply(result, A, B);
+      processor->Multiply(result, A, B);
     }
-    if (processor_->should_terminate()) return;
+    if (processor->should_terminate()) return;
     ModFnDoubleWidth(part_[i], result.digits(), length_);
     // To improve cache friendliness, we perform the first level of the
     // backwards FFT here.
@@ -752,7 +754,21 @@ void FFTContainer::DoPointwiseMultiplication(const FFTContainer& other,
 // Convenient entry point for pointwise multiplications.
 void FFTContainer::PointwiseMultiply(const FFTContainer& other) {
   DCHECK(n_ == other.n_);
-  DoPointwiseMultiplication(other, 0, n_, temp_);
+  uint32_t pairs = n_ / 2;
+  uint32_t tasks = std::min(processor_->ParallelismFor(n_ * length_), pairs);
+  if (tasks <= 1) {
+    return DoPointwiseMultiplication(other, 0, n_, temp_, processor_);
+  }
+  // The parts are independent, except that each odd part gets combined with
+  // its predecessor, so every task gets a range of whole pairs.
+  uint32_t pairs_per_task = DIV_CEIL(pairs, tasks);
+  tasks = DIV_CEIL(pairs, pairs_per_task);
+  processor_->ParallelFor(tasks, [&](uint32_t i, ProcessorImpl* worker) {
+    uint32_t start = 2 * i * pairs_per_task;
+    uint32_t end = std::min(n_, start + 2 * pairs_per_task);
+    Storage temp(2 * length_);
+    DoPointwiseMultiplication(other, start, end, temp.get(), worker);
+  });
 }
 
 }  // namespace
@@ -772,13 +788,25 @@ void ProcessorImpl::MultiplyFFT(RWDigits Z, Digits X, Digits Y) {
   int omega = params.r;  // really: 2^r
 
   FFTContainer a(params.n, params.K, this);
-  a.Start(X, params.s, 0, omega);
   if (X == Y) {
     // Squaring.
+    a.Start(X, params.s, 0, omega);
     a.PointwiseMultiply(a);
   } else {
     FFTContainer b(params.n, params.K, this);
-    b.Start(Y, params.s, 0, omega);
+    if (ParallelismFor(X.len()) > 1) {
+      // The two forward transforms only touch their own container.
+      ParallelFor(2, [&](uint32_t i, ProcessorImpl* /* worker */) {
+        if (i == 0) {
+          a.Start(X, params.s, 0, omega);
+        } else {
+          b.Start(Y, params.s, 0, omega);
+        }
+      });
+    } else {
+      a.Start(X, params.s, 0, omega);
+      b.Start(Y, params.s, 0, omega);
+    }
     a.PointwiseMultiply(b);
   }
   if (should_terminate()) return;
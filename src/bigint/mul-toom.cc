@@ -208,6 +208,23 @@ void ProcessorImpl::MultiplyToomCook(RWDigits Z, Digits X, Digits Y) {
   Digits X0(X, 0, k);
   Toom3Main(Z, X0, Y);
   if (X.len() > Y.len()) {
+    uint32_t chunks = DIV_CEIL(X.len() - k, k);
+    if (chunks > 1 && ParallelismFor(X.len()) > 1) {
+      // Neighbouring chunk products overlap in {Z}, so every task writes to
+      // its own slice of {T}, and the slices are added up afterwards.
+      ScratchDigits T(chunks * 2 * k);
+      ParallelFor(chunks, [&](uint32_t j, ProcessorImpl* worker) {
+        Digits Xi(X, (j + 1) * k, k);
+        RWDigits Tj(T, j * 2 * k, 2 * k);
+        worker->Toom3Main(Tj, Xi, Y);
+      });
+      if (should_terminate()) return;
+      for (uint32_t j = 0; j < chunks; j++) {
+        Digits Tj(T, j * 2 * k, 2 * k);
+        AddAndReturnOverflow(Z + (j + 1) * k, Tj);  // Can't overflow.
+      }
+      return;
+    }
     ScratchDigits T(2 * k);
     for (uint32_t i = k; i < X.len(); i += k) {
       Digits Xi(X, i, k);
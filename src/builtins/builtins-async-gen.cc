@@ -72,6 +72,28 @@ TNode<Object> AsyncBuiltinsAssembler::Await(TNode<Context> context,
                                             const GetClosures& get_closures) {
   const TNode<NativeContext> native_context = LoadNativeContext(context);
 
+  // Get or allocate resolve and reject handlers
+  auto [on_resolve, on_reject] = get_closures(native_context);
+
+  TVARIABLE(Object, var_result);
+  Label if_primitive(this), if_generic(this), done(this);
+
+  // Awaiting a primitive would wrap it into a promise that is fulfilled right
+  // away, and then immediately enqueue that promise's fulfill reaction. Unless
+  // PromiseHooks or the debugger could observe the wrapper promise, skip it
+  // and enqueue the reaction job directly.
+  GotoIf(NeedsAnyPromiseHooks(), &if_generic);
+  GotoIf(TaggedIsSmi(value), &if_primitive);
+  Branch(IsJSReceiver(CAST(value)), &if_generic, &if_primitive);
+
+  BIND(&if_primitive);
+  {
+    EnqueueAwaitFulfillReaction(native_context, value, on_resolve, on_reject);
+    var_result = UndefinedConstant();
+    Goto(&done);
+  }
+
+  BIND(&if_generic);
   // We do the `PromiseResolve(%Promise%,value)` avoiding to unnecessarily
   // create wrapper promises. Now if {value} is already a promise with the
   // intrinsics %Promise% constructor as its "constructor", we don't need
@@ -124,9 +146,6 @@ TNode<Object> AsyncBuiltinsAssembler::Await(TNode<Context> context,
     value = var_value.value();
   }
 
-  // Get or allocate resolve and reject handlers
-  auto [on_resolve, on_reject] = get_closures(native_context);
-
   // Deal with PromiseHooks and debug support in the runtime. This
   // also allocates the throwaway promise, which is only needed in
   // case of PromiseHooks or debugging.
@@ -156,8 +175,12 @@ TNode<Object> AsyncBuiltinsAssembler::Await(TNode<Context> context,
   }
   BIND(&if_instrumentation_done);
 
-  return CallBuiltin(Builtin::kPerformPromiseThen, native_context, value,
-                     on_resolve, on_reject, var_throwaway.value());
+  var_result = CallBuiltin(Builtin::kPerformPromiseThen, native_context, value,
+                           on_resolve, on_reject, var_throwaway.value());
+  Goto(&done);
+
+  BIND(&done);
+  return var_result.value();
 }
 
 TNode<Object> AsyncBuiltinsAssembler::AwaitWithReusableClosures(
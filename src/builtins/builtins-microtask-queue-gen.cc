@@ -36,9 +36,20 @@ class MicrotaskQueueBuiltinsAssembler : public CodeStubAssembler {
                                            TNode<IntPtrT> start,
                                            TNode<IntPtrT> index);
 
-  void PrepareForContext(TNode<Context> microtask_context, Label* bailout);
+  // Consecutive microtasks of the same native context are run as a batch:
+  // the native context stays entered between them, on top of the
+  // {base_entered_context_count} contexts that were entered before, and
+  // {var_entered_native_context} holds it (or Smi zero if there is none).
+  void PrepareForContext(TNode<NativeContext> native_context,
+                         TNode<IntPtrT> base_entered_context_count,
+                         TVariable<Object>* var_entered_native_context,
+                         Label* bailout);
+  void LeaveBatchedContext(TNode<IntPtrT> base_entered_context_count,
+                           TVariable<Object>* var_entered_native_context);
   void RunSingleMicrotask(TNode<Context> current_context,
-                          TNode<Microtask> microtask);
+                          TNode<Microtask> microtask,
+                          TNode<IntPtrT> base_entered_context_count,
+                          TVariable<Object>* var_entered_native_context);
   void IncrementFinishedMicrotaskCount(TNode<RawPtrT> microtask_queue);
 
   TNode<Context> GetCurrentContext();
@@ -110,17 +121,43 @@ TNode<IntPtrT> MicrotaskQueueBuiltinsAssembler::CalculateRingBufferOffset(
 }
 
 void MicrotaskQueueBuiltinsAssembler::PrepareForContext(
-    TNode<Context> native_context, Label* bailout) {
+    TNode<NativeContext> native_context,
+    TNode<IntPtrT> base_entered_context_count,
+    TVariable<Object>* var_entered_native_context, Label* bailout) {
   CSA_DCHECK(this, IsNativeContext(native_context));
 
   // Skip the microtask execution if the associated context is shutdown.
   GotoIf(WordEqual(GetMicrotaskQueue(native_context), IntPtrConstant(0)),
          bailout);
 
+  // The previous microtask may have left the same native context entered.
+  Label done(this);
+  GotoIf(TaggedEqual(native_context, var_entered_native_context->value()),
+         &done);
+  LeaveBatchedContext(base_entered_context_count, var_entered_native_context);
   EnterContext(native_context);
+  *var_entered_native_context = native_context;
+  Goto(&done);
+
+  BIND(&done);
+  CSA_DCHECK(this, IntPtrEqual(GetEnteredContextCount(),
+                               IntPtrAdd(base_entered_context_count,
+                                         IntPtrConstant(1))));
   SetCurrentContext(native_context);
 }
 
+void MicrotaskQueueBuiltinsAssembler::LeaveBatchedContext(
+    TNode<IntPtrT> base_entered_context_count,
+    TVariable<Object>* var_entered_native_context) {
+  Label done(this);
+  GotoIf(TaggedIsSmi(var_entered_native_context->value()), &done);
+  RewindEnteredContext(base_entered_context_count);
+  *var_entered_native_context = SmiConstant(0);
+  Goto(&done);
+
+  BIND(&done);
+}
+
 #ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
 void MicrotaskQueueBuiltinsAssembler::SetupContinuationPreservedEmbedderData(
     TNode<Microtask> microtask) {
@@ -143,12 +180,17 @@ void MicrotaskQueueBuiltinsAssembler::ClearContinuationPreservedEmbedderData() {
 #endif  // V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
 
 void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
-    TNode<Context> current_context, TNode<Microtask> microtask) {
+    TNode<Context> current_context, TNode<Microtask> microtask,
+    TNode<IntPtrT> base_entered_context_count,
+    TVariable<Object>* var_entered_native_context) {
   CSA_DCHECK(this, TaggedIsNotSmi(microtask));
   CSA_DCHECK(this, Word32BinaryNot(IsExecutionTerminating()));
 
   StoreRoot(RootIndex::kCurrentMicrotask, microtask);
-  TNode<IntPtrT> saved_entered_context_count = GetEnteredContextCount();
+  // The number of entered contexts while the native context of the microtask
+  // is entered. Microtasks that throw may leave more contexts entered.
+  TNode<IntPtrT> batched_entered_context_count =
+      IntPtrAdd(base_entered_context_count, IntPtrConstant(1));
   TNode<Map> microtask_map = LoadMap(microtask);
   TNode<Uint16T> microtask_type = LoadMapInstanceType(microtask_map);
 
@@ -177,7 +219,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context =
         LoadObjectField<Context>(microtask, offsetof(CallableTask, context_));
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForContext(native_context, base_entered_context_count,
+                      var_entered_native_context, &done);
 
 #ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
     SetupContinuationPreservedEmbedderData(microtask);
@@ -188,7 +231,7 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
       ScopedExceptionHandler handler(this, &if_exception, &var_exception);
       Call(microtask_context, callable, UndefinedConstant());
     }
-    RewindEnteredContext(saved_entered_context_count);
+    RewindEnteredContext(batched_entered_context_count);
     SetCurrentContext(current_context);
 #ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
     ClearContinuationPreservedEmbedderData();
@@ -202,6 +245,9 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
         LoadObjectField(microtask, offsetof(CallbackTask, callback_));
     const TNode<Object> microtask_data =
         LoadObjectField(microtask, offsetof(CallbackTask, data_));
+    // Callbacks run in the current context, without any context entered.
+    LeaveBatchedContext(base_entered_context_count,
+                        var_entered_native_context);
 #ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
     SetupContinuationPreservedEmbedderData(microtask);
 #endif
@@ -233,7 +279,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, offsetof(PromiseResolveThenableJobTask, context_));
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForContext(native_context, base_entered_context_count,
+                      var_entered_native_context, &done);
 
     const TNode<Object> promise_to_resolve = LoadObjectField(
         microtask,
@@ -257,7 +304,7 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     RunAllPromiseHooks(PromiseHookType::kAfter, microtask_context,
                    CAST(promise_to_resolve));
 
-    RewindEnteredContext(saved_entered_context_count);
+    RewindEnteredContext(batched_entered_context_count);
     SetCurrentContext(current_context);
 #ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
     ClearContinuationPreservedEmbedderData();
@@ -271,7 +318,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, offsetof(PromiseReactionJobTask, context_));
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForContext(native_context, base_entered_context_count,
+                      var_entered_native_context, &done);
 
     const TNode<Object> argument =
         LoadObjectField(microtask, offsetof(PromiseReactionJobTask, argument_));
@@ -302,7 +350,7 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     ClearContinuationPreservedEmbedderData();
 #endif  // V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
 
-    RewindEnteredContext(saved_entered_context_count);
+    RewindEnteredContext(batched_entered_context_count);
     SetCurrentContext(current_context);
     Goto(&done);
   }
@@ -313,7 +361,8 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     TNode<Context> microtask_context = LoadObjectField<Context>(
         microtask, offsetof(PromiseReactionJobTask, context_));
     TNode<NativeContext> native_context = LoadNativeContext(microtask_context);
-    PrepareForContext(native_context, &done);
+    PrepareForContext(native_context, base_entered_context_count,
+                      var_entered_native_context, &done);
 
     const TNode<Object> argument =
         LoadObjectField(microtask, offsetof(PromiseReactionJobTask, argument_));
@@ -344,7 +393,7 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     ClearContinuationPreservedEmbedderData();
 #endif  // V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
 
-    RewindEnteredContext(saved_entered_context_count);
+    RewindEnteredContext(batched_entered_context_count);
     SetCurrentContext(current_context);
     Goto(&done);
   }
@@ -357,7 +406,10 @@ void MicrotaskQueueBuiltinsAssembler::RunSingleMicrotask(
     // Report unhandled exceptions from microtasks.
     CallRuntime(Runtime::kReportMessageFromMicrotask, GetCurrentContext(),
                 var_exception.value());
-    RewindEnteredContext(saved_entered_context_count);
+    RewindEnteredContext(Select<IntPtrT>(
+        TaggedIsSmi(var_entered_native_context->value()),
+        [=] { return base_entered_context_count; },
+        [=] { return batched_entered_context_count; }));
     SetCurrentContext(current_context);
     Goto(&done);
   }
@@ -587,7 +639,10 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   auto microtask_queue =
       UncheckedParameter<RawPtrT>(Descriptor::kMicrotaskQueue);
 
-  Label loop(this), done(this);
+  TNode<IntPtrT> base_entered_context_count = GetEnteredContextCount();
+  TVARIABLE(Object, var_entered_native_context, SmiConstant(0));
+
+  Label loop(this, &var_entered_native_context), done(this);
   Goto(&loop);
   BIND(&loop);
 
@@ -614,12 +669,15 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   SetMicrotaskQueueSize(microtask_queue, new_size);
   SetMicrotaskQueueStart(microtask_queue, new_start);
 
-  RunSingleMicrotask(current_context, microtask);
+  RunSingleMicrotask(current_context, microtask, base_entered_context_count,
+                     &var_entered_native_context);
   IncrementFinishedMicrotaskCount(microtask_queue);
   Goto(&loop);
 
   BIND(&done);
   {
+    LeaveBatchedContext(base_entered_context_count,
+                        &var_entered_native_context);
     // Reset the "current microtask" on the isolate.
     StoreRoot(RootIndex::kCurrentMicrotask, UndefinedConstant());
     Return(UndefinedConstant());
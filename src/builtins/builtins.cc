@@ -666,6 +666,7 @@ Builtins::JSBuiltinStateFlags Builtins::GetJSBuiltinState(Builtin builtin) {
     case Builtin::kStringCreateLazyDeoptContinuation:
     case Builtin::kGenericLazyDeoptContinuation:
     case Builtin::kPromiseConstructorLazyDeoptContinuation:
+    case Builtin::kRegExpExecFromTestLazyDeoptContinuation:
       return JSBuiltinStateFlag::kDisabledJSBuiltin;
 
     // These builtins with JS calling convention are not JS language builtins
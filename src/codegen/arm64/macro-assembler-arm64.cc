@@ -4028,6 +4028,19 @@ void MacroAssembler::LoadCodePointerTableBase(Register destination) {
 }
 #endif  // V8_ENABLE_SANDBOX
 
+void MacroAssembler::LoadJSDispatchTableBase(Register destination) {
+  if (builtin() == Builtin::kNoBuiltinId &&
+      !options().isolate_independent_code) {
+    // Saves a dependent load on every call through the table. The table is
+    // never moved, so this is as safe as the constant handle case below.
+    Ldr(destination, ExternalReference::js_dispatch_table_address());
+  } else {
+    CHECK(root_array_available());
+    Ldr(destination,
+        ExternalReferenceAsOperand(IsolateFieldId::kJSDispatchTable));
+  }
+}
+
 void MacroAssembler::LoadEntrypointFromJSDispatchTable(Register destination,
                                                        Register dispatch_handle,
                                                        Register scratch) {
@@ -4035,8 +4048,7 @@ void MacroAssembler::LoadEntrypointFromJSDispatchTable(Register destination,
   ASM_CODE_COMMENT(this);
 
   Register index = destination;
-  CHECK(root_array_available());
-  Ldr(scratch, ExternalReferenceAsOperand(IsolateFieldId::kJSDispatchTable));
+  LoadJSDispatchTableBase(scratch);
   Mov(index, Operand(dispatch_handle, LSR, kJSDispatchHandleShift));
   Add(scratch, scratch, Operand(index, LSL, kJSDispatchTableEntrySizeLog2));
   Ldr(destination, MemOperand(scratch, JSDispatchEntry::kEntrypointOffset));
@@ -4069,8 +4081,7 @@ void MacroAssembler::LoadParameterCountFromJSDispatchTable(
   ASM_CODE_COMMENT(this);
 
   Register index = destination;
-  CHECK(root_array_available());
-  Ldr(scratch, ExternalReferenceAsOperand(IsolateFieldId::kJSDispatchTable));
+  LoadJSDispatchTableBase(scratch);
   Mov(index, Operand(dispatch_handle, LSR, kJSDispatchHandleShift));
   Add(scratch, scratch, Operand(index, LSL, kJSDispatchTableEntrySizeLog2));
   static_assert(JSDispatchEntry::kParameterCountMask == 0xffff);
@@ -4084,8 +4095,7 @@ void MacroAssembler::LoadEntrypointAndParameterCountFromJSDispatchTable(
   ASM_CODE_COMMENT(this);
 
   Register index = parameter_count;
-  CHECK(root_array_available());
-  Ldr(scratch, ExternalReferenceAsOperand(IsolateFieldId::kJSDispatchTable));
+  LoadJSDispatchTableBase(scratch);
   Mov(index, Operand(dispatch_handle, LSR, kJSDispatchHandleShift));
   Add(scratch, scratch, Operand(index, LSL, kJSDispatchTableEntrySizeLog2));
   Ldr(entrypoint, MemOperand(scratch, JSDispatchEntry::kEntrypointOffset));
@@ -1741,6 +1741,9 @@ class V8_EXPORT_PRIVATE MacroAssembler : public MacroAssemblerBase {
   void LoadCodePointerTableBase(Register destination);
 #endif
 
+  // Load the base address of the JSDispatchTable. Code that is specific to an
+  // isolate embeds the address, everything else loads it from the isolate.
+  void LoadJSDispatchTableBase(Register destination);
   void LoadEntrypointFromJSDispatchTable(Register destination,
                                          Register dispatch_handle,
                                          Register scratch);
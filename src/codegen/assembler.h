@@ -477,6 +477,15 @@ class V8_EXPORT_PRIVATE AssemblerBase : public Malloced {
   // generated code.
   static constexpr int kDefaultBufferSize = 4 * KB;
 
+  // The handles that the generated code refers to by index, see
+  // {code_targets_} and {embedded_objects_} below.
+  const std::vector<IndirectHandle<Code>>& code_targets() const {
+    return code_targets_;
+  }
+  const std::vector<IndirectHandle<HeapObject>>& embedded_objects() const {
+    return embedded_objects_;
+  }
+
  protected:
   // Add 'target' to the {code_targets_} vector, if necessary, and return the
   // offset at which it is stored.
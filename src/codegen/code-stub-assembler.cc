@@ -6628,8 +6628,14 @@ TNode<TIndex> CodeStubAssembler::CalculateNewElementsCapacity(
   static_assert(std::is_same_v<TIndex, Smi> || std::is_same_v<TIndex, IntPtrT>,
                 "Only Smi or IntPtrT old_capacity is allowed");
   Comment("TryGrowElementsCapacity");
-  TNode<TIndex> half_old_capacity = WordOrSmiShr(old_capacity, 1);
-  TNode<TIndex> new_capacity = IntPtrOrSmiAdd(half_old_capacity, old_capacity);
+  // Keep in sync with JSObject::NewElementsCapacity.
+  TNode<TIndex> growth = Select<TIndex>(
+      UintPtrOrSmiGreaterThanOrEqual(
+          old_capacity,
+          IntPtrOrSmiConstant<TIndex>(JSObject::kLargeElementsCapacity)),
+      [=] { return old_capacity; },
+      [=, this] { return WordOrSmiShr(old_capacity, 1); });
+  TNode<TIndex> new_capacity = IntPtrOrSmiAdd(growth, old_capacity);
   TNode<TIndex> padding =
       IntPtrOrSmiConstant<TIndex>(JSObject::kMinAddedElementsCapacity);
   return IntPtrOrSmiAdd(new_capacity, padding);
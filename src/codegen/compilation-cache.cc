@@ -4,8 +4,13 @@
 
 #include "src/codegen/compilation-cache.h"
 
+#include <memory>
+
+#include "include/v8-platform.h"
+#include "src/codegen/script-details.h"
 #include "src/common/globals.h"
 #include "src/heap/factory.h"
+#include "src/init/v8.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/objects/compilation-cache-table-inl.h"
@@ -13,6 +18,9 @@
 #include "src/objects/objects.h"
 #include "src/objects/slots.h"
 #include "src/objects/visitors.h"
+#include "src/snapshot/code-serializer.h"
+#include "src/tasks/cancelable-task.h"
+#include "src/tasks/task-utils.h"
 #include "src/utils/ostreams.h"
 
 namespace v8 {
@@ -21,6 +29,34 @@ namespace internal {
 // Initial size of each compilation cache table allocated.
 static const int kInitialCacheSize = 64;
 
+namespace {
+
+// Key of |source| in the persistent cache. The hash is 64-bit FNV-1a over
+// the UTF-16 code units, so it is stable across processes and does not
+// depend on whether the string is stored one-byte or two-byte.
+v8::PersistentCompilationCache::Key PersistentScriptKey(
+    Isolate* isolate, Handle<String> source,
+    const ScriptDetails& script_details) {
+  source = String::Flatten(isolate, source);
+  uint64_t hash = 0xcbf29ce484222325;
+  auto add = [&hash](const auto& chars) {
+    for (uint16_t c : chars) {
+      hash = (hash ^ (c & 0xFF)) * 0x100000001b3;
+      hash = (hash ^ (c >> 8)) * 0x100000001b3;
+    }
+  };
+  DisallowGarbageCollection no_gc;
+  String::FlatContent content = source->GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    add(content.ToOneByteVector());
+  } else {
+    add(content.ToUC16Vector());
+  }
+  return {hash, source->length(), script_details.origin_options};
+}
+
+}  // namespace
+
 CompilationCache::CompilationCache(Isolate* isolate)
     : isolate_(isolate),
       script_(isolate),
@@ -303,6 +339,78 @@ void CompilationCache::PutScript(
   script_.Put(source, function_info);
 }
 
+MaybeDirectHandle<SharedFunctionInfo> CompilationCache::LookupPersistentScript(
+    Handle<String> source, const ScriptDetails& script_details,
+    LanguageMode language_mode, MaybeDirectHandle<Script> maybe_script) {
+  v8::PersistentCompilationCache* cache =
+      isolate()->persistent_compilation_cache();
+  if (cache == nullptr || !IsEnabledScript(language_mode)) return {};
+
+  std::unique_ptr<ScriptCompiler::CachedData> data = cache->Lookup(
+      reinterpret_cast<v8::Isolate*>(isolate()),
+      PersistentScriptKey(isolate(), source, script_details));
+  if (!data) return {};
+  AlignedCachedData cached_data(data->data, data->length);
+  DirectHandle<SharedFunctionInfo> result;
+  if (!CodeSerializer::Deserialize(isolate(), &cached_data, source,
+                                   script_details, maybe_script)
+           .ToHandle(&result) ||
+      !result->is_compiled()) {
+    return {};
+  }
+  LOG(isolate(), CompilationCacheEvent("hit", "persistent-script", *result));
+  PutScript(source, language_mode, result);
+  return result;
+}
+
+void CompilationCache::PutPersistentScript(
+    Handle<String> source, const ScriptDetails& script_details,
+    LanguageMode language_mode,
+    DirectHandle<SharedFunctionInfo> function_info) {
+  if (isolate()->persistent_compilation_cache() == nullptr ||
+      !IsEnabledScript(language_mode)) {
+    return;
+  }
+  persistent_scripts_.push_back(*function_info);
+  persistent_script_keys_.push_back(
+      PersistentScriptKey(isolate(), source, script_details));
+
+  if (!persistent_store_task_posted_) {
+    persistent_store_task_posted_ = true;
+    V8::GetCurrentPlatform()
+        ->GetForegroundTaskRunner(reinterpret_cast<v8::Isolate*>(isolate()))
+        ->PostTask(MakeCancelableTask(isolate(), [this] {
+          DCHECK(persistent_store_task_posted_);
+          persistent_store_task_posted_ = false;
+          StorePersistentScripts();
+        }));
+  }
+}
+
+void CompilationCache::StorePersistentScripts() {
+  HandleScope scope(isolate());
+  std::vector<Handle<SharedFunctionInfo>> functions;
+  functions.reserve(persistent_scripts_.size());
+  for (Tagged<Object> function : persistent_scripts_) {
+    functions.push_back(handle(Cast<SharedFunctionInfo>(function), isolate()));
+  }
+  std::vector<v8::PersistentCompilationCache::Key> keys;
+  keys.swap(persistent_script_keys_);
+  persistent_scripts_.clear();
+
+  for (size_t i = 0; i < functions.size(); ++i) {
+    // Looked up each time: the embedder may remove the cache from Store().
+    v8::PersistentCompilationCache* cache =
+        isolate()->persistent_compilation_cache();
+    if (cache == nullptr) return;
+    std::unique_ptr<ScriptCompiler::CachedData> data(
+        CodeSerializer::Serialize(isolate(), functions[i]));
+    if (!data) continue;
+    cache->Store(reinterpret_cast<v8::Isolate*>(isolate()), keys[i],
+                 std::move(data));
+  }
+}
+
 void CompilationCache::PutEval(DirectHandle<String> source,
                                DirectHandle<SharedFunctionInfo> outer_info,
                                DirectHandle<JSFunction> js_function,
@@ -340,6 +448,12 @@ void CompilationCache::Iterate(RootVisitor* v) {
   eval_global_.Iterate(v);
   eval_contextual_.Iterate(v);
   reg_exp_.Iterate(v);
+  if (!persistent_scripts_.empty()) {
+    Tagged<Object>* scripts = persistent_scripts_.data();
+    v->VisitRootPointers(Root::kCompilationCache, nullptr,
+                         FullObjectSlot(scripts),
+                         FullObjectSlot(scripts + persistent_scripts_.size()));
+  }
 }
 
 void CompilationCache::MarkCompactPrologue() {
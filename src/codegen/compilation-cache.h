@@ -5,6 +5,9 @@
 #ifndef V8_CODEGEN_COMPILATION_CACHE_H_
 #define V8_CODEGEN_COMPILATION_CACHE_H_
 
+#include <vector>
+
+#include "include/v8-script.h"
 #include "src/base/hashmap.h"
 #include "src/objects/compilation-cache-table.h"
 #include "src/utils/allocation.h"
@@ -177,6 +180,23 @@ class V8_EXPORT_PRIVATE CompilationCache {
   void PutScript(Handle<String> source, LanguageMode language_mode,
                  DirectHandle<SharedFunctionInfo> function_info);
 
+  // Finds the root SharedFunctionInfo for a script source string in the
+  // embedder's PersistentCompilationCache, for use after LookupScript()
+  // missed. A result is also put into the script cache. Returns an empty
+  // handle if there is no persistent cache, no entry, or the entry is
+  // rejected.
+  MaybeDirectHandle<SharedFunctionInfo> LookupPersistentScript(
+      Handle<String> source, const ScriptDetails& script_details,
+      LanguageMode language_mode, MaybeDirectHandle<Script> maybe_script);
+
+  // Queues the code cache of a freshly compiled script for the embedder's
+  // PersistentCompilationCache. The data is produced by a foreground task,
+  // which by then includes the functions the script compiled while running.
+  void PutPersistentScript(Handle<String> source,
+                           const ScriptDetails& script_details,
+                           LanguageMode language_mode,
+                           DirectHandle<SharedFunctionInfo> function_info);
+
   // Associate the (source, context->closure()->shared(), kind) triple
   // with the shared function info. This may overwrite an existing mapping.
   void PutEval(DirectHandle<String> source,
@@ -229,6 +249,10 @@ class V8_EXPORT_PRIVATE CompilationCache {
 
   Isolate* isolate() const { return isolate_; }
 
+  // Hands the code caches of the scripts queued by PutPersistentScript() to
+  // the embedder.
+  void StorePersistentScripts();
+
   Isolate* isolate_;
 
   CompilationCacheScript script_;
@@ -239,6 +263,12 @@ class V8_EXPORT_PRIVATE CompilationCache {
   // Current enable state of the compilation cache for scripts and eval.
   bool enabled_script_and_eval_;
 
+  // Root SharedFunctionInfos queued for the persistent cache, and their keys.
+  // The functions are strong roots until the store task has run.
+  std::vector<Tagged<Object>> persistent_scripts_;
+  std::vector<v8::PersistentCompilationCache::Key> persistent_script_keys_;
+  bool persistent_store_task_posted_ = false;
+
   friend class Isolate;
 };
 
@@ -0,0 +1,119 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/codegen/compilation-timeline.h"
+
+#include <memory>
+
+#include "src/base/hashing.h"
+#include "src/codegen/compiler.h"
+#include "src/objects/script.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/tracing/trace-event.h"
+#include "src/tracing/traced-value.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+#define TIMELINE_CATEGORY TRACE_DISABLED_BY_DEFAULT("v8.compile")
+
+// Trace event names have to be literals, hence a macro.
+#define ADD_TIMELINE_EVENT(isolate, shared, name, data)                        \
+  TRACE_EVENT_WITH_FLOW1(TIMELINE_CATEGORY, name, FlowId(isolate, shared),     \
+                         TRACE_EVENT_FLAG_FLOW_IN | TRACE_EVENT_FLAG_FLOW_OUT, \
+                         "data", std::move(data))
+
+bool IsTimelineEnabled() {
+  bool enabled;
+  TRACE_EVENT_CATEGORY_GROUP_ENABLED(TIMELINE_CATEGORY, &enabled);
+  return enabled;
+}
+
+int ScriptId(Tagged<SharedFunctionInfo> shared) {
+  return IsScript(shared->script()) ? Cast<Script>(shared->script())->id()
+                                    : v8::UnboundScript::kNoScriptId;
+}
+
+// Identifies the function across compile jobs and code objects, so that all
+// of its events end up on one flow.
+uint64_t FlowId(Isolate* isolate, Tagged<SharedFunctionInfo> shared) {
+  return base::Hasher{}.Combine(reinterpret_cast<uintptr_t>(isolate),
+                                ScriptId(shared), shared->StartPosition());
+}
+
+std::unique_ptr<v8::tracing::TracedValue> FunctionData(
+    Tagged<SharedFunctionInfo> shared, CodeKind kind) {
+  auto value = v8::tracing::TracedValue::Create();
+  value->SetString("function", shared->DebugNameCStr().get());
+  value->SetInteger("scriptId", ScriptId(shared));
+  value->SetInteger("position", shared->StartPosition());
+  value->SetString("tier", CodeKindToString(kind));
+  return value;
+}
+
+}  // namespace
+
+// static
+void CompilationTimeline::Scheduled(Isolate* isolate,
+                                    Tagged<SharedFunctionInfo> shared,
+                                    CodeKind kind, bool is_osr) {
+  if (!IsTimelineEnabled()) return;
+  auto data = FunctionData(shared, kind);
+  data->SetBoolean("osr", is_osr);
+  ADD_TIMELINE_EVENT(isolate, shared, "V8.TierUpScheduled", data);
+}
+
+// static
+void CompilationTimeline::Compiled(Isolate* isolate,
+                                   Tagged<SharedFunctionInfo> shared,
+                                   CodeKind kind,
+                                   const OptimizedCompilationJob* job) {
+  if (!IsTimelineEnabled()) return;
+  auto data = FunctionData(shared, kind);
+  data->SetDouble("queueWaitMs", job->queue_wait_in_ms());
+  data->SetDouble("prepareMs", job->prepare_in_ms());
+  data->SetDouble("executeMs", job->execute_in_ms());
+  data->SetDouble("finalizeMs", job->finalize_in_ms());
+  ADD_TIMELINE_EVENT(isolate, shared, "V8.TierUpCompiled", data);
+}
+
+// static
+void CompilationTimeline::Installed(Isolate* isolate,
+                                    Tagged<SharedFunctionInfo> shared,
+                                    CodeKind kind, bool is_osr) {
+  if (!IsTimelineEnabled()) return;
+  auto data = FunctionData(shared, kind);
+  data->SetBoolean("osr", is_osr);
+  ADD_TIMELINE_EVENT(isolate, shared, "V8.TierUpInstalled", data);
+}
+
+// static
+void CompilationTimeline::Aborted(Isolate* isolate,
+                                  Tagged<SharedFunctionInfo> shared,
+                                  CodeKind kind, BailoutReason reason) {
+  if (!IsTimelineEnabled()) return;
+  auto data = FunctionData(shared, kind);
+  data->SetString("reason", GetBailoutReason(reason));
+  ADD_TIMELINE_EVENT(isolate, shared, "V8.TierUpAborted", data);
+}
+
+// static
+void CompilationTimeline::Deoptimized(Isolate* isolate,
+                                      Tagged<SharedFunctionInfo> shared,
+                                      CodeKind kind, DeoptimizeKind deopt_kind,
+                                      DeoptimizeReason reason) {
+  if (!IsTimelineEnabled()) return;
+  auto data = FunctionData(shared, kind);
+  data->SetString("kind", ToString(deopt_kind));
+  data->SetString("reason", DeoptimizeReasonToString(reason));
+  ADD_TIMELINE_EVENT(isolate, shared, "V8.Deoptimize", data);
+}
+
+#undef ADD_TIMELINE_EVENT
+#undef TIMELINE_CATEGORY
+
+}  // namespace internal
+}  // namespace v8
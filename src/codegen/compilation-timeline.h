@@ -0,0 +1,49 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_CODEGEN_COMPILATION_TIMELINE_H_
+#define V8_CODEGEN_COMPILATION_TIMELINE_H_
+
+#include "src/codegen/bailout-reason.h"
+#include "src/common/globals.h"
+#include "src/deoptimizer/deoptimize-reason.h"
+#include "src/objects/code-kind.h"
+#include "src/objects/tagged.h"
+
+namespace v8 {
+namespace internal {
+
+class OptimizedCompilationJob;
+class SharedFunctionInfo;
+
+// Records the tier-up timeline of functions as trace events in the
+// disabled-by-default "v8.compile" category. All events of a function are
+// bound to one flow, so that a trace links "scheduled -> compiled ->
+// installed -> deoptimized" and any re-optimization that follows, which makes
+// tier-up latency and deopt loops visible per function.
+//
+// All methods must be called on the main thread.
+class CompilationTimeline : public AllStatic {
+ public:
+  // A concurrent job for |shared| has been queued.
+  static void Scheduled(Isolate* isolate, Tagged<SharedFunctionInfo> shared,
+                        CodeKind kind, bool is_osr);
+  // |job| has been finalized successfully; records its queue wait and phase
+  // times.
+  static void Compiled(Isolate* isolate, Tagged<SharedFunctionInfo> shared,
+                       CodeKind kind, const OptimizedCompilationJob* job);
+  // The code has been installed on the function or in the OSR cache.
+  static void Installed(Isolate* isolate, Tagged<SharedFunctionInfo> shared,
+                        CodeKind kind, bool is_osr);
+  static void Aborted(Isolate* isolate, Tagged<SharedFunctionInfo> shared,
+                      CodeKind kind, BailoutReason reason);
+  static void Deoptimized(Isolate* isolate, Tagged<SharedFunctionInfo> shared,
+                          CodeKind kind, DeoptimizeKind deopt_kind,
+                          DeoptimizeReason reason);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_CODEGEN_COMPILATION_TIMELINE_H_
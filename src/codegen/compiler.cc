@@ -5,9 +5,11 @@
 #include "src/codegen/compiler.h"
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <optional>
 
+#include "include/v8-platform.h"
 #include "src/api/api-inl.h"
 #include "src/asmjs/asm-js.h"
 #include "src/ast/prettyprinter.h"
@@ -15,8 +17,10 @@
 #include "src/base/fpu.h"
 #include "src/base/logging.h"
 #include "src/base/platform/time.h"
+#include "src/baseline/baseline-batch-compiler.h"
 #include "src/baseline/baseline.h"
 #include "src/codegen/assembler-inl.h"
+#include "src/codegen/compilation-timeline.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/optimized-compilation-info.h"
 #include "src/codegen/pending-optimization-table.h"
@@ -47,6 +51,8 @@
 #include "src/heap/parked-scope-inl.h"
 #include "src/heap/visit-object.h"
 #include "src/init/bootstrapper.h"
+#include "src/init/v8.h"
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/interpreter.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/log-inl.h"
@@ -449,6 +455,7 @@ CompilationJob::Status OptimizedCompilationJob::ExecuteJob(
                  local_isolate->heap()->IsParked());
   // Delegate to the underlying implementation.
   DCHECK_EQ(state(), State::kReadyToExecute);
+  time_waited_to_execute_ = timer_.Elapsed() - time_taken_to_prepare_;
   base::ScopedTimer t(&time_taken_to_execute_);
   return UpdateState(ExecuteJobImpl(stats, local_isolate),
                      State::kReadyToFinalize);
@@ -1064,12 +1071,18 @@ bool CompileTurbofan_NotConcurrent(Isolate* isolate,
   // Success!
   job->RecordCompilationStats(ConcurrencyMode::kSynchronous, isolate);
   DCHECK(!isolate->has_exception());
+  CompilationTimeline::Compiled(isolate, *compilation_info->shared_info(),
+                                CodeKind::TURBOFAN_JS, job);
   if (job->compilation_info()->is_osr()) {
     OptimizedOSRCodeCache::Insert(
         isolate, *compilation_info->closure(), compilation_info->osr_offset(),
         *compilation_info->code(),
         compilation_info->function_context_specializing());
   }
+  // The caller installs the code on the function right away.
+  CompilationTimeline::Installed(isolate, *compilation_info->shared_info(),
+                                 CodeKind::TURBOFAN_JS,
+                                 compilation_info->is_osr());
   job->RecordFunctionCompilation(LogEventListener::CodeTag::kFunction, isolate);
   return true;
 }
@@ -1114,7 +1127,10 @@ bool CompileTurbofan_Concurrent(Isolate* isolate,
                                    compilation_info->osr_offset());
   }
 
-  // The background recompile will own this job.
+  // The background recompile will own this job, so grab what the timeline
+  // needs beforehand.
+  DirectHandle<SharedFunctionInfo> shared = compilation_info->shared_info();
+  const bool is_osr = compilation_info->is_osr();
   if (!isolate->optimizing_compile_dispatcher()->TryQueueForOptimization(job)) {
     function->SetTieringInProgress(isolate, false,
                                    compilation_info->osr_offset());
@@ -1132,6 +1148,8 @@ bool CompileTurbofan_Concurrent(Isolate* isolate,
     ShortPrint(*function);
     PrintF(" for concurrent optimization.\n");
   }
+  CompilationTimeline::Scheduled(isolate, *shared, CodeKind::TURBOFAN_JS,
+                                 is_osr);
 
   DCHECK(compilation_info->shared_info()->HasBytecodeArray());
   return true;
@@ -1275,11 +1293,16 @@ MaybeHandle<Code> CompileMaglev(Isolate* isolate, Handle<JSFunction> function,
 
   DCHECK(IsConcurrent(mode));
 
+  // Remember that the function is currently being processed. This happens
+  // before enqueueing, since the dispatcher may drop the job right away and
+  // reset it.
+  function->SetTieringInProgress(isolate, true, osr_offset);
+
+  CompilationTimeline::Scheduled(isolate, function->shared(), CodeKind::MAGLEV,
+                                 job->is_osr());
   // Enqueue it.
   isolate->maglev_concurrent_dispatcher()->EnqueueJob(std::move(job));
 
-  // Remember that the function is currently being processed.
-  function->SetTieringInProgress(isolate, true, osr_offset);
   function->SetInterruptBudget(isolate, BudgetModification::kRaise,
                                CodeKind::MAGLEV);
 
@@ -1505,6 +1528,50 @@ void CompileAllWithBaseline(Isolate* isolate,
   }
 }
 
+#ifdef V8_ENABLE_SPARKPLUG
+bool HasLoop(Handle<BytecodeArray> bytecode) {
+  for (interpreter::BytecodeArrayIterator it(bytecode); !it.done();
+       it.Advance()) {
+    if (it.current_bytecode() == interpreter::Bytecode::kJumpLoop) return true;
+  }
+  return false;
+}
+
+// Kicks off concurrent baseline compilation of the freshly compiled functions
+// that contain loops, so that their baseline code is likely ready by the time
+// the budget interrupt would have asked for it.
+void EagerlyCompileLikelyHotFunctionsWithBaseline(
+    Isolate* isolate, const FinalizeUnoptimizedCompilationDataList&
+                          finalize_unoptimized_compilation_data_list) {
+  // Compilation has to stay off the main thread, which only the batch compiler
+  // in concurrent mode guarantees.
+  if (!v8_flags.concurrent_sparkplug || !v8_flags.baseline_batch_compilation) {
+    return;
+  }
+  baseline::BaselineBatchCompiler* batch_compiler =
+      isolate->baseline_batch_compiler();
+  bool enqueued = false;
+  for (const auto& finalize_data : finalize_unoptimized_compilation_data_list) {
+    Handle<SharedFunctionInfo> shared_info = finalize_data.function_handle();
+    IsCompiledScope is_compiled_scope(*shared_info, isolate);
+    if (!is_compiled_scope.is_compiled()) continue;
+    if (!CanCompileWithBaseline(isolate, *shared_info)) continue;
+    Handle<BytecodeArray> bytecode(shared_info->GetBytecodeArray(isolate),
+                                   isolate);
+    if (bytecode->length() > v8_flags.eager_sparkplug_max_bytecode_size) {
+      continue;
+    }
+    if (!HasLoop(bytecode)) continue;
+    batch_compiler->EnqueueSFI(*shared_info);
+    enqueued = true;
+  }
+  if (enqueued) batch_compiler->FlushBatch();
+}
+#else
+void EagerlyCompileLikelyHotFunctionsWithBaseline(
+    Isolate*, const FinalizeUnoptimizedCompilationDataList&) {}
+#endif  // V8_ENABLE_SPARKPLUG
+
 // Create shared function info for top level and shared function infos array for
 // inner functions.
 template <typename IsolateT>
@@ -1589,6 +1656,9 @@ MaybeHandle<SharedFunctionInfo> CompileToplevel(
 
   if (v8_flags.always_sparkplug) {
     CompileAllWithBaseline(isolate, finalize_unoptimized_compilation_data_list);
+  } else if (v8_flags.eager_sparkplug) {
+    EagerlyCompileLikelyHotFunctionsWithBaseline(
+        isolate, finalize_unoptimized_compilation_data_list);
   }
 
   return shared_info;
@@ -1655,6 +1725,12 @@ BackgroundCompileTask::BackgroundCompileTask(
   if (options & ScriptCompiler::CompileOptions::kProduceCompileHints) {
     flags_.set_produce_compile_hints(true);
   }
+  if (v8_flags.parallel_compile_tasks_for_streaming) {
+    // Hand lazy function bodies to the LazyCompileDispatcher as soon as the
+    // top-level parse has preparsed them, so that they are compiled on other
+    // workers while the script is still streaming in.
+    flags_.set_post_parallel_compile_tasks_for_lazy(true);
+  }
   DCHECK(is_streaming_compilation());
   if (options & ScriptCompiler::kConsumeCompileHints) {
     DCHECK_NOT_NULL(compile_hint_callback);
@@ -2822,6 +2898,64 @@ void BackgroundDeserializeTask::MergeWithExistingScript() {
       &isolate, off_thread_data_.GetOnlyScript(isolate.heap()));
 }
 
+namespace {
+
+void RunAndMergeDeserializeTask(BackgroundDeserializeTask* task) {
+  task->Run();
+  if (v8_flags.merge_background_deserialized_script_with_compilation_cache &&
+      task->ShouldMergeWithExistingScript()) {
+    task->MergeWithExistingScript();
+  }
+}
+
+class BatchDeserializeJob final : public JobTask {
+ public:
+  explicit BatchDeserializeJob(
+      base::Vector<BackgroundDeserializeTask* const> tasks)
+      : tasks_(tasks) {}
+
+  void Run(JobDelegate* delegate) override {
+    for (size_t i = next_.fetch_add(1, std::memory_order_relaxed);
+         i < tasks_.size();
+         i = next_.fetch_add(1, std::memory_order_relaxed)) {
+      RunAndMergeDeserializeTask(tasks_[i]);
+      remaining_.fetch_sub(1, std::memory_order_relaxed);
+      if (delegate->ShouldYield()) return;
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    return remaining_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  base::Vector<BackgroundDeserializeTask* const> tasks_;
+  std::atomic<size_t> next_{0};
+  std::atomic<size_t> remaining_{tasks_.size()};
+};
+
+}  // namespace
+
+// static
+void BackgroundDeserializeTask::RunBatch(
+    Isolate* isolate, base::Vector<BackgroundDeserializeTask* const> tasks) {
+  if (tasks.empty()) return;
+  // Background deserialization may need a safepoint, so the main thread must
+  // not stay unparked while it waits for (or joins) the worker threads.
+  isolate->main_thread_local_isolate()->ExecuteMainThreadWhileParked([&]() {
+    if (v8_flags.single_threaded || tasks.size() == 1) {
+      for (BackgroundDeserializeTask* task : tasks) {
+        RunAndMergeDeserializeTask(task);
+      }
+      return;
+    }
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking,
+                    std::make_unique<BatchDeserializeJob>(tasks))
+        ->Join();
+  });
+}
+
 MaybeDirectHandle<SharedFunctionInfo> BackgroundDeserializeTask::Finish(
     Isolate* isolate, DirectHandle<String> source,
     const ScriptDetails& script_details) {
@@ -3013,9 +3147,18 @@ bool Compiler::Compile(Isolate* isolate, Handle<SharedFunctionInfo> shared_info,
 
   if (v8_flags.always_sparkplug) {
     CompileAllWithBaseline(isolate, finalize_unoptimized_compilation_data_list);
-  }
-
-  if (script->produce_compile_hints()) {
+  } else if (v8_flags.eager_sparkplug) {
+    EagerlyCompileLikelyHotFunctionsWithBaseline(
+        isolate, finalize_unoptimized_compilation_data_list);
+  }
+
+  // Functions that are only compiled long after startup are not worth
+  // compiling eagerly the next time the script is loaded.
+  const bool within_compile_hints_time_limit =
+      v8_flags.produce_compile_hints_time_limit == 0 ||
+      isolate->time_millis_since_init() <
+          v8_flags.produce_compile_hints_time_limit;
+  if (script->produce_compile_hints() && within_compile_hints_time_limit) {
     // Log lazy function compilation.
     DirectHandle<ArrayList> list;
     if (IsUndefined(script->compiled_lazy_function_positions())) {
@@ -4001,6 +4144,16 @@ MaybeDirectHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
         // Deserializer failed. Fall through to compile.
         compile_timer.set_consuming_code_cache_failed();
       }
+    } else {
+      // Then check the embedder's persistent cache.
+      DirectHandle<SharedFunctionInfo> result;
+      if (compilation_cache
+              ->LookupPersistentScript(source, script_details, language_mode,
+                                       maybe_script)
+              .ToHandle(&result)) {
+        maybe_result = result;
+        is_compiled_scope = result->is_compiled_scope(isolate);
+      }
     }
   }
 
@@ -4044,6 +4197,8 @@ MaybeDirectHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     if (use_compilation_cache && maybe_result.ToHandle(&result)) {
       DCHECK(is_compiled_scope.is_compiled());
       compilation_cache->PutScript(source, language_mode, result);
+      compilation_cache->PutPersistentScript(source, script_details,
+                                             language_mode, result);
     } else if (maybe_result.is_null() && natives != EXTENSION_CODE) {
       isolate->ReportPendingMessages();
     }
@@ -4059,6 +4214,19 @@ MaybeDirectHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
 
 }  // namespace
 
+// static
+MaybeDirectHandle<SharedFunctionInfo> Compiler::CompileToplevelUncached(
+    Isolate* isolate, Handle<String> source,
+    const ScriptDetails& script_details) {
+  UnoptimizedCompileFlags flags = UnoptimizedCompileFlags::ForToplevelCompile(
+      isolate, true, construct_language_mode(v8_flags.use_strict),
+      script_details.repl_mode, ScriptType::kClassic, true);
+  IsCompiledScope is_compiled_scope;
+  return CompileScriptOnMainThread(flags, source, script_details,
+                                   NOT_NATIVES_CODE, nullptr, isolate,
+                                   MaybeHandle<Script>(), &is_compiled_scope);
+}
+
 MaybeDirectHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
     Isolate* isolate, Handle<String> source,
     const ScriptDetails& script_details,
@@ -4447,6 +4615,8 @@ void Compiler::FinalizeTurbofanCompilationJob(TurbofanCompilationJob* job,
       job->RecordFunctionCompilation(LogEventListener::CodeTag::kFunction,
                                      isolate);
       if (V8_LIKELY(use_result)) {
+        CompilationTimeline::Compiled(isolate, *shared, CodeKind::TURBOFAN_JS,
+                                      job);
         function->SetTieringInProgress(isolate, false,
                                        job->compilation_info()->osr_offset());
         if (IsOSR(osr_offset)) {
@@ -4462,6 +4632,8 @@ void Compiler::FinalizeTurbofanCompilationJob(TurbofanCompilationJob* job,
         } else {
           function->UpdateOptimizedCode(isolate, *compilation_info->code());
         }
+        CompilationTimeline::Installed(isolate, *shared, CodeKind::TURBOFAN_JS,
+                                       IsOSR(osr_offset));
       }
       return;
     }
@@ -4471,6 +4643,8 @@ void Compiler::FinalizeTurbofanCompilationJob(TurbofanCompilationJob* job,
   CompilerTracer::TraceAbortedJob(isolate, compilation_info,
                                   job->prepare_in_ms(), job->execute_in_ms(),
                                   job->finalize_in_ms());
+  CompilationTimeline::Aborted(isolate, *shared, CodeKind::TURBOFAN_JS,
+                               compilation_info->bailout_reason());
   if (V8_LIKELY(use_result)) {
     function->SetTieringInProgress(isolate, false,
                                    job->compilation_info()->osr_offset());
@@ -4520,6 +4694,7 @@ void Compiler::FinalizeMaglevCompilationJob(maglev::MaglevCompilationJob* job,
   if (status == CompilationJob::SUCCEEDED) {
     DirectHandle<SharedFunctionInfo> shared(function->shared(), isolate);
     DCHECK(!shared->HasBreakInfo(isolate));
+    CompilationTimeline::Compiled(isolate, *shared, CodeKind::MAGLEV, job);
 
     // Note the finalized InstructionStream object has already been installed on
     // the function by MaglevCompilationJob::FinalizeJobImpl.
@@ -4535,6 +4710,9 @@ void Compiler::FinalizeMaglevCompilationJob(maglev::MaglevCompilationJob* job,
                                     job->specialize_to_function_context());
     }
 
+    CompilationTimeline::Installed(isolate, *shared, CodeKind::MAGLEV,
+                                   job->is_osr());
+
     RecordMaglevFunctionCompilation(isolate, function,
                                     Cast<AbstractCode>(code));
     job->RecordCompilationStats(isolate);
@@ -4549,6 +4727,8 @@ void Compiler::FinalizeMaglevCompilationJob(maglev::MaglevCompilationJob* job,
   } else {
     CompilerTracer::TraceAbortedMaglevCompile(isolate, function,
                                               job->bailout_reason_);
+    CompilationTimeline::Aborted(isolate, function->shared(), CodeKind::MAGLEV,
+                                 job->bailout_reason_);
   }
   function->SetTieringInProgress(isolate, false, osr_offset);
 #endif
@@ -200,6 +200,13 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
                                  ParseRestriction restriction,
                                  int parameters_end_pos);
 
+  // Compiles the top-level code of a classic script with lazy inner functions,
+  // bypassing the compilation cache, so that the result holds the preparse
+  // data of all inner functions rather than their bytecode.
+  static MaybeDirectHandle<SharedFunctionInfo> CompileToplevelUncached(
+      Isolate* isolate, Handle<String> source,
+      const ScriptDetails& script_details);
+
   // Create a shared function info object for a String source.
   static MaybeDirectHandle<SharedFunctionInfo> GetSharedFunctionInfoForScript(
       Isolate* isolate, Handle<String> source,
@@ -431,6 +438,11 @@ class OptimizedCompilationJob : public CompilationJob {
   double finalize_in_ms() const {
     return time_taken_to_finalize_.InMillisecondsF();
   }
+  // Time between the end of PrepareJob and the start of ExecuteJob, i.e. the
+  // time a concurrent job spent waiting in the dispatcher's queue.
+  double queue_wait_in_ms() const {
+    return time_waited_to_execute_.InMillisecondsF();
+  }
 
   V8_WARN_UNUSED_RESULT base::TimeDelta ElapsedTime() const {
     return timer_.Elapsed();
@@ -452,6 +464,7 @@ class OptimizedCompilationJob : public CompilationJob {
                                           GlobalHandleVector<Map> maps);
 
   base::TimeDelta time_taken_to_prepare_;
+  base::TimeDelta time_waited_to_execute_;
   base::TimeDelta time_taken_to_execute_;
   base::TimeDelta time_taken_to_finalize_;
 
@@ -708,6 +721,12 @@ class V8_EXPORT_PRIVATE BackgroundDeserializeTask {
   // once.
   void MergeWithExistingScript();
 
+  // Runs all {tasks}, including their pending merges, on worker threads and
+  // returns once they are done. The main thread is parked in the meantime, so
+  // this must be called on the thread where {isolate} is entered.
+  static void RunBatch(Isolate* isolate,
+                       base::Vector<BackgroundDeserializeTask* const> tasks);
+
   MaybeDirectHandle<SharedFunctionInfo> Finish(
       Isolate* isolate, DirectHandle<String> source,
       const ScriptDetails& script_details);
@@ -321,6 +321,8 @@ void ExternalReferenceTable::AddStubCache(Isolate* isolate, int* index) {
     Add(stub_cache->key_reference(StubCache::kSecondary).address(), index);
     Add(stub_cache->value_reference(StubCache::kSecondary).address(), index);
     Add(stub_cache->map_reference(StubCache::kSecondary).address(), index);
+    Add(stub_cache->mask_reference(StubCache::kPrimary).address(), index);
+    Add(stub_cache->mask_reference(StubCache::kSecondary).address(), index);
   }
 
   CHECK_EQ(kSizeIsolateIndependent + kExternalReferenceCountIsolateDependent +
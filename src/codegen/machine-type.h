@@ -350,6 +350,7 @@ class MachineType {
         return MachineType::Pointer();
       case CTypeInfo::Type::kV8Value:
       case CTypeInfo::Type::kSeqOneByteString:
+      case CTypeInfo::Type::kSeqTwoByteString:
       case CTypeInfo::Type::kApiObject:
         return MachineType::AnyTagged();
     }
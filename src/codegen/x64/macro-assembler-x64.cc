@@ -948,12 +948,23 @@ void MacroAssembler::LoadCodePointerTableBase(Register destination) {
 }
 #endif  // V8_ENABLE_SANDBOX
 
+void MacroAssembler::LoadJSDispatchTableBase(Register destination) {
+  if (builtin() == Builtin::kNoBuiltinId &&
+      !options().isolate_independent_code) {
+    // Saves a dependent load on every call through the table. The table is
+    // never moved, so this is as safe as the constant handle case below.
+    Move(destination, ExternalReference::js_dispatch_table_address());
+  } else {
+    CHECK(root_array_available());
+    movq(destination,
+         ExternalReferenceAsOperand(IsolateFieldId::kJSDispatchTable));
+  }
+}
+
 void MacroAssembler::LoadEntrypointFromJSDispatchTable(
     Register destination, Register dispatch_handle) {
   DCHECK(!AreAliased(destination, dispatch_handle, kScratchRegister));
-  CHECK(root_array_available());
-  movq(kScratchRegister,
-       ExternalReferenceAsOperand(IsolateFieldId::kJSDispatchTable));
+  LoadJSDispatchTableBase(kScratchRegister);
   movq(destination, dispatch_handle);
   shrl(destination, Immediate(kJSDispatchHandleShift));
   shll(destination, Immediate(kJSDispatchTableEntrySizeLog2));
@@ -984,9 +995,7 @@ void MacroAssembler::LoadEntrypointFromJSDispatchTable(
 void MacroAssembler::LoadParameterCountFromJSDispatchTable(
     Register destination, Register dispatch_handle) {
   DCHECK(!AreAliased(destination, dispatch_handle, kScratchRegister));
-  CHECK(root_array_available());
-  movq(kScratchRegister,
-       ExternalReferenceAsOperand(IsolateFieldId::kJSDispatchTable));
+  LoadJSDispatchTableBase(kScratchRegister);
   movq(destination, dispatch_handle);
   shrl(destination, Immediate(kJSDispatchHandleShift));
   shll(destination, Immediate(kJSDispatchTableEntrySizeLog2));
@@ -999,9 +1008,7 @@ void MacroAssembler::LoadEntrypointAndParameterCountFromJSDispatchTable(
     Register entrypoint, Register parameter_count, Register dispatch_handle) {
   DCHECK(!AreAliased(entrypoint, parameter_count, dispatch_handle,
                      kScratchRegister));
-  CHECK(root_array_available());
-  movq(kScratchRegister,
-       ExternalReferenceAsOperand(IsolateFieldId::kJSDispatchTable));
+  LoadJSDispatchTableBase(kScratchRegister);
   Register offset = parameter_count;
   movq(offset, dispatch_handle);
   shrl(offset, Immediate(kJSDispatchHandleShift));
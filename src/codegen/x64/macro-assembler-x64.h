@@ -915,6 +915,9 @@ class V8_EXPORT_PRIVATE MacroAssembler
   void LoadCodePointerTableBase(Register destination);
 #endif  // V8_ENABLE_SANDBOX
 
+  // Load the base address of the JSDispatchTable. Code that is specific to an
+  // isolate embeds the address, everything else loads it from the isolate.
+  void LoadJSDispatchTableBase(Register destination);
   void LoadEntrypointFromJSDispatchTable(Register destination,
                                          Register dispatch_handle);
   void LoadEntrypointFromJSDispatchTable(Register destination,
@@ -171,8 +171,19 @@ std::optional<BailoutReason> InstructionSelector::SelectInstructions() {
   return std::nullopt;
 }
 
+bool InstructionSelector::ShouldScheduleBlock(RpoNumber rpo) const {
+  if (!v8_flags.turbo_instruction_scheduling_hot_loops) return true;
+  // Blocks that the basic block profile or the graph builder marked as
+  // unlikely are deferred, so what remains of a loop is its hot part.
+  const InstructionBlock* block = sequence()->InstructionBlockAt(rpo);
+  return !block->IsDeferred() &&
+         (block->IsLoopHeader() || block->loop_header().IsValid());
+}
+
 void InstructionSelector::StartBlock(RpoNumber rpo) {
-  if (UseInstructionScheduling()) {
+  schedule_current_block_ =
+      UseInstructionScheduling() && ShouldScheduleBlock(rpo);
+  if (schedule_current_block_) {
     DCHECK_NOT_NULL(scheduler_);
     scheduler_->StartBlock(rpo);
   } else {
@@ -181,7 +192,7 @@ void InstructionSelector::StartBlock(RpoNumber rpo) {
 }
 
 void InstructionSelector::EndBlock(RpoNumber rpo, Instruction* terminator) {
-  if (UseInstructionScheduling()) {
+  if (schedule_current_block_) {
     DCHECK_NOT_NULL(scheduler_);
     scheduler_->EndBlock(rpo, terminator);
   } else {
@@ -190,7 +201,7 @@ void InstructionSelector::EndBlock(RpoNumber rpo, Instruction* terminator) {
 }
 
 void InstructionSelector::AddInstruction(Instruction* instr) {
-  if (UseInstructionScheduling()) {
+  if (schedule_current_block_) {
     DCHECK_NOT_NULL(scheduler_);
     scheduler_->AddInstruction(instr);
   } else {
@@ -1021,6 +1021,9 @@ class V8_EXPORT_PRIVATE InstructionSelector final
   bool UseInstructionScheduling() const {
     return enable_scheduling_ && InstructionScheduler::SchedulerSupported();
   }
+  // Whether the instructions of the given block are scheduled, provided that
+  // scheduling is enabled at all.
+  bool ShouldScheduleBlock(RpoNumber rpo) const;
 
   void AppendDeoptimizeArguments(InstructionOperandVector* args,
                                  DeoptimizeReason reason, uint32_t node_id,
@@ -1608,6 +1611,7 @@ class V8_EXPORT_PRIVATE InstructionSelector final
   IntVector virtual_register_rename_;
   InstructionScheduler* scheduler_;
   EnableScheduling enable_scheduling_;
+  bool schedule_current_block_ = false;
   EnableRootsRelativeAddressing enable_roots_relative_addressing_;
   EnableSwitchJumpTable enable_switch_jump_table_;
   ZoneUnorderedMap<FrameStateInput, CachedStateValues*,
@@ -3782,6 +3782,8 @@ void LinearScanAllocator::AllocateRegisters() {
           } else if (!ConsiderBlockForControlFlow(
                          current_block, current_block->predecessors()[1])) {
             chosen_predecessor = current_block->predecessors()[0];
+          } else if (data()->is_over_budget()) {
+            chosen_predecessor = current_block->predecessors()[0];
           } else {
             chosen_predecessor = ChooseOneOfTwoPredecessorStates(
                 current_block, next_block_boundary);
@@ -3790,7 +3792,22 @@ void LinearScanAllocator::AllocateRegisters() {
 
         } else {
           // Merge at the end of, e.g., a switch.
-          ComputeStateFromManyPredecessors(current_block, to_be_live);
+          RpoNumber chosen_predecessor = RpoNumber::Invalid();
+          if (data()->is_over_budget()) {
+            // Skip the vote and use the state of any predecessor.
+            for (RpoNumber pred : current_block->predecessors()) {
+              if (ConsiderBlockForControlFlow(current_block, pred)) {
+                chosen_predecessor = pred;
+                break;
+              }
+            }
+          }
+          if (chosen_predecessor.IsValid()) {
+            no_change_required =
+                pick_state_from(chosen_predecessor, to_be_live);
+          } else {
+            ComputeStateFromManyPredecessors(current_block, to_be_live);
+          }
         }
 
         if (!no_change_required) {
@@ -3818,8 +3835,12 @@ void LinearScanAllocator::AllocateRegisters() {
     // Now we can erase current, as we are sure to process it.
     unhandled_live_ranges().erase(unhandled_live_ranges().begin());
 
-    if (current->IsTopLevel() && TryReuseSpillForPhi(current->TopLevel()))
+    // Sharing spill slots with phi inputs relies on the live range bundles,
+    // which are not built when over budget.
+    if (current->IsTopLevel() && !data()->is_over_budget() &&
+        TryReuseSpillForPhi(current->TopLevel())) {
       continue;
+    }
 
     ForwardStateTo(position);
 
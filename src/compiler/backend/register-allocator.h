@@ -336,6 +336,11 @@ class RegisterAllocationData final : public ZoneObject {
 
   TickCounter* tick_counter() { return tick_counter_; }
 
+  // In functions with too many live ranges, heuristics that only improve the
+  // quality of the allocation are skipped to bound the compile time.
+  bool is_over_budget() const { return is_over_budget_; }
+  void set_is_over_budget() { is_over_budget_ = true; }
+
   ZoneMap<TopLevelLiveRange*, AllocatedOperand*>& slot_for_const_range() {
     return slot_for_const_range_;
   }
@@ -366,6 +371,7 @@ class RegisterAllocationData final : public ZoneObject {
   ZoneVector<ZoneVector<LiveRange*>> spill_state_;
   TickCounter* const tick_counter_;
   ZoneMap<TopLevelLiveRange*, AllocatedOperand*> slot_for_const_range_;
+  bool is_over_budget_ = false;
 };
 
 // Representation of the non-empty interval [start,end[.
@@ -2,12 +2,110 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cstring>
+
+#include "src/base/cpu.h"
 #include "src/compiler/backend/instruction-scheduler.h"
 
 namespace v8 {
 namespace internal {
 namespace compiler {
 
+namespace {
+
+// Latencies, in cycles, of the instructions whose cost differs the most
+// between microarchitectures.
+struct LatencyModel {
+  int integer_multiply;
+  int signed_divide_64;
+  int signed_divide_32;
+  int unsigned_divide_64;
+  int unsigned_divide_32;
+  // Also used for comparisons, min/max and sign manipulation.
+  int float_add;
+  int float32_multiply;
+  int float64_multiply;
+  // Also used for square roots.
+  int float_divide;
+  // Float conversions, rounding and truncation to 32-bit integers.
+  int float_convert;
+  int float_to_int64;
+  int float64_mod;
+  int truncate_double_to_int;
+};
+
+// Basic latency modeling for x64 instructions. They have been determined
+// in an empirical way.
+constexpr LatencyModel kGenericLatencies = {
+    .integer_multiply = 3,
+    .signed_divide_64 = 49,
+    .signed_divide_32 = 35,
+    .unsigned_divide_64 = 38,
+    .unsigned_divide_32 = 26,
+    .float_add = 3,
+    .float32_multiply = 4,
+    .float64_multiply = 5,
+    .float_divide = 13,
+    .float_convert = 4,
+    .float_to_int64 = 10,
+    .float64_mod = 50,
+    .truncate_double_to_int = 6,
+};
+
+// AMD Zen 4, which has a much faster integer divider than older cores.
+constexpr LatencyModel kZen4Latencies = {
+    .integer_multiply = 3,
+    .signed_divide_64 = 18,
+    .signed_divide_32 = 14,
+    .unsigned_divide_64 = 18,
+    .unsigned_divide_32 = 14,
+    .float_add = 3,
+    .float32_multiply = 3,
+    .float64_multiply = 3,
+    .float_divide = 13,
+    .float_convert = 4,
+    .float_to_int64 = 6,
+    .float64_mod = 50,
+    .truncate_double_to_int = 6,
+};
+
+// Intel Sapphire Rapids and Emerald Rapids (Golden Cove and Raptor Cove).
+constexpr LatencyModel kSapphireRapidsLatencies = {
+    .integer_multiply = 3,
+    .signed_divide_64 = 15,
+    .signed_divide_32 = 12,
+    .unsigned_divide_64 = 15,
+    .unsigned_divide_32 = 12,
+    .float_add = 2,
+    .float32_multiply = 4,
+    .float64_multiply = 4,
+    .float_divide = 14,
+    .float_convert = 5,
+    .float_to_int64 = 7,
+    .float64_mod = 50,
+    .truncate_double_to_int = 7,
+};
+
+const LatencyModel& DetectLatencyModel() {
+  base::CPU cpu;
+  if (strcmp(cpu.vendor(), "AuthenticAMD") == 0 &&
+      cpu.family() + cpu.ext_family() == 0x19) {
+    // Family 0x19 is shared by Zen 3 and Zen 4.
+    int model = cpu.model();
+    if ((model >= 0x10 && model <= 0x1F) || (model >= 0x60 && model <= 0x7F) ||
+        (model >= 0xA0 && model <= 0xAF)) {
+      return kZen4Latencies;
+    }
+  }
+  if (strcmp(cpu.vendor(), "GenuineIntel") == 0 && cpu.family() == 6 &&
+      (cpu.model() == 0x8F || cpu.model() == 0xCF)) {
+    return kSapphireRapidsLatencies;
+  }
+  return kGenericLatencies;
+}
+
+}  // namespace
+
 bool InstructionScheduler::SchedulerSupported() { return true; }
 
 int InstructionScheduler::GetTargetInstructionFlags(
@@ -448,17 +546,17 @@ int InstructionScheduler::GetTargetInstructionFlags(
 }
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // Basic latency modeling for x64 instructions. They have been determined
-  // in an empirical way.
+  static const LatencyModel& latencies = DetectLatencyModel();
   switch (instr->arch_opcode()) {
     case kSSEFloat64Mul:
-      return 5;
+      return latencies.float64_multiply;
     case kX64Imul:
     case kX64Imul32:
     case kX64ImulHigh32:
     case kX64UmulHigh32:
     case kX64ImulHigh64:
     case kX64UmulHigh64:
+      return latencies.integer_multiply;
     case kX64Float32Abs:
     case kX64Float32Neg:
     case kX64Float64Abs:
@@ -471,8 +569,9 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64Sub:
     case kSSEFloat64Max:
     case kSSEFloat64Min:
-      return 3;
+      return latencies.float_add;
     case kSSEFloat32Mul:
+      return latencies.float32_multiply;
     case kSSEFloat32ToFloat64:
     case kSSEFloat64ToFloat32:
     case kSSEFloat32Round:
@@ -481,31 +580,31 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat32ToUint32:
     case kSSEFloat64ToInt32:
     case kSSEFloat64ToUint32:
-      return 4;
+      return latencies.float_convert;
     case kX64Idiv:
-      return 49;
+      return latencies.signed_divide_64;
     case kX64Idiv32:
-      return 35;
+      return latencies.signed_divide_32;
     case kX64Udiv:
-      return 38;
+      return latencies.unsigned_divide_64;
     case kX64Udiv32:
-      return 26;
+      return latencies.unsigned_divide_32;
     case kSSEFloat32Div:
     case kSSEFloat64Div:
     case kSSEFloat32Sqrt:
     case kSSEFloat64Sqrt:
-      return 13;
+      return latencies.float_divide;
     case kSSEFloat32ToInt64:
     case kSSEFloat64ToInt64:
     case kSSEFloat32ToUint64:
     case kSSEFloat64ToUint64:
     case kSSEFloat64ToFloat16RawBits:
     case kSSEFloat16RawBitsToFloat64:
-      return 10;
+      return latencies.float_to_int64;
     case kSSEFloat64Mod:
-      return 50;
+      return latencies.float64_mod;
     case kArchTruncateDoubleToI:
-      return 6;
+      return latencies.truncate_double_to_int;
     default:
       return 1;
   }
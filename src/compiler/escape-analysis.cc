@@ -53,7 +53,7 @@ class SparseSidetable {
     if (iter != map_.end()) {
       iter->second = std::move(value);
     } else if (value != def_value_) {
-      map_.insert(iter, std::make_pair(node->id(), std::move(value)));
+      map_.emplace(node->id(), std::move(value));
     }
   }
   const T& Get(const Node* node) const {
@@ -63,7 +63,7 @@ class SparseSidetable {
 
  private:
   T def_value_;
-  ZoneUnorderedMap<NodeId, T> map_;
+  ZoneAbslFlatHashMap<NodeId, T> map_;
 };
 
 // Keeps track of the changes to the current node during reduction.
@@ -316,7 +316,7 @@ class EscapeAnalysisTracker : public ZoneObject {
 
   SparseSidetable<VirtualObject*> virtual_objects_;
   Sidetable<Node*> replacements_;
-  ZoneUnorderedMap<Node*, bool> framestate_might_lazy_deopt_;
+  ZoneAbslFlatHashMap<Node*, bool> framestate_might_lazy_deopt_;
   VariableTracker variable_states_;
   VirtualObject::Id next_object_id_ = 0;
   int number_of_tracked_bytes_ = 0;
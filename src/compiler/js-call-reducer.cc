@@ -5247,6 +5247,8 @@ Reduction JSCallReducer::ReduceJSCall(Node* node,
       return ReduceMapPrototypeHas(node);
     case Builtin::kSetPrototypeHas:
       return ReduceSetPrototypeHas(node);
+    case Builtin::kRegExpPrototypeExec:
+      return ReduceRegExpPrototypeExec(node, shared);
     case Builtin::kRegExpPrototypeTest:
       return ReduceRegExpPrototypeTest(node);
     case Builtin::kReturnReceiver:
@@ -9050,8 +9052,17 @@ Reduction JSCallReducer::ReduceRegExpPrototypeTest(Node* node) {
   inference.RelyOnMapsPreferStability(dependencies(), jsgraph(), &effect,
                                       control, p.feedback());
 
+  LowerToRegExpTest(node, n.frame_state(), effect);
+  return Changed(node);
+}
+
+void JSCallReducer::LowerToRegExpTest(Node* node, Node* frame_state,
+                                      Effect effect) {
+  JSCallNode n(node);
+  CallParameters const& p = n.Parameters();
+  Control control = n.control();
+  Node* regexp = n.receiver();
   Node* context = n.context();
-  FrameState frame_state = n.frame_state();
   Node* search = n.Argument(0);
   Node* search_string = effect = graph()->NewNode(
       simplified()->CheckString(p.feedback()), search, effect, control);
@@ -9078,6 +9089,84 @@ Reduction JSCallReducer::ReduceRegExpPrototypeTest(Node* node) {
   node->ReplaceInput(5, control);
   node->TrimInputCount(6);
   NodeProperties::ChangeOp(node, javascript()->RegExpTest());
+}
+
+Reduction JSCallReducer::ReduceRegExpPrototypeExec(
+    Node* node, SharedFunctionInfoRef shared) {
+  JSCallNode n(node);
+  CallParameters const& p = n.Parameters();
+  if (v8_flags.force_slow_path) return NoChange();
+  if (n.ArgumentCount() < 1) return NoChange();
+
+  if (p.speculation_mode() != SpeculationMode::kAllowSpeculation) {
+    return NoChange();
+  }
+
+  // Only reduce if the result array is never looked at, i.e. the code only
+  // checks whether there is a match: `if (re.exec(s))`, `re.exec(s) !== null`
+  // and the like. Such calls can skip building the result array and
+  // substrings, just like RegExp.prototype.test.
+  ZoneVector<Node*> null_checks(graph()->zone());
+  for (Edge edge : node->use_edges()) {
+    if (!NodeProperties::IsValueEdge(edge)) continue;
+    Node* user = edge.from();
+    switch (user->opcode()) {
+      case IrOpcode::kToBoolean:
+        break;
+      case IrOpcode::kReferenceEqual: {
+        Node* other = NodeProperties::GetValueInput(user, 1 - edge.index());
+        if (!HeapObjectMatcher(other).Is(factory()->null_value())) {
+          return NoChange();
+        }
+        null_checks.push_back(user);
+        break;
+      }
+      case IrOpcode::kObjectIsUndetectable:
+        // The result is a JSArray or null.
+        null_checks.push_back(user);
+        break;
+      default:
+        return NoChange();
+    }
+  }
+
+  Effect effect = n.effect();
+  Control control = n.control();
+  Node* regexp = n.receiver();
+
+  // JSRegExpTest relies on the location of the lastIndex field. There is no
+  // need to check the exec property, because this already is the original
+  // exec method.
+  MapRef regexp_initial_map =
+      native_context().regexp_function(broker()).initial_map(broker());
+  MapInference inference(broker(), regexp, effect);
+  if (!inference.Is(regexp_initial_map)) return inference.NoChange();
+  inference.RelyOnMapsPreferStability(dependencies(), jsgraph(), &effect,
+                                      control, p.feedback());
+
+  // A lazy deopt right after the call has to hand the exec result to the
+  // interpreter. The continuation rebuilds it from the last match info,
+  // which is what exec itself does after matching.
+  Node* last_index_before = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSRegExpLastIndex()), regexp,
+      effect, control);
+  Node* continuation_parameters[] = {regexp, n.Argument(0),
+                                     last_index_before};
+  Node* frame_state = CreateJavaScriptBuiltinContinuationFrameState(
+      jsgraph(), shared, Builtin::kRegExpExecFromTestLazyDeoptContinuation,
+      n.target(), n.context(), continuation_parameters,
+      arraysize(continuation_parameters), n.frame_state(),
+      ContinuationFrameStateMode::LAZY);
+
+  LowerToRegExpTest(node, frame_state, effect);
+
+  // The users see a boolean now instead of an array or null.
+  for (Node* user : null_checks) {
+    user->ReplaceInput(0, node);
+    user->TrimInputCount(1);
+    NodeProperties::ChangeOp(user, simplified()->BooleanNot());
+    Revisit(user);
+  }
   return Changed(node);
 }
 
@@ -154,7 +154,10 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
   Reduction ReduceJSCall(Node* node, SharedFunctionInfoRef shared);
   Reduction ReduceJSCallWithArrayLike(Node* node);
   Reduction ReduceJSCallWithSpread(Node* node);
+  Reduction ReduceRegExpPrototypeExec(Node* node,
+                                      SharedFunctionInfoRef shared);
   Reduction ReduceRegExpPrototypeTest(Node* node);
+  void LowerToRegExpTest(Node* node, Node* frame_state, Effect effect);
   Reduction ReduceReturnReceiver(Node* node);
 
   Reduction ReduceStringConstructor(Node* node, JSFunctionRef constructor);
@@ -465,11 +465,11 @@ class V8_EXPORT_PRIVATE JSHeapBroker {
   // The CanonicalHandlesMap is owned by the compilation info.
   CanonicalHandlesMap* canonical_handles_;
   unsigned trace_indentation_ = 0;
-  ZoneUnorderedMap<FeedbackSource, ProcessedFeedback const*,
-                   FeedbackSource::Hash, FeedbackSource::Equal>
+  ZoneAbslFlatHashMap<FeedbackSource, ProcessedFeedback const*,
+                      FeedbackSource::Hash, FeedbackSource::Equal>
       feedback_;
-  ZoneUnorderedMap<PropertyAccessTarget, PropertyAccessInfo,
-                   PropertyAccessTarget::Hash, PropertyAccessTarget::Equal>
+  ZoneAbslFlatHashMap<PropertyAccessTarget, PropertyAccessInfo,
+                      PropertyAccessTarget::Hash, PropertyAccessTarget::Equal>
       property_access_infos_;
 
   // Cache read only roots to avoid needing to look them up via the map.
@@ -35,6 +35,7 @@
 #include "src/heap/factory.h"
 #include "src/heap/heap-layout-inl.h"
 #include "src/heap/heap-write-barrier-inl.h"
+#include "src/numbers/conversions-inl.h"
 #include "src/objects/elements-kind.h"
 #include "src/objects/feedback-vector.h"
 #include "src/objects/heap-number.h"
@@ -1456,16 +1457,26 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
     for (MapRef map : inferred_maps) {
       if (map.is_deprecated()) continue;
 
-      // TODO(v8:12547): Support writing to objects in shared space, which need
-      // a write barrier that calls Object::Share to ensure the RHS is shared.
-      if (InstanceTypeChecker::IsAlwaysSharedSpaceJSObject(
+      // Writing to objects in shared space needs a barrier that calls
+      // Object::Share to ensure the RHS is shared. We only inline plain field
+      // stores into JSSharedStructs of values that are already known to be
+      // shared, and leave everything else to the StoreIC.
+      bool const is_shared_struct_store =
+          InstanceTypeChecker::IsAlwaysSharedSpaceJSObject(
               map.instance_type()) &&
-          access_mode == AccessMode::kStore) {
+          access_mode == AccessMode::kStore;
+      if (is_shared_struct_store &&
+          (map.instance_type() != JS_SHARED_STRUCT_TYPE ||
+           !IsKnownSharedValue(value, effect))) {
         return NoChange();
       }
 
       PropertyAccessInfo access_info =
           broker()->GetPropertyAccessInfo(map, feedback.name(), access_mode);
+      if (is_shared_struct_store &&
+          (!access_info.IsDataField() || access_info.HasTransitionMap())) {
+        return NoChange();
+      }
       access_infos_for_feedback.push_back(access_info);
     }
 
@@ -4384,6 +4395,32 @@ bool JSNativeContextSpecialization::InferMaps(Node* object, Effect effect,
   return false;
 }
 
+bool JSNativeContextSpecialization::IsKnownSharedValue(Node* value,
+                                                       Effect effect) const {
+  // Keep in sync with the fast paths of CodeStubAssembler::SharedValueBarrier.
+  NumberMatcher number(value);
+  if (number.HasResolvedValue()) return IsSmiDouble(number.ResolvedValue());
+
+  HeapObjectMatcher constant(value);
+  if (constant.HasResolvedValue()) {
+    Tagged<HeapObject> object = *constant.ResolvedValue();
+    return HeapLayout::InReadOnlySpace(object) ||
+           HeapLayout::InWritableSharedSpace(object);
+  }
+
+  // The instance type of an object never changes, so even unreliable maps
+  // tell us whether {value} is itself a shared JS object.
+  ZoneVector<MapRef> maps(zone());
+  if (!InferMaps(value, effect, &maps) || maps.empty()) return false;
+  for (MapRef map : maps) {
+    if (!InstanceTypeChecker::IsAlwaysSharedSpaceJSObject(
+            map.instance_type())) {
+      return false;
+    }
+  }
+  return true;
+}
+
 OptionalMapRef JSNativeContextSpecialization::InferRootMap(Node* object) const {
   HeapObjectMatcher m(object);
   if (m.HasResolvedValue()) {
@@ -247,6 +247,11 @@ class V8_EXPORT_PRIVATE JSNativeContextSpecialization final
   // location.
   OptionalMapRef InferRootMap(Node* object) const;
 
+  // Checks if {value} is statically known to be shareable across Isolates, so
+  // that storing it into an object in the shared space doesn't need to go
+  // through the shared value barrier.
+  bool IsKnownSharedValue(Node* value, Effect effect) const;
+
   // Checks if we know at compile time that the {receiver} either definitely
   // has the {prototype} in it's prototype chain, or the {receiver} definitely
   // doesn't have the {prototype} in it's prototype chain.
@@ -40,7 +40,8 @@ class EXPORT_TEMPLATE_DECLARE(V8_EXPORT_PRIVATE) NodeCache final {
   // location in this cache that stores an entry for the key. If the location
   // returned by this method contains a non-nullptr node, the caller can use
   // that node. Otherwise it is the responsibility of the caller to fill the
-  // entry with a new node.
+  // entry with a new node. The location is only valid until the next call to
+  // {Find}.
   Node** Find(Key key) { return &(map_[key]); }
 
   // Appends all nodes from this cache to {nodes}.
@@ -51,7 +52,7 @@ class EXPORT_TEMPLATE_DECLARE(V8_EXPORT_PRIVATE) NodeCache final {
   }
 
  private:
-  ZoneUnorderedMap<Key, Node*, Hash, Pred> map_;
+  ZoneAbslFlatHashMap<Key, Node*, Hash, Pred> map_;
 };
 
 // Various default cache types.
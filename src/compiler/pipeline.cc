@@ -4,6 +4,7 @@
 
 #include "src/compiler/pipeline.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -113,6 +114,7 @@
 #if V8_ENABLE_WEBASSEMBLY
 #include "src/compiler/int64-lowering.h"
 #include "src/compiler/turboshaft/int64-lowering-phase.h"
+#include "src/compiler/turboshaft/wasm-bounds-check-hoisting-phase.h"
 #include "src/compiler/turboshaft/wasm-dead-code-elimination-phase.h"
 #include "src/compiler/turboshaft/wasm-debug-memory-lowering-phase.h"
 #include "src/compiler/turboshaft/wasm-gc-optimize-phase.h"
@@ -3227,6 +3229,16 @@ wasm::WasmCompilationResult Pipeline::GenerateWasmCode(
     CHECK(turboshaft_pipeline.Run<turboshaft::LoopPeelingPhase>());
   }
 
+  if (v8_flags.wasm_bounds_check_hoisting && mcgraph->machine()->Is64() &&
+      std::any_of(module->memories.begin(), module->memories.end(),
+                  [](const wasm::WasmMemory& memory) {
+                    return memory.is_memory64();
+                  })) {
+    // Runs before loop unrolling, so that both versions of the loop can be
+    // unrolled.
+    CHECK(turboshaft_pipeline.Run<turboshaft::WasmBoundsCheckHoistingPhase>());
+  }
+
   if (v8_flags.wasm_loop_unrolling) {
     // TODO(384870251): Note that if we don't run this, subsequent analyses and
     // optimizations (DCE, decompression optimization) can run much slower.
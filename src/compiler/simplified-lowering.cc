@@ -2143,6 +2143,7 @@ class RepresentationSelector {
       case CTypeInfo::Type::kPointer:
       case CTypeInfo::Type::kV8Value:
       case CTypeInfo::Type::kSeqOneByteString:
+      case CTypeInfo::Type::kSeqTwoByteString:
       case CTypeInfo::Type::kApiObject:
         return UseInfo::AnyTagged();
     }
@@ -2226,6 +2227,7 @@ class RepresentationSelector {
         SetOutput<T>(node, MachineRepresentation::kFloat64);
         return;
       case CTypeInfo::Type::kSeqOneByteString:
+      case CTypeInfo::Type::kSeqTwoByteString:
         SetOutput<T>(node, MachineRepresentation::kTagged);
         return;
       case CTypeInfo::Type::kUint32:
@@ -1218,6 +1218,7 @@ Type Typer::Visitor::TypeFastApiCall(Node* node) {
                 CFunctionInfo::Int64Representation::kNumber);
       return Type::Number();
     case CTypeInfo::Type::kSeqOneByteString:
+    case CTypeInfo::Type::kSeqTwoByteString:
       return Type::String();
     case CTypeInfo::Type::kUint32:
       return Type::Unsigned32();
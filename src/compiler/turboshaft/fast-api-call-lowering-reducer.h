@@ -200,38 +200,28 @@ class FastApiCallLoweringReducer : public Next {
           return result;
         }
         case CTypeInfo::Type::kSeqOneByteString: {
-          // Check that the value is a HeapObject.
-          GOTO_IF(__ ObjectIsSmi(argument), handle_error);
-          V<HeapObject> argument_obj = V<HeapObject>::Cast(argument);
-
-          V<Map> map = __ LoadMapField(argument_obj);
-          V<Word32> instance_type = __ LoadInstanceTypeField(map);
-
-          V<Word32> encoding = __ Word32BitwiseAnd(
-              instance_type, kStringRepresentationAndEncodingMask);
-          GOTO_IF_NOT(__ Word32Equal(encoding, kSeqOneByteStringTag),
-                      handle_error);
-
-          V<WordPtr> length_in_bytes = __ template LoadField<WordPtr>(
-              argument_obj, AccessBuilder::ForStringLength());
-          V<WordPtr> data_ptr = __ GetElementStartPointer(
-              argument_obj, AccessBuilder::ForSeqOneByteStringCharacter());
-
-          constexpr int kAlign = alignof(FastOneByteString);
-          constexpr int kSize = sizeof(FastOneByteString);
-          static_assert(kSize == sizeof(uintptr_t) + sizeof(size_t),
+          static_assert(sizeof(FastOneByteString) ==
+                            sizeof(uintptr_t) + sizeof(size_t),
                         "The size of "
                         "FastOneByteString isn't equal to the sum of its "
                         "expected members.");
-          OpIndex stack_slot = __ StackSlot(kSize, kAlign);
-          __ StoreOffHeap(stack_slot, data_ptr,
-                          MemoryRepresentation::UintPtr());
-          __ StoreOffHeap(stack_slot, length_in_bytes,
-                          MemoryRepresentation::Uint32(), sizeof(size_t));
-          static_assert(sizeof(uintptr_t) == sizeof(size_t),
-                        "The string length can't "
-                        "fit the PointerRepresentation used to store it.");
-          return stack_slot;
+          return BuildStringViewArgument(
+              argument, kSeqOneByteStringTag,
+              AccessBuilder::ForSeqOneByteStringCharacter(),
+              sizeof(FastOneByteString), alignof(FastOneByteString),
+              handle_error);
+        }
+        case CTypeInfo::Type::kSeqTwoByteString: {
+          static_assert(sizeof(FastTwoByteString) ==
+                            sizeof(uintptr_t) + sizeof(size_t),
+                        "The size of "
+                        "FastTwoByteString isn't equal to the sum of its "
+                        "expected members.");
+          return BuildStringViewArgument(
+              argument, kSeqTwoByteStringTag,
+              AccessBuilder::ForSeqTwoByteStringCharacter(),
+              sizeof(FastTwoByteString), alignof(FastTwoByteString),
+              handle_error);
         }
         default: {
           return argument;
@@ -240,6 +230,40 @@ class FastApiCallLoweringReducer : public Next {
     }
   }
 
+  // Passes a flat sequential string of the given encoding as a
+  // {data, length} view on the stack; any other value takes the slow path.
+  // The view stays valid because nothing can allocate during the fast call.
+  OpIndex BuildStringViewArgument(OpIndex argument,
+                                  uint32_t representation_tag,
+                                  const ElementAccess& character_access,
+                                  int size, int alignment,
+                                  Label<>& handle_error) {
+    // Check that the value is a HeapObject.
+    GOTO_IF(__ ObjectIsSmi(argument), handle_error);
+    V<HeapObject> argument_obj = V<HeapObject>::Cast(argument);
+
+    V<Map> map = __ LoadMapField(argument_obj);
+    V<Word32> instance_type = __ LoadInstanceTypeField(map);
+
+    V<Word32> encoding = __ Word32BitwiseAnd(
+        instance_type, kStringRepresentationAndEncodingMask);
+    GOTO_IF_NOT(__ Word32Equal(encoding, representation_tag), handle_error);
+
+    V<WordPtr> length = __ template LoadField<WordPtr>(
+        argument_obj, AccessBuilder::ForStringLength());
+    V<WordPtr> data_ptr =
+        __ GetElementStartPointer(argument_obj, character_access);
+
+    OpIndex stack_slot = __ StackSlot(size, alignment);
+    __ StoreOffHeap(stack_slot, data_ptr, MemoryRepresentation::UintPtr());
+    __ StoreOffHeap(stack_slot, length, MemoryRepresentation::Uint32(),
+                    sizeof(size_t));
+    static_assert(sizeof(uintptr_t) == sizeof(size_t),
+                  "The string length can't "
+                  "fit the PointerRepresentation used to store it.");
+    return stack_slot;
+  }
+
   OpIndex ClampFastCallArgument(V<Float64> argument,
                                 CTypeInfo::Type scalar_type) {
     double min, max;
@@ -316,6 +340,7 @@ class FastApiCallLoweringReducer : public Next {
         return __ HeapConstant(factory_->undefined_value());
       case CTypeInfo::Type::kAny:
       case CTypeInfo::Type::kSeqOneByteString:
+      case CTypeInfo::Type::kSeqTwoByteString:
       case CTypeInfo::Type::kV8Value:
       case CTypeInfo::Type::kApiObject:
       case CTypeInfo::Type::kUint8:
@@ -358,6 +383,7 @@ class FastApiCallLoweringReducer : public Next {
         return BuildAllocateJSExternalObject(result);
       case CTypeInfo::Type::kAny:
       case CTypeInfo::Type::kSeqOneByteString:
+      case CTypeInfo::Type::kSeqTwoByteString:
       case CTypeInfo::Type::kV8Value:
       case CTypeInfo::Type::kApiObject:
       case CTypeInfo::Type::kUint8:
@@ -35,7 +35,10 @@ void LoopUnrollingAnalyzer::DetectUnrollableLoops() {
       can_unroll_at_least_one_loop_ = true;
     }
 
-    if (iter_count.IsSmallerThan(kMaxIterForStackCheckRemoval)) {
+    // Short loops reach the next interrupt check soon enough without one of
+    // their own.
+    if (iter_count.IsSmallerThan(
+            v8_flags.turboshaft_loop_stack_check_max_iterations)) {
       stack_checks_to_remove_.insert(start->index().id());
     }
   }
@@ -280,7 +280,6 @@ class V8_EXPORT_PRIVATE LoopUnrollingAnalyzer {
   static constexpr size_t kWasmMaxUnrolledLoopSize = 240;
   static constexpr size_t kMaxLoopIterationsForFullUnrolling = 4;
   static constexpr size_t kMaxPartialUnrollingCount = 4;
-  static constexpr size_t kMaxIterForStackCheckRemoval = 5000;
 
  private:
   void DetectUnrollableLoops();
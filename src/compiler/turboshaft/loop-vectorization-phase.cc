@@ -0,0 +1,27 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/loop-vectorization-phase.h"
+
+#include "src/codegen/cpu-features.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/loop-vectorization-reducer.h"
+#include "src/compiler/turboshaft/machine-optimization-reducer.h"
+#include "src/compiler/turboshaft/value-numbering-reducer.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+void LoopVectorizationPhase::Run(PipelineData* data, Zone* temp_zone) {
+  if (!CpuFeatures::SupportsWasmSimd128()) return;
+  LoopVectorizationAnalyzer analyzer(temp_zone, data->graph());
+
+  if (analyzer.ShouldReduce()) {
+    data->set_loop_vectorization_analyzer(&analyzer);
+    CopyingPhase<LoopVectorizationReducer, MachineOptimizationReducer,
+                 ValueNumberingReducer>::Run(data, temp_zone);
+    data->clear_loop_vectorization_analyzer();
+  }
+}
+
+}  // namespace v8::internal::compiler::turboshaft
@@ -0,0 +1,425 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/loop-vectorization-reducer.h"
+
+#include "src/base/bits.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/loop-finder.h"
+
+#ifdef DEBUG
+#define TRACE(x)                                      \
+  do {                                                \
+    if (v8_flags.turboshaft_trace_loop_vectorization) \
+      StdoutStream() << x << std::endl;               \
+  } while (false)
+#else
+#define TRACE(x)
+#endif
+
+namespace v8::internal::compiler::turboshaft {
+
+LoopVectorizationAnalyzer::LoopVectorizationAnalyzer(Zone* phase_zone,
+                                                     const Graph& input_graph)
+    : input_graph_(input_graph),
+      phase_zone_(phase_zone),
+      loop_finder_(phase_zone, &input_graph,
+                   {LoopFinder::ConfigFlags::kFindCalls}),
+      candidates_(phase_zone) {
+  DetectVectorizableLoops();
+}
+
+void LoopVectorizationAnalyzer::DetectVectorizableLoops() {
+  for (const auto& [header, info] : loop_finder_.LoopHeaders()) {
+    Candidate candidate(phase_zone_);
+    if (!MatchLoop(info, &candidate)) continue;
+    TRACE("LoopVectorizationAnalyzer: loop at "
+          << header->index().id() << " is vectorizable with "
+          << candidate.lane_count() << " lanes");
+    candidates_.insert({header, std::move(candidate)});
+  }
+}
+
+bool LoopVectorizationAnalyzer::IsInLoop(OpIndex index,
+                                         const Block* loop_header) const {
+  const Block* block = &input_graph_.Get(input_graph_.BlockOf(index));
+  return block == loop_header ||
+         loop_finder_.GetLoopHeader(block) == loop_header;
+}
+
+bool LoopVectorizationAnalyzer::IsInvariant(OpIndex index,
+                                            const Block* loop_header,
+                                            int depth) const {
+  if (!IsInLoop(index, loop_header)) return true;
+  if (depth > kMaxDepth) return false;
+  const Operation& op = input_graph_.Get(index);
+  switch (op.opcode) {
+    case Opcode::kConstant:
+    case Opcode::kWordBinop:
+    case Opcode::kShift:
+    case Opcode::kComparison:
+    case Opcode::kChange:
+    case Opcode::kTaggedBitcast:
+      break;
+    default:
+      return false;
+  }
+  for (OpIndex input : op.inputs()) {
+    if (!IsInvariant(input, loop_header, depth + 1)) return false;
+  }
+  return true;
+}
+
+bool LoopVectorizationAnalyzer::MatchLoop(const LoopFinder::LoopInfo& info,
+                                          Candidate* candidate) const {
+  const Block* header = info.start;
+  DCHECK(header->IsLoop());
+  // Only a header, which checks the condition, and a body.
+  if (info.has_inner_loops || info.has_any_call || info.block_count != 2 ||
+      info.op_count > kMaxLoopSize) {
+    return false;
+  }
+  candidate->header = header;
+
+  const BranchOp* branch =
+      header->LastOperation(input_graph_).TryCast<BranchOp>();
+  if (!branch) return false;
+  const Block* body = branch->if_true;
+  if (body == header || loop_finder_.GetLoopHeader(body) != header ||
+      branch->if_false == header ||
+      loop_finder_.GetLoopHeader(branch->if_false) == header) {
+    return false;
+  }
+  const GotoOp* backedge = body->LastOperation(input_graph_).TryCast<GotoOp>();
+  if (!backedge || !backedge->is_backedge ||
+      backedge->destination != header) {
+    return false;
+  }
+
+  // The condition is `i < limit`, with `i` the only phi of the loop.
+  const ComparisonOp* cmp =
+      input_graph_.Get(branch->condition()).TryCast<ComparisonOp>();
+  if (!cmp || cmp->rep != RegisterRepresentation::Word32() ||
+      (cmp->kind != ComparisonOp::Kind::kSignedLessThan &&
+       cmp->kind != ComparisonOp::Kind::kUnsignedLessThan)) {
+    return false;
+  }
+  const PhiOp* phi = nullptr;
+  for (const Operation& op : input_graph_.operations(*header)) {
+    if (const PhiOp* header_phi = op.TryCast<PhiOp>()) {
+      if (phi) return false;
+      phi = header_phi;
+    }
+  }
+  if (!phi || input_graph_.Index(*phi) != cmp->left() ||
+      phi->rep != RegisterRepresentation::Word32() ||
+      !IsInvariant(cmp->right(), header) ||
+      !MatchInductionIncrement(phi->back_edge(), cmp->left())) {
+    return false;
+  }
+  candidate->phi = cmp->left();
+  candidate->limit = cmp->right();
+
+  // Every operation of the loop that has to stay is a stream access, a check
+  // that can be hoisted into the guard of the vector loop, or control flow.
+  bool has_store = false;
+  for (const Block* block : {header, body}) {
+    for (OpIndex index : input_graph_.OperationIndices(*block)) {
+      const Operation& op = input_graph_.Get(index);
+      switch (op.opcode) {
+        case Opcode::kPhi:
+        case Opcode::kGoto:
+        case Opcode::kBranch:
+        case Opcode::kJSStackCheck:
+        case Opcode::kRetain:
+          continue;
+        case Opcode::kLoad:
+        case Opcode::kStore: {
+          Access access;
+          VectorKind kind;
+          if (!MatchAccess(index, *candidate, &access, &kind)) return false;
+          // All accesses have the element type of the first one.
+          if (candidate->accesses.empty()) {
+            candidate->kind = kind;
+            candidate->element_size_log2 = base::bits::WhichPowerOfTwo(
+                kind == VectorKind::kF64x2 ? kDoubleSize : kInt32Size);
+          } else if (kind != candidate->kind) {
+            return false;
+          }
+          if (access.is_store) {
+            const StoreOp& store = op.Cast<StoreOp>();
+            bool matched =
+                candidate->kind == VectorKind::kF32x4
+                    ? MatchFloat32Value(store.value(), *candidate)
+                    : MatchValue(store.value(), *candidate, 0);
+            if (!matched) return false;
+            has_store = true;
+          }
+          candidate->accesses.push_back(access);
+          continue;
+        }
+        case Opcode::kDeoptimizeIf: {
+          const DeoptimizeIfOp& deopt = op.Cast<DeoptimizeIfOp>();
+          BoundsCheck check;
+          if (MatchBoundsCheck(deopt, *candidate, &check)) {
+            candidate->bounds_checks.push_back(check);
+          } else if (IsInvariant(deopt.condition(), header)) {
+            candidate->invariant_checks.push_back(index);
+          } else if (!IsOverflowCheckOfIncrement(deopt, *candidate)) {
+            return false;
+          }
+          continue;
+        }
+        default:
+          // Pure operations that don't feed a store, for instance those of
+          // frame states, are not emitted in the vector loop.
+          if (op.Effects().is_required_when_unused()) return false;
+          continue;
+      }
+    }
+  }
+  return has_store;
+}
+
+bool LoopVectorizationAnalyzer::MatchInductionIncrement(OpIndex index,
+                                                        OpIndex phi) const {
+  const Operation& op = input_graph_.Get(index);
+  if (const ProjectionOp* projection = op.TryCast<ProjectionOp>()) {
+    if (projection->index != OverflowCheckedBinopOp::kValueIndex) return false;
+    const OverflowCheckedBinopOp* add =
+        input_graph_.Get(projection->input())
+            .TryCast<OverflowCheckedBinopOp>();
+    return add && add->kind == OverflowCheckedBinopOp::Kind::kSignedAdd &&
+           add->rep == WordRepresentation::Word32() && add->left() == phi &&
+           input_graph_.Get(add->right()).Is<Opmask::kWord32Constant>() &&
+           input_graph_.Get(add->right())
+                   .Cast<ConstantOp>()
+                   .signed_integral() == 1;
+  }
+  const WordBinopOp* add = op.TryCast<WordBinopOp>();
+  return add && add->kind == WordBinopOp::Kind::kAdd &&
+         add->rep == WordRepresentation::Word32() && add->left() == phi &&
+         input_graph_.Get(add->right()).Is<Opmask::kWord32Constant>() &&
+         input_graph_.Get(add->right()).Cast<ConstantOp>().signed_integral() ==
+             1;
+}
+
+bool LoopVectorizationAnalyzer::IsInductionIndex(OpIndex index,
+                                                 OpIndex phi) const {
+  if (index == phi) return kSystemPointerSize == kInt32Size;
+  const ChangeOp* change = input_graph_.Get(index).TryCast<ChangeOp>();
+  return change && change->input() == phi &&
+         (change->kind == ChangeOp::Kind::kZeroExtend ||
+          change->kind == ChangeOp::Kind::kSignExtend) &&
+         change->from == RegisterRepresentation::Word32() &&
+         change->to == RegisterRepresentation::Word64();
+}
+
+bool LoopVectorizationAnalyzer::MatchAccess(OpIndex index,
+                                            const Candidate& candidate,
+                                            Access* access,
+                                            VectorKind* kind) const {
+  const Operation& op = input_graph_.Get(index);
+  LoadOp::Kind access_kind;
+  MemoryRepresentation rep;
+  OptionalOpIndex element_index = OptionalOpIndex::Nullopt();
+  uint8_t element_size_log2;
+  if (const StoreOp* store = op.TryCast<StoreOp>()) {
+    if (store->write_barrier != WriteBarrierKind::kNoWriteBarrier) {
+      return false;
+    }
+    access_kind = store->kind;
+    rep = store->stored_rep;
+    element_index = store->index();
+    element_size_log2 = store->element_size_log2;
+    *access = {index, store->base(), store->offset, true};
+  } else {
+    const LoadOp& load = op.Cast<LoadOp>();
+    access_kind = load.kind;
+    rep = load.loaded_rep;
+    element_index = load.index();
+    element_size_log2 = load.element_size_log2;
+    *access = {index, load.base(), load.offset, false};
+  }
+  if (access_kind.tagged_base || access_kind.is_atomic ||
+      access_kind.with_trap_handler || !element_index.valid() ||
+      !IsInductionIndex(element_index.value(), candidate.phi) ||
+      !IsInvariant(access->data_pointer, candidate.header)) {
+    return false;
+  }
+  if (rep == MemoryRepresentation::Float64()) {
+    *kind = VectorKind::kF64x2;
+  } else if (rep == MemoryRepresentation::Float32()) {
+    *kind = VectorKind::kF32x4;
+  } else if (rep == MemoryRepresentation::Int32() ||
+             rep == MemoryRepresentation::Uint32()) {
+    *kind = VectorKind::kI32x4;
+  } else {
+    return false;
+  }
+  // The index is the one of an element, not a byte offset.
+  return element_size_log2 ==
+         base::bits::WhichPowerOfTwo(rep.SizeInBytes());
+}
+
+bool LoopVectorizationAnalyzer::IsStreamLoad(OpIndex value,
+                                             const Candidate& candidate,
+                                             MemoryRepresentation rep) const {
+  const LoadOp* load = input_graph_.Get(value).TryCast<LoadOp>();
+  if (!load || !IsInLoop(value, candidate.header)) return false;
+  if (rep == MemoryRepresentation::Int32()) {
+    return load->loaded_rep == MemoryRepresentation::Int32() ||
+           load->loaded_rep == MemoryRepresentation::Uint32();
+  }
+  return load->loaded_rep == rep;
+}
+
+bool LoopVectorizationAnalyzer::MatchBoundsCheck(const DeoptimizeIfOp& deopt,
+                                                 const Candidate& candidate,
+                                                 BoundsCheck* check) const {
+  const ComparisonOp* cmp =
+      input_graph_.Get(deopt.condition()).TryCast<ComparisonOp>();
+  if (!cmp) return false;
+  RegisterRepresentation rep = cmp->rep;
+  if (rep != RegisterRepresentation::Word32() &&
+      rep != RegisterRepresentation::Word64()) {
+    return false;
+  }
+  OpIndex index;
+  OpIndex length;
+  if (deopt.negated && cmp->kind == ComparisonOp::Kind::kUnsignedLessThan) {
+    // Deopt unless `index < length`.
+    index = cmp->left();
+    length = cmp->right();
+  } else if (!deopt.negated &&
+             cmp->kind == ComparisonOp::Kind::kUnsignedLessThanOrEqual) {
+    // Deopt if `length <= index`.
+    index = cmp->right();
+    length = cmp->left();
+  } else {
+    return false;
+  }
+  if (index != candidate.phi && !IsInductionIndex(index, candidate.phi)) {
+    return false;
+  }
+  if (!IsInvariant(length, candidate.header)) return false;
+  *check = {length, WordRepresentation(rep)};
+  return true;
+}
+
+bool LoopVectorizationAnalyzer::IsOverflowCheckOfIncrement(
+    const DeoptimizeIfOp& deopt, const Candidate& candidate) const {
+  // The increment cannot overflow while `i < limit`.
+  const ProjectionOp* overflow =
+      input_graph_.Get(deopt.condition()).TryCast<ProjectionOp>();
+  if (deopt.negated || !overflow ||
+      overflow->index != OverflowCheckedBinopOp::kOverflowIndex) {
+    return false;
+  }
+  const PhiOp& phi = input_graph_.Get(candidate.phi).Cast<PhiOp>();
+  const ProjectionOp* value =
+      input_graph_.Get(phi.back_edge()).TryCast<ProjectionOp>();
+  return value && value->input() == overflow->input();
+}
+
+bool LoopVectorizationAnalyzer::MatchValue(OpIndex value,
+                                           const Candidate& candidate,
+                                           int depth) const {
+  if (depth > kMaxDepth) return false;
+  const Operation& op = input_graph_.Get(value);
+  if (candidate.kind == VectorKind::kF64x2) {
+    if (IsInvariant(value, candidate.header)) {
+      return op.outputs_rep()[0] == RegisterRepresentation::Float64();
+    }
+    if (IsStreamLoad(value, candidate, MemoryRepresentation::Float64())) {
+      return true;
+    }
+    const FloatBinopOp* binop = op.TryCast<FloatBinopOp>();
+    if (!binop || binop->rep != FloatRepresentation::Float64()) return false;
+    switch (binop->kind) {
+      case FloatBinopOp::Kind::kAdd:
+      case FloatBinopOp::Kind::kSub:
+      case FloatBinopOp::Kind::kMul:
+      case FloatBinopOp::Kind::kDiv:
+        return MatchValue(binop->left(), candidate, depth + 1) &&
+               MatchValue(binop->right(), candidate, depth + 1);
+      default:
+        return false;
+    }
+  }
+
+  DCHECK_EQ(candidate.kind, VectorKind::kI32x4);
+  if (IsInvariant(value, candidate.header)) {
+    return op.outputs_rep()[0] == RegisterRepresentation::Word32();
+  }
+  if (IsStreamLoad(value, candidate, MemoryRepresentation::Int32())) {
+    return true;
+  }
+  // Only operations whose result doesn't depend on the signedness of the
+  // elements, since Int32 and Uint32 elements are mixed.
+  const WordBinopOp* binop = op.TryCast<WordBinopOp>();
+  if (!binop || binop->rep != WordRepresentation::Word32()) return false;
+  switch (binop->kind) {
+    case WordBinopOp::Kind::kAdd:
+    case WordBinopOp::Kind::kSub:
+    case WordBinopOp::Kind::kMul:
+    case WordBinopOp::Kind::kBitwiseAnd:
+    case WordBinopOp::Kind::kBitwiseOr:
+    case WordBinopOp::Kind::kBitwiseXor:
+      return MatchValue(binop->left(), candidate, depth + 1) &&
+             MatchValue(binop->right(), candidate, depth + 1);
+    default:
+      return false;
+  }
+}
+
+bool LoopVectorizationAnalyzer::MatchFloat32Value(
+    OpIndex value, const Candidate& candidate) const {
+  // Float32 arithmetic reaches Turboshaft as a single Float64 operation on
+  // widened operands, truncated back to Float32. For addition, subtraction,
+  // multiplication and division, this rounds the same way as the Float32
+  // operation, so it can be computed with F32x4 lanes. Longer expressions
+  // round differently, and are not matched.
+  auto is_conversion = [&](OpIndex index, RegisterRepresentation from,
+                           RegisterRepresentation to) -> const ChangeOp* {
+    const ChangeOp* change = input_graph_.Get(index).TryCast<ChangeOp>();
+    if (change && change->kind == ChangeOp::Kind::kFloatConversion &&
+        change->from == from && change->to == to) {
+      return change;
+    }
+    return nullptr;
+  };
+  auto is_widened_load = [&](OpIndex index) {
+    const ChangeOp* widen =
+        is_conversion(index, RegisterRepresentation::Float32(),
+                      RegisterRepresentation::Float64());
+    return widen && IsStreamLoad(widen->input(), candidate,
+                                 MemoryRepresentation::Float32());
+  };
+
+  if (IsStreamLoad(value, candidate, MemoryRepresentation::Float32())) {
+    return true;
+  }
+  const ChangeOp* truncate =
+      is_conversion(value, RegisterRepresentation::Float64(),
+                    RegisterRepresentation::Float32());
+  if (!truncate) return false;
+  if (is_widened_load(truncate->input())) return true;
+  const FloatBinopOp* binop =
+      input_graph_.Get(truncate->input()).TryCast<FloatBinopOp>();
+  if (!binop || binop->rep != FloatRepresentation::Float64()) return false;
+  switch (binop->kind) {
+    case FloatBinopOp::Kind::kAdd:
+    case FloatBinopOp::Kind::kSub:
+    case FloatBinopOp::Kind::kMul:
+    case FloatBinopOp::Kind::kDiv:
+      return is_widened_load(binop->left()) && is_widened_load(binop->right());
+    default:
+      return false;
+  }
+}
+
+#undef TRACE
+
+}  // namespace v8::internal::compiler::turboshaft
@@ -0,0 +1,503 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+#ifndef V8_COMPILER_TURBOSHAFT_LOOP_VECTORIZATION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_LOOP_VECTORIZATION_REDUCER_H_
+
+#include "src/base/logging.h"
+#include "src/common/scoped-modification.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/loop-finder.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/phase.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+// OVERVIEW:
+//
+// LoopVectorizationReducer vectorizes inner JS loops of the form
+//
+//   for (let i = start; i < limit; i++) {
+//     a[i] = <expression of b[i], c[i], ... and loop-invariant values>;
+//   }
+//
+// where all typed arrays have the same element type (Float64, Float32, Int32 or
+// Uint32) and the expression only uses operations whose SIMD128 version
+// computes the same lanes (see LoopVectorizationAnalyzer::MatchValue). There
+// can be several such stores in the loop.
+//
+// The loop is versioned: in front of it, a SIMD128 loop runs the first
+// (limit - start) rounded down to a multiple of the lane count iterations, if
+//   - the bounds checks of the loop hold for all of these iterations,
+//   - the other checks of the loop are loop-invariant and hold, which covers
+//     detached and out-of-bounds typed arrays,
+//   - the elements written by every store either don't overlap with the
+//     elements accessed by any other load or store, or start at the same
+//     address.
+// The original loop then runs the remaining iterations, or all of them if any
+// of these conditions doesn't hold, with all of its checks.
+//
+// Reductions are not vectorized: JS arithmetic on floats is not associative.
+// The loop has to be free of other loads, which is usually the case once
+// Turbofan has peeled it and eliminated the loads of the typed array fields.
+
+#ifdef DEBUG
+#define TRACE(x)                                      \
+  do {                                                \
+    if (v8_flags.turboshaft_trace_loop_vectorization) \
+      StdoutStream() << x << std::endl;               \
+  } while (false)
+#else
+#define TRACE(x)
+#endif
+
+class V8_EXPORT_PRIVATE LoopVectorizationAnalyzer {
+ public:
+  // How the elements are combined: as F64x2 for Float64 elements, as F32x4
+  // for Float32 elements and as I32x4 for Int32 and Uint32 elements.
+  enum class VectorKind : uint8_t { kF64x2, kF32x4, kI32x4 };
+
+  // A load or store of element `i` of a typed array, that is of
+  // `data_pointer + offset + (i << element_size_log2)`.
+  struct Access {
+    OpIndex op;
+    OpIndex data_pointer;
+    int32_t offset;
+    bool is_store;
+  };
+
+  // A check that deopts unless `i < length`.
+  struct BoundsCheck {
+    OpIndex length;
+    WordRepresentation rep;
+  };
+
+  struct Candidate {
+    explicit Candidate(Zone* zone)
+        : accesses(zone), bounds_checks(zone), invariant_checks(zone) {}
+
+    const Block* header = nullptr;
+    // The induction variable `i` and the value it is compared against.
+    OpIndex phi;
+    OpIndex limit;
+    VectorKind kind = VectorKind::kF64x2;
+    uint8_t element_size_log2 = 0;
+    // In program order.
+    ZoneVector<Access> accesses;
+    ZoneVector<BoundsCheck> bounds_checks;
+    // DeoptimizeIfs whose condition is loop-invariant.
+    ZoneVector<OpIndex> invariant_checks;
+
+    int lane_count() const { return kSimd128Size >> element_size_log2; }
+  };
+
+  LoopVectorizationAnalyzer(Zone* phase_zone, const Graph& input_graph);
+
+  bool ShouldReduce() const { return !candidates_.empty(); }
+
+  const Candidate* GetCandidate(const Block* loop_header) const {
+    auto it = candidates_.find(loop_header);
+    return it == candidates_.end() ? nullptr : &it->second;
+  }
+
+  // Returns true if {index} is defined in the loop of {loop_header}.
+  bool IsInLoop(OpIndex index, const Block* loop_header) const;
+
+  // Returns true if {index} only depends on values defined outside of the
+  // loop, through pure operations that the reducer can emit in front of it.
+  bool IsInvariant(OpIndex index, const Block* loop_header,
+                   int depth = 0) const;
+
+  size_t GetLoopOpCount(const Block* loop_header) const {
+    return loop_finder_.GetLoopInfo(loop_header).op_count;
+  }
+
+  ZoneSet<const Block*, LoopFinder::BlockCmp> GetLoopBody(
+      const Block* loop_header) {
+    return loop_finder_.GetLoopBody(loop_header);
+  }
+
+  static constexpr size_t kMaxLoopSize = 200;
+  // Bounds the depth of the expressions that are matched and re-emitted.
+  static constexpr int kMaxDepth = 16;
+
+ private:
+  void DetectVectorizableLoops();
+  bool MatchLoop(const LoopFinder::LoopInfo& info, Candidate* candidate) const;
+  bool MatchInductionIncrement(OpIndex index, OpIndex phi) const;
+  bool IsInductionIndex(OpIndex index, OpIndex phi) const;
+  bool MatchAccess(OpIndex index, const Candidate& candidate, Access* access,
+                   VectorKind* kind) const;
+  bool MatchBoundsCheck(const DeoptimizeIfOp& deopt, const Candidate& candidate,
+                        BoundsCheck* check) const;
+  bool IsOverflowCheckOfIncrement(const DeoptimizeIfOp& deopt,
+                                  const Candidate& candidate) const;
+  bool MatchValue(OpIndex value, const Candidate& candidate, int depth) const;
+  bool MatchFloat32Value(OpIndex value, const Candidate& candidate) const;
+  bool IsStreamLoad(OpIndex value, const Candidate& candidate,
+                    MemoryRepresentation rep) const;
+
+  const Graph& input_graph_;
+  Zone* phase_zone_;
+  LoopFinder loop_finder_;
+  ZoneUnorderedMap<const Block*, Candidate> candidates_;
+};
+
+template <class Next>
+class LoopVectorizationReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(LoopVectorization)
+
+  V<None> REDUCE_INPUT_GRAPH(Goto)(V<None> ig_idx, const GotoOp& gto) {
+    LABEL_BLOCK(no_change) { return Next::ReduceInputGraphGoto(ig_idx, gto); }
+
+    const Block* dst = gto.destination;
+    if (current_candidate_ != nullptr || !dst->IsLoop() || gto.is_backedge) {
+      goto no_change;
+    }
+    // We trigger the vectorization when reaching the GotoOp that enters the
+    // loop, which becomes the preheader of the vector loop.
+    const Candidate* candidate = analyzer_.GetCandidate(dst);
+    if (candidate == nullptr) goto no_change;
+    if (ShouldSkipOptimizationStep()) goto no_change;
+    if (!__ CanCreateNVariables(analyzer_.GetLoopOpCount(dst))) {
+      TRACE("> Too many variables, skipping vectorization");
+      goto no_change;
+    }
+    VectorizeLoop(*candidate);
+    return {};
+  }
+
+  OpIndex REDUCE_INPUT_GRAPH(Phi)(OpIndex ig_idx, const PhiOp& phi) {
+    if (current_candidate_ == nullptr ||
+        __ current_input_block() != current_candidate_->header) {
+      return Next::ReduceInputGraphPhi(ig_idx, phi);
+    }
+    // The scalar loop resumes where the vector loop stopped.
+    DCHECK_EQ(ig_idx, current_candidate_->phi);
+    return __ PendingLoopPhi(resume_index_, phi.rep);
+  }
+
+ private:
+  using Candidate = LoopVectorizationAnalyzer::Candidate;
+  using Access = LoopVectorizationAnalyzer::Access;
+  using VectorKind = LoopVectorizationAnalyzer::VectorKind;
+
+  // Maps the inputs of invariant operations that are re-emitted in front of
+  // the loop.
+  struct InvariantMapper {
+    OpIndex Map(OpIndex index) { return reducer->EmitInvariant(index); }
+    OptionalOpIndex Map(OptionalOpIndex index) {
+      if (!index.valid()) return OptionalOpIndex::Nullopt();
+      return reducer->EmitInvariant(index.value());
+    }
+    LoopVectorizationReducer* reducer;
+  };
+
+  void VectorizeLoop(const Candidate& candidate);
+  V<Word32> EmitGuard(const Candidate& candidate, V<Word32> start,
+                      V<Word32> limit, V<Word32> vector_end);
+  V<WordPtr> ElementAddress(const Candidate& candidate, const Access& access,
+                            V<Word32> index);
+  void EmitSplats(const Candidate& candidate, OpIndex value);
+  V<Simd128> EmitVectorValue(const Candidate& candidate, OpIndex value);
+  OpIndex EmitInvariant(OpIndex index);
+
+  LoopVectorizationAnalyzer& analyzer_ =
+      *__ data() -> loop_vectorization_analyzer();
+  // {current_candidate_} is set while the scalar loop is being emitted.
+  const Candidate* current_candidate_ = nullptr;
+  V<Word32> resume_index_;
+  const Block* current_header_ = nullptr;
+  // Input graph operations of the current loop, mapped to their counterpart
+  // in front of the vector loop or, for {vector_values_}, in its body.
+  ZoneUnorderedMap<OpIndex, OpIndex> invariants_{__ phase_zone()};
+  ZoneUnorderedMap<OpIndex, V<Simd128>> splats_{__ phase_zone()};
+  ZoneUnorderedMap<OpIndex, V<Simd128>> vector_values_{__ phase_zone()};
+};
+
+template <class Next>
+void LoopVectorizationReducer<Next>::VectorizeLoop(
+    const Candidate& candidate) {
+  TRACE("LoopVectorization: vectorizing loop at "
+        << candidate.header->index().id());
+  current_header_ = candidate.header;
+  invariants_.clear();
+  splats_.clear();
+
+  const PhiOp& phi = __ input_graph().Get(candidate.phi).template Cast<PhiOp>();
+  V<Word32> start = __ MapToNewGraph(V<Word32>::Cast(phi.input(0)));
+  V<Word32> limit = V<Word32>::Cast(EmitInvariant(candidate.limit));
+  const int lanes = candidate.lane_count();
+  V<Word32> vector_end = __ Word32Add(
+      start, __ Word32BitwiseAnd(__ Word32Sub(limit, start), -lanes));
+
+  Label<Word32> resume(this);
+  GOTO_IF_NOT(EmitGuard(candidate, start, limit, vector_end), resume, start);
+
+  // Everything that doesn't depend on the index is computed once, in front of
+  // the vector loop.
+  for (const Access& access : candidate.accesses) {
+    EmitInvariant(access.data_pointer);
+    if (access.is_store) {
+      EmitSplats(candidate, __ input_graph()
+                                .Get(access.op)
+                                .template Cast<StoreOp>()
+                                .value());
+    }
+  }
+
+  LoopLabel<Word32> loop(this);
+  GOTO(loop, start);
+
+  BIND_LOOP(loop, index) {
+    GOTO_IF_NOT(__ Int32LessThan(index, vector_end), resume, index);
+    vector_values_.clear();
+    // Loads and stores are emitted in the order of the scalar loop, so that
+    // loads from the element written by a store see the same value.
+    for (const Access& access : candidate.accesses) {
+      const LoadOp::Kind kind =
+          LoadOp::Kind::MaybeUnaligned(MemoryRepresentation::Simd128())
+              .NotLoadEliminable();
+      V<WordPtr> address = ElementAddress(candidate, access, index);
+      if (access.is_store) {
+        const StoreOp& store =
+            __ input_graph().Get(access.op).template Cast<StoreOp>();
+        __ Store(address, EmitVectorValue(candidate, store.value()), kind,
+                 MemoryRepresentation::Simd128(),
+                 WriteBarrierKind::kNoWriteBarrier, access.offset);
+      } else {
+        vector_values_[access.op] = V<Simd128>::Cast(
+            __ Load(address, kind, MemoryRepresentation::Simd128(),
+                    access.offset));
+      }
+    }
+    GOTO(loop, __ Word32Add(index, lanes));
+  }
+
+  BIND(resume, resume_index);
+  resume_index_ = resume_index;
+
+  // The scalar loop handles the remaining iterations, starting at
+  // {resume_index}. Its blocks are cloned so that the loop phi can be
+  // replaced, and the original ones are never reached.
+  ScopedModification<const Candidate*> set_candidate(&current_candidate_,
+                                                     &candidate);
+  __ CloneSubGraph(analyzer_.GetLoopBody(candidate.header),
+                   /* keep_loop_kinds */ true,
+                   /* is_loop_after_peeling */ true);
+}
+
+template <class Next>
+V<Word32> LoopVectorizationReducer<Next>::EmitGuard(const Candidate& candidate,
+                                                    V<Word32> start,
+                                                    V<Word32> limit,
+                                                    V<Word32> vector_end) {
+  // With {start} and {limit} both non-negative, the iterations of the vector
+  // loop are [start, vector_end), and there is at least one.
+  V<Word32> guard = __ Word32BitwiseAnd(
+      __ Word32BitwiseAnd(__ Int32LessThanOrEqual(0, start),
+                          __ Int32LessThanOrEqual(0, limit)),
+      __ Int32LessThan(start, vector_end));
+
+  for (const LoopVectorizationAnalyzer::BoundsCheck& check :
+       candidate.bounds_checks) {
+    OpIndex end = vector_end;
+    if (check.rep == WordRepresentation::Word64()) {
+      end = __ ChangeUint32ToUint64(vector_end);
+    }
+    V<Word32> in_bounds = V<Word32>::Cast(
+        __ UintLessThanOrEqual(end, EmitInvariant(check.length), check.rep));
+    guard = __ Word32BitwiseAnd(guard, in_bounds);
+  }
+
+  for (OpIndex check : candidate.invariant_checks) {
+    const DeoptimizeIfOp& deopt =
+        __ input_graph().Get(check).template Cast<DeoptimizeIfOp>();
+    V<Word32> fires = __ Word32Equal(
+        V<Word32>::Cast(EmitInvariant(deopt.condition())), 0);
+    if (!deopt.negated) fires = __ Word32Equal(fires, 0);
+    guard = __ Word32BitwiseAnd(guard, __ Word32Equal(fires, 0));
+  }
+
+  // Elements [start, vector_end) of every store must either not overlap with
+  // those of any other access, or be exactly the same ones, since elements
+  // are only ever combined with elements of the same index.
+  const uint8_t log2 = candidate.element_size_log2;
+  auto range_of = [&](const Access& access) {
+    V<WordPtr> base = __ WordPtrAdd(
+        V<WordPtr>::Cast(EmitInvariant(access.data_pointer)), access.offset);
+    return std::pair{
+        __ WordPtrAdd(base, __ WordPtrShiftLeft(
+                                __ ChangeUint32ToUintPtr(start), log2)),
+        __ WordPtrAdd(base, __ WordPtrShiftLeft(
+                                __ ChangeUint32ToUintPtr(vector_end), log2))};
+  };
+  const ZoneVector<Access>& accesses = candidate.accesses;
+  for (size_t i = 0; i < accesses.size(); ++i) {
+    for (size_t j = i + 1; j < accesses.size(); ++j) {
+      if (!accesses[i].is_store && !accesses[j].is_store) continue;
+      auto [begin_i, end_i] = range_of(accesses[i]);
+      auto [begin_j, end_j] = range_of(accesses[j]);
+      V<Word32> no_alias = __ Word32BitwiseOr(
+          __ WordPtrEqual(begin_i, begin_j),
+          __ Word32BitwiseOr(__ UintPtrLessThanOrEqual(end_i, begin_j),
+                             __ UintPtrLessThanOrEqual(end_j, begin_i)));
+      guard = __ Word32BitwiseAnd(guard, no_alias);
+    }
+  }
+  return guard;
+}
+
+template <class Next>
+V<WordPtr> LoopVectorizationReducer<Next>::ElementAddress(
+    const Candidate& candidate, const Access& access, V<Word32> index) {
+  return __ WordPtrAdd(
+      V<WordPtr>::Cast(EmitInvariant(access.data_pointer)),
+      __ WordPtrShiftLeft(__ ChangeUint32ToUintPtr(index),
+                          candidate.element_size_log2));
+}
+
+template <class Next>
+void LoopVectorizationReducer<Next>::EmitSplats(const Candidate& candidate,
+                                                OpIndex value) {
+  if (splats_.contains(value)) return;
+  const Operation& op = __ input_graph().Get(value);
+  if (!analyzer_.IsInvariant(value, current_header_)) {
+    if (op.Is<LoadOp>()) return;
+    for (OpIndex input : op.inputs()) EmitSplats(candidate, input);
+    return;
+  }
+  DCHECK_NE(candidate.kind, VectorKind::kF32x4);
+  Simd128SplatOp::Kind kind = candidate.kind == VectorKind::kF64x2
+                                  ? Simd128SplatOp::Kind::kF64x2
+                                  : Simd128SplatOp::Kind::kI32x4;
+  splats_[value] = __ Simd128Splat(V<Any>::Cast(EmitInvariant(value)), kind);
+}
+
+template <class Next>
+V<Simd128> LoopVectorizationReducer<Next>::EmitVectorValue(
+    const Candidate& candidate, OpIndex value) {
+  if (auto it = vector_values_.find(value); it != vector_values_.end()) {
+    return it->second;
+  }
+  if (auto it = splats_.find(value); it != splats_.end()) return it->second;
+
+  const Operation& op = __ input_graph().Get(value);
+  V<Simd128> result;
+  if (const ChangeOp* change = op.TryCast<ChangeOp>()) {
+    // Float32 values are widened to Float64 and back around a single
+    // operation, which the F32x4 operation computes without the widening.
+    DCHECK_EQ(candidate.kind, VectorKind::kF32x4);
+    DCHECK_EQ(change->kind, ChangeOp::Kind::kFloatConversion);
+    result = EmitVectorValue(candidate, change->input());
+  } else if (const FloatBinopOp* binop = op.TryCast<FloatBinopOp>()) {
+    const bool f64 = candidate.kind == VectorKind::kF64x2;
+    Simd128BinopOp::Kind kind;
+    switch (binop->kind) {
+      case FloatBinopOp::Kind::kAdd:
+        kind = f64 ? Simd128BinopOp::Kind::kF64x2Add
+                   : Simd128BinopOp::Kind::kF32x4Add;
+        break;
+      case FloatBinopOp::Kind::kSub:
+        kind = f64 ? Simd128BinopOp::Kind::kF64x2Sub
+                   : Simd128BinopOp::Kind::kF32x4Sub;
+        break;
+      case FloatBinopOp::Kind::kMul:
+        kind = f64 ? Simd128BinopOp::Kind::kF64x2Mul
+                   : Simd128BinopOp::Kind::kF32x4Mul;
+        break;
+      case FloatBinopOp::Kind::kDiv:
+        kind = f64 ? Simd128BinopOp::Kind::kF64x2Div
+                   : Simd128BinopOp::Kind::kF32x4Div;
+        break;
+      default:
+        UNREACHABLE();
+    }
+    result = __ Simd128Binop(EmitVectorValue(candidate, binop->left()),
+                             EmitVectorValue(candidate, binop->right()), kind);
+  } else {
+    const WordBinopOp& binop = op.Cast<WordBinopOp>();
+    DCHECK_EQ(candidate.kind, VectorKind::kI32x4);
+    Simd128BinopOp::Kind kind;
+    switch (binop.kind) {
+      case WordBinopOp::Kind::kAdd:
+        kind = Simd128BinopOp::Kind::kI32x4Add;
+        break;
+      case WordBinopOp::Kind::kSub:
+        kind = Simd128BinopOp::Kind::kI32x4Sub;
+        break;
+      case WordBinopOp::Kind::kMul:
+        kind = Simd128BinopOp::Kind::kI32x4Mul;
+        break;
+      case WordBinopOp::Kind::kBitwiseAnd:
+        kind = Simd128BinopOp::Kind::kS128And;
+        break;
+      case WordBinopOp::Kind::kBitwiseOr:
+        kind = Simd128BinopOp::Kind::kS128Or;
+        break;
+      case WordBinopOp::Kind::kBitwiseXor:
+        kind = Simd128BinopOp::Kind::kS128Xor;
+        break;
+      default:
+        UNREACHABLE();
+    }
+    result = __ Simd128Binop(EmitVectorValue(candidate, binop.left()),
+                             EmitVectorValue(candidate, binop.right()), kind);
+  }
+  vector_values_[value] = result;
+  return result;
+}
+
+template <class Next>
+OpIndex LoopVectorizationReducer<Next>::EmitInvariant(OpIndex index) {
+  if (!analyzer_.IsInLoop(index, current_header_)) {
+    return __ MapToNewGraph(index);
+  }
+  if (auto it = invariants_.find(index); it != invariants_.end()) {
+    return it->second;
+  }
+  // The operation is in the loop, but only depends on values defined outside
+  // of it (see LoopVectorizationAnalyzer::IsInvariant): it is emitted again in
+  // front of the vector loop, while the scalar loop keeps its own copy.
+  const Operation& op = __ input_graph().Get(index);
+  InvariantMapper mapper{this};
+  OpIndex result;
+  switch (op.opcode) {
+#define EMIT_INVARIANT(Name)                                          \
+  case Opcode::k##Name:                                               \
+    result = op.Cast<Name##Op>().Explode(                             \
+        [this](auto... args) { return __ Reduce##Name(args...); }, \
+        mapper);                                                      \
+    break;
+    EMIT_INVARIANT(Constant)
+    EMIT_INVARIANT(WordBinop)
+    EMIT_INVARIANT(Shift)
+    EMIT_INVARIANT(Comparison)
+    EMIT_INVARIANT(Change)
+    EMIT_INVARIANT(TaggedBitcast)
+#undef EMIT_INVARIANT
+    default:
+      UNREACHABLE();
+  }
+  invariants_[index] = result;
+  return result;
+}
+
+#undef TRACE
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_LOOP_VECTORIZATION_REDUCER_H_
@@ -2257,6 +2257,33 @@ class MachineOptimizationReducer : public Next {
     goto no_change;
   }
 #endif  // V8_TARGET_ARCH_ARM64
+
+  V<Simd128> REDUCE(Simd128Binop)(V<Simd128> left, V<Simd128> right,
+                                  Simd128BinopOp::Kind kind) {
+    LABEL_BLOCK(no_change) {
+      return Next::ReduceSimd128Binop(left, right, kind);
+    }
+    if (ShouldSkipOptimizationStep()) goto no_change;
+    if (kind != Simd128BinopOp::Kind::kI8x16Swizzle &&
+        kind != Simd128BinopOp::Kind::kI8x16RelaxedSwizzle) {
+      goto no_change;
+    }
+
+    // A swizzle with constant in-range indices is a shuffle of {left} with
+    // itself, which the backends can often do with a single instruction that
+    // takes an immediate instead of a byte shuffle with a loaded mask. Both
+    // swizzles agree on in-range indices.
+    const Simd128ConstantOp* indices =
+        matcher_.TryCast<Simd128ConstantOp>(right);
+    if (!indices) goto no_change;
+    uint8_t shuffle[kSimd128Size];
+    for (int i = 0; i < kSimd128Size; ++i) {
+      if (indices->value[i] >= kSimd128Size) goto no_change;
+      shuffle[i] = indices->value[i];
+    }
+    return __ Simd128Shuffle(left, left, Simd128ShuffleOp::Kind::kI8x16,
+                             shuffle);
+  }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
  private:
@@ -6787,6 +6787,7 @@ struct FastApiCallOp : OperationT<FastApiCallOp> {
       case CTypeInfo::Type::kApiObject:
       case CTypeInfo::Type::kPointer:
       case CTypeInfo::Type::kSeqOneByteString:
+      case CTypeInfo::Type::kSeqTwoByteString:
         return MaybeRegisterRepresentation::Tagged();
       case CTypeInfo::Type::kFloat32:
       case CTypeInfo::Type::kFloat64:
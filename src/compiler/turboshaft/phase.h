@@ -173,6 +173,8 @@ struct produces_printable_graph
 enum class TurboshaftPipelineKind { kJS, kWasm, kCSA, kTSABuiltin, kJSToWasm };
 
 class LoopUnrollingAnalyzer;
+class LoopVectorizationAnalyzer;
+class WasmBoundsCheckHoistingAnalyzer;
 class WasmRevecAnalyzer;
 class WasmShuffleAnalyzer;
 
@@ -467,6 +469,35 @@ class V8_EXPORT_PRIVATE PipelineData {
   }
 
   void clear_wasm_shuffle_analyzer() { wasm_shuffle_analyzer_ = nullptr; }
+
+  LoopVectorizationAnalyzer* loop_vectorization_analyzer() const {
+    DCHECK_NOT_NULL(loop_vectorization_analyzer_);
+    return loop_vectorization_analyzer_;
+  }
+
+  void set_loop_vectorization_analyzer(LoopVectorizationAnalyzer* analyzer) {
+    DCHECK_NULL(loop_vectorization_analyzer_);
+    loop_vectorization_analyzer_ = analyzer;
+  }
+
+  void clear_loop_vectorization_analyzer() {
+    loop_vectorization_analyzer_ = nullptr;
+  }
+
+  WasmBoundsCheckHoistingAnalyzer* wasm_bounds_check_hoisting_analyzer() const {
+    DCHECK_NOT_NULL(wasm_bounds_check_hoisting_analyzer_);
+    return wasm_bounds_check_hoisting_analyzer_;
+  }
+
+  void set_wasm_bounds_check_hoisting_analyzer(
+      WasmBoundsCheckHoistingAnalyzer* analyzer) {
+    DCHECK_NULL(wasm_bounds_check_hoisting_analyzer_);
+    wasm_bounds_check_hoisting_analyzer_ = analyzer;
+  }
+
+  void clear_wasm_bounds_check_hoisting_analyzer() {
+    wasm_bounds_check_hoisting_analyzer_ = nullptr;
+  }
 #endif  // V8_ENABLE_WEBASSEMBLY
 
   bool is_wasm() const {
@@ -545,6 +576,9 @@ class V8_EXPORT_PRIVATE PipelineData {
   const wasm::WasmModule* wasm_module_ = nullptr;
   bool wasm_shared_ = false;
   WasmShuffleAnalyzer* wasm_shuffle_analyzer_ = nullptr;
+  LoopVectorizationAnalyzer* loop_vectorization_analyzer_ = nullptr;
+  WasmBoundsCheckHoistingAnalyzer* wasm_bounds_check_hoisting_analyzer_ =
+      nullptr;
 #ifdef V8_ENABLE_WASM_SIMD256_REVEC
 
   WasmRevecAnalyzer* wasm_revec_analyzer_ = nullptr;
@@ -53,7 +53,19 @@ bool Pipeline::AllocateRegisters(const RegisterConfiguration* config,
   RUN_MAYBE_ABORT(MeetRegisterConstraintsPhase);
   RUN_MAYBE_ABORT(ResolvePhisPhase);
   RUN_MAYBE_ABORT(BuildLiveRangesPhase);
-  RUN_MAYBE_ABORT(BuildLiveRangeBundlesPhase);
+
+  // Linear scan is superlinear in the number of live ranges, so huge functions
+  // trade some code quality for a bounded compile time.
+  RegisterAllocationData* allocation_data = data_->register_allocation_data();
+  if (v8_flags.turbo_regalloc_live_range_budget > 0 &&
+      data_->sequence()->VirtualRegisterCount() >
+          v8_flags.turbo_regalloc_live_range_budget) {
+    allocation_data->set_is_over_budget();
+  }
+
+  if (!allocation_data->is_over_budget()) {
+    RUN_MAYBE_ABORT(BuildLiveRangeBundlesPhase);
+  }
 
   TraceSequence("before register allocation");
   if (verifier != nullptr) {
@@ -96,7 +108,7 @@ bool Pipeline::AllocateRegisters(const RegisterConfiguration* config,
 
   RUN_MAYBE_ABORT(PopulateReferenceMapsPhase);
 
-  if (v8_flags.turbo_move_optimization) {
+  if (v8_flags.turbo_move_optimization && !allocation_data->is_over_budget()) {
     RUN_MAYBE_ABORT(OptimizeMovesPhase);
   }
 
@@ -33,6 +33,7 @@
 #include "src/compiler/turboshaft/typed-optimizations-phase.h"
 
 #if V8_ENABLE_WEBASSEMBLY
+#include "src/compiler/turboshaft/loop-vectorization-phase.h"
 #include "src/compiler/turboshaft/wasm-in-js-inlining-phase.h"
 #endif  // V8_ENABLE_WEBASSEMBLY
 
@@ -209,6 +210,13 @@ class V8_EXPORT_PRIVATE Pipeline {
 
     RUN_MAYBE_ABORT(turboshaft::MachineLoweringPhase);
 
+#if V8_ENABLE_WEBASSEMBLY
+    // Runs before unrolling so that the vectorized loops are unrolled as well.
+    if (v8_flags.turboshaft_loop_vectorization) {
+      RUN_MAYBE_ABORT(turboshaft::LoopVectorizationPhase);
+    }
+#endif  // V8_ENABLE_WEBASSEMBLY
+
     if (v8_flags.turboshaft_loop_unrolling) {
       RUN_MAYBE_ABORT(turboshaft::LoopUnrollingPhase);
     }
@@ -3151,6 +3151,17 @@ class GraphBuildingNodeProcessor {
     SetMap(node, __ RestLength(node->formal_parameter_count()));
     return maglev::ProcessResult::kContinue;
   }
+  maglev::ProcessResult Process(maglev::LoadStackArgument* node,
+                                const maglev::ProcessingState& state) {
+    // LoadStackArgument counts slots from the fixed part above the frame
+    // pointer, the first of which is the receiver.
+    V<WordPtr> index = __ WordPtrAdd(
+        __ ChangeInt32ToIntPtr(Map(node->IndexInput())),
+        CommonFrameConstants::kFixedSlotCountAboveFp + node->start_index());
+    SetMap(node,
+           __ LoadStackArgument(V<Object>::Cast(__ FramePointer()), index));
+    return maglev::ProcessResult::kContinue;
+  }
 
   template <typename NodeT>
   maglev::ProcessResult ProcessAbstractLoadTaggedField(
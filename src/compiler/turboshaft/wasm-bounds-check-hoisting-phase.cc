@@ -0,0 +1,25 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/wasm-bounds-check-hoisting-phase.h"
+
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/machine-optimization-reducer.h"
+#include "src/compiler/turboshaft/value-numbering-reducer.h"
+#include "src/compiler/turboshaft/wasm-bounds-check-hoisting-reducer.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+void WasmBoundsCheckHoistingPhase::Run(PipelineData* data, Zone* temp_zone) {
+  WasmBoundsCheckHoistingAnalyzer analyzer(temp_zone, data->graph());
+
+  if (analyzer.ShouldReduce()) {
+    data->set_wasm_bounds_check_hoisting_analyzer(&analyzer);
+    CopyingPhase<WasmBoundsCheckHoistingReducer, MachineOptimizationReducer,
+                 ValueNumberingReducer>::Run(data, temp_zone);
+    data->clear_wasm_bounds_check_hoisting_analyzer();
+  }
+}
+
+}  // namespace v8::internal::compiler::turboshaft
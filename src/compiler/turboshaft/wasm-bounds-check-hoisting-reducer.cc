@@ -0,0 +1,291 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/wasm-bounds-check-hoisting-reducer.h"
+
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/loop-finder.h"
+
+#ifdef DEBUG
+#define TRACE(x)                                   \
+  do {                                             \
+    if (v8_flags.trace_wasm_bounds_check_hoisting) \
+      StdoutStream() << x << std::endl;            \
+  } while (false)
+#else
+#define TRACE(x)
+#endif
+
+namespace v8::internal::compiler::turboshaft {
+
+WasmBoundsCheckHoistingAnalyzer::WasmBoundsCheckHoistingAnalyzer(
+    Zone* phase_zone, const Graph& input_graph)
+    : input_graph_(input_graph),
+      phase_zone_(phase_zone),
+      loop_finder_(phase_zone, &input_graph,
+                   {LoopFinder::ConfigFlags::kFindCalls}),
+      candidates_(phase_zone) {
+  DetectHoistableChecks();
+}
+
+void WasmBoundsCheckHoistingAnalyzer::DetectHoistableChecks() {
+  for (const auto& [header, info] : loop_finder_.LoopHeaders()) {
+    Candidate candidate(phase_zone_);
+    if (!MatchLoop(info, &candidate)) continue;
+    TRACE("WasmBoundsCheckHoistingAnalyzer: loop at "
+          << header->index().id() << " can drop "
+          << candidate.removed_checks.size() << " checks");
+    candidates_.insert({header, std::move(candidate)});
+  }
+}
+
+bool WasmBoundsCheckHoistingAnalyzer::IsInLoop(
+    OpIndex index, const Block* loop_header) const {
+  const Block* block = &input_graph_.Get(input_graph_.BlockOf(index));
+  return block == loop_header ||
+         loop_finder_.GetLoopHeader(block) == loop_header;
+}
+
+bool WasmBoundsCheckHoistingAnalyzer::IsInvariant(OpIndex index,
+                                                  const Block* loop_header,
+                                                  int depth) const {
+  if (!IsInLoop(index, loop_header)) return true;
+  if (depth > kMaxDepth) return false;
+  const Operation& op = input_graph_.Get(index);
+  switch (op.opcode) {
+    case Opcode::kPhi:
+      // Values cached across the loop, such as the memory size, are loop
+      // phis whose backedge input is the phi itself until the next
+      // CopyingPhase removes them.
+      return input_graph_.BlockOf(index) == loop_header->index() &&
+             op.Cast<PhiOp>().back_edge() == index;
+    case Opcode::kConstant:
+    case Opcode::kWordBinop:
+    case Opcode::kShift:
+    case Opcode::kComparison:
+    case Opcode::kChange:
+      break;
+    default:
+      return false;
+  }
+  for (OpIndex input : op.inputs()) {
+    if (!IsInvariant(input, loop_header, depth + 1)) return false;
+  }
+  return true;
+}
+
+bool WasmBoundsCheckHoistingAnalyzer::MatchLoop(
+    const LoopFinder::LoopInfo& info, Candidate* candidate) {
+  const Block* header = info.start;
+  DCHECK(header->IsLoop());
+  if (info.has_inner_loops || info.op_count > kMaxLoopSize) return false;
+  candidate->header = header;
+
+  // Find the branch that decides whether the loop continues: every path to
+  // the backedge goes through one of its successors. This is either the
+  // branch at the end of the header that leaves the loop, or the branch right
+  // in front of the backedge.
+  auto in_loop = [&](const Block* block) {
+    return block == header || loop_finder_.GetLoopHeader(block) == header;
+  };
+  const BranchOp* branch =
+      header->LastOperation(input_graph_).TryCast<BranchOp>();
+  bool continue_if_true;
+  if (branch && in_loop(branch->if_true) != in_loop(branch->if_false)) {
+    continue_if_true = in_loop(branch->if_true);
+  } else {
+    const Block* backedge_block = header->LastPredecessor();
+    if (backedge_block->PredecessorCount() != 1) return false;
+    branch = backedge_block->LastPredecessor()
+                 ->LastOperation(input_graph_)
+                 .TryCast<BranchOp>();
+    if (!branch || branch->if_true == branch->if_false) return false;
+    continue_if_true = branch->if_true == backedge_block;
+  }
+
+  // The loop continues if `x < limit` or `x <= limit`, with `x` either the
+  // induction variable or its incremented value. If the loop continues on
+  // the false branch, the comparison is `limit < x` or `limit <= x`.
+  const ComparisonOp* cmp =
+      input_graph_.Get(branch->condition()).TryCast<ComparisonOp>();
+  if (!cmp || cmp->rep != RegisterRepresentation::Word64()) return false;
+  bool or_equal;
+  switch (cmp->kind) {
+    case ComparisonOp::Kind::kSignedLessThan:
+    case ComparisonOp::Kind::kUnsignedLessThan:
+      or_equal = false;
+      break;
+    case ComparisonOp::Kind::kSignedLessThanOrEqual:
+    case ComparisonOp::Kind::kUnsignedLessThanOrEqual:
+      or_equal = true;
+      break;
+    default:
+      return false;
+  }
+  OpIndex x = cmp->left();
+  OpIndex limit = cmp->right();
+  if (!continue_if_true) {
+    std::swap(x, limit);
+    or_equal = !or_equal;
+  }
+  if (!IsInvariant(limit, header)) return false;
+
+  bool compares_next = false;
+  for (OpIndex index : input_graph_.OperationIndices(*header)) {
+    const PhiOp* phi = input_graph_.Get(index).TryCast<PhiOp>();
+    if (!phi || phi->rep != RegisterRepresentation::Word64()) continue;
+    if (index != x && phi->back_edge() != x) continue;
+    if (!MatchInductionIncrement(phi->back_edge(), index, &candidate->step)) {
+      continue;
+    }
+    candidate->phi = index;
+    compares_next = index != x;
+    break;
+  }
+  if (!candidate->phi.valid()) return false;
+  candidate->limit = limit;
+  // The last iteration runs with `x <= limit - 1` (or `x <= limit`), so the
+  // induction variable is at most that, or that plus {step} if `x` is the
+  // value of the previous iteration.
+  candidate->last_index_offset =
+      (or_equal ? 0 : -1) + (compares_next ? 0 : candidate->step);
+
+  for (const Block* block : loop_finder_.GetLoopBody(header)) {
+    for (OpIndex index : input_graph_.OperationIndices(*block)) {
+      const TrapIfOp* trap = input_graph_.Get(index).TryCast<TrapIfOp>();
+      if (!trap) continue;
+      BoundsCheck check;
+      if (MatchBoundsCheck(*trap, *candidate, &check)) {
+        candidate->bounds_checks.push_back(check);
+      } else if (IsInvariant(trap->condition(), header)) {
+        candidate->invariant_checks.push_back(index);
+      } else {
+        continue;
+      }
+      candidate->removed_checks.insert(index);
+    }
+  }
+  return !candidate->bounds_checks.empty();
+}
+
+bool WasmBoundsCheckHoistingAnalyzer::MatchInductionIncrement(
+    OpIndex index, OpIndex phi, int64_t* step) const {
+  const WordBinopOp* add = input_graph_.Get(index).TryCast<WordBinopOp>();
+  if (!add || add->kind != WordBinopOp::Kind::kAdd ||
+      add->rep != WordRepresentation::Word64()) {
+    return false;
+  }
+  OpIndex constant;
+  if (add->left() == phi) {
+    constant = add->right();
+  } else if (add->right() == phi) {
+    constant = add->left();
+  } else {
+    return false;
+  }
+  return MatchWord64Constant(constant, step) && *step > 0 &&
+         *step < kMaxStep;
+}
+
+bool WasmBoundsCheckHoistingAnalyzer::MatchAffineIndex(
+    OpIndex index, const Candidate& candidate, AffineIndex* result,
+    int depth) const {
+  if (index == candidate.phi) {
+    *result = AffineIndex{};
+    return true;
+  }
+  if (depth > kMaxDepth) return false;
+  const Operation& op = input_graph_.Get(index);
+  int64_t constant;
+  auto add_offset = [&](int64_t value) {
+    if (value <= -kMaxOffset || value >= kMaxOffset) return false;
+    result->offset += value;
+    return result->offset > -kMaxOffset && result->offset < kMaxOffset;
+  };
+  auto scale = [&](int64_t factor) {
+    // Only the index itself is scaled, never the base.
+    if (result->base.valid() || factor < 1 || factor > kMaxScale) {
+      return false;
+    }
+    result->scale *= static_cast<uint32_t>(factor);
+    result->offset *= factor;
+    return result->scale <= kMaxScale && result->offset > -kMaxOffset &&
+           result->offset < kMaxOffset;
+  };
+
+  if (const ShiftOp* shift = op.TryCast<ShiftOp>()) {
+    if (shift->kind != ShiftOp::Kind::kShiftLeft ||
+        shift->rep != WordRepresentation::Word64() ||
+        !input_graph_.Get(shift->right()).Is<Opmask::kWord32Constant>()) {
+      return false;
+    }
+    int64_t amount =
+        input_graph_.Get(shift->right()).Cast<ConstantOp>().signed_integral();
+    return amount >= 0 && amount <= 4 &&
+           MatchAffineIndex(shift->left(), candidate, result, depth + 1) &&
+           scale(int64_t{1} << amount);
+  }
+
+  const WordBinopOp* binop = op.TryCast<WordBinopOp>();
+  if (!binop || binop->rep != WordRepresentation::Word64()) return false;
+  OpIndex left = binop->left();
+  OpIndex right = binop->right();
+  switch (binop->kind) {
+    case WordBinopOp::Kind::kAdd:
+      // One of the operands depends on the index, the other one is a
+      // constant offset or the (single) invariant base.
+      if (IsInvariant(left, candidate.header)) std::swap(left, right);
+      if (!MatchAffineIndex(left, candidate, result, depth + 1)) return false;
+      if (MatchWord64Constant(right, &constant)) return add_offset(constant);
+      if (result->base.valid() || !IsInvariant(right, candidate.header)) {
+        return false;
+      }
+      result->base = right;
+      return true;
+    case WordBinopOp::Kind::kSub:
+      return MatchWord64Constant(right, &constant) &&
+             constant < kMaxOffset && constant > -kMaxOffset &&
+             MatchAffineIndex(left, candidate, result, depth + 1) &&
+             add_offset(-constant);
+    case WordBinopOp::Kind::kMul:
+      if (MatchWord64Constant(left, &constant)) std::swap(left, right);
+      return MatchWord64Constant(right, &constant) &&
+             MatchAffineIndex(left, candidate, result, depth + 1) &&
+             scale(constant);
+    default:
+      return false;
+  }
+}
+
+bool WasmBoundsCheckHoistingAnalyzer::MatchBoundsCheck(
+    const TrapIfOp& trap, const Candidate& candidate,
+    BoundsCheck* check) const {
+  // Trap unless `index < size`.
+  if (!trap.negated || trap.trap_id != TrapId::kTrapMemOutOfBounds) {
+    return false;
+  }
+  const ComparisonOp* cmp =
+      input_graph_.Get(trap.condition()).TryCast<ComparisonOp>();
+  if (!cmp || cmp->kind != ComparisonOp::Kind::kUnsignedLessThan ||
+      cmp->rep != RegisterRepresentation::Word64() ||
+      !IsInvariant(cmp->right(), candidate.header)) {
+    return false;
+  }
+  AffineIndex index;
+  if (!MatchAffineIndex(cmp->left(), candidate, &index, 0)) return false;
+  *check = {index.base, index.scale, index.offset, cmp->right()};
+  return true;
+}
+
+bool WasmBoundsCheckHoistingAnalyzer::MatchWord64Constant(
+    OpIndex index, int64_t* value) const {
+  const Operation& op = input_graph_.Get(index);
+  if (!op.Is<Opmask::kWord64Constant>()) return false;
+  *value = op.Cast<ConstantOp>().signed_integral();
+  return true;
+}
+
+#undef TRACE
+
+}  // namespace v8::internal::compiler::turboshaft
@@ -0,0 +1,344 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#if !V8_ENABLE_WEBASSEMBLY
+#error This header should only be included if WebAssembly is enabled.
+#endif  // !V8_ENABLE_WEBASSEMBLY
+
+#ifndef V8_COMPILER_TURBOSHAFT_WASM_BOUNDS_CHECK_HOISTING_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_WASM_BOUNDS_CHECK_HOISTING_REDUCER_H_
+
+#include "src/base/logging.h"
+#include "src/common/scoped-modification.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/loop-finder.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/phase.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+// OVERVIEW:
+//
+// Memory64 accesses are bounds checked with an explicit
+//
+//   TrapIfNot(Uint64LessThan(index, size), kTrapMemOutOfBounds)
+//
+// in front of every load and store, where {size} is either the memory size
+// minus the end offset of the access or, with the trap handler, a constant
+// that keeps the access within the guard regions.
+//
+// WasmBoundsCheckHoistingReducer removes these checks from innermost loops
+// of the form
+//
+//   loop (i = start; ...; i += step) {
+//     ...
+//     TrapIfNot(a * i + b < size)   // {size} and {b} loop-invariant
+//     ...
+//     if (!(i < limit)) break;      // or `i + step < limit`, or `<=`
+//   }
+//
+// Traps are observable after the stores of the previous iterations, so the
+// checks cannot simply be moved in front of the loop. Instead, the loop is
+// versioned: a guard in front of it computes an upper bound on `i` from
+// {start}, {limit} and {step}, and checks, for each bounds check, that it
+// holds for the smallest and the largest value of `i`. Since all of these
+// values are small enough for `a * i + b` not to overflow, this covers every
+// iteration. If the guard holds, a copy of the loop without these checks runs;
+// otherwise, the original loop runs and traps where it would have. Checks
+// whose condition is loop-invariant are moved to the guard as well.
+
+#ifdef DEBUG
+#define TRACE(x)                                   \
+  do {                                             \
+    if (v8_flags.trace_wasm_bounds_check_hoisting) \
+      StdoutStream() << x << std::endl;            \
+  } while (false)
+#else
+#define TRACE(x)
+#endif
+
+class V8_EXPORT_PRIVATE WasmBoundsCheckHoistingAnalyzer {
+ public:
+  // A check that traps unless `scale * i + base + offset < size`.
+  struct BoundsCheck {
+    OptionalOpIndex base;
+    uint32_t scale;
+    int64_t offset;
+    OpIndex size;
+  };
+
+  struct Candidate {
+    explicit Candidate(Zone* zone)
+        : bounds_checks(zone), invariant_checks(zone), removed_checks(zone) {}
+
+    const Block* header = nullptr;
+    // The induction variable `i`, incremented by {step} in every iteration,
+    // and the value it is compared against.
+    OpIndex phi;
+    int64_t step = 0;
+    OpIndex limit;
+    // `i` is at most `limit + last_index_offset`, or `start` if that is
+    // larger.
+    int64_t last_index_offset = 0;
+    ZoneVector<BoundsCheck> bounds_checks;
+    // TrapIfs whose condition is loop-invariant.
+    ZoneVector<OpIndex> invariant_checks;
+    // The TrapIfs that the guard covers.
+    ZoneUnorderedSet<OpIndex> removed_checks;
+  };
+
+  WasmBoundsCheckHoistingAnalyzer(Zone* phase_zone, const Graph& input_graph);
+
+  bool ShouldReduce() const { return !candidates_.empty(); }
+
+  const Candidate* GetCandidate(const Block* loop_header) const {
+    auto it = candidates_.find(loop_header);
+    return it == candidates_.end() ? nullptr : &it->second;
+  }
+
+  // Returns true if {index} is defined in the loop of {loop_header}.
+  bool IsInLoop(OpIndex index, const Block* loop_header) const;
+
+  // Returns true if {index} only depends on values defined outside of the
+  // loop, through pure operations that the reducer can emit in front of it.
+  bool IsInvariant(OpIndex index, const Block* loop_header,
+                   int depth = 0) const;
+
+  size_t GetLoopOpCount(const Block* loop_header) const {
+    return loop_finder_.GetLoopInfo(loop_header).op_count;
+  }
+
+  ZoneSet<const Block*, LoopFinder::BlockCmp> GetLoopBody(
+      const Block* loop_header) {
+    return loop_finder_.GetLoopBody(loop_header);
+  }
+
+  static constexpr size_t kMaxLoopSize = 400;
+  // Bounds the depth of the expressions that are matched and re-emitted.
+  static constexpr int kMaxDepth = 16;
+  // The guard only holds if `i`, {limit} and the bases of the checks stay
+  // below {kMaxIndex}, so that none of the indices computed from them
+  // overflows.
+  static constexpr uint64_t kMaxIndex = uint64_t{1} << 40;
+  static constexpr int64_t kMaxStep = int64_t{1} << 16;
+  static constexpr uint32_t kMaxScale = 16;
+  static constexpr int64_t kMaxOffset = int64_t{1} << 31;
+
+ private:
+  // `scale * i + base + offset`.
+  struct AffineIndex {
+    OptionalOpIndex base = OptionalOpIndex::Nullopt();
+    uint32_t scale = 1;
+    int64_t offset = 0;
+  };
+
+  void DetectHoistableChecks();
+  bool MatchLoop(const LoopFinder::LoopInfo& info, Candidate* candidate);
+  bool MatchInductionIncrement(OpIndex index, OpIndex phi,
+                               int64_t* step) const;
+  bool MatchAffineIndex(OpIndex index, const Candidate& candidate,
+                        AffineIndex* result, int depth) const;
+  bool MatchBoundsCheck(const TrapIfOp& trap, const Candidate& candidate,
+                        BoundsCheck* check) const;
+  bool MatchWord64Constant(OpIndex index, int64_t* value) const;
+
+  const Graph& input_graph_;
+  Zone* phase_zone_;
+  LoopFinder loop_finder_;
+  ZoneUnorderedMap<const Block*, Candidate> candidates_;
+};
+
+template <class Next>
+class WasmBoundsCheckHoistingReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(WasmBoundsCheckHoisting)
+
+  V<None> REDUCE_INPUT_GRAPH(Goto)(V<None> ig_idx, const GotoOp& gto) {
+    LABEL_BLOCK(no_change) { return Next::ReduceInputGraphGoto(ig_idx, gto); }
+
+    const Block* dst = gto.destination;
+    if (current_candidate_ != nullptr || !dst->IsLoop() || gto.is_backedge) {
+      goto no_change;
+    }
+    // We version the loop when reaching the GotoOp that enters it, which
+    // becomes the block that checks the guard.
+    const Candidate* candidate = analyzer_.GetCandidate(dst);
+    if (candidate == nullptr) goto no_change;
+    if (ShouldSkipOptimizationStep()) goto no_change;
+    if (!__ CanCreateNVariables(analyzer_.GetLoopOpCount(dst))) {
+      TRACE("> Too many variables, skipping bounds check hoisting");
+      goto no_change;
+    }
+    VersionLoop(*candidate);
+    return {};
+  }
+
+  V<None> REDUCE_INPUT_GRAPH(TrapIf)(V<None> ig_idx, const TrapIfOp& trap) {
+    if (emitting_unchecked_loop_ &&
+        current_candidate_->removed_checks.contains(ig_idx)) {
+      // The guard in front of the loop established that this check passes.
+      return V<None>::Invalid();
+    }
+    return Next::ReduceInputGraphTrapIf(ig_idx, trap);
+  }
+
+ private:
+  using Candidate = WasmBoundsCheckHoistingAnalyzer::Candidate;
+  using BoundsCheck = WasmBoundsCheckHoistingAnalyzer::BoundsCheck;
+
+  // Maps the inputs of invariant operations that are re-emitted in front of
+  // the loop.
+  struct InvariantMapper {
+    OpIndex Map(OpIndex index) { return reducer->EmitInvariant(index); }
+    OptionalOpIndex Map(OptionalOpIndex index) {
+      if (!index.valid()) return OptionalOpIndex::Nullopt();
+      return reducer->EmitInvariant(index.value());
+    }
+    WasmBoundsCheckHoistingReducer* reducer;
+  };
+
+  void VersionLoop(const Candidate& candidate);
+  V<Word32> EmitGuard(const Candidate& candidate);
+  OpIndex EmitInvariant(OpIndex index);
+
+  WasmBoundsCheckHoistingAnalyzer& analyzer_ =
+      *__ data() -> wasm_bounds_check_hoisting_analyzer();
+  // {current_candidate_} is set while the versions of the loop are emitted.
+  const Candidate* current_candidate_ = nullptr;
+  bool emitting_unchecked_loop_ = false;
+  const Block* current_header_ = nullptr;
+  // Input graph operations of the current loop, mapped to their counterpart
+  // in front of it.
+  ZoneUnorderedMap<OpIndex, OpIndex> invariants_{__ phase_zone()};
+};
+
+template <class Next>
+void WasmBoundsCheckHoistingReducer<Next>::VersionLoop(
+    const Candidate& candidate) {
+  TRACE("WasmBoundsCheckHoisting: versioning loop at "
+        << candidate.header->index().id() << ", removing "
+        << candidate.removed_checks.size() << " checks");
+  current_header_ = candidate.header;
+  invariants_.clear();
+
+  Block* unchecked = __ NewBlock();
+  Block* checked = __ NewBlock();
+  __ Branch(EmitGuard(candidate), unchecked, checked, BranchHint::kTrue);
+
+  // Both versions are clones of the loop, and the original blocks are never
+  // reached.
+  ScopedModification<const Candidate*> set_candidate(&current_candidate_,
+                                                     &candidate);
+  if (__ Bind(unchecked)) {
+    ScopedModification<bool> set_unchecked(&emitting_unchecked_loop_, true);
+    __ CloneSubGraph(analyzer_.GetLoopBody(candidate.header),
+                     /* keep_loop_kinds */ true,
+                     /* is_loop_after_peeling */ true);
+  }
+  if (__ Bind(checked)) {
+    __ CloneSubGraph(analyzer_.GetLoopBody(candidate.header),
+                     /* keep_loop_kinds */ true,
+                     /* is_loop_after_peeling */ true);
+  }
+}
+
+template <class Next>
+V<Word32> WasmBoundsCheckHoistingReducer<Next>::EmitGuard(
+    const Candidate& candidate) {
+  using Analyzer = WasmBoundsCheckHoistingAnalyzer;
+  const PhiOp& phi = __ input_graph().Get(candidate.phi).template Cast<PhiOp>();
+  V<Word64> start = __ MapToNewGraph(V<Word64>::Cast(phi.forward_edge()));
+  V<Word64> limit = V<Word64>::Cast(EmitInvariant(candidate.limit));
+  V<Word64> last = __ Word64Add(
+      limit, __ Word64Constant(static_cast<uint64_t>(
+                 candidate.last_index_offset)));
+  auto is_small = [&](V<Word64> value) {
+    return __ Uint64LessThan(value, __ Word64Constant(Analyzer::kMaxIndex));
+  };
+  // The values of `i` are in [start, max(start, last)].
+  V<Word32> guard = __ Word32BitwiseAnd(
+      __ Word32BitwiseAnd(is_small(start), is_small(limit)), is_small(last));
+
+  for (const BoundsCheck& check : candidate.bounds_checks) {
+    V<Word64> base;
+    if (check.base.valid()) {
+      base = V<Word64>::Cast(EmitInvariant(check.base.value()));
+      guard = __ Word32BitwiseAnd(guard, is_small(base));
+    }
+    auto index_at = [&](V<Word64> i) {
+      V<Word64> index = i;
+      if (check.scale != 1) {
+        index = __ Word64Mul(index, __ Word64Constant(uint64_t{check.scale}));
+      }
+      if (check.base.valid()) index = __ Word64Add(index, base);
+      return __ Word64Add(
+          index, __ Word64Constant(static_cast<uint64_t>(check.offset)));
+    };
+    V<Word64> size = V<Word64>::Cast(EmitInvariant(check.size));
+    guard = __ Word32BitwiseAnd(
+        guard, __ Word32BitwiseAnd(__ Uint64LessThan(index_at(start), size),
+                                   __ Uint64LessThan(index_at(last), size)));
+  }
+
+  for (OpIndex check : candidate.invariant_checks) {
+    const TrapIfOp& trap =
+        __ input_graph().Get(check).template Cast<TrapIfOp>();
+    V<Word32> fires = __ Word32Equal(
+        V<Word32>::Cast(EmitInvariant(trap.condition())), 0);
+    if (!trap.negated) fires = __ Word32Equal(fires, 0);
+    guard = __ Word32BitwiseAnd(guard, __ Word32Equal(fires, 0));
+  }
+  return guard;
+}
+
+template <class Next>
+OpIndex WasmBoundsCheckHoistingReducer<Next>::EmitInvariant(OpIndex index) {
+  if (!analyzer_.IsInLoop(index, current_header_)) {
+    return __ MapToNewGraph(index);
+  }
+  if (auto it = invariants_.find(index); it != invariants_.end()) {
+    return it->second;
+  }
+  // The operation is in the loop, but only depends on values defined outside
+  // of it (see WasmBoundsCheckHoistingAnalyzer::IsInvariant): it is emitted
+  // again in front of the loop, while both versions keep their own copy.
+  const Operation& op = __ input_graph().Get(index);
+  InvariantMapper mapper{this};
+  OpIndex result;
+  switch (op.opcode) {
+    case Opcode::kPhi:
+      // A loop phi that only ever takes its forward value.
+      result = __ MapToNewGraph(op.Cast<PhiOp>().forward_edge());
+      break;
+#define EMIT_INVARIANT(Name)                                          \
+  case Opcode::k##Name:                                               \
+    result = op.Cast<Name##Op>().Explode(                             \
+        [this](auto... args) { return __ Reduce##Name(args...); }, \
+        mapper);                                                      \
+    break;
+    EMIT_INVARIANT(Constant)
+    EMIT_INVARIANT(WordBinop)
+    EMIT_INVARIANT(Shift)
+    EMIT_INVARIANT(Comparison)
+    EMIT_INVARIANT(Change)
+#undef EMIT_INVARIANT
+    default:
+      UNREACHABLE();
+  }
+  invariants_[index] = result;
+  return result;
+}
+
+#undef TRACE
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_WASM_BOUNDS_CHECK_HOISTING_REDUCER_H_
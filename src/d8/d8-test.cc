@@ -87,6 +87,17 @@ class FastCApiObject {
     return ret;
   }
 
+  static AnyCType CopyTwoByteStringFastCallbackPatch(AnyCType receiver,
+                                                     AnyCType source,
+                                                     AnyCType out,
+                                                     AnyCType options) {
+    AnyCType ret;
+    CopyTwoByteStringFastCallback(
+        receiver.object_value, *source.two_byte_string_value,
+        out.object_value, *options.options_value);
+    return ret;
+  }
+
 #endif  //  V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
   static void CopyStringFastCallback(Local<Object> receiver,
                                      const FastOneByteString& source,
@@ -117,6 +128,30 @@ class FastCApiObject {
     CHECK_SELF_OR_THROW_SLOW();
     self->slow_call_count_++;
   }
+
+  static void CopyTwoByteStringFastCallback(Local<Object> receiver,
+                                            const FastTwoByteString& source,
+                                            Local<Object> out,
+                                            FastApiCallbackOptions& options) {
+    FastCApiObject* self = UnwrapObject(receiver);
+    self->fast_call_count_++;
+
+    HandleScope handle_scope(options.isolate);
+    if (!out->IsUint16Array()) {
+      options.isolate->ThrowError(
+          "Invalid parameter, the second parameter has to be a Uint16Array.");
+      return;
+    }
+    Local<Uint16Array> array = out.As<Uint16Array>();
+    if (array->Length() < source.length) {
+      options.isolate->ThrowError(
+          "Invalid parameter, destination array is too small.");
+      return;
+    }
+    uint8_t* memory = reinterpret_cast<uint8_t*>(array->Buffer()->Data()) +
+                      array->ByteOffset();
+    memcpy(memory, source.data, source.length * sizeof(uint16_t));
+  }
 #ifdef V8_USE_SIMULATOR_WITH_GENERIC_C_CALLS
   static AnyCType AddAllFastCallbackPatch(AnyCType receiver,
                                           AnyCType arg_i32, AnyCType arg_u32,
@@ -1538,6 +1573,17 @@ Local<FunctionTemplate> Shell::CreateTestFastCApiTemplate(Isolate* isolate) {
                               ConstructorBehavior::kThrow,
                               SideEffectType::kHasSideEffect, &copy_str_func));
 
+    CFunction copy_two_byte_str_func = CFunction::Make(
+        FastCApiObject::CopyTwoByteStringFastCallback V8_IF_USE_SIMULATOR(
+            FastCApiObject::CopyTwoByteStringFastCallbackPatch));
+    api_obj_ctor->PrototypeTemplate()->Set(
+        isolate, "copy_two_byte_string",
+        FunctionTemplate::New(isolate, FastCApiObject::CopyStringSlowCallback,
+                              Local<Value>(), signature, 1,
+                              ConstructorBehavior::kThrow,
+                              SideEffectType::kHasSideEffect,
+                              &copy_two_byte_str_func));
+
     CFunction add_all_c_func =
         CFunction::Make(FastCApiObject::AddAllFastCallback V8_IF_USE_SIMULATOR(
             FastCApiObject::AddAllFastCallbackPatch));
@@ -5659,6 +5659,271 @@ void SourceGroup::JoinThread(const i::ParkedScope& parked) {
   thread_->Join();
 }
 
+namespace {
+
+struct BenchmarkIsolateStats {
+  int thread = 0;
+  std::vector<double> latencies_ms;
+  int failures = 0;
+  int gc_count = 0;
+  double gc_time_ms = 0;
+  base::TimeTicks gc_start;
+  size_t used_heap_size = 0;
+  size_t total_heap_size = 0;
+  // Bounds of the timed iterations.
+  base::TimeTicks start;
+  base::TimeTicks end;
+};
+
+// Hosts the isolates with index |thread_index| + k * |num_threads| of a
+// benchmark run and runs their iterations round-robin.
+class BenchmarkThread : public base::Thread {
+ public:
+  BenchmarkThread(std::vector<BenchmarkIsolateStats>* stats, int thread_index,
+                  int num_threads)
+      : base::Thread(GetThreadOptions("BenchmarkThread")),
+        stats_(stats),
+        thread_index_(thread_index),
+        num_threads_(num_threads) {}
+
+  void Run() override;
+
+ private:
+  static void GCPrologue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                         void* data) {
+    static_cast<BenchmarkIsolateStats*>(data)->gc_start =
+        base::TimeTicks::Now();
+  }
+
+  static void GCEpilogue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                         void* data) {
+    auto* stats = static_cast<BenchmarkIsolateStats*>(data);
+    stats->gc_count++;
+    stats->gc_time_ms +=
+        (base::TimeTicks::Now() - stats->gc_start).InMillisecondsF();
+  }
+
+  // Runs the main source group once in a fresh context of |isolate|. Returns
+  // false if an exception was thrown.
+  static bool RunIteration(Isolate* isolate);
+
+  std::vector<BenchmarkIsolateStats>* const stats_;
+  const int thread_index_;
+  const int num_threads_;
+};
+
+bool BenchmarkThread::RunIteration(Isolate* isolate) {
+  HandleScope scope(isolate);
+  Global<Context> global_context;
+  {
+    Local<Context> context;
+    if (!Shell::CreateEvaluationContext(isolate).ToLocal(&context)) {
+      return false;
+    }
+    global_context.Reset(isolate, context);
+  }
+  PerIsolateData::RealmScope realm_scope(isolate, global_context);
+  // See SourceGroup::ExecuteInThread() for why this is not a Context::Scope.
+  global_context.Get(isolate)->Enter();
+  bool success = Shell::options.isolate_sources[0].Execute(isolate);
+  global_context.Get(isolate)->Exit();
+  if (!Shell::FinishExecuting(isolate, global_context)) success = false;
+  return success;
+}
+
+void BenchmarkThread::Run() {
+  base::FlushDenormalsScope denormals_scope(Shell::options.flush_denormals);
+
+  struct HostedIsolate {
+    Isolate* isolate;
+    BenchmarkIsolateStats* stats;
+    std::unique_ptr<D8Console> console;
+    std::unique_ptr<PerIsolateData> data;
+  };
+  std::vector<HostedIsolate> hosted;
+  for (size_t i = thread_index_; i < stats_->size(); i += num_threads_) {
+    Isolate::CreateParams create_params = GetDefaultIsolateCreateParams();
+    Isolate* isolate = Isolate::New(create_params);
+    BenchmarkIsolateStats* stats = &(*stats_)[i];
+    stats->thread = thread_index_;
+    Isolate::Scope isolate_scope(isolate);
+    auto console = std::make_unique<D8Console>(isolate);
+    Shell::Initialize(isolate, console.get(), false);
+    auto data = std::make_unique<PerIsolateData>(isolate);
+    isolate->AddGCPrologueCallback(GCPrologue, stats);
+    isolate->AddGCEpilogueCallback(GCEpilogue, stats);
+    hosted.push_back({isolate, stats, std::move(console), std::move(data)});
+  }
+
+  const int warmup = Shell::options.bench_warmup;
+  const int iterations = Shell::options.bench_iterations;
+  for (int iteration = 0; iteration < warmup + iterations; iteration++) {
+    const bool timed = iteration >= warmup;
+    for (HostedIsolate& entry : hosted) {
+      Isolate::Scope isolate_scope(entry.isolate);
+      if (timed && iteration == warmup) {
+        // Warm-up GCs don't count.
+        entry.stats->gc_count = 0;
+        entry.stats->gc_time_ms = 0;
+        entry.stats->start = base::TimeTicks::Now();
+      }
+      base::TimeTicks start = base::TimeTicks::Now();
+      bool success = RunIteration(entry.isolate);
+      base::TimeTicks end = base::TimeTicks::Now();
+      if (!timed) continue;
+      entry.stats->latencies_ms.push_back((end - start).InMillisecondsF());
+      if (!success) entry.stats->failures++;
+      entry.stats->end = end;
+    }
+  }
+
+  for (HostedIsolate& entry : hosted) {
+    {
+      Isolate::Scope isolate_scope(entry.isolate);
+      HeapStatistics heap_statistics;
+      entry.isolate->GetHeapStatistics(&heap_statistics);
+      entry.stats->used_heap_size = heap_statistics.used_heap_size();
+      entry.stats->total_heap_size = heap_statistics.total_heap_size();
+      entry.isolate->RemoveGCPrologueCallback(GCPrologue, entry.stats);
+      entry.isolate->RemoveGCEpilogueCallback(GCEpilogue, entry.stats);
+      entry.data.reset();
+      entry.console.reset();
+      Shell::ResetOnProfileEndListener(entry.isolate);
+    }
+    platform::NotifyIsolateShutdown(g_default_platform, entry.isolate);
+    entry.isolate->Dispose();
+  }
+}
+
+// Returns the |p|-th percentile of the sorted |values|.
+double Percentile(const std::vector<double>& values, double p) {
+  if (values.empty()) return 0;
+  size_t index = static_cast<size_t>(p / 100 * (values.size() - 1) + 0.5);
+  return values[index];
+}
+
+void WriteLatencyJSON(std::ostream& out, std::vector<double> latencies_ms) {
+  std::sort(latencies_ms.begin(), latencies_ms.end());
+  out << "{\"p50\": " << Percentile(latencies_ms, 50)
+      << ", \"p90\": " << Percentile(latencies_ms, 90)
+      << ", \"p99\": " << Percentile(latencies_ms, 99) << ", \"max\": "
+      << (latencies_ms.empty() ? 0 : latencies_ms.back()) << "}";
+}
+
+// Exponential buckets from 0.25ms up to ~8s, plus one for everything above.
+constexpr int kBenchmarkHistogramBuckets = 16;
+constexpr double kBenchmarkHistogramFirstBoundMs = 0.25;
+
+void WriteHistogramJSON(std::ostream& out,
+                        const std::vector<double>& latencies_ms) {
+  int counts[kBenchmarkHistogramBuckets + 1] = {0};
+  for (double latency : latencies_ms) {
+    int bucket = 0;
+    double bound = kBenchmarkHistogramFirstBoundMs;
+    while (bucket < kBenchmarkHistogramBuckets && latency > bound) {
+      bucket++;
+      bound *= 2;
+    }
+    counts[bucket]++;
+  }
+  out << "{\"upper_bounds_ms\": [";
+  double bound = kBenchmarkHistogramFirstBoundMs;
+  for (int i = 0; i < kBenchmarkHistogramBuckets; i++, bound *= 2) {
+    out << (i ? ", " : "") << bound;
+  }
+  out << "], \"counts\": [";
+  for (int i = 0; i <= kBenchmarkHistogramBuckets; i++) {
+    out << (i ? ", " : "") << counts[i];
+  }
+  out << "]}";
+}
+
+}  // namespace
+
+int Shell::RunBenchmark(Isolate* isolate) {
+  const int num_isolates = std::max(options.bench_isolates.get(), 1);
+  const int num_threads =
+      options.bench_threads > 0
+          ? std::min(options.bench_threads.get(), num_isolates)
+          : num_isolates;
+  std::vector<BenchmarkIsolateStats> stats(num_isolates);
+
+  // Park the main thread in case the benchmark isolates perform a shared GC.
+  reinterpret_cast<i::Isolate*>(isolate)
+      ->main_thread_local_isolate()
+      ->ExecuteMainThreadWhileParked([&]() {
+        std::vector<std::unique_ptr<BenchmarkThread>> threads;
+        for (int i = 0; i < num_threads; i++) {
+          threads.push_back(
+              std::make_unique<BenchmarkThread>(&stats, i, num_threads));
+          CHECK(threads.back()->Start());
+        }
+        for (auto& thread : threads) thread->Join();
+      });
+
+  std::vector<double> all_latencies_ms;
+  int failures = 0;
+  base::TimeTicks start = stats[0].start;
+  base::TimeTicks end = stats[0].end;
+  for (const BenchmarkIsolateStats& isolate_stats : stats) {
+    all_latencies_ms.insert(all_latencies_ms.end(),
+                            isolate_stats.latencies_ms.begin(),
+                            isolate_stats.latencies_ms.end());
+    failures += isolate_stats.failures;
+    start = std::min(start, isolate_stats.start);
+    end = std::max(end, isolate_stats.end);
+  }
+  const double wall_time_ms = (end - start).InMillisecondsF();
+  const double runs_per_second =
+      wall_time_ms > 0 ? all_latencies_ms.size() * 1000 / wall_time_ms : 0;
+
+  std::vector<double> sorted_latencies_ms = all_latencies_ms;
+  std::sort(sorted_latencies_ms.begin(), sorted_latencies_ms.end());
+  printf(
+      "Benchmark: %d isolate(s) on %d thread(s), %d iteration(s) after %d "
+      "warm-up: %.2f runs/s, p50 %.3f ms, p99 %.3f ms, %d failure(s)\n",
+      num_isolates, num_threads, options.bench_iterations.get(),
+      options.bench_warmup.get(), runs_per_second,
+      Percentile(sorted_latencies_ms, 50), Percentile(sorted_latencies_ms, 99),
+      failures);
+
+  if (options.bench_json) {
+    std::ofstream out(options.bench_json.get());
+    out << "{\"isolates\": " << num_isolates
+        << ", \"threads\": " << num_threads
+        << ", \"iterations\": " << options.bench_iterations.get()
+        << ", \"warmup\": " << options.bench_warmup.get()
+        << ", \"wall_time_ms\": " << wall_time_ms
+        << ", \"runs_per_second\": " << runs_per_second
+        << ", \"failures\": " << failures << ", \"latency_ms\": ";
+    WriteLatencyJSON(out, all_latencies_ms);
+    out << ", \"per_isolate\": [";
+    for (int i = 0; i < num_isolates; i++) {
+      const BenchmarkIsolateStats& isolate_stats = stats[i];
+      out << (i ? ", " : "") << "{\"isolate\": " << i
+          << ", \"thread\": " << isolate_stats.thread
+          << ", \"failures\": " << isolate_stats.failures
+          << ", \"latency_ms\": ";
+      WriteLatencyJSON(out, isolate_stats.latencies_ms);
+      out << ", \"histogram\": ";
+      WriteHistogramJSON(out, isolate_stats.latencies_ms);
+      out << ", \"gc\": {\"count\": " << isolate_stats.gc_count
+          << ", \"time_ms\": " << isolate_stats.gc_time_ms << "}"
+          << ", \"heap\": {\"used_bytes\": " << isolate_stats.used_heap_size
+          << ", \"total_bytes\": " << isolate_stats.total_heap_size << "}}";
+    }
+    out << "]}\n";
+    if (!out.good()) {
+      printf("Error writing benchmark results to '%s'\n",
+             options.bench_json.get());
+      return 1;
+    }
+  }
+
+  if (options.no_fail) return 0;
+  return failures > 0 ? 1 : 0;
+}
+
 void SerializationDataQueue::Enqueue(std::unique_ptr<SerializationData> data) {
   base::MutexGuard lock_guard(&mutex_);
   data_.push_back(std::move(data));
@@ -6315,6 +6580,23 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (FlagWithArgMatches("--thread-pool-size", &flag_value, argc, argv,
                                   &i)) {
       options.thread_pool_size = atoi(flag_value);
+    } else if (FlagMatches("--work-stealing", &argv[i])) {
+      options.work_stealing = true;
+    } else if (FlagWithArgMatches("--bench-iterations", &flag_value, argc,
+                                  argv, &i)) {
+      options.bench_iterations = atoi(flag_value);
+    } else if (FlagWithArgMatches("--bench-warmup", &flag_value, argc, argv,
+                                  &i)) {
+      options.bench_warmup = atoi(flag_value);
+    } else if (FlagWithArgMatches("--bench-isolates", &flag_value, argc, argv,
+                                  &i)) {
+      options.bench_isolates = atoi(flag_value);
+    } else if (FlagWithArgMatches("--bench-threads", &flag_value, argc, argv,
+                                  &i)) {
+      options.bench_threads = atoi(flag_value);
+    } else if (FlagWithArgMatches("--bench-json", &flag_value, argc, argv,
+                                  &i)) {
+      options.bench_json = flag_value;
     } else if (FlagMatches("--no-can-block", &argv[i])) {
       options.can_block = false;
     } else if (FlagMatches("--stress-delay-tasks", &argv[i])) {
@@ -7160,7 +7442,9 @@ int Shell::Main(int argc, char* argv[]) {
         options.thread_pool_size, v8::platform::IdleTaskSupport::kEnabled,
         in_process_stack_dumping, std::move(tracing),
         options.apply_priority ? v8::platform::PriorityMode::kApply
-                               : v8::platform::PriorityMode::kDontApply);
+                               : v8::platform::PriorityMode::kDontApply,
+        options.work_stealing ? v8::platform::WorkerScheduling::kWorkStealing
+                              : v8::platform::WorkerScheduling::kSharedQueue);
   }
   g_default_platform = g_platform.get();
   if (i::v8_flags.predictable) {
@@ -7341,6 +7625,8 @@ int Shell::Main(int argc, char* argv[]) {
           bool last_run = i == options.stress_runs - 1;
           result = RunMain(isolate, last_run);
         }
+      } else if (options.bench_iterations > 0) {
+        result = RunBenchmark(isolate);
       } else if (options.code_cache_options != ShellOptions::kNoProduceCache) {
         // Park the main thread here in case the new isolate wants to perform
         // a shared GC to prevent a deadlock.
@@ -500,6 +500,12 @@ class ShellOptions {
   DisallowReassignment<bool> quiet_load = {"quiet-load", false};
   DisallowReassignment<bool> apply_priority = {"apply-priority", true};
   DisallowReassignment<int> thread_pool_size = {"thread-pool-size", 0};
+  DisallowReassignment<bool> work_stealing = {"work-stealing", false};
+  DisallowReassignment<int> bench_iterations = {"bench-iterations", 0};
+  DisallowReassignment<int> bench_warmup = {"bench-warmup", 0};
+  DisallowReassignment<int> bench_isolates = {"bench-isolates", 1};
+  DisallowReassignment<int> bench_threads = {"bench-threads", 0};
+  DisallowReassignment<const char*> bench_json = {"bench-json", nullptr};
   DisallowReassignment<bool> stress_delay_tasks = {"stress-delay-tasks", false};
   std::vector<const char*> arguments;
   DisallowReassignment<bool> include_arguments = {"arguments", true};
@@ -557,6 +563,9 @@ class Shell : public i::AllStatic {
                                                  const char* name);
   static MaybeLocal<Context> CreateEvaluationContext(Isolate* isolate);
   static int RunMain(Isolate* isolate, bool last_run);
+  // Runs the main source group repeatedly in fresh isolates and reports
+  // throughput, latencies and GC statistics (--bench-iterations).
+  static int RunBenchmark(Isolate* isolate);
   static int Main(int argc, char* argv[]);
   static void InitializeDefaultCounters(Isolate* isolate);
   static void Exit(int exit_code);
@@ -284,7 +284,7 @@ void DateCache::ExtendTheAfterSegment(int64_t time_ms, int offset_ms) {
 
 int DateCache::LocalOffsetInMs(int64_t time_ms, bool is_utc) {
   if (!is_utc) {
-    return GetLocalOffsetFromOS(time_ms, is_utc);
+    return LocalOffsetForLocalTimeInMs(time_ms);
   }
 #ifdef ENABLE_SLOW_DCHECKS
   int known_correct_result = 0;
@@ -409,6 +409,26 @@ int DateCache::LocalOffsetInMs(int64_t time_ms, bool is_utc) {
   UNREACHABLE();
 }
 
+int DateCache::LocalOffsetForLocalTimeInMs(int64_t time_ms) {
+  // Local times only have a unique offset away from offset transitions, so
+  // the UTC offset cache can answer for |time_ms| if the offset does not
+  // change within a day (more than any UTC offset) on either side of it.
+  // Both probes hit the cache when converting many nearby local times, e.g.
+  // when parsing timestamps from a log.
+  int offset_ms = LocalOffsetInMs(time_ms - kMsPerDay, true);
+  if (offset_ms == LocalOffsetInMs(time_ms + kMsPerDay, true) &&
+      before_->start_ms <= time_ms - kMsPerDay) {
+    // The second probe left before_ on the segment containing
+    // time_ms + kMsPerDay; it reaching back to the first probe means that
+    // the offset is constant in between.
+    DCHECK_LE(time_ms + kMsPerDay, before_->end_ms);
+    DCHECK_EQ(offset_ms, before_->offset_ms);
+    SLOW_DCHECK(offset_ms == GetLocalOffsetFromOS(time_ms, false));
+    return offset_ms;
+  }
+  return GetLocalOffsetFromOS(time_ms, false);
+}
+
 void DateCache::ProbeCache(int64_t time_ms) {
   CacheItem* before = nullptr;
   CacheItem* after = nullptr;
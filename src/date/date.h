@@ -194,6 +194,10 @@ class V8_EXPORT_PRIVATE DateCache {
     return GetDaylightSavingsOffsetFromOS(time_sec);
   }
 
+  // Computes the offset of the given local time, using the timezone offset
+  // cache when the local time is not close to an offset transition.
+  int LocalOffsetForLocalTimeInMs(int64_t time_ms);
+
   // Sets the before_ and the after_ segments from the timezone offset cache
   // such that the before_ segment starts earlier than the given time and the
   // after_ segment start later than the given time. Both segments might be
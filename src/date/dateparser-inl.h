@@ -16,6 +16,8 @@ namespace internal {
 
 template <typename Char>
 bool DateParser::Parse(Isolate* isolate, base::Vector<Char> str, double* out) {
+  if (TryParseISODateTime(str, out)) return true;
+
   InputReader<Char> in(str);
   DateStringTokenizer<Char> scanner(&in);
   TimeZoneComposer tz;
@@ -235,6 +237,73 @@ bool DateParser::InputReader<Char>::SkipParentheses() {
   return true;
 }
 
+template <typename Char>
+bool DateParser::TryParseISODateTime(base::Vector<Char> str, double* output) {
+  // Mirrors ParseES5DateTime for the subset of inputs it accepts; anything
+  // unusual (expanded years, lowercase separators, other fraction lengths,
+  // hhmm offsets, trailing text) is left to the general parser.
+  int year, month, day;
+  if (!ReadFixedDigits(str, 0, 4, &year) || str.length() < 10 ||
+      str[4] != '-' || !ReadFixedDigits(str, 5, 2, &month) || str[7] != '-' ||
+      !ReadFixedDigits(str, 8, 2, &day) || !DayComposer::IsMonth(month) ||
+      !DayComposer::IsDay(day)) {
+    return false;
+  }
+
+  int hour = 0, minute = 0, second = 0, millisecond = 0;
+  // Date-only forms are UTC, date-time forms without an offset are local.
+  double utc_offset = 0;
+  if (str.length() > 10) {
+    if (str[10] != 'T' || !ReadFixedDigits(str, 11, 2, &hour) ||
+        str.length() < 16 || str[13] != ':' ||
+        !ReadFixedDigits(str, 14, 2, &minute)) {
+      return false;
+    }
+    int pos = 16;
+    if (pos < str.length() && str[pos] == ':') {
+      if (!ReadFixedDigits(str, pos + 1, 2, &second)) return false;
+      pos += 3;
+      if (pos < str.length() && str[pos] == '.') {
+        if (!ReadFixedDigits(str, pos + 1, 3, &millisecond)) return false;
+        pos += 4;
+      }
+    }
+    if (!Between(hour, 0, 24) || !TimeComposer::IsMinute(minute) ||
+        !TimeComposer::IsSecond(second) ||
+        (hour == 24 && (minute != 0 || second != 0 || millisecond != 0))) {
+      return false;
+    }
+    utc_offset = std::numeric_limits<double>::quiet_NaN();
+    if (pos < str.length() && str[pos] == 'Z') {
+      utc_offset = 0;
+      pos++;
+    } else if (pos < str.length() && (str[pos] == '+' || str[pos] == '-')) {
+      int sign = str[pos] == '+' ? 1 : -1;
+      int offset_hour, offset_minute;
+      if (!ReadFixedDigits(str, pos + 1, 2, &offset_hour) ||
+          pos + 3 >= str.length() || str[pos + 3] != ':' ||
+          !ReadFixedDigits(str, pos + 4, 2, &offset_minute) ||
+          !TimeComposer::IsHour(offset_hour) ||
+          !TimeComposer::IsMinute(offset_minute)) {
+        return false;
+      }
+      utc_offset = sign * (offset_hour * 3600 + offset_minute * 60);
+      pos += 6;
+    }
+    if (pos != str.length()) return false;
+  }
+
+  output[YEAR] = year;
+  output[MONTH] = month - 1;  // 0-based
+  output[DAY] = day;
+  output[HOUR] = hour;
+  output[MINUTE] = minute;
+  output[SECOND] = second;
+  output[MILLISECOND] = millisecond;
+  output[UTC_OFFSET] = utc_offset;
+  return true;
+}
+
 template <typename Char>
 DateParser::DateToken DateParser::ParseES5DateTime(
     DateStringTokenizer<Char>* scanner, DayComposer* day, TimeComposer* time,
@@ -46,6 +46,20 @@ class DateParser : public AllStatic {
     return static_cast<unsigned>(x - lo) <= static_cast<unsigned>(hi - lo);
   }
 
+  // Reads exactly |count| decimal digits starting at |pos|.
+  template <typename Char>
+  static bool ReadFixedDigits(base::Vector<Char> str, int pos, int count,
+                              int* value) {
+    if (pos + count > str.length()) return false;
+    int result = 0;
+    for (int i = pos; i < pos + count; i++) {
+      if (!IsDecimalDigit(str[i])) return false;
+      result = result * 10 + (str[i] - '0');
+    }
+    *value = result;
+    return true;
+  }
+
   // Indicates a missing value.
   static const int kNone = kMaxInt;
 
@@ -351,6 +365,13 @@ class DateParser : public AllStatic {
     bool is_iso_date_;
   };
 
+  // Parses the common fixed-width forms of the Date Time String Format,
+  // YYYY-MM-DD and YYYY-MM-DDTHH:mm[:ss[.sss]][Z|(+|-)HH:mm], as produced by
+  // toISOString and most log formats, without tokenizing. Returns false if
+  // |str| has any other shape, in which case the general parser must be used.
+  template <typename Char>
+  static bool TryParseISODateTime(base::Vector<Char> str, double* output);
+
   // Tries to parse an ES5 Date Time String. Returns the next token
   // to continue with in the legacy date string parser. If parsing is
   // complete, returns DateToken::EndOfInput(). If terminally unsuccessful,
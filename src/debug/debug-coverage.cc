@@ -5,6 +5,7 @@
 #include "src/debug/debug-coverage.h"
 
 #include "src/ast/ast-source-ranges.h"
+#include "src/base/hashing.h"
 #include "src/base/hashmap.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
@@ -61,6 +62,12 @@ int StartPosition(Tagged<SharedFunctionInfo> info) {
   return start;
 }
 
+// Identifies a function for sampled coverage across re-parses.
+uint64_t SampledCoverageKey(Tagged<SharedFunctionInfo> info) {
+  return base::Hasher{}.Combine(Cast<Script>(info->script())->id(),
+                                StartPosition(info), info->EndPosition());
+}
+
 bool CompareCoverageBlock(const CoverageBlock& a, const CoverageBlock& b) {
   DCHECK_NE(kNoSourcePosition, a.start);
   DCHECK_NE(kNoSourcePosition, b.start);
@@ -622,6 +629,29 @@ std::unique_ptr<Coverage> Coverage::CollectBestEffort(Isolate* isolate) {
   return Collect(isolate, v8::debug::CoverageMode::kBestEffort);
 }
 
+std::unique_ptr<Coverage> Coverage::CollectSampled(Isolate* isolate) {
+  DCHECK(isolate->is_best_effort_code_coverage());
+  SampleFunctions(isolate);
+  return Collect(isolate, v8::debug::CoverageMode::kBestEffort, true);
+}
+
+void Coverage::SampleFunctions(Isolate* isolate) {
+  // Unsupported if jitless mode is enabled at build-time since related
+  // optimizations deactivate invocation count updates.
+  CHECK(!V8_JITLESS_BOOL);
+  DCHECK(isolate->is_best_effort_code_coverage());
+
+  SharedToCounterMap counter_map;
+  CollectAndMaybeResetCounts(isolate, &counter_map,
+                             v8::debug::CoverageMode::kBestEffort);
+  std::unordered_set<uint64_t>* sampled = isolate->debug()->sampled_coverage();
+  for (SharedToCounterMap::Entry* entry = counter_map.Start(); entry != nullptr;
+       entry = counter_map.Next(entry)) {
+    if (entry->value == 0 || !IsScript(entry->key->script())) continue;
+    sampled->insert(SampledCoverageKey(entry->key));
+  }
+}
+
 #ifdef V8_ENABLE_WEBASSEMBLY
 
 std::unique_ptr<Coverage> Coverage::CollectWasmData(Isolate* isolate) {
@@ -701,7 +731,8 @@ std::unique_ptr<Coverage> Coverage::CollectWasmData(Isolate* isolate) {
 #endif  // V8_ENABLE_WEBASSEMBLY
 
 std::unique_ptr<Coverage> Coverage::Collect(
-    Isolate* isolate, v8::debug::CoverageMode collection_mode) {
+    Isolate* isolate, v8::debug::CoverageMode collection_mode,
+    bool include_sampled) {
   // Unsupported if jitless mode is enabled at build-time since related
   // optimizations deactivate invocation count updates.
   CHECK(!V8_JITLESS_BOOL);
@@ -731,9 +762,16 @@ std::unique_ptr<Coverage> Coverage::Collect(
     {
       // Sort functions by start position, from outer to inner functions.
       SharedFunctionInfo::ScriptIterator infos(isolate, *script);
+      const std::unordered_set<uint64_t>* sampled =
+          isolate->debug()->sampled_coverage();
       for (Tagged<SharedFunctionInfo> info = infos.Next(); !info.is_null();
            info = infos.Next()) {
-        sorted.emplace_back(handle(info, isolate), counter_map.Get(info));
+        uint32_t count = counter_map.Get(info);
+        if (include_sampled && count == 0 &&
+            sampled->find(SampledCoverageKey(info)) != sampled->end()) {
+          count = 1;
+        }
+        sorted.emplace_back(handle(info, isolate), count);
       }
       std::sort(sorted.begin(), sorted.end());
     }
@@ -61,6 +61,16 @@ class Coverage : public std::vector<CoverageScript> {
   // Collecting best effort coverage always works, but may be imprecise
   // depending on selected mode. The invocation count is not reset.
   static std::unique_ptr<Coverage> CollectBestEffort(Isolate* isolate);
+  // Sampled coverage is best effort coverage that also reports functions seen
+  // executed by any earlier SampleFunctions() call, even if all their closures
+  // have been collected since. It neither instruments bytecode nor
+  // deoptimizes, so it can be used in production to find dead code. Counts
+  // are 0 or 1. Only works in best effort mode.
+  static std::unique_ptr<Coverage> CollectSampled(Isolate* isolate);
+  // Records which functions have been executed so far, from the invocation
+  // counters in feedback vectors. Meant to be called periodically, e.g. from
+  // an idle task; each call iterates the heap.
+  V8_EXPORT_PRIVATE static void SampleFunctions(Isolate* isolate);
 
 #if V8_ENABLE_WEBASSEMBLY
   static std::unique_ptr<Coverage> CollectWasmData(Isolate* isolate);
@@ -72,7 +82,8 @@ class Coverage : public std::vector<CoverageScript> {
 
  private:
   static std::unique_ptr<Coverage> Collect(
-      Isolate* isolate, v8::debug::CoverageMode collectionMode);
+      Isolate* isolate, v8::debug::CoverageMode collectionMode,
+      bool include_sampled = false);
 
   Coverage() = default;
 };
@@ -376,6 +376,8 @@ bool DebugEvaluate::IsSideEffectFreeIntrinsic(Runtime::FunctionId id) {
   V(StringAdd)                           \
   V(StringCharCodeAt)                    \
   V(StringEqual)                         \
+  V(StringIndexOf)                       \
+  V(StringIsSubstringAt)                 \
   V(StringParseFloat)                    \
   V(StringParseInt)                      \
   V(SymbolDescriptiveString)             \
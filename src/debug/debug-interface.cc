@@ -1388,6 +1388,15 @@ Coverage Coverage::CollectBestEffort(Isolate* isolate) {
       i::Coverage::CollectBestEffort(reinterpret_cast<i::Isolate*>(isolate)));
 }
 
+Coverage Coverage::CollectSampled(Isolate* isolate) {
+  return Coverage(
+      i::Coverage::CollectSampled(reinterpret_cast<i::Isolate*>(isolate)));
+}
+
+void Coverage::SampleFunctions(Isolate* isolate) {
+  i::Coverage::SampleFunctions(reinterpret_cast<i::Isolate*>(isolate));
+}
+
 #if V8_ENABLE_WEBASSEMBLY
 Coverage Coverage::CollectWasmData(Isolate* isolate) {
   return Coverage(
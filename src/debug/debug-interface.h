@@ -460,6 +460,9 @@ class V8_EXPORT_PRIVATE Coverage {
 
   static Coverage CollectPrecise(Isolate* isolate);
   static Coverage CollectBestEffort(Isolate* isolate);
+  // Production-friendly function coverage, see i::Coverage::CollectSampled.
+  static Coverage CollectSampled(Isolate* isolate);
+  static void SampleFunctions(Isolate* isolate);
 
 #if V8_ENABLE_WEBASSEMBLY
   static Coverage CollectWasmData(Isolate* isolate);
@@ -8,6 +8,7 @@
 #include <memory>
 #include <optional>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "src/base/enum-set.h"
@@ -357,6 +358,11 @@ class V8_EXPORT_PRIVATE Debug {
                            DirectHandle<CoverageInfo> coverage_info);
   void RemoveAllCoverageInfos();
 
+  // Functions that Coverage::SampleFunctions() has seen executed.
+  std::unordered_set<uint64_t>* sampled_coverage() {
+    return &sampled_coverage_;
+  }
+
   // This function is used in FunctionNameUsing* tests.
   Handle<Object> FindInnermostContainingFunctionInfo(Handle<Script> script,
                                                      int position);
@@ -716,6 +722,10 @@ class V8_EXPORT_PRIVATE Debug {
   IndirectHandle<FunctionTemplateInfo>
       ignore_side_effects_for_function_template_info_;
 
+  // Keyed by source range rather than by SharedFunctionInfo, so that entries
+  // survive the functions being collected.
+  std::unordered_set<uint64_t> sampled_coverage_;
+
   Isolate* isolate_;
 
   // The isolate id is set by the inspector via an embedder provided RNG
@@ -7,6 +7,7 @@
 #include <optional>
 
 #include "src/base/memory.h"
+#include "src/codegen/compilation-timeline.h"
 #include "src/codegen/interface-descriptors-inl.h"
 #include "src/codegen/register-configuration.h"
 #include "src/codegen/reloc-info.h"
@@ -695,6 +696,9 @@ Deoptimizer::Deoptimizer(Isolate* isolate, Tagged<JSFunction> function,
     PROFILE(isolate_, CodeDeoptEvent(direct_handle(compiled_code_, isolate_),
                                      kind, from_, fp_to_sp_delta_));
   }
+  CompilationTimeline::Deoptimized(isolate_, function->shared(),
+                                   compiled_code_->kind(), kind,
+                                   GetDeoptInfo().deopt_reason);
   unsigned size = ComputeInputFrameSize();
   const int parameter_count = compiled_code_->parameter_count();
   DCHECK_EQ(
@@ -3003,6 +3007,8 @@ void Deoptimizer::DoComputeBuiltinContinuation(
 }
 
 void Deoptimizer::MaterializeHeapObjects() {
+  TimedHistogramScope timer(
+      isolate_->counters()->deopt_materialize_heap_objects());
   translated_state_.Prepare(static_cast<Address>(stack_fp_));
   if (v8_flags.deopt_every_n_times > 0) {
     // Doing a GC here will find problems with the deoptimized frames.
@@ -3038,6 +3044,13 @@ void Deoptimizer::MaterializeHeapObjects() {
 
   translated_state_.VerifyMaterializedObjects();
 
+  if (verbose_tracing_enabled()) {
+    PrintF(trace_scope()->file(),
+           "Materialized %zu values and %zu feedback vectors\n",
+           values_to_materialize_.size(),
+           feedback_vector_to_materialize_.size());
+  }
+
   isolate_->materialized_object_store()->Remove(
       static_cast<Address>(stack_fp_));
 }
@@ -4,9 +4,12 @@
 
 #include "src/execution/futex-emulation.h"
 
+#include <array>
 #include <limits>
+#include <unordered_map>
 
 #include "src/api/api-inl.h"
+#include "src/base/hashing.h"
 #include "src/base/lazy-instance.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
@@ -23,7 +26,9 @@
 namespace v8::internal {
 
 // A {FutexWaitList} manages all contexts waiting (synchronously or
-// asynchronously) on any address.
+// asynchronously) on the addresses which hash to it. The wait lists are
+// sharded by address (see {FutexEmulationGlobalState}), so that waits and
+// wakes on unrelated addresses do not contend on a single mutex.
 class FutexWaitList {
  public:
   FutexWaitList() = default;
@@ -82,19 +87,21 @@ class FutexWaitList {
 
   // For checking the internal consistency of the FutexWaitList.
   void Verify() const;
+  // Checks the links of the list from |head| to |tail|.
+  static void VerifyList(FutexWaitListNode* head, FutexWaitListNode* tail);
   // Returns true if |node| is on the linked list starting with |head|.
   static bool NodeIsOnList(FutexWaitListNode* node, FutexWaitListNode* head);
 
   base::Mutex* mutex() { return &mutex_; }
 
- private:
-  friend class FutexEmulation;
-
   struct HeadAndTail {
     FutexWaitListNode* head;
     FutexWaitListNode* tail;
   };
 
+ private:
+  friend class FutexEmulation;
+
   // `mutex` protects the composition of the fields below (i.e. no elements may
   // be added or removed without holding this mutex), as well as the `waiting_`
   // and `interrupted_` fields for each individual list node that is currently
@@ -107,17 +114,53 @@ class FutexWaitList {
   // As long as the map does not grow beyond 16 entries, there is no dynamic
   // allocation and deallocation happening in wait or wake, which reduces the
   // time spend in the critical section.
-  base::SmallMap<std::map<void*, HeadAndTail>, 16> location_lists_;
+  base::SmallMap<std::unordered_map<void*, HeadAndTail>, 16> location_lists_;
+};
+
+// The wait lists of all addresses, and the async waiters which have been
+// woken and wait for their Promises to be resolved.
+class FutexEmulationGlobalState {
+ public:
+  static constexpr size_t kNumWaitLists = 64;
+
+  FutexWaitList* WaitListFor(void* wait_location) {
+    size_t hash = base::hash_value(reinterpret_cast<uintptr_t>(wait_location));
+    return &wait_lists_[hash % kNumWaitLists];
+  }
+
+  std::array<FutexWaitList, kNumWaitLists>& wait_lists() { return wait_lists_; }
+
+  base::Mutex* promises_to_resolve_mutex() {
+    return &promises_to_resolve_mutex_;
+  }
+
+  // For checking the internal consistency of the Promise lists.
+  void VerifyPromisesToResolve() const;
+
+ private:
+  friend class FutexEmulation;
+
+  std::array<FutexWaitList, kNumWaitLists> wait_lists_;
+
+  // Protects the map below and the links of the nodes on its lists. A node
+  // moves from a wait list to these lists while holding both its wait list's
+  // mutex and this one, which is always acquired second.
+  base::Mutex promises_to_resolve_mutex_;
 
   // Isolate* -> linked list of Nodes which are waiting for their Promises to
-  // be resolved.
-  base::SmallMap<std::map<Isolate*, HeadAndTail>> isolate_promises_to_resolve_;
+  // be resolved. All Promises of an Isolate are resolved by one task.
+  base::SmallMap<std::map<Isolate*, FutexWaitList::HeadAndTail>>
+      isolate_promises_to_resolve_;
 };
 
 namespace {
 
-// {GetWaitList} returns the lazily initialized global wait list.
-DEFINE_LAZY_LEAKY_OBJECT_GETTER(FutexWaitList, GetWaitList)
+// {GetGlobalState} returns the lazily initialized global futex state.
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(FutexEmulationGlobalState, GetGlobalState)
+
+FutexWaitList* GetWaitList(void* wait_location) {
+  return GetGlobalState()->WaitListFor(wait_location);
+}
 
 }  // namespace
 
@@ -136,17 +179,24 @@ bool FutexWaitListNode::CancelTimeoutTask() {
 
 void FutexWaitListNode::NotifyWake() {
   DCHECK(!IsAsync());
-  // Lock the FutexEmulation mutex before notifying. We know that the mutex
+  // Lock the wait list mutexes before notifying. We know that the mutex
   // will have been unlocked if we are currently waiting on the condition
   // variable. The mutex will not be locked if FutexEmulation::Wait hasn't
   // locked it yet. In that case, we set the interrupted_
   // flag to true, which will be tested after the mutex locked by a future wait.
-  FutexWaitList* wait_list = GetWaitList();
-  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+  // The waiting thread may pick its wait list at any time, so all of them are
+  // locked; interrupts are rare compared to waits and wakes.
+  DisallowGarbageCollection no_gc;
+  auto& wait_lists = GetGlobalState()->wait_lists();
+  for (FutexWaitList& wait_list : wait_lists) wait_list.mutex()->Lock();
 
   // if not waiting, this will not have any effect.
   cond_.NotifyOne();
   interrupted_ = true;
+
+  for (auto it = wait_lists.rbegin(); it != wait_lists.rend(); ++it) {
+    it->mutex()->Unlock();
+  }
 }
 
 class ResolveAsyncWaiterPromisesTask : public CancelableTask {
@@ -180,7 +230,7 @@ void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
   DCHECK(node->IsAsync());
   // This function can run in any thread.
 
-  FutexWaitList* wait_list = GetWaitList();
+  FutexWaitList* wait_list = GetWaitList(node->wait_location_);
   wait_list->mutex()->AssertHeld();
 
   // Nullify the timeout time; this distinguishes timed out waiters from
@@ -192,7 +242,9 @@ void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
   // Schedule a task for resolving the Promise. It's still possible that the
   // timeout task runs before the promise resolving task. In that case, the
   // timeout task will just ignore the node.
-  auto& isolate_map = wait_list->isolate_promises_to_resolve_;
+  FutexEmulationGlobalState* global_state = GetGlobalState();
+  base::MutexGuard promises_guard(global_state->promises_to_resolve_mutex());
+  auto& isolate_map = global_state->isolate_promises_to_resolve_;
   auto it = isolate_map.find(node->async_state_->isolate_for_async_waiters);
   if (it == isolate_map.end()) {
     // This Isolate doesn't have other Promises to resolve at the moment.
@@ -366,9 +418,9 @@ Tagged<Object> FutexEmulation::WaitSync(
 
   DirectHandle<Object> result;
 
-  FutexWaitList* wait_list = GetWaitList();
   FutexWaitListNode* node = isolate->futex_wait_list_node();
   void* wait_location = FutexWaitList::ToWaitLocation(*array_buffer, addr);
+  FutexWaitList* wait_list = GetWaitList(wait_location);
 
   base::TimeTicks timeout_time;
   if (use_timeout) {
@@ -517,7 +569,7 @@ Tagged<Object> FutexEmulation::WaitAsync(
   // Get a weak pointer to the backing store, to be stored in the async state of
   // the node.
   std::weak_ptr<BackingStore> backing_store{array_buffer->GetBackingStore()};
-  FutexWaitList* wait_list = GetWaitList();
+  FutexWaitList* wait_list = GetWaitList(wait_location);
   {
     // 16. Perform EnterCriticalSection(WL).
     NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
@@ -633,7 +685,7 @@ int FutexEmulation::Wake(Tagged<JSArrayBuffer> array_buffer, size_t addr,
 
 int FutexEmulation::Wake(void* wait_location, uint32_t num_waiters_to_wake) {
   int num_waiters_woken = 0;
-  FutexWaitList* wait_list = GetWaitList();
+  FutexWaitList* wait_list = GetWaitList(wait_location);
   NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
 
   auto& location_lists = wait_list->location_lists_;
@@ -727,8 +779,8 @@ int FutexEmulation::Wake(void* wait_location, uint32_t num_waiters_to_wake) {
 void FutexEmulation::CleanupAsyncWaiterPromise(FutexWaitListNode* node) {
   DCHECK(node->IsAsync());
   // This function must run in the main thread of node's Isolate. This function
-  // may allocate memory. To avoid deadlocks, we shouldn't be holding the
-  // FutexEmulationGlobalState::mutex.
+  // may allocate memory. To avoid deadlocks, we shouldn't be holding any
+  // FutexWaitList mutex.
 
   Isolate* isolate = node->async_state_->isolate_for_async_waiters;
   auto v8_isolate = reinterpret_cast<v8::Isolate*>(isolate);
@@ -801,12 +853,13 @@ void FutexEmulation::ResolveAsyncWaiterPromise(FutexWaitListNode* node) {
 void FutexEmulation::ResolveAsyncWaiterPromises(Isolate* isolate) {
   // This function must run in the main thread of isolate.
 
-  FutexWaitList* wait_list = GetWaitList();
+  FutexEmulationGlobalState* global_state = GetGlobalState();
   FutexWaitListNode* node;
   {
-    NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+    NoGarbageCollectionMutexGuard lock_guard(
+        global_state->promises_to_resolve_mutex());
 
-    auto& isolate_map = wait_list->isolate_promises_to_resolve_;
+    auto& isolate_map = global_state->isolate_promises_to_resolve_;
     auto it = isolate_map.find(isolate);
     DCHECK_NE(isolate_map.end(), it);
 
@@ -838,7 +891,7 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
   // This function must run in the main thread of node's Isolate.
   DCHECK(node->IsAsync());
 
-  FutexWaitList* wait_list = GetWaitList();
+  FutexWaitList* wait_list = GetWaitList(node->wait_location_);
 
   {
     NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
@@ -862,15 +915,15 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
 }
 
 void FutexEmulation::IsolateDeinit(Isolate* isolate) {
-  FutexWaitList* wait_list = GetWaitList();
-  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+  FutexEmulationGlobalState* global_state = GetGlobalState();
 
   // Iterate all locations to find nodes belonging to "isolate" and delete them.
   // The Isolate is going away; don't bother cleaning up the Promises in the
   // NativeContext. Also we don't need to cancel the timeout tasks, since they
   // will be cancelled by Isolate::Deinit.
-  {
-    auto& location_lists = wait_list->location_lists_;
+  for (FutexWaitList& wait_list : global_state->wait_lists()) {
+    NoGarbageCollectionMutexGuard lock_guard(wait_list.mutex());
+    auto& location_lists = wait_list.location_lists_;
     auto it = location_lists.begin();
     while (it != location_lists.end()) {
       FutexWaitListNode*& head = it->second.head;
@@ -884,10 +937,15 @@ void FutexEmulation::IsolateDeinit(Isolate* isolate) {
         ++it;
       }
     }
+    wait_list.Verify();
   }
 
+  // Nodes are only moved to the Promise lists from the wait lists, so once
+  // the wait lists are clean, no more nodes of "isolate" can show up here.
   {
-    auto& isolate_map = wait_list->isolate_promises_to_resolve_;
+    NoGarbageCollectionMutexGuard lock_guard(
+        global_state->promises_to_resolve_mutex());
+    auto& isolate_map = global_state->isolate_promises_to_resolve_;
     auto it = isolate_map.find(isolate);
     if (it != isolate_map.end()) {
       for (FutexWaitListNode* node = it->second.head; node;) {
@@ -899,15 +957,14 @@ void FutexEmulation::IsolateDeinit(Isolate* isolate) {
       }
       isolate_map.erase(it);
     }
+    global_state->VerifyPromisesToResolve();
   }
-
-  wait_list->Verify();
 }
 
 int FutexEmulation::NumWaitersForTesting(Tagged<JSArrayBuffer> array_buffer,
                                          size_t addr) {
   void* wait_location = FutexWaitList::ToWaitLocation(*array_buffer, addr);
-  FutexWaitList* wait_list = GetWaitList();
+  FutexWaitList* wait_list = GetWaitList(wait_location);
   NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
 
   int num_waiters = 0;
@@ -931,11 +988,12 @@ int FutexEmulation::NumWaitersForTesting(Tagged<JSArrayBuffer> array_buffer,
 int FutexEmulation::NumUnresolvedAsyncPromisesForTesting(
     Tagged<JSArrayBuffer> array_buffer, size_t addr) {
   void* wait_location = FutexWaitList::ToWaitLocation(array_buffer, addr);
-  FutexWaitList* wait_list = GetWaitList();
-  NoGarbageCollectionMutexGuard lock_guard(wait_list->mutex());
+  FutexEmulationGlobalState* global_state = GetGlobalState();
+  NoGarbageCollectionMutexGuard lock_guard(
+      global_state->promises_to_resolve_mutex());
 
   int num_waiters = 0;
-  auto& isolate_map = wait_list->isolate_promises_to_resolve_;
+  auto& isolate_map = global_state->isolate_promises_to_resolve_;
   for (const auto& it : isolate_map) {
     for (FutexWaitListNode* node = it.second.head; node; node = node->next_) {
       DCHECK(node->IsAsync());
@@ -953,8 +1011,30 @@ int FutexEmulation::NumUnresolvedAsyncPromisesForTesting(
 
 void FutexWaitList::Verify() const {
 #ifdef DEBUG
-  auto VerifyNode = [](FutexWaitListNode* node, FutexWaitListNode* head,
-                       FutexWaitListNode* tail) {
+  for (const auto& [addr, head_and_tail] : location_lists_) {
+    VerifyList(head_and_tail.head, head_and_tail.tail);
+  }
+#endif  // DEBUG
+}
+
+void FutexEmulationGlobalState::VerifyPromisesToResolve() const {
+#ifdef DEBUG
+  for (const auto& [isolate, head_and_tail] : isolate_promises_to_resolve_) {
+    auto [head, tail] = head_and_tail;
+    FutexWaitList::VerifyList(head, tail);
+    for (FutexWaitListNode* node = head; node; node = node->next_) {
+      DCHECK(node->IsAsync());
+      DCHECK_EQ(isolate, node->async_state_->isolate_for_async_waiters);
+    }
+  }
+#endif  // DEBUG
+}
+
+// static
+void FutexWaitList::VerifyList(FutexWaitListNode* head,
+                               FutexWaitListNode* tail) {
+#ifdef DEBUG
+  for (FutexWaitListNode* node = head; node; node = node->next_) {
     if (node->next_ != nullptr) {
       DCHECK_NE(node, tail);
       DCHECK_EQ(node, node->next_->prev_);
@@ -969,22 +1049,6 @@ void FutexWaitList::Verify() const {
     }
 
     DCHECK(NodeIsOnList(node, head));
-  };
-
-  for (const auto& [addr, head_and_tail] : location_lists_) {
-    auto [head, tail] = head_and_tail;
-    for (FutexWaitListNode* node = head; node; node = node->next_) {
-      VerifyNode(node, head, tail);
-    }
-  }
-
-  for (const auto& [isolate, head_and_tail] : isolate_promises_to_resolve_) {
-    auto [head, tail] = head_and_tail;
-    for (FutexWaitListNode* node = head; node; node = node->next_) {
-      DCHECK(node->IsAsync());
-      VerifyNode(node, head, tail);
-      DCHECK_EQ(isolate, node->async_state_->isolate_for_async_waiters);
-    }
   }
 #endif  // DEBUG
 }
@@ -34,6 +34,7 @@ class TimeDelta;
 namespace internal {
 
 class BackingStore;
+class FutexEmulationGlobalState;
 class FutexWaitList;
 
 class Isolate;
@@ -64,6 +65,7 @@ class FutexWaitListNode {
 
  private:
   friend class FutexEmulation;
+  friend class FutexEmulationGlobalState;
   friend class FutexWaitList;
 
   // Async wait requires substantially more information than synchronous wait.
@@ -114,7 +116,9 @@ class FutexWaitListNode {
   };
 
   base::ConditionVariable cond_;
-  // prev_ and next_ are protected by FutexEmulationGlobalState::mutex.
+  // prev_ and next_ are protected by the mutex of the list the node is on:
+  // the FutexWaitList of wait_location_, or the Promise lists of
+  // FutexEmulationGlobalState.
   FutexWaitListNode* prev_ = nullptr;
   FutexWaitListNode* next_ = nullptr;
 
@@ -126,9 +130,8 @@ class FutexWaitListNode {
   // this node is alive.
   void* wait_location_ = nullptr;
 
-  // waiting_ and interrupted_ are protected by FutexEmulationGlobalState::mutex
-  // if this node is currently contained in
-  // FutexEmulationGlobalState::wait_list.
+  // waiting_ and interrupted_ are protected by the mutex of the FutexWaitList
+  // of wait_location_ if this node is currently contained in that list.
   bool waiting_ = false;
   bool interrupted_ = false;
 
@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cinttypes>
 #include <cstdint>
@@ -19,6 +20,7 @@
 #include <utility>
 
 #include "include/v8-callbacks.h"
+#include "include/v8-platform.h"
 #include "include/v8-template.h"
 #include "src/api/api-arguments-inl.h"
 #include "src/api/api-inl.h"
@@ -4668,6 +4670,8 @@ void Isolate::Deinit() {
   }
 #endif
 
+  if (tiering_manager_ != nullptr) tiering_manager_->WriteProfileIfNeeded();
+
   // We start with the heap tear down so that releasing managed objects does
   // not cause a GC.
   heap_.StartTearDown();
@@ -5581,7 +5585,49 @@ class BigIntPlatform : public bigint::Platform {
             isolate_->stack_guard()->HasTerminationRequest());
   }
 
+  uint32_t MaxConcurrency() override {
+    if (!v8_flags.bigint_parallel_multiplication ||
+        v8_flags.single_threaded) {
+      return 1;
+    }
+    return static_cast<uint32_t>(
+        V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1);
+  }
+
+  void RunInParallel(ParallelTask* task, uint32_t count) override {
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking,
+                    std::make_unique<BigIntJob>(task, count))
+        ->Join();
+  }
+
  private:
+  // Hands out the indices of a bigint::Platform::ParallelTask to the job's
+  // workers. The joining thread takes part, so it also runs some of them.
+  class BigIntJob final : public JobTask {
+   public:
+    BigIntJob(ParallelTask* task, uint32_t count)
+        : task_(task), count_(count) {}
+
+    void Run(JobDelegate* delegate) override {
+      do {
+        uint32_t index = next_index_.fetch_add(1, std::memory_order_relaxed);
+        if (index >= count_) return;
+        task_->Run(index);
+      } while (!delegate->ShouldYield());
+    }
+
+    size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+      uint32_t next_index = next_index_.load(std::memory_order_relaxed);
+      return count_ - std::min(next_index, count_);
+    }
+
+   private:
+    ParallelTask* const task_;
+    const uint32_t count_;
+    std::atomic<uint32_t> next_index_{0};
+  };
+
   Isolate* isolate_;
 };
 }  // namespace
@@ -7654,21 +7700,32 @@ void Isolate::ResetDefaultLocale() {
 
 icu::UMemory* Isolate::get_cached_icu_object(ICUObjectCacheType cache_type,
                                              DirectHandle<Object> locales) {
-  const ICUObjectCacheEntry& entry =
-      icu_object_cache_[static_cast<int>(cache_type)];
-  return StringEqualsLocales(this, entry.locales, locales) ? entry.obj.get()
-                                                           : nullptr;
+  ICUObjectCacheEntry* entries = icu_object_cache_[static_cast<int>(cache_type)];
+  for (int i = 0; i < kICUObjectCacheEntriesPerType; i++) {
+    if (!entries[i].obj) break;
+    if (!StringEqualsLocales(this, entries[i].locales, locales)) continue;
+    // Move the hit to the front.
+    std::rotate(entries, entries + i, entries + i + 1);
+    return entries[0].obj.get();
+  }
+  return nullptr;
 }
 
 void Isolate::set_icu_object_in_cache(ICUObjectCacheType cache_type,
                                       DirectHandle<Object> locales,
                                       std::shared_ptr<icu::UMemory> obj) {
-  icu_object_cache_[static_cast<int>(cache_type)] = {
-      GetStringFromLocales(this, locales), std::move(obj)};
+  ICUObjectCacheEntry* entries = icu_object_cache_[static_cast<int>(cache_type)];
+  // Evict the least recently used entry.
+  std::move_backward(entries, entries + kICUObjectCacheEntriesPerType - 1,
+                     entries + kICUObjectCacheEntriesPerType);
+  entries[0] = {GetStringFromLocales(this, locales), std::move(obj)};
 }
 
 void Isolate::clear_cached_icu_object(ICUObjectCacheType cache_type) {
-  icu_object_cache_[static_cast<int>(cache_type)] = ICUObjectCacheEntry{};
+  for (ICUObjectCacheEntry& entry :
+       icu_object_cache_[static_cast<int>(cache_type)]) {
+    entry = ICUObjectCacheEntry{};
+  }
 }
 
 void Isolate::clear_cached_icu_objects() {
@@ -7849,6 +7906,14 @@ v8::metrics::Recorder::ContextId Isolate::GetOrRegisterRecorderContextId(
   }
 }
 
+v8::metrics::Recorder::ContextId Isolate::GetRecorderContextIdNoRegister(
+    Tagged<NativeContext> context) {
+  Tagged<Object> id = context->recorder_context_id();
+  if (!IsSmi(id)) return v8::metrics::Recorder::ContextId::Empty();
+  return v8::metrics::Recorder::ContextId(
+      static_cast<uintptr_t>(Smi::ToInt(id)));
+}
+
 MaybeLocal<v8::Context> Isolate::GetContextFromRecorderContextId(
     v8::metrics::Recorder::ContextId id) {
   auto result = recorder_context_id_map_.find(id.id_);
@@ -87,6 +87,7 @@ class V8Inspector;
 namespace v8 {
 
 class EmbedderState;
+class PersistentCompilationCache;
 
 namespace base {
 class RandomNumberGenerator;
@@ -496,6 +497,7 @@ using DebugObjectCache = std::vector<Handle<HeapObject>>;
   V(LogEventCallback, event_logger, nullptr)                                \
   V(ModifyCodeGenerationFromStringsCallback2, modify_code_gen_callback,     \
     nullptr)                                                                \
+  V(v8::PersistentCompilationCache*, persistent_compilation_cache, nullptr) \
   V(AllowWasmCodeGenerationCallback, allow_wasm_code_gen_callback, nullptr) \
   V(ExtensionCallback, wasm_module_callback, &NoExtension)                  \
   V(ExtensionCallback, wasm_instance_callback, &NoExtension)                \
@@ -524,6 +526,7 @@ using DebugObjectCache = std::vector<Handle<HeapObject>>;
   V(int, code_and_metadata_size, 0)                                         \
   V(int, bytecode_and_metadata_size, 0)                                     \
   V(int, external_script_source_size, 0)                                    \
+  V(int, feedback_vector_size, 0)                                           \
   /* Number of CPU profilers running on the isolate. */                     \
   V(size_t, num_cpu_profilers, 0)                                           \
   /* true if a trace is being formatted through Error.prepareStackTrace. */ \
@@ -2185,6 +2188,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
       DirectHandle<NativeContext> context);
   MaybeLocal<v8::Context> GetContextFromRecorderContextId(
       v8::metrics::Recorder::ContextId id);
+  // Returns the id of |context| if it was registered through
+  // GetOrRegisterRecorderContextId() and the empty id otherwise. Does not
+  // allocate and can be used during GC.
+  v8::metrics::Recorder::ContextId GetRecorderContextIdNoRegister(
+      Tagged<NativeContext> context);
 
   void UpdateLongTaskStats();
   v8::metrics::LongTaskStats* GetCurrentLongTaskStats();
@@ -2653,8 +2661,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 #ifdef V8_INTL_SUPPORT
   std::string default_locale_;
 
-  // The cache stores the most recently accessed {locales,obj} pair for each
-  // cache type.
+  // The cache stores the most recently accessed {locales,obj} pairs for each
+  // cache type, most recently used first, so that code formatting for a few
+  // locales in turn does not keep recreating ICU objects.
+  static constexpr int kICUObjectCacheEntriesPerType = 8;
   struct ICUObjectCacheEntry {
     std::string locales;
     std::shared_ptr<icu::UMemory> obj;
@@ -2664,7 +2674,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
         : locales(locales), obj(std::move(obj)) {}
   };
 
-  ICUObjectCacheEntry icu_object_cache_[kICUObjectCacheTypeCount];
+  ICUObjectCacheEntry icu_object_cache_[kICUObjectCacheTypeCount]
+                                       [kICUObjectCacheEntriesPerType];
 #endif  // V8_INTL_SUPPORT
 
   // Whether the isolate has been created for snapshotting.
@@ -165,6 +165,8 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
                  !isolate->is_execution_terminating());
 
   intptr_t base_count = finished_microtask_count_;
+  max_pending_microtask_count_ =
+      std::max(max_pending_microtask_count_, static_cast<size_t>(size()));
   HandleScope handle_scope(isolate);
   MaybeDirectHandle<Object> maybe_result;
 
@@ -189,6 +191,10 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
     TRACE_EVENT_END1("v8.execute", "RunMicrotasks", "microtask_count",
                      processed_microtask_count);
   }
+  checkpoint_count_++;
+  max_microtasks_per_checkpoint_ =
+      std::max(max_microtasks_per_checkpoint_,
+               static_cast<size_t>(processed_microtask_count));
 
 #ifdef V8_ENABLE_CONTINUATION_PRESERVED_EMBEDDER_DATA
   isolate->isolate_data()->set_continuation_preserved_embedder_data(
@@ -214,6 +220,17 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
   return processed_microtask_count;
 }
 
+v8::MicrotaskQueue::Statistics MicrotaskQueue::GetStatistics() const {
+  Statistics statistics;
+  statistics.pending_microtask_count = static_cast<size_t>(size_);
+  statistics.max_pending_microtask_count = max_pending_microtask_count_;
+  statistics.finished_microtask_count =
+      static_cast<size_t>(finished_microtask_count_);
+  statistics.checkpoint_count = checkpoint_count_;
+  statistics.max_microtasks_per_checkpoint = max_microtasks_per_checkpoint_;
+  return statistics;
+}
+
 void MicrotaskQueue::IterateMicrotasks(RootVisitor* visitor) {
   if (size_) {
     // Iterate pending Microtasks as root objects to avoid the write barrier for
@@ -74,6 +74,7 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   void IncrementMicrotasksScopeDepth() { ++microtasks_depth_; }
   void DecrementMicrotasksScopeDepth() { --microtasks_depth_; }
   int GetMicrotasksScopeDepth() const override { return microtasks_depth_; }
+  Statistics GetStatistics() const override;
 
   // Possibly nested microtasks suppression scopes prevent microtasks
   // from running.
@@ -134,6 +135,11 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   // The number of finished microtask.
   intptr_t finished_microtask_count_ = 0;
 
+  // Statistics for GetStatistics(), updated once per RunMicrotasks().
+  size_t max_pending_microtask_count_ = 0;
+  size_t checkpoint_count_ = 0;
+  size_t max_microtasks_per_checkpoint_ = 0;
+
   // MicrotaskQueue instances form a doubly linked list loop, so that all
   // instances are reachable through |next_|.
   MicrotaskQueue* next_ = nullptr;
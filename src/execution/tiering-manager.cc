@@ -6,6 +6,7 @@
 
 #include <optional>
 
+#include "src/base/hashing.h"
 #include "src/base/platform/platform.h"
 #include "src/baseline/baseline.h"
 #include "src/codegen/assembler.h"
@@ -13,21 +14,31 @@
 #include "src/codegen/compiler.h"
 #include "src/codegen/pending-optimization-table.h"
 #include "src/common/globals.h"
+#include "src/deoptimizer/deoptimize-reason.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/execution.h"
 #include "src/execution/frames-inl.h"
+#include "src/execution/tiering-profile.h"
 #include "src/flags/flags.h"
 #include "src/handles/global-handles.h"
 #include "src/init/bootstrapper.h"
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/interpreter.h"
+#include "src/logging/metrics.h"
 #include "src/objects/code-kind.h"
 #include "src/objects/code.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/script.h"
 #include "src/tracing/trace-event.h"
 
 #ifdef V8_ENABLE_SPARKPLUG
 #include "src/baseline/baseline-batch-compiler.h"
 #endif  // V8_ENABLE_SPARKPLUG
 
+#ifdef V8_ENABLE_MAGLEV
+#include "src/maglev/maglev-concurrent-dispatcher.h"
+#endif  // V8_ENABLE_MAGLEV
+
 namespace v8 {
 namespace internal {
 
@@ -130,6 +141,18 @@ void TraceRecompile(Isolate* isolate, Tagged<JSFunction> function,
 
 }  // namespace
 
+TieringManager::TieringManager(Isolate* isolate) : isolate_(isolate) {
+  if (const char* filename = v8_flags.tiering_profile_input) {
+    profile_ = TieringProfile::Load(filename);
+    if (v8_flags.trace_opt_verbose) {
+      PrintF("[tiering: %s profile %s]\n",
+             profile_ ? "loaded" : "could not load", filename);
+    }
+  }
+}
+
+TieringManager::~TieringManager() = default;
+
 void TraceManualRecompile(Tagged<JSFunction> function, CodeKind code_kind,
                           ConcurrencyMode concurrency_mode) {
   if (v8_flags.trace_opt) {
@@ -196,6 +219,11 @@ int InterruptBudgetFor(Isolate* isolate, std::optional<CodeKind> code_kind,
 
   if (TiersUpToMaglev(code_kind) &&
       !function->IsTieringRequestedOrInProgress()) {
+    if (v8_flags.snapshot_hot_functions &&
+        function->shared()->is_snapshot_hot()) {
+      return v8_flags.invocation_count_for_early_optimization *
+             bytecode_length;
+    }
     if (v8_flags.profile_guided_optimization) {
       switch (cached_tiering_decision) {
         case CachedTieringDecision::kDelayMaglev:
@@ -233,6 +261,12 @@ int TieringManager::InterruptBudgetFor(
       function->shared()->GetBytecodeArray(isolate)->length();
 
   if (FirstTimeTierUpToSparkplug(isolate, function)) {
+    // Feedback of functions that never tier up is wasted, so wait for more
+    // invocations while memory is tight.
+    if (isolate->heap()->ShouldOptimizeForMemoryUsage()) {
+      return bytecode_length *
+             v8_flags.invocation_count_for_feedback_allocation_under_pressure;
+    }
     return bytecode_length * v8_flags.invocation_count_for_feedback_allocation;
   }
 
@@ -456,6 +490,13 @@ bool ShouldResetInterruptBudgetByICChange(
 }  // namespace
 
 void TieringManager::NotifyICChanged(Tagged<FeedbackVector> vector) {
+#ifdef V8_ENABLE_MAGLEV
+  if ((vector->tiering_in_progress() || vector->osr_tiering_in_progress()) &&
+      isolate_->maglev_concurrent_dispatcher()->is_enabled()) {
+    isolate_->maglev_concurrent_dispatcher()->CancelStaleJobs(vector);
+  }
+#endif  // V8_ENABLE_MAGLEV
+
   CodeKind code_kind = vector->shared_function_info()->HasBaselineCode()
                            ? CodeKind::BASELINE
                            : CodeKind::INTERPRETED_FUNCTION;
@@ -534,6 +575,114 @@ void TieringManager::NotifyICChanged(Tagged<FeedbackVector> vector) {
   }
 }
 
+void TieringManager::SeedCachedTieringDecision(Tagged<FeedbackVector> vector) {
+  if (!profile_ || !v8_flags.profile_guided_optimization) return;
+  Tagged<SharedFunctionInfo> shared = vector->shared_function_info();
+  // Only seed functions that have not learned anything in this run yet.
+  if (shared->cached_tiering_decision() >
+      CachedTieringDecision::kEarlySparkplug) {
+    return;
+  }
+  std::optional<CachedTieringDecision> decision = profile_->Lookup(vector);
+  if (!decision) return;
+  shared->set_cached_tiering_decision(*decision);
+  if (v8_flags.trace_opt_verbose) {
+    PrintF("[tiering: seeded cached decision %d from profile for %s]\n",
+           static_cast<int>(*decision), shared->DebugNameCStr().get());
+  }
+}
+
+void TieringManager::WriteProfileIfNeeded() {
+  const char* filename = v8_flags.tiering_profile_output;
+  if (!filename || isolate_->serializer_enabled()) return;
+  if (!TieringProfile::Write(isolate_->heap(), profile_.get(), filename)) {
+    PrintIsolate(isolate_, "Could not write tiering profile %s\n", filename);
+  }
+}
+
+namespace {
+
+// Bounds the memory used for deopt loop detection; sites that deopt rarely
+// are forgotten when the table fills up.
+constexpr size_t kMaxTrackedDeoptSites = 1024;
+
+// Makes the feedback of the bytecode at |bytecode_offset| as generic as the
+// interpreter would leave it after seeing many different inputs: property
+// access ICs go megamorphic, which also drops elements kind assumptions for
+// keyed accesses, and calls stop speculating. Returns whether any feedback
+// changed.
+bool GeneralizeFeedback(Isolate* isolate, DirectHandle<JSFunction> function,
+                        int bytecode_offset) {
+  Handle<BytecodeArray> bytecode_array(
+      function->shared()->GetBytecodeArray(isolate), isolate);
+  Handle<FeedbackVector> vector(function->feedback_vector(), isolate);
+  interpreter::BytecodeArrayIterator iterator(bytecode_array, bytecode_offset);
+  interpreter::Bytecode bytecode = iterator.current_bytecode();
+
+  bool changed = false;
+  for (int i = 0; i < interpreter::Bytecodes::NumberOfOperands(bytecode);
+       ++i) {
+    if (interpreter::Bytecodes::GetOperandType(bytecode, i) !=
+        interpreter::OperandType::kFeedbackSlot) {
+      continue;
+    }
+    FeedbackNexus nexus(isolate, vector, iterator.GetSlotOperand(i));
+    FeedbackSlotKind kind = nexus.kind();
+    if (IsLoadICKind(kind) || IsSetNamedICKind(kind) ||
+        IsDefineNamedOwnICKind(kind)) {
+      changed |= nexus.ConfigureMegamorphic(IcCheckType::kProperty);
+    } else if (IsKeyedLoadICKind(kind) || IsKeyedHasICKind(kind) ||
+               IsKeyedStoreICKind(kind) || IsDefineKeyedOwnICKind(kind)) {
+      changed |= nexus.ConfigureMegamorphic(IcCheckType::kElement);
+    } else if (IsCallICKind(kind) && nexus.GetSpeculationMode() !=
+                                         SpeculationMode::kDisallowSpeculation) {
+      nexus.SetSpeculationMode(SpeculationMode::kDisallowSpeculation);
+      changed = true;
+    }
+  }
+  return changed;
+}
+
+}  // namespace
+
+void TieringManager::OnEagerDeopt(DirectHandle<JSFunction> function,
+                                  int bytecode_offset,
+                                  DeoptimizeReason reason) {
+  const int threshold = v8_flags.deopt_loop_threshold;
+  if (threshold <= 0 || bytecode_offset < 0) return;
+  Tagged<SharedFunctionInfo> shared = function->shared();
+  if (!shared->HasBytecodeArray() || !function->has_feedback_vector()) return;
+
+  int script_id = IsScript(shared->script())
+                      ? Cast<Script>(shared->script())->id()
+                      : v8::UnboundScript::kNoScriptId;
+  uint64_t site = base::Hasher{}.Combine(script_id, shared->StartPosition(),
+                                         bytecode_offset,
+                                         static_cast<int>(reason));
+  if (deopt_sites_.size() >= kMaxTrackedDeoptSites &&
+      deopt_sites_.find(site) == deopt_sites_.end()) {
+    deopt_sites_.clear();
+  }
+  int deopt_count = ++deopt_sites_[site];
+  if (deopt_count < threshold) return;
+  deopt_sites_.erase(site);
+
+  bool generalized = GeneralizeFeedback(isolate_, function, bytecode_offset);
+  if (generalized) NotifyICChanged(function->feedback_vector());
+  if (v8_flags.trace_deopt) {
+    CodeTracer::Scope scope(isolate_->GetCodeTracer());
+    PrintF(scope.file(), "[deopt loop: ");
+    ShortPrint(*function, scope.file());
+    PrintF(scope.file(),
+           " deoptimized %d times at bytecode offset %d (%s), %s]\n",
+           deopt_count, bytecode_offset, DeoptimizeReasonToString(reason),
+           generalized ? "generalized feedback" : "no feedback to generalize");
+  }
+  isolate_->metrics_recorder()->AddMainThreadEvent(
+      v8::metrics::DeoptimizationLoop{deopt_count, generalized},
+      isolate_->GetOrRegisterRecorderContextId(isolate_->native_context()));
+}
+
 TieringManager::OnInterruptTickScope::OnInterruptTickScope() {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                "V8.MarkCandidatesForOptimization");
@@ -5,7 +5,10 @@
 #ifndef V8_EXECUTION_TIERING_MANAGER_H_
 #define V8_EXECUTION_TIERING_MANAGER_H_
 
+#include <cstdint>
+#include <memory>
 #include <optional>
+#include <unordered_map>
 
 #include "src/common/assert-scope.h"
 #include "src/handles/handles.h"
@@ -18,7 +21,9 @@ class BytecodeArray;
 class Isolate;
 class JSFunction;
 class OptimizationDecision;
+class TieringProfile;
 enum class CodeKind : uint8_t;
+enum class DeoptimizeReason : uint8_t;
 enum class OptimizationReason : uint8_t;
 
 void TraceManualRecompile(Tagged<JSFunction> function, CodeKind code_kind,
@@ -26,7 +31,8 @@ void TraceManualRecompile(Tagged<JSFunction> function, CodeKind code_kind,
 
 class TieringManager {
  public:
-  explicit TieringManager(Isolate* isolate) : isolate_(isolate) {}
+  explicit TieringManager(Isolate* isolate);
+  ~TieringManager();
 
   void OnInterruptTick(DirectHandle<JSFunction> function, CodeKind code_kind);
 
@@ -42,6 +48,20 @@ class TieringManager {
 
   void MarkForTurboFanOptimization(Tagged<JSFunction> function);
 
+  // Applies the decision of --tiering-profile-input, if any, to the function
+  // of the newly allocated |vector|, before its interrupt budget is set.
+  void SeedCachedTieringDecision(Tagged<FeedbackVector> vector);
+  // Writes --tiering-profile-output, if set.
+  void WriteProfileIfNeeded();
+
+  // Called for eager deopts that invalidated the optimized code, with the
+  // innermost unoptimized frame the deopt resumed in. Once the same bytecode
+  // deopts for the same reason --deopt-loop-threshold times, the feedback of
+  // that bytecode is generalized so that the next optimization doesn't make
+  // the same speculation again.
+  void OnEagerDeopt(DirectHandle<JSFunction> function, int bytecode_offset,
+                    DeoptimizeReason reason);
+
  private:
   // Make the decision whether to optimize the given function, and mark it for
   // optimization if the decision was 'yes'.
@@ -65,6 +85,9 @@ class TieringManager {
   };
 
   Isolate* const isolate_;
+  std::unique_ptr<TieringProfile> profile_;
+  // Deopt counts keyed by a hash of function, bytecode offset and reason.
+  std::unordered_map<uint64_t, int> deopt_sites_;
 };
 
 }  // namespace internal
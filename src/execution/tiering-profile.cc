@@ -0,0 +1,151 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/tiering-profile.h"
+
+#include <fstream>
+#include <string>
+#include <utility>
+
+#include "src/base/platform/platform.h"
+#include "src/heap/heap-inl.h"
+#include "src/heap/heap.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/objects/string-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr char kMagic[] = "v8-tiering-profile";
+
+// Returns the script of |shared| and its source, if it has both.
+std::optional<std::pair<Tagged<Script>, Tagged<String>>> GetScriptSource(
+    Tagged<SharedFunctionInfo> shared) {
+  Tagged<Object> maybe_script = shared->script();
+  if (!IsScript(maybe_script)) return std::nullopt;
+  Tagged<Script> script = Cast<Script>(maybe_script);
+  if (!IsString(script->source())) return std::nullopt;
+  return std::make_pair(script, Cast<String>(script->source()));
+}
+
+}  // namespace
+
+// static
+std::unique_ptr<TieringProfile> TieringProfile::Load(const char* filename) {
+  std::ifstream in(filename);
+  std::string magic;
+  int version;
+  if (!(in >> magic >> version) || magic != kMagic || version != kVersion) {
+    return nullptr;
+  }
+  std::unique_ptr<TieringProfile> profile(new TieringProfile());
+  FunctionKey key;
+  int decision;
+  while (in >> key.source_length >> std::hex >> key.source_hash >> std::dec >>
+         key.function_position >> std::hex >> key.feedback_shape >>
+         std::dec >> decision) {
+    auto cached_decision = static_cast<CachedTieringDecision>(decision);
+    if (!IsPersistent(cached_decision)) return nullptr;
+    profile->decisions_[key] = cached_decision;
+    profile->source_lengths_.insert(key.source_length);
+  }
+  if (!in.eof()) return nullptr;
+  return profile;
+}
+
+// static
+bool TieringProfile::Write(Heap* heap, const TieringProfile* previous,
+                           const char* filename) {
+  DecisionMap decisions;
+  if (previous) decisions = previous->decisions_;
+  {
+    std::unordered_map<int, size_t> source_hashes;
+    HeapObjectIterator iterator(heap);
+    DisallowGarbageCollection no_gc;
+    for (Tagged<HeapObject> object = iterator.Next(); !object.is_null();
+         object = iterator.Next()) {
+      if (!IsFeedbackVector(object)) continue;
+      Tagged<FeedbackVector> vector = Cast<FeedbackVector>(object);
+      Tagged<SharedFunctionInfo> shared = vector->shared_function_info();
+      const CachedTieringDecision decision = shared->cached_tiering_decision();
+      if (!IsPersistent(decision)) continue;
+      auto script_source = GetScriptSource(shared);
+      if (!script_source) continue;
+      auto [script, source] = *script_source;
+      auto [it, inserted] = source_hashes.try_emplace(script->id(), 0);
+      if (inserted) it->second = HashSource(source);
+      decisions[{source->length(), it->second, shared->StartPosition(),
+                 HashFeedbackShape(vector->metadata())}] = decision;
+    }
+  }
+
+  FILE* file = base::OS::FOpen(filename, "w");
+  if (file == nullptr) return false;
+  fprintf(file, "%s %d\n", kMagic, kVersion);
+  for (const auto& [key, decision] : decisions) {
+    fprintf(file, "%u %zx %d %zx %d\n", key.source_length, key.source_hash,
+            key.function_position, key.feedback_shape,
+            static_cast<int>(decision));
+  }
+  return fclose(file) == 0;
+}
+
+std::optional<CachedTieringDecision> TieringProfile::Lookup(
+    Tagged<FeedbackVector> vector) {
+  Tagged<SharedFunctionInfo> shared = vector->shared_function_info();
+  auto script_source = GetScriptSource(shared);
+  if (!script_source) return std::nullopt;
+  auto [script, source] = *script_source;
+  if (!source_lengths_.contains(source->length())) return std::nullopt;
+  auto [hash_it, inserted] = source_hashes_.try_emplace(script->id(), 0);
+  if (inserted) hash_it->second = HashSource(source);
+  auto it = decisions_.find({source->length(), hash_it->second,
+                             shared->StartPosition(),
+                             HashFeedbackShape(vector->metadata())});
+  if (it == decisions_.end()) return std::nullopt;
+  return it->second;
+}
+
+// static
+bool TieringProfile::IsPersistent(CachedTieringDecision decision) {
+  switch (decision) {
+    case CachedTieringDecision::kDelayMaglev:
+    case CachedTieringDecision::kEarlyMaglev:
+    case CachedTieringDecision::kEarlyTurbofan:
+      return true;
+    case CachedTieringDecision::kPending:
+    case CachedTieringDecision::kEarlySparkplug:
+    case CachedTieringDecision::kNormal:
+      return false;
+  }
+  // Values read from a profile are not guaranteed to be declared ones.
+  return false;
+}
+
+// static
+size_t TieringProfile::HashSource(Tagged<String> source) {
+  const uint32_t length = source->length();
+  std::unique_ptr<base::uc16[]> chars(new base::uc16[length]);
+  String::WriteToFlat(source, chars.get(), 0, length);
+  return base::hash_range(chars.get(), chars.get() + length);
+}
+
+// static
+size_t TieringProfile::HashFeedbackShape(Tagged<FeedbackMetadata> metadata) {
+  DisallowGarbageCollection no_gc;
+  size_t hash = base::hash_value(metadata->slot_count());
+  FeedbackMetadataIterator slots(metadata, no_gc);
+  while (slots.HasNext()) {
+    slots.Next();
+    hash = base::hash_combine(hash, static_cast<int>(slots.kind()));
+  }
+  return hash;
+}
+
+}  // namespace internal
+}  // namespace v8
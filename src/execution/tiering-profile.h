@@ -0,0 +1,107 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_EXECUTION_TIERING_PROFILE_H_
+#define V8_EXECUTION_TIERING_PROFILE_H_
+
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "src/base/hashing.h"
+#include "src/common/globals.h"
+#include "src/objects/feedback-vector.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+
+// Cached tiering decisions that outlive the process, so that a later run can
+// tier up a function that reached Maglev or Turbofan with stable feedback as
+// early as the same run would have after a deoptimization-free warm-up,
+// instead of learning the decision again from scratch.
+//
+// A function is identified by the source of its script and its start
+// position. Feedback itself refers to maps and other heap objects and cannot
+// be carried over, so only a condensed shape of the feedback vector is kept:
+// a hash of the kinds of its slots. Functions whose shape differs, for
+// example because flags of the later run lay out their slots differently,
+// are not seeded.
+// The profile is a text file with a version line followed by one line per
+// function:
+//
+//   v8-tiering-profile 1
+//   <source length> <source hash> <function start position> <shape> <decision>
+class TieringProfile final {
+ public:
+  static constexpr int kVersion = 1;
+
+  // Reads a profile written by Write(). Returns nullptr if the file cannot be
+  // read or is not a profile of this version.
+  static std::unique_ptr<TieringProfile> Load(const char* filename);
+
+  // Writes the decisions of the functions that have a feedback vector in
+  // |heap| together with the ones in |previous|, if any, to |filename|.
+  // Decisions of this run take precedence.
+  static bool Write(Heap* heap, const TieringProfile* previous,
+                    const char* filename);
+
+  TieringProfile(const TieringProfile&) = delete;
+  TieringProfile& operator=(const TieringProfile&) = delete;
+
+  // Returns the decision recorded for the function of |vector|, if any.
+  std::optional<CachedTieringDecision> Lookup(Tagged<FeedbackVector> vector);
+
+  size_t size() const { return decisions_.size(); }
+
+ private:
+  struct FunctionKey {
+    uint32_t source_length;
+    size_t source_hash;
+    int function_position;
+    size_t feedback_shape;
+
+    bool operator==(const FunctionKey& other) const {
+      return source_length == other.source_length &&
+             source_hash == other.source_hash &&
+             function_position == other.function_position &&
+             feedback_shape == other.feedback_shape;
+    }
+  };
+
+  struct FunctionKeyHash {
+    size_t operator()(const FunctionKey& key) const {
+      return base::hash_combine(key.source_length, key.source_hash,
+                                key.function_position, key.feedback_shape);
+    }
+  };
+
+  using DecisionMap =
+      std::unordered_map<FunctionKey, CachedTieringDecision, FunctionKeyHash>;
+
+  TieringProfile() = default;
+
+  // Returns whether |decision| is worth carrying over to another run.
+  static bool IsPersistent(CachedTieringDecision decision);
+
+  // Hashes the characters of |source|. The result only needs to be stable
+  // between runs of the same build.
+  static size_t HashSource(Tagged<String> source);
+  // Hashes the slot kinds of |metadata|.
+  static size_t HashFeedbackShape(Tagged<FeedbackMetadata> metadata);
+
+  DecisionMap decisions_;
+  // Source lengths of all scripts in the profile. Scripts of other lengths
+  // are not hashed at all.
+  std::unordered_set<uint32_t> source_lengths_;
+  // Source hashes by script id, so that every script is hashed only once.
+  std::unordered_map<int, size_t> source_hashes_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_EXECUTION_TIERING_PROFILE_H_
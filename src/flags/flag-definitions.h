@@ -507,8 +507,9 @@ DEFINE_BOOL_READONLY(
 DEFINE_BOOL_READONLY(conservative_stack_scanning, true,
                      "use conservative stack scanning")
 #else
-DEFINE_EXPERIMENTAL_FEATURE(conservative_stack_scanning,
-                            "use conservative stack scanning")
+DEFINE_BOOL(conservative_stack_scanning, false,
+            "use conservative stack scanning; objects referenced from the "
+            "native stack are kept alive and do not move")
 #endif  // V8_ENABLE_DIRECT_HANDLE
 DEFINE_IMPLICATION(conservative_stack_scanning,
                    scavenger_conservative_object_pinning)
@@ -688,6 +689,9 @@ DEFINE_UINT(
     "max number of threads that concurrent Maglev can use (0 for unbounded)")
 DEFINE_BOOL(concurrent_maglev_high_priority_threads, false,
             "use high priority compiler threads for concurrent Maglev")
+DEFINE_BOOL(concurrent_maglev_prioritize_jobs, true,
+            "start queued concurrent Maglev jobs by estimated benefit, and "
+            "drop duplicate jobs and jobs whose feedback changed")
 
 DEFINE_INT(
     max_maglev_inline_depth, 1,
@@ -846,6 +850,14 @@ DEFINE_BOOL(empty_context_extension_dep, true,
             "non-empty context extensions")
 
 DEFINE_BOOL(json_stringify_fast_path, true, "Enable JSON.stringify fast-path")
+DEFINE_BOOL(json_parse_parallel_numbers, false,
+            "convert the numbers of large JSON.parse sources on worker threads")
+DEFINE_SIZE_T(json_parse_parallel_numbers_threshold, 1 * MB,
+              "minimum length of a JSON.parse source (in characters) for "
+              "--json-parse-parallel-numbers")
+DEFINE_BOOL(bigint_parallel_multiplication, false,
+            "split multiplications of very large BigInts across worker "
+            "threads")
 
 // TODO(jgruber): Remove this flag.
 DEFINE_BOOL(cache_property_key_string_adds, true,
@@ -939,6 +951,7 @@ DEFINE_NEG_IMPLICATION(jitless, turbofan)
 #ifdef V8_ENABLE_SPARKPLUG
 DEFINE_NEG_IMPLICATION(jitless, sparkplug)
 DEFINE_NEG_IMPLICATION(jitless, always_sparkplug)
+DEFINE_NEG_IMPLICATION(jitless, eager_sparkplug)
 #endif  // V8_ENABLE_SPARKPLUG
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(jitless, maglev)
@@ -1013,6 +1026,13 @@ DEFINE_NEG_NEG_IMPLICATION(allocation_site_tracking,
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_STRING(pretenuring_profile_input, nullptr,
+              "tenure literal allocation sites that were tenured when the "
+              "given pretenuring profile was written")
+DEFINE_STRING(pretenuring_profile_output, nullptr,
+              "write the tenured literal allocation sites, together with the "
+              "ones of --pretenuring-profile-input, to the given file when "
+              "the isolate is torn down")
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation "
@@ -1025,6 +1045,9 @@ DEFINE_INT(minor_ms_page_promotion_max_lab_threshold, 30,
            "page promotion")
 DEFINE_UINT(minor_ms_max_page_age, 4,
             "max age for a page after which it is force promoted to old space")
+DEFINE_BOOL(minor_ms_age_scaled_page_promotion, false,
+            "lower the MinorMS page promotion threshold for pages that "
+            "survived previous GCs, down to 0 at minor_ms_max_page_age")
 
 DEFINE_BOOL(trace_page_promotions, false, "trace page promotion decisions")
 DEFINE_BOOL(trace_pretenuring, false,
@@ -1072,6 +1095,9 @@ DEFINE_BOOL_READONLY(string_slices, true, "use string slices")
 // Tiering: Sparkplug / feedback vector allocation.
 DEFINE_INT(invocation_count_for_feedback_allocation, 8,
            "invocation count required for allocating feedback vectors")
+DEFINE_INT(invocation_count_for_feedback_allocation_under_pressure, 32,
+           "invocation count required for allocating feedback vectors while "
+           "the heap optimizes for memory usage")
 
 // Tiering: Maglev.
 #if defined(ANDROID)
@@ -1212,6 +1238,12 @@ DEFINE_BOOL(always_sparkplug, false, "directly tier up to Sparkplug code")
 #if V8_ENABLE_SPARKPLUG
 DEFINE_IMPLICATION(always_sparkplug, sparkplug)
 DEFINE_BOOL(baseline_batch_compilation, true, "batch compile Sparkplug code")
+DEFINE_BOOL(eager_sparkplug, false,
+            "concurrently compile Sparkplug code for functions with loops "
+            "right after their bytecode has been generated")
+DEFINE_IMPLICATION(eager_sparkplug, sparkplug)
+DEFINE_INT(eager_sparkplug_max_bytecode_size, 4096,
+           "maximum bytecode size of functions compiled by --eager-sparkplug")
 #if defined(V8_OS_DARWIN) && defined(V8_HOST_ARCH_ARM64) && \
     !V8_HEAP_USE_PTHREAD_JIT_WRITE_PROTECT &&               \
     !V8_HEAP_USE_BECORE_JIT_WRITE_PROTECT
@@ -1233,10 +1265,16 @@ DEFINE_BOOL(concurrent_sparkplug_high_priority_threads, false,
             "use high priority compiler threads for concurrent Sparkplug")
 #else
 DEFINE_BOOL(baseline_batch_compilation, false, "batch compile Sparkplug code")
+DEFINE_BOOL_READONLY(eager_sparkplug, false,
+                     "concurrently compile Sparkplug code for functions with "
+                     "loops right after their bytecode has been generated")
 DEFINE_BOOL_READONLY(concurrent_sparkplug, false,
                      "compile Sparkplug code in a background thread")
 #endif
 DEFINE_STRING(sparkplug_filter, "*", "filter for Sparkplug baseline compiler")
+DEFINE_BOOL(shared_baseline_code_cache, false,
+            "share Sparkplug code compiled from identical bytecode between "
+            "the isolates of a process")
 DEFINE_BOOL(sparkplug_needs_short_builtins, false,
             "only enable Sparkplug baseline compiler when "
             "--short-builtin-calls are also enabled")
@@ -1589,6 +1627,9 @@ DEFINE_STRING(
 
 DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
             "verify register allocation in TurboFan")
+DEFINE_INT(turbo_regalloc_live_range_budget, 150000,
+           "number of virtual registers above which the register allocator "
+           "skips its costlier heuristics (0 means no limit)")
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "TurboFan loop peeling")
@@ -1603,6 +1644,10 @@ DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
 DEFINE_IMPLICATION(turbo_stress_instruction_scheduling,
                    turbo_instruction_scheduling)
+DEFINE_BOOL(turbo_instruction_scheduling_hot_loops, false,
+            "only schedule instructions of non-deferred blocks in loops")
+DEFINE_IMPLICATION(turbo_instruction_scheduling_hot_loops,
+                   turbo_instruction_scheduling)
 DEFINE_BOOL(turbo_store_elimination, true,
             "enable store-store elimination in TurboFan")
 DEFINE_BOOL(trace_store_elimination, false, "trace store elimination")
@@ -1696,6 +1741,12 @@ DEFINE_BOOL(turboshaft_load_elimination, true,
             "enable Turboshaft's low-level load elimination for JS")
 DEFINE_BOOL(turboshaft_loop_unrolling, true,
             "enable Turboshaft's loop unrolling")
+DEFINE_UINT(turboshaft_loop_stack_check_max_iterations, 5000,
+            "remove the interrupt check from loops that Turboshaft can prove "
+            "to run fewer iterations than this")
+DEFINE_BOOL(turboshaft_loop_vectorization, false,
+            "vectorize simple loops over typed arrays with SIMD128 in "
+            "Turboshaft (JS only)")
 DEFINE_BOOL(turboshaft_string_concat_escape_analysis, true,
             "enable Turboshaft's escape analysis for string concatenation")
 
@@ -1773,6 +1824,8 @@ DEFINE_BOOL(turboshaft_trace_unrolling, false,
             "trace Turboshaft's loop unrolling reducer")
 DEFINE_BOOL(turboshaft_trace_peeling, false,
             "trace Turboshaft's loop peeling reducer")
+DEFINE_BOOL(turboshaft_trace_loop_vectorization, false,
+            "trace Turboshaft's loop vectorization reducer")
 DEFINE_BOOL(turboshaft_trace_load_elimination, false,
             "trace Turboshaft's late load elimination")
 DEFINE_BOOL(turboshaft_trace_if_else_to_switch, false,
@@ -1802,6 +1855,13 @@ DEFINE_BOOL(profile_guided_optimization_for_empty_feedback_vector, true,
             "profile guided optimization for empty feedback vector")
 DEFINE_INT(invocation_count_for_early_optimization, 30,
            "invocation count threshold for early optimization")
+DEFINE_STRING(tiering_profile_input, nullptr,
+              "seed the cached tiering decisions of functions from the given "
+              "tiering profile")
+DEFINE_STRING(tiering_profile_output, nullptr,
+              "write the cached tiering decisions, together with the ones of "
+              "--tiering-profile-input, to the given file when the isolate "
+              "is torn down")
 DEFINE_INT(invocation_count_for_maglev_with_delay, 600,
            "invocation count for maglev for functions which according to "
            "profile_guided_optimization are likely to deoptimize before "
@@ -1815,6 +1875,10 @@ DEFINE_VALUE_IMPLICATION(optimize_for_size, max_semi_space_size, size_t{1})
 
 DEFINE_BOOL(reopt_after_lazy_deopts, true,
             "Immediately re-optimize code after some lazy deopts")
+DEFINE_INT(deopt_loop_threshold, 3,
+           "number of eager deopts at the same bytecode for the same reason "
+           "after which the feedback of that bytecode is generalized (0 to "
+           "disable)")
 
 // This verification doesn't work for debugger tests which set breakpoints
 // into builtin functions and thus make certain core JS builtins look like
@@ -1904,6 +1968,8 @@ DEFINE_INT(wasm_stack_switching_stack_size, V8_DEFAULT_STACK_SIZE_KB,
 // depends on the stack limit margin and the platform's page size.
 DEFINE_VALUE_IMPLICATION(experimental_wasm_growable_stacks,
                          wasm_stack_switching_stack_size, 1)
+DEFINE_INT(wasm_stack_pool_size, 4 * MB / KB,
+           "maximum size of finished wasm stacks kept for reuse (in kB)")
 DEFINE_BOOL(liftoff, true,
             "enable Liftoff, the baseline compiler for WebAssembly")
 DEFINE_BOOL(liftoff_only, false,
@@ -1942,6 +2008,10 @@ DEFINE_NEG_IMPLICATION(experimental_wasm_pgo_to_file, single_threaded)
 DEFINE_BOOL(
     experimental_wasm_pgo_from_file, false,
     "experimental: read and use Wasm PGO data from a local file (for testing)")
+DEFINE_STRING(experimental_wasm_code_cache_dir, nullptr,
+              "experimental: share the TurboFan code of Wasm modules with "
+              "other processes through files in this directory, which are "
+              "mapped read-only and deserialized lazily")
 
 DEFINE_BOOL(validate_asm, true,
             "validate asm.js modules and translate them to Wasm")
@@ -2093,6 +2163,11 @@ DEFINE_BOOL(wasm_loop_unrolling, true,
 DEFINE_BOOL(wasm_loop_peeling, true, "enable loop peeling for wasm functions")
 DEFINE_SIZE_T(wasm_loop_peeling_max_size, 1000, "maximum size for peeling")
 DEFINE_BOOL(trace_wasm_loop_peeling, false, "trace wasm loop peeling")
+DEFINE_BOOL(wasm_bounds_check_hoisting, false,
+            "version memory64 loops to check the bounds of their accesses "
+            "once in front of the loop")
+DEFINE_BOOL(trace_wasm_bounds_check_hoisting, false,
+            "trace wasm bounds check hoisting")
 DEFINE_BOOL(wasm_fuzzer_gen_test, false,
             "generate a test case when running a wasm fuzzer")
 DEFINE_IMPLICATION(wasm_fuzzer_gen_test, single_threaded)
@@ -2124,6 +2199,19 @@ DEFINE_BOOL(stress_wasm_memory_moving, false,
             "always move non-shared bounds-checked Wasm memory on grow")
 DEFINE_BOOL(flush_liftoff_code, true,
             "enable flushing Liftoff code on memory pressure signal")
+DEFINE_BOOL(wasm_flush_cold_liftoff_code, false,
+            "flush the Liftoff code of functions that did not run between two "
+            "full GCs, to be compiled again lazily on their next call")
+// Coldness is judged by the tiering budgets, which only dynamic tiering uses.
+DEFINE_NEG_NEG_IMPLICATION(wasm_dynamic_tiering, wasm_flush_cold_liftoff_code)
+DEFINE_BOOL(wasm_flush_cold_turbofan_code, false,
+            "also flush the TurboFan code of functions that did not run "
+            "between --wasm-cold-turbofan-code-age full GCs in a row; "
+            "TurboFan code then counts its calls")
+DEFINE_IMPLICATION(wasm_flush_cold_turbofan_code, wasm_flush_cold_liftoff_code)
+DEFINE_INT(wasm_cold_turbofan_code_age, 4,
+           "number of full GCs in a row during which TurboFan code has to be "
+           "unused to get flushed, at most 255")
 DEFINE_BOOL(stress_branch_hinting, false,
             "stress branch hinting by generating a random hint for each branch "
             "instruction")
@@ -2321,6 +2409,10 @@ DEFINE_SIZE_T(max_semi_space_size, 0,
               "max size of a semi-space (in MBytes), the new space consists of "
               "two semi-spaces")
 DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
+DEFINE_FLOAT(new_space_target_pause_ms, 0,
+             "size the new space for scavenges of about this many "
+             "milliseconds, based on the observed scavenge speed and survival "
+             "rate, instead of growing it by semi_space_growth_factor")
 // Set minimum semi space growth factor
 DEFINE_MIN_VALUE_IMPLICATION(semi_space_growth_factor, 2)
 DEFINE_SIZE_T(max_old_space_size, 0, "max size of the old space (in Mbytes)")
@@ -2349,11 +2441,17 @@ DEFINE_INT(cppgc_random_gc_interval, 0,
 
 DEFINE_INT(retain_maps_for_n_gc, 2,
            "keeps maps alive for <n> old space garbage collections")
+DEFINE_BOOL(prune_deprecated_transitions, true,
+            "drop transitions between deprecated maps during full GCs, and "
+            "don't retain deprecated maps")
 DEFINE_BOOL(trace_gc, false,
             "print one trace line following each garbage collection")
 DEFINE_BOOL(trace_gc_nvp, false,
             "print one detailed trace line in name=value format "
             "after each garbage collection")
+DEFINE_BOOL(gc_latency_histograms, false,
+            "collect histograms of GC pauses and time to safepoint for "
+            "v8::metrics::GCLatencyHistograms")
 DEFINE_BOOL(trace_gc_ignore_scavenger, false,
             "do not print trace line after scavenger collection")
 DEFINE_BOOL(trace_memory_reducer, false, "print memory reducer behavior")
@@ -2403,6 +2501,11 @@ DEFINE_BOOL(incremental_marking_unified_schedule, false,
             "JS and C++ objects.")
 DEFINE_BOOL(trace_unmapper, false, "Trace the unmapping")
 DEFINE_BOOL(parallel_scavenge, true, "parallel scavenge")
+DEFINE_INT(scavenger_max_tasks, 8,
+           "maximum number of scavenger tasks, including the main thread; on "
+           "multi-socket machines, a limit of one socket's cores avoids "
+           "copying young objects across sockets")
+DEFINE_REQUIREMENT(v8_flags.scavenger_max_tasks >= 1)
 DEFINE_BOOL(minor_gc_task, true, "schedule minor GC tasks")
 DEFINE_UINT(minor_gc_task_trigger, 80,
             "minor GC task trigger in percent of the current heap limit")
@@ -2445,6 +2548,8 @@ DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
 DEFINE_BOOL(parallel_weak_ref_clearing, true,
             "use parallel threads to clear weak refs in the atomic pause.")
+DEFINE_INT(finalization_registry_cleanup_interval_ms, 0,
+           "minimum time between two FinalizationRegistry cleanup tasks")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
             "trigger out-of-memory failure to avoid GC storm near heap limit")
 DEFINE_BOOL(ineffective_gc_includes_global, false,
@@ -2563,6 +2668,10 @@ DEFINE_BOOL(compact_with_stack, true,
             "Perform compaction when finalizing a full GC with stack")
 DEFINE_INT(compaction_max_evacuated_bytes_mb, 4,
            "Max evacuated bytes during compaction")
+DEFINE_FLOAT(compaction_pause_budget_ms, 0,
+             "Bound the bytes all spaces together evacuate in a full GC that "
+             "does not reduce memory to what the traced compaction speed "
+             "evacuates in this many milliseconds (0 means no budget)")
 DEFINE_INT(compaction_max_evacuated_bytes_mb_for_reduce_memory, 12,
            "Max evacuated bytes during compaction for reduce memory GCs")
 DEFINE_INT(compaction_max_evacuated_bytes_mb_for_optimize_memory, 6,
@@ -2573,6 +2682,15 @@ DEFINE_INT(compaction_target_fragmentation_percent_for_reduce_memory, 20,
 DEFINE_INT(compaction_target_fragmentation_percent_for_optimize_memory, 20,
            "Target fragmentation % during compaction for GCs when "
            "ShouldOptimizeForMemoryUsage() = true")
+DEFINE_INT(compaction_target_fragmentation_percent_for_code_space, 0,
+           "Upper bound on the target fragmentation % of code space pages, "
+           "so that scattered code is compacted earlier (0 means no bound)")
+DEFINE_INT(pointer_table_compaction_min_size_kb, 1024,
+           "Only compact external and C++ heap pointer table spaces of at "
+           "least this size (in KB)")
+DEFINE_INT(pointer_table_compaction_min_free_percent, 10,
+           "Only compact external and C++ heap pointer table spaces with at "
+           "least this percentage of free entries")
 DEFINE_BOOL(shortcut_strings_with_stack, true,
             "Shortcut Strings during GC with stack")
 DEFINE_BOOL(stress_compaction, false,
@@ -2604,6 +2722,9 @@ DEFINE_BOOL(use_marking_progress_bar, true,
             "incremental marking is active.")
 DEFINE_BOOL(stress_per_context_marking_worklist, false,
             "Use per-context worklist for marking")
+DEFINE_BOOL(gc_per_context_cost, false,
+            "Report the marking and sweeping cost of full GCs per native "
+            "context to the metrics recorder")
 DEFINE_BOOL(stress_incremental_marking, false,
             "force incremental marking for small heaps and run it more often")
 
@@ -2618,13 +2739,30 @@ DEFINE_BOOL(memory_pool_release_before_memory_pressure_gcs, true,
 DEFINE_BOOL(memory_pool_release_on_malloc_failures, false,
             "discard the memory pool on malloc retries")
 DEFINE_INT(memory_pool_timeout, 8, "Release pooled pages after X seconds.")
+DEFINE_BOOL(memory_pool_numa_affinity, true,
+            "prefer pooled memory that was released on the NUMA node of the "
+            "allocating thread")
+DEFINE_BOOL(memory_pool_decommit, true,
+            "discard the contents of pooled memory that was not reused within "
+            "memory_pool_timeout but keep it reserved for another timeout "
+            "before releasing it")
 DEFINE_BOOL(large_page_pool, true, "Add large pages to the page pool")
+DEFINE_BOOL(transparent_huge_pages, false,
+            "advise the OS to back the pointer compression cage, the code "
+            "range and large objects with transparent huge pages (Linux only)")
+// Discarding a pooled page splits the huge page it is part of.
+DEFINE_NEG_IMPLICATION(transparent_huge_pages, memory_pool_decommit)
 DEFINE_SIZE_T(max_large_page_pool_size, 32,
               "Maximum size of pooled large pages in MB.")
 DEFINE_BOOL(managed_zone_memory, false,
             "Manage zone memory in V8 instead of using malloc().")
 DEFINE_WEAK_IMPLICATION(future, managed_zone_memory)
 DEFINE_NEG_NEG_IMPLICATION(memory_pool, managed_zone_memory)
+DEFINE_BOOL(zone_segment_pool, false,
+            "cache returned zone segments by size class for reuse by later "
+            "zones instead of freeing them")
+DEFINE_SIZE_T(zone_segment_pool_max_size_kb, 4096,
+              "maximum size of the zone segment pool of an isolate in KB")
 
 DEFINE_BOOL(fuzzer_gc_analysis, false,
             "prints number of allocations and enables analysis mode for gc "
@@ -2686,6 +2824,10 @@ DEFINE_FLOAT(memory_balancer_c_value, 3e-10,
              "c value for membalancer. "
              "A special constant to balance between memory and space tradeoff. "
              "The smaller the more memory it uses.")
+DEFINE_SIZE_T(memory_balancer_global_budget, 0,
+              "old generation budget (in Mbytes) that membalancer splits "
+              "between all heaps of the process, 0 to size each heap on its "
+              "own")
 DEFINE_NEG_IMPLICATION(memory_balancer, memory_reducer)
 DEFINE_BOOL(trace_memory_balancer, false, "print memory balancer behavior.")
 DEFINE_BOOL(late_heap_limit_check, true,
@@ -2891,6 +3033,9 @@ DEFINE_BOOL(lazy_streaming, true,
             "use lazy compilation during streaming compilation")
 DEFINE_BOOL(max_lazy, false, "ignore eager compilation hints")
 DEFINE_IMPLICATION(max_lazy, lazy)
+DEFINE_UINT(produce_compile_hints_time_limit, 0,
+            "only produce compile hints for lazy functions compiled within "
+            "this many milliseconds of isolate creation (0 means no limit)")
 DEFINE_BOOL(trace_opt, false, "trace optimized compilation")
 DEFINE_BOOL(trace_opt_status, false,
             "trace the optimization status of functions during tiering events")
@@ -2953,6 +3098,12 @@ DEFINE_EXPERIMENTAL_FEATURE(
     parallel_compile_tasks_for_lazy,
     "spawn parallel compile tasks for all lazily compiled functions")
 DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, lazy_compile_dispatcher)
+DEFINE_EXPERIMENTAL_FEATURE(
+    parallel_compile_tasks_for_streaming,
+    "spawn parallel compile tasks for the lazily compiled functions of "
+    "streamed scripts")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_streaming,
+                   lazy_compile_dispatcher)
 
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
@@ -3049,10 +3200,25 @@ DEFINE_BOOL_READONLY(fast_map_update, false,
 #define DEFAULT_MAX_POLYMORPHIC_MAP_COUNT 4
 DEFINE_INT(max_valid_polymorphic_map_count, DEFAULT_MAX_POLYMORPHIC_MAP_COUNT,
            "maximum number of valid maps to track in POLYMORPHIC state")
+DEFINE_INT(max_shared_handler_polymorphic_map_count, 16,
+           "maximum number of valid maps to track in POLYMORPHIC state when "
+           "they all use the same handler, e.g. the same field load")
 DEFINE_BOOL(
     clone_object_sidestep_transitions, true,
     "support sidestep transitions for dependency tracking object clone maps")
 DEFINE_WEAK_IMPLICATION(future, clone_object_sidestep_transitions)
+DEFINE_INT(dictionary_promotion_lookups, 8,
+           "migrate dictionary-mode objects back to fast properties after "
+           "this many load IC misses without adding or deleting properties "
+           "(at most 15, 0 to disable)")
+
+// stub-cache.cc
+DEFINE_UINT(stub_cache_max_primary_table_bits, 13,
+            "log2 of the maximum number of entries in the primary megamorphic "
+            "stub cache table, which grows at GCs while it keeps missing "
+            "(11 keeps the initial size)")
+DEFINE_BOOL(trace_stub_cache_growth, false,
+            "trace growing of the megamorphic stub caches")
 
 // map-inl.h
 DEFINE_INT(fast_properties_soft_limit, 12,
@@ -3208,6 +3374,15 @@ DEFINE_GENERIC_IMPLICATION(
         v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE))
 DEFINE_BOOL(rcs, false, "report runtime call counts and times")
 DEFINE_IMPLICATION(rcs, runtime_call_stats)
+DEFINE_BOOL(runtime_call_stats_sampling, false,
+            "sample the active runtime call counter of the main thread "
+            "instead of timing each runtime call")
+DEFINE_GENERIC_IMPLICATION(
+    runtime_call_stats_sampling,
+    TracingFlags::runtime_stats.fetch_or(
+        v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING))
+DEFINE_INT(runtime_call_stats_sampling_interval, 1000,
+           "interval between runtime call stats samples in microseconds")
 
 DEFINE_BOOL(rcs_cpu_time, false,
             "report runtime times in cpu time (the default is wall time)")
@@ -3218,9 +3393,23 @@ DEFINE_BOOL(verify_snapshot_checksum, DEBUG_BOOL,
             "Verify snapshot checksums when deserializing snapshots. Enable "
             "checksum creation and verification for code caches. Enabled by "
             "default in debug builds and once per process for Android.")
+DEFINE_BOOL(snapshot_hot_functions, true,
+            "Remember functions that ran before a snapshot was created with "
+            "kept function code, exempt them from bytecode flushing and tier "
+            "them up early after deserialization.")
+DEFINE_BOOL(verify_code_cache_checksum_once, true,
+            "Verify the checksum of a code cache buffer only the first time "
+            "it is consumed in this process.")
 DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
 DEFINE_BOOL(trace_deserialization, false, "Trace the snapshot deserialization.")
+DEFINE_STRING(read_only_heap_file, nullptr,
+              "Back the read-only heap with a private mapping of this file so "
+              "that its clean pages are shared by all processes using the "
+              "same file. The file is created on first use. Requires static "
+              "roots.")
+DEFINE_BOOL(parallel_snapshot_decompression, true,
+            "Decompress the chunks of compressed snapshots on worker threads.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
 // Regexp
@@ -3268,6 +3457,12 @@ DEFINE_IMPLICATION(experimental_regexp_engine_capture_group_opt,
 DEFINE_UINT64(experimental_regexp_engine_capture_group_opt_max_memory_usage,
               1024,
               "maximum memory usage in MB allowed for experimental engine")
+DEFINE_BOOL(experimental_regexp_engine_lazy_dfa, true,
+            "search with a lazily built DFA in the experimental regexp engine "
+            "if the regexp has no assertions or lookarounds")
+DEFINE_SIZE_T(experimental_regexp_engine_lazy_dfa_cache_size, 1 * MB,
+              "maximum size in bytes of the experimental engine's DFA state "
+              "cache before falling back to NFA simulation")
 DEFINE_BOOL(trace_experimental_regexp_engine, false,
             "trace execution of experimental regexp engine")
 
@@ -3860,6 +4055,7 @@ DEFINE_NEG_IMPLICATION(predictable, stress_concurrent_inlining)
 DEFINE_NEG_IMPLICATION(predictable, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(predictable, parallel_compile_tasks_for_streaming)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(predictable, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(predictable, maglev_build_code_on_background)
@@ -3890,6 +4086,7 @@ DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_streaming)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_build_code_on_background)
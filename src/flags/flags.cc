@@ -1252,6 +1252,7 @@ void FlagList::ResolveContradictionsWhenFuzzing() {
 
       // https://crbug.com/371061101
       RESET_WHEN_FUZZING(parallel_compile_tasks_for_lazy),
+      RESET_WHEN_FUZZING(parallel_compile_tasks_for_streaming),
 
       // https://crbug.com/366671002
       RESET_WHEN_FUZZING(stress_snapshot),
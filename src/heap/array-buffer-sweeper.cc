@@ -129,6 +129,15 @@ class ArrayBufferSweeper::SweepingState final {
     sweeper->DecrementExternalMemoryCounters(freed_bytes_);
   }
 
+  // Lets the main thread hand large backing stores to a worker instead of
+  // freeing them when it sweeps, see kBackgroundFreeThresholdBytes.
+  void set_free_large_in_background(bool value) {
+    free_large_in_background_ = value;
+  }
+  ArrayBufferExtension* TakeDeferredFree() {
+    return std::exchange(deferred_free_, nullptr);
+  }
+
   void StartBackgroundSweeping() { job_handle_->NotifyConcurrencyIncrease(); }
   void FinishSweeping() {
     DCHECK(job_handle_ && job_handle_->IsValid());
@@ -148,6 +157,10 @@ class ArrayBufferSweeper::SweepingState final {
   // bytes. This is used to compute adjustment when sweeping finishes.
   uint64_t young_bytes_accounted_{0};
   uint64_t old_bytes_accounted_{0};
+  bool free_large_in_background_{false};
+  // Dead extensions the main thread left for a worker to free. Only accessed
+  // on the main thread.
+  ArrayBufferExtension* deferred_free_{nullptr};
   std::unique_ptr<JobHandle> job_handle_;
 };
 
@@ -185,6 +198,10 @@ class ArrayBufferSweeper::SweepingState::SweepingJob final : public JobTask {
   bool SweepFull(JobDelegate* delegate);
   bool SweepListFull(JobDelegate* delegate, ArrayBufferList& list,
                      ArrayBufferExtension::Age age);
+  // Frees a dead extension with |bytes| accounted, or defers freeing it to a
+  // worker if it is large and this is the main thread.
+  void Free(JobDelegate* delegate, ArrayBufferExtension* extension,
+            size_t bytes);
 
   Heap* const heap_;
   SweepingState& state_;
@@ -237,6 +254,33 @@ void ArrayBufferSweeper::SweepingState::SweepingJob::Run(
   Sweep(delegate);
 }
 
+// Deletes extensions, and thereby frees their backing stores, off the main
+// thread. The extensions were finalized already.
+class ArrayBufferSweeper::FreeingJob final : public JobTask {
+ public:
+  explicit FreeingJob(ArrayBufferExtension* head) : head_(head) {}
+
+  FreeingJob(const FreeingJob&) = delete;
+  FreeingJob& operator=(const FreeingJob&) = delete;
+
+  void Run(JobDelegate* delegate) final {
+    while (head_) {
+      ArrayBufferExtension* next = head_->next();
+      delete head_;
+      head_ = next;
+    }
+    done_.store(true, std::memory_order_relaxed);
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    return done_.load(std::memory_order_relaxed) ? 0 : 1;
+  }
+
+ private:
+  ArrayBufferExtension* head_;
+  std::atomic<bool> done_{false};
+};
+
 ArrayBufferSweeper::SweepingState::SweepingState(
     Heap* heap, ArrayBufferList young, ArrayBufferList old,
     ArrayBufferSweeper::SweepingType type,
@@ -254,8 +298,12 @@ ArrayBufferSweeper::ArrayBufferSweeper(Heap* heap) : heap_(heap) {}
 
 ArrayBufferSweeper::~ArrayBufferSweeper() {
   EnsureFinished();
+  JoinFreeingJob();
   ReleaseAll(&old_);
   ReleaseAll(&young_);
+  // All extensions are gone, so only decreases can be pending.
+  ReportPendingExternalMemory(false);
+  DCHECK_EQ(0, pending_external_memory_);
 }
 
 void ArrayBufferSweeper::EnsureFinished() {
@@ -285,6 +333,10 @@ void ArrayBufferSweeper::RequestSweep(
     SweepingType type, TreatAllYoungAsPromoted treat_all_young_as_promoted) {
   DCHECK(!sweeping_in_progress());
 
+  // GC is a safepoint for the batched external memory: decreases that are
+  // not reported yet would otherwise hold on to the external memory limits.
+  ReportPendingExternalMemory(false);
+
   if (young_.IsEmpty() && (old_.IsEmpty() || type == SweepingType::kYoung))
     return;
 
@@ -300,9 +352,11 @@ void ArrayBufferSweeper::RequestSweep(
   Prepare(type, treat_all_young_as_promoted, trace_id);
   DCHECK_IMPLIES(v8_flags.minor_ms && type == SweepingType::kYoung,
                  !heap_->ShouldReduceMemory());
-  if (!heap_->IsTearingDown() && !heap_->ShouldReduceMemory() &&
-      v8_flags.concurrent_array_buffer_sweeping &&
-      heap_->ShouldUseBackgroundThreads()) {
+  const bool use_background_threads =
+      !heap_->IsTearingDown() && v8_flags.concurrent_array_buffer_sweeping &&
+      heap_->ShouldUseBackgroundThreads();
+  state_->set_free_large_in_background(use_background_threads);
+  if (use_background_threads && !heap_->ShouldReduceMemory()) {
     state_->StartBackgroundSweeping();
   } else {
     Finish();
@@ -337,6 +391,9 @@ void ArrayBufferSweeper::Finalize() {
   DCHECK(sweeping_in_progress());
   CHECK(state_->IsDone());
   state_->MergeTo(this);
+  if (ArrayBufferExtension* deferred = state_->TakeDeferredFree()) {
+    FreeOnBackgroundThread(deferred);
+  }
   state_.reset();
   DCHECK(!sweeping_in_progress());
 }
@@ -353,6 +410,20 @@ void ArrayBufferSweeper::ReleaseAll(ArrayBufferList* list) {
   *list = ArrayBufferList(list->age_);
 }
 
+void ArrayBufferSweeper::FreeOnBackgroundThread(ArrayBufferExtension* head) {
+  // Freeing jobs are short, so the previous one is normally done by now.
+  JoinFreeingJob();
+  freeing_job_handle_ = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kBestEffort, std::make_unique<FreeingJob>(head));
+}
+
+void ArrayBufferSweeper::JoinFreeingJob() {
+  if (freeing_job_handle_ && freeing_job_handle_->IsValid()) {
+    freeing_job_handle_->Join();
+  }
+  freeing_job_handle_.reset();
+}
+
 void ArrayBufferSweeper::Append(ArrayBufferExtension* extension) {
   size_t bytes = extension->accounting_length();
 
@@ -424,15 +495,33 @@ void ArrayBufferSweeper::UpdateApproximateBytes(int64_t delta,
 void ArrayBufferSweeper::IncrementExternalMemoryCounters(size_t bytes) {
   if (bytes == 0) return;
   total_bytes_ += bytes;
-  external_memory_accounter_.Increase(
-      reinterpret_cast<v8::Isolate*>(heap_->isolate()), bytes);
+  pending_external_memory_ += bytes;
+  if (pending_external_memory_ >= kExternalMemoryBatchBytes) {
+    ReportPendingExternalMemory(true);
+  }
 }
 
 void ArrayBufferSweeper::DecrementExternalMemoryCounters(size_t bytes) {
   if (bytes == 0) return;
   total_bytes_ -= bytes;
-  external_memory_accounter_.Decrease(
-      reinterpret_cast<v8::Isolate*>(heap_->isolate()), bytes);
+  pending_external_memory_ -= bytes;
+  if (pending_external_memory_ <= -kExternalMemoryBatchBytes) {
+    ReportPendingExternalMemory(false);
+  }
+}
+
+void ArrayBufferSweeper::ReportPendingExternalMemory(bool gc_allowed) {
+  v8::Isolate* isolate = reinterpret_cast<v8::Isolate*>(heap_->isolate());
+  if (pending_external_memory_ < 0) {
+    external_memory_accounter_.Decrease(
+        isolate,
+        static_cast<size_t>(-std::exchange(pending_external_memory_, 0)));
+  } else if (pending_external_memory_ > 0 && gc_allowed) {
+    // Reset the batch first, as a GC triggered by the increase may add to it.
+    external_memory_accounter_.Increase(
+        isolate,
+        static_cast<size_t>(std::exchange(pending_external_memory_, 0)));
+  }
 }
 
 void ArrayBufferSweeper::FinalizeAndDelete(ArrayBufferExtension* extension) {
@@ -492,8 +581,9 @@ bool ArrayBufferSweeper::SweepingState::SweepingJob::SweepListFull(
     ArrayBufferExtension* next = current->next();
 
     if (!current->IsMarked()) {
-      freed_bytes += current->accounting_length();
-      FinalizeAndDelete(current);
+      const size_t bytes = current->accounting_length();
+      freed_bytes += bytes;
+      Free(delegate, current, bytes);
     } else {
       current->Unmark();
       accounted_bytes += new_old.Append(current);
@@ -537,7 +627,7 @@ bool ArrayBufferSweeper::SweepingState::SweepingJob::SweepYoung(
 
     if (!current->IsYoungMarked()) {
       const size_t bytes = current->accounting_length();
-      FinalizeAndDelete(current);
+      Free(delegate, current, bytes);
       if (bytes) freed_bytes += bytes;
     } else {
       if ((treat_all_young_as_promoted_ == TreatAllYoungAsPromoted::kYes) ||
@@ -563,6 +653,22 @@ bool ArrayBufferSweeper::SweepingState::SweepingJob::SweepYoung(
   return !current;
 }
 
+void ArrayBufferSweeper::SweepingState::SweepingJob::Free(
+    JobDelegate* delegate, ArrayBufferExtension* extension, size_t bytes) {
+  if (bytes < kBackgroundFreeThresholdBytes || !delegate->IsJoiningThread() ||
+      !state_.free_large_in_background_) {
+    FinalizeAndDelete(extension);
+    return;
+  }
+  // The external pointer table entry is zapped right away, as the worker may
+  // still be running during the next GC.
+#ifdef V8_COMPRESS_POINTERS
+  extension->ZapExternalPointerTableEntry();
+#endif  // V8_COMPRESS_POINTERS
+  extension->set_next(state_.deferred_free_);
+  state_.deferred_free_ = extension;
+}
+
 uint64_t ArrayBufferSweeper::GetTraceIdForFlowEvent() const {
   return reinterpret_cast<uint64_t>(this) ^ heap_->tracer()->CurrentEpoch();
 }
@@ -8,6 +8,7 @@
 #include <memory>
 
 #include "include/v8-external-memory-accounter.h"
+#include "include/v8-platform.h"
 #include "include/v8config.h"
 #include "src/api/api.h"
 #include "src/base/logging.h"
@@ -87,8 +88,19 @@ class ArrayBufferSweeper final {
   uint64_t GetTraceIdForFlowEvent() const;
 
  private:
+  class FreeingJob;
   class SweepingState;
 
+  // Changes of external memory are reported to the isolate once they add up
+  // to this many bytes, so that allocating and freeing many small buffers
+  // does not update the shared counter every time. This stays well below
+  // Heap::ExternalMemoryAccounting::kExternalAllocationLimitForInterrupt.
+  static constexpr int64_t kExternalMemoryBatchBytes = 16 * KB;
+  // Extensions whose backing stores are at least this large are not freed on
+  // the main thread when it ends up sweeping them itself, but handed to a
+  // worker instead.
+  static constexpr size_t kBackgroundFreeThresholdBytes = 1 * MB;
+
   // Finishes sweeping if it is already done.
   void FinishIfDone();
   void Finish();
@@ -99,6 +111,10 @@ class ArrayBufferSweeper final {
   // Increment may trigger GC.
   void IncrementExternalMemoryCounters(size_t bytes);
   void DecrementExternalMemoryCounters(size_t bytes);
+  // Reports the batched external memory changes to the isolate. A batched
+  // increase may trigger GC and is only reported if |gc_allowed|; it is less
+  // than kExternalMemoryBatchBytes then.
+  void ReportPendingExternalMemory(bool gc_allowed);
 
   void Prepare(SweepingType type,
                TreatAllYoungAsPromoted treat_all_young_as_promoted,
@@ -107,6 +123,10 @@ class ArrayBufferSweeper final {
 
   void ReleaseAll(ArrayBufferList* extension);
 
+  // Frees the given singly linked extensions on a worker thread.
+  void FreeOnBackgroundThread(ArrayBufferExtension* head);
+  void JoinFreeingJob();
+
   static void FinalizeAndDelete(ArrayBufferExtension* extension);
 
   Heap* const heap_;
@@ -119,7 +139,11 @@ class ArrayBufferSweeper final {
   int64_t young_bytes_adjustment_while_sweeping_{0};
   int64_t old_bytes_adjustment_while_sweeping_{0};
   uint64_t total_bytes_{0};
+  // External memory changes not yet reported through
+  // |external_memory_accounter_|.
+  int64_t pending_external_memory_{0};
   V8_NO_UNIQUE_ADDRESS ExternalMemoryAccounter external_memory_accounter_;
+  std::unique_ptr<JobHandle> freeing_job_handle_;
 };
 
 }  // namespace internal
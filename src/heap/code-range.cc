@@ -172,6 +172,7 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
   params.base_alignment =
       VirtualMemoryCage::ReservationParams::kAnyBaseAlignment;
   params.page_size = kPageSize;
+  params.use_huge_pages = v8_flags.transparent_huge_pages;
   if (v8_flags.jitless) {
     params.permissions = PageAllocator::Permission::kNoAccess;
     params.page_initialization_mode =
@@ -45,6 +45,9 @@ void CodeStatistics::RecordCodeAndMetadataStatistics(Tagged<HeapObject> object,
     isolate->code_kind_statistics()[static_cast<int>(code_kind)] +=
         abstract_code->Size(cage_base);
 #endif
+  } else if (IsFeedbackVector(object, cage_base)) {
+    isolate->set_feedback_vector_size(isolate->feedback_vector_size() +
+                                      object->Size(cage_base));
   }
 }
 
@@ -52,6 +55,7 @@ void CodeStatistics::ResetCodeAndMetadataStatistics(Isolate* isolate) {
   isolate->set_code_and_metadata_size(0);
   isolate->set_bytecode_and_metadata_size(0);
   isolate->set_external_script_source_size(0);
+  isolate->set_feedback_vector_size(0);
 #ifdef DEBUG
   ResetCodeStatistics(isolate);
 #endif
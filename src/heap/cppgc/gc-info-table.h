@@ -23,13 +23,18 @@ namespace internal {
 // inherit from GarbageCollected.
 struct GCInfo final {
   constexpr GCInfo(FinalizationCallback finalize, TraceCallback trace,
-                   NameCallback name)
-      : finalize(finalize), trace(trace), name(name) {}
+                   NameCallback name, bool finalize_concurrently = false)
+      : finalize(finalize),
+        trace(trace),
+        name(name),
+        finalize_concurrently(finalize_concurrently) {}
 
   FinalizationCallback finalize;
   TraceCallback trace;
   NameCallback name;
-  size_t padding = 0;
+  // |finalize| may be invoked on a concurrent sweeper thread. Takes the place
+  // of what used to be padding, so the entry size stays a power of two.
+  bool finalize_concurrently;
 };
 
 class V8_EXPORT GCInfoTable final {
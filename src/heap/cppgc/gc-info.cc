@@ -24,19 +24,20 @@ HeapObjectName GetHiddenName(
 // static
 GCInfoIndex EnsureGCInfoIndexTrait::EnsureGCInfoIndex(
     std::atomic<GCInfoIndex>& registered_index, TraceCallback trace_callback,
-    FinalizationCallback finalization_callback, NameCallback name_callback) {
+    FinalizationCallback finalization_callback, NameCallback name_callback,
+    bool finalize_concurrently) {
   return GlobalGCInfoTable::GetMutable().RegisterNewGCInfo(
-      registered_index,
-      GCInfo(finalization_callback, trace_callback, name_callback));
+      registered_index, GCInfo(finalization_callback, trace_callback,
+                               name_callback, finalize_concurrently));
 }
 
 // static
 GCInfoIndex EnsureGCInfoIndexTrait::EnsureGCInfoIndex(
     std::atomic<GCInfoIndex>& registered_index, TraceCallback trace_callback,
-    FinalizationCallback finalization_callback) {
+    FinalizationCallback finalization_callback, bool finalize_concurrently) {
   return GlobalGCInfoTable::GetMutable().RegisterNewGCInfo(
-      registered_index,
-      GCInfo(finalization_callback, trace_callback, GetHiddenName));
+      registered_index, GCInfo(finalization_callback, trace_callback,
+                               GetHiddenName, finalize_concurrently));
 }
 
 // static
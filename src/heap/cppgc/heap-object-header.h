@@ -104,6 +104,9 @@ class HeapObjectHeader {
   bool IsFree() const;
 
   inline bool IsFinalizable() const;
+  // Whether the finalizer may run on a concurrent sweeper thread. See
+  // CPPGC_FINALIZE_CONCURRENTLY().
+  inline bool IsConcurrentlyFinalizable() const;
   void Finalize();
 
 #if defined(CPPGC_CAGED_HEAP)
@@ -311,6 +314,11 @@ bool HeapObjectHeader::IsFinalizable() const {
   return gc_info.finalize;
 }
 
+bool HeapObjectHeader::IsConcurrentlyFinalizable() const {
+  const GCInfo& gc_info = GlobalGCInfoTable::GCInfoFromIndex(GetGCInfoIndex());
+  return gc_info.finalize_concurrently;
+}
+
 #if defined(CPPGC_CAGED_HEAP)
 void HeapObjectHeader::SetNextUnfinalized(HeapObjectHeader* next) {
 #if defined(CPPGC_POINTER_COMPRESSION)
@@ -108,9 +108,23 @@ class V8_EXPORT_PRIVATE NormalPageSpace final : public BaseSpace {
   FreeList& free_list() { return free_list_; }
   const FreeList& free_list() const { return free_list_; }
 
+  struct LinearAllocationBufferStats {
+    size_t refills_from_free_list = 0;
+    size_t refills_from_new_pages = 0;
+    size_t refilled_bytes = 0;
+  };
+
+  LinearAllocationBufferStats& linear_allocation_buffer_stats() {
+    return lab_stats_;
+  }
+  const LinearAllocationBufferStats& linear_allocation_buffer_stats() const {
+    return lab_stats_;
+  }
+
  private:
   LinearAllocationBuffer current_lab_;
   FreeList free_list_;
+  LinearAllocationBufferStats lab_stats_;
 };
 
 class V8_EXPORT_PRIVATE LargePageSpace final : public BaseSpace {
@@ -133,6 +133,14 @@ bool HeapStatisticsCollector::VisitNormalPageSpace(NormalPageSpace& space) {
 
   space.free_list().CollectStatistics(current_space_stats_->free_list_stats);
 
+  const auto& lab_stats = space.linear_allocation_buffer_stats();
+  auto& linear_allocation_stats = current_space_stats_->linear_allocation_stats;
+  linear_allocation_stats.refills_from_free_list =
+      lab_stats.refills_from_free_list;
+  linear_allocation_stats.refills_from_new_pages =
+      lab_stats.refills_from_new_pages;
+  linear_allocation_stats.refilled_bytes = lab_stats.refilled_bytes;
+
   return false;
 }
 
@@ -244,6 +244,9 @@ bool ObjectAllocator::TryExpandAndRefillLinearAllocationBuffer(
   ReplaceLinearAllocationBuffer(space, stats_collector_,
                                 new_page->PayloadStart(),
                                 new_page->PayloadSize());
+  auto& lab_stats = space.linear_allocation_buffer_stats();
+  lab_stats.refills_from_new_pages++;
+  lab_stats.refilled_bytes += new_page->PayloadSize();
   return true;
 }
 
@@ -308,6 +311,9 @@ bool ObjectAllocator::TryRefillLinearAllocationBufferFromFreeList(
 
   ReplaceLinearAllocationBuffer(
       space, stats_collector_, static_cast<Address>(entry.address), entry.size);
+  auto& lab_stats = space.linear_allocation_buffer_stats();
+  lab_stats.refills_from_free_list++;
+  lab_stats.refilled_bytes += entry.size;
   return true;
 }
 
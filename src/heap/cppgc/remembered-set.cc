@@ -61,19 +61,21 @@ void InvalidateCompressedRememberedSlots(
 }
 
 void InvalidateUncompressedRememberedSlots(
-    std::set<void*>& slots, void* begin, void* end,
+    RememberedEntries<void*>& slots, void* begin, void* end,
     std::set<void*>& remembered_slots_for_verification) {
-  EraseFromSet(slots, begin, end);
+  slots.EraseRange(begin, end);
 #if DEBUG
   EraseFromSet(remembered_slots_for_verification, begin, end);
 #endif  // DEBUG
 #if defined(ENABLE_SLOW_DCHECKS)
   // Check that no remembered slots are referring to the freed area.
-  DCHECK(std::none_of(slots.begin(), slots.end(), [begin, end](void* slot) {
-    void* value = nullptr;
-    value = *reinterpret_cast<void**>(slot);
-    return begin <= value && value < end;
-  }));
+  const std::vector<void*>& remaining_slots = slots.entries();
+  DCHECK(std::none_of(remaining_slots.begin(), remaining_slots.end(),
+                      [begin, end](void* slot) {
+                        void* value = nullptr;
+                        value = *reinterpret_cast<void**>(slot);
+                        return begin <= value && value < end;
+                      }));
 #endif  // defined(ENABLE_SLOW_DCHECKS)
 }
 
@@ -205,7 +207,7 @@ class SlotRemover : HeapVisitor<SlotRemover> {
 // Visit remembered set that was recorded in the generational barrier.
 void VisitRememberedSlots(
     HeapBase& heap, MutatorMarkingState& mutator_marking_state,
-    const std::set<void*>& remembered_uncompressed_slots,
+    const RememberedEntries<void*>& remembered_uncompressed_slots,
     const std::set<void*>& remembered_slots_for_verification) {
   size_t objects_visited = 0;
   {
@@ -213,7 +215,7 @@ void VisitRememberedSlots(
                                        remembered_slots_for_verification);
     objects_visited += slot_visitor.Run();
   }
-  for (void* uncompressed_slot : remembered_uncompressed_slots) {
+  for (void* uncompressed_slot : remembered_uncompressed_slots.entries()) {
     auto* page = BasePage::FromInnerAddress(&heap, uncompressed_slot);
     DCHECK(page);
     VisitSlot<SlotType::kUncompressed>(
@@ -228,9 +230,9 @@ void VisitRememberedSlots(
 // Visits source objects that were recorded in the generational barrier for
 // slots.
 void VisitRememberedSourceObjects(
-    const std::set<HeapObjectHeader*>& remembered_source_objects,
+    const RememberedEntries<HeapObjectHeader*>& remembered_source_objects,
     Visitor& visitor) {
-  for (HeapObjectHeader* source_hoh : remembered_source_objects) {
+  for (HeapObjectHeader* source_hoh : remembered_source_objects.entries()) {
     DCHECK(source_hoh);
     // The age checking in the generational barrier is imprecise, since a card
     // may have mixed young/old objects. Check here precisely if the object is
@@ -290,7 +292,7 @@ void OldToNewRememberedSet::AddSlot(void* slot) {
 
 void OldToNewRememberedSet::AddUncompressedSlot(void* uncompressed_slot) {
   DCHECK(heap_.generational_gc_supported());
-  remembered_uncompressed_slots_.insert(uncompressed_slot);
+  remembered_uncompressed_slots_.Add(uncompressed_slot);
 #if defined(DEBUG)
   remembered_slots_for_verification_.insert(uncompressed_slot);
 #endif  // defined(DEBUG)
@@ -298,7 +300,7 @@ void OldToNewRememberedSet::AddUncompressedSlot(void* uncompressed_slot) {
 
 void OldToNewRememberedSet::AddSourceObject(HeapObjectHeader& hoh) {
   DCHECK(heap_.generational_gc_supported());
-  remembered_source_objects_.insert(&hoh);
+  remembered_source_objects_.Add(&hoh);
 }
 
 void OldToNewRememberedSet::AddWeakCallback(WeakCallbackItem item) {
@@ -328,7 +330,7 @@ void OldToNewRememberedSet::InvalidateRememberedSlotsInRange(void* begin,
 void OldToNewRememberedSet::InvalidateRememberedSourceObject(
     HeapObjectHeader& header) {
   DCHECK(heap_.generational_gc_supported());
-  remembered_source_objects_.erase(&header);
+  remembered_source_objects_.Erase(&header);
 }
 
 void OldToNewRememberedSet::Visit(
@@ -358,8 +360,8 @@ void OldToNewRememberedSet::Reset() {
   DCHECK(heap_.generational_gc_supported());
   SlotRemover slot_remover(heap_);
   slot_remover.Run();
-  remembered_uncompressed_slots_.clear();
-  remembered_source_objects_.clear();
+  remembered_uncompressed_slots_.Clear();
+  remembered_source_objects_.Clear();
 #if DEBUG
   remembered_slots_for_verification_.clear();
 #endif  // DEBUG
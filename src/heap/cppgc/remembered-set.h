@@ -9,7 +9,9 @@
 
 #if defined(CPPGC_YOUNG_GENERATION)
 
+#include <algorithm>
 #include <set>
+#include <vector>
 
 #include "src/base/macros.h"
 #include "src/heap/base/basic-slot-set.h"
@@ -28,6 +30,73 @@ class MutatorMarkingState;
 
 class SlotSet : public ::heap::base::BasicSlotSet<kSlotSize> {};
 
+// Entries recorded by the generational barrier. Recording an entry appends it
+// to a vector, which unlike inserting into a node-based set does not allocate
+// in the common case. Duplicates are removed in batches, whenever the vector
+// has doubled since the last compaction and before the entries are consumed,
+// so that repeated writes to the same slot only cost amortized constant
+// memory.
+template <typename T>
+class RememberedEntries final {
+ public:
+  void Add(T entry) {
+    if (!entries_.empty() && entries_.back() == entry) return;
+    entries_.push_back(entry);
+    if (entries_.size() >= 2 * compacted_size_ + kMinEntriesToCompact) {
+      Compact();
+    }
+  }
+
+  void Erase(T entry) {
+    Compact();
+    auto it = std::lower_bound(entries_.begin(), entries_.end(), entry);
+    if (it != entries_.end() && *it == entry) entries_.erase(it);
+    compacted_size_ = entries_.size();
+  }
+
+  // Erases all entries in [begin, end).
+  void EraseRange(T begin, T end) {
+    Compact();
+    entries_.erase(std::lower_bound(entries_.begin(), entries_.end(), begin),
+                   std::lower_bound(entries_.begin(), entries_.end(), end));
+    compacted_size_ = entries_.size();
+  }
+
+  void Clear() {
+    entries_.clear();
+    compacted_size_ = 0;
+  }
+
+  // Returns the distinct entries in ascending order.
+  const std::vector<T>& entries() const {
+    Compact();
+    return entries_;
+  }
+
+  bool empty() const { return entries_.empty(); }
+  size_t size() const { return entries().size(); }
+  size_t count(T entry) const {
+    const std::vector<T>& all = entries();
+    return std::binary_search(all.begin(), all.end(), entry) ? 1 : 0;
+  }
+
+ private:
+  static constexpr size_t kMinEntriesToCompact = 256;
+
+  void Compact() const {
+    if (compacted_size_ == entries_.size()) return;
+    std::sort(entries_.begin(), entries_.end());
+    entries_.erase(std::unique(entries_.begin(), entries_.end()),
+                   entries_.end());
+    compacted_size_ = entries_.size();
+  }
+
+  // Compaction does not change the set of entries, so it is allowed on const
+  // access.
+  mutable std::vector<T> entries_;
+  mutable size_t compacted_size_ = 0;
+};
+
 // OldToNewRememberedSet represents a per-heap set of old-to-new references.
 class V8_EXPORT_PRIVATE OldToNewRememberedSet final {
  public:
@@ -78,12 +147,12 @@ class V8_EXPORT_PRIVATE OldToNewRememberedSet final {
   } compare_parameter{};
 
   HeapBase& heap_;
-  std::set<HeapObjectHeader*> remembered_source_objects_;
+  RememberedEntries<HeapObjectHeader*> remembered_source_objects_;
   std::set<WeakCallbackItem, decltype(compare_parameter)>
       remembered_weak_callbacks_;
   // Compressed slots are stored in slot-sets (per-page two-level bitmaps),
-  // whereas uncompressed are stored in std::set.
-  std::set<void*> remembered_uncompressed_slots_;
+  // whereas uncompressed are stored in a sorted vector.
+  RememberedEntries<void*> remembered_uncompressed_slots_;
   std::set<void*> remembered_slots_for_verification_;
   RememberedInConstructionObjects remembered_in_construction_objects_;
 };
@@ -302,7 +302,7 @@ class DeferredFinalizationBuilder final : public FreeHandler {
   }
 
   void AddFinalizer(HeapObjectHeader* header, size_t size) {
-    if (header->IsFinalizable()) {
+    if (header->IsFinalizable() && !header->IsConcurrentlyFinalizable()) {
 #if defined(CPPGC_CAGED_HEAP)
       if (!current_unfinalized_) {
         DCHECK_NULL(result_.unfinalized_objects_head);
@@ -317,6 +317,10 @@ class DeferredFinalizationBuilder final : public FreeHandler {
 #endif  // !defined(CPPGC_CAGED_HEAP)
       found_finalizer_ = true;
     } else {
+      // Objects that opted into concurrent finalization are finalized right
+      // away, so that their memory can be freed without a round trip through
+      // the mutator thread.
+      if (header->IsFinalizable()) header->Finalize();
       SetMemoryInaccessible(header, size);
     }
   }
@@ -846,12 +850,17 @@ class ConcurrentSweepTask final : public cppgc::JobTask,
     HeapObjectHeader* header = page.ObjectHeader();
     CHECK(!header->IsMarked());
     DCHECK_EQ(page.marked_bytes(), 0u);
+    bool needs_finalization = header->IsFinalizable();
+    if (needs_finalization && header->IsConcurrentlyFinalizable()) {
+      header->Finalize();
+      needs_finalization = false;
+    }
 #if defined(CPPGC_CAGED_HEAP)
     HeapObjectHeader* const unfinalized_objects =
-        header->IsFinalizable() ? page.ObjectHeader() : nullptr;
+        needs_finalization ? page.ObjectHeader() : nullptr;
 #else   // !defined(CPPGC_CAGED_HEAP)
     std::vector<HeapObjectHeader*> unfinalized_objects;
-    if (header->IsFinalizable()) {
+    if (needs_finalization) {
       unfinalized_objects.push_back(page.ObjectHeader());
     }
 #endif  // !defined(CPPGC_CAGED_HEAP)
@@ -44,6 +44,8 @@ void FinalizationRegistryCleanupTask::RunInternal() {
 
   // First clear that the task is posted in case of early returns below.
   heap_->set_is_finalization_registry_cleanup_task_posted(false);
+  heap_->set_last_finalization_registry_cleanup_ms(
+      heap_->MonotonicallyIncreasingTimeInMs());
 
   HandleScope handle_scope(isolate);
   DirectHandle<JSFinalizationRegistry> finalization_registry;
@@ -67,6 +67,25 @@ GCTracer::Scope::~Scope() {
         duration.InMicroseconds();
   }
 
+  if (V8_UNLIKELY(tracer_->latency_histograms_)) {
+    switch (scope_) {
+      case ScopeId::TIME_TO_SAFEPOINT:
+      case ScopeId::TIME_TO_GLOBAL_SAFEPOINT:
+        tracer_->RecordLatency(
+            &v8::metrics::GCLatencyHistograms::time_to_safepoint_us, duration);
+        break;
+      case ScopeId::MC_INCREMENTAL:
+      case ScopeId::MC_INCREMENTAL_START:
+      case ScopeId::MC_INCREMENTAL_SWEEPING:
+        tracer_->RecordLatency(
+            &v8::metrics::GCLatencyHistograms::full_incremental_step_us,
+            duration);
+        break;
+      default:
+        break;
+    }
+  }
+
 #ifdef V8_RUNTIME_CALL_STATS
   if (V8_LIKELY(runtime_stats_ == nullptr)) return;
   runtime_stats_->Leave(&timer_);
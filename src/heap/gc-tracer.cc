@@ -4,8 +4,10 @@
 
 #include "src/heap/gc-tracer.h"
 
+#include <cmath>
 #include <cstdarg>
 #include <limits>
+#include <memory>
 #include <optional>
 
 #include "include/v8-metrics.h"
@@ -221,6 +223,10 @@ GCTracer::GCTracer(Heap* heap, base::TimeTicks startup_time,
   // event's end time to compute time spent in mutator.
   current_.end_time = previous_mark_compact_end_time_;
 
+  if (v8_flags.gc_latency_histograms) {
+    latency_histograms_ = std::make_unique<v8::metrics::GCLatencyHistograms>();
+  }
+
   TRACE_EVENT_BEGIN(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
                     perfetto::StaticString(ToString(*current_.priority)),
                     priority_track_);
@@ -453,6 +459,10 @@ void GCTracer::StopObservablePause(GarbageCollector collector,
                              duration + current_.incremental_marking_duration);
   }
 
+  if (V8_UNLIKELY(latency_histograms_)) {
+    RecordPauseLatencies(is_young, duration);
+  }
+
   heap_->UpdateTotalGCTime(duration);
 
   if (heap_->is_gc_tracing_category_enabled()) {
@@ -1261,6 +1271,53 @@ void GCTracer::RecordMutatorUtilization(base::TimeTicks mark_compact_end_time,
   previous_mark_compact_end_time_ = mark_compact_end_time;
 }
 
+v8::metrics::GCLatencyHistograms GCTracer::GetLatencyHistograms() const {
+  base::MutexGuard guard(&latency_histograms_mutex_);
+  if (!latency_histograms_) return {};
+  return *latency_histograms_;
+}
+
+void GCTracer::ResetLatencyHistograms() {
+  base::MutexGuard guard(&latency_histograms_mutex_);
+  if (!latency_histograms_) return;
+  *latency_histograms_ = {};
+}
+
+void GCTracer::RecordLatency(LatencyHistogramField histogram,
+                             base::TimeDelta value) {
+  RecordLatency(histogram, value.InMicroseconds());
+}
+
+void GCTracer::RecordLatency(LatencyHistogramField histogram, int64_t value) {
+  DCHECK(latency_histograms_);
+  base::MutexGuard guard(&latency_histograms_mutex_);
+  ((*latency_histograms_).*histogram).Record(value);
+}
+
+void GCTracer::RecordPauseLatencies(bool is_young, base::TimeDelta duration) {
+  using Histograms = v8::metrics::GCLatencyHistograms;
+  if (is_young) {
+    RecordLatency(&Histograms::young_pause_us, duration);
+    return;
+  }
+  // The phases are split up like for GarbageCollectionFullCycle.
+  RecordLatency(&Histograms::full_atomic_pause_us, duration);
+  RecordLatency(&Histograms::full_atomic_mark_us,
+                current_.scopes[Scope::MC_PROLOGUE] +
+                    current_.scopes[Scope::MC_MARK]);
+  RecordLatency(&Histograms::full_atomic_weak_us,
+                current_.scopes[Scope::MC_CLEAR]);
+  RecordLatency(&Histograms::full_atomic_compact_us,
+                current_.scopes[Scope::MC_EVACUATE] +
+                    current_.scopes[Scope::MC_FINISH] +
+                    current_.scopes[Scope::MC_EPILOGUE]);
+  RecordLatency(&Histograms::full_atomic_sweep_us,
+                current_.scopes[Scope::MC_SWEEP]);
+  const double utilization = current_mark_compact_mutator_utilization_;
+  RecordLatency(&Histograms::mutator_utilization_percent,
+                static_cast<int64_t>(std::round(100 * utilization)));
+}
+
 double GCTracer::AverageMarkCompactMutatorUtilization() const {
   double average_total_duration =
       average_mark_compact_duration_ + average_mutator_duration_;
@@ -1573,6 +1630,7 @@ void GCTracer::ReportFullCycleToRecorder() {
   if (!recorder->HasEmbedderRecorder()) {
     incremental_mark_batched_events_ = {};
     incremental_sweep_batched_events_ = {};
+    marked_bytes_per_context_.clear();
     if (cpp_heap) {
       cpp_heap->GetMetricRecorder()->ClearCachedEvents();
     }
@@ -1782,6 +1840,44 @@ void GCTracer::ReportFullCycleToRecorder() {
   }
 
   recorder->AddMainThreadEvent(event, GetContextId(heap_->isolate()));
+  ReportContextCostsToRecorder(recorder.get(), event);
+}
+
+void GCTracer::NotifyMarkedBytesPerContext(MarkedBytesPerContext marked_bytes) {
+  DCHECK(v8_flags.gc_per_context_cost);
+  marked_bytes_per_context_ = std::move(marked_bytes);
+}
+
+void GCTracer::ReportContextCostsToRecorder(
+    v8::metrics::Recorder* recorder,
+    const v8::metrics::GarbageCollectionFullCycle& cycle) {
+  MarkedBytesPerContext marked_bytes;
+  marked_bytes.swap(marked_bytes_per_context_);
+  size_t total_bytes = 0;
+  for (const auto& [context_id, bytes] : marked_bytes) total_bytes += bytes;
+  if (total_bytes == 0) return;
+
+  // Sweeping is not tracked per context, so it is split by the live bytes the
+  // contexts left behind on the swept pages, just like marking.
+  for (const auto& [context_id, bytes] : marked_bytes) {
+    const double share = static_cast<double>(bytes) / total_bytes;
+    auto split = [share](int64_t duration) -> int64_t {
+      if (duration < 0) return -1;
+      return static_cast<int64_t>(duration * share);
+    };
+    v8::metrics::GarbageCollectionFullCycleContextCost event;
+    event.marked_bytes = static_cast<int64_t>(bytes);
+    event.marked_bytes_share = share;
+    event.total_mark_wall_clock_duration_in_us =
+        split(cycle.total.mark_wall_clock_duration_in_us);
+    event.total_sweep_wall_clock_duration_in_us =
+        split(cycle.total.sweep_wall_clock_duration_in_us);
+    event.main_thread_mark_wall_clock_duration_in_us =
+        split(cycle.main_thread.mark_wall_clock_duration_in_us);
+    event.main_thread_sweep_wall_clock_duration_in_us =
+        split(cycle.main_thread.sweep_wall_clock_duration_in_us);
+    recorder->AddMainThreadEvent(event, context_id);
+  }
 }
 
 void GCTracer::ReportIncrementalMarkingStepToRecorder(double v8_duration) {
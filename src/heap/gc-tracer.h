@@ -6,6 +6,8 @@
 #define V8_HEAP_GC_TRACER_H_
 
 #include <optional>
+#include <utility>
+#include <vector>
 
 #include "include/v8-metrics.h"
 #include "src/base/compiler-specific.h"
@@ -459,9 +461,23 @@ class V8_EXPORT_PRIVATE GCTracer {
   // pause. Used for computing/updating code flushing increase.
   void NotifyMarkingStart();
 
+  using MarkedBytesPerContext =
+      std::vector<std::pair<v8::metrics::Recorder::ContextId, size_t>>;
+
+  // Invoked at the end of full marking with the bytes that were marked for
+  // each native context, if --gc-per-context-cost is enabled. The cycle's
+  // marking and sweeping times are split between the contexts in proportion
+  // to them when the cycle is reported to the metrics recorder.
+  void NotifyMarkedBytesPerContext(MarkedBytesPerContext marked_bytes);
+
   // Returns the current cycle's code flushing increase in seconds.
   uint16_t CodeFlushingIncrease() const;
 
+  // Returns a copy of, or resets, the histograms collected with
+  // --gc-latency-histograms. Can be called from any thread.
+  v8::metrics::GCLatencyHistograms GetLatencyHistograms() const;
+  void ResetLatencyHistograms();
+
   // Returns average mutator utilization with respect to mark-compact
   // garbage collections. This ignores scavenger.
   double AverageMarkCompactMutatorUtilization() const;
@@ -535,6 +551,16 @@ class V8_EXPORT_PRIVATE GCTracer {
   void ReportIncrementalMarkingStepToRecorder(double v8_duration);
   void ReportIncrementalSweepingStepToRecorder(double v8_duration);
   void ReportYoungCycleToRecorder();
+  using LatencyHistogramField =
+      v8::metrics::LatencyHistogram v8::metrics::GCLatencyHistograms::*;
+  void RecordLatency(LatencyHistogramField histogram, base::TimeDelta value);
+  void RecordLatency(LatencyHistogramField histogram, int64_t value);
+  // Records the observable pause that just ended, see --gc-latency-histograms.
+  void RecordPauseLatencies(bool is_young, base::TimeDelta duration);
+
+  void ReportContextCostsToRecorder(
+      v8::metrics::Recorder* recorder,
+      const v8::metrics::GarbageCollectionFullCycle& cycle);
 
   // Pointer to the heap that owns this tracer.
   Heap* heap_;
@@ -629,9 +655,16 @@ class V8_EXPORT_PRIVATE GCTracer {
   v8::metrics::GarbageCollectionFullMainThreadBatchedIncrementalSweep
       incremental_sweep_batched_events_;
 
+  // Marked bytes per native context of the current full GC cycle.
+  MarkedBytesPerContext marked_bytes_per_context_;
+
   mutable base::Mutex background_scopes_mutex_;
   base::TimeDelta background_scopes_[Scope::NUMBER_OF_SCOPES];
 
+  // Only allocated with --gc-latency-histograms.
+  std::unique_ptr<v8::metrics::GCLatencyHistograms> latency_histograms_;
+  mutable base::Mutex latency_histograms_mutex_;
+
   perfetto::NamedTrack parent_track_;
   perfetto::NamedTrack phase_track_;
   perfetto::NamedTrack state_track_;
@@ -4,7 +4,10 @@
 
 #include "src/heap/heap-controller.h"
 
+#include <algorithm>
+
 #include "src/execution/isolate-inl.h"
+#include "src/heap/page-metadata.h"
 #include "src/heap/spaces.h"
 #include "src/tracing/trace-event.h"
 
@@ -167,5 +170,36 @@ size_t MemoryController<Trait>::BoundAllocationLimit(
 template class V8_EXPORT_PRIVATE MemoryController<V8HeapTrait>;
 template class V8_EXPORT_PRIVATE MemoryController<GlobalMemoryTrait>;
 
+// static
+std::optional<size_t> NewSpaceController::TargetCapacity(
+    Heap* heap, double target_pause_ms, std::optional<double> scavenge_speed,
+    double survival_percent, double allocation_throughput, size_t min_capacity,
+    size_t max_capacity) {
+  DCHECK_LT(0, target_pause_ms);
+  DCHECK_LE(min_capacity, max_capacity);
+  if (!scavenge_speed.has_value()) return std::nullopt;
+  // Treat everything dying as a tiny survival rate to stay finite.
+  constexpr double kMinSurvivalPercent = 0.1;
+  double capacity = target_pause_ms * *scavenge_speed * 100 /
+                    std::max(survival_percent, kMinSurvivalPercent);
+  if (allocation_throughput > 0) {
+    capacity =
+        std::min(capacity, allocation_throughput * kMaxAllocationWindowMs);
+  }
+  capacity = std::clamp(capacity, static_cast<double>(min_capacity),
+                        static_cast<double>(max_capacity));
+  const size_t result = std::clamp(
+      ::RoundDown(static_cast<size_t>(capacity), PageMetadata::kPageSize),
+      min_capacity, max_capacity);
+  if (V8_UNLIKELY(v8_flags.trace_gc_verbose)) {
+    Isolate::FromHeap(heap)->PrintWithTimestamp(
+        "[NewSpaceController] capacity %zu KB based on pause=%.1f ms, "
+        "speed=%.f, survival=%.1f%%, allocation=%.f\n",
+        result / KB, target_pause_ms, *scavenge_speed, survival_percent,
+        allocation_throughput);
+  }
+  return result;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -6,6 +6,8 @@
 #define V8_HEAP_HEAP_CONTROLLER_H_
 
 #include <cstddef>
+#include <optional>
+
 #include "src/heap/heap.h"
 #include "src/utils/allocation.h"
 #include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
@@ -55,6 +57,32 @@ class V8_EXPORT_PRIVATE MemoryController : public AllStatic {
   FRIEND_TEST(MemoryControllerTest, MaxHeapGrowingFactor);
 };
 
+// Picks the new space capacity for a target scavenge pause. A scavenge copies
+// the objects that survive it, so its pause is roughly
+//
+//   capacity * survival_ratio / scavenge_speed
+//
+// where the speed is measured in surviving bytes per millisecond. Solving for
+// the capacity gives large new spaces to allocation-heavy code whose objects
+// die young, and small ones to code whose objects mostly survive. The
+// capacity is further bounded by what is allocated within
+// kMaxAllocationWindowMs, so that mostly idle code does not keep large, empty
+// new spaces around.
+class V8_EXPORT_PRIVATE NewSpaceController : public AllStatic {
+ public:
+  static constexpr double kMaxAllocationWindowMs = 1000;
+
+  // Returns a capacity aligned to the page size and within
+  // [min_capacity, max_capacity], or nullopt if no scavenge speed was
+  // recorded yet. |survival_percent| is the percentage of new space objects
+  // that survived recent scavenges, |allocation_throughput| is in bytes per
+  // millisecond and ignored if 0.
+  static std::optional<size_t> TargetCapacity(
+      Heap* heap, double target_pause_ms, std::optional<double> scavenge_speed,
+      double survival_percent, double allocation_throughput,
+      size_t min_capacity, size_t max_capacity);
+};
+
 }  // namespace internal
 }  // namespace v8
 
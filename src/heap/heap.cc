@@ -134,6 +134,7 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/zone/accounting-allocator.h"
 #include "third_party/rapidhash-v8/secret.h"
 
 #if V8_ENABLE_WEBASSEMBLY
@@ -1236,6 +1237,17 @@ void Heap::GarbageCollectionEpilogue(GarbageCollector collector) {
   if (v8_flags.code_stats) ReportCodeStatistics("After GC");
 #endif  // DEBUG
 
+#if V8_ENABLE_WEBASSEMBLY
+  if (collector == GarbageCollector::MARK_COMPACTOR &&
+      v8_flags.wasm_flush_cold_liftoff_code) {
+    wasm::GetWasmEngine()->FlushColdCode(isolate_);
+  }
+#endif  // V8_ENABLE_WEBASSEMBLY
+
+  if (collector == GarbageCollector::MARK_COMPACTOR) {
+    isolate_->allocator()->TrimSegmentPool();
+  }
+
   last_gc_time_ = MonotonicallyIncreasingTimeInMs();
 }
 
@@ -1329,6 +1341,7 @@ void FreeCachesOnMemoryPressure(Isolate* isolate) {
   isolate->AbortConcurrentOptimization(BlockingBehavior::kDontBlock);
   isolate->ClearSerializerData();
   isolate->compilation_cache()->Clear();
+  isolate->allocator()->ReleaseSegmentPool();
 
   // TODO(ishell): consider trimming number to string caches to initial size.
 
@@ -3932,6 +3945,7 @@ void Heap::ActivateMemoryReducerIfNeededOnMainThread() {
 }
 
 Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpace() {
+  new_space_target_capacity_ = 0;
   if (ShouldReduceMemory()) {
     return (v8_flags.predictable) ? ResizeNewSpaceMode::kNone
                                   : ResizeNewSpaceMode::kShrink;
@@ -3940,6 +3954,24 @@ Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpace() {
   static const size_t kLowAllocationThroughput = 1000;
   const double allocation_throughput =
       tracer_->AllocationThroughputInBytesPerMillisecond();
+
+  if (v8_flags.new_space_target_pause_ms > 0 && !v8_flags.predictable &&
+      tracer_->SurvivalEventsRecorded()) {
+    std::optional<size_t> target_capacity = NewSpaceController::TargetCapacity(
+        this, v8_flags.new_space_target_pause_ms,
+        tracer_->YoungGenerationSpeedInBytesPerMillisecond(
+            YoungGenerationSpeedMode::kOnlyAtomicPause),
+        tracer_->AverageSurvivalRatio(),
+        tracer_->NewSpaceAllocationThroughputInBytesPerMillisecond(),
+        new_space_->MinimumCapacity(), new_space_->MaximumCapacity());
+    if (target_capacity.has_value()) {
+      const size_t capacity = new_space_->TotalCapacity();
+      if (*target_capacity == capacity) return ResizeNewSpaceMode::kNone;
+      new_space_target_capacity_ = *target_capacity;
+      return *target_capacity > capacity ? ResizeNewSpaceMode::kGrow
+                                         : ResizeNewSpaceMode::kShrink;
+    }
+  }
   const bool should_shrink = !v8_flags.predictable &&
                              (allocation_throughput != 0) &&
                              (allocation_throughput < kLowAllocationThroughput);
@@ -3955,9 +3987,10 @@ Heap::ResizeNewSpaceMode Heap::ShouldResizeNewSpace() {
 }
 
 namespace {
-size_t ComputeReducedNewSpaceSize(NewSpace* new_space) {
-  size_t new_capacity =
-      std::max(new_space->MinimumCapacity(), 2 * new_space->Size());
+size_t ComputeReducedNewSpaceSize(NewSpace* new_space,
+                                  size_t target_capacity) {
+  size_t new_capacity = std::max(
+      {new_space->MinimumCapacity(), 2 * new_space->Size(), target_capacity});
   size_t rounded_new_capacity =
       ::RoundUp(new_capacity, PageMetadata::kPageSize);
   DCHECK_LE(new_space->TotalCapacity(), new_space->MaximumCapacity());
@@ -3970,7 +4003,8 @@ void Heap::StartResizeNewSpace() {
   DCHECK(v8_flags.minor_ms);
   resize_new_space_mode_ = ShouldResizeNewSpace();
   if (resize_new_space_mode_ == ResizeNewSpaceMode::kShrink) {
-    size_t reduced_capacity = ComputeReducedNewSpaceSize(new_space());
+    size_t reduced_capacity =
+        ComputeReducedNewSpaceSize(new_space(), new_space_target_capacity_);
     paged_new_space()->StartShrinking(reduced_capacity);
   }
 }
@@ -3999,10 +4033,13 @@ void Heap::ExpandNewSpaceSizeForTesting() { ExpandNewSpaceSize(); }
 
 void Heap::ExpandNewSpaceSize() {
   // Grow the size of new space if there is room to grow, and enough data
-  // has survived scavenge since the last expansion.
+  // has survived scavenge since the last expansion or the NewSpaceController
+  // asked for it.
   const size_t suggested_capacity =
-      static_cast<size_t>(v8_flags.semi_space_growth_factor) *
-      new_space_->TotalCapacity();
+      new_space_target_capacity_ > 0
+          ? new_space_target_capacity_
+          : static_cast<size_t>(v8_flags.semi_space_growth_factor) *
+                new_space_->TotalCapacity();
   const size_t chosen_capacity =
       std::min(suggested_capacity, new_space_->MaximumCapacity());
   DCHECK(IsAligned(chosen_capacity, PageMetadata::kPageSize));
@@ -4011,17 +4048,20 @@ void Heap::ExpandNewSpaceSize() {
     new_space_->Grow(chosen_capacity);
     new_lo_space()->SetCapacity(new_space()->TotalCapacity());
   }
+  new_space_target_capacity_ = 0;
 }
 
 void Heap::ReduceNewSpaceSize() {
   if (!v8_flags.minor_ms) {
-    const size_t reduced_capacity = ComputeReducedNewSpaceSize(new_space());
+    const size_t reduced_capacity =
+        ComputeReducedNewSpaceSize(new_space(), new_space_target_capacity_);
     semi_space_new_space()->Shrink(reduced_capacity);
   } else {
     // MinorMS starts shrinking new space as part of sweeping.
     paged_new_space()->FinishShrinking();
   }
   new_lo_space_->SetCapacity(new_space()->TotalCapacity());
+  new_space_target_capacity_ = 0;
 }
 
 size_t Heap::NewSpaceSize() {
@@ -4449,6 +4489,7 @@ void Heap::CollectCodeStatistics() {
   // somehow ends up in those spaces, we would miss it here.
   CodeStatistics::CollectCodeStatistics(code_space_, isolate());
   CodeStatistics::CollectCodeStatistics(old_space_, isolate());
+  CodeStatistics::CollectCodeStatistics(lo_space_, isolate());
   CodeStatistics::CollectCodeStatistics(code_lo_space_, isolate());
   CodeStatistics::CollectCodeStatistics(trusted_space_, isolate());
   CodeStatistics::CollectCodeStatistics(trusted_lo_space_, isolate());
@@ -6521,6 +6562,8 @@ void Heap::StartTearDown() {
   // the heap during teardown.
   CompleteSweepingFull(CompleteSweepingReason::kTearDown);
 
+  pretenuring_handler_.WriteProfileIfNeeded();
+
   if (v8_flags.concurrent_marking) {
     concurrent_marking()->Pause();
   }
@@ -7295,8 +7338,21 @@ void Heap::PostFinalizationRegistryCleanupTaskIfNeeded() {
       is_finalization_registry_cleanup_task_posted_) {
     return;
   }
+  // Cleanup callbacks are not urgent, so keep them out of the way of
+  // latency-sensitive tasks, and space them out by at least
+  // --finalization-registry-cleanup-interval-ms.
+  std::shared_ptr<v8::TaskRunner> task_runner =
+      GetForegroundTaskRunner(TaskPriority::kBestEffort);
   auto task = std::make_unique<FinalizationRegistryCleanupTask>(this);
-  task_runner_->PostNonNestableTask(std::move(task));
+  const double delay_ms = last_finalization_registry_cleanup_ms_ +
+                          v8_flags.finalization_registry_cleanup_interval_ms -
+                          MonotonicallyIncreasingTimeInMs();
+  if (delay_ms > 0 && task_runner->NonNestableDelayedTasksEnabled()) {
+    task_runner->PostNonNestableDelayedTask(
+        std::move(task), delay_ms / base::Time::kMillisecondsPerSecond);
+  } else {
+    task_runner->PostNonNestableTask(std::move(task));
+  }
   is_finalization_registry_cleanup_task_posted_ = true;
 }
 
@@ -1046,6 +1046,10 @@ class Heap final {
     is_finalization_registry_cleanup_task_posted_ = posted;
   }
 
+  void set_last_finalization_registry_cleanup_ms(double time_ms) {
+    last_finalization_registry_cleanup_ms_ = time_ms;
+  }
+
   bool is_finalization_registry_cleanup_task_posted() {
     return is_finalization_registry_cleanup_task_posted_;
   }
@@ -2312,6 +2316,10 @@ class Heap final {
   // scavenge since last new space expansion.
   size_t survived_since_last_expansion_ = 0;
 
+  // Capacity chosen by the NewSpaceController for the next resize of new
+  // space, or 0 if it did not choose one.
+  size_t new_space_target_capacity_ = 0;
+
   // This is not the depth of nested AlwaysAllocateScope's but rather a single
   // count, as scopes can be acquired from multiple tasks (read: threads).
   std::atomic<size_t> always_allocate_scope_count_{0};
@@ -2573,6 +2581,8 @@ class Heap final {
   std::vector<HeapObjectAllocationTracker*> allocation_trackers_;
 
   bool is_finalization_registry_cleanup_task_posted_ = false;
+  // When the last FinalizationRegistryCleanupTask ran, for rate limiting.
+  double last_finalization_registry_cleanup_ms_ = 0;
 
   bool is_external_memory_limit_updates_suspended_ = false;
 
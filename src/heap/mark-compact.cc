@@ -364,6 +364,7 @@ bool MarkCompactCollector::StartCompaction(StartCompactionMode mode) {
     return false;
   }
 
+  evacuation_budget_bytes_ = ComputeEvacuationBudget();
   CollectEvacuationCandidates(heap_->old_space());
 
   // Don't compact shared space when CSS is enabled, since there may be
@@ -454,7 +455,8 @@ void MarkCompactCollector::StartMarking(
 
   std::vector<Address> contexts =
       heap_->memory_measurement()->StartProcessing();
-  if (v8_flags.stress_per_context_marking_worklist) {
+  if (v8_flags.stress_per_context_marking_worklist ||
+      v8_flags.gc_per_context_cost) {
     contexts.clear();
     HandleScope handle_scope(heap_->isolate());
     for (auto context : heap_->FindAllNativeContexts()) {
@@ -535,6 +537,7 @@ void MarkCompactCollector::CollectGarbage() {
   }
 
   heap_->memory_measurement()->FinishProcessing(native_context_stats_);
+  if (v8_flags.gc_per_context_cost) RecordMarkedBytesPerContext();
 
   Sweep();
   Evacuate();
@@ -638,6 +641,21 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
   }
 }
 
+size_t MarkCompactCollector::ComputeEvacuationBudget() const {
+  if (v8_flags.compaction_pause_budget_ms <= 0 || heap_->ShouldReduceMemory()) {
+    return SIZE_MAX;
+  }
+  const std::optional<double> compaction_speed =
+      heap_->tracer()->CompactionSpeedInBytesPerMillisecond();
+  if (!compaction_speed.has_value()) return SIZE_MAX;
+  // Candidates are picked from the most fragmented pages first, so pages that
+  // do not fit into this cycle's budget are picked up by the following
+  // cycles, which spreads the compaction of a fragmented heap over several
+  // pauses.
+  return static_cast<size_t>(v8_flags.compaction_pause_budget_ms *
+                             *compaction_speed);
+}
+
 void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
   DCHECK(space->identity() == OLD_SPACE || space->identity() == CODE_SPACE ||
          space->identity() == SHARED_SPACE ||
@@ -664,6 +682,16 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     //   compacted.
     ComputeEvacuationHeuristics(area_size, &target_fragmentation_percent,
                                 &max_evacuated_bytes);
+    max_evacuated_bytes =
+        std::min(max_evacuated_bytes, evacuation_budget_bytes_);
+    if (space->identity() == CODE_SPACE &&
+        v8_flags.compaction_target_fragmentation_percent_for_code_space > 0) {
+      // Code spread over many pages costs instruction TLB entries on top of
+      // memory, so code pages may qualify at a lower fragmentation.
+      target_fragmentation_percent = std::min<int>(
+          target_fragmentation_percent,
+          v8_flags.compaction_target_fragmentation_percent_for_code_space);
+    }
     free_bytes_threshold = target_fragmentation_percent * (area_size / 100);
   }
 
@@ -778,6 +806,12 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     for (int i = 0; i < candidate_count; i++) {
       AddEvacuationCandidate(pages[i].second);
     }
+    if (in_standard_path && candidate_count > 0) {
+      DCHECK_LE(total_live_bytes, evacuation_budget_bytes_);
+      if (evacuation_budget_bytes_ != SIZE_MAX) {
+        evacuation_budget_bytes_ -= total_live_bytes;
+      }
+    }
   }
 
   if (v8_flags.trace_fragmentation) {
@@ -2467,6 +2501,32 @@ void MarkCompactCollector::ProcessTopOptimizedFrame(ObjectVisitor* visitor,
   }
 }
 
+void MarkCompactCollector::RecordMarkedBytesPerContext() {
+  Isolate* const isolate = heap_->isolate();
+  GCTracer::MarkedBytesPerContext marked_bytes;
+  size_t unattributed_bytes = 0;
+  native_context_stats_.Iterate([&](Address context, size_t size) {
+    if (context != MarkingWorklists::kSharedContext &&
+        context != MarkingWorklists::kOtherContext) {
+      Tagged<Object> object(context);
+      if (IsNativeContext(object)) {
+        auto id = isolate->GetRecorderContextIdNoRegister(
+            Cast<NativeContext>(object));
+        if (!id.IsEmpty()) {
+          marked_bytes.emplace_back(id, size);
+          return;
+        }
+      }
+    }
+    unattributed_bytes += size;
+  });
+  if (unattributed_bytes > 0) {
+    marked_bytes.emplace_back(v8::metrics::Recorder::ContextId::Empty(),
+                              unattributed_bytes);
+  }
+  heap_->tracer()->NotifyMarkedBytesPerContext(std::move(marked_bytes));
+}
+
 void MarkCompactCollector::RecordObjectStats() {
   if (V8_LIKELY(!TracingFlags::is_gc_stats_enabled())) return;
   // Cannot run during bootstrapping due to incomplete objects.
@@ -2502,6 +2562,11 @@ bool ShouldRetainMap(Heap* heap, MarkingState* marking_state, Tagged<Map> map,
     // The map has aged. Do not retain this map.
     return false;
   }
+  if (v8_flags.prune_deprecated_transitions && map->is_deprecated()) {
+    // No new objects get a deprecated map, so retaining it would only keep a
+    // dead branch of the transition tree alive.
+    return false;
+  }
   Tagged<Object> constructor = map->GetConstructor();
   if (!IsHeapObject(constructor) ||
       MarkingHelper::IsUnmarkedAndNotAlwaysLive(
@@ -2977,6 +3042,7 @@ class MarkCompactCollector::ClearTrivialWeakRefJobItem final
                         delegate, trace_id_, TRACE_EVENT_FLAG_FLOW_IN);
     collector_->ClearTrivialWeakReferences();
     collector_->ClearTrustedWeakReferences();
+    collector_->ClearJSWeakRefs();
   }
 
   uint64_t trace_id() const { return trace_id_; }
@@ -3270,7 +3336,7 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_WEAKNESS_HANDLING);
     ClearNonTrivialWeakReferences();
     ClearWeakCollections();
-    ProcessJSWeakRefs();
+    ProcessWeakCells();
   }
 
   PROFILE(heap_->isolate(), WeakCodeClearEvent());
@@ -3684,10 +3750,21 @@ void MarkCompactCollector::ClearFullMapTransitions() {
   }
 }
 
+// Transitions from a deprecated map are never followed: objects with that map
+// are migrated to an up-to-date map before they transition. Their targets are
+// deprecated as well and are only kept alive by their own instances, so the
+// transitions can be dropped as if the targets had died.
+bool MarkCompactCollector::IsPrunableTransition(Tagged<Map> parent,
+                                                Tagged<Map> target) {
+  return v8_flags.prune_deprecated_transitions && parent->is_deprecated() &&
+         target->is_deprecated();
+}
+
 // Returns false if no maps have died, or if the transition array is
 // still being deserialized.
 bool MarkCompactCollector::TransitionArrayNeedsCompaction(
-    Tagged<TransitionArray> transitions, int num_transitions) {
+    Tagged<Map> map, Tagged<TransitionArray> transitions,
+    int num_transitions) {
   ReadOnlyRoots roots(heap_->isolate());
   for (int i = 0; i < num_transitions; ++i) {
     Tagged<MaybeObject> raw_target = transitions->GetRawTarget(i);
@@ -3704,9 +3781,11 @@ bool MarkCompactCollector::TransitionArrayNeedsCompaction(
       }
 #endif
       return false;
-    } else if (MarkingHelper::IsUnmarkedAndNotAlwaysLive(
-                   heap_, non_atomic_marking_state_,
-                   TransitionsAccessor::GetTargetFromRaw(raw_target))) {
+    } else if (Tagged<Map> target =
+                   TransitionsAccessor::GetTargetFromRaw(raw_target);
+               MarkingHelper::IsUnmarkedAndNotAlwaysLive(
+                   heap_, non_atomic_marking_state_, target) ||
+               IsPrunableTransition(map, target)) {
 #ifdef DEBUG
       // Targets can only be dead iff this array is fully deserialized.
       for (int j = 0; j < num_transitions; ++j) {
@@ -3724,7 +3803,7 @@ bool MarkCompactCollector::CompactTransitionArray(
     Tagged<DescriptorArray> descriptors) {
   DCHECK(!map->is_prototype_map());
   int num_transitions = transitions->number_of_transitions();
-  if (!TransitionArrayNeedsCompaction(transitions, num_transitions)) {
+  if (!TransitionArrayNeedsCompaction(map, transitions, num_transitions)) {
     return false;
   }
   ReadOnlyRoots roots(heap_->isolate());
@@ -3744,6 +3823,9 @@ bool MarkCompactCollector::CompactTransitionArray(
       }
       continue;
     }
+    // A pruned target that is still alive keeps owning the descriptors it
+    // shares with {map}, so they are not trimmed.
+    if (IsPrunableTransition(map, target)) continue;
 
     if (i != transition_index) {
       Tagged<Name> key = transitions->GetKey(i);
@@ -3998,21 +4080,28 @@ void MarkCompactCollector::ClearNonTrivialWeakReferences() {
   }
 }
 
-void MarkCompactCollector::ProcessJSWeakRefs() {
-  TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR_JS_WEAK_REFERENCES);
+void MarkCompactCollector::ClearJSWeakRefs() {
+  // Mark bits don't change anymore at this point, and nothing else writes
+  // JSWeakRef targets during clearing, so this can run off the main thread.
   Tagged<JSWeakRef> weak_ref;
-  Isolate* const isolate = heap_->isolate();
+  const Tagged<Undefined> undefined =
+      ReadOnlyRoots(heap_->isolate()).undefined_value();
   while (local_weak_objects()->js_weak_refs_local.Pop(&weak_ref)) {
     Tagged<HeapObject> target = Cast<HeapObject>(weak_ref->target());
     if (MarkingHelper::IsUnmarkedAndNotAlwaysLive(
             heap_, non_atomic_marking_state_, target)) {
-      weak_ref->set_target(ReadOnlyRoots(isolate).undefined_value());
+      weak_ref->set_target(undefined);
     } else {
       // The value of the JSWeakRef is alive.
       ObjectSlot slot = weak_ref->RawField(JSWeakRef::kTargetOffset);
       RecordSlot(weak_ref, slot, target);
     }
   }
+}
+
+void MarkCompactCollector::ProcessWeakCells() {
+  TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_CLEAR_JS_WEAK_REFERENCES);
+  Isolate* const isolate = heap_->isolate();
   Tagged<WeakCell> weak_cell;
   while (local_weak_objects()->weak_cells_local.Pop(&weak_cell)) {
     auto gc_notify_updated_slot = [](Tagged<HeapObject> object, ObjectSlot slot,
@@ -199,8 +199,14 @@ class MarkCompactCollector final {
   void ComputeEvacuationHeuristics(size_t area_size,
                                    int* target_fragmentation_percent,
                                    size_t* max_evacuated_bytes);
+  // Bytes that the evacuation candidates of all spaces together may hold in
+  // this cycle, see --compaction-pause-budget-ms.
+  size_t ComputeEvacuationBudget() const;
 
   void RecordObjectStats();
+  // Hands the marked bytes of every native context to the tracer, see
+  // --gc-per-context-cost.
+  void RecordMarkedBytesPerContext();
 
   // Finishes GC, performs heap verification if enabled.
   void Finish();
@@ -319,8 +325,12 @@ class MarkCompactCollector final {
   bool CompactTransitionArray(Tagged<Map> map,
                               Tagged<TransitionArray> transitions,
                               Tagged<DescriptorArray> descriptors);
-  bool TransitionArrayNeedsCompaction(Tagged<TransitionArray> transitions,
+  bool TransitionArrayNeedsCompaction(Tagged<Map> map,
+                                      Tagged<TransitionArray> transitions,
                                       int num_transitions);
+  // Whether the transition from {parent} to the live {target} can be cleared
+  // like one to a dead map (see --prune-deprecated-transitions).
+  static bool IsPrunableTransition(Tagged<Map> parent, Tagged<Map> target);
   void WeakenStrongDescriptorArrays();
 
   // After all reachable objects have been marked those weak map entries
@@ -354,9 +364,13 @@ class MarkCompactCollector final {
   // transition.
   void ClearNonTrivialWeakReferences();
 
-  // Goes through the list of encountered JSWeakRefs and WeakCells and clears
-  // those with dead values.
-  void ProcessJSWeakRefs();
+  // Goes through the list of encountered JSWeakRefs and clears those with dead
+  // targets. Runs as part of the parallel ClearTrivialWeakRefJobItem.
+  void ClearJSWeakRefs();
+
+  // Goes through the list of encountered WeakCells, clears those with dead
+  // values and schedules their FinalizationRegistries for cleanup.
+  void ProcessWeakCells();
 
   // Starts sweeping of spaces by contributing on the main thread and setting
   // up other pages for sweeping. Does not start sweeper tasks.
@@ -414,6 +428,9 @@ class MarkCompactCollector final {
   // True if we are collecting slots to perform evacuation from evacuation
   // candidates.
   bool compacting_ = false;
+  // Remaining bytes the evacuation candidates of the spaces that were not
+  // considered yet may hold. Set up by StartCompaction().
+  size_t evacuation_budget_bytes_ = SIZE_MAX;
   bool black_allocation_ = false;
   bool have_code_to_deoptimize_ = false;
   bool parallel_marking_ = false;
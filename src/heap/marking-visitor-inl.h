@@ -506,6 +506,7 @@ bool MarkingVisitorBase<ConcreteVisitor>::ShouldFlushCode(
 template <typename ConcreteVisitor>
 bool MarkingVisitorBase<ConcreteVisitor>::IsOld(
     Tagged<SharedFunctionInfo> sfi) const {
+  if (v8_flags.snapshot_hot_functions && sfi->is_snapshot_hot()) return false;
   if (v8_flags.flush_code_based_on_time) {
     return sfi->age() >= v8_flags.bytecode_old_time;
   } else if (v8_flags.flush_code_based_on_tab_visibility) {
@@ -9,6 +9,7 @@
 
 #include "src/base/address-region.h"
 #include "src/base/macros.h"
+#include "src/base/platform/platform.h"
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -153,6 +154,12 @@ Address MemoryAllocator::AllocateAlignedMemory(
     ThreadIsolation::RegisterJitPage(base, chunk_size);
   }
 
+  // Regular pages are smaller than a huge page and only benefit if they are
+  // part of a cage or code range that was advised as a whole.
+  if (v8_flags.transparent_huge_pages && page_size == PageSize::kLarge) {
+    USE(base::OS::AdviseHugePages(reinterpret_cast<void*>(base), chunk_size));
+  }
+
   UpdateAllocatedSpaceLimits(base, base + chunk_size, executable);
 
   *controller = std::move(reservation);
@@ -4,15 +4,69 @@
 
 #include "src/heap/memory-balancer.h"
 
+#include <unordered_map>
+
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
 
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// The estimates of every heap sharing --memory-balancer-global-budget.
+class GlobalBudget {
+ public:
+  // Records |balancer|'s live memory and weight, sqrt(L * g / s), and returns
+  // the extra space it gets out of |budget|.
+  size_t Share(const MemoryBalancer* balancer, size_t live_memory,
+               double weight, size_t budget) {
+    base::MutexGuard guard(&mutex_);
+    heaps_[balancer] = {live_memory, weight};
+    size_t total_live_memory = 0;
+    double total_weight = 0;
+    for (const auto& [unused, heap] : heaps_) {
+      total_live_memory += heap.live_memory;
+      total_weight += heap.weight;
+    }
+    if (total_live_memory >= budget) return 0;
+    const double extra_space = static_cast<double>(budget - total_live_memory);
+    if (total_weight <= 0) {
+      return static_cast<size_t>(extra_space / heaps_.size());
+    }
+    return static_cast<size_t>(extra_space * (weight / total_weight));
+  }
+
+  void Remove(const MemoryBalancer* balancer) {
+    base::MutexGuard guard(&mutex_);
+    heaps_.erase(balancer);
+  }
+
+ private:
+  struct Estimate {
+    size_t live_memory;
+    double weight;
+  };
+
+  base::Mutex mutex_;
+  std::unordered_map<const MemoryBalancer*, Estimate> heaps_;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(GlobalBudget, GetGlobalBudget)
+
+}  // namespace
+
 MemoryBalancer::MemoryBalancer(Heap* heap, base::TimeTicks startup_time)
     : heap_(heap), last_measured_at_(startup_time) {}
 
+MemoryBalancer::~MemoryBalancer() {
+  if (v8_flags.memory_balancer_global_budget > 0) {
+    GetGlobalBudget()->Remove(this);
+  }
+}
+
 void MemoryBalancer::RecomputeLimits(size_t embedder_allocation_limit,
                                      base::TimeTicks time) {
   embedder_allocation_limit_ = embedder_allocation_limit;
@@ -26,10 +80,22 @@ void MemoryBalancer::RecomputeLimits(size_t embedder_allocation_limit,
 void MemoryBalancer::RefreshLimit() {
   CHECK(major_allocation_rate_.has_value());
   CHECK(major_gc_speed_.has_value());
-  const size_t computed_limit =
-      live_memory_after_gc_ +
-      sqrt(live_memory_after_gc_ * (major_allocation_rate_.value().rate()) /
-           (major_gc_speed_.value().rate()) / v8_flags.memory_balancer_c_value);
+  size_t computed_limit;
+  if (v8_flags.memory_balancer_global_budget > 0) {
+    const double weight =
+        sqrt(live_memory_after_gc_ * (major_allocation_rate_.value().rate()) /
+             (major_gc_speed_.value().rate()));
+    computed_limit =
+        live_memory_after_gc_ +
+        GetGlobalBudget()->Share(this, live_memory_after_gc_, weight,
+                                 v8_flags.memory_balancer_global_budget * MB);
+  } else {
+    computed_limit =
+        live_memory_after_gc_ +
+        sqrt(live_memory_after_gc_ * (major_allocation_rate_.value().rate()) /
+             (major_gc_speed_.value().rate()) /
+             v8_flags.memory_balancer_c_value);
+  }
 
   // 2 MB of extra space.
   // This allows the heap size to not decay to CurrentSizeOfObject()
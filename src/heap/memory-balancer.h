@@ -20,9 +20,20 @@ class Heap;
 // and smooth them using an exponentially weighted moving average (EWMA).
 // Spawn a heartbeat task that monitors allocation rate.
 // Calculate heap limit and update it accordingly.
+//
+// MemBalancer gives a heap with live memory L, allocation rate g and GC speed
+// s sqrt(L * g / (s * c)) bytes of extra space. With
+// --memory-balancer-global-budget set, the heaps of the process instead split
+// one budget: minimizing their total GC time under the constraint
+// sum(L_i + E_i) <= budget keeps each E_i proportional to sqrt(L_i * g_i /
+// s_i), so extra space goes to the heaps that allocate fast relative to how
+// fast they collect. Each heap publishes its estimate and takes its share on
+// every refresh, and the budget of a heap being torn down goes back to the
+// others on their next heartbeat.
 class MemoryBalancer {
  public:
   MemoryBalancer(Heap* heap, base::TimeTicks startup_time);
+  ~MemoryBalancer();
 
   void UpdateAllocationRate(size_t major_allocation_bytes,
                             base::TimeDelta major_allocation_duration);
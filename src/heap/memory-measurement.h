@@ -93,6 +93,14 @@ class V8_EXPORT_PRIVATE NativeContextStats {
 
   bool Empty() const { return size_by_context_.empty(); }
 
+  // Calls |callback| with every context and its size.
+  template <typename Callback>
+  void Iterate(Callback callback) const {
+    for (const auto& [context, size] : size_by_context_) {
+      callback(context, size);
+    }
+  }
+
  private:
   V8_INLINE bool HasExternalBytes(Tagged<Map> map);
   void IncrementExternalSize(Address context, Tagged<Map> map,
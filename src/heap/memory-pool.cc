@@ -7,6 +7,7 @@
 #include <algorithm>
 
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
 #include "src/common/ptr-compr-inl.h"
 #include "src/execution/isolate.h"
 #include "src/heap/large-page-metadata.h"
@@ -21,7 +22,8 @@ PooledPage::PooledPage(void* uninitialized_metadata, VirtualMemory reservation,
                        Epoch epoch)
     : uninitialized_metadata_(uninitialized_metadata),
       reservation_(std::move(reservation)),
-      epoch_(epoch) {}
+      epoch_(epoch),
+      numa_node_(MemoryPool::CurrentNumaNode()) {}
 
 // static
 PooledPage PooledPage::Create(PageMetadata* metadata, Epoch epoch) {
@@ -94,10 +96,50 @@ PooledPage::Result PooledPage::ToResult() {
   return {uninitialized_metadata, uninitialized_chunk};
 }
 
+void PooledPage::Decommit(Epoch epoch) {
+  DCHECK(!decommitted_);
+  // Failing to discard only means that the memory stays committed until the
+  // page is released.
+  reservation_.DiscardSystemPages(reservation_.address(), reservation_.size());
+  decommitted_ = true;
+  epoch_ = epoch;
+}
+
+void MemoryPool::PooledVirtualMemory::Decommit(Epoch epoch) {
+  DCHECK(!decommitted_);
+  memory_.DiscardSystemPages(memory_.address(), memory_.size());
+  decommitted_ = true;
+  epoch_ = epoch;
+}
+
 template <typename PoolEntry>
 void MemoryPool::PoolImpl<PoolEntry>::TearDown() {
   DCHECK(local_pools_.empty());
   shared_pool_.clear();
+  decommitted_pool_.clear();
+}
+
+// static
+template <typename PoolEntry>
+std::optional<PoolEntry> MemoryPool::PoolImpl<PoolEntry>::TakeFrom(
+    std::vector<PoolEntry>& entries, int numa_node) {
+  if (entries.empty()) {
+    return std::nullopt;
+  }
+  auto selected = entries.end() - 1;
+  if (numa_node != kAnyNumaNode) {
+    const size_t limit = std::min(entries.size(), kNumaSearchLimit);
+    for (size_t i = 0; i < limit; i++) {
+      auto it = entries.end() - 1 - i;
+      if (it->numa_node() == numa_node) {
+        selected = it;
+        break;
+      }
+    }
+  }
+  PoolEntry entry = std::move(*selected);
+  entries.erase(selected);
+  return {std::move(entry)};
 }
 
 template <typename PoolEntry>
@@ -109,7 +151,7 @@ void MemoryPool::PoolImpl<PoolEntry>::PutLocal(Isolate* isolate,
 
 template <typename PoolEntry>
 std::optional<PoolEntry> MemoryPool::PoolImpl<PoolEntry>::Get(
-    Isolate* isolate) {
+    Isolate* isolate, int numa_node) {
   DCHECK_NOT_NULL(isolate);
   base::MutexGuard guard(&mutex_);
 
@@ -118,14 +160,23 @@ std::optional<PoolEntry> MemoryPool::PoolImpl<PoolEntry>::Get(
 
   if (it == local_pools_.end()) {
     // Pages in this pool will be flushed soon. Take them first.
-    if (!shared_pool_.empty()) {
-      PoolEntry shared_entry = std::move(shared_pool_.back());
-      shared_pool_.pop_back();
-      return {std::move(shared_entry)};
+    if (std::optional<PoolEntry> shared_entry =
+            TakeFrom(shared_pool_, numa_node)) {
+      return shared_entry;
     }
 
-    // Otherwise steal from some other isolate's local pool.
+    // Otherwise steal from some other isolate's local pool, preferably one
+    // that was filled on the same NUMA node.
     it = local_pools_.begin();
+    if (numa_node != kAnyNumaNode) {
+      auto same_node = std::find_if(
+          local_pools_.begin(), local_pools_.end(), [numa_node](auto& pool) {
+            return pool.second.back().numa_node() == numa_node;
+          });
+      if (same_node != local_pools_.end()) {
+        it = same_node;
+      }
+    }
   }
 
   if (it != local_pools_.end()) {
@@ -139,6 +190,13 @@ std::optional<PoolEntry> MemoryPool::PoolImpl<PoolEntry>::Get(
     return {std::move(local_entry)};
   }
 
+  // Decommitted memory has to be faulted in again but still saves mapping it.
+  if (!decommitted_pool_.empty()) {
+    PoolEntry decommitted_entry = std::move(decommitted_pool_.back());
+    decommitted_pool_.pop_back();
+    return {std::move(decommitted_entry)};
+  }
+
   return std::nullopt;
 }
 
@@ -160,6 +218,7 @@ template <typename PoolEntry>
 void MemoryPool::PoolImpl<PoolEntry>::ReleaseShared() {
   base::MutexGuard guard(&mutex_);
   shared_pool_.clear();
+  decommitted_pool_.clear();
 }
 
 template <typename PoolEntry>
@@ -184,6 +243,7 @@ size_t MemoryPool::PoolImpl<PoolEntry>::Size() const {
   for (const auto& entry : shared_pool_) {
     count += entry.size();
   }
+  count += decommitted_pool_.size();
   return count;
 }
 
@@ -202,21 +262,30 @@ size_t MemoryPool::PoolImpl<PoolEntry>::SharedSize() const {
 
 template <typename PoolEntry>
 MemoryPool::PoolReleaseStats MemoryPool::PoolImpl<PoolEntry>::ReleaseUpTo(
-    Epoch release_epoch) {
+    Epoch release_epoch, Epoch current_epoch) {
   std::vector<PoolEntry> entries_to_free;
+  std::vector<PoolEntry> entries_to_decommit;
   size_t freed = 0;
   bool pool_emptied = false;
-  const auto collect_entries = [&entries_to_free, &freed,
-                                release_epoch](PoolEntry& entry) {
-    if (entry.epoch() <= release_epoch) {
+  const bool decommit = v8_flags.memory_pool_decommit;
+  const auto collect_entries = [&entries_to_free, &entries_to_decommit,
+                                &freed, release_epoch,
+                                decommit](PoolEntry& entry) {
+    if (entry.epoch() > release_epoch) {
+      return false;
+    }
+    if (decommit && !entry.decommitted()) {
+      entries_to_decommit.push_back(std::move(entry));
+    } else {
       freed += entry.size();
       entries_to_free.push_back(std::move(entry));
-      return true;
     }
-    return false;
+    return true;
   };
   {
     base::MutexGuard guard(&mutex_);
+    // Release entries that were decommitted by an earlier task.
+    std::erase_if(decommitted_pool_, collect_entries);
     // Release shared pages of isolates that were recently torn down.
     std::erase_if(shared_pool_, collect_entries);
     // Release pooled pages of local pools.
@@ -228,12 +297,26 @@ MemoryPool::PoolReleaseStats MemoryPool::PoolImpl<PoolEntry>::ReleaseUpTo(
       }
     }
     std::swap(local_pools_, non_empty_local_pools);
-    if (local_pools_.empty() && shared_pool_.empty()) {
+  }
+  // Discarding memory calls into the OS for every entry, so it is done
+  // without holding the lock. The entries cannot be handed out meanwhile.
+  const size_t decommitted = entries_to_decommit.size();
+  for (PoolEntry& entry : entries_to_decommit) {
+    entry.Decommit(current_epoch);
+  }
+  {
+    base::MutexGuard guard(&mutex_);
+    decommitted_pool_.insert(
+        decommitted_pool_.end(),
+        std::make_move_iterator(entries_to_decommit.begin()),
+        std::make_move_iterator(entries_to_decommit.end()));
+    if (local_pools_.empty() && shared_pool_.empty() &&
+        decommitted_pool_.empty()) {
       pool_emptied = true;
     }
   }
   // Entries will be freed automatically here.
-  return {freed, pool_emptied};
+  return {freed, decommitted, pool_emptied};
 }
 
 bool MemoryPool::LargePagePoolImpl::Add(std::vector<LargePageMetadata*>& pages,
@@ -318,7 +401,7 @@ MemoryPool::PoolReleaseStats MemoryPool::LargePagePoolImpl::ReleaseUpTo(
     DCHECK_EQ(total_size_, ComputeTotalSize());
   }
   // Entries will be freed automatically here.
-  return {freed, pool_emptied};
+  return {freed, 0, pool_emptied};
 }
 
 size_t MemoryPool::LargePagePoolImpl::ComputeTotalSize() const {
@@ -377,15 +460,20 @@ void MemoryPool::TearDown() {
 }
 
 MemoryPool::ReleaseStats MemoryPool::ReleaseUpTo(Epoch release_epoch) {
-  const auto [pages_removed, normal_pools_empty] =
-      page_pool_.ReleaseUpTo(release_epoch);
-  const auto [large_pages_removed, large_pool_empty] =
+  const Epoch current_epoch = current_epoch_.load(std::memory_order_relaxed);
+  const auto [pages_removed, pages_decommitted, normal_pools_empty] =
+      page_pool_.ReleaseUpTo(release_epoch, current_epoch);
+  const auto [large_pages_removed, large_pages_decommitted, large_pool_empty] =
       large_pool_.ReleaseUpTo(release_epoch);
-  const auto [zone_reservations_removed, zone_pool_empty] =
-      zone_pool_.ReleaseUpTo(release_epoch);
+  DCHECK_EQ(large_pages_decommitted, 0);
+  const auto [zone_reservations_removed, zone_reservations_decommitted,
+              zone_pool_empty] =
+      zone_pool_.ReleaseUpTo(release_epoch, current_epoch);
   return {.pages_removed = pages_removed,
+          .pages_decommitted = pages_decommitted,
           .large_pages_removed = large_pages_removed,
           .zone_reservations_removed = zone_reservations_removed,
+          .zone_reservations_decommitted = zone_reservations_decommitted,
           .pool_emptied =
               normal_pools_empty && large_pool_empty && zone_pool_empty};
 }
@@ -409,7 +497,7 @@ void MemoryPool::Add(Isolate* isolate, MutablePageMetadata* page) {
 
 std::optional<PooledPage::Result> MemoryPool::Remove(Isolate* isolate) {
   DCHECK_NOT_NULL(isolate);
-  std::optional<PooledPage> result = page_pool_.Get(isolate);
+  std::optional<PooledPage> result = page_pool_.Get(isolate, CurrentNumaNode());
   if (!result) {
     return std::nullopt;
   }
@@ -439,7 +527,7 @@ void MemoryPool::AddZoneReservation(Isolate* isolate,
 std::optional<VirtualMemory> MemoryPool::RemoveZoneReservation(
     Isolate* isolate) {
   DCHECK_NOT_NULL(isolate);
-  auto result = zone_pool_.Get(isolate);
+  auto result = zone_pool_.Get(isolate, CurrentNumaNode());
   return result
              ? std::optional<VirtualMemory>(std::move(result->virtual_memory()))
              : std::nullopt;
@@ -471,11 +559,12 @@ class MemoryPool::ReleasePooledChunksTask final : public CancelableTask {
       IsolateGroup::current()->FindAnotherIsolateLocked(
           nullptr, [&stats](Isolate* isolate) {
             isolate->PrintWithTimestamp(
-                "Memory pool: Removed pages: %zu, removed large pages: %zu\n, "
-                "removed "
-                "zone reservations: %zu\n",
-                stats.pages_removed, stats.large_pages_removed,
-                stats.zone_reservations_removed);
+                "Memory pool: Removed pages: %zu, decommitted pages: %zu, "
+                "removed large pages: %zu, removed zone reservations: %zu, "
+                "decommitted zone reservations: %zu\n",
+                stats.pages_removed, stats.pages_decommitted,
+                stats.large_pages_removed, stats.zone_reservations_removed,
+                stats.zone_reservations_decommitted);
           });
     }
     // Repost itself to the next heartbeat only if pool is not fully emptied.
@@ -531,4 +620,12 @@ void MemoryPool::CancelAndWaitForTaskToFinishForTesting() {
   cancellable_task_manager_->CancelAndWait();
 }
 
+// static
+int MemoryPool::CurrentNumaNode() {
+  // Memory is assumed to reside on the node of the thread that pooled it,
+  // which is usually the node of the isolate that last used it.
+  return v8_flags.memory_pool_numa_affinity ? base::OS::GetCurrentNumaNode()
+                                            : kAnyNumaNode;
+}
+
 }  // namespace v8::internal
@@ -44,6 +44,12 @@ class PooledPage final {
 
   size_t size() const { return reservation_.size(); }
   size_t epoch() const { return epoch_; }
+  int numa_node() const { return numa_node_; }
+  bool decommitted() const { return decommitted_; }
+
+  // Returns the physical memory of the page to the OS while keeping it
+  // reserved. The page then waits for release from `epoch` on.
+  void Decommit(Epoch epoch);
 
   // Transfers ownership to a `Result` that is then used by the callers to
   // initialize the chunk and metadata.
@@ -64,6 +70,10 @@ class PooledPage final {
   // The reservation that was previously used by MemoryChunk.
   VirtualMemory reservation_;
   Epoch epoch_;
+  // NUMA node of the thread that pooled the page, see
+  // MemoryPool::CurrentNumaNode().
+  int numa_node_;
+  bool decommitted_ = false;
 };
 
 // Pool that keeps memory cached until explicitly flushed. The pool assumes that
@@ -71,6 +81,14 @@ class PooledPage final {
 // pool can immediately be reused by some other Isolate.
 //
 // Currently used for pages and zone reservations.
+//
+// The pool is shared by all isolates of an IsolateGroup, so pages freed by a
+// short-lived isolate are handed to the next one without going through the
+// OS. Pooled memory stays committed. When --memory-pool-numa-affinity is set,
+// memory is preferably handed to threads on the NUMA node it was released
+// on. Memory that is not reused within --memory-pool-timeout is decommitted
+// by the background release task and only released after another timeout,
+// see --memory-pool-decommit.
 class MemoryPool final {
   using Epoch = PooledPage::Epoch;
 
@@ -134,11 +152,17 @@ class MemoryPool final {
   // Cancels the background releasing task.
   V8_EXPORT_PRIVATE void CancelAndWaitForTaskToFinishForTesting();
 
+  // Returns the NUMA node pooled memory is tagged with and looked up for, or
+  // kAnyNumaNode if --memory-pool-numa-affinity is off.
+  static int CurrentNumaNode();
+  static constexpr int kAnyNumaNode = -1;
+
  private:
   class ReleasePooledChunksTask;
 
   struct PoolReleaseStats {
     size_t removed_entries = 0;
+    size_t decommitted_entries = 0;
     bool pool_emptied = false;
   };
 
@@ -148,15 +172,21 @@ class MemoryPool final {
     ~PoolImpl() {
       DCHECK(local_pools_.empty());
       DCHECK(shared_pool_.empty());
+      DCHECK(decommitted_pool_.empty());
     }
 
     void PutLocal(Isolate* isolate, PoolEntry entry);
-    std::optional<PoolEntry> Get(Isolate* isolate);
+    // Prefers entries that were pooled on `numa_node` once the local pool of
+    // `isolate` is empty, and falls back to decommitted entries last.
+    std::optional<PoolEntry> Get(Isolate* isolate, int numa_node);
     bool MoveLocalToShared(Isolate* isolate);
     void ReleaseShared();
     void ReleaseLocal();
     void ReleaseLocal(Isolate* isolate);
-    PoolReleaseStats ReleaseUpTo(Epoch release_epoch);
+    // Releases entries at least as old as `release_epoch`. With
+    // --memory-pool-decommit, committed entries are decommitted instead and
+    // wait for release from `current_epoch` on.
+    PoolReleaseStats ReleaseUpTo(Epoch release_epoch, Epoch current_epoch);
 
     void TearDown();
 
@@ -165,8 +195,17 @@ class MemoryPool final {
     size_t SharedSize() const;
 
    private:
+    // Number of entries at the end of a pool that are searched for one from
+    // the requested NUMA node.
+    static constexpr size_t kNumaSearchLimit = 32;
+
+    static std::optional<PoolEntry> TakeFrom(std::vector<PoolEntry>& entries,
+                                             int numa_node);
+
     absl::flat_hash_map<Isolate*, std::vector<PoolEntry>> local_pools_;
     std::vector<PoolEntry> shared_pool_;
+    // Entries whose memory was returned to the OS, not owned by any isolate.
+    std::vector<PoolEntry> decommitted_pool_;
     mutable base::Mutex mutex_;
   };
 
@@ -192,21 +231,31 @@ class MemoryPool final {
   class PooledVirtualMemory final {
    public:
     PooledVirtualMemory(VirtualMemory memory, Epoch epoch)
-        : memory_(std::move(memory)), epoch_(epoch) {}
+        : memory_(std::move(memory)),
+          epoch_(epoch),
+          numa_node_(CurrentNumaNode()) {}
 
     VirtualMemory& virtual_memory() { return memory_; }
     Epoch epoch() const { return epoch_; }
     size_t size() const { return memory_.size(); }
+    int numa_node() const { return numa_node_; }
+    bool decommitted() const { return decommitted_; }
+
+    void Decommit(Epoch epoch);
 
    private:
     VirtualMemory memory_;
     Epoch epoch_;
+    int numa_node_;
+    bool decommitted_ = false;
   };
 
   struct ReleaseStats final {
     size_t pages_removed = 0;
+    size_t pages_decommitted = 0;
     size_t large_pages_removed = 0;
     size_t zone_reservations_removed = 0;
+    size_t zone_reservations_decommitted = 0;
     bool pool_emptied = false;
   };
 
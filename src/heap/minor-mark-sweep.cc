@@ -856,10 +856,21 @@ void MinorMarkSweepCollector::TraceFragmentation() {
 namespace {
 
 // NewSpacePages with more live bytes than this threshold qualify for fast
-// evacuation.
-intptr_t NewSpacePageEvacuationThreshold() {
-  return v8_flags.minor_ms_page_promotion_threshold *
-         MemoryChunkLayout::AllocatableMemoryInDataPage() / 100;
+// evacuation. With --minor-ms-age-scaled-page-promotion, the threshold drops
+// with each GC the page survived: objects that outlived several GCs on a page
+// likely live on, so less of the page needs to be live for it to move. It
+// reaches zero at --minor-ms-max-page-age, where pages are force promoted.
+intptr_t NewSpacePageEvacuationThreshold(const PageMetadata* p) {
+  const intptr_t threshold = v8_flags.minor_ms_page_promotion_threshold *
+                             MemoryChunkLayout::AllocatableMemoryInDataPage() /
+                             100;
+  const size_t max_age = v8_flags.minor_ms_max_page_age;
+  if (!v8_flags.minor_ms_age_scaled_page_promotion || max_age == 0) {
+    return threshold;
+  }
+  const size_t age = std::min(p->AgeInNewSpace(), max_age);
+  return threshold * static_cast<intptr_t>(max_age - age) /
+         static_cast<intptr_t>(max_age);
 }
 
 bool ShouldMovePage(PageMetadata* p, intptr_t live_bytes,
@@ -869,7 +880,7 @@ bool ShouldMovePage(PageMetadata* p, intptr_t live_bytes,
   Heap* heap = p->heap();
   DCHECK(!p->never_evacuate());
   const bool should_move_page =
-      ((live_bytes + wasted_bytes) > NewSpacePageEvacuationThreshold() ||
+      ((live_bytes + wasted_bytes) > NewSpacePageEvacuationThreshold(p) ||
        (p->AllocatedLabSize() == 0)) &&
       (heap->new_space()->IsPromotionCandidate(p)) &&
       heap->CanExpandOldGeneration(live_bytes);
@@ -880,7 +891,7 @@ bool ShouldMovePage(PageMetadata* p, intptr_t live_bytes,
         ", live bytes = %zu, wasted bytes = %zu, promotion threshold = %zu"
         ", allocated labs size = %zu\n",
         p, should_move_page, live_bytes, wasted_bytes,
-        NewSpacePageEvacuationThreshold(), p->AllocatedLabSize());
+        NewSpacePageEvacuationThreshold(p), p->AllocatedLabSize());
   }
   if (!should_move_page &&
       (p->AgeInNewSpace() == v8_flags.minor_ms_max_page_age)) {
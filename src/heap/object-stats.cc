@@ -478,6 +478,10 @@ class ObjectStatsCollectorImpl {
     kIgnoreCow,
   };
 
+  // Maps with at least this many transitions get their TransitionArray
+  // recorded as LARGE_TRANSITION_ARRAY_TYPE.
+  static constexpr int kLargeTransitionArrayTransitions = 64;
+
   Isolate* isolate() { return heap_->isolate(); }
 
   bool RecordVirtualObjectStats(Tagged<HeapObject> parent,
@@ -1058,6 +1062,32 @@ void ObjectStatsCollectorImpl::RecordVirtualMapDetails(Tagged<Map> map) {
                                    StatsEnum::ENUM_INDICES_CACHE_TYPE);
   }
 
+  // TransitionArrays have their own instance type as well, but tell apart the
+  // ones that only keep deprecated branches of the transition tree, and the
+  // ones that fan out into many transitions, which usually hints at objects
+  // used as dictionaries. Unused capacity is recorded as over-allocation.
+  if (Tagged<HeapObject> transitions;
+      map->raw_transitions().GetHeapObjectIfStrong(&transitions) &&
+      IsTransitionArray(transitions, cage_base())) {
+    Tagged<TransitionArray> array = Cast<TransitionArray>(transitions);
+    size_t size = array->Size(cage_base());
+    size_t over_allocated =
+        (array->length() -
+         TransitionArray::ToKeyIndex(array->number_of_transitions())) *
+        kTaggedSize;
+    if (over_allocated >= size) over_allocated = ObjectStats::kNoOverAllocation;
+    if (map->is_deprecated()) {
+      RecordVirtualObjectStats(map, array,
+                               StatsEnum::DEPRECATED_MAP_TRANSITION_ARRAY_TYPE,
+                               size, over_allocated);
+    } else if (array->number_of_transitions() >=
+               kLargeTransitionArrayTransitions) {
+      RecordVirtualObjectStats(map, array,
+                               StatsEnum::LARGE_TRANSITION_ARRAY_TYPE, size,
+                               over_allocated);
+    }
+  }
+
   if (map->is_prototype_map()) {
     Tagged<PrototypeInfo> prototype_info;
     if (map->TryGetPrototypeInfo(&prototype_info)) {
@@ -30,6 +30,7 @@
   V(DEOPTIMIZATION_DATA_TYPE)                    \
   V(DEPENDENT_CODE_TYPE)                         \
   V(DEPRECATED_DESCRIPTOR_ARRAY_TYPE)            \
+  V(DEPRECATED_MAP_TRANSITION_ARRAY_TYPE)        \
   V(EMBEDDED_OBJECT_TYPE)                        \
   V(ENUM_KEYS_CACHE_TYPE)                        \
   V(ENUM_INDICES_CACHE_TYPE)                     \
@@ -50,6 +51,7 @@
   V(JS_COLLECTION_TABLE_TYPE)                    \
   V(JS_OBJECT_BOILERPLATE_TYPE)                  \
   V(JS_UNCOMPILED_FUNCTION_TYPE)                 \
+  V(LARGE_TRANSITION_ARRAY_TYPE)                 \
   V(MAP_ABANDONED_PROTOTYPE_TYPE)                \
   V(MAP_DEPRECATED_TYPE)                         \
   V(MAP_DICTIONARY_TYPE)                         \
@@ -11,13 +11,22 @@
 #include "src/heap/gc-tracer-inl.h"
 #include "src/heap/heap-layout.h"
 #include "src/heap/new-spaces.h"
+#include "src/heap/pretenuring-profile.h"
 #include "src/objects/allocation-site-inl.h"
 
 namespace v8 {
 namespace internal {
 
 PretenuringHandler::PretenuringHandler(Heap* heap)
-    : heap_(heap), global_pretenuring_feedback_(kInitialFeedbackCapacity) {}
+    : heap_(heap), global_pretenuring_feedback_(kInitialFeedbackCapacity) {
+  if (const char* filename = v8_flags.pretenuring_profile_input) {
+    profile_ = PretenuringProfile::Load(filename);
+    if (v8_flags.trace_pretenuring_statistics) {
+      PrintF("pretenuring: %s profile %s\n",
+             profile_ ? "loaded" : "could not load", filename);
+    }
+  }
+}
 
 PretenuringHandler::~PretenuringHandler() = default;
 
@@ -132,6 +141,31 @@ bool PretenureAllocationSiteManually(Isolate* isolate,
 
 }  // namespace
 
+void PretenuringHandler::SeedAllocationSite(Tagged<FeedbackVector> vector,
+                                            FeedbackSlot slot,
+                                            Tagged<AllocationSite> site) {
+  if (!profile_ || !v8_flags.allocation_site_pretenuring) return;
+  DCHECK_EQ(site->pretenure_decision(), AllocationSite::kUndecided);
+  if (!profile_->ShouldTenure(vector, slot)) return;
+  // No code depends on the new site yet, so nothing needs to deoptimize.
+  site->set_pretenure_decision(AllocationSite::kTenure);
+  if (v8_flags.trace_pretenuring_statistics) {
+    PrintIsolate(heap_->isolate(),
+                 "pretenuring from profile: AllocationSite(%p): %s\n",
+                 reinterpret_cast<void*>(site.ptr()),
+                 site->PretenureDecisionName(site->pretenure_decision()));
+  }
+}
+
+void PretenuringHandler::WriteProfileIfNeeded() {
+  const char* filename = v8_flags.pretenuring_profile_output;
+  if (!filename) return;
+  if (!PretenuringProfile::Write(heap_, profile_.get(), filename)) {
+    PrintIsolate(heap_->isolate(), "Could not write pretenuring profile %s\n",
+                 filename);
+  }
+}
+
 // static
 int PretenuringHandler::GetMinMementoCountForTesting() {
   return kMinMementoCount;
@@ -10,13 +10,16 @@
 #include "src/objects/allocation-site.h"
 #include "src/objects/heap-object.h"
 #include "src/objects/map.h"
+#include "src/utils/utils.h"
 
 namespace v8 {
 namespace internal {
 
 template <typename T>
 class GlobalHandleVector;
+class FeedbackVector;
 class Heap;
+class PretenuringProfile;
 
 class PretenuringHandler final {
  public:
@@ -82,6 +85,18 @@ class PretenuringHandler final {
     return !global_pretenuring_feedback_.empty();
   }
 
+  // ===========================================================================
+  // Persisted decisions. ======================================================
+  // ===========================================================================
+
+  // Tenures a new literal |site| for |slot| of |vector| right away if it was
+  // tenured when the --pretenuring-profile-input was written.
+  void SeedAllocationSite(Tagged<FeedbackVector> vector, FeedbackSlot slot,
+                          Tagged<AllocationSite> site);
+
+  // Writes the --pretenuring-profile-output, if any.
+  void WriteProfileIfNeeded();
+
   V8_EXPORT_PRIVATE static int GetMinMementoCountForTesting();
 
  private:
@@ -96,6 +111,9 @@ class PretenuringHandler final {
 
   std::unique_ptr<GlobalHandleVector<AllocationSite>>
       allocation_sites_to_pretenure_;
+
+  // Decisions read from --pretenuring-profile-input.
+  std::unique_ptr<PretenuringProfile> profile_;
 };
 
 }  // namespace internal
@@ -0,0 +1,128 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/pretenuring-profile.h"
+
+#include <fstream>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "src/base/platform/platform.h"
+#include "src/heap/heap-inl.h"
+#include "src/heap/heap.h"
+#include "src/objects/allocation-site-inl.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/objects/string-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr char kMagic[] = "v8-pretenuring-profile";
+
+// Returns the script of |shared| and its source, if it has both.
+std::optional<std::pair<Tagged<Script>, Tagged<String>>> GetScriptSource(
+    Tagged<SharedFunctionInfo> shared) {
+  Tagged<Object> maybe_script = shared->script();
+  if (!IsScript(maybe_script)) return std::nullopt;
+  Tagged<Script> script = Cast<Script>(maybe_script);
+  if (!IsString(script->source())) return std::nullopt;
+  return std::make_pair(script, Cast<String>(script->source()));
+}
+
+}  // namespace
+
+// static
+std::unique_ptr<PretenuringProfile> PretenuringProfile::Load(
+    const char* filename) {
+  std::ifstream in(filename);
+  std::string magic;
+  int version;
+  if (!(in >> magic >> version) || magic != kMagic || version != kVersion) {
+    return nullptr;
+  }
+  std::unique_ptr<PretenuringProfile> profile(new PretenuringProfile());
+  SiteKey key;
+  while (in >> key.source_length >> std::hex >> key.source_hash >> std::dec >>
+         key.function_position >> key.slot) {
+    profile->tenured_sites_.insert(key);
+    profile->source_lengths_.insert(key.source_length);
+  }
+  if (!in.eof()) return nullptr;
+  return profile;
+}
+
+// static
+bool PretenuringProfile::Write(Heap* heap, const PretenuringProfile* previous,
+                               const char* filename) {
+  SiteSet sites;
+  if (previous) sites = previous->tenured_sites_;
+  {
+    std::unordered_map<int, size_t> source_hashes;
+    HeapObjectIterator iterator(heap);
+    DisallowGarbageCollection no_gc;
+    for (Tagged<HeapObject> object = iterator.Next(); !object.is_null();
+         object = iterator.Next()) {
+      if (!IsFeedbackVector(object)) continue;
+      Tagged<FeedbackVector> vector = Cast<FeedbackVector>(object);
+      Tagged<SharedFunctionInfo> shared = vector->shared_function_info();
+      auto script_source = GetScriptSource(shared);
+      if (!script_source) continue;
+      auto [script, source] = *script_source;
+      FeedbackMetadataIterator slots(vector->metadata(), no_gc);
+      while (slots.HasNext()) {
+        FeedbackSlot slot = slots.Next();
+        if (slots.kind() != FeedbackSlotKind::kLiteral) continue;
+        Tagged<HeapObject> site;
+        if (!vector->Get(slot).GetHeapObjectIfStrong(&site) ||
+            !IsAllocationSite(site) ||
+            Cast<AllocationSite>(site)->pretenure_decision() !=
+                AllocationSite::kTenure) {
+          continue;
+        }
+        auto [it, inserted] = source_hashes.try_emplace(script->id(), 0);
+        if (inserted) it->second = HashSource(source);
+        sites.insert({source->length(), it->second, shared->StartPosition(),
+                      slot.ToInt()});
+      }
+    }
+  }
+
+  FILE* file = base::OS::FOpen(filename, "w");
+  if (file == nullptr) return false;
+  fprintf(file, "%s %d\n", kMagic, kVersion);
+  for (const SiteKey& key : sites) {
+    fprintf(file, "%u %zx %d %d\n", key.source_length, key.source_hash,
+            key.function_position, key.slot);
+  }
+  return fclose(file) == 0;
+}
+
+bool PretenuringProfile::ShouldTenure(Tagged<FeedbackVector> vector,
+                                      FeedbackSlot slot) {
+  Tagged<SharedFunctionInfo> shared = vector->shared_function_info();
+  auto script_source = GetScriptSource(shared);
+  if (!script_source) return false;
+  auto [script, source] = *script_source;
+  if (!source_lengths_.contains(source->length())) return false;
+  auto [it, inserted] = source_hashes_.try_emplace(script->id(), 0);
+  if (inserted) it->second = HashSource(source);
+  return tenured_sites_.contains({source->length(), it->second,
+                                  shared->StartPosition(), slot.ToInt()});
+}
+
+// static
+size_t PretenuringProfile::HashSource(Tagged<String> source) {
+  const uint32_t length = source->length();
+  std::unique_ptr<base::uc16[]> chars(new base::uc16[length]);
+  String::WriteToFlat(source, chars.get(), 0, length);
+  return base::hash_range(chars.get(), chars.get() + length);
+}
+
+}  // namespace internal
+}  // namespace v8
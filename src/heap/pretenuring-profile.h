@@ -0,0 +1,95 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_PRETENURING_PROFILE_H_
+#define V8_HEAP_PRETENURING_PROFILE_H_
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "src/base/hashing.h"
+#include "src/objects/feedback-vector.h"
+#include "src/objects/script.h"
+
+namespace v8 {
+namespace internal {
+
+class Heap;
+
+// Pretenuring decisions of literal allocation sites that outlive the process,
+// so that a later run can allocate from a tenured site in old space right
+// away instead of learning the decision again over several scavenges.
+//
+// A site is identified by the source of its script, the start position of
+// the function it belongs to and the feedback slot of the literal. The
+// profile is a text file with a version line followed by one line per
+// tenured site:
+//
+//   v8-pretenuring-profile 1
+//   <source length> <source hash> <function start position> <slot>
+class PretenuringProfile final {
+ public:
+  static constexpr int kVersion = 1;
+
+  // Reads a profile written by Write(). Returns nullptr if the file cannot be
+  // read or is not a profile of this version.
+  static std::unique_ptr<PretenuringProfile> Load(const char* filename);
+
+  // Writes the sites that are currently tenured in |heap| together with the
+  // ones in |previous|, if any, to |filename|.
+  static bool Write(Heap* heap, const PretenuringProfile* previous,
+                    const char* filename);
+
+  PretenuringProfile(const PretenuringProfile&) = delete;
+  PretenuringProfile& operator=(const PretenuringProfile&) = delete;
+
+  // Returns whether the site created for the literal in |slot| of |vector|
+  // was tenured when the profile was written.
+  bool ShouldTenure(Tagged<FeedbackVector> vector, FeedbackSlot slot);
+
+  size_t size() const { return tenured_sites_.size(); }
+
+ private:
+  struct SiteKey {
+    uint32_t source_length;
+    size_t source_hash;
+    int function_position;
+    int slot;
+
+    bool operator==(const SiteKey& other) const {
+      return source_length == other.source_length &&
+             source_hash == other.source_hash &&
+             function_position == other.function_position &&
+             slot == other.slot;
+    }
+  };
+
+  struct SiteKeyHash {
+    size_t operator()(const SiteKey& key) const {
+      return base::hash_combine(key.source_length, key.source_hash,
+                                key.function_position, key.slot);
+    }
+  };
+
+  using SiteSet = std::unordered_set<SiteKey, SiteKeyHash>;
+
+  PretenuringProfile() = default;
+
+  // Hashes the characters of |source|. The result only needs to be stable
+  // between runs of the same build.
+  static size_t HashSource(Tagged<String> source);
+
+  SiteSet tenured_sites_;
+  // Source lengths of all scripts in the profile. Scripts of other lengths
+  // are not hashed at all.
+  std::unordered_set<uint32_t> source_lengths_;
+  // Source hashes by script id, so that every script is hashed only once.
+  std::unordered_map<int, size_t> source_hashes_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_PRETENURING_PROFILE_H_
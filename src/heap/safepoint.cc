@@ -427,6 +427,7 @@ void GlobalSafepoint::EnterGlobalSafepointScope(Isolate* initiator) {
 
   if (++active_safepoint_scopes_ > 1) return;
 
+  safepoint_start_ = base::TimeTicks::Now();
   TimedHistogramScope timer(
       initiator->counters()->gc_time_to_global_safepoint());
   TRACE_GC(initiator->heap()->tracer(),
@@ -461,6 +462,7 @@ void GlobalSafepoint::EnterGlobalSafepointScope(Isolate* initiator) {
     DCHECK(client.is_locked());
     client.safepoint()->WaitUntilRunningThreadsInSafepoint(&client);
   }
+  stopped_isolates_ = clients.size();
 }
 
 void GlobalSafepoint::LeaveGlobalSafepointScope(Isolate* initiator) {
@@ -472,6 +474,15 @@ void GlobalSafepoint::LeaveGlobalSafepointScope(Isolate* initiator) {
       Heap* client_heap = client->heap();
       client_heap->safepoint()->LeaveGlobalSafepointScope(initiator);
     });
+
+    base::TimeDelta duration = base::TimeTicks::Now() - safepoint_start_;
+    initiator->counters()->gc_global_safepoint_duration()->AddTimedSample(
+        duration);
+    if (v8_flags.trace_gc_verbose) {
+      initiator->PrintWithTimestamp(
+          "Global safepoint stopped %zu isolates for %.3f ms\n",
+          stopped_isolates_, duration.InMillisecondsF());
+    }
   }
 
   clients_mutex_.Unlock();
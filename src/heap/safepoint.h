@@ -11,6 +11,7 @@
 
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
 #include "src/common/globals.h"
 #include "src/handles/persistent-handles.h"
 #include "src/heap/local-heap.h"
@@ -232,6 +233,10 @@ class GlobalSafepoint final {
   base::RecursiveMutex clients_mutex_;
   Isolate* clients_head_ = nullptr;
   int active_safepoint_scopes_ = 0;
+  // When the outermost active scope started requesting the safepoint, and
+  // how many isolates it stopped.
+  base::TimeTicks safepoint_start_;
+  size_t stopped_isolates_ = 0;
 
   friend class GlobalSafepointScope;
   friend class Isolate;
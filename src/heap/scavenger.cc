@@ -1542,10 +1542,6 @@ void SweepArrayBufferExtensions(Heap* heap) {
 }
 
 int NumberOfScavengeTasks(Heap* heap) {
-  // The maximum number of scavenger tasks including the main thread. The actual
-  // number of tasks is determined at runtime.
-  static constexpr int kMaxScavengerTasks = 8;
-
   if (!v8_flags.parallel_scavenge) {
     return 1;
   }
@@ -1555,8 +1551,11 @@ int NumberOfScavengeTasks(Heap* heap) {
           MB +
       1;
   static int num_cores = V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1;
-  int tasks = std::max(
-      1, std::min({num_scavenge_tasks, kMaxScavengerTasks, num_cores}));
+  // The maximum number of scavenger tasks including the main thread. The actual
+  // number of tasks is determined at runtime.
+  int tasks = std::max(1, std::min({num_scavenge_tasks,
+                                    v8_flags.scavenger_max_tasks.value(),
+                                    num_cores}));
   if (!heap->CanPromoteYoungAndExpandOldGeneration(
           static_cast<size_t>(tasks * PageMetadata::kPageSize))) {
     // Optimize for memory usage near the heap limit.
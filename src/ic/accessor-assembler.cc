@@ -3100,7 +3100,15 @@ enum AccessorAssembler::StubCacheTable : int {
   kSecondary = static_cast<int>(StubCache::kSecondary)
 };
 
-TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
+TNode<Word32T> AccessorAssembler::LoadStubCacheMask(StubCache* stub_cache,
+                                                    StubCacheTable table_id) {
+  StubCache::Table table = static_cast<StubCache::Table>(table_id);
+  return Load<Uint32T>(ExternalConstant(
+      ExternalReference::Create(stub_cache->mask_reference(table))));
+}
+
+TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(StubCache* stub_cache,
+                                                         TNode<Name> name,
                                                          TNode<Map> map) {
   // Compute the hash of the name (use entire hash field).
   TNode<Uint32T> raw_hash_field = LoadNameRawHash(name);
@@ -3118,15 +3126,13 @@ TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
       WordXor(map_word, WordShr(map_word, StubCache::kPrimaryTableBits))));
   // Base the offset on a simple combination of name and map.
   TNode<Word32T> hash = Int32Add(raw_hash_field, map32);
-  uint32_t mask = (StubCache::kPrimaryTableSize - 1)
-                  << StubCache::kCacheIndexShift;
-  TNode<UintPtrT> result =
-      ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  TNode<Word32T> mask = LoadStubCacheMask(stub_cache, kPrimary);
+  TNode<UintPtrT> result = ChangeUint32ToWord(Word32And(hash, mask));
   return Signed(result);
 }
 
-TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(TNode<Name> name,
-                                                           TNode<Map> map) {
+TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(
+    StubCache* stub_cache, TNode<Name> name, TNode<Map> map) {
   // See v8::internal::StubCache::SecondaryOffset().
 
   // Use the seed from the primary cache in the secondary cache.
@@ -3136,10 +3142,8 @@ TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(TNode<Name> name,
   TNode<Word32T> hash_a = Int32Add(map32, name32);
   TNode<Word32T> hash_b = Word32Shr(hash_a, StubCache::kSecondaryTableBits);
   TNode<Word32T> hash = Int32Add(hash_a, hash_b);
-  int32_t mask = (StubCache::kSecondaryTableSize - 1)
-                 << StubCache::kCacheIndexShift;
-  TNode<UintPtrT> result =
-      ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  TNode<Word32T> mask = LoadStubCacheMask(stub_cache, kSecondary);
+  TNode<UintPtrT> result = ChangeUint32ToWord(Word32And(hash, mask));
   return Signed(result);
 }
 
@@ -3192,7 +3196,7 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
 
   // Probe the primary table.
   TNode<IntPtrT> primary_offset =
-      StubCachePrimaryOffset(name, lookup_start_object_map);
+      StubCachePrimaryOffset(stub_cache, name, lookup_start_object_map);
   TryProbeStubCacheTable(stub_cache, kPrimary, primary_offset, name,
                          lookup_start_object_map, if_handler, var_handler,
                          &try_secondary);
@@ -3201,7 +3205,7 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
   {
     // Probe the secondary table.
     TNode<IntPtrT> secondary_offset =
-        StubCacheSecondaryOffset(name, lookup_start_object_map);
+        StubCacheSecondaryOffset(stub_cache, name, lookup_start_object_map);
     TryProbeStubCacheTable(stub_cache, kSecondary, secondary_offset, name,
                            lookup_start_object_map, if_handler, var_handler,
                            &miss);
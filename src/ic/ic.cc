@@ -423,6 +423,9 @@ MaybeDirectHandle<Object> LoadIC::Load(Handle<JSAny> object, Handle<Name> name,
     UpdateState(object, name);
   }
 
+  if (use_ic && IsJSObject(*object)) {
+    JSObject::MaybePromoteDictionaryToFast(isolate(), Cast<JSObject>(object));
+  }
   JSObject::MakePrototypesFast(object, kStartAtReceiver, isolate());
   update_lookup_start_object_map(object);
 
@@ -632,6 +635,9 @@ bool IC::UpdatePolymorphicIC(DirectHandle<Name> name,
   maps_and_handlers.reserve(v8_flags.max_valid_polymorphic_map_count);
   int deprecated_maps = 0;
   int handler_to_overwrite = -1;
+  // Whether all valid maps would use {handler}, as maps of similar shapes do
+  // for a property at the same field index and representation.
+  bool all_share_handler = true;
 
   {
     DisallowGarbageCollection no_gc;
@@ -646,7 +652,13 @@ bool IC::UpdatePolymorphicIC(DirectHandle<Name> name,
       if (existing_map->is_deprecated()) {
         // Filter out deprecated maps to ensure their instances get migrated.
         deprecated_maps++;
-      } else if (map.is_identical_to(existing_map)) {
+        i++;
+        continue;
+      }
+      if (!handler.is_identical_to(existing_handler)) {
+        all_share_handler = false;
+      }
+      if (map.is_identical_to(existing_map)) {
         // If both map and handler stayed the same (and the name is also the
         // same as checked above, for keyed accesses), we're not progressing
         // in the lattice and need to go MEGAMORPHIC instead. There's one
@@ -675,7 +687,14 @@ bool IC::UpdatePolymorphicIC(DirectHandle<Name> name,
   int number_of_valid_maps =
       number_of_maps - deprecated_maps - (handler_to_overwrite != -1);
 
-  if (number_of_valid_maps >= v8_flags.max_valid_polymorphic_map_count) {
+  // One handler covering all maps stays cheap to dispatch to, so allow more
+  // of them before going MEGAMORPHIC.
+  const int max_valid_maps =
+      all_share_handler
+          ? std::max<int>(v8_flags.max_valid_polymorphic_map_count,
+                          v8_flags.max_shared_handler_polymorphic_map_count)
+          : v8_flags.max_valid_polymorphic_map_count;
+  if (number_of_valid_maps >= max_valid_maps) {
     return false;
   }
   if (deprecated_maps >= v8_flags.max_valid_polymorphic_map_count) {
@@ -4,20 +4,53 @@
 
 #include "src/ic/stub-cache.h"
 
+#include <algorithm>
+
 #include "src/ast/ast.h"
 #include "src/base/bits.h"
+#include "src/flags/flags.h"
 #include "src/heap/heap-inl.h"  // For InYoungGeneration().
 #include "src/ic/ic-inl.h"
+#include "src/init/v8.h"
 #include "src/logging/counters.h"
 #include "src/objects/tagged-value-inl.h"
 
 namespace v8 {
 namespace internal {
 
-StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
+namespace {
+
+constexpr int kSecondaryTableBitsDelta =
+    StubCache::kPrimaryTableBits - StubCache::kSecondaryTableBits;
+
+}  // namespace
+
+StubCache::StubCache(Isolate* isolate)
+    : max_primary_table_bits_(
+          std::clamp(
+              static_cast<int>(v8_flags.stub_cache_max_primary_table_bits),
+              kPrimaryTableBits, kMaxPrimaryTableBits)),
+      isolate_(isolate) {
   // Ensure the nullptr (aka Smi::zero()) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(Tagged<MaybeObject>()));
+
+  // Reserve the tables at their maximum size. Only the parts that are in use
+  // get touched, and thus committed.
+  size_t max_primary_size = size_t{1} << max_primary_table_bits_;
+  size_t max_secondary_size =
+      size_t{1} << (max_primary_table_bits_ - kSecondaryTableBitsDelta);
+  v8::PageAllocator* page_allocator = GetPlatformPageAllocator();
+  size_t reservation_size =
+      RoundUp((max_primary_size + max_secondary_size) * sizeof(Entry),
+              page_allocator->CommitPageSize());
+  reservation_ = VirtualMemory(page_allocator, reservation_size, {}, 1,
+                               PageAllocator::kReadWrite);
+  if (!reservation_.IsReserved()) {
+    V8::FatalProcessOutOfMemory(isolate, "StubCache::StubCache");
+  }
+  primary_ = reinterpret_cast<Entry*>(reservation_.address());
+  secondary_ = primary_ + max_primary_size;
 }
 
 void StubCache::Initialize() {
@@ -29,7 +62,7 @@ void StubCache::Initialize() {
 // Hash algorithm for the primary table. This algorithm is replicated in
 // the AccessorAssembler.  Returns an index into the table that
 // is scaled by 1 << kCacheIndexShift.
-int StubCache::PrimaryOffset(Tagged<Name> name, Tagged<Map> map) {
+int StubCache::PrimaryOffset(Tagged<Name> name, Tagged<Map> map) const {
   // Compute the hash of the name (use entire hash field).
   uint32_t field = name->RawHash();
   DCHECK(Name::IsHashFieldComputed(field));
@@ -40,26 +73,29 @@ int StubCache::PrimaryOffset(Tagged<Name> name, Tagged<Map> map) {
       static_cast<uint32_t>(map.ptr() ^ (map.ptr() >> kPrimaryTableBits));
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & primary_mask_;
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
 // assembler. This hash should be sufficiently different from the primary one
 // in order to avoid collisions for minified code with short names.
 // Returns an index into the table that is scaled by 1 << kCacheIndexShift.
-int StubCache::SecondaryOffset(Tagged<Name> name, Tagged<Map> old_map) {
+int StubCache::SecondaryOffset(Tagged<Name> name,
+                               Tagged<Map> old_map) const {
   uint32_t name_low32bits = static_cast<uint32_t>(name.ptr());
   uint32_t map_low32bits = static_cast<uint32_t>(old_map.ptr());
   uint32_t key = (map_low32bits + name_low32bits);
   key = key + (key >> kSecondaryTableBits);
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  return key & secondary_mask_;
 }
 
-int StubCache::PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map) {
+int StubCache::PrimaryOffsetForTesting(Tagged<Name> name,
+                                       Tagged<Map> map) const {
   return PrimaryOffset(name, map);
 }
 
-int StubCache::SecondaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map) {
+int StubCache::SecondaryOffsetForTesting(Tagged<Name> name,
+                                         Tagged<Map> map) const {
   return SecondaryOffset(name, map);
 }
 
@@ -115,6 +151,7 @@ void StubCache::Set(Tagged<Name> name, Tagged<Map> map,
   primary->key = StrongTaggedValue(name);
   primary->value = TaggedValue(handler);
   primary->map = StrongTaggedValue(map);
+  updates_since_clear_++;
   isolate()->counters()->megamorphic_stub_cache_updates()->Increment();
 }
 
@@ -133,15 +170,37 @@ Tagged<MaybeObject> StubCache::Get(Tagged<Name> name, Tagged<Map> map) {
   return Tagged<MaybeObject>();
 }
 
+void StubCache::MaybeGrow() {
+  // Every update follows a miss in generated code. If there were more of them
+  // since the last GC than there are entries in the primary table, the
+  // working set most likely doesn't fit into the tables.
+  size_t updates = updates_since_clear_;
+  updates_since_clear_ = 0;
+  int primary_bits = base::bits::WhichPowerOfTwo(primary_table_size());
+  if (primary_bits >= max_primary_table_bits_) return;
+  if (updates <= static_cast<size_t>(primary_table_size())) return;
+  primary_bits++;
+  primary_mask_ = ((1u << primary_bits) - 1) << kCacheIndexShift;
+  secondary_mask_ = ((1u << (primary_bits - kSecondaryTableBitsDelta)) - 1)
+                    << kCacheIndexShift;
+  if (v8_flags.trace_stub_cache_growth) {
+    PrintIsolate(isolate(),
+                 "Growing stub cache after %zu updates: %d primary and %d "
+                 "secondary entries\n",
+                 updates, primary_table_size(), secondary_table_size());
+  }
+}
+
 void StubCache::Clear() {
+  MaybeGrow();
   Tagged<MaybeObject> empty = isolate_->builtins()->code(Builtin::kIllegal);
   Tagged<Name> empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_table_size(); i++) {
     primary_[i].key = StrongTaggedValue(empty_string);
     primary_[i].map = StrongTaggedValue(Smi::zero());
     primary_[i].value = TaggedValue(empty);
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_table_size(); j++) {
     secondary_[j].key = StrongTaggedValue(empty_string);
     secondary_[j].map = StrongTaggedValue(Smi::zero());
     secondary_[j].value = TaggedValue(empty);
@@ -8,6 +8,7 @@
 #include "include/v8-callbacks.h"
 #include "src/objects/name.h"
 #include "src/objects/tagged-value.h"
+#include "src/utils/allocation.h"
 
 namespace v8 {
 namespace internal {
@@ -16,6 +17,12 @@ namespace internal {
 // It maps (map, name, type) to property access handlers. The cache does not
 // need explicit invalidation when a prototype chain is modified, since the
 // handlers verify the chain.
+//
+// The tables start out small and grow when they are cleared at a GC and have
+// seen more updates (i.e. misses) since the previous clear than they have
+// entries, up to --stub-cache-max-primary-table-bits. Memory for the maximum
+// size is reserved up front so that the tables never move; generated code
+// loads the current masks.
 
 class SCTableReference {
  public:
@@ -66,6 +73,17 @@ class V8_EXPORT_PRIVATE StubCache {
         reinterpret_cast<Address>(&first_entry(table)->value));
   }
 
+  // The offset mask of the table, which changes when the table grows.
+  SCTableReference mask_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_mask_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_mask_));
+    }
+    UNREACHABLE();
+  }
+
   StubCache::Entry* first_entry(StubCache::Table table) {
     switch (table) {
       case StubCache::kPrimary:
@@ -76,6 +94,13 @@ class V8_EXPORT_PRIVATE StubCache {
     UNREACHABLE();
   }
 
+  int primary_table_size() const {
+    return (primary_mask_ >> kCacheIndexShift) + 1;
+  }
+  int secondary_table_size() const {
+    return (secondary_mask_ >> kCacheIndexShift) + 1;
+  }
+
   Isolate* isolate() { return isolate_; }
 
   // Setting kCacheIndexShift to Name::HashBits::kShift is convenient because it
@@ -85,13 +110,18 @@ class V8_EXPORT_PRIVATE StubCache {
   // the static_assert below, in {entry(...)}).
   static const int kCacheIndexShift = Name::HashBits::kShift;
 
+  // The initial table sizes. The bit counts are also used to mix the hashes,
+  // independently of the current table sizes.
   static const int kPrimaryTableBits = 11;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
   static const int kSecondaryTableBits = 9;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  // The limit for --stub-cache-max-primary-table-bits. The secondary table
+  // grows along with the primary table.
+  static const int kMaxPrimaryTableBits = 16;
 
-  static int PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
-  static int SecondaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
+  int PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map) const;
+  int SecondaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map) const;
 
   // The constructor is made public only for the purposes of testing.
   explicit StubCache(Isolate* isolate);
@@ -109,12 +139,15 @@ class V8_EXPORT_PRIVATE StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Tagged<Name> name, Tagged<Map> map);
+  int PrimaryOffset(Tagged<Name> name, Tagged<Map> map) const;
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Tagged<Name> name, Tagged<Map> map);
+  int SecondaryOffset(Tagged<Name> name, Tagged<Map> map) const;
+
+  // Doubles both tables if they missed too often since the last call.
+  void MaybeGrow();
 
   // Compute the entry for a given offset in exactly the same way as
   // we do in generated code.  We generate an hash code that already
@@ -131,8 +164,16 @@ class V8_EXPORT_PRIVATE StubCache {
   }
 
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  // Backing store for both tables at their maximum size.
+  VirtualMemory reservation_;
+  Entry* primary_;
+  Entry* secondary_;
+  // The offset masks, i.e. (table size - 1) << kCacheIndexShift.
+  uint32_t primary_mask_ = (kPrimaryTableSize - 1) << kCacheIndexShift;
+  uint32_t secondary_mask_ = (kSecondaryTableSize - 1) << kCacheIndexShift;
+  int max_primary_table_bits_;
+  // Number of Set() calls since the last Clear().
+  size_t updates_since_clear_ = 0;
   Isolate* isolate_;
 
   friend class Isolate;
@@ -247,6 +247,9 @@ class Genesis {
   void InitializeGlobal(DirectHandle<JSGlobalObject> global_object,
                         DirectHandle<JSFunction> empty_function);
   void InitializeExperimentalGlobal();
+  // Installs the lazy accessors for the Intl constructors that are kept out
+  // of the snapshot.
+  void InstallLazyIntlConstructors();
   void InitializeIteratorFunctions();
   void InitializeCallSiteBuiltins();
   void InitializeConsole(DirectHandle<JSObject> extras_binding);
@@ -1582,6 +1585,222 @@ void InstallError(Isolate* isolate, DirectHandle<JSObject> global,
   }
 }
 
+#ifdef V8_INTL_SUPPORT
+
+namespace {
+
+// Intl.DisplayNames and Intl.Segmenter are rarely used, so they are not part
+// of the context snapshot. Each context gets lazy accessors on its Intl
+// object instead, which build the constructor on first access (see
+// Genesis::InstallLazyIntlConstructors).
+
+DirectHandle<JSFunction> InitializeIntlDisplayNames(Isolate* isolate) {
+  DirectHandle<NativeContext> native_context = isolate->native_context();
+
+  // Already initialized?
+  DirectHandle<Object> maybe_display_names(
+      native_context->GetNoCell(Context::INTL_DISPLAY_NAMES_FUNCTION_INDEX),
+      isolate);
+  if (IsJSFunction(*maybe_display_names)) {
+    return Cast<JSFunction>(maybe_display_names);
+  }
+
+  Factory* factory = isolate->factory();
+  DirectHandle<JSFunction> display_names_fun = CreateFunction(
+      isolate, "DisplayNames", JS_DISPLAY_NAMES_TYPE,
+      JSDisplayNames::kHeaderSize, 0, factory->the_hole_value(),
+      Builtin::kDisplayNamesConstructor, 2, kDontAdapt);
+  InstallWithIntrinsicDefaultProto(isolate, display_names_fun,
+                                   Context::INTL_DISPLAY_NAMES_FUNCTION_INDEX);
+
+  SimpleInstallFunction(isolate, display_names_fun, "supportedLocalesOf",
+                        Builtin::kDisplayNamesSupportedLocalesOf, 1,
+                        kDontAdapt);
+
+  {
+    // Setup %DisplayNamesPrototype%.
+    DirectHandle<JSObject> prototype(
+        Cast<JSObject>(display_names_fun->instance_prototype()), isolate);
+
+    InstallToStringTag(isolate, prototype, "Intl.DisplayNames");
+
+    SimpleInstallFunction(isolate, prototype, "resolvedOptions",
+                          Builtin::kDisplayNamesPrototypeResolvedOptions, 0,
+                          kDontAdapt);
+
+    SimpleInstallFunction(isolate, prototype, "of",
+                          Builtin::kDisplayNamesPrototypeOf, 1, kDontAdapt);
+  }
+  return display_names_fun;
+}
+
+DirectHandle<JSFunction> InitializeIntlSegmenter(Isolate* isolate) {
+  DirectHandle<NativeContext> native_context = isolate->native_context();
+
+  // Already initialized?
+  DirectHandle<Object> maybe_segmenter(
+      native_context->GetNoCell(Context::INTL_SEGMENTER_FUNCTION_INDEX),
+      isolate);
+  if (IsJSFunction(*maybe_segmenter)) {
+    return Cast<JSFunction>(maybe_segmenter);
+  }
+
+  Factory* factory = isolate->factory();
+  DirectHandle<JSFunction> segmenter_fun =
+      CreateFunction(isolate, "Segmenter", JS_SEGMENTER_TYPE,
+                     JSSegmenter::kHeaderSize, 0, factory->the_hole_value(),
+                     Builtin::kSegmenterConstructor, 0, kDontAdapt);
+  InstallWithIntrinsicDefaultProto(isolate, segmenter_fun,
+                                   Context::INTL_SEGMENTER_FUNCTION_INDEX);
+  SimpleInstallFunction(isolate, segmenter_fun, "supportedLocalesOf",
+                        Builtin::kSegmenterSupportedLocalesOf, 1, kDontAdapt);
+  {
+    // Setup %SegmenterPrototype%.
+    DirectHandle<JSObject> prototype(
+        Cast<JSObject>(segmenter_fun->instance_prototype()), isolate);
+    // #sec-intl.segmenter.prototype-@@tostringtag
+    //
+    // Intl.Segmenter.prototype [ @@toStringTag ]
+    //
+    // The initial value of the @@toStringTag property is the String value
+    // "Intl.Segmenter".
+    InstallToStringTag(isolate, prototype, "Intl.Segmenter");
+    SimpleInstallFunction(isolate, prototype, "resolvedOptions",
+                          Builtin::kSegmenterPrototypeResolvedOptions, 0,
+                          kDontAdapt);
+    SimpleInstallFunction(isolate, prototype, "segment",
+                          Builtin::kSegmenterPrototypeSegment, 1, kDontAdapt);
+  }
+  {
+    // Setup %SegmentsPrototype%.
+    DirectHandle<JSObject> prototype = factory->NewJSObject(
+        isolate->object_function(), AllocationType::kOld);
+    DirectHandle<String> name_string =
+        Name::ToFunctionName(isolate, factory->Segments_string())
+            .ToHandleChecked();
+    DirectHandle<JSFunction> segments_fun = CreateFunction(
+        isolate, name_string, JS_SEGMENTS_TYPE, JSSegments::kHeaderSize, 0,
+        prototype, Builtin::kIllegal, 0, kDontAdapt);
+    segments_fun->shared()->set_native(false);
+    SimpleInstallFunction(isolate, prototype, "containing",
+                          Builtin::kSegmentsPrototypeContaining, 1, kDontAdapt);
+    InstallFunctionAtSymbol(isolate, prototype, factory->iterator_symbol(),
+                            "[Symbol.iterator]",
+                            Builtin::kSegmentsPrototypeIterator, 0, kAdapt,
+                            DONT_ENUM);
+    DirectHandle<Map> segments_map(segments_fun->initial_map(), isolate);
+    native_context->set_intl_segments_map(*segments_map);
+  }
+  {
+    // Setup %SegmentIteratorPrototype%.
+    DirectHandle<JSObject> iterator_prototype(
+        native_context->initial_iterator_prototype(), isolate);
+    DirectHandle<JSObject> prototype = factory->NewJSObject(
+        isolate->object_function(), AllocationType::kOld);
+    JSObject::ForceSetPrototype(isolate, prototype, iterator_prototype);
+    // #sec-%segmentiteratorprototype%.@@tostringtag
+    //
+    // %SegmentIteratorPrototype% [ @@toStringTag ]
+    //
+    // The initial value of the @@toStringTag property is the String value
+    // "Segmenter String Iterator".
+    InstallToStringTag(isolate, prototype, "Segmenter String Iterator");
+    SimpleInstallFunction(isolate, prototype, "next",
+                          Builtin::kSegmentIteratorPrototypeNext, 0,
+                          kDontAdapt);
+    // Setup SegmentIterator constructor.
+    DirectHandle<String> name_string =
+        Name::ToFunctionName(isolate, factory->SegmentIterator_string())
+            .ToHandleChecked();
+    DirectHandle<JSFunction> segment_iterator_fun =
+        CreateFunction(isolate, name_string, JS_SEGMENT_ITERATOR_TYPE,
+                       JSSegmentIterator::kHeaderSize, 0, prototype,
+                       Builtin::kIllegal, 0, kDontAdapt);
+    segment_iterator_fun->shared()->set_native(false);
+    DirectHandle<Map> segment_iterator_map(segment_iterator_fun->initial_map(),
+                                           isolate);
+    native_context->set_intl_segment_iterator_map(*segment_iterator_map);
+  }
+  {
+    // Set up the maps for SegmentDataObjects, with and without "isWordLike"
+    // property.
+    constexpr int kNumProperties = 3;
+    constexpr int kNumPropertiesWithWordlike = kNumProperties + 1;
+    constexpr int kInstanceSize =
+        JSObject::kHeaderSize + kNumProperties * kTaggedSize;
+    constexpr int kInstanceSizeWithWordlike =
+        JSObject::kHeaderSize + kNumPropertiesWithWordlike * kTaggedSize;
+    DirectHandle<Map> map = factory->NewContextfulMapForCurrentContext(
+        JS_OBJECT_TYPE, kInstanceSize, TERMINAL_FAST_ELEMENTS_KIND,
+        kNumProperties);
+    DirectHandle<Map> map_with_wordlike =
+        factory->NewContextfulMapForCurrentContext(
+            JS_OBJECT_TYPE, kInstanceSizeWithWordlike,
+            TERMINAL_FAST_ELEMENTS_KIND, kNumPropertiesWithWordlike);
+    map->SetConstructor(native_context->object_function());
+    map_with_wordlike->SetConstructor(native_context->object_function());
+    map->set_prototype(*isolate->initial_object_prototype());
+    map_with_wordlike->set_prototype(*isolate->initial_object_prototype());
+    Map::EnsureDescriptorSlack(isolate, map, kNumProperties);
+    Map::EnsureDescriptorSlack(isolate, map_with_wordlike,
+                               kNumPropertiesWithWordlike);
+    int index = 0;
+    {  // segment
+      Descriptor d =
+          Descriptor::DataField(isolate, factory->segment_string(), index++,
+                                NONE, Representation::Tagged());
+      map->AppendDescriptor(isolate, &d);
+      map_with_wordlike->AppendDescriptor(isolate, &d);
+    }
+    {  // index
+      Descriptor d =
+          Descriptor::DataField(isolate, factory->index_string(), index++,
+                                NONE, Representation::Tagged());
+      map->AppendDescriptor(isolate, &d);
+      map_with_wordlike->AppendDescriptor(isolate, &d);
+    }
+    {  // input
+      Descriptor d =
+          Descriptor::DataField(isolate, factory->input_string(), index++,
+                                NONE, Representation::Tagged());
+      map->AppendDescriptor(isolate, &d);
+      map_with_wordlike->AppendDescriptor(isolate, &d);
+    }
+    DCHECK_EQ(index, kNumProperties);
+    {  // isWordLike
+      Descriptor d =
+          Descriptor::DataField(isolate, factory->isWordLike_string(), index++,
+                                NONE, Representation::Tagged());
+      map_with_wordlike->AppendDescriptor(isolate, &d);
+    }
+    DCHECK_EQ(index, kNumPropertiesWithWordlike);
+    DCHECK(!map->is_dictionary_map());
+    DCHECK(!map_with_wordlike->is_dictionary_map());
+    native_context->set_intl_segment_data_object_map(*map);
+    native_context->set_intl_segment_data_object_wordlike_map(
+        *map_with_wordlike);
+  }
+  return segmenter_fun;
+}
+
+void LazyInitializeIntlDisplayNames(
+    v8::Local<v8::Name> name, const v8::PropertyCallbackInfo<v8::Value>& info) {
+  Isolate* isolate = reinterpret_cast<Isolate*>(info.GetIsolate());
+  DirectHandle<JSFunction> display_names = InitializeIntlDisplayNames(isolate);
+  info.GetReturnValue().Set(v8::Utils::ToLocal(display_names));
+}
+
+void LazyInitializeIntlSegmenter(
+    v8::Local<v8::Name> name, const v8::PropertyCallbackInfo<v8::Value>& info) {
+  Isolate* isolate = reinterpret_cast<Isolate*>(info.GetIsolate());
+  DirectHandle<JSFunction> segmenter = InitializeIntlSegmenter(isolate);
+  info.GetReturnValue().Set(v8::Utils::ToLocal(segmenter));
+}
+
+}  // namespace
+
+#endif  // V8_INTL_SUPPORT
+
 #ifdef V8_TEMPORAL_SUPPORT
 
 namespace {
@@ -3851,175 +4070,6 @@ void Genesis::InitializeGlobal(DirectHandle<JSGlobalObject> global_object,
                             kDontAdapt);
     }
 
-    {  // -- D i s p l a y N a m e s
-      DirectHandle<JSFunction> display_names_fun = InstallFunction(
-          isolate(), intl, "DisplayNames", JS_DISPLAY_NAMES_TYPE,
-          JSDisplayNames::kHeaderSize, 0, factory->the_hole_value(),
-          Builtin::kDisplayNamesConstructor, 2, kDontAdapt);
-      InstallWithIntrinsicDefaultProto(
-          isolate(), display_names_fun,
-          Context::INTL_DISPLAY_NAMES_FUNCTION_INDEX);
-
-      SimpleInstallFunction(isolate(), display_names_fun, "supportedLocalesOf",
-                            Builtin::kDisplayNamesSupportedLocalesOf, 1,
-                            kDontAdapt);
-
-      {
-        // Setup %DisplayNamesPrototype%.
-        DirectHandle<JSObject> prototype(
-            Cast<JSObject>(display_names_fun->instance_prototype()), isolate());
-
-        InstallToStringTag(isolate(), prototype, "Intl.DisplayNames");
-
-        SimpleInstallFunction(isolate(), prototype, "resolvedOptions",
-                              Builtin::kDisplayNamesPrototypeResolvedOptions, 0,
-                              kDontAdapt);
-
-        SimpleInstallFunction(isolate(), prototype, "of",
-                              Builtin::kDisplayNamesPrototypeOf, 1, kDontAdapt);
-      }
-    }
-
-    {  // -- S e g m e n t e r
-      DirectHandle<JSFunction> segmenter_fun = InstallFunction(
-          isolate(), intl, "Segmenter", JS_SEGMENTER_TYPE,
-          JSSegmenter::kHeaderSize, 0, factory->the_hole_value(),
-          Builtin::kSegmenterConstructor, 0, kDontAdapt);
-      InstallWithIntrinsicDefaultProto(isolate_, segmenter_fun,
-                                       Context::INTL_SEGMENTER_FUNCTION_INDEX);
-      SimpleInstallFunction(isolate(), segmenter_fun, "supportedLocalesOf",
-                            Builtin::kSegmenterSupportedLocalesOf, 1,
-                            kDontAdapt);
-      {
-        // Setup %SegmenterPrototype%.
-        DirectHandle<JSObject> prototype(
-            Cast<JSObject>(segmenter_fun->instance_prototype()), isolate());
-        // #sec-intl.segmenter.prototype-@@tostringtag
-        //
-        // Intl.Segmenter.prototype [ @@toStringTag ]
-        //
-        // The initial value of the @@toStringTag property is the String value
-        // "Intl.Segmenter".
-        InstallToStringTag(isolate(), prototype, "Intl.Segmenter");
-        SimpleInstallFunction(isolate(), prototype, "resolvedOptions",
-                              Builtin::kSegmenterPrototypeResolvedOptions, 0,
-                              kDontAdapt);
-        SimpleInstallFunction(isolate(), prototype, "segment",
-                              Builtin::kSegmenterPrototypeSegment, 1,
-                              kDontAdapt);
-      }
-      {
-        // Setup %SegmentsPrototype%.
-        DirectHandle<JSObject> prototype = factory->NewJSObject(
-            isolate()->object_function(), AllocationType::kOld);
-        DirectHandle<String> name_string =
-            Name::ToFunctionName(isolate(), factory->Segments_string())
-                .ToHandleChecked();
-        DirectHandle<JSFunction> segments_fun = CreateFunction(
-            isolate(), name_string, JS_SEGMENTS_TYPE, JSSegments::kHeaderSize,
-            0, prototype, Builtin::kIllegal, 0, kDontAdapt);
-        segments_fun->shared()->set_native(false);
-        SimpleInstallFunction(isolate(), prototype, "containing",
-                              Builtin::kSegmentsPrototypeContaining, 1,
-                              kDontAdapt);
-        InstallFunctionAtSymbol(isolate_, prototype, factory->iterator_symbol(),
-                                "[Symbol.iterator]",
-                                Builtin::kSegmentsPrototypeIterator, 0, kAdapt,
-                                DONT_ENUM);
-        DirectHandle<Map> segments_map(segments_fun->initial_map(), isolate());
-        native_context()->set_intl_segments_map(*segments_map);
-      }
-      {
-        // Setup %SegmentIteratorPrototype%.
-        DirectHandle<JSObject> iterator_prototype(
-            native_context()->initial_iterator_prototype(), isolate());
-        DirectHandle<JSObject> prototype = factory->NewJSObject(
-            isolate()->object_function(), AllocationType::kOld);
-        JSObject::ForceSetPrototype(isolate(), prototype, iterator_prototype);
-        // #sec-%segmentiteratorprototype%.@@tostringtag
-        //
-        // %SegmentIteratorPrototype% [ @@toStringTag ]
-        //
-        // The initial value of the @@toStringTag property is the String value
-        // "Segmenter String Iterator".
-        InstallToStringTag(isolate(), prototype, "Segmenter String Iterator");
-        SimpleInstallFunction(isolate(), prototype, "next",
-                              Builtin::kSegmentIteratorPrototypeNext, 0,
-                              kDontAdapt);
-        // Setup SegmentIterator constructor.
-        DirectHandle<String> name_string =
-            Name::ToFunctionName(isolate(), factory->SegmentIterator_string())
-                .ToHandleChecked();
-        DirectHandle<JSFunction> segment_iterator_fun =
-            CreateFunction(isolate(), name_string, JS_SEGMENT_ITERATOR_TYPE,
-                           JSSegmentIterator::kHeaderSize, 0, prototype,
-                           Builtin::kIllegal, 0, kDontAdapt);
-        segment_iterator_fun->shared()->set_native(false);
-        DirectHandle<Map> segment_iterator_map(
-            segment_iterator_fun->initial_map(), isolate());
-        native_context()->set_intl_segment_iterator_map(*segment_iterator_map);
-      }
-      {
-        // Set up the maps for SegmentDataObjects, with and without "isWordLike"
-        // property.
-        constexpr int kNumProperties = 3;
-        constexpr int kNumPropertiesWithWordlike = kNumProperties + 1;
-        constexpr int kInstanceSize =
-            JSObject::kHeaderSize + kNumProperties * kTaggedSize;
-        constexpr int kInstanceSizeWithWordlike =
-            JSObject::kHeaderSize + kNumPropertiesWithWordlike * kTaggedSize;
-        DirectHandle<Map> map = factory->NewContextfulMapForCurrentContext(
-            JS_OBJECT_TYPE, kInstanceSize, TERMINAL_FAST_ELEMENTS_KIND,
-            kNumProperties);
-        DirectHandle<Map> map_with_wordlike =
-            factory->NewContextfulMapForCurrentContext(
-                JS_OBJECT_TYPE, kInstanceSizeWithWordlike,
-                TERMINAL_FAST_ELEMENTS_KIND, kNumPropertiesWithWordlike);
-        map->SetConstructor(native_context()->object_function());
-        map_with_wordlike->SetConstructor(native_context()->object_function());
-        map->set_prototype(*isolate_->initial_object_prototype());
-        map_with_wordlike->set_prototype(*isolate_->initial_object_prototype());
-        Map::EnsureDescriptorSlack(isolate_, map, kNumProperties);
-        Map::EnsureDescriptorSlack(isolate_, map_with_wordlike,
-                                   kNumPropertiesWithWordlike);
-        int index = 0;
-        {  // segment
-          Descriptor d =
-              Descriptor::DataField(isolate_, factory->segment_string(),
-                                    index++, NONE, Representation::Tagged());
-          map->AppendDescriptor(isolate_, &d);
-          map_with_wordlike->AppendDescriptor(isolate_, &d);
-        }
-        {  // index
-          Descriptor d =
-              Descriptor::DataField(isolate_, factory->index_string(), index++,
-                                    NONE, Representation::Tagged());
-          map->AppendDescriptor(isolate_, &d);
-          map_with_wordlike->AppendDescriptor(isolate_, &d);
-        }
-        {  // input
-          Descriptor d =
-              Descriptor::DataField(isolate_, factory->input_string(), index++,
-                                    NONE, Representation::Tagged());
-          map->AppendDescriptor(isolate_, &d);
-          map_with_wordlike->AppendDescriptor(isolate_, &d);
-        }
-        DCHECK_EQ(index, kNumProperties);
-        {  // isWordLike
-          Descriptor d =
-              Descriptor::DataField(isolate_, factory->isWordLike_string(),
-                                    index++, NONE, Representation::Tagged());
-          map_with_wordlike->AppendDescriptor(isolate_, &d);
-        }
-        DCHECK_EQ(index, kNumPropertiesWithWordlike);
-        DCHECK(!map->is_dictionary_map());
-        DCHECK(!map_with_wordlike->is_dictionary_map());
-        native_context()->set_intl_segment_data_object_map(*map);
-        native_context()->set_intl_segment_data_object_wordlike_map(
-            *map_with_wordlike);
-      }
-    }
-
     {  // -- D u r a t i o n F o r m a t
       DirectHandle<JSFunction> duration_format_fun = InstallFunction(
           isolate(), intl, "DurationFormat", JS_DURATION_FORMAT_TYPE,
@@ -5969,6 +6019,31 @@ void Genesis::InitializeGlobal_js_intl_locale_variants() {
 }
 #endif  // V8_INTL_SUPPORT
 
+void Genesis::InstallLazyIntlConstructors() {
+#ifdef V8_INTL_SUPPORT
+  DirectHandle<JSGlobalObject> global(native_context()->global_object(),
+                                      isolate());
+  DirectHandle<Object> maybe_intl = JSReceiver::GetDataProperty(
+      isolate(), global, factory()->InternalizeUtf8String("Intl"));
+  if (!IsJSObject(*maybe_intl)) return;
+  DirectHandle<JSObject> intl = Cast<JSObject>(maybe_intl);
+
+  auto install = [&](const char* name_chars,
+                     AccessorNameGetterCallback getter) {
+    DirectHandle<String> name = factory()->InternalizeUtf8String(name_chars);
+    if (JSObject::HasRealNamedProperty(isolate(), intl, name).FromJust()) {
+      return;
+    }
+    DirectHandle<AccessorInfo> accessor =
+        Accessors::MakeAccessor(isolate(), name, getter, nullptr);
+    accessor->set_replace_on_access(true);
+    JSObject::SetAccessor(intl, name, accessor, DONT_ENUM).Check();
+  };
+  install("DisplayNames", LazyInitializeIntlDisplayNames);
+  install("Segmenter", LazyInitializeIntlSegmenter);
+#endif  // V8_INTL_SUPPORT
+}
+
 void Genesis::InitializeGlobal_harmony_temporal() {
 #ifdef V8_TEMPORAL_SUPPORT
   if (!v8_flags.harmony_temporal) return;
@@ -7078,6 +7153,7 @@ Genesis::Genesis(Isolate* isolate,
   // them after they have already been deserialized would also fail.
   if (!isolate->serializer_enabled()) {
     InitializeExperimentalGlobal();
+    InstallLazyIntlConstructors();
 
     // Store String.prototype's map again in case it has been changed by
     // experimental natives.
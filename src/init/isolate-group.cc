@@ -122,6 +122,7 @@ struct PtrComprCageReservationParams
     page_initialization_mode =
         base::PageInitializationMode::kAllocatedPagesCanBeUninitialized;
     page_freeing_mode = base::PageFreeingMode::kMakeInaccessible;
+    use_huge_pages = v8_flags.transparent_huge_pages;
   }
 };
 #endif  // V8_COMPRESS_POINTERS
@@ -459,12 +459,14 @@ std::unique_ptr<V8ConsoleMessage> V8ConsoleMessage::createForConsoleAPI(
   message->m_consoleContext = consoleContext;
   message->m_type = type;
   message->m_contextId = contextId;
-  for (v8::Local<v8::Value> arg : arguments) {
-    std::unique_ptr<v8::Global<v8::Value>> argument(
-        new v8::Global<v8::Value>(isolate, arg));
-    argument->AnnotateStrongRetainer(kGlobalConsoleMessageHandleLabel);
-    message->m_arguments.push_back(std::move(argument));
-    message->m_v8Size += v8::debug::EstimatedValueSize(isolate, arg);
+  if (inspector->needsConsoleMessageArguments(groupId)) {
+    for (v8::Local<v8::Value> arg : arguments) {
+      std::unique_ptr<v8::Global<v8::Value>> argument(
+          new v8::Global<v8::Value>(isolate, arg));
+      argument->AnnotateStrongRetainer(kGlobalConsoleMessageHandleLabel);
+      message->m_arguments.push_back(std::move(argument));
+      message->m_v8Size += v8::debug::EstimatedValueSize(isolate, arg);
+    }
   }
   bool sep = false;
   for (v8::Local<v8::Value> arg : arguments) {
@@ -588,6 +590,7 @@ void V8ConsoleMessageStorage::addMessage(
         session->runtimeAgent()->messageAdded(message.get());
       });
   if (!inspector->hasConsoleMessageStorage(contextGroupId)) return;
+  if (!inspector->client()->retainConsoleMessages(contextGroupId)) return;
 
   DCHECK(m_messages.size() <= maxConsoleMessageCount);
   if (m_messages.size() == maxConsoleMessageCount) {
@@ -4,6 +4,10 @@
 
 #include "src/inspector/v8-heap-profiler-agent-impl.h"
 
+#include <algorithm>
+#include <deque>
+#include <string>
+
 #include "include/v8-context.h"
 #include "include/v8-inspector.h"
 #include "include/v8-platform.h"
@@ -34,6 +38,8 @@ static const char samplingHeapProfilerStackDepth[] =
 static const char samplingHeapProfilerFlags[] = "samplingHeapProfilerFlags";
 }  // namespace HeapProfilerAgentState
 
+constexpr int kDefaultHeapSnapshotStreamReadSize = 1 * v8::internal::MB;
+
 class HeapSnapshotProgress final : public v8::ActivityControl {
  public:
   explicit HeapSnapshotProgress(protocol::HeapProfiler::Frontend* frontend)
@@ -176,18 +182,68 @@ class V8HeapProfilerAgentImpl::GCTask : public v8::Task {
 };
 
 struct V8HeapProfilerAgentImpl::HeapSnapshotProtocolOptions {
-  HeapSnapshotProtocolOptions(std::optional<bool> reportProgress,
-                              std::optional<bool> treatGlobalObjectsAsRoots,
-                              std::optional<bool> captureNumericValue,
-                              std::optional<bool> exposeInternals)
+  HeapSnapshotProtocolOptions(
+      std::optional<bool> reportProgress,
+      std::optional<bool> treatGlobalObjectsAsRoots,
+      std::optional<bool> captureNumericValue,
+      std::optional<bool> exposeInternals,
+      std::optional<bool> returnAsStream = std::nullopt,
+      std::optional<bool> binaryFormat = std::nullopt)
       : m_reportProgress(reportProgress.value_or(false)),
         m_treatGlobalObjectsAsRoots(treatGlobalObjectsAsRoots.value_or(true)),
         m_captureNumericValue(captureNumericValue.value_or(false)),
-        m_exposeInternals(exposeInternals.value_or(false)) {}
+        m_exposeInternals(exposeInternals.value_or(false)),
+        m_returnAsStream(returnAsStream.value_or(false)),
+        m_binaryFormat(binaryFormat.value_or(false)) {}
   bool m_reportProgress;
   bool m_treatGlobalObjectsAsRoots;
   bool m_captureNumericValue;
   bool m_exposeInternals;
+  bool m_returnAsStream;
+  bool m_binaryFormat;
+};
+
+// Keeps a snapshot taken with `returnAsStream` until the client reads it with
+// readHeapSnapshotStream. Unlike addHeapSnapshotChunk events, which pile up
+// in the embedder's outgoing queue as String16 messages when the client is
+// slow, the data is held once, as bytes, and each part is released as soon as
+// it has been read.
+class V8HeapProfilerAgentImpl::HeapSnapshotStream final
+    : public v8::OutputStream {
+ public:
+  explicit HeapSnapshotStream(bool binary) : m_binary(binary) {}
+
+  void EndOfStream() override {}
+  int GetChunkSize() override { return 1 * v8::internal::MB; }
+  WriteResult WriteAsciiChunk(char* data, int size) override {
+    m_chunks.emplace_back(data, size);
+    return kContinue;
+  }
+
+  bool binary() const { return m_binary; }
+  bool eof() const { return m_chunks.empty(); }
+
+  // Removes up to |size| bytes from the front of the stream.
+  std::string read(size_t size) {
+    std::string result;
+    while (!m_chunks.empty() && result.size() < size) {
+      const std::string& chunk = m_chunks.front();
+      size_t count = std::min(size - result.size(), chunk.size() - m_offset);
+      result.append(chunk, m_offset, count);
+      m_offset += count;
+      if (m_offset == chunk.size()) {
+        m_chunks.pop_front();
+        m_offset = 0;
+      }
+    }
+    return result;
+  }
+
+ private:
+  const bool m_binary;
+  std::deque<std::string> m_chunks;
+  // Number of bytes of the first chunk that have already been read.
+  size_t m_offset = 0;
 };
 
 class V8HeapProfilerAgentImpl::HeapSnapshotTask : public v8::Task {
@@ -205,6 +261,7 @@ class V8HeapProfilerAgentImpl::HeapSnapshotTask : public v8::Task {
 
   void Run(cppgc::EmbedderStackState stackState) {
     Response response = Response::Success();
+    std::optional<String16> streamHandle;
     {
       // If the async callbacks object still exists and is not canceled, then
       // the V8HeapProfilerAgentImpl still exists, so we can safely take a
@@ -225,7 +282,8 @@ class V8HeapProfilerAgentImpl::HeapSnapshotTask : public v8::Task {
       }
       heapSnapshotTasks.erase(it);
 
-      response = m_agent->takeHeapSnapshotNow(m_protocolOptions, stackState);
+      response = m_agent->takeHeapSnapshotNow(m_protocolOptions, stackState,
+                                              &streamHandle);
     }
 
     // The rest of this function runs without the mutex, because Node expects to
@@ -235,7 +293,7 @@ class V8HeapProfilerAgentImpl::HeapSnapshotTask : public v8::Task {
     // uses weak pointers to avoid doing anything dangerous if other components
     // have been disposed (see DomainDispatcher::Callback::sendIfActive).
     if (response.IsSuccess()) {
-      m_callback->sendSuccess();
+      m_callback->sendSuccess(std::move(streamHandle));
     } else {
       m_callback->sendFailure(std::move(response));
     }
@@ -339,6 +397,7 @@ Response V8HeapProfilerAgentImpl::disable() {
     profiler->StopSamplingHeapProfiler();
   }
   profiler->ClearObjectIds();
+  m_snapshotStreams.clear();
   m_state->setBoolean(HeapProfilerAgentState::heapProfilerEnabled, false);
   return Response::Success();
 }
@@ -347,11 +406,18 @@ void V8HeapProfilerAgentImpl::takeHeapSnapshot(
     std::optional<bool> reportProgress,
     std::optional<bool> treatGlobalObjectsAsRoots,
     std::optional<bool> captureNumericValue,
-    std::optional<bool> exposeInternals,
+    std::optional<bool> exposeInternals, std::optional<bool> returnAsStream,
+    std::optional<bool> binaryFormat,
     std::unique_ptr<TakeHeapSnapshotCallback> callback) {
   HeapSnapshotProtocolOptions protocolOptions(
       std::move(reportProgress), std::move(treatGlobalObjectsAsRoots),
-      std::move(captureNumericValue), std::move(exposeInternals));
+      std::move(captureNumericValue), std::move(exposeInternals),
+      std::move(returnAsStream), std::move(binaryFormat));
+  if (protocolOptions.m_binaryFormat && !protocolOptions.m_returnAsStream) {
+    callback->sendFailure(
+        Response::InvalidParams("binaryFormat requires returnAsStream"));
+    return;
+  }
   std::shared_ptr<v8::TaskRunner> task_runner =
       v8::debug::GetCurrentPlatform()->GetForegroundTaskRunner(m_isolate);
 
@@ -362,10 +428,12 @@ void V8HeapProfilerAgentImpl::takeHeapSnapshot(
   // be taken immediately with conservative stack scanning enabled.
   if (m_session->inspector()->debugger()->isPaused() ||
       !task_runner->NonNestableTasksEnabled()) {
+    std::optional<String16> streamHandle;
     Response response = takeHeapSnapshotNow(
-        protocolOptions, cppgc::EmbedderStackState::kMayContainHeapPointers);
+        protocolOptions, cppgc::EmbedderStackState::kMayContainHeapPointers,
+        &streamHandle);
     if (response.IsSuccess()) {
-      callback->sendSuccess();
+      callback->sendSuccess(std::move(streamHandle));
     } else {
       callback->sendFailure(std::move(response));
     }
@@ -380,7 +448,8 @@ void V8HeapProfilerAgentImpl::takeHeapSnapshot(
 
 Response V8HeapProfilerAgentImpl::takeHeapSnapshotNow(
     const HeapSnapshotProtocolOptions& protocolOptions,
-    cppgc::EmbedderStackState stackState) {
+    cppgc::EmbedderStackState stackState,
+    std::optional<String16>* streamHandle) {
   v8::HeapProfiler* profiler = m_isolate->GetHeapProfiler();
   DCHECK(profiler);
   std::unique_ptr<HeapSnapshotProgress> progress;
@@ -403,6 +472,28 @@ Response V8HeapProfilerAgentImpl::takeHeapSnapshotNow(
           ? v8::HeapProfiler::NumericsMode::kExposeNumericValues
           : v8::HeapProfiler::NumericsMode::kHideNumericValues;
   options.stack_state = stackState;
+
+  if (protocolOptions.m_returnAsStream) {
+    DCHECK_NOT_NULL(streamHandle);
+    auto stream =
+        std::make_unique<HeapSnapshotStream>(protocolOptions.m_binaryFormat);
+    if (protocolOptions.m_binaryFormat) {
+      if (!profiler->StreamHeapSnapshot(stream.get(), options))
+        return Response::ServerError("Failed to take heap snapshot");
+    } else {
+      const v8::HeapSnapshot* snapshot = profiler->TakeHeapSnapshot(options);
+      if (!snapshot)
+        return Response::ServerError("Failed to take heap snapshot");
+      snapshot->Serialize(stream.get());
+      const_cast<v8::HeapSnapshot*>(snapshot)->Delete();
+    }
+    String16 handle = String16::concat(
+        "heap-snapshot-", String16::fromInteger(++m_lastSnapshotStreamId));
+    m_snapshotStreams[handle] = std::move(stream);
+    *streamHandle = handle;
+    return Response::Success();
+  }
+
   const v8::HeapSnapshot* snapshot = profiler->TakeHeapSnapshot(options);
   if (!snapshot) return Response::ServerError("Failed to take heap snapshot");
   HeapSnapshotOutputStream stream(&m_frontend);
@@ -411,6 +502,40 @@ Response V8HeapProfilerAgentImpl::takeHeapSnapshotNow(
   return Response::Success();
 }
 
+Response V8HeapProfilerAgentImpl::readHeapSnapshotStream(
+    const String16& handle, std::optional<int> size, String16* data,
+    bool* base64Encoded, bool* eof) {
+  auto it = m_snapshotStreams.find(handle);
+  if (it == m_snapshotStreams.end())
+    return Response::ServerError("Invalid heap snapshot stream handle");
+  int maxSize = size.value_or(kDefaultHeapSnapshotStreamReadSize);
+  if (maxSize <= 0) return Response::ServerError("size must be positive");
+
+  HeapSnapshotStream* stream = it->second.get();
+  std::string bytes = stream->read(maxSize);
+  if (stream->binary()) {
+    *data = protocol::Binary::fromSpan(
+                v8::MemorySpan<const uint8_t>(
+                    reinterpret_cast<const uint8_t*>(bytes.data()),
+                    bytes.size()))
+                .toBase64();
+    *base64Encoded = true;
+  } else {
+    // The JSON serializer only writes ASCII.
+    *data = String16(bytes.data(), bytes.size());
+    *base64Encoded = false;
+  }
+  *eof = stream->eof();
+  return Response::Success();
+}
+
+Response V8HeapProfilerAgentImpl::closeHeapSnapshotStream(
+    const String16& handle) {
+  if (m_snapshotStreams.erase(handle) == 0)
+    return Response::ServerError("Invalid heap snapshot stream handle");
+  return Response::Success();
+}
+
 Response V8HeapProfilerAgentImpl::getObjectByHeapObjectId(
     const String16& heapSnapshotObjectId, std::optional<String16> objectGroup,
     std::unique_ptr<protocol::Runtime::RemoteObject>* result) {
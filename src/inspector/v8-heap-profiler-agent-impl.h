@@ -5,6 +5,7 @@
 #ifndef V8_INSPECTOR_V8_HEAP_PROFILER_AGENT_IMPL_H_
 #define V8_INSPECTOR_V8_HEAP_PROFILER_AGENT_IMPL_H_
 
+#include <map>
 #include <memory>
 
 #include "src/base/macros.h"
@@ -48,8 +49,13 @@ class V8HeapProfilerAgentImpl : public protocol::HeapProfiler::Backend {
       std::optional<bool> reportProgress,
       std::optional<bool> treatGlobalObjectsAsRoots,
       std::optional<bool> captureNumericValue,
-      std::optional<bool> exposeInternals,
+      std::optional<bool> exposeInternals, std::optional<bool> returnAsStream,
+      std::optional<bool> binaryFormat,
       std::unique_ptr<TakeHeapSnapshotCallback> callback) override;
+  Response readHeapSnapshotStream(const String16& handle,
+                                  std::optional<int> size, String16* data,
+                                  bool* base64Encoded, bool* eof) override;
+  Response closeHeapSnapshotStream(const String16& handle) override;
 
   Response getObjectByHeapObjectId(
       const String16& heapSnapshotObjectId, std::optional<String16> objectGroup,
@@ -76,11 +82,14 @@ class V8HeapProfilerAgentImpl : public protocol::HeapProfiler::Backend {
   struct AsyncCallbacks;
   class GCTask;
   class HeapSnapshotTask;
+  class HeapSnapshotStream;
   struct HeapSnapshotProtocolOptions;
 
+  // If |protocolOptions| ask for a stream, |streamHandle| receives its handle.
   Response takeHeapSnapshotNow(
       const HeapSnapshotProtocolOptions& protocolOptions,
-      cppgc::EmbedderStackState stackState);
+      cppgc::EmbedderStackState stackState,
+      std::optional<String16>* streamHandle = nullptr);
   void startTrackingHeapObjectsInternal(bool trackAllocations);
   void stopTrackingHeapObjectsInternal();
   void requestHeapStatsUpdate();
@@ -94,6 +103,9 @@ class V8HeapProfilerAgentImpl : public protocol::HeapProfiler::Backend {
   bool m_hasTimer;
   double m_timerDelayInSeconds;
   std::shared_ptr<AsyncCallbacks> m_asyncCallbacks;
+  // Snapshots taken with `returnAsStream` that have not been closed yet.
+  std::map<String16, std::unique_ptr<HeapSnapshotStream>> m_snapshotStreams;
+  int m_lastSnapshotStreamId = 0;
 };
 
 }  // namespace v8_inspector
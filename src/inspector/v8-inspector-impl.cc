@@ -139,6 +139,18 @@ bool V8InspectorImpl::hasConsoleMessageStorage(int contextGroupId) {
   return storageIt != m_consoleStorageMap.end();
 }
 
+bool V8InspectorImpl::needsConsoleMessageArguments(int contextGroupId) {
+  if (m_client->retainConsoleMessages(contextGroupId)) return true;
+  bool listening = false;
+  forEachSession(contextGroupId, [&listening](V8InspectorSessionImpl* session) {
+    if (session->runtimeAgent()->enabled() ||
+        session->consoleAgent()->enabled()) {
+      listening = true;
+    }
+  });
+  return listening;
+}
+
 std::unique_ptr<V8StackTrace> V8InspectorImpl::createStackTrace(
     v8::Local<v8::StackTrace> stackTrace) {
   return m_debugger->createStackTrace(stackTrace);
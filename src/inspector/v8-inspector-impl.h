@@ -130,6 +130,9 @@ class V8InspectorImpl : public V8Inspector {
   void unmuteExceptions(int contextGroupId);
   V8ConsoleMessageStorage* ensureConsoleMessageStorage(int contextGroupId);
   bool hasConsoleMessageStorage(int contextGroupId);
+  // Whether console messages of |contextGroupId| need to keep their arguments,
+  // either for a session that listens or to be retained for a later one.
+  bool needsConsoleMessageArguments(int contextGroupId);
   void discardInspectedContext(int contextGroupId, int contextId);
   void disconnect(V8InspectorSessionImpl*);
   V8InspectorSessionImpl* sessionById(int contextGroupId, int sessionId);
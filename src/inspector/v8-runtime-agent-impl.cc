@@ -59,6 +59,7 @@
 namespace v8_inspector {
 
 namespace V8RuntimeAgentImplState {
+static const char consolePreviewsEnabled[] = "consolePreviewsEnabled";
 static const char customObjectFormatterEnabled[] =
     "customObjectFormatterEnabled";
 static const char maxCallStackSizeToCapture[] = "maxCallStackSizeToCapture";
@@ -648,6 +649,13 @@ Response V8RuntimeAgentImpl::runIfWaitingForDebugger() {
   return Response::Success();
 }
 
+Response V8RuntimeAgentImpl::setConsolePreviewsEnabled(bool enabled) {
+  m_state->setBoolean(V8RuntimeAgentImplState::consolePreviewsEnabled, enabled);
+  if (!m_enabled) return Response::ServerError("Runtime agent is not enabled");
+  m_consolePreviewsEnabled = enabled;
+  return Response::Success();
+}
+
 Response V8RuntimeAgentImpl::setCustomObjectFormatterEnabled(bool enabled) {
   m_state->setBoolean(V8RuntimeAgentImplState::customObjectFormatterEnabled,
                       enabled);
@@ -1087,6 +1095,8 @@ void V8RuntimeAgentImpl::restore() {
   if (m_state->booleanProperty(
           V8RuntimeAgentImplState::customObjectFormatterEnabled, false))
     m_session->setCustomObjectFormatterEnabled(true);
+  m_consolePreviewsEnabled = m_state->booleanProperty(
+      V8RuntimeAgentImplState::consolePreviewsEnabled, true);
 
   int size;
   if (m_state->getInteger(V8RuntimeAgentImplState::maxCallStackSizeToCapture,
@@ -1141,6 +1151,8 @@ Response V8RuntimeAgentImpl::disable() {
   m_state->remove(V8RuntimeAgentImplState::globalBindings);
   m_inspector->debugger()->setMaxCallStackSizeToCapture(this, -1);
   m_session->setCustomObjectFormatterEnabled(false);
+  m_state->remove(V8RuntimeAgentImplState::consolePreviewsEnabled);
+  m_consolePreviewsEnabled = true;
   reset();
   m_inspector->client()->endEnsureAllContextsInGroup(
       m_session->contextGroupId());
@@ -1202,7 +1214,7 @@ void V8RuntimeAgentImpl::inspect(
 }
 
 void V8RuntimeAgentImpl::messageAdded(V8ConsoleMessage* message) {
-  if (m_enabled) reportMessage(message, true);
+  if (m_enabled) reportMessage(message, m_consolePreviewsEnabled);
 }
 
 bool V8RuntimeAgentImpl::reportMessage(V8ConsoleMessage* message,
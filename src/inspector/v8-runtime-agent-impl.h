@@ -115,6 +115,7 @@ class V8RuntimeAgentImpl : public protocol::Runtime::Backend {
       std::unique_ptr<protocol::Runtime::ExceptionDetails>*) override;
   Response releaseObjectGroup(const String16& objectGroup) override;
   Response runIfWaitingForDebugger() override;
+  Response setConsolePreviewsEnabled(bool) override;
   Response setCustomObjectFormatterEnabled(bool) override;
   Response setMaxCallStackSizeToCapture(int) override;
   Response discardConsoleEntries() override;
@@ -176,6 +177,7 @@ class V8RuntimeAgentImpl : public protocol::Runtime::Backend {
   V8InspectorImpl* m_inspector;
   std::shared_ptr<V8DebuggerBarrier> m_debuggerBarrier;
   bool m_enabled;
+  bool m_consolePreviewsEnabled = true;
   std::unordered_map<String16, std::unique_ptr<v8::Global<v8::Script>>>
       m_compiledScripts;
   // Binding name -> executionContextIds mapping.
@@ -1377,6 +1377,52 @@ void InterpreterAssembler::InlineShortStar(TNode<WordT> target_bytecode) {
   implicit_register_use_ = previous_acc_use;
 }
 
+void InterpreterAssembler::JumpDispatchLookahead(TNode<WordT> target_bytecode) {
+  Label if_jump_if_true(this), if_jump_if_false(this), done(this);
+
+  // A debug break replaces the opcode in the bytecode array that is executed,
+  // so breakpoints on the jump are still hit as no lookahead happens then.
+  TNode<Int32T> bytecode = TruncateWordToInt32(target_bytecode);
+  GotoIf(Word32Equal(bytecode,
+                     Int32Constant(static_cast<int>(Bytecode::kJumpIfTrue))),
+         &if_jump_if_true);
+  Branch(Word32Equal(bytecode,
+                     Int32Constant(static_cast<int>(Bytecode::kJumpIfFalse))),
+         &if_jump_if_false, &done);
+
+  BIND(&if_jump_if_true);
+  InlineConditionalJump(Bytecode::kJumpIfTrue, TrueConstant());
+
+  BIND(&if_jump_if_false);
+  InlineConditionalJump(Bytecode::kJumpIfFalse, FalseConstant());
+
+  BIND(&done);
+}
+
+void InterpreterAssembler::InlineConditionalJump(Bytecode jump_bytecode,
+                                                 TNode<Boolean> jump_value) {
+  Bytecode previous_bytecode = bytecode_;
+  ImplicitRegisterUse previous_acc_use = implicit_register_use_;
+
+  // The handler's bytecode produced a boolean, so this is exactly what the
+  // JumpIfTrue and JumpIfFalse handlers do. As with the short Star, both the
+  // jump and the fall-through dispatch are duplicated here for better branch
+  // prediction.
+  bytecode_ = jump_bytecode;
+  implicit_register_use_ = ImplicitRegisterUse::kNone;
+
+#ifdef V8_TRACE_UNOPTIMIZED
+  TraceBytecode(Runtime::kTraceUnoptimizedBytecodeEntry);
+#endif
+
+  TNode<Object> accumulator = GetAccumulator();
+  CSA_DCHECK(this, IsBoolean(CAST(accumulator)));
+  JumpIfTaggedEqual(accumulator, jump_value, 0);
+
+  bytecode_ = previous_bytecode;
+  implicit_register_use_ = previous_acc_use;
+}
+
 void InterpreterAssembler::Dispatch() {
   Comment("========= Dispatch");
   DCHECK_IMPLIES(Bytecodes::MakesCallAlongCriticalPath(bytecode_), made_call_);
@@ -1390,6 +1436,9 @@ void InterpreterAssembler::DispatchToBytecodeWithOptionalStarLookahead(
   if (Bytecodes::IsStarLookahead(bytecode_, operand_scale_)) {
     StarDispatchLookahead(target_bytecode);
   }
+  if (Bytecodes::IsJumpLookahead(bytecode_, operand_scale_)) {
+    JumpDispatchLookahead(target_bytecode);
+  }
   DispatchToBytecode(target_bytecode, BytecodeOffset());
 }
 
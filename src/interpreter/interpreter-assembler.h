@@ -304,7 +304,8 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
 
   // Dispatches to |target_bytecode| at BytecodeOffset(). Includes short-star
   // lookahead if the current bytecode_ is likely followed by a short-star
-  // instruction.
+  // instruction, and conditional jump lookahead if it is likely followed by a
+  // JumpIfTrue or JumpIfFalse.
   void DispatchToBytecodeWithOptionalStarLookahead(
       TNode<WordT> target_bytecode);
 
@@ -471,6 +472,15 @@ class V8_EXPORT_PRIVATE InterpreterAssembler : public CodeStubAssembler {
   // the next dispatch offset.
   void InlineShortStar(TNode<WordT> target_bytecode);
 
+  // Look ahead for JumpIfTrue and JumpIfFalse and inline them in a branch,
+  // including the subsequent dispatch. Saves a dispatch for the common
+  // "TestXXX; JumpIfFalse" sequences of conditions and loops.
+  void JumpDispatchLookahead(TNode<WordT> target_bytecode);
+
+  // Build code for |jump_bytecode| at the current BytecodeOffset(), which jumps
+  // if the accumulator is |jump_value|, and dispatch to the next bytecode.
+  void InlineConditionalJump(Bytecode jump_bytecode, TNode<Boolean> jump_value);
+
   // Dispatch to the bytecode handler with code entry point |handler_entry|.
   void DispatchToBytecodeHandlerEntry(TNode<RawPtrT> handler_entry,
                                       TNode<IntPtrT> bytecode_offset);
@@ -4,8 +4,11 @@
 
 #include "src/json/json-parser.h"
 
+#include <atomic>
 #include <optional>
 
+#include "hwy/highway.h"
+#include "include/v8-platform.h"
 #include "src/base/small-vector.h"
 #include "src/base/strings.h"
 #include "src/builtins/builtins.h"
@@ -15,6 +18,7 @@
 #include "src/debug/debug.h"
 #include "src/execution/frames-inl.h"
 #include "src/heap/factory.h"
+#include "src/init/v8.h"
 #include "src/numbers/conversions.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/elements-kind.h"
@@ -130,6 +134,50 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// Skips characters at the start of [cursor, end) that cannot terminate a JSON
+// string, two vectors at a time, and returns a position at or before the first
+// one that may. Skipped two-byte characters outside of Latin1 are recorded in
+// {bits}.
+template <typename Char>
+const Char* SkipJsonStringCharacters(const Char* cursor, const Char* end,
+                                     base::uc32* bits) {
+  namespace hw = hwy::HWY_NAMESPACE;
+  const hw::ScalableTag<Char> d;
+  const size_t N = hw::Lanes(d);
+  const auto control_limit = hw::Set(d, 0x20);
+  const auto quote = hw::Set(d, '"');
+  const auto backslash = hw::Set(d, '\\');
+  [[maybe_unused]] auto skipped = hw::Zero(d);
+  for (; static_cast<size_t>(end - cursor) >= 2 * N; cursor += 2 * N) {
+    const auto v0 = hw::LoadU(d, cursor);
+    const auto v1 = hw::LoadU(d, cursor + N);
+    const auto terminates0 = hw::Or(
+        hw::Or(hw::Lt(v0, control_limit), hw::Eq(v0, quote)),
+        hw::Eq(v0, backslash));
+    const auto terminates1 = hw::Or(
+        hw::Or(hw::Lt(v1, control_limit), hw::Eq(v1, quote)),
+        hw::Eq(v1, backslash));
+    if (V8_UNLIKELY(!hw::AllFalse(d, hw::Or(terminates0, terminates1)))) {
+      // Two-byte characters in front of the terminating one still have to
+      // be added to {bits}, so leave them to the caller.
+      if constexpr (sizeof(Char) == 1) {
+        cursor += hw::AllFalse(d, terminates0)
+                      ? N + hw::FindKnownFirstTrue(d, terminates1)
+                      : hw::FindKnownFirstTrue(d, terminates0);
+      }
+      break;
+    }
+    if constexpr (sizeof(Char) == 2) skipped = hw::Or(skipped, hw::Or(v0, v1));
+  }
+  if constexpr (sizeof(Char) == 2) {
+    const auto latin1_limit = hw::Set(d, unibrow::Latin1::kMaxChar);
+    if (!hw::AllFalse(d, hw::Gt(skipped, latin1_limit))) {
+      *bits |= unibrow::Latin1::kMaxChar + 1;
+    }
+  }
+  return cursor;
+}
+
 #define EXPECT_RETURN_ON_ERROR(token, msg, ret) \
   if (V8_UNLIKELY(!Expect<token>(msg))) {       \
     return ret;                                 \
@@ -2346,11 +2394,15 @@ bool JsonParser<Char>::ParseJsonNumberAsDoubleOrSmi(double* result_double,
       AdvanceToNonDecimal();
     }
 
-    base::Vector<const Char> chars(start, cursor_ - start);
-    *result_double =
-        StringToDouble(chars,
-                       NO_CONVERSION_FLAG,  // Hex, octal or trailing junk.
-                       std::numeric_limits<double>::quiet_NaN());
+    uint32_t length = static_cast<uint32_t>(cursor_ - start);
+    if (!TakePrescannedNumber(static_cast<uint32_t>(start - chars_), length,
+                              result_double)) {
+      base::Vector<const Char> chars(start, length);
+      *result_double =
+          StringToDouble(chars,
+                         NO_CONVERSION_FLAG,  // Hex, octal or trailing junk.
+                         std::numeric_limits<double>::quiet_NaN());
+    }
     DCHECK(!std::isnan(*result_double));
 
     // The result might still be a smi even if it has a decimal part.
@@ -2358,6 +2410,153 @@ bool JsonParser<Char>::ParseJsonNumberAsDoubleOrSmi(double* result_double,
   }
 }
 
+// Finds the numbers of a chunk of the source without knowing whether the chunk
+// starts inside a string. Every number is preceded by a delimiter, so numbers
+// are matched at each delimiter. Matches inside strings are never looked up
+// by the parser, which only uses numbers at the exact position and length it
+// scanned itself.
+template <typename Char>
+class JsonParser<Char>::NumberPrescanJob final : public JobTask {
+ public:
+  static constexpr size_t kChunkSize = 64 * KB;
+
+  NumberPrescanJob(const Char* chars, size_t start, size_t end,
+                   std::vector<std::vector<PrescannedNumber>>* chunks)
+      : chars_(chars), start_(start), end_(end), chunks_(chunks) {}
+
+  static size_t ChunkCount(size_t length) {
+    return (length + kChunkSize - 1) / kChunkSize;
+  }
+
+  void Run(JobDelegate* delegate) override {
+    do {
+      size_t chunk = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= chunks_->size()) return;
+      size_t begin = start_ + chunk * kChunkSize;
+      ScanChunk(begin, std::min(end_, begin + kChunkSize),
+                &(*chunks_)[chunk]);
+    } while (!delegate->ShouldYield());
+  }
+
+  size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+    size_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    return chunks_->size() - std::min(next_chunk, chunks_->size());
+  }
+
+ private:
+  static bool IsDelimiter(Char c) {
+    return c == '[' || c == ',' || c == ':' || c == ' ' || c == '\t' ||
+           c == '\n' || c == '\r';
+  }
+
+  const Char* SkipDigits(const Char* cursor) const {
+    return std::find_if(cursor, chars_ + end_,
+                        [](Char c) { return !IsDecimalDigit(c); });
+  }
+
+  // Returns the length of the number at {start}, or 0 if there is no valid
+  // number. {is_double} is cleared if ParseJsonNumberAsDoubleOrSmi handles
+  // the number as a Smi without calling StringToDouble.
+  size_t MatchNumber(const Char* start, bool* is_double) const {
+    const Char* end = chars_ + end_;
+    const Char* cursor = start;
+    if (*cursor == '-') cursor++;
+    if (cursor == end || !IsDecimalDigit(*cursor)) return 0;
+    const Char* digits = cursor;
+    if (*cursor == '0') {
+      cursor++;
+      if (cursor != end && IsDecimalDigit(*cursor)) return 0;
+      *is_double = digits != start;
+    } else {
+      cursor = SkipDigits(cursor);
+      *is_double = cursor - digits > 9;
+    }
+    if (cursor != end && *cursor == '.') {
+      cursor++;
+      if (cursor == end || !IsDecimalDigit(*cursor)) return 0;
+      cursor = SkipDigits(cursor);
+      *is_double = true;
+    }
+    if (cursor != end && (*cursor == 'e' || *cursor == 'E')) {
+      cursor++;
+      if (cursor != end && (*cursor == '-' || *cursor == '+')) cursor++;
+      if (cursor == end || !IsDecimalDigit(*cursor)) return 0;
+      cursor = SkipDigits(cursor);
+      *is_double = true;
+    }
+    return cursor - start;
+  }
+
+  void ScanChunk(size_t begin, size_t end,
+                 std::vector<PrescannedNumber>* numbers) const {
+    for (size_t i = begin; i < end; i++) {
+      Char c = chars_[i];
+      if (c != '-' && !IsDecimalDigit(c)) continue;
+      if (i != start_ && !IsDelimiter(chars_[i - 1])) continue;
+      bool is_double;
+      size_t length = MatchNumber(chars_ + i, &is_double);
+      if (length == 0) continue;
+      if (is_double) {
+        base::Vector<const Char> number(chars_ + i, length);
+        double value = StringToDouble(number, NO_CONVERSION_FLAG,
+                                      std::numeric_limits<double>::quiet_NaN());
+        numbers->push_back({static_cast<uint32_t>(i),
+                            static_cast<uint32_t>(length), value});
+      }
+      i += length - 1;
+    }
+  }
+
+  const Char* const chars_;
+  const size_t start_;
+  const size_t end_;
+  std::vector<std::vector<PrescannedNumber>>* const chunks_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+template <typename Char>
+void JsonParser<Char>::PrescanNumbers() {
+  DCHECK(prescanned_numbers_.empty());
+  if (v8_flags.single_threaded ||
+      remaining_chars() < v8_flags.json_parse_parallel_numbers_threshold) {
+    return;
+  }
+  // The job reads the characters directly, so they must not move until it is
+  // done.
+  DisallowGarbageCollection no_gc;
+  std::vector<std::vector<PrescannedNumber>> chunks(
+      NumberPrescanJob::ChunkCount(remaining_chars()));
+  V8::GetCurrentPlatform()
+      ->CreateJob(TaskPriority::kUserBlocking,
+                  std::make_unique<NumberPrescanJob>(chars_, position(),
+                                                     end_ - chars_, &chunks))
+      ->Join();
+  size_t count = 0;
+  for (const auto& chunk : chunks) count += chunk.size();
+  prescanned_numbers_.reserve(count);
+  for (const auto& chunk : chunks) {
+    prescanned_numbers_.insert(prescanned_numbers_.end(), chunk.begin(),
+                               chunk.end());
+  }
+}
+
+template <typename Char>
+bool JsonParser<Char>::TakePrescannedNumber(uint32_t position,
+                                            uint32_t length, double* value) {
+  while (next_prescanned_number_ < prescanned_numbers_.size()) {
+    const PrescannedNumber& number =
+        prescanned_numbers_[next_prescanned_number_];
+    if (number.position > position) return false;
+    next_prescanned_number_++;
+    if (number.position == position) {
+      if (number.length != length) return false;
+      *value = number.value;
+      return true;
+    }
+  }
+  return false;
+}
+
 namespace {
 
 template <typename Char>
@@ -2517,6 +2716,7 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
+    cursor_ = SkipJsonStringCharacters(cursor_, end_, &bits);
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
@@ -2627,6 +2827,7 @@ MaybeHandle<Object> JsonParser<Char>::Parse(
   MaybeHandle<Object> val_node;
   {
     JsonParser parser(isolate, source, script_details);
+    if (v8_flags.json_parse_parallel_numbers) parser.PrescanNumbers();
     ASSIGN_RETURN_ON_EXCEPTION(isolate, result,
                                parser.ParseJson(collect_source_strings));
     val_node = parser.parsed_val_node_;
@@ -6,6 +6,7 @@
 #define V8_JSON_JSON_PARSER_H_
 
 #include <optional>
+#include <vector>
 
 #include "include/v8-callbacks.h"
 #include "src/base/small-vector.h"
@@ -224,6 +225,16 @@ class JsonParser final {
 
  private:
   class NamedPropertyIterator;
+  class NumberPrescanJob;
+
+  // A number that was converted to a double on a worker thread before
+  // parsing started. {position} and {length} describe the characters of the
+  // number in the source.
+  struct PrescannedNumber {
+    uint32_t position;
+    uint32_t length;
+    double value;
+  };
 
   template <typename T>
   using SmallVector = base::SmallVector<T, 16>;
@@ -261,6 +272,12 @@ class JsonParser final {
 
   bool ParseRawJson();
 
+  // Convert the numbers of a large source on worker threads, so that parsing
+  // does not have to call StringToDouble for them.
+  void PrescanNumbers();
+  bool TakePrescannedNumber(uint32_t position, uint32_t length,
+                            double* value);
+
   void advance() { ++cursor_; }
 
   base::uc32 CurrentCharacter() const {
@@ -499,6 +516,11 @@ class JsonParser final {
   SmallVector<double> double_elements_;
   SmallVector<int> smi_elements_;
 
+  // Sorted by position. Since the parser only moves forward, we look up
+  // numbers starting at {next_prescanned_number_}.
+  std::vector<PrescannedNumber> prescanned_numbers_;
+  size_t next_prescanned_number_ = 0;
+
   // Cached pointer to the raw chars in source. In case source is on-heap, we
   // register an UpdatePointers callback. For this reason, chars_, cursor_ and
   // end_ should never be locally cached across a possible allocation. The scope
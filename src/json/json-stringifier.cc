@@ -4,10 +4,16 @@
 
 #include "src/json/json-stringifier.h"
 
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
 #include <string_view>
+#include <vector>
 
 #include "absl/functional/overload.h"
 #include "hwy/highway.h"
+#include "include/v8-profiler.h"
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
@@ -25,15 +31,72 @@
 #include "src/objects/smi.h"
 #include "src/objects/tagged.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-inl.h"
 
 namespace v8 {
 namespace internal {
 
 static constexpr char kJsonStringifierZoneName[] = "json-stringifier-zone";
 
+// Encodes serialized characters as UTF-8 and writes them to an OutputStream
+// in chunks of at most the stream's preferred size.
+class JsonOutputStreamWriter {
+ public:
+  explicit JsonOutputStreamWriter(v8::OutputStream* stream)
+      : stream_(stream),
+        chunk_size_(std::max(stream->GetChunkSize(), kMaxEncodedSize)),
+        chunk_(std::make_unique<char[]>(chunk_size_)) {}
+
+  // Writes {length} characters. A surrogate pair must not be split across
+  // two calls.
+  template <typename Char>
+  void Write(const Char* chars, size_t length) {
+    for (size_t i = 0; i < length && !aborted_; i++) {
+      unibrow::uchar c = chars[i];
+      if (chunk_size_ - position_ < kMaxEncodedSize) WriteChunk();
+      if constexpr (sizeof(Char) == 2) {
+        if (unibrow::Utf16::IsLeadSurrogate(c) && i + 1 < length &&
+            unibrow::Utf16::IsTrailSurrogate(chars[i + 1])) {
+          c = unibrow::Utf16::CombineSurrogatePair(c, chars[++i]);
+        }
+      }
+      position_ += unibrow::Utf8::Encode(chunk_.get() + position_, c,
+                                         unibrow::Utf16::kNoPreviousCharacter);
+    }
+  }
+
+  // Writes the last chunk and ends the stream. Returns false if the stream
+  // aborted.
+  bool Finish() {
+    if (position_ > 0) WriteChunk();
+    if (aborted_) return false;
+    stream_->EndOfStream();
+    return true;
+  }
+
+ private:
+  static constexpr int kMaxEncodedSize = unibrow::Utf8::kMaxEncodedSize;
+
+  void WriteChunk() {
+    if (aborted_) return;
+    if (stream_->WriteAsciiChunk(chunk_.get(), position_) ==
+        v8::OutputStream::kAbort) {
+      aborted_ = true;
+    }
+    position_ = 0;
+  }
+
+  v8::OutputStream* const stream_;
+  const int chunk_size_;
+  std::unique_ptr<char[]> chunk_;
+  int position_ = 0;
+  bool aborted_ = false;
+};
+
 class JsonStringifier {
  public:
-  explicit JsonStringifier(Isolate* isolate);
+  explicit JsonStringifier(Isolate* isolate,
+                           v8::OutputStream* output_stream = nullptr);
 
   ~JsonStringifier() {
     if (one_byte_ptr_ != one_byte_array_) delete[] one_byte_ptr_;
@@ -44,6 +107,12 @@ class JsonStringifier {
   V8_WARN_UNUSED_RESULT MaybeDirectHandle<Object> Stringify(
       Handle<JSAny> object, Handle<JSAny> replacer, Handle<Object> gap);
 
+  // Like Stringify, but writes the result to the output stream. Returns false
+  // if the result is undefined or the stream aborted.
+  V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToStream(Handle<JSAny> object,
+                                                      Handle<JSAny> replacer,
+                                                      Handle<Object> gap);
+
  private:
   enum Result { UNCHANGED, SUCCESS, EXCEPTION, NEED_STACK };
 
@@ -432,6 +501,8 @@ class JsonStringifier {
 
   V8_NOINLINE void Extend();
   V8_NOINLINE void ChangeEncoding();
+  // Write out the current part, so that it can be reused.
+  void FlushToStream();
 
   Isolate* isolate_;
   String::Encoding encoding_;
@@ -452,6 +523,7 @@ class JsonStringifier {
   std::vector<KeyObject> stack_;
 
   SimplePropertyKeyCache key_cache_;
+  std::optional<JsonOutputStreamWriter> stream_writer_;
   uint8_t one_byte_array_[kInitialPartLength];
 };
 
@@ -593,7 +665,8 @@ V8_INLINE bool CanFastSerializeJSObject(Tagged<JSObject> raw_object,
 
 }  // namespace
 
-JsonStringifier::JsonStringifier(Isolate* isolate)
+JsonStringifier::JsonStringifier(Isolate* isolate,
+                                 v8::OutputStream* output_stream)
     : isolate_(isolate),
       encoding_(String::ONE_BYTE_ENCODING),
       gap_(nullptr),
@@ -608,6 +681,7 @@ JsonStringifier::JsonStringifier(Isolate* isolate)
       key_cache_(isolate) {
   one_byte_ptr_ = one_byte_array_;
   part_ptr_ = one_byte_ptr_;
+  if (output_stream != nullptr) stream_writer_.emplace(output_stream);
 }
 
 MaybeDirectHandle<Object> JsonStringifier::Stringify(Handle<JSAny> object,
@@ -647,6 +721,38 @@ MaybeDirectHandle<Object> JsonStringifier::Stringify(Handle<JSAny> object,
   return MaybeDirectHandle<Object>();
 }
 
+Maybe<bool> JsonStringifier::StringifyToStream(Handle<JSAny> object,
+                                               Handle<JSAny> replacer,
+                                               Handle<Object> gap) {
+  DCHECK(stream_writer_.has_value());
+  if (!InitializeReplacer(replacer)) {
+    CHECK(isolate_->has_exception());
+    return Nothing<bool>();
+  }
+  if (!IsUndefined(*gap, isolate_) && !InitializeGap(gap)) {
+    CHECK(isolate_->has_exception());
+    return Nothing<bool>();
+  }
+  // Written output can't be taken back, so track the stack from the start
+  // instead of restarting with it.
+  need_stack_ = true;
+  Result result = SerializeObject(object);
+  DCHECK_NE(result, NEED_STACK);
+  if (result == UNCHANGED) return Just(false);
+  if (result == EXCEPTION) {
+    CHECK(isolate_->has_exception());
+    return Nothing<bool>();
+  }
+  DCHECK_EQ(result, SUCCESS);
+  if (overflowed_) {
+    isolate_->Throw(*factory()->NewInvalidStringLengthError());
+    return Nothing<bool>();
+  }
+  FlushToStream();
+  DCHECK_EQ(current_index_, 0);
+  return Just(stream_writer_->Finish());
+}
+
 bool JsonStringifier::InitializeReplacer(Handle<JSAny> replacer) {
   DCHECK(property_list_.is_null());
   DCHECK(replacer_function_.is_null());
@@ -1767,6 +1873,13 @@ bool JsonStringifier::SerializeString(Handle<String> object) {
 }
 
 void JsonStringifier::Extend() {
+  if (stream_writer_.has_value()) {
+    // Reuse the part if anything could be written out, and only grow it for
+    // strings that are longer than the part.
+    size_t length = current_index_;
+    FlushToStream();
+    if (current_index_ < length) return;
+  }
   if (part_length_ >= String::kMaxLength) {
     // Set the flag and carry on. Delay throwing the exception till the end.
     current_index_ = 0;
@@ -1791,6 +1904,22 @@ void JsonStringifier::Extend() {
   }
 }
 
+void JsonStringifier::FlushToStream() {
+  size_t length = current_index_;
+  if (encoding_ == String::ONE_BYTE_ENCODING) {
+    stream_writer_->Write(one_byte_ptr_, length);
+  } else {
+    // Keep a lead surrogate in the part until its trail surrogate follows.
+    if (length > 0 &&
+        unibrow::Utf16::IsLeadSurrogate(two_byte_ptr_[length - 1])) {
+      length--;
+    }
+    stream_writer_->Write(two_byte_ptr_, length);
+    if (length < current_index_) two_byte_ptr_[0] = two_byte_ptr_[length];
+  }
+  current_index_ -= length;
+}
+
 void JsonStringifier::ChangeEncoding() {
   encoding_ = String::TWO_BYTE_ENCODING;
   two_byte_ptr_ = new base::uc16[part_length_];
@@ -2210,6 +2339,15 @@ class FastJsonStringifier {
       uint16_t nof_descriptors, uint8_t in_object_properties,
       uint8_t in_object_properties_start, Tagged<DescriptorArray> descriptors,
       bool comma, const DisallowGarbageCollection& no_gc);
+  struct ObjectPlan;
+  ObjectPlan* GetObjectPlan(Tagged<Map> map,
+                            const DisallowGarbageCollection& no_gc);
+  void BuildObjectPlan(Tagged<Map> map, ObjectPlan* plan,
+                       const DisallowGarbageCollection& no_gc);
+  FastJsonStringifierResult SerializeJSObjectWithPlan(
+      Tagged<JSObject> obj, const ObjectPlan& plan,
+      uint16_t start_descriptor_idx, bool comma,
+      const DisallowGarbageCollection& no_gc);
   FastJsonStringifierResult SerializeJSArray(Tagged<JSArray> array);
   template <ElementsKind kind>
   FastJsonStringifierResult SerializeFixedArrayWithInterruptCheck(
@@ -2313,6 +2451,34 @@ class FastJsonStringifier {
 
   Tagged<HeapObject> initial_jsobject_proto_;
   Tagged<HeapObject> initial_jsarray_proto_;
+
+  // Serialization plan for objects of a map with kJsonFast descriptors. It
+  // holds the `"key":` fragment of each field and where to load the value
+  // from. Plans are built for maps that are seen again, e.g. for arrays of
+  // records, and a few of them are kept for records with nested objects.
+  struct ObjectPlanField {
+    uint32_t key_start;
+    uint32_t key_length;
+    // Offset into the object for in-object fields, or else index into the
+    // property array.
+    int location;
+    bool is_inobject;
+  };
+  struct ObjectPlan {
+    Tagged<Map> map;
+    Tagged<DescriptorArray> descriptors;
+    uint8_t in_object_properties;
+    uint8_t in_object_properties_start;
+    std::vector<ObjectPlanField> fields;
+    std::vector<uint8_t> keys;
+  };
+  static constexpr size_t kObjectPlanCount = 4;
+  static constexpr uint16_t kMaxObjectPlanFields = 64;
+  std::array<ObjectPlan, kObjectPlanCount> object_plans_;
+  std::array<Tagged<Map>, kObjectPlanCount> seen_object_maps_;
+  size_t next_object_plan_ = 0;
+  size_t next_seen_object_map_ = 0;
+
   template <typename>
   friend class FastJsonStringifier;
 };
@@ -2775,6 +2941,12 @@ FastJsonStringifierResult FastJsonStringifier<Char>::ResumeJSObject(
     uint16_t nof_descriptors, uint8_t in_object_properties,
     uint8_t in_object_properties_start, Tagged<DescriptorArray> descriptors,
     bool comma, const DisallowGarbageCollection& no_gc) {
+  if constexpr (fast_iterable_state == FastIterableState::kJsonFast) {
+    if (ObjectPlan* plan = GetObjectPlan(obj->map(), no_gc)) {
+      return SerializeJSObjectWithPlan(obj, *plan, start_descriptor_idx, comma,
+                                       no_gc);
+    }
+  }
   PtrComprCageBase cage_base = GetPtrComprCageBase();
   InternalIndex::Range range{start_descriptor_idx, nof_descriptors};
   for (InternalIndex i : range) {
@@ -2921,6 +3093,124 @@ FastJsonStringifierResult FastJsonStringifier<Char>::ResumeJSObject(
   return SUCCESS;
 }
 
+template <typename Char>
+typename FastJsonStringifier<Char>::ObjectPlan*
+FastJsonStringifier<Char>::GetObjectPlan(
+    Tagged<Map> map, const DisallowGarbageCollection& no_gc) {
+  for (ObjectPlan& plan : object_plans_) {
+    if (plan.map == map) return &plan;
+  }
+  if (std::find(seen_object_maps_.begin(), seen_object_maps_.end(), map) ==
+      seen_object_maps_.end()) {
+    seen_object_maps_[next_seen_object_map_++ % kObjectPlanCount] = map;
+    return nullptr;
+  }
+  if (map->NumberOfOwnDescriptors() > kMaxObjectPlanFields) return nullptr;
+  ObjectPlan* plan = &object_plans_[next_object_plan_++ % kObjectPlanCount];
+  BuildObjectPlan(map, plan, no_gc);
+  return plan;
+}
+
+template <typename Char>
+void FastJsonStringifier<Char>::BuildObjectPlan(
+    Tagged<Map> map, ObjectPlan* plan, const DisallowGarbageCollection& no_gc) {
+  Tagged<DescriptorArray> descriptors = map->instance_descriptors();
+  DCHECK_EQ(descriptors->fast_iterable(), FastIterableState::kJsonFast);
+  const int in_object_properties = map->GetInObjectProperties();
+  const int in_object_properties_start =
+      map->GetInObjectPropertiesStartInWords();
+  plan->map = map;
+  plan->descriptors = descriptors;
+  plan->in_object_properties = static_cast<uint8_t>(in_object_properties);
+  plan->in_object_properties_start =
+      static_cast<uint8_t>(in_object_properties_start);
+  plan->fields.clear();
+  plan->keys.clear();
+  for (InternalIndex i : map->IterateOwnDescriptors()) {
+    // Keys of kJsonFast descriptors are one-byte and need no escaping.
+    Tagged<String> key = Cast<String>(descriptors->GetKey(i));
+    DCHECK(IsFastKey(key, no_gc));
+    const uint32_t key_start = static_cast<uint32_t>(plan->keys.size());
+    const uint32_t length = key->length();
+    plan->keys.resize(key_start + length + 3);
+    plan->keys[key_start] = '"';
+    String::WriteToFlat(key, plan->keys.data() + key_start + 1, 0, length);
+    plan->keys[key_start + length + 1] = '"';
+    plan->keys[key_start + length + 2] = ':';
+    // The field index of kJsonFast descriptors is the descriptor index.
+    const int property_index = i.as_int();
+    DCHECK_EQ(property_index, descriptors->GetDetails(i).field_index());
+    ObjectPlanField field{key_start, length + 3, 0, false};
+    if (property_index < in_object_properties) {
+      field.location =
+          (in_object_properties_start + property_index) * kTaggedSize;
+      field.is_inobject = true;
+    } else {
+      field.location = property_index - in_object_properties;
+    }
+    plan->fields.push_back(field);
+  }
+}
+
+template <typename Char>
+FastJsonStringifierResult FastJsonStringifier<Char>::SerializeJSObjectWithPlan(
+    Tagged<JSObject> obj, const ObjectPlan& plan,
+    uint16_t start_descriptor_idx, bool comma,
+    const DisallowGarbageCollection& no_gc) {
+  DCHECK_EQ(obj->map(), plan.map);
+  PtrComprCageBase cage_base = GetPtrComprCageBase();
+  const uint16_t nof_descriptors = static_cast<uint16_t>(plan.fields.size());
+  for (uint16_t i = start_descriptor_idx; i < nof_descriptors; i++) {
+    const ObjectPlanField& field = plan.fields[i];
+    Tagged<JSAny> property;
+    if (field.is_inobject) {
+      property = TaggedField<JSAny>::Relaxed_Load(cage_base, obj,
+                                                  field.location);
+    } else {
+      property =
+          obj->property_array(cage_base)->get(cage_base, field.location);
+    }
+    if (V8_UNLIKELY(IsUndefined(property) || IsSymbol(property))) continue;
+
+    EnsureCapacity(field.key_length + 1);
+    SeparatorUnchecked(comma);
+    buffer_.Append(plan.keys.data() + field.key_start, field.key_length);
+
+    // TrySerializeSimpleObject won't trigger GCs. See DisableGCMole scopes in
+    // SerializeJSPrimitiveWrapper for explanation.
+    DisableGCMole no_gc_mole;
+    FastJsonStringifierResult result = TrySerializeSimpleObject(property);
+    switch (result) {
+      case SUCCESS:
+        comma = true;
+        break;
+      case UNDEFINED:
+        break;
+      case JS_OBJECT:
+      case JS_ARRAY:
+      case CHANGE_ENCODING:
+        DCHECK_IMPLIES(result == CHANGE_ENCODING, is_one_byte);
+        // The nested value resumes this object, through the plan again if it
+        // still matches.
+        stack_.push_back(
+            ContinuationRecord::ForJSObjectResume<FastIterableState::kJsonFast>(
+                obj, i + 1, nof_descriptors, plan.in_object_properties,
+                plan.in_object_properties_start, plan.descriptors));
+        if (result == CHANGE_ENCODING) {
+          stack_.push_back(ContinuationRecord::ForSimpleObject(property));
+        } else {
+          stack_.push_back(ContinuationRecord::ForJSAny(property, result));
+        }
+        return result;
+      case SLOW_PATH:
+      case EXCEPTION:
+        return result;
+    }
+  }
+  AppendCharacter('}');
+  return SUCCESS;
+}
+
 template <typename Char>
 FastJsonStringifierResult FastJsonStringifier<Char>::SerializeJSArray(
     Tagged<JSArray> array) {
@@ -3570,6 +3860,15 @@ MaybeDirectHandle<Object> FastJsonStringify(Isolate* isolate,
 
 }  // namespace
 
+Maybe<bool> JsonStringifyToStream(Isolate* isolate, Handle<JSAny> object,
+                                  Handle<JSAny> replacer, Handle<Object> gap,
+                                  v8::OutputStream* stream) {
+  // The fast path builds the whole result in one buffer, so always use the
+  // JsonStringifier, which can write out its parts as they fill up.
+  JsonStringifier stringifier(isolate, stream);
+  return stringifier.StringifyToStream(object, replacer, gap);
+}
+
 MaybeDirectHandle<Object> JsonStringify(Isolate* isolate, Handle<JSAny> object,
                                         Handle<JSAny> replacer,
                                         Handle<Object> gap) {
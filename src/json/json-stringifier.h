@@ -8,11 +8,21 @@
 #include "src/objects/objects.h"
 
 namespace v8 {
+
+class OutputStream;
+
 namespace internal {
 
 V8_WARN_UNUSED_RESULT MaybeDirectHandle<Object> JsonStringify(
     Isolate* isolate, Handle<JSAny> object, Handle<JSAny> replacer,
     Handle<Object> gap);
+
+// Writes the result of JSON.stringify to {stream} as UTF-8 while it is
+// serialized, instead of creating a string. Returns false if the result is
+// undefined or the stream aborted.
+V8_WARN_UNUSED_RESULT Maybe<bool> JsonStringifyToStream(
+    Isolate* isolate, Handle<JSAny> object, Handle<JSAny> replacer,
+    Handle<Object> gap, v8::OutputStream* stream);
 }  // namespace internal
 }  // namespace v8
 
@@ -4,6 +4,8 @@
 
 #include "src/libplatform/default-job.h"
 
+#include <algorithm>
+
 #include "src/base/bits.h"
 #include "src/base/macros.h"
 
@@ -14,8 +16,136 @@ namespace {
 // Capped to allow assigning task_ids from a bitfield.
 constexpr size_t kMaxWorkersPerJob = 32;
 
+thread_local DefaultJobTenant* current_tenant = nullptr;
+
+void NotifyThrottledJobs(
+    const std::vector<std::weak_ptr<DefaultJobState>>& jobs) {
+  for (const std::weak_ptr<DefaultJobState>& job : jobs) {
+    if (auto shared_job = job.lock()) shared_job->NotifyConcurrencyIncrease();
+  }
+}
+
 }  // namespace
 
+DefaultJobTenant::DefaultJobTenant(std::shared_ptr<DefaultJobTenantGroup> group,
+                                   uint32_t weight, size_t max_workers)
+    : group_(std::move(group)),
+      weight_(std::max(weight, uint32_t{1})),
+      max_workers_(max_workers) {
+  group_->AddTenant(this);
+}
+
+DefaultJobTenant::~DefaultJobTenant() {
+  DCHECK_EQ(0U, active_workers_.load(std::memory_order_relaxed));
+  group_->RemoveTenant(this);
+}
+
+// static
+DefaultJobTenant* DefaultJobTenant::current() { return current_tenant; }
+
+DefaultJobTenant::CurrentScope::CurrentScope(DefaultJobTenant* tenant)
+    : previous_(current_tenant) {
+  current_tenant = tenant;
+}
+
+DefaultJobTenant::CurrentScope::~CurrentScope() { current_tenant = previous_; }
+
+bool DefaultJobTenant::TryAcquireWorker(std::weak_ptr<DefaultJobState> job) {
+  {
+    base::MutexGuard guard(&mutex_);
+    const size_t active_workers =
+        active_workers_.load(std::memory_order_relaxed);
+    if (active_workers >= limit_.load(std::memory_order_relaxed)) {
+      throttled_jobs_.push_back(std::move(job));
+      return false;
+    }
+    active_workers_.store(active_workers + 1, std::memory_order_relaxed);
+    if (active_workers > 0) return true;
+  }
+  // Becoming busy shrinks the share of the other tenants.
+  group_->UpdateLimits();
+  return true;
+}
+
+void DefaultJobTenant::ReleaseWorker(
+    std::weak_ptr<DefaultJobState> throttled_job) {
+  std::vector<std::weak_ptr<DefaultJobState>> jobs_to_notify;
+  bool became_idle;
+  {
+    base::MutexGuard guard(&mutex_);
+    if (!throttled_job.expired()) {
+      throttled_jobs_.push_back(std::move(throttled_job));
+    }
+    const size_t active_workers =
+        active_workers_.load(std::memory_order_relaxed) - 1;
+    active_workers_.store(active_workers, std::memory_order_relaxed);
+    became_idle = active_workers == 0;
+    if (active_workers < limit_.load(std::memory_order_relaxed) &&
+        !throttled_jobs_.empty()) {
+      jobs_to_notify.push_back(std::move(throttled_jobs_.front()));
+      throttled_jobs_.erase(throttled_jobs_.begin());
+    }
+  }
+  NotifyThrottledJobs(jobs_to_notify);
+  // Becoming idle grows the share of the other tenants.
+  if (became_idle) group_->UpdateLimits();
+}
+
+void DefaultJobTenantGroup::AddTenant(DefaultJobTenant* tenant) {
+  {
+    base::MutexGuard guard(&mutex_);
+    tenants_.push_back(tenant);
+  }
+  UpdateLimits();
+}
+
+void DefaultJobTenantGroup::RemoveTenant(DefaultJobTenant* tenant) {
+  {
+    base::MutexGuard guard(&mutex_);
+    tenants_.erase(std::find(tenants_.begin(), tenants_.end(), tenant));
+  }
+  UpdateLimits();
+}
+
+void DefaultJobTenantGroup::UpdateLimits() {
+  std::vector<std::weak_ptr<DefaultJobState>> jobs_to_notify;
+  {
+    base::MutexGuard guard(&mutex_);
+    auto is_busy = [](const DefaultJobTenant* tenant) {
+      return tenant->active_workers_.load(std::memory_order_relaxed) > 0;
+    };
+    uint64_t busy_weight = 0;
+    for (const DefaultJobTenant* tenant : tenants_) {
+      if (is_busy(tenant)) busy_weight += tenant->weight_;
+    }
+    for (DefaultJobTenant* tenant : tenants_) {
+      const uint64_t total_weight =
+          busy_weight + (is_busy(tenant) ? 0 : tenant->weight_);
+      // Round up, so that every tenant gets at least one worker and all
+      // workers are handed out.
+      size_t limit = static_cast<size_t>(
+          (num_worker_threads_ * tenant->weight_ + total_weight - 1) /
+          total_weight);
+      limit = std::max(limit, size_t{1});
+      if (tenant->max_workers_ > 0) {
+        limit = std::min(limit, tenant->max_workers_);
+      }
+      const size_t previous_limit =
+          tenant->limit_.exchange(limit, std::memory_order_relaxed);
+      if (limit <= previous_limit) continue;
+      base::MutexGuard tenant_guard(&tenant->mutex_);
+      auto& throttled_jobs = tenant->throttled_jobs_;
+      const size_t count =
+          std::min(limit - previous_limit, throttled_jobs.size());
+      std::move(throttled_jobs.begin(), throttled_jobs.begin() + count,
+                std::back_inserter(jobs_to_notify));
+      throttled_jobs.erase(throttled_jobs.begin(),
+                           throttled_jobs.begin() + count);
+    }
+  }
+  NotifyThrottledJobs(jobs_to_notify);
+}
+
 DefaultJobState::JobDelegate::~JobDelegate() {
   static_assert(kInvalidTaskId >= kMaxWorkersPerJob,
                 "kInvalidTaskId must be outside of the range of valid task_ids "
@@ -31,9 +161,11 @@ uint8_t DefaultJobState::JobDelegate::GetTaskId() {
 DefaultJobState::DefaultJobState(Platform* platform,
                                  std::unique_ptr<JobTask> job_task,
                                  TaskPriority priority,
-                                 size_t num_worker_threads)
+                                 size_t num_worker_threads,
+                                 std::shared_ptr<DefaultJobTenant> tenant)
     : platform_(platform),
       job_task_(std::move(job_task)),
+      tenant_(std::move(tenant)),
       priority_(priority),
       num_worker_threads_(std::min(num_worker_threads, kMaxWorkersPerJob)) {}
 
@@ -166,34 +298,58 @@ bool DefaultJobState::IsActive() {
 }
 
 bool DefaultJobState::CanRunFirstTask() {
-  base::MutexGuard guard(&mutex_);
-  --pending_tasks_;
-  if (is_canceled_.load(std::memory_order_relaxed)) return false;
-  if (active_workers_ >= CappedMaxConcurrency(active_workers_)) return false;
-  // Acquire current worker.
-  ++active_workers_;
-  return true;
+  // The tenant is consulted outside of |mutex_|, as it may notify other jobs,
+  // including this one. If it's at its limit, it notifies this job again later.
+  const bool acquired_tenant_worker =
+      !tenant_ || tenant_->TryAcquireWorker(weak_from_this());
+  {
+    base::MutexGuard guard(&mutex_);
+    --pending_tasks_;
+    if (acquired_tenant_worker &&
+        !is_canceled_.load(std::memory_order_relaxed) &&
+        active_workers_ < CappedMaxConcurrency(active_workers_)) {
+      // Acquire current worker.
+      ++active_workers_;
+      return true;
+    }
+  }
+  if (tenant_ && acquired_tenant_worker) tenant_->ReleaseWorker();
+  return false;
 }
 
 bool DefaultJobState::DidRunTask() {
   size_t num_tasks_to_post = 0;
   TaskPriority priority;
+  bool release_worker = false;
+  bool tenant_over_limit = false;
   {
     base::MutexGuard guard(&mutex_);
     const size_t max_concurrency = CappedMaxConcurrency(active_workers_ - 1);
+    tenant_over_limit = tenant_ && tenant_->IsOverLimit();
     if (is_canceled_.load(std::memory_order_relaxed) ||
-        active_workers_ > max_concurrency) {
+        active_workers_ > max_concurrency || tenant_over_limit) {
       // Release current worker and notify.
       --active_workers_;
       worker_released_condition_.NotifyOne();
-      return false;
+      release_worker = true;
+    } else {
+      // Consider |pending_tasks_| to avoid posting too many tasks.
+      if (max_concurrency > active_workers_ + pending_tasks_) {
+        num_tasks_to_post = max_concurrency - active_workers_ - pending_tasks_;
+        pending_tasks_ += num_tasks_to_post;
+      }
+      priority = priority_;
     }
-    // Consider |pending_tasks_| to avoid posting too many tasks.
-    if (max_concurrency > active_workers_ + pending_tasks_) {
-      num_tasks_to_post = max_concurrency - active_workers_ - pending_tasks_;
-      pending_tasks_ += num_tasks_to_post;
+  }
+  if (release_worker) {
+    if (tenant_) {
+      // A tenant over its limit yields the worker to other tenants. This job is
+      // notified again once the tenant may run another worker.
+      tenant_->ReleaseWorker(tenant_over_limit
+                                 ? weak_from_this()
+                                 : std::weak_ptr<DefaultJobState>());
     }
-    priority = priority_;
+    return false;
   }
   // Post additional worker tasks to reach |max_concurrency| in the case that
   // max concurrency increased. This is not strictly necessary, since
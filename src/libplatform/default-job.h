@@ -7,6 +7,7 @@
 
 #include <atomic>
 #include <memory>
+#include <vector>
 
 #include "include/libplatform/libplatform-export.h"
 #include "include/v8-platform.h"
@@ -16,6 +17,91 @@
 namespace v8 {
 namespace platform {
 
+class DefaultJobState;
+class DefaultJobTenantGroup;
+
+// The jobs of one tenant, usually an isolate. Tenants of a group share the
+// worker threads in proportion to their weight, and a tenant never runs more
+// than |max_workers| job workers at a time (0 means no cap). The joining
+// thread of a job does not count against its tenant.
+class V8_PLATFORM_EXPORT DefaultJobTenant
+    : public std::enable_shared_from_this<DefaultJobTenant> {
+ public:
+  DefaultJobTenant(std::shared_ptr<DefaultJobTenantGroup> group,
+                   uint32_t weight, size_t max_workers);
+  ~DefaultJobTenant();
+
+  DefaultJobTenant(const DefaultJobTenant&) = delete;
+  DefaultJobTenant& operator=(const DefaultJobTenant&) = delete;
+
+  // Returns the tenant of the job that runs on the current thread, if any, so
+  // that jobs posted from jobs inherit it.
+  static DefaultJobTenant* current();
+
+  class V8_NODISCARD CurrentScope final {
+   public:
+    explicit CurrentScope(DefaultJobTenant* tenant);
+    ~CurrentScope();
+
+   private:
+    DefaultJobTenant* const previous_;
+  };
+
+  // Accounts for a worker that starts running a job of this tenant. Returns
+  // false if the tenant is at its limit, in which case |job| is notified once
+  // the tenant can run another worker.
+  bool TryAcquireWorker(std::weak_ptr<DefaultJobState> job);
+  // Gives back a worker. A non-empty |throttled_job| still has work and is
+  // notified like in TryAcquireWorker().
+  void ReleaseWorker(std::weak_ptr<DefaultJobState> throttled_job = {});
+
+  // Whether the tenant runs more workers than its share, e.g. because another
+  // tenant became busy in the meantime.
+  bool IsOverLimit() const {
+    return active_workers_.load(std::memory_order_relaxed) >
+           limit_.load(std::memory_order_relaxed);
+  }
+
+  size_t limit() const { return limit_.load(std::memory_order_relaxed); }
+
+ private:
+  friend class DefaultJobTenantGroup;
+
+  const std::shared_ptr<DefaultJobTenantGroup> group_;
+  const uint32_t weight_;
+  const size_t max_workers_;
+  // Written under |mutex_|, read without it by IsOverLimit().
+  std::atomic<size_t> active_workers_{0};
+  // Recomputed by |group_| whenever any of its tenants becomes busy or idle.
+  std::atomic<size_t> limit_{1};
+  base::Mutex mutex_;
+  // Jobs that could not get a worker because of |limit_|.
+  std::vector<std::weak_ptr<DefaultJobState>> throttled_jobs_;
+};
+
+// The tenants sharing one pool of |num_worker_threads|.
+class V8_PLATFORM_EXPORT DefaultJobTenantGroup {
+ public:
+  explicit DefaultJobTenantGroup(size_t num_worker_threads)
+      : num_worker_threads_(num_worker_threads) {}
+
+  DefaultJobTenantGroup(const DefaultJobTenantGroup&) = delete;
+  DefaultJobTenantGroup& operator=(const DefaultJobTenantGroup&) = delete;
+
+ private:
+  friend class DefaultJobTenant;
+
+  void AddTenant(DefaultJobTenant* tenant);
+  void RemoveTenant(DefaultJobTenant* tenant);
+  // Splits the worker threads between the busy tenants by weight. An idle
+  // tenant gets the share it would have if it became busy.
+  void UpdateLimits();
+
+  const size_t num_worker_threads_;
+  base::Mutex mutex_;
+  std::vector<DefaultJobTenant*> tenants_;
+};
+
 class V8_PLATFORM_EXPORT DefaultJobState
     : public std::enable_shared_from_this<DefaultJobState> {
  public:
@@ -35,7 +121,9 @@ class V8_PLATFORM_EXPORT DefaultJobState
       DCHECK(!was_told_to_yield_);
       // Thread-safe but may return an outdated result.
       was_told_to_yield_ |=
-          outer_->is_canceled_.load(std::memory_order_relaxed);
+          outer_->is_canceled_.load(std::memory_order_relaxed) ||
+          (!is_joining_thread_ && outer_->tenant_ &&
+           outer_->tenant_->IsOverLimit());
       return was_told_to_yield_;
     }
     uint8_t GetTaskId() override;
@@ -52,7 +140,8 @@ class V8_PLATFORM_EXPORT DefaultJobState
   };
 
   DefaultJobState(Platform* platform, std::unique_ptr<JobTask> job_task,
-                  TaskPriority priority, size_t num_worker_threads);
+                  TaskPriority priority, size_t num_worker_threads,
+                  std::shared_ptr<DefaultJobTenant> tenant = {});
   virtual ~DefaultJobState();
 
   void NotifyConcurrencyIncrease();
@@ -74,6 +163,8 @@ class V8_PLATFORM_EXPORT DefaultJobState
 
   void UpdatePriority(TaskPriority);
 
+  DefaultJobTenant* tenant() const { return tenant_.get(); }
+
  private:
   // Returns GetMaxConcurrency() capped by the number of threads used by this
   // job.
@@ -83,6 +174,7 @@ class V8_PLATFORM_EXPORT DefaultJobState
 
   Platform* const platform_;
   std::unique_ptr<JobTask> job_task_;
+  const std::shared_ptr<DefaultJobTenant> tenant_;
 
   // All members below are protected by |mutex_|.
   base::Mutex mutex_;
@@ -140,6 +232,7 @@ class DefaultJobWorker : public Task {
     auto shared_state = state_.lock();
     if (!shared_state) return;
     if (!shared_state->CanRunFirstTask()) return;
+    DefaultJobTenant::CurrentScope tenant_scope(shared_state->tenant());
     do {
       // Scope of |delegate| must not outlive DidRunTask() so that associated
       // state is freed before the worker becomes inactive.
@@ -46,14 +46,14 @@ std::unique_ptr<v8::Platform> NewDefaultPlatform(
     int thread_pool_size, IdleTaskSupport idle_task_support,
     InProcessStackDumping in_process_stack_dumping,
     std::unique_ptr<v8::TracingController> tracing_controller,
-    PriorityMode priority_mode) {
+    PriorityMode priority_mode, WorkerScheduling worker_scheduling) {
   if (in_process_stack_dumping == InProcessStackDumping::kEnabled) {
     v8::base::debug::EnableInProcessStackDumping();
   }
   thread_pool_size = GetActualThreadPoolSize(thread_pool_size);
   auto platform = std::make_unique<DefaultPlatform>(
       thread_pool_size, idle_task_support, std::move(tracing_controller),
-      priority_mode);
+      priority_mode, worker_scheduling);
   return platform;
 }
 
@@ -92,15 +92,26 @@ void NotifyIsolateShutdown(v8::Platform* platform, Isolate* isolate) {
   static_cast<DefaultPlatform*>(platform)->NotifyIsolateShutdown(isolate);
 }
 
+void SetIsolateJobScheduling(v8::Platform* platform, v8::Isolate* isolate,
+                             uint32_t weight, size_t max_worker_threads) {
+  static_cast<DefaultPlatform*>(platform)->SetIsolateJobScheduling(
+      isolate, weight, max_worker_threads);
+}
+
+void SetCurrentThreadJobIsolate(v8::Platform* platform, v8::Isolate* isolate) {
+  static_cast<DefaultPlatform*>(platform)->SetCurrentThreadJobIsolate(isolate);
+}
+
 DefaultPlatform::DefaultPlatform(
     int thread_pool_size, IdleTaskSupport idle_task_support,
     std::unique_ptr<v8::TracingController> tracing_controller,
-    PriorityMode priority_mode)
+    PriorityMode priority_mode, WorkerScheduling worker_scheduling)
     : thread_pool_size_(thread_pool_size),
       idle_task_support_(idle_task_support),
       tracing_controller_(std::move(tracing_controller)),
       page_allocator_(std::make_unique<v8::base::PageAllocator>()),
-      priority_mode_(priority_mode) {
+      priority_mode_(priority_mode),
+      worker_scheduling_(worker_scheduling) {
   if (!tracing_controller_) {
     tracing::TracingController* controller = new tracing::TracingController();
 #if !defined(V8_USE_PERFETTO)
@@ -142,7 +153,7 @@ void DefaultPlatform::EnsureBackgroundTaskRunnerInitialized() {
             thread_pool_size_,
             time_function_for_testing_ ? time_function_for_testing_
                                        : DefaultTimeFunction,
-            priority_from_index(i));
+            priority_from_index(i), worker_scheduling_);
   }
   DCHECK_NOT_NULL(worker_threads_task_runners_[0]);
 }
@@ -249,8 +260,9 @@ std::unique_ptr<JobHandle> DefaultPlatform::CreateJobImpl(
   if (priority == TaskPriority::kBestEffort && num_worker_threads > 2) {
     num_worker_threads = 2;
   }
-  return NewDefaultJobHandle(this, priority, std::move(job_task),
-                             num_worker_threads);
+  return std::make_unique<DefaultJobHandle>(std::make_shared<DefaultJobState>(
+      this, std::move(job_task), priority, num_worker_threads,
+      CurrentJobTenant()));
 }
 
 double DefaultPlatform::MonotonicallyIncreasingTime() {
@@ -298,9 +310,44 @@ void DefaultPlatform::NotifyIsolateShutdown(Isolate* isolate) {
       taskrunner = it->second;
       foreground_task_runner_map_.erase(it);
     }
+    // Jobs that are still around keep their tenant alive.
+    job_tenant_map_.erase(isolate);
   }
   taskrunner->Terminate();
 }
 
+namespace {
+
+thread_local v8::Isolate* current_job_isolate = nullptr;
+
+}  // namespace
+
+void DefaultPlatform::SetIsolateJobScheduling(Isolate* isolate,
+                                              uint32_t weight,
+                                              size_t max_worker_threads) {
+  base::MutexGuard guard(&lock_);
+  if (!job_tenant_group_) {
+    job_tenant_group_ = std::make_shared<DefaultJobTenantGroup>(
+        std::max(thread_pool_size_, 1));
+  }
+  // Jobs created before keep the previous settings.
+  job_tenant_map_[isolate] = std::make_shared<DefaultJobTenant>(
+      job_tenant_group_, weight, max_worker_threads);
+}
+
+void DefaultPlatform::SetCurrentThreadJobIsolate(Isolate* isolate) {
+  current_job_isolate = isolate;
+}
+
+std::shared_ptr<DefaultJobTenant> DefaultPlatform::CurrentJobTenant() {
+  if (DefaultJobTenant* tenant = DefaultJobTenant::current()) {
+    return tenant->shared_from_this();
+  }
+  if (current_job_isolate == nullptr) return nullptr;
+  base::MutexGuard guard(&lock_);
+  auto it = job_tenant_map_.find(current_job_isolate);
+  return it != job_tenant_map_.end() ? it->second : nullptr;
+}
+
 }  // namespace platform
 }  // namespace v8
@@ -22,6 +22,8 @@ namespace platform {
 class Thread;
 class WorkerThread;
 class DefaultForegroundTaskRunner;
+class DefaultJobTenant;
+class DefaultJobTenantGroup;
 class DefaultWorkerThreadsTaskRunner;
 class DefaultPageAllocator;
 
@@ -31,7 +33,8 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
       int thread_pool_size = 0,
       IdleTaskSupport idle_task_support = IdleTaskSupport::kDisabled,
       std::unique_ptr<v8::TracingController> tracing_controller = {},
-      PriorityMode priority_mode = PriorityMode::kDontApply);
+      PriorityMode priority_mode = PriorityMode::kDontApply,
+      WorkerScheduling worker_scheduling = WorkerScheduling::kSharedQueue);
 
   ~DefaultPlatform() override;
 
@@ -76,7 +79,14 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
 
   void NotifyIsolateShutdown(Isolate* isolate);
 
+  void SetIsolateJobScheduling(Isolate* isolate, uint32_t weight,
+                               size_t max_worker_threads);
+  void SetCurrentThreadJobIsolate(Isolate* isolate);
+
  private:
+  // Returns the tenant that jobs created on the current thread belong to.
+  std::shared_ptr<DefaultJobTenant> CurrentJobTenant();
+
   base::Thread::Priority priority_from_index(int i) const {
     if (priority_mode_ == PriorityMode::kDontApply) {
       return base::Thread::Priority::kDefault;
@@ -109,12 +119,15 @@ class V8_PLATFORM_EXPORT DefaultPlatform : public NON_EXPORTED_BASE(Platform) {
       [static_cast<int>(TaskPriority::kMaxPriority) + 1] = {0};
   std::map<v8::Isolate*, std::shared_ptr<DefaultForegroundTaskRunner>>
       foreground_task_runner_map_;
+  std::shared_ptr<DefaultJobTenantGroup> job_tenant_group_;
+  std::map<v8::Isolate*, std::shared_ptr<DefaultJobTenant>> job_tenant_map_;
 
   std::unique_ptr<TracingController> tracing_controller_;
   std::unique_ptr<PageAllocator> page_allocator_;
   DefaultThreadIsolatedAllocator thread_isolated_allocator_;
 
   const PriorityMode priority_mode_;
+  const WorkerScheduling worker_scheduling_;
   TimeFunction time_function_for_testing_ = nullptr;
 };
 
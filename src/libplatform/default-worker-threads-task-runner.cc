@@ -4,18 +4,37 @@
 
 #include "src/libplatform/default-worker-threads-task-runner.h"
 
+#include <algorithm>
+
 #include "src/base/platform/time.h"
 #include "src/libplatform/delayed-task-queue.h"
 
 namespace v8 {
 namespace platform {
 
+namespace {
+
+// The runner and local queue index of the worker running on this thread, if
+// any. Tasks posted from a worker go to its own queue.
+thread_local const DefaultWorkerThreadsTaskRunner* current_runner = nullptr;
+thread_local int current_worker_index = -1;
+
+}  // namespace
+
 DefaultWorkerThreadsTaskRunner::DefaultWorkerThreadsTaskRunner(
     uint32_t thread_pool_size, TimeFunction time_function,
-    base::Thread::Priority priority)
+    base::Thread::Priority priority, WorkerScheduling worker_scheduling)
     : queue_(time_function), time_function_(time_function) {
+  const bool work_stealing =
+      worker_scheduling == WorkerScheduling::kWorkStealing;
+  if (work_stealing) {
+    for (uint32_t i = 0; i < thread_pool_size; ++i) {
+      local_queues_.push_back(std::make_unique<LocalQueue>());
+    }
+  }
   for (uint32_t i = 0; i < thread_pool_size; ++i) {
-    thread_pool_.push_back(std::make_unique<WorkerThread>(this, priority));
+    thread_pool_.push_back(std::make_unique<WorkerThread>(
+        this, priority, work_stealing ? static_cast<int>(i) : -1));
   }
 }
 
@@ -31,6 +50,7 @@ void DefaultWorkerThreadsTaskRunner::Terminate() {
     terminated_ = true;
     queue_.Terminate();
     idle_threads_.clear();
+    num_idle_threads_ = 0;
   }
   // Clearing the thread pool lets all worker threads join.
   thread_pool_.clear();
@@ -38,14 +58,31 @@ void DefaultWorkerThreadsTaskRunner::Terminate() {
 
 void DefaultWorkerThreadsTaskRunner::PostTaskImpl(
     std::unique_ptr<Task> task, const SourceLocation& location) {
+  if (work_stealing()) {
+    if (terminated_) return;
+    size_t index =
+        current_runner == this
+            ? current_worker_index
+            : next_local_queue_.fetch_add(1, std::memory_order_relaxed) %
+                  local_queues_.size();
+    {
+      LocalQueue& queue = *local_queues_[index];
+      base::MutexGuard guard(&queue.lock);
+      queue.tasks.push_back(std::move(task));
+    }
+    // A worker that is about to go idle increments |num_idle_threads_| before
+    // rescanning the local queues, so either it sees the task pushed above or
+    // this sees it as idle.
+    if (num_idle_threads_ == 0) return;
+    base::MutexGuard guard(&lock_);
+    NotifyIdleThread();
+    return;
+  }
+
   base::MutexGuard guard(&lock_);
   if (terminated_) return;
   queue_.Append(std::move(task));
-
-  if (!idle_threads_.empty()) {
-    idle_threads_.back()->Notify();
-    idle_threads_.pop_back();
-  }
+  NotifyIdleThread();
 }
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTaskImpl(
@@ -54,11 +91,7 @@ void DefaultWorkerThreadsTaskRunner::PostDelayedTaskImpl(
   base::MutexGuard guard(&lock_);
   if (terminated_) return;
   queue_.AppendDelayed(std::move(task), delay_in_seconds);
-
-  if (!idle_threads_.empty()) {
-    idle_threads_.back()->Notify();
-    idle_threads_.pop_back();
-  }
+  NotifyIdleThread();
 }
 
 void DefaultWorkerThreadsTaskRunner::PostIdleTaskImpl(
@@ -72,11 +105,64 @@ bool DefaultWorkerThreadsTaskRunner::IdleTasksEnabled() {
   return false;
 }
 
+void DefaultWorkerThreadsTaskRunner::AddIdleThread(WorkerThread* thread) {
+  lock_.AssertHeld();
+  // A thread that timed out or woke up spuriously is still in the list.
+  if (std::find(idle_threads_.begin(), idle_threads_.end(), thread) ==
+      idle_threads_.end()) {
+    idle_threads_.push_back(thread);
+  }
+  num_idle_threads_ = idle_threads_.size();
+}
+
+void DefaultWorkerThreadsTaskRunner::NotifyIdleThread() {
+  lock_.AssertHeld();
+  if (idle_threads_.empty()) return;
+  idle_threads_.back()->Notify();
+  idle_threads_.pop_back();
+  num_idle_threads_ = idle_threads_.size();
+}
+
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::TryPopOrSteal(
+    int index) {
+  if (terminated_) return {};
+  LocalQueue& own = *local_queues_[index];
+  {
+    base::MutexGuard guard(&own.lock);
+    if (!own.tasks.empty()) {
+      std::unique_ptr<Task> task = std::move(own.tasks.front());
+      own.tasks.pop_front();
+      return task;
+    }
+  }
+  const int num_queues = static_cast<int>(local_queues_.size());
+  const int numa_node = own.numa_node.load(std::memory_order_relaxed);
+  // The first pass only steals from workers on the same NUMA node, the second
+  // one from all others.
+  for (bool same_node : {true, false}) {
+    for (int i = 1; i < num_queues; ++i) {
+      LocalQueue& victim = *local_queues_[(index + i) % num_queues];
+      if ((victim.numa_node.load(std::memory_order_relaxed) == numa_node) !=
+          same_node) {
+        continue;
+      }
+      base::MutexGuard guard(&victim.lock);
+      if (victim.tasks.empty()) continue;
+      std::unique_ptr<Task> task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      return task;
+    }
+  }
+  return {};
+}
+
 DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
-    DefaultWorkerThreadsTaskRunner* runner, base::Thread::Priority priority)
+    DefaultWorkerThreadsTaskRunner* runner, base::Thread::Priority priority,
+    int index)
     : Thread(
           Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread", priority)),
-      runner_(runner) {
+      runner_(runner),
+      index_(index) {
   CHECK(Start());
 }
 
@@ -86,6 +172,10 @@ DefaultWorkerThreadsTaskRunner::WorkerThread::~WorkerThread() {
 }
 
 void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
+  if (runner_->work_stealing()) {
+    RunWorkStealing();
+    return;
+  }
   base::MutexGuard guard(&runner_->lock_);
   while (true) {
     DelayedTaskQueue::MaybeNextTask next_task = runner_->queue_.TryGetNext();
@@ -98,14 +188,14 @@ void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
       case DelayedTaskQueue::MaybeNextTask::kTerminated:
         return;
       case DelayedTaskQueue::MaybeNextTask::kWaitIndefinite:
-        runner_->idle_threads_.push_back(this);
+        runner_->AddIdleThread(this);
         condition_var_.Wait(&runner_->lock_);
         continue;
       case DelayedTaskQueue::MaybeNextTask::kWaitDelayed:
         // WaitFor unfortunately doesn't care about our fake time and will wait
         // the 'real' amount of time, based on whatever clock the system call
         // uses.
-        runner_->idle_threads_.push_back(this);
+        runner_->AddIdleThread(this);
         bool notified =
             condition_var_.WaitFor(&runner_->lock_, next_task.wait_time);
         USE(notified);
@@ -114,6 +204,59 @@ void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
   }
 }
 
+void DefaultWorkerThreadsTaskRunner::WorkerThread::RunWorkStealing() {
+  current_runner = runner_;
+  current_worker_index = index_;
+  LocalQueue& own = *runner_->local_queues_[index_];
+  own.numa_node.store(base::OS::GetCurrentNumaNode(),
+                      std::memory_order_relaxed);
+  while (true) {
+    std::unique_ptr<Task> task = runner_->TryPopOrSteal(index_);
+    bool waited = false;
+    if (!task) {
+      // Delayed tasks and termination are still handled by the shared queue.
+      base::MutexGuard guard(&runner_->lock_);
+      DelayedTaskQueue::MaybeNextTask next_task = runner_->queue_.TryGetNext();
+      switch (next_task.state) {
+        case DelayedTaskQueue::MaybeNextTask::kTask:
+          task = std::move(next_task.task);
+          break;
+        case DelayedTaskQueue::MaybeNextTask::kTerminated:
+          return;
+        case DelayedTaskQueue::MaybeNextTask::kWaitIndefinite:
+        case DelayedTaskQueue::MaybeNextTask::kWaitDelayed:
+          runner_->AddIdleThread(this);
+          // Tasks posted since the scan above did not see this thread as idle
+          // and did not wake anyone up.
+          task = runner_->TryPopOrSteal(index_);
+          if (task) {
+            auto& idle_threads = runner_->idle_threads_;
+            idle_threads.erase(
+                std::find(idle_threads.begin(), idle_threads.end(), this));
+            runner_->num_idle_threads_ = idle_threads.size();
+            break;
+          }
+          if (next_task.state ==
+              DelayedTaskQueue::MaybeNextTask::kWaitIndefinite) {
+            condition_var_.Wait(&runner_->lock_);
+          } else {
+            bool notified =
+                condition_var_.WaitFor(&runner_->lock_, next_task.wait_time);
+            USE(notified);
+          }
+          waited = true;
+          break;
+      }
+    }
+    if (task) task->Run();
+    if (waited) {
+      // The OS may have moved this thread while it was blocked.
+      own.numa_node.store(base::OS::GetCurrentNumaNode(),
+                          std::memory_order_relaxed);
+    }
+  }
+}
+
 void DefaultWorkerThreadsTaskRunner::WorkerThread::Notify() {
   condition_var_.NotifyAll();
 }
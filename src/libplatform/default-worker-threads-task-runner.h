@@ -5,10 +5,13 @@
 #ifndef V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 #define V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <vector>
 
 #include "include/libplatform/libplatform-export.h"
+#include "include/libplatform/libplatform.h"
 #include "include/v8-platform.h"
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
@@ -25,7 +28,8 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
   DefaultWorkerThreadsTaskRunner(
       uint32_t thread_pool_size, TimeFunction time_function,
-      base::Thread::Priority priority = base::Thread::Priority::kDefault);
+      base::Thread::Priority priority = base::Thread::Priority::kDefault,
+      WorkerScheduling worker_scheduling = WorkerScheduling::kSharedQueue);
 
   ~DefaultWorkerThreadsTaskRunner() override;
 
@@ -47,10 +51,20 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
   void PostIdleTaskImpl(std::unique_ptr<IdleTask> task,
                         const SourceLocation& location) override;
 
+  // With WorkerScheduling::kWorkStealing, every worker owns one of these.
+  // Tasks are taken from the front, by the owner as well as by other workers
+  // stealing from it, so that the oldest tasks run first.
+  struct LocalQueue {
+    base::Mutex lock;
+    std::deque<std::unique_ptr<Task>> tasks;
+    // NUMA node the owning worker last ran on, used to pick steal victims.
+    std::atomic<int> numa_node{0};
+  };
+
   class WorkerThread : public base::Thread {
    public:
-    explicit WorkerThread(DefaultWorkerThreadsTaskRunner* runner,
-                          base::Thread::Priority priority);
+    WorkerThread(DefaultWorkerThreadsTaskRunner* runner,
+                 base::Thread::Priority priority, int index);
     ~WorkerThread() override;
 
     WorkerThread(const WorkerThread&) = delete;
@@ -62,7 +76,11 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
     void Notify();
 
    private:
+    void RunWorkStealing();
+
     DefaultWorkerThreadsTaskRunner* runner_;
+    // Index into |runner_->local_queues_|, or -1 without work stealing.
+    const int index_;
     base::ConditionVariable condition_var_;
   };
 
@@ -70,11 +88,28 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
   // executed. Blocks if no task is available.
   std::unique_ptr<Task> GetNext();
 
-  bool terminated_ = false;
+  bool work_stealing() const { return !local_queues_.empty(); }
+
+  // Pops a task from the worker's own queue, or else steals one from another
+  // worker, trying workers on the same NUMA node first.
+  std::unique_ptr<Task> TryPopOrSteal(int index);
+
+  // Both require |lock_| to be held.
+  void AddIdleThread(WorkerThread* thread);
+  void NotifyIdleThread();
+
+  std::atomic<bool> terminated_{false};
   base::Mutex lock_;
   // Vector of idle threads -- these are pushed in LIFO order, so that the most
   // recently active thread is the first to be reactivated.
   std::vector<WorkerThread*> idle_threads_;
+  // Mirrors |idle_threads_.size()| so that posting to a local queue only takes
+  // |lock_| when there may be a thread to wake up.
+  std::atomic<size_t> num_idle_threads_{0};
+  // Local queues must outlive the workers, so they are declared before the
+  // pool.
+  std::vector<std::unique_ptr<LocalQueue>> local_queues_;
+  std::atomic<uint32_t> next_local_queue_{0};
   std::vector<std::unique_ptr<WorkerThread>> thread_pool_;
   // Worker threads access this queue, so we can only destroy it after all
   // workers stopped.
@@ -225,9 +225,16 @@ namespace internal {
      MILLISECOND)                                                              \
   HT(gc_time_to_global_safepoint, V8.GC.TimeToGlobalSafepoint, 10000000,       \
      MICROSECOND)                                                              \
+  /* Time from requesting a global safepoint until it is left, which bounds */ \
+  /* the pause of every client isolate. */                                     \
+  HT(gc_global_safepoint_duration, V8.GC.GlobalSafepointDuration, 10000000,    \
+     MICROSECOND)                                                              \
   HT(gc_time_to_safepoint, V8.GC.TimeToSafepoint, 10000000, MICROSECOND)       \
   HT(gc_time_to_collection_on_background, V8.GC.TimeToCollectionOnBackground,  \
      10000000, MICROSECOND)                                                    \
+  /* Deoptimizer timers. */                                                    \
+  HT(deopt_materialize_heap_objects, V8.DeoptMaterializeHeapObjects, 100000,   \
+     MICROSECOND)                                                              \
   /* Maglev timers. */                                                         \
   HT(maglev_optimize_prepare, V8.MaglevOptimizePrepare, 100000, MICROSECOND)   \
   HT(maglev_optimize_execute, V8.MaglevOptimizeExecute, 100000, MICROSECOND)   \
@@ -378,6 +385,12 @@ namespace internal {
   SC(wasm_reloc_size, V8.WasmRelocBytes)                                       \
   SC(wasm_deopt_data_size, V8.WasmDeoptDataBytes)                              \
   SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions)           \
+  SC(wasm_flushed_cold_liftoff_functions, V8.WasmFlushedColdLiftoffFunctions)  \
+  SC(wasm_flushed_cold_liftoff_code_size, V8.WasmFlushedColdLiftoffCodeBytes)  \
+  SC(wasm_flushed_cold_turbofan_functions,                                     \
+     V8.WasmFlushedColdTurbofanFunctions)                                      \
+  SC(wasm_flushed_cold_turbofan_code_size,                                     \
+     V8.WasmFlushedColdTurbofanCodeBytes)                                      \
   SC(wasm_compiled_export_wrapper, V8.WasmCompiledExportWrappers)
 
 // List of counters that can be incremented from generated code. We need them in
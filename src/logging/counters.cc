@@ -10,6 +10,7 @@
 #include "src/builtins/builtins-definitions.h"
 #include "src/execution/isolate.h"
 #include "src/execution/thread-id.h"
+#include "src/flags/flags.h"
 #include "src/logging/log-inl.h"
 #include "src/logging/log.h"
 
@@ -163,6 +164,12 @@ Counters::Counters(Isolate* isolate)
       stats_table_(this) {
   CountersInitializer init(this);
   init.Start();
+#ifdef V8_RUNTIME_CALL_STATS
+  if (v8_flags.runtime_call_stats_sampling) {
+    runtime_call_stats_sampler_ =
+        std::make_unique<RuntimeCallStatsSampler>(&runtime_call_stats_);
+  }
+#endif
 }
 
 void StatsCounterResetter::VisitStatsCounter(StatsCounter* counter,
@@ -600,6 +600,11 @@ class Counters : public std::enable_shared_from_this<Counters> {
   WorkerThreadRuntimeCallStats* worker_thread_runtime_call_stats() {
     return &worker_thread_runtime_call_stats_;
   }
+
+  // Only with --runtime-call-stats-sampling, nullptr otherwise.
+  RuntimeCallStatsSampler* runtime_call_stats_sampler() {
+    return runtime_call_stats_sampler_.get();
+  }
 #else   // V8_RUNTIME_CALL_STATS
   RuntimeCallStats* runtime_call_stats() { return nullptr; }
 
@@ -665,6 +670,8 @@ class Counters : public std::enable_shared_from_this<Counters> {
 #ifdef V8_RUNTIME_CALL_STATS
   RuntimeCallStats runtime_call_stats_;
   WorkerThreadRuntimeCallStats worker_thread_runtime_call_stats_;
+  // Declared after the table it samples, so that it stops first.
+  std::unique_ptr<RuntimeCallStatsSampler> runtime_call_stats_sampler_;
 #endif
   Isolate* isolate_;
   StatsTable stats_table_;
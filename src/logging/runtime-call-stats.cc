@@ -8,6 +8,8 @@
 
 #include <iomanip>
 
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
 #include "src/flags/flags.h"
 #include "src/tracing/tracing-category-observer.h"
 #include "src/utils/ostreams.h"
@@ -352,6 +354,61 @@ WorkerThreadRuntimeCallStatsScope::~WorkerThreadRuntimeCallStatsScope() {
   }
 }
 
+class RuntimeCallStatsSampler::SamplingThread final : public base::Thread {
+ public:
+  explicit SamplingThread(RuntimeCallStatsSampler* sampler)
+      : Thread(Options("RuntimeCallStatsSampler")),
+        sampler_(sampler),
+        interval_(base::TimeDelta::FromMicroseconds(
+            v8_flags.runtime_call_stats_sampling_interval)) {}
+
+  void Run() override {
+    base::MutexGuard guard(&mutex_);
+    while (!stopping_) {
+      if (stop_requested_.WaitFor(&mutex_, interval_)) continue;
+      sampler_->Sample();
+    }
+  }
+
+  void Stop() {
+    {
+      base::MutexGuard guard(&mutex_);
+      stopping_ = true;
+    }
+    stop_requested_.NotifyOne();
+    Join();
+  }
+
+ private:
+  RuntimeCallStatsSampler* const sampler_;
+  const base::TimeDelta interval_;
+  base::Mutex mutex_;
+  base::ConditionVariable stop_requested_;
+  bool stopping_ = false;
+};
+
+RuntimeCallStatsSampler::RuntimeCallStatsSampler(RuntimeCallStats* stats)
+    : stats_(stats), thread_(std::make_unique<SamplingThread>(this)) {
+  CHECK(thread_->Start());
+}
+
+RuntimeCallStatsSampler::~RuntimeCallStatsSampler() { thread_->Stop(); }
+
+void RuntimeCallStatsSampler::Reset() {
+  for (std::atomic<uint64_t>& samples : samples_) {
+    samples.store(0, std::memory_order_relaxed);
+  }
+  total_samples_.store(0, std::memory_order_relaxed);
+}
+
+void RuntimeCallStatsSampler::Sample() {
+  total_samples_.fetch_add(1, std::memory_order_relaxed);
+  RuntimeCallCounter* counter = stats_->current_counter();
+  if (counter == nullptr) return;
+  samples_[counter - stats_->GetCounter(0)].fetch_add(
+      1, std::memory_order_relaxed);
+}
+
 }  // namespace internal
 }  // namespace v8
 
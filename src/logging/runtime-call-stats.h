@@ -5,6 +5,8 @@
 #ifndef V8_LOGGING_RUNTIME_CALL_STATS_H_
 #define V8_LOGGING_RUNTIME_CALL_STATS_H_
 
+#include <atomic>
+#include <memory>
 #include <optional>
 
 // These includes are needed for the macro lists defining the
@@ -173,7 +175,9 @@ namespace v8::internal {
   V(SharedArrayBuffer_NewBackingStore)                     \
   V(String_Concat)                                         \
   V(String_NewExternalOneByte)                             \
+  V(String_NewExternalOneByteSlices)                       \
   V(String_NewExternalTwoByte)                             \
+  V(String_NewExternalTwoByteSlices)                       \
   V(String_NewFromOneByte)                                 \
   V(String_NewFromTwoByte)                                 \
   V(String_NewFromUtf8)                                    \
@@ -297,6 +301,7 @@ namespace v8::internal {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLateOptimization)        \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLoopPeeling)             \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLoopUnrolling)           \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLoopVectorization)       \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftMachineLowering)         \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftTurbolevGraphBuilding)   \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize,                                    \
@@ -308,6 +313,7 @@ namespace v8::internal {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftTagUntagLowering)        \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftTypeAssertions)          \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftTypedOptimizations)      \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftWasmBoundsCheckHoisting) \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftWasmDeadCodeElimination) \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftWasmGCOptimize)          \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftWasmOptimize)            \
@@ -757,6 +763,43 @@ class V8_EXPORT_PRIVATE V8_NODISCARD WorkerThreadRuntimeCallStatsScope final {
   RuntimeCallStats* table_ = nullptr;
 };
 
+// Samples which counter of a main thread table is active, for
+// --runtime-call-stats-sampling. In that mode timers only maintain the stack
+// of active counters and take no timestamps, so the sampled thread pays for
+// two stores per runtime call and the samples give the time breakdown.
+class RuntimeCallStatsSampler final {
+ public:
+  explicit RuntimeCallStatsSampler(RuntimeCallStats* stats);
+  ~RuntimeCallStatsSampler();
+
+  RuntimeCallStatsSampler(const RuntimeCallStatsSampler&) = delete;
+  RuntimeCallStatsSampler& operator=(const RuntimeCallStatsSampler&) = delete;
+
+  // Samples taken while |counter_id| was the active counter.
+  uint64_t samples(int counter_id) const {
+    return samples_[counter_id].load(std::memory_order_relaxed);
+  }
+  // All samples, including those taken while no counter was active.
+  uint64_t total_samples() const {
+    return total_samples_.load(std::memory_order_relaxed);
+  }
+  const char* counter_name(int counter_id) {
+    return stats_->GetCounter(counter_id)->name();
+  }
+
+  void Reset();
+
+ private:
+  class SamplingThread;
+
+  void Sample();
+
+  RuntimeCallStats* const stats_;
+  std::atomic<uint64_t> samples_[RuntimeCallStats::kNumberOfCounters] = {};
+  std::atomic<uint64_t> total_samples_{0};
+  std::unique_ptr<SamplingThread> thread_;
+};
+
 #define CHANGE_CURRENT_RUNTIME_COUNTER(runtime_call_stats, counter_id) \
   do {                                                                 \
     if (V8_UNLIKELY(TracingFlags::is_runtime_stats_enabled()) &&       \
@@ -4,10 +4,14 @@
 
 #include "src/maglev/maglev-concurrent-dispatcher.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "src/base/fpu.h"
 #include "src/codegen/compiler.h"
 #include "src/compiler/compilation-dependencies.h"
 #include "src/compiler/js-heap-broker.h"
+#include "src/diagnostics/code-tracer.h"
 #include "src/execution/isolate.h"
 #include "src/execution/local-isolate-inl.h"
 #include "src/flags/flags.h"
@@ -20,6 +24,7 @@
 #include "src/maglev/maglev-compiler.h"
 #include "src/maglev/maglev-graph-labeller.h"
 #include "src/maglev/maglev-pipeline-statistics.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/js-function-inl.h"
 #include "src/objects/shared-function-info-inl.h"
 #include "src/utils/identity-map.h"
@@ -255,6 +260,62 @@ void MaglevCompilationJob::EndPhaseKind() {
   }
 }
 
+void MaglevJobQueue::Enqueue(std::unique_ptr<MaglevCompilationJob> job,
+                             uint64_t priority) {
+  base::MutexGuard guard(&mutex_);
+  entries_.push_back({priority, next_sequence_++, std::move(job)});
+  size_.store(entries_.size(), std::memory_order_relaxed);
+}
+
+bool MaglevJobQueue::Dequeue(std::unique_ptr<MaglevCompilationJob>* job) {
+  base::MutexGuard guard(&mutex_);
+  if (entries_.empty()) return false;
+  auto best = std::max_element(
+      entries_.begin(), entries_.end(), [](const Entry& a, const Entry& b) {
+        if (a.priority != b.priority) return a.priority < b.priority;
+        return a.sequence > b.sequence;
+      });
+  *job = std::move(best->job);
+  if (best != entries_.end() - 1) *best = std::move(entries_.back());
+  entries_.pop_back();
+  size_.store(entries_.size(), std::memory_order_relaxed);
+  return true;
+}
+
+bool MaglevJobQueue::MergeDuplicate(const MaglevCompilationJob* job,
+                                    uint64_t priority) {
+  base::MutexGuard guard(&mutex_);
+  Tagged<SharedFunctionInfo> shared = job->function()->shared();
+  for (Entry& entry : entries_) {
+    if (entry.job->function()->shared() != shared ||
+        entry.job->osr_offset() != job->osr_offset()) {
+      continue;
+    }
+    constexpr uint64_t kMax = std::numeric_limits<uint64_t>::max();
+    entry.priority = priority > kMax - entry.priority
+                         ? kMax
+                         : entry.priority + priority;
+    return true;
+  }
+  return false;
+}
+
+void MaglevJobQueue::RemoveJobsFor(
+    Tagged<FeedbackVector> vector,
+    std::vector<std::unique_ptr<MaglevCompilationJob>>* removed) {
+  base::MutexGuard guard(&mutex_);
+  size_t kept = 0;
+  for (Entry& entry : entries_) {
+    if (entry.job->function()->raw_feedback_cell()->value() == vector) {
+      removed->push_back(std::move(entry.job));
+    } else {
+      entries_[kept++] = std::move(entry);
+    }
+  }
+  entries_.resize(kept);
+  size_.store(entries_.size(), std::memory_order_relaxed);
+}
+
 // The JobTask is posted to V8::GetCurrentPlatform(). It's responsible for
 // processing the incoming queue on a worker thread.
 class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
@@ -319,7 +380,9 @@ class MaglevConcurrentDispatcher::JobTask final : public v8::JobTask {
 
  private:
   Isolate* isolate() const { return dispatcher_->isolate_; }
-  QueueT* incoming_queue() const { return &dispatcher_->incoming_queue_; }
+  MaglevJobQueue* incoming_queue() const {
+    return &dispatcher_->incoming_queue_;
+  }
   QueueT* outgoing_queue() const { return &dispatcher_->outgoing_queue_; }
   QueueT* destruction_queue() const { return &dispatcher_->destruction_queue_; }
 
@@ -358,10 +421,67 @@ MaglevConcurrentDispatcher::~MaglevConcurrentDispatcher() {
 void MaglevConcurrentDispatcher::EnqueueJob(
     std::unique_ptr<MaglevCompilationJob>&& job) {
   DCHECK(is_enabled());
-  incoming_queue_.Enqueue(std::move(job));
+  if (!v8_flags.concurrent_maglev_prioritize_jobs) {
+    incoming_queue_.Enqueue(std::move(job), 0);
+    job_handle_->NotifyConcurrencyIncrease();
+    return;
+  }
+  uint64_t priority = EstimateBenefit(job.get());
+  // Another closure of the same function already waits for a worker, so
+  // this one compiles once that job is done and the function is hot again,
+  // and the workers pick distinct functions in the meantime.
+  if (incoming_queue_.MergeDuplicate(job.get(), priority)) {
+    if (v8_flags.trace_opt_verbose) {
+      CodeTracer::Scope scope(isolate_->GetCodeTracer());
+      PrintF(scope.file(), "[not enqueueing Maglev job for ");
+      ShortPrint(*job->function(), scope.file());
+      PrintF(scope.file(), ": a job for the same function is queued]\n");
+    }
+    DisposeUnstartedJob(std::move(job));
+    return;
+  }
+  incoming_queue_.Enqueue(std::move(job), priority);
   job_handle_->NotifyConcurrencyIncrease();
 }
 
+void MaglevConcurrentDispatcher::CancelStaleJobs(
+    Tagged<FeedbackVector> vector) {
+  DCHECK(is_enabled());
+  if (!v8_flags.concurrent_maglev_prioritize_jobs) return;
+  std::vector<std::unique_ptr<MaglevCompilationJob>> stale;
+  incoming_queue_.RemoveJobsFor(vector, &stale);
+  for (std::unique_ptr<MaglevCompilationJob>& job : stale) {
+    if (v8_flags.trace_opt_verbose) {
+      CodeTracer::Scope scope(isolate_->GetCodeTracer());
+      PrintF(scope.file(), "[cancelling queued Maglev job for ");
+      ShortPrint(*job->function(), scope.file());
+      PrintF(scope.file(), ": feedback changed]\n");
+    }
+    DisposeUnstartedJob(std::move(job));
+  }
+}
+
+uint64_t MaglevConcurrentDispatcher::EstimateBenefit(
+    const MaglevCompilationJob* job) const {
+  if (job->is_osr()) return std::numeric_limits<uint64_t>::max();
+  Tagged<JSFunction> function = *job->function();
+  if (!function->has_feedback_vector()) return 0;
+  uint64_t invocations =
+      std::max(function->feedback_vector()->invocation_count(), 1);
+  uint64_t bytecode_length =
+      function->shared()->GetBytecodeArray(isolate_)->length();
+  return invocations * bytecode_length;
+}
+
+void MaglevConcurrentDispatcher::DisposeUnstartedJob(
+    std::unique_ptr<MaglevCompilationJob> job) {
+  Compiler::DisposeMaglevCompilationJob(job.get(), isolate_);
+  if (v8_flags.maglev_destroy_on_background) {
+    destruction_queue_.Enqueue(std::move(job));
+    job_handle_->NotifyConcurrencyIncrease();
+  }
+}
+
 void MaglevConcurrentDispatcher::FinalizeFinishedJobs() {
   HandleScope handle_scope(isolate_);
   while (!outgoing_queue_.IsEmpty()) {
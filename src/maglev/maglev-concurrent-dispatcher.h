@@ -7,8 +7,11 @@
 
 #ifdef V8_ENABLE_MAGLEV
 
+#include <atomic>
 #include <memory>
+#include <vector>
 
+#include "src/base/platform/mutex.h"
 #include "src/codegen/compiler.h"  // For OptimizedCompilationJob.
 #include "src/maglev/maglev-pipeline-statistics.h"
 #include "src/utils/locked-queue.h"
@@ -16,6 +19,7 @@
 namespace v8 {
 namespace internal {
 
+class FeedbackVector;
 class Isolate;
 
 namespace maglev {
@@ -72,6 +76,45 @@ class MaglevCompilationJob final : public OptimizedCompilationJob {
   std::unique_ptr<MaglevPipelineStatistics> pipeline_statistics_;
 };
 
+// Jobs waiting for a worker thread. They are handed out by decreasing
+// priority, and in the order they were added for the same priority.
+class MaglevJobQueue final {
+ public:
+  MaglevJobQueue() = default;
+  MaglevJobQueue(const MaglevJobQueue&) = delete;
+  MaglevJobQueue& operator=(const MaglevJobQueue&) = delete;
+
+  void Enqueue(std::unique_ptr<MaglevCompilationJob> job, uint64_t priority);
+  bool Dequeue(std::unique_ptr<MaglevCompilationJob>* job);
+
+  // Called from the main thread. Returns whether a job for the same function
+  // and OSR offset as |job| is queued, after raising its priority by
+  // |priority|.
+  bool MergeDuplicate(const MaglevCompilationJob* job, uint64_t priority);
+
+  // Called from the main thread. Moves the queued jobs that compile a
+  // function with |vector| to |removed|.
+  void RemoveJobsFor(Tagged<FeedbackVector> vector,
+                     std::vector<std::unique_ptr<MaglevCompilationJob>>*
+                         removed);
+
+  bool IsEmpty() const { return size() == 0; }
+  size_t size() const { return size_.load(std::memory_order_relaxed); }
+
+ private:
+  struct Entry {
+    uint64_t priority;
+    uint64_t sequence;
+    std::unique_ptr<MaglevCompilationJob> job;
+  };
+
+  base::Mutex mutex_;
+  // Unordered, since queues are short.
+  std::vector<Entry> entries_;
+  uint64_t next_sequence_ = 0;
+  std::atomic<size_t> size_{0};
+};
+
 // The public API for Maglev concurrent compilation.
 // Keep this as minimal as possible.
 class V8_EXPORT_PRIVATE MaglevConcurrentDispatcher final {
@@ -85,9 +128,16 @@ class V8_EXPORT_PRIVATE MaglevConcurrentDispatcher final {
   explicit MaglevConcurrentDispatcher(Isolate* isolate);
   ~MaglevConcurrentDispatcher();
 
-  // Called from the main thread.
+  // Called from the main thread. With --concurrent-maglev-prioritize-jobs,
+  // jobs are started by decreasing EstimateBenefit(), and a job is dropped
+  // again if one for the same function is already queued.
   void EnqueueJob(std::unique_ptr<MaglevCompilationJob>&& job);
 
+  // Called from the main thread when the feedback in |vector| changed.
+  // Drops the queued jobs for it, since the tiering decision that requested
+  // them was taken on feedback that wasn't stable yet.
+  void CancelStaleJobs(Tagged<FeedbackVector> vector);
+
   // Called from the main thread.
   void FinalizeFinishedJobs();
 
@@ -98,9 +148,14 @@ class V8_EXPORT_PRIVATE MaglevConcurrentDispatcher final {
   bool is_enabled() const { return static_cast<bool>(job_handle_); }
 
  private:
+  // The invocation count times the bytecode size of the function, or the
+  // maximum priority for OSR, since the function waits in a loop for it.
+  uint64_t EstimateBenefit(const MaglevCompilationJob* job) const;
+  void DisposeUnstartedJob(std::unique_ptr<MaglevCompilationJob> job);
+
   Isolate* const isolate_;
   std::unique_ptr<JobHandle> job_handle_;
-  QueueT incoming_queue_;
+  MaglevJobQueue incoming_queue_;
   QueueT outgoing_queue_;
   QueueT destruction_queue_;
 };
@@ -40,6 +40,7 @@
 #include "src/execution/protectors.h"
 #include "src/flags/flags.h"
 #include "src/handles/maybe-handles-inl.h"
+#include "src/heap/heap-layout-inl.h"
 #include "src/ic/handler-configuration-inl.h"
 #include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/bytecode-decoder.h"
@@ -4430,15 +4431,18 @@ bool MaglevGraphBuilder::CanElideWriteBarrier(ValueNode* object,
     return true;
   }
 
-  // No need for a write barrier if both object and value are part of the same
-  // folded young allocation.
+  // No need for a write barrier if the object is part of the current folded
+  // young allocation: nothing that can allocate or trigger a GC has run since
+  // it was allocated, so it is still in the young generation and unmarked.
+  // This holds for any value that is already tagged; tagging {value} here
+  // could allocate after the object. The block must then stay young.
   // Turbolev will do this optimization later after allocation folding. Doing it
   // here could interfere with turboshaft pretenuring.
   AllocationBlock* allocation = GetAllocation(object);
   if (!is_turbolev() && allocation != nullptr &&
       current_allocation_block_ == allocation &&
       allocation->allocation_type() == AllocationType::kYoung &&
-      allocation == GetAllocation(value)) {
+      (allocation == GetAllocation(value) || value->is_tagged())) {
     allocation->set_elided_write_barriers_depend_on_type();
     return true;
   }
@@ -4700,6 +4704,56 @@ void MaglevGraphBuilder::TryBuildStoreTaggedFieldToAllocation(ValueNode* object,
   }
 }
 
+void MaglevGraphBuilder::TryBuildStoreElementToAllocation(ValueNode* elements,
+                                                          ValueNode* index,
+                                                          ValueNode* value) {
+  if (!v8_flags.maglev_object_tracking) return;
+  if (!elements->Is<InlinedAllocation>()) return;
+  // This avoids loop in the object graph.
+  if (value->Is<InlinedAllocation>()) return;
+  // Conversions must not leak into virtual objects, see BuildStoreTaggedField.
+  if (value->is_conversion()) return;
+  std::optional<int32_t> constant_index = TryGetInt32Constant(index);
+  if (!constant_index) return;
+  InlinedAllocation* allocation = elements->Cast<InlinedAllocation>();
+  if (allocation->IsEscaping()) return;
+  // CanTrackObjectChanges refuses stores to objects that are pointed to by
+  // other objects. The backing store of an array literal can still be
+  // tracked as long as the array itself is, since nothing else refers to it:
+  // this is what keeps the stores of StaInArrayLiteral from escaping e.g.
+  // `[a, b]`.
+  auto containers = graph_->allocations_elide_map().find(allocation);
+  if (containers == graph_->allocations_elide_map().end() ||
+      containers->second.size() != 1) {
+    return;
+  }
+  InlinedAllocation* array = containers->second[0];
+  if (!array->object()->has_static_map() ||
+      !array->object()->map().IsJSArrayMap() ||
+      !CanTrackObjectChanges(array, TrackObjectMode::kStore)) {
+    return;
+  }
+  if (!allocation->object()->has_static_map() ||
+      !allocation->object()->map().IsFixedArrayMap()) {
+    return;
+  }
+  std::optional<int32_t> length = TryGetInt32Constant(
+      GetObjectFromAllocation(allocation)->get(FixedArrayBase::kLengthOffset));
+  if (!length || constant_index.value() < 0 ||
+      constant_index.value() >= length.value()) {
+    return;
+  }
+  VirtualObject* vobject = GetModifiableObjectFromAllocation(allocation);
+  CHECK_NOT_NULL(vobject);
+  vobject->set(FixedArray::OffsetOfElementAt(constant_index.value()), value);
+  AddNonEscapingUses(allocation, 1);
+  if (v8_flags.trace_maglev_object_tracking) {
+    std::cout << "  * Setting element in virtual object "
+              << PrintNodeLabel(vobject) << "[" << constant_index.value()
+              << "]: " << PrintNode(value) << std::endl;
+  }
+}
+
 ReduceResult MaglevGraphBuilder::BuildStoreTaggedField(
     ValueNode* object, ValueNode* value, int offset, StoreTaggedMode store_mode,
     PropertyKey property_key) {
@@ -4809,9 +4863,8 @@ ReduceResult MaglevGraphBuilder::BuildLoadFixedArrayElement(ValueNode* elements,
 
 ReduceResult MaglevGraphBuilder::BuildStoreFixedArrayElement(
     ValueNode* elements, ValueNode* index, ValueNode* value) {
-  // TODO(victorgomes): Support storing element to a virtual object. If we
-  // modify the elements array, we need to modify the original object to point
-  // to the new elements array.
+  MarkArgumentsElementsWritten(elements);
+  TryBuildStoreElementToAllocation(elements, index, value);
   if (CanElideWriteBarrier(elements, value)) {
     return AddNewNode<StoreFixedArrayElementNoWriteBarrier>(
         {elements, index, value});
@@ -5146,6 +5199,15 @@ ValueNode* MaglevGraphBuilder::BuildLoadFixedArrayLength(
   // We won't try to reason about the type of the FixedArray and thus also
   // cannot end up with an empty type for it.
   DCHECK(!IsEmptyNodeType(GetType(fixed_array)));
+  if (CanReadArgumentsElementsFromStack(fixed_array)) {
+    ArgumentsElements* arguments_elements =
+        fixed_array->Cast<ArgumentsElements>();
+    if (arguments_elements->create_arguments_type() ==
+        CreateArgumentsType::kUnmappedArguments) {
+      // The backing store holds all arguments.
+      return arguments_elements->ArgumentsCountInput().node();
+    }
+  }
   ValueNode* length;
   GET_VALUE(length,
             BuildLoadTaggedField(fixed_array, offsetof(FixedArray, length_),
@@ -5508,6 +5570,33 @@ MaybeReduceResult MaglevGraphBuilder::TryBuildPropertyAccess(
   }
 }
 
+bool MaglevGraphBuilder::IsKnownSharedValue(ValueNode* value) {
+  // Keep in sync with the fast paths of CodeStubAssembler::SharedValueBarrier.
+  // Untagged doubles would be boxed into a fresh, unshared HeapNumber.
+  if (IsDoubleRepresentation(value->value_representation())) return false;
+  if (CheckType(value, NodeType::kSmi)) return true;
+
+  if (compiler::OptionalHeapObjectRef constant =
+          TryGetConstant<HeapObject>(value)) {
+    Tagged<HeapObject> object = *constant->object();
+    return HeapLayout::InReadOnlySpace(object) ||
+           HeapLayout::InWritableSharedSpace(object);
+  }
+
+  NodeInfo* info = known_node_aspects().TryGetInfoFor(value);
+  if (!info || !info->possible_maps_are_known() ||
+      info->possible_maps().is_empty()) {
+    return false;
+  }
+  for (compiler::MapRef map : info->possible_maps()) {
+    if (!InstanceTypeChecker::IsAlwaysSharedSpaceJSObject(
+            map.instance_type())) {
+      return false;
+    }
+  }
+  return true;
+}
+
 template <typename GenericAccessFunc>
 MaybeReduceResult MaglevGraphBuilder::TryBuildNamedAccess(
     ValueNode* receiver, ValueNode* lookup_start_object,
@@ -5587,16 +5676,25 @@ MaybeReduceResult MaglevGraphBuilder::TryBuildNamedAccess(
   for (compiler::MapRef map : inferred_maps) {
     if (map.is_deprecated()) continue;
 
-    // TODO(v8:12547): Support writing to objects in shared space, which
-    // need a write barrier that calls Object::Share to ensure the RHS is
-    // shared.
-    if (InstanceTypeChecker::IsAlwaysSharedSpaceJSObject(map.instance_type()) &&
-        access_mode == compiler::AccessMode::kStore) {
+    // Writing to objects in shared space needs a barrier that calls
+    // Object::Share to ensure the RHS is shared. We only inline plain field
+    // stores into JSSharedStructs of values that are already known to be
+    // shared, and leave everything else to the StoreIC.
+    bool const is_shared_struct_store =
+        InstanceTypeChecker::IsAlwaysSharedSpaceJSObject(map.instance_type()) &&
+        access_mode == compiler::AccessMode::kStore;
+    if (is_shared_struct_store &&
+        (map.instance_type() != JS_SHARED_STRUCT_TYPE ||
+         !IsKnownSharedValue(GetAccumulator()))) {
       return {};
     }
 
     compiler::PropertyAccessInfo access_info =
         broker()->GetPropertyAccessInfo(map, feedback.name(), access_mode);
+    if (is_shared_struct_store &&
+        (!access_info.IsDataField() || access_info.HasTransitionMap())) {
+      return {};
+    }
     access_infos_for_feedback.push_back(access_info);
   }
 
@@ -6201,10 +6299,16 @@ MaybeReduceResult MaglevGraphBuilder::TryBuildElementLoadOnJSArrayOrJSObject(
           is_holey && CanTreatHoleAsUndefined(maps) &&
           LoadModeHandlesHoles(load_mode);
       bool is_smi = elements_kind == PACKED_SMI_ELEMENTS;
-      GET_VALUE_OR_ABORT(result,
-                         BuildLoadFixedArrayElement(
-                             elements_array, index,
-                             is_smi ? LoadType::kSmi : LoadType::kUnknown));
+      MaybeReduceResult stack_argument =
+          TryBuildLoadStackArgument(elements_array, index);
+      if (stack_argument.IsDone()) {
+        GET_VALUE_OR_ABORT(result, stack_argument);
+      } else {
+        GET_VALUE_OR_ABORT(result,
+                           BuildLoadFixedArrayElement(
+                               elements_array, index,
+                               is_smi ? LoadType::kSmi : LoadType::kUnknown));
+      }
       if (is_holey) {
         if (is_holey_and_treat_hole_as_undefined) {
           GET_VALUE_OR_ABORT(result, BuildConvertHoleToUndefined(result));
@@ -6373,6 +6477,7 @@ MaybeReduceResult MaglevGraphBuilder::TryBuildElementStoreOnJSArrayOrJSObject(
           DeoptimizeReason::kOutOfBounds));
 
       // Grow backing store if necessary and handle COW.
+      MarkArgumentsElementsWritten(elements_array);
       GET_VALUE_OR_ABORT(elements_array, AddNewNode<MaybeGrowFastElements>(
                                              {elements_array, object, index,
                                               elements_array_length},
@@ -6404,6 +6509,7 @@ MaybeReduceResult MaglevGraphBuilder::TryBuildElementStoreOnJSArrayOrJSObject(
       // Handle COW if needed.
       if (IsSmiOrObjectElementsKind(elements_kind)) {
         if (keyed_mode.store_mode() == KeyedAccessStoreMode::kHandleCOW) {
+          MarkArgumentsElementsWritten(elements_array);
           GET_VALUE_OR_ABORT(
               elements_array,
               AddNewNode<EnsureWritableFastElements>({elements_array, object}));
@@ -8559,6 +8665,9 @@ ReduceResult MaglevGraphBuilder::BuildEagerInlineCall(
   // Set the inner graph builder to build in the current block.
   reducer_.FlushNodesToBlock();
   inner_graph_builder.set_current_block(current_block());
+  // Nothing has allocated since the current allocation block either, so the
+  // callee can keep folding into it and eliding barriers for its objects.
+  inner_graph_builder.current_allocation_block_ = current_allocation_block_;
 
   // Build inline function.
   ReduceResult result = inner_graph_builder.BuildInlineFunction(
@@ -8568,7 +8677,9 @@ ReduceResult MaglevGraphBuilder::BuildEagerInlineCall(
   unobserved_context_slot_stores_ =
       inner_graph_builder.unobserved_context_slot_stores_;
   latest_checkpointed_frame_ = nullptr;
-  ClearCurrentAllocationBlock();
+  // The inner builder cleared its block at any node that could allocate and
+  // at any control flow, including the merge of several returns.
+  current_allocation_block_ = inner_graph_builder.current_allocation_block_;
 
   if (result.IsDoneWithAbort()) {
     DCHECK_NULL(inner_graph_builder.current_block());
@@ -8808,13 +8919,57 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayMap(
   return result_array;
 }
 
+MaybeReduceResult MaglevGraphBuilder::TryReduceArrayReduce(
+    compiler::JSFunctionRef target, CallArguments& args) {
+  // Without an initial value, the accumulator starts out as the first element
+  // that is not a hole, and reducing an empty array throws.
+  if (args.count() < 2) {
+    FAIL(" to reduce Array.prototype.reduce - no initial value");
+  }
+
+  ValueNode* accumulator = args[1];
+
+  auto get_lazy_deopt_scope =
+      [this](compiler::JSFunctionRef target, ValueNode* receiver,
+             ValueNode* callback, ValueNode* this_arg, ValueNode* index_int32,
+             ValueNode* next_index_int32, ValueNode* original_length) {
+        // The result of the call is the next accumulator.
+        return LazyDeoptFrameScope(
+            this, Builtin::kArrayReduceLoopLazyDeoptContinuation, target,
+            base::VectorOf<ValueNode*>(
+                {receiver, callback, next_index_int32, original_length}));
+      };
+
+  auto get_eager_deopt_scope =
+      [this, &accumulator](compiler::JSFunctionRef target, ValueNode* receiver,
+                           ValueNode* callback, ValueNode* this_arg,
+                           ValueNode* index_int32, ValueNode* next_index_int32,
+                           ValueNode* original_length) {
+        return EagerDeoptFrameScope(
+            this, Builtin::kArrayReduceLoopEagerDeoptContinuation, target,
+            base::VectorOf<ValueNode*>({receiver, callback, next_index_int32,
+                                        original_length, accumulator}));
+      };
+
+  MaybeReduceResult builtin_result = TryReduceArrayIteratingBuiltin(
+      "Array.prototype.reduce", target, args, get_eager_deopt_scope,
+      get_lazy_deopt_scope, {}, {}, &accumulator);
+  if (builtin_result.IsFail() || builtin_result.IsDoneWithAbort()) {
+    return builtin_result;
+  }
+  DCHECK(builtin_result.IsDoneWithoutPayload());
+  return accumulator;
+}
+
 MaybeReduceResult MaglevGraphBuilder::TryReduceArrayIteratingBuiltin(
     const char* name, compiler::JSFunctionRef target, CallArguments& args,
     GetEagerDeoptScopeCallback get_eager_deopt_scope,
     GetLazyDeoptScopeCallback get_lazy_deopt_scope,
     const std::optional<InitialCallback>& initial_callback,
-    const std::optional<ProcessElementCallback>& process_element_callback) {
+    const std::optional<ProcessElementCallback>& process_element_callback,
+    ValueNode** accumulator) {
   DCHECK_EQ(initial_callback.has_value(), process_element_callback.has_value());
+  DCHECK_IMPLIES(accumulator, !process_element_callback.has_value());
 
   if (!CanSpeculateCall()) return {};
 
@@ -8879,10 +9034,12 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayIteratingBuiltin(
   }
   PossibleMaps receiver_maps_before_loop(*possible_maps);
 
-  // Create a sub graph builder with two variables (index and length).
-  MaglevSubGraphBuilder sub_builder(this, 2);
+  // Create a sub graph builder with two variables (index and length), and a
+  // third one for the accumulator if there is one.
+  MaglevSubGraphBuilder sub_builder(this, accumulator ? 3 : 2);
   MaglevSubGraphBuilder::Variable var_index(0);
   MaglevSubGraphBuilder::Variable var_length(1);
+  MaglevSubGraphBuilder::Variable var_accumulator(2);
 
   MaglevSubGraphBuilder::Label loop_end(&sub_builder, 1);
 
@@ -8892,8 +9049,17 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayIteratingBuiltin(
   // ```
   sub_builder.set(var_index, GetSmiConstant(0));
   sub_builder.set(var_length, original_length);
+  if (accumulator) {
+    GET_VALUE_OR_ABORT(*accumulator, GetTaggedValue(*accumulator));
+    sub_builder.set(var_accumulator, *accumulator);
+  }
   MaglevSubGraphBuilder::LoopLabel loop_header =
-      sub_builder.BeginLoop({&var_index, &var_length});
+      accumulator
+          ? sub_builder.BeginLoop({&var_index, &var_length, &var_accumulator})
+          : sub_builder.BeginLoop({&var_index, &var_length});
+  if (accumulator) {
+    *accumulator = sub_builder.get(var_accumulator);
+  }
 
   // Reset known state that is cleared by BeginLoop, but is known to be true on
   // the first iteration, and will be re-checked at the end of the loop.
@@ -8971,9 +9137,16 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayIteratingBuiltin(
     // ```
     // if (element is hole) goto skip_call
     // ```
-    skip_call.emplace(
-        &sub_builder, 2,
-        std::initializer_list<MaglevSubGraphBuilder::Variable*>{&var_length});
+    if (accumulator) {
+      skip_call.emplace(
+          &sub_builder, 2,
+          std::initializer_list<MaglevSubGraphBuilder::Variable*>{
+              &var_length, &var_accumulator});
+    } else {
+      skip_call.emplace(
+          &sub_builder, 2,
+          std::initializer_list<MaglevSubGraphBuilder::Variable*>{&var_length});
+    }
     if (elements_kind == HOLEY_DOUBLE_ELEMENTS) {
       RETURN_IF_ABORT(sub_builder.GotoIfTrue<BranchIfFloat64IsHole>(&*skip_call,
                                                                     {element}));
@@ -8991,12 +9164,18 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayIteratingBuiltin(
     const LazyDeoptFrameScope& lazy_deopt_scope =
         get_lazy_deopt_scope(target, receiver, callback, this_arg, index_int32,
                              next_index_int32, original_length);
-    CallArguments call_args =
-        args.count() < 2
-            ? CallArguments(ConvertReceiverMode::kNullOrUndefined,
-                            {element, index_tagged, receiver})
-            : CallArguments(ConvertReceiverMode::kAny,
-                            {this_arg, element, index_tagged, receiver});
+    auto make_call_args = [&]() {
+      if (accumulator) {
+        return CallArguments(ConvertReceiverMode::kNullOrUndefined,
+                             {*accumulator, element, index_tagged, receiver});
+      }
+      return args.count() < 2
+                 ? CallArguments(ConvertReceiverMode::kNullOrUndefined,
+                                 {element, index_tagged, receiver})
+                 : CallArguments(ConvertReceiverMode::kAny,
+                                 {this_arg, element, index_tagged, receiver});
+    };
+    CallArguments call_args = make_call_args();
 
     SaveCallSpeculationScope saved(this);
     result = ReduceCall(callback, call_args, saved.value());
@@ -9014,6 +9193,10 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayIteratingBuiltin(
       ValueNode* value = result.value();
       RETURN_IF_ABORT((*process_element_callback)(index_int32, value));
     }
+    if (accumulator) {
+      GET_VALUE_OR_ABORT(*accumulator, GetTaggedValue(result.value()));
+      sub_builder.set(var_accumulator, *accumulator);
+    }
 
     // If any of the receiver's maps were unstable maps, we have to re-check the
     // maps on each iteration, in case the callback changed them. That said, we
@@ -9089,6 +9272,9 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayIteratingBuiltin(
   // bind end
   // ```
   sub_builder.Bind(&loop_end);
+  if (accumulator) {
+    *accumulator = sub_builder.get(var_accumulator);
+  }
 
   return ReduceResult::Done();
 }
@@ -10525,6 +10711,7 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayPrototypePush(
     }
 
     ValueNode* writable_elements_array;
+    MarkArgumentsElementsWritten(elements_array);
     GET_VALUE_OR_ABORT(
         writable_elements_array,
         AddNewNode<MaybeGrowFastElements>(
@@ -10663,6 +10850,7 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayPrototypePop(
     // Handle COW if needed.
     ValueNode* writable_elements_array;
     if (IsSmiOrObjectElementsKind(kind)) {
+      MarkArgumentsElementsWritten(elements_array);
       GET_VALUE_OR_ABORT(
           writable_elements_array,
           AddNewNode<EnsureWritableFastElements>({elements_array, receiver}));
@@ -12223,6 +12411,42 @@ MaglevGraphBuilder::TryGetNonEscapingArgumentsObject(ValueNode* value) {
   return {};
 }
 
+bool MaglevGraphBuilder::CanReadArgumentsElementsFromStack(
+    ValueNode* elements) {
+  ArgumentsElements* arguments_elements =
+      elements->TryCast<ArgumentsElements>();
+  if (arguments_elements == nullptr) return false;
+  // The unmapped part of a mapped backing store does not start at the first
+  // argument.
+  if (arguments_elements->create_arguments_type() ==
+      CreateArgumentsType::kMappedArguments) {
+    return false;
+  }
+  // Writes are recorded as they are built. Outside of loops, that is before
+  // any load that they precede at runtime. Any other code that could write
+  // to the backing store would have made the arguments object escape, in
+  // which case we would not have seen the ArgumentsElements node here.
+  return !arguments_elements->may_be_written() && !IsInsideLoop();
+}
+
+MaybeReduceResult MaglevGraphBuilder::TryBuildLoadStackArgument(
+    ValueNode* elements, ValueNode* index) {
+  if (!CanReadArgumentsElementsFromStack(elements)) return {};
+  ArgumentsElements* arguments_elements = elements->Cast<ArgumentsElements>();
+  int start_index = arguments_elements->create_arguments_type() ==
+                            CreateArgumentsType::kRestParameter
+                        ? arguments_elements->formal_parameter_count()
+                        : 0;
+  return AddNewNode<LoadStackArgument>({index}, start_index);
+}
+
+void MaglevGraphBuilder::MarkArgumentsElementsWritten(ValueNode* elements) {
+  if (ArgumentsElements* arguments_elements =
+          elements->TryCast<ArgumentsElements>()) {
+    arguments_elements->set_may_be_written();
+  }
+}
+
 ReduceResult MaglevGraphBuilder::ReduceCallWithArrayLike(
     ValueNode* target_node, CallArguments& args,
     const compiler::FeedbackSource& feedback_source) {
@@ -922,6 +922,7 @@ class MaglevGraphBuilder {
   V(ArrayIsArray)                              \
   V(ArrayIteratorPrototypeNext)                \
   V(ArrayMap)                                  \
+  V(ArrayReduce)                               \
   V(ArrayPrototypeAt)                          \
   V(ArrayPrototypeEntries)                     \
   V(ArrayPrototypeSlice)                       \
@@ -993,17 +994,22 @@ class MaglevGraphBuilder {
       compiler::JSFunctionRef, ValueNode*, ValueNode*, ValueNode*, ValueNode*,
       ValueNode*, ValueNode*)>;
 
-  // Used for reduding Array.prototype.forEach and Array.prototype.map.
-  // initial_callback will be called to generate code before starting the
-  // iteration, and process_element_callback will be called to generate code for
-  // each result element.
+  // Used for reduding Array.prototype.forEach, Array.prototype.map and
+  // Array.prototype.reduce. initial_callback will be called to generate code
+  // before starting the iteration, and process_element_callback will be called
+  // to generate code for each result element. If accumulator is given, it
+  // holds the initial value and the callback is called with it instead of a
+  // receiver, and its result becomes the next value. It is kept updated to
+  // the current value for the deopt scope callbacks, and holds the final value
+  // after the loop.
   MaybeReduceResult TryReduceArrayIteratingBuiltin(
       const char* name, compiler::JSFunctionRef target, CallArguments& args,
       GetEagerDeoptScopeCallback get_eager_deopt_scope,
       GetLazyDeoptScopeCallback get_lazy_deopt_scope,
       const std::optional<InitialCallback>& initial_callback = {},
       const std::optional<ProcessElementCallback>& process_element_callback =
-          {});
+          {},
+      ValueNode** accumulator = nullptr);
 
   // OOB StringAt access behaves differently for elements (needs the elements
   // protector, positive indices, and returns undefined) and charAt (allows
@@ -1277,6 +1283,8 @@ class MaglevGraphBuilder {
 
   void TryBuildStoreTaggedFieldToAllocation(ValueNode* object, ValueNode* value,
                                             int offset);
+  void TryBuildStoreElementToAllocation(ValueNode* elements, ValueNode* index,
+                                        ValueNode* value);
   ReduceResult BuildLoadTaggedField(ValueNode* object, uint32_t offset,
                                     LoadType type = LoadType::kUnknown,
                                     bool is_const = false,
@@ -1392,6 +1400,10 @@ class MaglevGraphBuilder {
       ValueNode* receiver, ValueNode* lookup_start_object,
       compiler::NameRef name, compiler::PropertyAccessInfo const& access_info,
       compiler::AccessMode access_mode);
+  // Checks if {value} is statically known to be shareable across Isolates, so
+  // that storing it into an object in the shared space doesn't need to go
+  // through the shared value barrier.
+  bool IsKnownSharedValue(ValueNode* value);
   template <typename GenericAccessFunc>
   MaybeReduceResult TryBuildNamedAccess(
       ValueNode* receiver, ValueNode* lookup_start_object,
@@ -1574,6 +1586,15 @@ class MaglevGraphBuilder {
   std::optional<VirtualObject*> TryGetNonEscapingArgumentsObject(
       ValueNode* value);
 
+  // Loads from the backing store of an arguments object or rest parameter
+  // that has not been written to can read the arguments on the stack instead,
+  // which lets the backing store allocation be removed if that was its only
+  // use.
+  bool CanReadArgumentsElementsFromStack(ValueNode* elements);
+  MaybeReduceResult TryBuildLoadStackArgument(ValueNode* elements,
+                                              ValueNode* index);
+  void MarkArgumentsElementsWritten(ValueNode* elements);
+
   MaybeReduceResult TryBuildFastCreateObjectOrArrayLiteral(
       const compiler::LiteralFeedback& feedback);
   std::optional<VirtualObject*> TryReadBoilerplateForFastLiteral(
@@ -1023,6 +1023,12 @@ ProcessResult MaglevGraphOptimizer::VisitRestLength(
   return ProcessResult::kContinue;
 }
 
+ProcessResult MaglevGraphOptimizer::VisitLoadStackArgument(
+    LoadStackArgument* node, const ProcessingState& state) {
+  // TODO(b/424157317): Optimize.
+  return ProcessResult::kContinue;
+}
+
 ProcessResult MaglevGraphOptimizer::VisitCall(Call* node,
                                               const ProcessingState& state) {
   // TODO(b/424157317): Optimize.
@@ -1301,6 +1301,27 @@ void ArgumentsElements::GenerateCode(MaglevAssembler* masm,
   }
 }
 
+void LoadStackArgument::SetValueLocationConstraints() {
+  UseRegister(IndexInput());
+  DefineAsRegister(this);
+  set_temporaries_needed(1);
+}
+
+void LoadStackArgument::GenerateCode(MaglevAssembler* masm,
+                                     const ProcessingState& state) {
+  Register index = ToRegister(IndexInput());
+  MaglevAssembler::TemporaryRegisterScope temps(masm);
+  Register arguments = temps.Acquire();
+  // The arguments follow the receiver above the fixed part of the frame.
+  __ Move(arguments, __ GetFramePointer());
+  __ IncrementAddress(arguments,
+                      CommonFrameConstants::kFixedFrameSizeAboveFp +
+                          (1 + start_index()) * kSystemPointerSize);
+  // Stack slots hold full (uncompressed) tagged values.
+  __ Move(ToRegister(result()),
+          __ TypedArrayElementOperand(arguments, index, kSystemPointerSize));
+}
+
 void AllocateElementsArray::SetValueLocationConstraints() {
   UseAndClobberRegister(LengthInput());
   DefineAsRegister(this);
@@ -4959,6 +4980,14 @@ void GeneratorStore::GenerateCode(MaglevAssembler* masm,
     // inputs.
     register_snapshot_during_store.live_registers.set(value);
     register_snapshot_during_store.live_tagged_registers.set(value);
+    // Dead registers are stored as the OptimizedOut root, and roots and Smi
+    // constants never need a write barrier.
+    if (ValueInput.node()->Is<RootConstant>() ||
+        ValueInput.node()->Is<SmiConstant>()) {
+      __ StoreTaggedFieldNoWriteBarrier(array, FixedArray::OffsetOfElementAt(i),
+                                        value);
+      continue;
+    }
     __ StoreTaggedFieldWithWriteBarrier(
         array, FixedArray::OffsetOfElementAt(i), value,
         register_snapshot_during_store,
@@ -8291,6 +8320,10 @@ void LoadFixedArrayElement::PrintParams(std::ostream& os) const {
   }
 }
 
+void LoadStackArgument::PrintParams(std::ostream& os) const {
+  os << "(" << start_index() << ")";
+}
+
 void StoreFloat64::PrintParams(std::ostream& os) const {
   os << "(0x" << std::hex << offset() << std::dec << ")";
 }
@@ -252,6 +252,7 @@ class ExceptionHandlerInfo;
   V(ArgumentsElements)                                                \
   V(ArgumentsLength)                                                  \
   V(RestLength)                                                       \
+  V(LoadStackArgument)                                                \
   V(Call)                                                             \
   V(CallBuiltin)                                                      \
   V(CallForwardVarargs)                                               \
@@ -705,6 +706,8 @@ constexpr bool CanBeStoreToNonEscapedObject(Opcode opcode) {
     case Opcode::kStoreTaggedFieldNoWriteBarrier:
     case Opcode::kStoreContextSlotWithWriteBarrier:
     case Opcode::kStoreFloat64:
+    case Opcode::kStoreFixedArrayElementWithWriteBarrier:
+    case Opcode::kStoreFixedArrayElementNoWriteBarrier:
       return true;
     default:
       return false;
@@ -6700,9 +6703,41 @@ class ArgumentsElements : public FixedInputValueNodeT<1, ArgumentsElements> {
   CreateArgumentsType create_arguments_type() const { return type_; }
   int formal_parameter_count() const { return formal_parameter_count_; }
 
+  // Whether the graph writes to (or grows) this backing store. Until it does,
+  // its elements are the arguments on the stack.
+  bool may_be_written() const { return may_be_written_; }
+  void set_may_be_written() { may_be_written_ = true; }
+
  private:
   CreateArgumentsType type_;
   int formal_parameter_count_;
+  bool may_be_written_ = false;
+};
+
+// Loads an element of an ArgumentsElements backing store directly from the
+// arguments on the stack, so that the backing store need not be allocated.
+// The index must already be known to be in bounds.
+class LoadStackArgument : public FixedInputValueNodeT<1, LoadStackArgument> {
+ public:
+  explicit LoadStackArgument(uint64_t bitfield, int start_index)
+      : Base(bitfield), start_index_(start_index) {}
+
+  static constexpr OpProperties kProperties = OpProperties::CanRead();
+  DECLARE_INPUTS(Index)
+  DECLARE_INPUT_TYPES(Int32)
+
+  void SetValueLocationConstraints();
+  void GenerateCode(MaglevAssembler*, const ProcessingState&);
+  void PrintParams(std::ostream&) const;
+
+  // The number of arguments skipped, i.e. the formal parameter count for rest
+  // parameters and zero otherwise.
+  int start_index() const { return start_index_; }
+
+  auto options() const { return std::tuple{start_index_}; }
+
+ private:
+  int start_index_;
 };
 
 // TODO(victorgomes): This node is currently not eliminated by the escape
@@ -244,6 +244,16 @@ void NameDictionary::set_flags(uint32_t flags) {
 BIT_FIELD_ACCESSORS(NameDictionary, flags, may_have_interesting_properties,
                     NameDictionary::MayHaveInterestingPropertiesBit)
 
+uint32_t NameDictionary::ShapeFingerprint() {
+  // Adding a property bumps the next enumeration index and deleting one
+  // drops the number of elements, so half of the bits track each.
+  constexpr int kHalfBits = StableShapeFingerprintBits::kSize / 2;
+  constexpr uint32_t kHalfMask = (1u << kHalfBits) - 1;
+  uint32_t added = static_cast<uint32_t>(next_enumeration_index()) & kHalfMask;
+  uint32_t elements = NumberOfElements() & kHalfMask;
+  return added | (elements << kHalfBits);
+}
+
 Tagged<PropertyCell> GlobalDictionary::CellAt(InternalIndex entry) {
   PtrComprCageBase cage_base = GetPtrComprCageBase();
   return CellAt(cage_base, entry);
@@ -303,8 +303,16 @@ class V8_EXPORT_PRIVATE NameDictionary
 
   // Note: Flags are stored as smi, so only 31 bits are usable.
   using MayHaveInterestingPropertiesBit = base::BitField<bool, 0, 1, uint32_t>;
+  // Used by JSObject::MaybePromoteDictionaryToFast to count IC misses on the
+  // owning object during which the dictionary's shape didn't change.
+  using StableShapeFingerprintBits =
+      MayHaveInterestingPropertiesBit::Next<uint32_t, 26>;
+  using StableLookupCountBits = StableShapeFingerprintBits::Next<uint32_t, 4>;
   DECL_BOOLEAN_ACCESSORS(may_have_interesting_properties)
 
+  // Changes whenever a property is added or deleted (modulo wrap-around).
+  inline uint32_t ShapeFingerprint();
+
   static constexpr int kFlagsDefault = 0;
 
   inline uint32_t flags() const;
@@ -4458,6 +4458,19 @@ struct CopyBetweenBackingStoresImpl {
              ArrayBuffer::kMaxByteLength);
     SBXCHECK(ElementsKindToByteSize(Kind) * length <=
              ArrayBuffer::kMaxByteLength);
+    if (is_shared == kUnshared) {
+      // Plain loads and stores, with sharedness decided once for the whole
+      // copy, so that the compiler can vectorize the conversion loop.
+      for (size_t i = 0; i < length; ++i) {
+        auto source_elem =
+            base::ReadUnalignedValue<TypedArrayCType<SourceKind>>(
+                reinterpret_cast<Address>(source_data_ptr + i));
+        base::WriteUnalignedValue(
+            reinterpret_cast<Address>(dest_data_ptr + i),
+            TypedElementsAccessor<Kind>::FromScalar(source_elem));
+      }
+      return;
+    }
     for (; length > 0; --length, ++source_data_ptr, ++dest_data_ptr) {
       // We use scalar accessors to avoid boxing/unboxing, so there are no
       // allocations.
@@ -425,7 +425,8 @@ template <class D, class S, class P>
 constexpr int TaggedArrayBase<D, S, P>::NewCapacityForIndex(int index,
                                                             int old_capacity) {
   DCHECK_GE(index, old_capacity);
-  // Note this is currently based on JSObject::NewElementsCapacity.
+  // Note this is currently based on JSObject::NewElementsCapacity, without
+  // its faster growth of large backing stores.
   int capacity = old_capacity;
   do {
     capacity = capacity + (capacity >> 1) + 16;
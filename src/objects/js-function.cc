@@ -9,6 +9,7 @@
 #include "src/baseline/baseline-batch-compiler.h"
 #include "src/codegen/compiler.h"
 #include "src/common/globals.h"
+#include "src/debug/debug.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate.h"
@@ -16,6 +17,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/ic/ic.h"
 #include "src/init/bootstrapper.h"
+#include "src/interpreter/bytecode-array-iterator.h"
 #include "src/objects/feedback-cell-inl.h"
 #include "src/objects/feedback-vector.h"
 #include "src/strings/string-builder-inl.h"
@@ -689,6 +691,7 @@ void JSFunction::CreateAndAttachFeedbackVector(
   DCHECK(function->raw_feedback_cell() !=
          *isolate->factory()->many_closures_cell());
   DCHECK_EQ(function->raw_feedback_cell()->value(), *feedback_vector);
+  isolate->tiering_manager()->SeedCachedTieringDecision(*feedback_vector);
   function->SetInterruptBudget(isolate, BudgetModification::kRaise);
 
   if (v8_flags.profile_guided_optimization &&
@@ -1312,6 +1315,46 @@ int JSFunction::ComputeInstanceSizeWithMinSlack(Isolate* isolate) {
   return initial_map()->instance_size();
 }
 
+// static
+JSFunction::NumericComparator JSFunction::ClassifyNumericComparator(
+    Isolate* isolate, DirectHandle<JSFunction> function) {
+  Tagged<SharedFunctionInfo> shared = function->shared();
+  if (!shared->HasBytecodeArray() || shared->HasBreakInfo(isolate) ||
+      isolate->debug()->is_active() ||
+      !isolate->is_best_effort_code_coverage()) {
+    return NumericComparator::kNone;
+  }
+  Handle<BytecodeArray> bytecode(shared->GetBytecodeArray(isolate), isolate);
+  if (bytecode->parameter_count_without_receiver() != 2) {
+    return NumericComparator::kNone;
+  }
+
+  // The whole function has to be `Ldar x; Sub y, [slot]; Return`.
+  interpreter::BytecodeArrayIterator it(bytecode);
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kLdar) {
+    return NumericComparator::kNone;
+  }
+  interpreter::Register lhs = it.GetRegisterOperand(0);
+  it.Advance();
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kSub) {
+    return NumericComparator::kNone;
+  }
+  interpreter::Register rhs = it.GetRegisterOperand(0);
+  it.Advance();
+  if (it.done() || it.current_bytecode() != interpreter::Bytecode::kReturn) {
+    return NumericComparator::kNone;
+  }
+  it.Advance();
+  if (!it.done()) return NumericComparator::kNone;
+
+  // The accumulator holds the right-hand side, so `a - b` loads b first.
+  interpreter::Register a = it.GetParameter(0);
+  interpreter::Register b = it.GetParameter(1);
+  if (lhs == b && rhs == a) return NumericComparator::kAscending;
+  if (lhs == a && rhs == b) return NumericComparator::kDescending;
+  return NumericComparator::kNone;
+}
+
 std::unique_ptr<char[]> JSFunction::DebugNameCStr() {
   return shared()->DebugNameCStr();
 }
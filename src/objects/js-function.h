@@ -271,6 +271,14 @@ class JSFunction : public TorqueGeneratedJSFunction<
   // Completes inobject slack tracking on initial map if it is active.
   inline void CompleteInobjectSlackTrackingIfActive(Isolate* isolate);
 
+  // Recognizes the `(a, b) => a - b` and `(a, b) => b - a` sort comparators
+  // from their bytecode, so that sorting numbers with them can skip the calls.
+  // Only returns a match when skipping the calls is unobservable, i.e. no
+  // debugger or precise coverage is active.
+  enum class NumericComparator { kNone, kAscending, kDescending };
+  static NumericComparator ClassifyNumericComparator(
+      Isolate* isolate, DirectHandle<JSFunction> function);
+
   // [raw_feedback_cell]: Gives raw access to the FeedbackCell used to hold the
   /// FeedbackVector eventually. Generally this shouldn't be used to get the
   // feedback_vector, instead use feedback_vector() which correctly deals with
@@ -3903,6 +3903,46 @@ void JSObject::NormalizeProperties(Isolate* isolate,
                          expected_additional_properties);
 }
 
+// static
+void JSObject::MaybePromoteDictionaryToFast(Isolate* isolate,
+                                            DirectHandle<JSObject> object) {
+  // SwissNameDictionary has no spare prefix slot to keep the counts in.
+  if constexpr (V8_ENABLE_SWISS_NAME_DICTIONARY_BOOL) return;
+  if (v8_flags.dictionary_promotion_lookups == 0) return;
+  if (object->HasFastProperties() || IsJSGlobalObject(*object) ||
+      IsJSGlobalProxy(*object)) {
+    return;
+  }
+  Tagged<Map> map = object->map();
+  // Prototypes are handled by MakePrototypesFast, and access checks and
+  // interceptors need the slow map.
+  if (map->is_prototype_map() || map->is_access_check_needed() ||
+      map->has_named_interceptor()) {
+    return;
+  }
+  Tagged<NameDictionary> dictionary = object->property_dictionary();
+  if (dictionary->NumberOfElements() >
+      static_cast<uint32_t>(v8_flags.max_fast_properties)) {
+    return;
+  }
+
+  uint32_t flags = dictionary->flags();
+  uint32_t fingerprint = dictionary->ShapeFingerprint();
+  uint32_t count = 1;
+  if (NameDictionary::StableShapeFingerprintBits::decode(flags) ==
+      fingerprint) {
+    count = NameDictionary::StableLookupCountBits::decode(flags) + 1;
+  }
+  if (count >= static_cast<uint32_t>(v8_flags.dictionary_promotion_lookups)) {
+    MigrateSlowToFast(object, 0, "StableDictionary");
+    return;
+  }
+  flags = NameDictionary::StableShapeFingerprintBits::update(flags,
+                                                             fingerprint);
+  flags = NameDictionary::StableLookupCountBits::update(flags, count);
+  dictionary->set_flags(flags);
+}
+
 void JSObject::MigrateSlowToFast(DirectHandle<JSObject> object,
                                  int unused_property_fields,
                                  const char* reason) {
@@ -660,12 +660,19 @@ class JSObject : public TorqueGeneratedJSObject<JSObject, JSReceiver> {
   bool WouldConvertToSlowElements(uint32_t index);
 
   static const uint32_t kMinAddedElementsCapacity = 16;
+  // Backing stores of at least this capacity live in large object space, where
+  // every growth copies the whole store; they grow by 100% rather than 50%.
+  static const uint32_t kLargeElementsCapacity =
+      kMaxRegularHeapObjectSize / kTaggedSize;
 
   // Computes the new capacity when expanding the elements of a JSObject.
   static constexpr uint32_t NewElementsCapacity(uint32_t old_capacity) {
-    // (old_capacity + 50%) + kMinAddedElementsCapacity
-    uint32_t new_capacity =
-        old_capacity + (old_capacity >> 1) + kMinAddedElementsCapacity;
+    // (old_capacity + 50%) + kMinAddedElementsCapacity, or + 100% for large
+    // backing stores.
+    uint32_t growth = old_capacity >= kLargeElementsCapacity
+                          ? old_capacity
+                          : old_capacity >> 1;
+    uint32_t new_capacity = old_capacity + growth + kMinAddedElementsCapacity;
 
     // If we go past kMaxFixedArrayCapacity, but kMaxFixedArrayCapacity is still
     // more than the old_capacity plus the minimum growth amount, limit the
@@ -772,6 +779,12 @@ class JSObject : public TorqueGeneratedJSObject<JSObject, JSReceiver> {
                                                   int unused_property_fields,
                                                   const char* reason);
 
+  // Called on IC misses on {object}. Migrates dictionary-mode objects back to
+  // fast properties once they missed often enough without any properties
+  // being added or deleted in between (see --dictionary-promotion-lookups).
+  static void MaybePromoteDictionaryToFast(Isolate* isolate,
+                                           DirectHandle<JSObject> object);
+
   // Access property in dictionary mode object at the given dictionary index.
   static Handle<Object> DictionaryPropertyAt(Isolate* isolate,
                                              DirectHandle<JSObject> object,
@@ -18,6 +18,11 @@ namespace v8::internal {
 // This class wraps timezone data, either loaded from ICU4C or static data,
 // to be used with timezone-using temporal_rs APIs
 //
+// The zoneinfo64 rules are not copied: with ICU they are read in place from
+// the memory-mapped ICU data, otherwise from the baked-in static data. The
+// single instance is shared by all isolates of the process, so zone data is
+// only parsed once, on the first Temporal operation that needs a time zone.
+//
 // Users should typically access this via
 // ZoneInfo64Provider::Singleton()
 class ZoneInfo64Provider {
@@ -85,10 +85,12 @@ OrderedHashTable<Derived, entrysize>::EnsureCapacityForAdding(
   if (capacity == 0) {
     // step from empty to minimum proper size
     new_capacity = kInitialCapacity;
-  } else if (nod >= (capacity >> 1)) {
+  } else if (nod >= (capacity >> 2)) {
     // Don't need to grow if we can simply clear out deleted entries instead.
     // Note that we can't compact in place, though, so we always allocate
-    // a new table.
+    // a new table. Compacting as soon as a quarter of the table is deleted
+    // keeps tables with steady churn (e.g. maps used as caches) from doubling,
+    // while the next rehash is still at least capacity / 4 insertions away.
     new_capacity = capacity;
   } else {
     new_capacity = capacity << 1;
@@ -290,6 +292,8 @@ HandleType<Derived>::MaybeType OrderedHashTable<Derived, entrysize>::Rehash(
   int removed_holes_index = 0;
 
   DisallowGarbageCollection no_gc;
+  // The new table was just allocated, so a young one needs no write barriers.
+  WriteBarrierMode mode = new_table->GetWriteBarrierMode(no_gc);
 
   for (InternalIndex old_entry : table->IterateEntries()) {
     int old_entry_raw = old_entry.as_int();
@@ -307,9 +311,9 @@ HandleType<Derived>::MaybeType OrderedHashTable<Derived, entrysize>::Rehash(
     int old_index = table->EntryToIndexRaw(old_entry_raw);
     for (int i = 0; i < entrysize; ++i) {
       Tagged<Object> value = table->get(old_index + i);
-      new_table->set(new_index + i, value);
+      new_table->set(new_index + i, value, mode);
     }
-    new_table->set(new_index + kChainOffset, chain_entry);
+    new_table->set(new_index + kChainOffset, chain_entry, SKIP_WRITE_BARRIER);
     ++new_entry;
   }
 
@@ -663,6 +663,11 @@ class SharedFunctionInfo
   // Indicates that the shared function info was live-edited.
   DECL_BOOLEAN_ACCESSORS(live_edited)
 
+  // Indicates that the function had been run when the snapshot it was
+  // deserialized from was created (see Snapshot::
+  // ClearReconstructableDataForSerialization).
+  DECL_BOOLEAN_ACCESSORS(is_snapshot_hot)
+
   inline FunctionKind kind() const;
 
   int UniqueIdInScript() const;
@@ -5,6 +5,7 @@
 #include "src/objects/string-table.h"
 
 #include <atomic>
+#include <vector>
 
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
@@ -462,41 +463,103 @@ DirectHandle<String> StringTable::LookupKey(IsolateT* isolate,
     base::MutexGuard table_write_guard(&write_mutex_);
 
     Data* data = EnsureCapacity(isolate, 1);
-    OffHeapStringHashSet& table = data->table();
+    return InsertPreparedKey(isolate, data->table(), key, [&]() {
+      return key->GetHandleForInsertion(isolate_);
+    });
+  }
+}
 
-    // Don't allow allocations anymore until the string is internalized.
+template <typename Char, typename IsolateT>
+void StringTable::LookupStrings(
+    IsolateT* isolate, base::Vector<const SequentialStringData<Char>> strings,
+    base::Vector<IndirectHandle<String>> results) {
+  DCHECK_EQ(strings.size(), results.size());
+  // Keys hold direct handles, so they are only ever created on the stack.
+  auto key_at = [&](size_t i) {
+    return SequentialStringKey<Char>(strings[i].raw_hash_field,
+                                     strings[i].chars);
+  };
+
+  // See LookupKey for why the optimistic lookups without the lock are safe.
+  // All lookups happen before the first allocation below, which could allow a
+  // GC to free {current_data} once it was replaced by a resize.
+  std::vector<size_t> missing;
+  {
     DisallowGarbageCollection no_gc;
-    // Allocations above could have turned key into a ThinString in case of
-    // SharedHeap with SharedStrings. If so, we can simply deref it here to find
-    // the internalized string. Otherwise it's not a ThinString and we can
-    // continue inserting.
-    if (key->IsThinString()) {
-      return DirectHandle<String>(key->UnwrapThinString(), isolate);
+    Data* const current_data = data_.load(std::memory_order_acquire);
+    OffHeapStringHashSet& current_table = current_data->table();
+    for (size_t i = 0; i < strings.size(); i++) {
+      SequentialStringKey<Char> key = key_at(i);
+      InternalIndex entry = current_table.FindEntry(isolate, &key, key.hash());
+      if (entry.is_found()) {
+        results[i] = IndirectHandle<String>(
+            Cast<String>(current_table.GetKey(isolate, entry)), isolate);
+      } else {
+        missing.push_back(i);
+      }
     }
+  }
+  if (missing.empty()) return;
 
-    // Check one last time if the key is present in the table, in case it was
-    // added after the check.
-    entry = table.FindEntryOrInsertionEntry(isolate, key, key->hash());
-
-    Tagged<Object> element = table.GetKey(isolate, entry);
-    if (element == OffHeapStringHashSet::empty_element()) {
-      // This entry is empty, so write it and register that we added an
-      // element.
-      DirectHandle<String> new_string = key->GetHandleForInsertion(isolate_);
-      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
-      table.AddAt(isolate, entry, *new_string);
-      return new_string;
-    } else if (element == OffHeapStringHashSet::deleted_element()) {
-      // This entry was deleted, so overwrite it and register that we
-      // overwrote a deleted element.
-      DirectHandle<String> new_string = key->GetHandleForInsertion(isolate_);
-      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
-      table.OverwriteDeletedAt(isolate, entry, *new_string);
-      return new_string;
-    } else {
-      // Return the existing string as a handle.
-      return direct_handle(Cast<String>(element), isolate);
-    }
+  // Allocate the new strings outside of the lock. They are kept in {results}
+  // so that they survive the allocations of the following ones.
+  for (size_t i : missing) {
+    SequentialStringKey<Char> key = key_at(i);
+    key.PrepareForInsertion(isolate);
+    results[i] = indirect_handle(key.GetHandleForInsertion(isolate_), isolate);
+  }
+
+  base::MutexGuard table_write_guard(&write_mutex_);
+  Data* data = EnsureCapacity(isolate, static_cast<int>(missing.size()));
+  for (size_t i : missing) {
+    SequentialStringKey<Char> key = key_at(i);
+    DirectHandle<String> new_string = results[i];
+    results[i] = indirect_handle(
+        InsertPreparedKey(isolate, data->table(), &key,
+                          [new_string]() { return new_string; }),
+        isolate);
+  }
+}
+
+template <typename StringTableKey, typename IsolateT, typename GetNewString>
+DirectHandle<String> StringTable::InsertPreparedKey(
+    IsolateT* isolate, OffHeapStringHashSet& table, StringTableKey* key,
+    GetNewString get_new_string) {
+  write_mutex_.AssertHeld();
+
+  // Don't allow allocations anymore until the string is internalized.
+  DisallowGarbageCollection no_gc;
+  // Allocations above could have turned key into a ThinString in case of
+  // SharedHeap with SharedStrings. If so, we can simply deref it here to find
+  // the internalized string. Otherwise it's not a ThinString and we can
+  // continue inserting.
+  if (key->IsThinString()) {
+    return DirectHandle<String>(key->UnwrapThinString(), isolate);
+  }
+
+  // Check one last time if the key is present in the table, in case it was
+  // added after the check.
+  InternalIndex entry =
+      table.FindEntryOrInsertionEntry(isolate, key, key->hash());
+
+  Tagged<Object> element = table.GetKey(isolate, entry);
+  if (element == OffHeapStringHashSet::empty_element()) {
+    // This entry is empty, so write it and register that we added an
+    // element.
+    DirectHandle<String> new_string = get_new_string();
+    DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
+    table.AddAt(isolate, entry, *new_string);
+    return new_string;
+  } else if (element == OffHeapStringHashSet::deleted_element()) {
+    // This entry was deleted, so overwrite it and register that we
+    // overwrote a deleted element.
+    DirectHandle<String> new_string = get_new_string();
+    DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
+    table.OverwriteDeletedAt(isolate, entry, *new_string);
+    return new_string;
+  } else {
+    // Return the existing string as a handle.
+    return direct_handle(Cast<String>(element), isolate);
   }
 }
 
@@ -519,6 +582,22 @@ template DirectHandle<String> StringTable::LookupKey(
 template DirectHandle<String> StringTable::LookupKey(
     LocalIsolate* isolate, StringTableInsertionKey* key);
 
+template void StringTable::LookupStrings(
+    Isolate* isolate, base::Vector<const SequentialStringData<uint8_t>> strings,
+    base::Vector<IndirectHandle<String>> results);
+template void StringTable::LookupStrings(
+    Isolate* isolate,
+    base::Vector<const SequentialStringData<uint16_t>> strings,
+    base::Vector<IndirectHandle<String>> results);
+template void StringTable::LookupStrings(
+    LocalIsolate* isolate,
+    base::Vector<const SequentialStringData<uint8_t>> strings,
+    base::Vector<IndirectHandle<String>> results);
+template void StringTable::LookupStrings(
+    LocalIsolate* isolate,
+    base::Vector<const SequentialStringData<uint16_t>> strings,
+    base::Vector<IndirectHandle<String>> results);
+
 StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
                                                int additional_elements) {
   // This call is only allowed while the write mutex is held.
@@ -69,6 +69,24 @@ class V8_EXPORT_PRIVATE StringTable {
   template <typename StringTableKey, typename IsolateT>
   DirectHandle<String> LookupKey(IsolateT* isolate, StringTableKey* key);
 
+  // The raw hash field and characters of a string to look up with
+  // LookupStrings.
+  template <typename Char>
+  struct SequentialStringData {
+    uint32_t raw_hash_field;
+    base::Vector<const Char> chars;
+  };
+
+  // Like LookupKey with a SequentialStringKey, for many strings at once. All
+  // strings missing from the table are added under a single acquisition of
+  // the write lock, so that threads internalizing many strings concurrently
+  // (e.g. when finalizing parallel compile tasks) don't contend on it for
+  // every string. {results} must have the same length as {strings}.
+  template <typename Char, typename IsolateT>
+  void LookupStrings(IsolateT* isolate,
+                     base::Vector<const SequentialStringData<Char>> strings,
+                     base::Vector<IndirectHandle<String>> results);
+
   // {raw_string} must be a tagged String pointer.
   // Returns a tagged pointer: either a Smi if the string is an array index, an
   // internalized string, or a Smi sentinel.
@@ -99,6 +117,15 @@ class V8_EXPORT_PRIVATE StringTable {
 
   Data* EnsureCapacity(PtrComprCageBase cage_base, int additional_elements);
 
+  // Adds the string for the prepared {key}, as returned by {get_new_string},
+  // to {table}, or returns the string that is already there. Must be called
+  // while holding the write lock.
+  template <typename StringTableKey, typename IsolateT, typename GetNewString>
+  DirectHandle<String> InsertPreparedKey(IsolateT* isolate,
+                                         OffHeapStringHashSet& table,
+                                         StringTableKey* key,
+                                         GetNewString get_new_string);
+
   std::atomic<Data*> data_;
   // Write mutex is mutable so that readers of concurrently mutated values (e.g.
   // NumberOfElements) are allowed to lock it while staying const.
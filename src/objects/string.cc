@@ -1053,6 +1053,120 @@ V8_INLINE void WriteToFlat2Impl(SinkCharT*& rdst, wtf_stack_top_t& top,
   }
 }
 
+bool IsLongRope(Tagged<String> string) {
+  return IsConsString(string) && !string->IsFlat() &&
+         string->length() >= String::kMinUnflattenedScanLength;
+}
+
+// Deep ropes, like the ones built by appending single characters, make
+// ConsStringIterator restart from the root over and over. Flattening them is
+// cheaper than walking them.
+constexpr int kMaxVisitedRopeSegments = 2048;
+
+// Calls {visit} with the characters of each segment of {rope}, starting at
+// {start}, until it returns false. Returns false if {rope} has too many
+// segments, in which case the caller should flatten it instead.
+template <typename Visitor>
+bool VisitRopeSegments(Tagged<ConsString> rope, uint32_t start,
+                       const DisallowGarbageCollection& no_gc,
+                       Visitor&& visit) {
+  ConsStringIterator iter(rope, static_cast<int>(start));
+  int offset;
+  int segments = 0;
+  for (Tagged<String> segment = iter.Next(&offset); !segment.is_null();
+       segment = iter.Next(&offset)) {
+    if (++segments > kMaxVisitedRopeSegments) return false;
+    String::FlatContent content = segment->GetFlatContent(no_gc);
+    bool more = content.IsOneByte()
+                    ? visit(content.ToOneByteVector().SubVectorFrom(offset))
+                    : visit(content.ToUC16Vector().SubVectorFrom(offset));
+    if (!more) break;
+  }
+  return true;
+}
+
+template <typename PatternChar>
+std::optional<int> SearchRope(Isolate* isolate, Tagged<ConsString> rope,
+                              base::Vector<const PatternChar> pattern,
+                              uint32_t start_index,
+                              const DisallowGarbageCollection& no_gc) {
+  // Matches that span segment boundaries are found in a window made of the
+  // last {overlap} characters before a segment and the first ones in it.
+  const size_t overlap = pattern.size() - 1;
+  std::vector<base::uc16> carry;
+  std::vector<base::uc16> window;
+  uint32_t position = start_index;
+  int result = -1;
+  bool completed = VisitRopeSegments(rope, start_index, no_gc, [&](auto chars) {
+    if (!carry.empty()) {
+      size_t head = std::min(overlap, chars.size());
+      window.assign(carry.begin(), carry.end());
+      window.insert(window.end(), chars.begin(), chars.begin() + head);
+      if (window.size() >= pattern.size()) {
+        base::Vector<const base::uc16> window_chars(window.data(),
+                                                    window.size());
+        int index = SearchString(isolate, window_chars, pattern, 0);
+        if (index >= 0 && static_cast<size_t>(index) < carry.size()) {
+          result = static_cast<int>(position - carry.size()) + index;
+          return false;
+        }
+      }
+    }
+    if (chars.size() >= pattern.size()) {
+      int index = SearchString(isolate, chars, pattern, 0);
+      if (index >= 0) {
+        result = static_cast<int>(position) + index;
+        return false;
+      }
+    }
+    position += static_cast<uint32_t>(chars.size());
+    if (chars.size() >= overlap) {
+      carry.assign(chars.end() - overlap, chars.end());
+    } else {
+      carry.insert(carry.end(), chars.begin(), chars.end());
+      if (carry.size() > overlap) {
+        carry.erase(carry.begin(), carry.end() - overlap);
+      }
+    }
+    return true;
+  });
+  if (!completed) return {};
+  return result;
+}
+
+template <typename PatternChar>
+std::optional<bool> RopeRegionEquals(Tagged<ConsString> rope, uint32_t start,
+                                     base::Vector<const PatternChar> pattern,
+                                     const DisallowGarbageCollection& no_gc) {
+  size_t matched = 0;
+  bool equal = true;
+  bool completed = VisitRopeSegments(rope, start, no_gc, [&](auto chars) {
+    size_t count = std::min(chars.size(), pattern.size() - matched);
+    if (!CompareCharsEqual(chars.begin(), pattern.begin() + matched, count)) {
+      equal = false;
+      return false;
+    }
+    matched += count;
+    return matched < pattern.size();
+  });
+  if (!completed) return {};
+  DCHECK_IMPLIES(equal, matched == pattern.size());
+  return equal;
+}
+
+// Returns whether {rope} starts with {search} at {start}, or nothing if
+// {rope} has to be flattened for that.
+std::optional<bool> RopeRegionEquals(Tagged<ConsString> rope, uint32_t start,
+                                     Tagged<String> search,
+                                     const DisallowGarbageCollection& no_gc) {
+  String::FlatContent search_content = search->GetFlatContent(no_gc);
+  if (search_content.IsOneByte()) {
+    return RopeRegionEquals(rope, start, search_content.ToOneByteVector(),
+                            no_gc);
+  }
+  return RopeRegionEquals(rope, start, search_content.ToUC16Vector(), no_gc);
+}
+
 }  // namespace
 
 // static
@@ -1348,6 +1462,17 @@ bool String::SlowEquals(Isolate* isolate, DirectHandle<String> one,
     if (one_hash != two_hash) return false;
   }
 
+  // Walk a long rope segment by segment rather than copying it. If both
+  // strings are ropes, only the second one is flattened.
+  if (!IsLongRope(*one)) std::swap(one, two);
+  if (IsLongRope(*one)) {
+    two = String::Flatten(isolate, two);
+    DisallowGarbageCollection no_gc;
+    std::optional<bool> result =
+        RopeRegionEquals(Cast<ConsString>(*one), 0, *two, no_gc);
+    if (result.has_value()) return *result;
+  }
+
   one = String::Flatten(isolate, one);
   two = String::Flatten(isolate, two);
 
@@ -1495,8 +1620,20 @@ int String::IndexOf(Isolate* isolate, DirectHandle<String> receiver,
   uint32_t receiver_length = receiver->length();
   if (start_index + search_length > receiver_length) return -1;
 
-  receiver = String::Flatten(isolate, receiver);
   search = String::Flatten(isolate, search);
+  if (IsLongRope(*receiver)) {
+    DisallowGarbageCollection no_gc;
+    Tagged<ConsString> rope = Cast<ConsString>(*receiver);
+    String::FlatContent search_content = search->GetFlatContent(no_gc);
+    std::optional<int> result =
+        search_content.IsOneByte()
+            ? SearchRope(isolate, rope, search_content.ToOneByteVector(),
+                         start_index, no_gc)
+            : SearchRope(isolate, rope, search_content.ToUC16Vector(),
+                         start_index, no_gc);
+    if (result.has_value()) return *result;
+  }
+  receiver = String::Flatten(isolate, receiver);
 
   DisallowGarbageCollection no_gc;  // ensure vectors stay valid
   // Extract flattened substrings of cons strings before getting encoding.
@@ -1514,6 +1651,41 @@ int String::IndexOf(Isolate* isolate, DirectHandle<String> receiver,
                                         start_index);
 }
 
+// static
+bool String::IsSubstringAt(Isolate* isolate, DirectHandle<String> string,
+                           DirectHandle<String> search, uint32_t start) {
+  DCHECK_LE(start + search->length(), string->length());
+  if (search->length() == 0) return true;
+  search = String::Flatten(isolate, search);
+  if (IsLongRope(*string)) {
+    DisallowGarbageCollection no_gc;
+    std::optional<bool> result =
+        RopeRegionEquals(Cast<ConsString>(*string), start, *search, no_gc);
+    if (result.has_value()) return *result;
+  }
+  string = String::Flatten(isolate, string);
+
+  DisallowGarbageCollection no_gc;
+  String::FlatContent search_content = search->GetFlatContent(no_gc);
+  String::FlatContent content = string->GetFlatContent(no_gc);
+  uint32_t length = search->length();
+  if (content.IsOneByte()) {
+    const uint8_t* chars = content.ToOneByteVector().begin() + start;
+    return search_content.IsOneByte()
+               ? CompareCharsEqual(
+                     chars, search_content.ToOneByteVector().begin(), length)
+               : CompareCharsEqual(chars, search_content.ToUC16Vector().begin(),
+                                   length);
+  }
+  const base::uc16* chars = content.ToUC16Vector().begin() + start;
+  return search_content.IsOneByte()
+             ? CompareCharsEqual(chars,
+                                 search_content.ToOneByteVector().begin(),
+                                 length)
+             : CompareCharsEqual(chars, search_content.ToUC16Vector().begin(),
+                                 length);
+}
+
 MaybeDirectHandle<String> String::GetSubstitution(
     Isolate* isolate, Match* match, DirectHandle<String> replacement,
     uint32_t start_index) {
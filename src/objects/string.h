@@ -352,6 +352,10 @@ V8_OBJECT class String : public Name {
   // check any arguments.
   static int IndexOf(Isolate* isolate, DirectHandle<String> receiver,
                      DirectHandle<String> search, uint32_t start_index);
+  // Returns whether {search} occurs in {string} at {start}. Caller must ensure
+  // that start + search->length() <= string->length().
+  static bool IsSubstringAt(Isolate* isolate, DirectHandle<String> string,
+                            DirectHandle<String> search, uint32_t start);
 
   static Tagged<Object> LastIndexOf(Isolate* isolate,
                                     DirectHandle<Object> receiver,
@@ -531,6 +535,11 @@ V8_OBJECT class String : public Name {
   // Limit for truncation in short printing.
   static const uint32_t kMaxShortPrintLength = 1024;
 
+  // Ropes of at least this length are searched and compared segment by
+  // segment instead of being flattened first, since flattening copies the
+  // whole string.
+  static const uint32_t kMinUnflattenedScanLength = 64 * KB;
+
   // Helper function for flattening strings.
   template <typename SinkCharT>
   EXPORT_TEMPLATE_DECLARE(V8_EXPORT_PRIVATE)
@@ -4,6 +4,8 @@
 
 #include "src/objects/template-objects.h"
 
+#include <utility>
+
 #include "src/base/hashing.h"
 #include "src/execution/isolate.h"
 #include "src/heap/factory.h"
@@ -16,16 +18,20 @@ namespace v8 {
 namespace internal {
 
 namespace {
-bool CachedTemplateMatches(Isolate* isolate,
-                           Tagged<NativeContext> native_context,
-                           Tagged<JSArray> entry, int function_literal_id,
-                           int slot_id, DisallowGarbageCollection& no_gc) {
+
+// Template objects are cached per script, in a list sorted by this key.
+using TemplateKey = std::pair<int, int>;
+
+TemplateKey CachedTemplateKey(Isolate* isolate,
+                              Tagged<NativeContext> native_context,
+                              Tagged<JSArray> entry,
+                              DisallowGarbageCollection& no_gc) {
   if (native_context->is_js_array_template_literal_object_map(
           entry->map(isolate))) {
     Tagged<TemplateLiteralObject> template_object =
         Cast<TemplateLiteralObject>(entry);
-    return template_object->function_literal_id() == function_literal_id &&
-           template_object->slot_id() == slot_id;
+    return {template_object->function_literal_id(),
+            template_object->slot_id()};
   }
 
   DirectHandle<JSArray> entry_handle(entry, isolate);
@@ -33,15 +39,31 @@ bool CachedTemplateMatches(Isolate* isolate,
       Cast<Smi>(*JSReceiver::GetDataProperty(
           isolate, entry_handle,
           isolate->factory()->template_literal_function_literal_id_symbol()));
-  if (cached_function_literal_id.value() != function_literal_id) return false;
-
   Tagged<Smi> cached_slot_id = Cast<Smi>(*JSReceiver::GetDataProperty(
       isolate, entry_handle,
       isolate->factory()->template_literal_slot_id_symbol()));
-  if (cached_slot_id.value() != slot_id) return false;
+  return {cached_function_literal_id.value(), cached_slot_id.value()};
+}
 
-  return true;
+// Returns the index of the first entry of |cached_templates| whose key is not
+// less than |key|.
+int LowerBound(Isolate* isolate, Tagged<NativeContext> native_context,
+               Tagged<ArrayList> cached_templates, TemplateKey key,
+               DisallowGarbageCollection& no_gc) {
+  int low = 0;
+  int high = cached_templates->length();
+  while (low < high) {
+    int mid = low + (high - low) / 2;
+    Tagged<JSArray> entry = Cast<JSArray>(cached_templates->get(mid));
+    if (CachedTemplateKey(isolate, native_context, entry, no_gc) < key) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return low;
 }
+
 }  // namespace
 
 // static
@@ -57,6 +79,8 @@ DirectHandle<JSArray> TemplateObjectDescription::GetTemplateObject(
   int32_t hash =
       EphemeronHashTable::TodoShape::Hash(ReadOnlyRoots(isolate), script);
   MaybeDirectHandle<ArrayList> maybe_cached_templates;
+  const TemplateKey key{function_literal_id, slot_id};
+  int insert_index = 0;
 
   if (!IsUndefined(native_context->template_weakmap(), isolate)) {
     DisallowGarbageCollection no_gc;
@@ -73,14 +97,17 @@ DirectHandle<JSArray> TemplateObjectDescription::GetTemplateObject(
           Cast<ArrayList>(cached_templates_lookup);
       maybe_cached_templates = direct_handle(cached_templates, isolate);
 
-      // Linear search over the cached template array list for a template
-      // object matching the given function_literal_id + slot_id.
-      // TODO(leszeks): Consider keeping this list sorted for faster lookup.
-      for (int i = 0; i < cached_templates->length(); i++) {
+      // Binary search over the cached template array list for a template
+      // object matching the given function_literal_id + slot_id. Scripts
+      // that are instantiated in many contexts look up every one of their
+      // templates once per context, so this must not be linear.
+      insert_index = LowerBound(isolate, *native_context, cached_templates,
+                                key, no_gc);
+      if (insert_index < cached_templates->length()) {
         Tagged<JSArray> template_object =
-            Cast<JSArray>(cached_templates->get(i));
-        if (CachedTemplateMatches(isolate, *native_context, template_object,
-                                  function_literal_id, slot_id, no_gc)) {
+            Cast<JSArray>(cached_templates->get(insert_index));
+        if (CachedTemplateKey(isolate, *native_context, template_object,
+                              no_gc) == key) {
           return direct_handle(template_object, isolate);
         }
       }
@@ -101,6 +128,15 @@ DirectHandle<JSArray> TemplateObjectDescription::GetTemplateObject(
     cached_templates = isolate->factory()->NewArrayList(1);
   }
   cached_templates = ArrayList::Add(isolate, cached_templates, template_object);
+  {
+    // Move the new template object to its sorted position.
+    DisallowGarbageCollection no_gc;
+    Tagged<ArrayList> raw_cached_templates = *cached_templates;
+    for (int i = raw_cached_templates->length() - 1; i > insert_index; i--) {
+      raw_cached_templates->set(i, raw_cached_templates->get(i - 1));
+    }
+    raw_cached_templates->set(insert_index, *template_object);
+  }
 
   // Compare the cached_templates to the original maybe_cached_templates loaded
   // from the weakmap -- if it doesn't match, we need to update the weakmap.
@@ -126,8 +162,7 @@ DirectHandle<JSArray> TemplateObjectDescription::GetTemplateObject(
   DCHECK_EQ(Cast<EphemeronHashTable>(native_context->template_weakmap())
                 ->Lookup(isolate, script, hash),
             *cached_templates);
-  DCHECK_EQ(cached_templates->get(cached_templates->length() - 1),
-            *template_object);
+  DCHECK_EQ(cached_templates->get(insert_index), *template_object);
 
   return template_object;
 }
@@ -186,6 +186,9 @@ enum class SerializationTag : uint8_t {
   kResizableArrayBuffer = '~',
   // Array buffer (transferred). transferID:uint32_t
   kArrayBufferTransfer = 't',
+  // Array buffer whose backing store is passed out of band.
+  // backingStoreID:uint32_t, byteLength:uint32_t
+  kArrayBufferReference = '&',
   // View into an array buffer.
   // subtag:ArrayBufferViewTag, byteOffset:uint32_t, byteLength:uint32_t
   // For typed arrays, byteOffset and byteLength must be divisible by the size
@@ -325,6 +328,12 @@ void ValueSerializer::SetTreatArrayBufferViewsAsHostObjects(bool mode) {
   treat_array_buffer_views_as_host_objects_ = mode;
 }
 
+void ValueSerializer::SetBackingStoreReferenceThreshold(
+    size_t min_byte_length) {
+  DCHECK_NOT_NULL(delegate_);
+  backing_store_reference_threshold_ = min_byte_length;
+}
+
 void ValueSerializer::WriteTag(SerializationTag tag) {
   uint8_t raw_tag = static_cast<uint8_t>(tag);
   WriteRawBytes(&raw_tag, sizeof(raw_tag));
@@ -1063,6 +1072,21 @@ Maybe<bool> ValueSerializer::WriteJSArrayBuffer(
     WriteRawBytes(array_buffer->backing_store(), byte_length);
     return ThrowIfOutOfMemory();
   }
+  if (byte_length >= backing_store_reference_threshold_ && delegate_) {
+    std::shared_ptr<BackingStore> backing_store =
+        array_buffer->GetBackingStore();
+    if (backing_store) {
+      Maybe<uint32_t> id = delegate_->GetBackingStoreId(
+          reinterpret_cast<v8::Isolate*>(isolate_),
+          std::static_pointer_cast<v8::BackingStore>(backing_store));
+      RETURN_VALUE_IF_EXCEPTION(isolate_, Nothing<bool>());
+
+      WriteTag(SerializationTag::kArrayBufferReference);
+      WriteVarint(id.FromJust());
+      WriteVarint<uint32_t>(static_cast<uint32_t>(byte_length));
+      return ThrowIfOutOfMemory();
+    }
+  }
   WriteTag(SerializationTag::kArrayBuffer);
   WriteVarint<uint32_t>(static_cast<uint32_t>(byte_length));
   WriteRawBytes(array_buffer->backing_store(), byte_length);
@@ -1726,6 +1750,8 @@ MaybeDirectHandle<Object> ValueDeserializer::ReadObjectInternal() {
     case SerializationTag::kArrayBufferTransfer: {
       return ReadTransferredJSArrayBuffer();
     }
+    case SerializationTag::kArrayBufferReference:
+      return ReadJSArrayBufferReference();
     case SerializationTag::kSharedArrayBuffer: {
       constexpr bool is_shared = true;
       constexpr bool is_resizable = false;
@@ -2224,6 +2250,33 @@ ValueDeserializer::ReadTransferredJSArrayBuffer() {
   return array_buffer;
 }
 
+MaybeDirectHandle<JSArrayBuffer>
+ValueDeserializer::ReadJSArrayBufferReference() {
+  uint32_t id = next_id_++;
+  uint32_t backing_store_id;
+  uint32_t byte_length;
+  if (!ReadVarint<uint32_t>().To(&backing_store_id) ||
+      !ReadVarint<uint32_t>().To(&byte_length) || delegate_ == nullptr) {
+    return MaybeDirectHandle<JSArrayBuffer>();
+  }
+  std::shared_ptr<v8::BackingStore> backing_store =
+      delegate_->GetBackingStoreFromId(reinterpret_cast<v8::Isolate*>(isolate_),
+                                       backing_store_id);
+  RETURN_EXCEPTION_IF_EXCEPTION(isolate_);
+  // The buffer adopts the backing store, so it has to match what was
+  // serialized.
+  if (!backing_store || backing_store->IsShared() ||
+      backing_store->IsResizableByUserJavaScript() ||
+      backing_store->ByteLength() != byte_length) {
+    return MaybeDirectHandle<JSArrayBuffer>();
+  }
+  DirectHandle<JSArrayBuffer> array_buffer =
+      isolate_->factory()->NewJSArrayBuffer(
+          std::static_pointer_cast<BackingStore>(std::move(backing_store)));
+  AddObjectWithID(id, array_buffer);
+  return array_buffer;
+}
+
 MaybeDirectHandle<JSArrayBufferView> ValueDeserializer::ReadJSArrayBufferView(
     DirectHandle<JSArrayBuffer> buffer) {
   uint32_t buffer_byte_length = static_cast<uint32_t>(buffer->GetByteLength());
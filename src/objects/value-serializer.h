@@ -6,6 +6,7 @@
 #define V8_OBJECTS_VALUE_SERIALIZER_H_
 
 #include <cstdint>
+#include <limits>
 
 #include "include/v8-value-serializer.h"
 #include "src/base/compiler-specific.h"
@@ -97,6 +98,13 @@ class ValueSerializer {
    */
   void SetTreatArrayBufferViewsAsHostObjects(bool mode);
 
+  /*
+   * Serialize non-resizable ArrayBuffers of at least |min_byte_length| bytes
+   * by passing their backing store to Delegate::GetBackingStoreId instead of
+   * copying their contents. Requires a Delegate.
+   */
+  void SetBackingStoreReferenceThreshold(size_t min_byte_length);
+
  private:
   // Managing allocations of the internal buffer.
   Maybe<bool> ExpandBuffer(size_t required_capacity);
@@ -181,6 +189,8 @@ class ValueSerializer {
   bool has_custom_host_objects_ = false;
   bool treat_array_buffer_views_as_host_objects_ = false;
   bool out_of_memory_ = false;
+  size_t backing_store_reference_threshold_ =
+      std::numeric_limits<size_t>::max();
   Zone zone_;
 
   // To avoid extra lookups in the identity map, ID+1 is actually stored in the
@@ -302,6 +312,8 @@ class ValueDeserializer {
       bool is_shared, bool is_resizable) V8_WARN_UNUSED_RESULT;
   MaybeDirectHandle<JSArrayBuffer> ReadTransferredJSArrayBuffer()
       V8_WARN_UNUSED_RESULT;
+  MaybeDirectHandle<JSArrayBuffer> ReadJSArrayBufferReference()
+      V8_WARN_UNUSED_RESULT;
   MaybeDirectHandle<JSArrayBufferView> ReadJSArrayBufferView(
       DirectHandle<JSArrayBuffer> buffer) V8_WARN_UNUSED_RESULT;
   bool ValidateJSArrayBufferViewFlags(
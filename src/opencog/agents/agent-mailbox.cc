@@ -0,0 +1,103 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/agent-mailbox.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <utility>
+
+namespace v8 {
+namespace opencog {
+
+AgentMailbox::AgentMailbox(size_t capacity, OverflowPolicy policy)
+    : policy_(policy),
+      mask_(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1),
+      slots_(new Slot[mask_ + 1]) {
+  for (size_t i = 0; i <= mask_; ++i) {
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+bool AgentMailbox::TryPush(const AgentMessage& message) {
+  size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+  while (true) {
+    Slot& slot = slots_[pos & mask_];
+    size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    intptr_t diff =
+        static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+    if (diff == 0) {
+      if (enqueue_pos_.compare_exchange_weak(pos, pos + 1)) {
+        slot.message = message;
+        slot.sequence.store(pos + 1, std::memory_order_release);
+        return true;
+      }
+      // |pos| was reloaded by the failed exchange.
+    } else if (diff < 0) {
+      return false;  // The slot still holds last lap's message: full.
+    } else {
+      pos = enqueue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+bool AgentMailbox::TryPop(AgentMessage* message) {
+  size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+  while (true) {
+    Slot& slot = slots_[pos & mask_];
+    size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    intptr_t diff =
+        static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+    if (diff == 0) {
+      if (dequeue_pos_.compare_exchange_weak(pos, pos + 1)) {
+        *message = std::move(slot.message);
+        slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+        break;
+      }
+    } else if (diff < 0) {
+      return false;  // Empty.
+    } else {
+      pos = dequeue_pos_.load(std::memory_order_relaxed);
+    }
+  }
+
+  // Pairs with the blocked_producers_ increment in Push(): either this load
+  // sees the waiter, or the waiter sees the freed slot before it sleeps.
+  if (blocked_producers_.load() > 0) {
+    std::lock_guard<std::mutex> lock(space_mutex_);
+    space_cv_.notify_all();
+  }
+  return true;
+}
+
+AgentMailbox::PushResult AgentMailbox::Push(const AgentMessage& message,
+                                            bool may_block) {
+  if (TryPush(message)) return PushResult::kDelivered;
+
+  switch (policy_) {
+    case OverflowPolicy::kDropOldest: {
+      AgentMessage evicted;
+      do {
+        TryPop(&evicted);
+      } while (!TryPush(message));
+      return PushResult::kDeliveredAfterDrop;
+    }
+    case OverflowPolicy::kBlock:
+      if (!may_block) return PushResult::kRejected;
+      while (!TryPush(message)) {
+        std::unique_lock<std::mutex> lock(space_mutex_);
+        blocked_producers_.fetch_add(1);
+        space_cv_.wait(lock, [this]() { return !IsFull(); });
+        blocked_producers_.fetch_sub(1);
+      }
+      return PushResult::kDelivered;
+    case OverflowPolicy::kReject:
+      return PushResult::kRejected;
+  }
+  return PushResult::kRejected;
+}
+
+}  // namespace opencog
+}  // namespace v8
@@ -6,12 +6,40 @@
 
 #include <algorithm>
 #include <chrono>
+#include <functional>
 #include <thread>
 
+#include "src/tracing/trace-event.h"
+
 namespace v8 {
 namespace opencog {
 
-AgentOrchestrator::AgentOrchestrator() : running_(false) {}
+namespace {
+
+// The orchestrator whose activation the current thread is running, if any.
+// Sends from inside agent callbacks never block on a full mailbox: the thread
+// that would drain it may be this one.
+thread_local const AgentOrchestrator* current_orchestrator = nullptr;
+
+// Trace counter of the agents waiting for a thread, sampled whenever one is
+// queued or taken. Callers hold the ready lock.
+void TraceReadyAgents(const AgentScheduler& scheduler) {
+  TRACE_COUNTER1("opencog", "AgentOrchestrator.ReadyAgents", scheduler.size());
+}
+
+// Trace counter of |agent|'s queued messages, one track per agent.
+void TraceMailboxDepth(const Agent* agent, const AgentMailbox& mailbox) {
+  TRACE_COUNTER_ID1("opencog", "AgentMailbox.Depth", agent, mailbox.size());
+}
+
+}  // namespace
+
+AgentOrchestrator::AgentOrchestrator() : AgentOrchestrator(Options()) {}
+
+AgentOrchestrator::AgentOrchestrator(const Options& options)
+    : options_(options),
+      running_(false),
+      scheduler_(options.starvation_threshold) {}
 
 AgentOrchestrator::~AgentOrchestrator() {
   Stop();
@@ -20,143 +48,421 @@ AgentOrchestrator::~AgentOrchestrator() {
 bool AgentOrchestrator::RegisterAgent(std::shared_ptr<Agent> agent) {
   if (!agent) return false;
 
-  std::lock_guard<std::mutex> lock(agents_mutex_);
-  
-  if (agents_.find(agent->agent_id()) != agents_.end()) {
-    return false; // Agent already registered
-  }
-
-  agent->set_orchestrator(this);
-  agents_[agent->agent_id()] = agent;
+  bool inserted = agents_.Insert(agent, [this](Agent* agent) {
+    agent->set_orchestrator(this);
+    agent->mailbox_ = std::make_unique<AgentMailbox>(
+        options_.mailbox_capacity, options_.overflow_policy);
+  });
+  if (!inserted) return false;  // Agent already registered
   return agent->Initialize();
 }
 
 bool AgentOrchestrator::UnregisterAgent(const std::string& agent_id) {
-  std::lock_guard<std::mutex> lock(agents_mutex_);
-  
-  auto it = agents_.find(agent_id);
-  if (it == agents_.end()) return false;
+  InternedName agent_name;
+  if (!InternedName::Find(agent_id, &agent_name)) return false;
+  std::shared_ptr<Agent> agent = agents_.Remove(agent_name);
+  if (!agent) return false;
+  agent->Shutdown();
 
-  it->second->Shutdown();
-  agents_.erase(it);
+  std::unique_lock<std::shared_mutex> topics_lock(topics_mutex_);
+  for (auto topic = topics_.begin(); topic != topics_.end();) {
+    const SubscriberList& subscribers = *topic->second;
+    if (std::none_of(subscribers.begin(), subscribers.end(),
+                     [&agent_name](const std::shared_ptr<Agent>& agent) {
+                       return agent->agent_name() == agent_name;
+                     })) {
+      ++topic;
+      continue;
+    }
+    auto updated = std::make_shared<SubscriberList>();
+    for (const auto& agent : subscribers) {
+      if (agent->agent_name() != agent_name) updated->push_back(agent);
+    }
+    if (updated->empty()) {
+      topic = topics_.erase(topic);
+    } else {
+      topic->second = std::move(updated);
+      ++topic;
+    }
+  }
   return true;
 }
 
 std::shared_ptr<Agent> AgentOrchestrator::GetAgent(
     const std::string& agent_id) const {
-  std::lock_guard<std::mutex> lock(agents_mutex_);
-  auto it = agents_.find(agent_id);
-  return (it != agents_.end()) ? it->second : nullptr;
+  InternedName agent_name;
+  if (!InternedName::Find(agent_id, &agent_name)) return nullptr;
+  return agents_.Find(agent_name);
 }
 
 std::vector<std::shared_ptr<Agent>> AgentOrchestrator::GetAgentsByTenant(
     const std::string& tenant_id) const {
-  std::lock_guard<std::mutex> lock(agents_mutex_);
-  std::vector<std::shared_ptr<Agent>> result;
-  
-  for (const auto& pair : agents_) {
-    if (pair.second->tenant_id() == tenant_id) {
-      result.push_back(pair.second);
-    }
-  }
-  
-  return result;
+  return agents_.GetByTenant(tenant_id);
 }
 
 void AgentOrchestrator::Start() {
-  if (running_) return;
-  
-  running_ = true;
-  orchestrator_thread_ = std::thread(&AgentOrchestrator::OrchestratorLoop, this);
+  if (running_.exchange(true)) return;
+  timer_thread_ = std::thread(&AgentOrchestrator::TimerLoop, this);
+
+  if (options_.worker_threads == 0) {
+    orchestrator_thread_ =
+        std::thread(&AgentOrchestrator::OrchestratorLoop, this);
+    return;
+  }
+
+  std::unique_lock<std::shared_mutex> dispatch_lock(dispatch_mutex_);
+  executor_ = std::make_unique<WorkStealingExecutor>(options_.worker_threads);
+  size_t parked;
+  {
+    std::lock_guard<std::mutex> lock(ready_mutex_);
+    parked = scheduler_.size();
+  }
+  // Hand over activations parked before Start().
+  for (size_t i = 0; i < parked; ++i) {
+    executor_->Submit([this]() { RunNextActivation(); });
+  }
+  direct_dispatch_ = true;
 }
 
 void AgentOrchestrator::Stop() {
-  if (!running_) return;
-  
-  running_ = false;
+  if (options_.worker_threads > 0) {
+    {
+      std::unique_lock<std::shared_mutex> dispatch_lock(dispatch_mutex_);
+      if (!running_.exchange(false)) return;
+      direct_dispatch_ = false;
+    }
+    StopTimerThread();
+    // Activations still queued run to completion; whatever they queue from
+    // here on is parked for the next Start().
+    executor_->Shutdown();
+    executor_.reset();
+    return;
+  }
+
+  {
+    // Flip the flag under the lock so the loop cannot miss the wakeup between
+    // checking it and going to sleep.
+    std::lock_guard<std::mutex> lock(ready_mutex_);
+    if (!running_.exchange(false)) return;
+  }
+  StopTimerThread();
+  work_available_.notify_all();
   if (orchestrator_thread_.joinable()) {
     orchestrator_thread_.join();
   }
 }
 
-void AgentOrchestrator::RouteMessage(const AgentMessage& message) {
-  std::lock_guard<std::mutex> lock(messages_mutex_);
-  message_queue_.push(message);
+bool AgentOrchestrator::RouteMessage(const AgentMessage& message) {
+  auto agent = agents_.Find(message.to_agent_id);
+  if (!agent) return false;
+  return DeliverMessage(agent, message);
+}
+
+bool AgentOrchestrator::DeliverMessage(const std::shared_ptr<Agent>& agent,
+                                       const AgentMessage& message) {
+  // Interned names live as long as the process, as trace arguments must.
+  TRACE_EVENT2("opencog", "AgentOrchestrator::DeliverMessage", "to",
+               message.to_agent_id.str().c_str(), "type",
+               message.type.str().c_str());
+  switch (agent->mailbox_->Push(message, current_orchestrator == nullptr)) {
+    case AgentMailbox::PushResult::kRejected:
+      rejected_messages_.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    case AgentMailbox::PushResult::kDeliveredAfterDrop:
+      dropped_messages_.fetch_add(1, std::memory_order_relaxed);
+      break;
+    case AgentMailbox::PushResult::kDelivered:
+      break;
+  }
+  TraceMailboxDepth(agent.get(), *agent->mailbox_);
+  MaybeActivate(agent);
+  return true;
 }
 
 void AgentOrchestrator::BroadcastMessage(const std::string& from_agent_id,
                                           const std::string& type,
-                                          const std::string& payload) {
-  std::lock_guard<std::mutex> lock(agents_mutex_);
-  
-  for (const auto& pair : agents_) {
-    if (pair.first != from_agent_id) {
-      AgentMessage message;
-      message.from_agent_id = from_agent_id;
-      message.to_agent_id = pair.first;
-      message.type = type;
-      message.payload = payload;
-      message.timestamp = 
-          std::chrono::system_clock::now().time_since_epoch().count();
-      RouteMessage(message);
-    }
+                                          AgentPayload payload) {
+  SubscriberList recipients;
+  recipients.reserve(agents_.size());
+  agents_.ForEach([&recipients](const std::shared_ptr<Agent>& agent) {
+    recipients.push_back(agent);
+  });
+
+  AgentMessage message;
+  message.type = type;
+  message.payload = std::move(payload);
+  FanOut(recipients, from_agent_id, std::move(message));
+}
+
+bool AgentOrchestrator::Subscribe(const std::string& agent_id,
+                                  const std::string& topic) {
+  auto agent = GetAgent(agent_id);
+  if (!agent) return false;
+
+  std::unique_lock<std::shared_mutex> lock(topics_mutex_);
+  auto& subscribers = topics_[topic];
+  if (subscribers && std::find(subscribers->begin(), subscribers->end(),
+                               agent) != subscribers->end()) {
+    return false;
+  }
+  auto updated = subscribers ? std::make_shared<SubscriberList>(*subscribers)
+                             : std::make_shared<SubscriberList>();
+  updated->push_back(std::move(agent));
+  subscribers = std::move(updated);
+  return true;
+}
+
+bool AgentOrchestrator::Unsubscribe(const std::string& agent_id,
+                                    const std::string& topic) {
+  std::unique_lock<std::shared_mutex> lock(topics_mutex_);
+  auto it = topics_.find(topic);
+  if (it == topics_.end()) return false;
+
+  auto updated = std::make_shared<SubscriberList>(*it->second);
+  auto removed = std::remove_if(updated->begin(), updated->end(),
+                                [&agent_id](const std::shared_ptr<Agent>& a) {
+                                  return a->agent_id() == agent_id;
+                                });
+  if (removed == updated->end()) return false;
+  updated->erase(removed, updated->end());
+  if (updated->empty()) {
+    topics_.erase(it);
+  } else {
+    it->second = std::move(updated);
+  }
+  return true;
+}
+
+size_t AgentOrchestrator::Publish(const std::string& from_agent_id,
+                                  const std::string& topic,
+                                  const std::string& type,
+                                  AgentPayload payload) {
+  std::shared_ptr<const SubscriberList> subscribers;
+  {
+    std::shared_lock<std::shared_mutex> lock(topics_mutex_);
+    auto it = topics_.find(topic);
+    if (it == topics_.end()) return 0;
+    subscribers = it->second;
+  }
+
+  AgentMessage message;
+  message.type = type;
+  message.topic = topic;
+  message.payload = std::move(payload);
+  return FanOut(*subscribers, from_agent_id, std::move(message));
+}
+
+size_t AgentOrchestrator::FanOut(const SubscriberList& recipients,
+                                 const InternedName& from,
+                                 AgentMessage message) {
+  message.from_agent_id = from;
+  message.timestamp = std::chrono::steady_clock::now();
+  size_t delivered = 0;
+  for (const auto& agent : recipients) {
+    if (agent->agent_name() == from) continue;
+    // Only the recipient id differs; the payload buffer is shared.
+    message.to_agent_id = agent->agent_name();
+    if (DeliverMessage(agent, message)) ++delivered;
   }
+  return delivered;
 }
 
 void AgentOrchestrator::ScheduleAgent(const std::string& agent_id) {
-  std::lock_guard<std::mutex> lock(messages_mutex_);
-  scheduled_agents_.push(agent_id);
+  auto agent = GetAgent(agent_id);
+  if (!agent) return;
+  agent->pending_runs_.fetch_add(1);
+  MaybeActivate(agent);
+}
+
+void AgentOrchestrator::ScheduleAgentAfter(
+    const std::string& agent_id, std::chrono::steady_clock::duration delay) {
+  if (delay <= std::chrono::steady_clock::duration::zero()) {
+    ScheduleAgent(agent_id);
+    return;
+  }
+  auto agent = GetAgent(agent_id);
+  if (!agent) return;
+  {
+    std::lock_guard<std::mutex> lock(timers_mutex_);
+    timers_.push(Timer{std::chrono::steady_clock::now() + delay, agent});
+  }
+  timers_changed_.notify_one();
+}
+
+void AgentOrchestrator::SetTenantWeight(const std::string& tenant_id,
+                                        uint32_t weight) {
+  std::lock_guard<std::mutex> lock(ready_mutex_);
+  scheduler_.SetTenantWeight(tenant_id, weight);
+}
+
+void AgentOrchestrator::SetTenantThrottle(const std::string& tenant_id,
+                                          uint32_t factor) {
+  std::lock_guard<std::mutex> lock(ready_mutex_);
+  scheduler_.SetTenantThrottle(tenant_id, factor);
+}
+
+std::chrono::nanoseconds AgentOrchestrator::TenantRunTime(
+    const std::string& tenant_id) const {
+  std::chrono::nanoseconds run_time{0};
+  for (const auto& agent : agents_.GetByTenant(tenant_id)) {
+    run_time += agent->run_time();
+  }
+  return run_time;
+}
+
+AgentScheduler::Stats AgentOrchestrator::scheduler_stats() const {
+  std::lock_guard<std::mutex> lock(ready_mutex_);
+  return scheduler_.stats();
 }
 
 void AgentOrchestrator::OrchestratorLoop() {
-  while (running_) {
-    ProcessMessageQueue();
-    
-    // Execute scheduled agents
-    std::string agent_id;
+  while (true) {
+    std::shared_ptr<Agent> agent;
     {
-      std::lock_guard<std::mutex> lock(messages_mutex_);
-      if (!scheduled_agents_.empty()) {
-        agent_id = scheduled_agents_.front();
-        scheduled_agents_.pop();
-      }
+      std::unique_lock<std::mutex> lock(ready_mutex_);
+      work_available_.wait(lock, [this]() {
+        return !running_.load(std::memory_order_relaxed) ||
+               !scheduler_.empty();
+      });
+      if (!running_.load(std::memory_order_relaxed)) break;
+      // One activation per pass, so that interactive work queued meanwhile
+      // goes ahead of the batch backlog.
+      agent = scheduler_.Pop();
+      TraceReadyAgents(scheduler_);
+    }
+    ActivateAgent(agent);
+  }
+}
+
+void AgentOrchestrator::TimerLoop() {
+  std::unique_lock<std::mutex> lock(timers_mutex_);
+  while (running_.load(std::memory_order_relaxed)) {
+    if (timers_.empty()) {
+      timers_changed_.wait(lock);
+      continue;
     }
-    
-    if (!agent_id.empty()) {
-      auto agent = GetAgent(agent_id);
-      if (agent && agent->state() == AgentState::IDLE) {
-        agent->set_state(AgentState::RUNNING);
-        try {
-          agent->Execute();
-          agent->set_state(AgentState::IDLE);
-        } catch (...) {
-          agent->set_state(AgentState::FAILED);
-        }
-      }
+    auto due = timers_.top().due;
+    if (std::chrono::steady_clock::now() < due) {
+      timers_changed_.wait_until(lock, due);
+      continue;
     }
-    
-    // Small delay to prevent busy-waiting
-    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    // Timers hold weak references, so unregistered agents are not kept
+    // alive until their timers fire.
+    std::shared_ptr<Agent> agent = timers_.top().agent.lock();
+    timers_.pop();
+    if (!agent) continue;
+    lock.unlock();
+    agent->pending_runs_.fetch_add(1);
+    MaybeActivate(agent);
+    lock.lock();
   }
 }
 
-void AgentOrchestrator::ProcessMessageQueue() {
-  std::vector<AgentMessage> messages;
-  
+void AgentOrchestrator::StopTimerThread() {
   {
-    std::lock_guard<std::mutex> lock(messages_mutex_);
-    while (!message_queue_.empty()) {
-      messages.push_back(message_queue_.front());
-      message_queue_.pop();
-    }
+    // |running_| is already clear; taking the lock orders this wakeup after
+    // the loop's last check of it.
+    std::lock_guard<std::mutex> lock(timers_mutex_);
+  }
+  timers_changed_.notify_all();
+  if (timer_thread_.joinable()) timer_thread_.join();
+}
+
+// static
+void AgentOrchestrator::RunAgent(Agent* agent) {
+  if (agent->state() != AgentState::IDLE) return;
+  agent->set_state(AgentState::RUNNING);
+  TRACE_EVENT1("opencog", "Agent::Execute", "agent",
+               agent->agent_name().str().c_str());
+  try {
+    agent->Execute();
+    agent->set_state(AgentState::IDLE);
+  } catch (...) {
+    agent->set_state(AgentState::FAILED);
   }
-  
-  for (const auto& message : messages) {
-    auto agent = GetAgent(message.to_agent_id);
-    if (agent) {
-      agent->OnMessage(message);
+}
+
+void AgentOrchestrator::MaybeActivate(const std::shared_ptr<Agent>& agent) {
+  if (agent->activation_queued_.exchange(true)) return;
+  SubmitActivation(agent);
+}
+
+void AgentOrchestrator::SubmitActivation(const std::shared_ptr<Agent>& agent) {
+  if (options_.worker_threads > 0) {
+    // Queued under the dispatch lock so that Start() either sees the
+    // activation among the parked ones or dispatches it here.
+    std::shared_lock<std::shared_mutex> dispatch_lock(dispatch_mutex_);
+    {
+      std::lock_guard<std::mutex> lock(ready_mutex_);
+      scheduler_.Push(agent);
+      TraceReadyAgents(scheduler_);
+    }
+    // Workers keep submitting while Stop() drains the executor, so that the
+    // drain covers follow-up work.
+    if (direct_dispatch_ || current_orchestrator == this) {
+      executor_->Submit([this]() { RunNextActivation(); });
     }
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(ready_mutex_);
+    scheduler_.Push(agent);
+    TraceReadyAgents(scheduler_);
+  }
+  work_available_.notify_one();
+}
+
+void AgentOrchestrator::RunNextActivation() {
+  std::shared_ptr<Agent> agent;
+  {
+    std::lock_guard<std::mutex> lock(ready_mutex_);
+    agent = scheduler_.Pop();
+    TraceReadyAgents(scheduler_);
+  }
+  if (agent) ActivateAgent(agent);
+}
+
+void AgentOrchestrator::ActivateAgent(const std::shared_ptr<Agent>& agent) {
+  const AgentOrchestrator* previous_orchestrator = current_orchestrator;
+  current_orchestrator = this;
+  const auto start = std::chrono::steady_clock::now();
+  // Bound the batch so that an agent whose mail keeps arriving yields.
+  AgentMessage message;
+  for (size_t i = 0; i < agent->mailbox_->capacity(); ++i) {
+    if (!agent->mailbox_->TryPop(&message)) break;
+    // Dispatch latency, from sending to the start of this activation.
+    TRACE_EVENT2("opencog", "Agent::OnMessage", "agent",
+                 agent->agent_name().str().c_str(), "queued_us",
+                 static_cast<int64_t>(
+                     std::chrono::duration_cast<std::chrono::microseconds>(
+                         start - message.timestamp)
+                         .count()));
+    agent->OnMessage(message);
+  }
+  TraceMailboxDepth(agent.get(), *agent->mailbox_);
+  for (uint32_t runs = agent->pending_runs_.exchange(0); runs > 0; --runs) {
+    RunAgent(agent.get());
+  }
+  agent->run_time_ns_.fetch_add(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - start)
+          .count(),
+      std::memory_order_relaxed);
+
+  auto has_work = [&agent]() {
+    return !agent->mailbox_->IsEmpty() || agent->pending_runs_.load() > 0;
+  };
+  bool requeue = true;
+  if (!has_work()) {
+    agent->activation_queued_.store(false);
+    // Work queued between the check above and the store saw the activation
+    // still pending and did not submit one; pick it up here.
+    requeue = has_work() && !agent->activation_queued_.exchange(true);
   }
+  // Requeue instead of looping so that a busy agent cannot monopolize its
+  // thread.
+  if (requeue) SubmitActivation(agent);
+  current_orchestrator = previous_orchestrator;
 }
 
 }  // namespace opencog
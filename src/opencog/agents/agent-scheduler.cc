@@ -0,0 +1,112 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/agent-scheduler.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace v8 {
+namespace opencog {
+
+namespace {
+
+constexpr size_t PriorityIndex(AgentPriority priority) {
+  return priority == AgentPriority::kInteractive ? 0 : 1;
+}
+
+constexpr size_t kBatch = PriorityIndex(AgentPriority::kBatch);
+
+}  // namespace
+
+AgentScheduler::AgentScheduler(Clock::duration starvation_threshold)
+    : starvation_threshold_(starvation_threshold) {}
+
+void AgentScheduler::SetTenantWeight(const std::string& tenant_id,
+                                     uint32_t weight) {
+  tenants_[tenant_id].weight = std::max<uint32_t>(weight, 1);
+}
+
+void AgentScheduler::SetTenantThrottle(const std::string& tenant_id,
+                                       uint32_t factor) {
+  tenants_[tenant_id].throttle = std::max<uint32_t>(factor, 1);
+}
+
+void AgentScheduler::Push(std::shared_ptr<Agent> agent) {
+  Tenant& tenant = tenants_[agent->tenant_id()];
+  if (tenant.size() == 0) {
+    tenant.virtual_time = std::max(tenant.virtual_time, virtual_clock_);
+  }
+
+  Clock::time_point now = Clock::now();
+  Clock::time_point deadline = agent->relative_deadline().count() > 0
+                                   ? now + agent->relative_deadline()
+                                   : Clock::time_point::max();
+  size_t priority = PriorityIndex(agent->priority());
+  uint64_t sequence = next_sequence_++;
+  tenant.queues[priority].insert(
+      Entry{deadline, sequence, now, std::move(agent)});
+  if (priority == kBatch) {
+    waiting_batch_.insert(WaitingEntry{now, sequence, &tenant, deadline});
+  }
+  ++size_;
+}
+
+std::shared_ptr<Agent> AgentScheduler::Pop() {
+  if (size_ == 0) return nullptr;
+
+  if (!waiting_batch_.empty()) {
+    const WaitingEntry& oldest = *waiting_batch_.begin();
+    if (Clock::now() - oldest.enqueued > starvation_threshold_) {
+      Tenant* tenant = oldest.tenant;
+      auto entry = tenant->queues[kBatch].find(
+          Entry{oldest.deadline, oldest.sequence, {}, nullptr});
+      ++stats_.starvation_promotions;
+      return Take(tenant, kBatch, entry);
+    }
+  }
+
+  for (size_t priority = 0; priority < kPriorityCount; ++priority) {
+    if (Tenant* tenant = NextTenant(priority)) {
+      return Take(tenant, priority, tenant->queues[priority].begin());
+    }
+  }
+  return nullptr;
+}
+
+AgentScheduler::Tenant* AgentScheduler::NextTenant(size_t priority) {
+  Tenant* next = nullptr;
+  for (auto& pair : tenants_) {
+    Tenant& tenant = pair.second;
+    if (tenant.queues[priority].empty()) continue;
+    if (next == nullptr || tenant.virtual_time < next->virtual_time) {
+      next = &tenant;
+    }
+  }
+  return next;
+}
+
+std::shared_ptr<Agent> AgentScheduler::Take(Tenant* tenant, size_t priority,
+                                            std::set<Entry>::iterator entry) {
+  Clock::time_point now = Clock::now();
+  stats_.max_wait = std::max(stats_.max_wait, now - entry->enqueued);
+  if (now > entry->deadline) ++stats_.deadline_misses;
+  ++stats_.dispatched;
+
+  if (priority == kBatch) {
+    waiting_batch_.erase(WaitingEntry{entry->enqueued, entry->sequence,
+                                      tenant, entry->deadline});
+  }
+  std::shared_ptr<Agent> agent = entry->agent;
+  tenant->queues[priority].erase(entry);
+  --size_;
+
+  virtual_clock_ = tenant->virtual_time;
+  tenant->virtual_time +=
+      static_cast<double>(tenant->throttle) / tenant->weight;
+  return agent;
+}
+
+}  // namespace opencog
+}  // namespace v8
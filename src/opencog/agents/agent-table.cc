@@ -0,0 +1,194 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/agent-table.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace v8 {
+namespace opencog {
+
+namespace {
+
+constexpr size_t kMinIndexCapacity = 16;
+
+// Names hash by address, whose low bits are mostly alignment.
+size_t Mix(size_t hash) {
+  return static_cast<size_t>((uint64_t{hash} * 0x9E3779B97F4A7C15ull) >> 20);
+}
+
+}  // namespace
+
+AgentTable::AgentTable() : index_(new Index(kMinIndexCapacity)) {}
+
+AgentTable::~AgentTable() {
+  delete index_.load(std::memory_order_relaxed);
+  for (auto& chunk : chunks_) delete[] chunk.load(std::memory_order_relaxed);
+}
+
+// static
+AgentTable::IndexEntry* AgentTable::Probe(const Index* index,
+                                          const InternedName& name) {
+  // At most half of the entries have a name, so this finds a free one.
+  for (size_t i = Mix(name.hash());; ++i) {
+    IndexEntry* entry = &index->entries[i & index->mask];
+    const void* entry_name = entry->name.load(std::memory_order_acquire);
+    if (entry_name == nullptr || entry_name == name.id()) return entry;
+  }
+}
+
+bool AgentTable::Insert(std::shared_ptr<Agent> agent,
+                        const std::function<void(Agent*)>& prepare) {
+  const InternedName& name = agent->agent_name();
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  Index* index = index_.load(std::memory_order_relaxed);
+  IndexEntry* entry = Probe(index, name);
+  bool has_entry = entry->name.load(std::memory_order_relaxed) != nullptr;
+  if (has_entry &&
+      entry->handle.load(std::memory_order_relaxed) != kNoHandle) {
+    return false;
+  }
+  Handle handle = AllocateSlot();
+  if (handle == kNoHandle) return false;
+  if (prepare) prepare(agent.get());
+
+  tenants_[agent->tenant_id()].push_back(handle);
+  Slot* slot = SlotAt(handle);
+  slot->agent = std::move(agent);
+  slot->live.store(true, std::memory_order_release);
+  if (!has_entry && index->used + 1 > (index->mask + 1) / 2) {
+    GrowIndex();
+    index = index_.load(std::memory_order_relaxed);
+    entry = Probe(index, name);
+  }
+  // Lookups that see the name see the handle.
+  entry->handle.store(handle, std::memory_order_release);
+  if (!has_entry) {
+    entry->name.store(name.id(), std::memory_order_release);
+    index->used++;
+  }
+  size_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+std::shared_ptr<Agent> AgentTable::Remove(const InternedName& name) {
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  IndexEntry* entry = Probe(index_.load(std::memory_order_relaxed), name);
+  Handle handle = entry->handle.load(std::memory_order_relaxed);
+  if (entry->name.load(std::memory_order_relaxed) == nullptr ||
+      handle == kNoHandle) {
+    return nullptr;
+  }
+  entry->handle.store(kNoHandle, std::memory_order_seq_cst);
+  Slot* slot = SlotAt(handle);
+  slot->live.store(false, std::memory_order_seq_cst);
+  // Lookups that found the slot may still be copying the agent out of it.
+  epochs_.Synchronize();
+  std::shared_ptr<Agent> agent = std::move(slot->agent);
+  free_slots_.push_back(handle);
+
+  auto tenant = tenants_.find(agent->tenant_id());
+  std::vector<Handle>& handles = tenant->second;
+  handles.erase(std::find(handles.begin(), handles.end(), handle));
+  if (handles.empty()) tenants_.erase(tenant);
+  size_.fetch_sub(1, std::memory_order_relaxed);
+  return agent;
+}
+
+AgentTable::Handle AgentTable::FindHandle(const InternedName& name) const {
+  ReaderEpochs::Scope scope(&epochs_);
+  const IndexEntry* entry =
+      Probe(index_.load(std::memory_order_seq_cst), name);
+  return entry->handle.load(std::memory_order_acquire);
+}
+
+std::shared_ptr<Agent> AgentTable::Find(const InternedName& name) const {
+  ReaderEpochs::Scope scope(&epochs_);
+  const IndexEntry* entry =
+      Probe(index_.load(std::memory_order_seq_cst), name);
+  Handle handle = entry->handle.load(std::memory_order_acquire);
+  if (handle == kNoHandle) return nullptr;
+  const Slot* slot = SlotAt(handle);
+  if (!slot->live.load(std::memory_order_seq_cst)) return nullptr;
+  return slot->agent;
+}
+
+std::shared_ptr<Agent> AgentTable::Get(Handle handle) const {
+  ReaderEpochs::Scope scope(&epochs_);
+  if (handle >= slot_limit_.load(std::memory_order_acquire)) return nullptr;
+  const Slot* slot = SlotAt(handle);
+  if (!slot->live.load(std::memory_order_seq_cst)) return nullptr;
+  return slot->agent;
+}
+
+void AgentTable::ForEach(
+    const std::function<void(const std::shared_ptr<Agent>&)>& visitor) const {
+  std::vector<std::shared_ptr<Agent>> agents;
+  agents.reserve(size());
+  {
+    ReaderEpochs::Scope scope(&epochs_);
+    Handle limit = slot_limit_.load(std::memory_order_acquire);
+    for (Handle handle = 0; handle < limit; ++handle) {
+      const Slot* slot = SlotAt(handle);
+      if (slot->live.load(std::memory_order_seq_cst)) {
+        agents.push_back(slot->agent);
+      }
+    }
+  }
+  // Outside the read scope, so that |visitor| may remove agents.
+  for (const auto& agent : agents) visitor(agent);
+}
+
+std::vector<std::shared_ptr<Agent>> AgentTable::GetByTenant(
+    const std::string& tenant_id) const {
+  std::lock_guard<std::mutex> lock(write_mutex_);
+  std::vector<std::shared_ptr<Agent>> agents;
+  auto it = tenants_.find(tenant_id);
+  if (it == tenants_.end()) return agents;
+  agents.reserve(it->second.size());
+  for (Handle handle : it->second) agents.push_back(SlotAt(handle)->agent);
+  return agents;
+}
+
+AgentTable::Handle AgentTable::AllocateSlot() {
+  if (!free_slots_.empty()) {
+    Handle handle = free_slots_.back();
+    free_slots_.pop_back();
+    return handle;
+  }
+  Handle handle = slot_limit_.load(std::memory_order_relaxed);
+  size_t chunk = handle >> kChunkBits;
+  if (chunk >= kMaxChunks) return kNoHandle;
+  if ((handle & (kChunkSize - 1)) == 0) {
+    chunks_[chunk].store(new Slot[kChunkSize], std::memory_order_release);
+  }
+  slot_limit_.store(handle + 1, std::memory_order_release);
+  return handle;
+}
+
+void AgentTable::GrowIndex() {
+  const Index* old_index = index_.load(std::memory_order_relaxed);
+  size_t live = size() + 1;
+  size_t capacity = kMinIndexCapacity;
+  while (capacity < 4 * live) capacity *= 2;
+  auto index = std::make_unique<Index>(capacity);
+  // Only entries with an agent move over; the rest were tombstones.
+  for (size_t i = 0; i <= old_index->mask; ++i) {
+    const IndexEntry& old_entry = old_index->entries[i];
+    Handle handle = old_entry.handle.load(std::memory_order_relaxed);
+    if (handle == kNoHandle) continue;
+    const InternedName& name = SlotAt(handle)->agent->agent_name();
+    IndexEntry* entry = Probe(index.get(), name);
+    entry->handle.store(handle, std::memory_order_relaxed);
+    entry->name.store(name.id(), std::memory_order_relaxed);
+    index->used++;
+  }
+  index_.store(index.release(), std::memory_order_seq_cst);
+  epochs_.Synchronize();
+  delete old_index;
+}
+
+}  // namespace opencog
+}  // namespace v8
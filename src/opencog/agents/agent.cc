@@ -3,21 +3,88 @@
 // found in the LICENSE file.
 
 #include "include/opencog/agent.h"
+#include "include/opencog/agent-mailbox.h"
 #include "include/opencog/agent-orchestrator.h"
 
 #include <chrono>
+#include <mutex>
+#include <ostream>
+#include <shared_mutex>
+#include <unordered_set>
 
 namespace v8 {
 namespace opencog {
 
+namespace {
+
+struct NameHash {
+  using is_transparent = void;
+  size_t operator()(std::string_view name) const {
+    return std::hash<std::string_view>()(name);
+  }
+};
+
+// Every name interned so far. Set nodes never move, so names point into it.
+struct NameTable {
+  std::shared_mutex mutex;
+  std::unordered_set<std::string, NameHash, std::equal_to<>> names;
+};
+
+NameTable& GetNameTable() {
+  static NameTable* table = new NameTable();
+  return *table;
+}
+
+}  // namespace
+
+// static
+const std::string& InternedName::EmptyString() {
+  static const std::string empty;
+  return empty;
+}
+
+// static
+const std::string* InternedName::Intern(std::string_view name) {
+  if (name.empty()) return &EmptyString();
+  NameTable& table = GetNameTable();
+  {
+    std::shared_lock<std::shared_mutex> lock(table.mutex);
+    auto it = table.names.find(name);
+    if (it != table.names.end()) return &*it;
+  }
+  std::unique_lock<std::shared_mutex> lock(table.mutex);
+  return &*table.names.emplace(name).first;
+}
+
+// static
+bool InternedName::Find(std::string_view name, InternedName* result) {
+  if (name.empty()) {
+    *result = InternedName();
+    return true;
+  }
+  NameTable& table = GetNameTable();
+  std::shared_lock<std::shared_mutex> lock(table.mutex);
+  auto it = table.names.find(name);
+  if (it == table.names.end()) return false;
+  result->value_ = &*it;
+  return true;
+}
+
+std::ostream& operator<<(std::ostream& os, const InternedName& name) {
+  return os << name.str();
+}
+
 Agent::Agent(const std::string& agent_id, const std::string& tenant_id)
     : agent_id_(agent_id),
+      agent_name_(agent_id),
       tenant_id_(tenant_id),
       state_(AgentState::IDLE),
       orchestrator_(nullptr) {
   atomspace_ = AtomSpaceManager::GetInstance()->GetOrCreateAtomSpace(tenant_id);
 }
 
+Agent::~Agent() = default;
+
 bool Agent::Initialize() {
   state_ = AgentState::IDLE;
   return true;
@@ -31,18 +98,27 @@ void Agent::OnMessage(const AgentMessage& message) {
   // Default implementation - subclasses should override
 }
 
-void Agent::SendMessage(const std::string& to_agent_id,
-                        const std::string& type,
-                        const std::string& payload) {
-  if (orchestrator_) {
-    AgentMessage message;
-    message.from_agent_id = agent_id_;
-    message.to_agent_id = to_agent_id;
-    message.type = type;
-    message.payload = payload;
-    message.timestamp = std::chrono::system_clock::now().time_since_epoch().count();
-    orchestrator_->RouteMessage(message);
-  }
+// static
+const std::string& AgentPayload::EmptyString() {
+  static const std::string empty;
+  return empty;
+}
+
+std::ostream& operator<<(std::ostream& os, const AgentPayload& payload) {
+  return os << payload.str();
+}
+
+bool Agent::SendMessage(const std::string& to_agent_id,
+                        const std::string& type, AgentPayload payload) {
+  if (!orchestrator_) return false;
+  AgentMessage message;
+  // An id that was never interned belongs to no agent.
+  if (!InternedName::Find(to_agent_id, &message.to_agent_id)) return false;
+  message.from_agent_id = agent_name_;
+  message.type = type;
+  message.payload = std::move(payload);
+  message.timestamp = std::chrono::steady_clock::now();
+  return orchestrator_->RouteMessage(message);
 }
 
 // AgentFactory implementation
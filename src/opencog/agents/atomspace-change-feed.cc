@@ -0,0 +1,136 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/atomspace-change-feed.h"
+
+#include <utility>
+
+#include "include/opencog/agent-orchestrator.h"
+
+namespace v8 {
+namespace opencog {
+
+AtomSpaceChangeFeed::AtomSpaceChangeFeed(AtomSpace* space,
+                                         AgentOrchestrator* orchestrator)
+    : AtomSpaceChangeFeed(space, orchestrator, Options()) {}
+
+AtomSpaceChangeFeed::AtomSpaceChangeFeed(AtomSpace* space,
+                                         AgentOrchestrator* orchestrator,
+                                         const Options& options)
+    : space_(space), orchestrator_(orchestrator), options_(options) {
+  space_->AddObserver(this);
+}
+
+AtomSpaceChangeFeed::~AtomSpaceChangeFeed() { space_->RemoveObserver(this); }
+
+AtomSpaceChangeFeed::SubscriptionId AtomSpaceChangeFeed::Subscribe(
+    const std::string& agent_id, AtomPattern pattern, uint8_t events) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  SubscriptionId id = next_id_++;
+  Subscription& subscription = subscriptions_[id];
+  subscription.agent_id = agent_id;
+  subscription.pattern = std::move(pattern);
+  subscription.events = events;
+  return id;
+}
+
+AtomSpaceChangeFeed::SubscriptionId AtomSpaceChangeFeed::SubscribeToType(
+    const std::string& agent_id, AtomType type, uint8_t events) {
+  AtomPattern pattern;
+  pattern.type = type;
+  return Subscribe(agent_id, std::move(pattern), events);
+}
+
+bool AtomSpaceChangeFeed::Unsubscribe(SubscriptionId id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return subscriptions_.erase(id) > 0;
+}
+
+std::vector<AtomChange> AtomSpaceChangeFeed::TakeChanges(SubscriptionId id) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = subscriptions_.find(id);
+  if (it == subscriptions_.end()) return {};
+  it->second.overflowed = false;
+  return std::exchange(it->second.pending, {});
+}
+
+size_t AtomSpaceChangeFeed::PendingCount(SubscriptionId id) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = subscriptions_.find(id);
+  return it == subscriptions_.end() ? 0 : it->second.pending.size();
+}
+
+size_t AtomSpaceChangeFeed::subscription_count() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return subscriptions_.size();
+}
+
+void AtomSpaceChangeFeed::OnAtomAdded(const std::shared_ptr<Atom>& atom) {
+  Record(AtomChange::Kind::kAdded, kAdded, atom);
+}
+
+void AtomSpaceChangeFeed::OnAtomRemoved(const std::shared_ptr<Atom>& atom) {
+  Record(AtomChange::Kind::kRemoved, kRemoved, atom);
+}
+
+void AtomSpaceChangeFeed::OnTruthValueChanged(
+    const std::shared_ptr<Atom>& atom) {
+  Record(AtomChange::Kind::kTruthValueChanged, kTruthValueChanged, atom);
+}
+
+void AtomSpaceChangeFeed::OnCleared() {
+  std::vector<std::string> to_notify;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [id, subscription] : subscriptions_) {
+      // Nothing that happened before the clear is left to look at.
+      bool was_empty = subscription.pending.empty();
+      subscription.pending.clear();
+      subscription.overflowed = false;
+      subscription.pending.push_back({AtomChange::Kind::kCleared, nullptr});
+      if (was_empty) to_notify.push_back(subscription.agent_id);
+    }
+  }
+  Notify(to_notify);
+}
+
+void AtomSpaceChangeFeed::Record(AtomChange::Kind kind, uint8_t event,
+                                 const std::shared_ptr<Atom>& atom) {
+  std::vector<std::string> to_notify;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& [id, subscription] : subscriptions_) {
+      if (!(subscription.events & event)) continue;
+      if (!subscription.pattern.Matches(atom)) continue;
+      if (Append(&subscription, {kind, atom})) {
+        to_notify.push_back(subscription.agent_id);
+      }
+    }
+  }
+  Notify(to_notify);
+}
+
+bool AtomSpaceChangeFeed::Append(Subscription* subscription,
+                                 AtomChange change) {
+  if (subscription->overflowed) return false;
+  bool was_empty = subscription->pending.empty();
+  if (subscription->pending.size() >= options_.max_pending) {
+    subscription->pending.clear();
+    subscription->pending.push_back({AtomChange::Kind::kOverflowed, nullptr});
+    subscription->overflowed = true;
+  } else {
+    subscription->pending.push_back(std::move(change));
+  }
+  return was_empty;
+}
+
+void AtomSpaceChangeFeed::Notify(const std::vector<std::string>& agent_ids) {
+  if (!orchestrator_) return;
+  for (const std::string& agent_id : agent_ids) {
+    orchestrator_->ScheduleAgent(agent_id);
+  }
+}
+
+}  // namespace opencog
+}  // namespace v8
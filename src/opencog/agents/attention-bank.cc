@@ -0,0 +1,253 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/attention-bank.h"
+
+#include <algorithm>
+#include <mutex>
+
+#include "include/opencog/work-stealing-executor.h"
+
+namespace v8 {
+namespace opencog {
+
+namespace {
+
+struct Transfer {
+  uint32_t slot;
+  float amount;
+};
+
+}  // namespace
+
+AttentionBank::AttentionBank(AtomSpace* space)
+    : AttentionBank(space, Options()) {}
+
+AttentionBank::AttentionBank(AtomSpace* space, const Options& options)
+    : space_(space),
+      options_(options),
+      buckets_(std::max<size_t>(options.bucket_count, 1)) {
+  space_->AddObserver(this);
+}
+
+AttentionBank::~AttentionBank() { space_->RemoveObserver(this); }
+
+AttentionValue AttentionBank::Get(AtomHandle handle) const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  uint32_t slot = handle.value();
+  if (!handle.is_valid() || slot >= bucket_of_.size() ||
+      bucket_of_[slot] == kNotIndexed) {
+    return AttentionValue();
+  }
+  return AttentionValue{sti_[slot], lti_[slot]};
+}
+
+void AttentionBank::Set(AtomHandle handle, const AttentionValue& av) {
+  if (!handle.is_valid()) return;
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  Place(handle.value(), av.sti);
+  lti_[handle.value()] = av.lti;
+}
+
+void AttentionBank::Stimulate(AtomHandle handle, float amount) {
+  if (!handle.is_valid()) return;
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  uint32_t slot = handle.value();
+  float sti = slot < sti_.size() ? sti_[slot] : 0;
+  Place(slot, sti + amount);
+}
+
+std::vector<AtomHandle> AttentionBank::GetAttentionalFocus(size_t k) const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  std::vector<AtomHandle> focus;
+  focus.reserve(std::min(k, size_));
+  for (size_t b = buckets_.size(); b-- > 0 && focus.size() < k;) {
+    const std::vector<uint32_t>& bucket = buckets_[b];
+    size_t missing = k - focus.size();
+    if (bucket.size() <= missing) {
+      for (uint32_t slot : bucket) focus.push_back(AtomHandle(slot));
+      continue;
+    }
+    // Only the bucket the focus ends in needs its atoms compared.
+    std::vector<uint32_t> boundary(bucket);
+    std::nth_element(
+        boundary.begin(), boundary.begin() + missing, boundary.end(),
+        [this](uint32_t a, uint32_t b) { return sti_[a] > sti_[b]; });
+    for (size_t i = 0; i < missing; ++i) {
+      focus.push_back(AtomHandle(boundary[i]));
+    }
+  }
+  return focus;
+}
+
+double AttentionBank::Diffuse(WorkStealingExecutor* executor) {
+  // Takes note of the spreading atoms, then gathers transfers without
+  // holding |mutex_|: the AtomSpace notifies observers under its own locks,
+  // which the gathering needs.
+  struct Source {
+    uint32_t slot;
+    float sti;
+  };
+  std::vector<Source> sources;
+  {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    // Buckets below the threshold's cannot hold atoms above it.
+    const uint32_t lowest = BucketOf(options_.diffusion_threshold);
+    for (size_t b = buckets_.size(); b-- > lowest;) {
+      for (uint32_t slot : buckets_[b]) {
+        if (sti_[slot] > options_.diffusion_threshold) {
+          sources.push_back(Source{slot, sti_[slot]});
+        }
+      }
+    }
+  }
+  if (sources.empty()) return 0;
+
+  const size_t batch_size = std::max<size_t>(options_.diffusion_batch_size, 1);
+  const size_t batch_count = (sources.size() + batch_size - 1) / batch_size;
+  std::vector<std::vector<Transfer>> transfers(batch_count);
+  auto gather = [&](size_t batch) {
+    std::vector<AtomHandle> neighbours;
+    size_t end = std::min(sources.size(), (batch + 1) * batch_size);
+    for (size_t i = batch * batch_size; i < end; ++i) {
+      const Atom* atom = space_->Resolve(AtomHandle(sources[i].slot));
+      if (atom == nullptr) continue;
+      neighbours.clear();
+      if (atom->IsLink()) {
+        for (const auto& target : static_cast<const Link*>(atom)->outgoing()) {
+          neighbours.push_back(target->handle());
+        }
+      }
+      for (const auto& link : space_->GetIncomingSet(atom->id())) {
+        neighbours.push_back(link->handle());
+      }
+      if (neighbours.empty()) continue;
+      float spread = sources[i].sti * options_.diffusion_rate;
+      float share = spread / neighbours.size();
+      transfers[batch].push_back(Transfer{sources[i].slot, -spread});
+      for (AtomHandle neighbour : neighbours) {
+        transfers[batch].push_back(Transfer{neighbour.value(), share});
+      }
+    }
+  };
+  if (executor != nullptr && batch_count > 1) {
+    executor->ParallelFor(batch_count, gather);
+  } else {
+    for (size_t batch = 0; batch < batch_count; ++batch) gather(batch);
+  }
+
+  double moved = 0;
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  for (const std::vector<Transfer>& batch : transfers) {
+    for (const Transfer& transfer : batch) {
+      // Skips atoms removed since; their removal is yet to be observed, or
+      // already was and must not be undone.
+      if (space_->Resolve(AtomHandle(transfer.slot)) == nullptr) continue;
+      float sti = transfer.slot < sti_.size() ? sti_[transfer.slot] : 0;
+      Place(transfer.slot, sti + transfer.amount);
+      if (transfer.amount > 0) moved += transfer.amount;
+    }
+  }
+  return moved;
+}
+
+void AttentionBank::UpdateLongTermImportance(float rate) {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  // Slots without an attention value are zero in both columns and stay so.
+  for (size_t slot = 0; slot < lti_.size(); ++slot) {
+    lti_[slot] += rate * (sti_[slot] - lti_[slot]);
+  }
+}
+
+void AttentionBank::DecayShortTermImportance(float factor) {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  for (float& sti : sti_) sti *= factor;
+  Reindex();
+}
+
+size_t AttentionBank::size() const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return size_;
+}
+
+void AttentionBank::OnAtomRemoved(const std::shared_ptr<Atom>& atom) {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  uint32_t slot = atom->handle().value();
+  if (slot < bucket_of_.size() && bucket_of_[slot] != kNotIndexed) {
+    Unindex(slot);
+  }
+}
+
+void AttentionBank::OnCleared() {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  // A layered AtomSpace keeps its inherited atoms, and their attention.
+  for (uint32_t slot = 0; slot < bucket_of_.size(); ++slot) {
+    if (bucket_of_[slot] != kNotIndexed &&
+        space_->Resolve(AtomHandle(slot)) == nullptr) {
+      Unindex(slot);
+    }
+  }
+}
+
+uint32_t AttentionBank::BucketOf(float sti) const {
+  float scaled = (sti + options_.max_sti) / (2 * options_.max_sti) *
+                 static_cast<float>(buckets_.size());
+  if (!(scaled > 0)) return 0;
+  return static_cast<uint32_t>(
+      std::min(static_cast<size_t>(scaled), buckets_.size() - 1));
+}
+
+void AttentionBank::Place(uint32_t slot, float sti) {
+  if (slot >= bucket_of_.size()) {
+    size_t size = std::max<size_t>(slot + 1, bucket_of_.size() * 2);
+    sti_.resize(size, 0);
+    lti_.resize(size, 0);
+    bucket_of_.resize(size, kNotIndexed);
+    position_.resize(size, 0);
+  }
+  sti_[slot] = std::clamp(sti, -options_.max_sti, options_.max_sti);
+  uint32_t bucket = BucketOf(sti_[slot]);
+  uint32_t current = bucket_of_[slot];
+  if (current == bucket) return;
+  if (current == kNotIndexed) {
+    ++size_;
+  } else {
+    RemoveFromBucket(slot);
+  }
+  bucket_of_[slot] = bucket;
+  position_[slot] = static_cast<uint32_t>(buckets_[bucket].size());
+  buckets_[bucket].push_back(slot);
+}
+
+void AttentionBank::Unindex(uint32_t slot) {
+  RemoveFromBucket(slot);
+  bucket_of_[slot] = kNotIndexed;
+  sti_[slot] = 0;
+  lti_[slot] = 0;
+  --size_;
+}
+
+void AttentionBank::RemoveFromBucket(uint32_t slot) {
+  std::vector<uint32_t>& atoms = buckets_[bucket_of_[slot]];
+  uint32_t moved = atoms.back();
+  atoms[position_[slot]] = moved;
+  position_[moved] = position_[slot];
+  atoms.pop_back();
+}
+
+void AttentionBank::Reindex() {
+  std::vector<std::vector<uint32_t>> buckets(buckets_.size());
+  for (const std::vector<uint32_t>& bucket : buckets_) {
+    for (uint32_t slot : bucket) {
+      uint32_t b = BucketOf(sti_[slot]);
+      bucket_of_[slot] = b;
+      position_[slot] = static_cast<uint32_t>(buckets[b].size());
+      buckets[b].push_back(slot);
+    }
+  }
+  buckets_.swap(buckets);
+}
+
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,93 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/coroutine-agent.h"
+
+#include <utility>
+
+#include "include/opencog/agent-orchestrator.h"
+
+namespace v8 {
+namespace opencog {
+
+AgentTask::AgentTask(AgentTask&& other) noexcept
+    : handle_(std::exchange(other.handle_, nullptr)) {}
+
+AgentTask& AgentTask::operator=(AgentTask&& other) noexcept {
+  if (this != &other) {
+    if (handle_) handle_.destroy();
+    handle_ = std::exchange(other.handle_, nullptr);
+  }
+  return *this;
+}
+
+AgentTask::~AgentTask() {
+  if (handle_) handle_.destroy();
+}
+
+void AgentTask::Resume() {
+  if (done()) return;
+  handle_.resume();
+  if (handle_.done() && handle_.promise().exception) {
+    std::rethrow_exception(std::exchange(handle_.promise().exception, {}));
+  }
+}
+
+CoroutineAgent::CoroutineAgent(const std::string& agent_id,
+                               const std::string& tenant_id)
+    : Agent(agent_id, tenant_id) {}
+
+CoroutineAgent::~CoroutineAgent() = default;
+
+void CoroutineAgent::Execute() {
+  if (!task_.valid()) {
+    task_ = Run();
+  } else if (waiting_ == Wait::kTimer) {
+    // Runs scheduled by other parties do not cut the sleep short.
+    if (Clock::now() < wake_time_) return;
+  } else if (waiting_ != Wait::kYield) {
+    return;
+  }
+  Resume();
+}
+
+void CoroutineAgent::OnMessage(const AgentMessage& message) {
+  inbox_.push_back(message);
+  if (waiting_ != Wait::kMessage) return;
+  // Not called through RunAgent(), so failures are recorded here.
+  try {
+    Resume();
+  } catch (...) {
+    set_state(AgentState::FAILED);
+  }
+}
+
+void CoroutineAgent::Resume() {
+  waiting_ = Wait::kNone;
+  task_.Resume();
+}
+
+AgentMessage CoroutineAgent::MessageAwaiter::await_resume() {
+  AgentMessage message = std::move(agent_->inbox_.front());
+  agent_->inbox_.pop_front();
+  return message;
+}
+
+void CoroutineAgent::SleepAwaiter::await_suspend(std::coroutine_handle<>) {
+  agent_->waiting_ = Wait::kTimer;
+  agent_->wake_time_ = Clock::now() + delay_;
+  agent_->orchestrator_->ScheduleAgentAfter(agent_->agent_id(), delay_);
+}
+
+void CoroutineAgent::YieldAwaiter::await_suspend(std::coroutine_handle<>) {
+  agent_->waiting_ = Wait::kYield;
+  // The run is picked up after the current activation, behind whatever the
+  // scheduler has queued meanwhile.
+  if (agent_->orchestrator_) {
+    agent_->orchestrator_->ScheduleAgent(agent_->agent_id());
+  }
+}
+
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,133 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/forward-chainer.h"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_set>
+
+#include "include/opencog/work-stealing-executor.h"
+
+namespace v8 {
+namespace opencog {
+
+namespace {
+
+// Collects the atoms added to an AtomSpace while it is attached.
+class AdditionCollector : public AtomSpace::Observer {
+ public:
+  explicit AdditionCollector(AtomSpace* space) : space_(space) {
+    space_->AddObserver(this);
+  }
+  ~AdditionCollector() override { space_->RemoveObserver(this); }
+
+  void OnAtomAdded(const std::shared_ptr<Atom>& atom) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    added_.push_back(atom);
+  }
+
+  std::vector<std::shared_ptr<Atom>> TakeAdded() {
+    std::vector<std::shared_ptr<Atom>> added;
+    std::lock_guard<std::mutex> lock(mutex_);
+    added.swap(added_);
+    return added;
+  }
+
+ private:
+  AtomSpace* const space_;
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<Atom>> added_;
+};
+
+struct Application {
+  const InferenceRule* rule;
+  std::shared_ptr<Atom> premise;
+};
+
+}  // namespace
+
+ForwardChainer::ForwardChainer(AtomSpace* space,
+                               WorkStealingExecutor* executor)
+    : ForwardChainer(space, executor, Options()) {}
+
+ForwardChainer::ForwardChainer(AtomSpace* space,
+                               WorkStealingExecutor* executor,
+                               const Options& options)
+    : space_(space), executor_(executor), options_(options) {}
+
+void ForwardChainer::AddRule(InferenceRule rule) {
+  rules_.push_back(std::move(rule));
+}
+
+ForwardChainer::Result ForwardChainer::Run() {
+  Result result;
+  std::vector<std::shared_ptr<Atom>> frontier;
+  const size_t batch_size = std::max<size_t>(options_.batch_size, 1);
+  while (result.steps < options_.max_steps) {
+    std::vector<Application> applications;
+    for (const InferenceRule& rule : rules_) {
+      if (result.steps == 0) {
+        for (auto& premise : space_->Match(rule.premise)) {
+          applications.push_back(Application{&rule, std::move(premise)});
+        }
+        continue;
+      }
+      for (const auto& atom : frontier) {
+        if (rule.premise.Matches(atom)) {
+          applications.push_back(Application{&rule, atom});
+        }
+      }
+    }
+    ++result.steps;
+    result.rule_applications += applications.size();
+
+    const size_t batch_count =
+        (applications.size() + batch_size - 1) / batch_size;
+    std::vector<RuleConclusions> conclusions(batch_count);
+    auto rewrite = [&](size_t batch) {
+      size_t end = std::min(applications.size(), (batch + 1) * batch_size);
+      for (size_t i = batch * batch_size; i < end; ++i) {
+        applications[i].rule->rewrite(applications[i].premise, *space_,
+                                      &conclusions[batch]);
+      }
+    };
+    if (executor_ != nullptr && batch_count > 1) {
+      executor_->ParallelFor(batch_count, rewrite);
+    } else {
+      for (size_t batch = 0; batch < batch_count; ++batch) rewrite(batch);
+    }
+
+    std::vector<std::shared_ptr<Atom>> added;
+    {
+      AdditionCollector collector(space_);
+      for (const RuleConclusions& batch : conclusions) {
+        if (batch.batch.empty()) continue;
+        std::vector<std::shared_ptr<Atom>> atoms = space_->Commit(batch.batch);
+        std::vector<std::shared_ptr<Atom>> batch_added = collector.TakeAdded();
+        if (!batch.truth_values.empty()) {
+          // Conclusions that already held keep their truth value.
+          std::unordered_set<const Atom*> is_new;
+          for (const auto& atom : batch_added) is_new.insert(atom.get());
+          for (const auto& [ref, tv] : batch.truth_values) {
+            if (is_new.count(atoms[ref].get()) > 0) {
+              space_->SetTruthValue(atoms[ref], tv);
+            }
+          }
+        }
+        added.insert(added.end(), batch_added.begin(), batch_added.end());
+      }
+    }
+    result.atoms_added += added.size();
+    if (added.empty()) {
+      result.saturated = true;
+      break;
+    }
+    frontier = std::move(added);
+  }
+  return result;
+}
+
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,144 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/work-stealing-executor.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace v8 {
+namespace opencog {
+
+namespace {
+
+// Identifies the executor and worker of the current thread, so that tasks
+// submitting follow-up work push onto their own deque.
+thread_local const WorkStealingExecutor* current_executor = nullptr;
+thread_local size_t current_worker = 0;
+
+}  // namespace
+
+WorkStealingExecutor::WorkStealingExecutor(size_t worker_count) {
+  worker_count = std::max<size_t>(worker_count, 1);
+  workers_.reserve(worker_count);
+  for (size_t i = 0; i < worker_count; ++i) {
+    workers_.push_back(std::make_unique<Worker>());
+  }
+  threads_.reserve(worker_count);
+  for (size_t i = 0; i < worker_count; ++i) {
+    threads_.emplace_back(&WorkStealingExecutor::WorkerLoop, this, i);
+  }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() { Shutdown(); }
+
+void WorkStealingExecutor::Submit(Task task) {
+  size_t index = current_executor == this
+                     ? current_worker
+                     : next_worker_.fetch_add(1, std::memory_order_relaxed) %
+                           workers_.size();
+  {
+    Worker& worker = *workers_[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+    worker.tasks.push_back(std::move(task));
+    queued_.fetch_add(1);
+  }
+  // Pairs with the sleepers_ increment in WorkerLoop(): either this load sees
+  // the sleeper, or the sleeper sees the queued task before it blocks.
+  if (sleepers_.load() > 0) {
+    std::lock_guard<std::mutex> lock(idle_mutex_);
+    idle_cv_.notify_one();
+  }
+}
+
+void WorkStealingExecutor::ParallelFor(
+    size_t count, const std::function<void(size_t)>& body) {
+  if (count == 0) return;
+  struct Loop {
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> pending;
+    std::mutex mutex;
+    std::condition_variable done;
+  };
+  // Shared with the helper tasks, which may only get to run after the loop
+  // has finished. They touch |body| only for indexes they claimed, that is
+  // while this call still waits.
+  auto loop = std::make_shared<Loop>();
+  loop->pending.store(count);
+  auto run = [loop, count, &body]() {
+    size_t index;
+    while ((index = loop->next.fetch_add(1)) < count) {
+      body(index);
+      if (loop->pending.fetch_sub(1) == 1) {
+        std::lock_guard<std::mutex> lock(loop->mutex);
+        loop->done.notify_all();
+      }
+    }
+  };
+  size_t helpers = std::min(count - 1, workers_.size());
+  for (size_t i = 0; i < helpers; ++i) Submit(run);
+  run();
+  std::unique_lock<std::mutex> lock(loop->mutex);
+  loop->done.wait(lock, [&loop]() { return loop->pending.load() == 0; });
+}
+
+void WorkStealingExecutor::Shutdown() {
+  {
+    std::lock_guard<std::mutex> lock(idle_mutex_);
+    stopping_ = true;
+  }
+  idle_cv_.notify_all();
+  for (auto& thread : threads_) {
+    if (thread.joinable()) thread.join();
+  }
+  threads_.clear();
+}
+
+bool WorkStealingExecutor::TryPop(size_t index, Task* task) {
+  Worker& worker = *workers_[index];
+  std::lock_guard<std::mutex> lock(worker.mutex);
+  if (worker.tasks.empty()) return false;
+  *task = std::move(worker.tasks.back());
+  worker.tasks.pop_back();
+  queued_.fetch_sub(1);
+  return true;
+}
+
+bool WorkStealingExecutor::TrySteal(size_t thief, Task* task) {
+  for (size_t i = 1; i < workers_.size(); ++i) {
+    Worker& victim = *workers_[(thief + i) % workers_.size()];
+    std::lock_guard<std::mutex> lock(victim.mutex);
+    if (victim.tasks.empty()) continue;
+    *task = std::move(victim.tasks.front());
+    victim.tasks.pop_front();
+    queued_.fetch_sub(1);
+    steals_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+  }
+  return false;
+}
+
+void WorkStealingExecutor::WorkerLoop(size_t index) {
+  current_executor = this;
+  current_worker = index;
+  Task task;
+  while (true) {
+    if (TryPop(index, &task) || TrySteal(index, &task)) {
+      task();
+      task = nullptr;
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(idle_mutex_);
+    sleepers_.fetch_add(1);
+    idle_cv_.wait(lock, [this]() { return queued_.load() > 0 || stopping_; });
+    sleepers_.fetch_sub(1);
+    // Tasks still running may submit more work, but only to their own
+    // worker's deque, which that worker drains before it exits.
+    if (stopping_ && queued_.load() == 0) break;
+  }
+  current_executor = nullptr;
+}
+
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,127 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/atom-arena.h"
+
+#include <new>
+
+namespace v8 {
+namespace opencog {
+
+namespace {
+constexpr size_t kInitialDirectoryCapacity = 16;
+}  // namespace
+
+AtomArena::Directory::Directory(size_t capacity)
+    : capacity(capacity), chunks(new std::atomic<Chunk*>[capacity]) {
+  for (size_t i = 0; i < capacity; ++i) {
+    chunks[i].store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+AtomArena::AtomArena(uint32_t first_handle)
+    : first_handle_(first_handle),
+      directory_(new Directory(kInitialDirectoryCapacity)) {}
+
+AtomArena::~AtomArena() { delete directory_.load(std::memory_order_relaxed); }
+
+void* AtomArena::Allocate(size_t size) {
+  if (size > kMaxSlabAllocation) return ::operator new(size);
+
+  std::lock_guard<std::mutex> lock(allocation_mutex_);
+  SizeClass& size_class = size_classes_[SizeClassIndex(size)];
+  if (!size_class.free_list.empty()) {
+    void* result = size_class.free_list.back();
+    size_class.free_list.pop_back();
+    return result;
+  }
+
+  size_t rounded = (SizeClassIndex(size) + 1) * kSizeClassGranularity;
+  if (size_class.top == nullptr ||
+      static_cast<size_t>(size_class.limit - size_class.top) < rounded) {
+    slabs_.emplace_back(new char[kSlabSize]);
+    size_class.top = slabs_.back().get();
+    size_class.limit = size_class.top + kSlabSize;
+  }
+  void* result = size_class.top;
+  size_class.top += rounded;
+  return result;
+}
+
+void AtomArena::Deallocate(void* ptr, size_t size) {
+  if (size > kMaxSlabAllocation) {
+    ::operator delete(ptr);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(allocation_mutex_);
+  size_classes_[SizeClassIndex(size)].free_list.push_back(ptr);
+}
+
+AtomHandle AtomArena::Register(Atom* atom) {
+  std::lock_guard<std::mutex> lock(handle_mutex_);
+
+  uint32_t value;
+  if (!free_handles_.empty()) {
+    value = free_handles_.back();
+    free_handles_.pop_back();
+  } else {
+    value = next_handle_++;
+  }
+
+  size_t chunk_index = value >> kChunkBits;
+  Directory* directory = directory_.load(std::memory_order_relaxed);
+  if (chunk_index >= directory->capacity) {
+    auto grown = std::make_unique<Directory>(directory->capacity * 2);
+    for (size_t i = 0; i < directory->capacity; ++i) {
+      grown->chunks[i].store(
+          directory->chunks[i].load(std::memory_order_relaxed),
+          std::memory_order_relaxed);
+    }
+    retired_directories_.emplace_back(directory);
+    directory = grown.release();
+    directory_.store(directory, std::memory_order_release);
+  }
+
+  Chunk* chunk = directory->chunks[chunk_index].load(std::memory_order_relaxed);
+  if (chunk == nullptr) {
+    chunks_.push_back(std::make_unique<Chunk>());
+    chunk = chunks_.back().get();
+    directory->chunks[chunk_index].store(chunk, std::memory_order_release);
+  }
+  chunk->slots[value & kChunkMask].store(atom, std::memory_order_release);
+  ++live_handles_;
+  return AtomHandle(first_handle_ + value);
+}
+
+void AtomArena::Unregister(AtomHandle handle) {
+  if (!handle.is_valid()) return;
+
+  const uint32_t index = handle.value() - first_handle_;
+  std::lock_guard<std::mutex> lock(handle_mutex_);
+  Directory* directory = directory_.load(std::memory_order_relaxed);
+  Chunk* chunk =
+      directory->chunks[index >> kChunkBits].load(std::memory_order_relaxed);
+  chunk->slots[index & kChunkMask].store(nullptr, std::memory_order_release);
+  free_handles_.push_back(index);
+  --live_handles_;
+}
+
+size_t AtomArena::slab_bytes() const {
+  std::lock_guard<std::mutex> lock(allocation_mutex_);
+  return slabs_.size() * kSlabSize;
+}
+
+size_t AtomArena::live_handles() const {
+  std::lock_guard<std::mutex> lock(handle_mutex_);
+  return live_handles_;
+}
+
+uint32_t AtomArena::handle_limit() const {
+  std::lock_guard<std::mutex> lock(handle_mutex_);
+  return first_handle_ + next_handle_;
+}
+
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,47 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/atom-id-allocator.h"
+
+namespace v8 {
+namespace opencog {
+
+namespace {
+
+std::atomic<uint64_t> next_allocator_serial{1};
+
+// Most threads ingest into one AtomSpace at a time, so a single cached block
+// per thread is enough. Switching AtomSpaces abandons the rest of the block.
+struct ThreadLocalBlock {
+  uint64_t serial = 0;
+  uint64_t next = 0;
+  uint64_t limit = 0;
+};
+
+thread_local ThreadLocalBlock current_block;
+
+}  // namespace
+
+AtomIdAllocator::AtomIdAllocator(uint64_t first_id)
+    : serial_(next_allocator_serial.fetch_add(1, std::memory_order_relaxed)),
+      next_block_(first_id) {}
+
+uint64_t AtomIdAllocator::Allocate() {
+  ThreadLocalBlock& block = current_block;
+  if (block.serial != serial_ || block.next == block.limit) {
+    block.serial = serial_;
+    block.next = next_block_.fetch_add(kBlockSize, std::memory_order_relaxed);
+    block.limit = block.next + kBlockSize;
+  }
+  return block.next++;
+}
+
+// static
+AtomIdAllocator* AtomIdAllocator::Default() {
+  static AtomIdAllocator allocator;
+  return &allocator;
+}
+
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,136 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/atom-name.h"
+
+#include <array>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace v8 {
+namespace opencog {
+
+namespace {
+
+constexpr size_t kPoolShardCount = 64;
+
+// Heap storage of |value|'s characters, 0 while they fit inline.
+size_t CharacterBytes(const std::string& value) {
+  static const size_t inline_capacity = std::string().capacity();
+  return value.capacity() > inline_capacity ? value.capacity() + 1 : 0;
+}
+
+}  // namespace
+
+// Entries are found through views of their own text, so a lookup with a
+// string_view allocates nothing.
+struct AtomNamePool {
+  struct alignas(64) Shard {
+    std::mutex mutex;
+    std::unordered_map<std::string_view, AtomName::Entry*> entries;
+    size_t bytes = 0;
+  };
+
+  static AtomNamePool* Get() {
+    // Never destroyed: names may outlive static destructors.
+    static AtomNamePool* pool = new AtomNamePool();
+    return pool;
+  }
+
+  Shard& shard(std::string_view name) {
+    return shards[std::hash<std::string_view>{}(name) &
+                  (kPoolShardCount - 1)];
+  }
+
+  std::array<Shard, kPoolShardCount> shards;
+};
+
+AtomName::AtomName() : entry_(EmptyEntry()) {}
+
+AtomName::AtomName(std::string_view name) {
+  if (name.empty()) {
+    entry_ = EmptyEntry();
+    return;
+  }
+  AtomNamePool::Shard& shard = AtomNamePool::Get()->shard(name);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto it = shard.entries.find(name);
+  if (it != shard.entries.end()) {
+    entry_ = it->second;
+    entry_->refs.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  entry_ = new Entry();
+  entry_->value.assign(name);
+  shard.entries.emplace(entry_->value, entry_);
+  shard.bytes += sizeof(Entry) + CharacterBytes(entry_->value);
+}
+
+AtomName::AtomName(const AtomName& other) : entry_(other.entry_) {
+  // |other| holds a reference, so the entry cannot be freed meanwhile.
+  if (entry_ != EmptyEntry()) {
+    entry_->refs.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+AtomName::AtomName(AtomName&& other) noexcept : entry_(other.entry_) {
+  other.entry_ = EmptyEntry();
+}
+
+AtomName& AtomName::operator=(AtomName other) noexcept {
+  std::swap(entry_, other.entry_);
+  return *this;
+}
+
+AtomName::~AtomName() {
+  if (entry_ != EmptyEntry()) Release(entry_);
+}
+
+size_t AtomName::allocated_bytes() const {
+  if (entry_ == EmptyEntry()) return 0;
+  return sizeof(Entry) + CharacterBytes(entry_->value);
+}
+
+// static
+AtomName::PoolStats AtomName::GetPoolStats() {
+  PoolStats stats;
+  for (AtomNamePool::Shard& shard : AtomNamePool::Get()->shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    stats.names += shard.entries.size();
+    stats.bytes += shard.bytes;
+  }
+  return stats;
+}
+
+// static
+AtomName::Entry* AtomName::EmptyEntry() {
+  static Entry* empty = new Entry();
+  return empty;
+}
+
+// static
+void AtomName::Release(Entry* entry) {
+  // Other references remain: drop ours without the lock.
+  uint32_t refs = entry->refs.load(std::memory_order_relaxed);
+  while (refs > 1) {
+    if (entry->refs.compare_exchange_weak(refs, refs - 1,
+                                          std::memory_order_release,
+                                          std::memory_order_relaxed)) {
+      return;
+    }
+  }
+  // Possibly the last reference. Lookups only take new references under the
+  // shard lock, so the count cannot rise from zero while it is held.
+  AtomNamePool::Shard& shard = AtomNamePool::Get()->shard(entry->value);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  if (entry->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+  shard.entries.erase(entry->value);
+  shard.bytes -= sizeof(Entry) + CharacterBytes(entry->value);
+  delete entry;
+}
+
+}  // namespace opencog
+}  // namespace v8
@@ -4,19 +4,65 @@
 
 #include "include/opencog/atom.h"
 
+#include <functional>
+
+#include "include/opencog/atom-id-allocator.h"
+
 namespace v8 {
 namespace opencog {
 
-uint64_t Atom::next_id_ = 1;
+namespace {
+
+size_t HashCombine(size_t seed, size_t value) {
+  return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+}
+
+}  // namespace
+
+Atom::Atom(AtomType type, const std::string& name, uint64_t id)
+    : type_(type), name_(name), id_(id) {}
 
-Atom::Atom(AtomType type, const std::string& name)
-    : type_(type), name_(name), id_(next_id_++) {}
+Node::Node(AtomType type, const std::string& name)
+    : Node(type, name, AtomIdAllocator::Default()->Allocate()) {}
 
-Node::Node(AtomType type, const std::string& name) : Atom(type, name) {}
+Node::Node(AtomType type, const std::string& name, uint64_t id)
+    : Atom(type, name, id) {
+  content_hash_ = ContentHash(type, name);
+}
+
+// static
+size_t Node::ContentHash(AtomType type, const std::string& name) {
+  return HashCombine(static_cast<size_t>(type), std::hash<std::string>{}(name));
+}
 
 Link::Link(AtomType type, const std::string& name,
            const std::vector<std::shared_ptr<Atom>>& outgoing)
-    : Atom(type, name), outgoing_(outgoing) {}
+    : Link(type, name, outgoing, AtomIdAllocator::Default()->Allocate()) {}
+
+Link::Link(AtomType type, const std::string& name,
+           const std::vector<std::shared_ptr<Atom>>& outgoing, uint64_t id)
+    : Atom(type, name, id), outgoing_(outgoing) {
+  content_hash_ = ContentHash(type, outgoing);
+}
+
+// static
+size_t Link::ContentHash(AtomType type,
+                         const std::vector<std::shared_ptr<Atom>>& outgoing) {
+  // Links are kept apart from nodes of the same type by the arity seed.
+  size_t hash = HashCombine(~static_cast<size_t>(type), outgoing.size());
+  for (const auto& target : outgoing) {
+    hash = HashCombine(hash, target ? target->content_hash() : 0);
+  }
+  return hash;
+}
+
+// static
+size_t Link::ContentHash(AtomType type,
+                         const std::vector<size_t>& outgoing_hashes) {
+  size_t hash = HashCombine(~static_cast<size_t>(type), outgoing_hashes.size());
+  for (size_t target : outgoing_hashes) hash = HashCombine(hash, target);
+  return hash;
+}
 
 }  // namespace opencog
 }  // namespace v8
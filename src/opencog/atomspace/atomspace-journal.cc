@@ -0,0 +1,451 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/atomspace-journal.h"
+
+#include <cstring>
+
+#include "include/opencog/atomspace-snapshot.h"
+#include "include/v8config.h"
+
+#if V8_OS_POSIX
+#include <unistd.h>
+#endif
+
+namespace v8 {
+namespace opencog {
+
+namespace {
+
+constexpr uint8_t kNodeTag = 0;
+constexpr uint8_t kLinkTag = 1;
+constexpr uint8_t kNullTag = 2;
+constexpr size_t kRecordHeaderSize = 2 * sizeof(uint32_t);
+// Guards against allocating absurd buffers for corrupt length fields.
+constexpr uint32_t kMaxRecordSize = 64 * 1024 * 1024;
+
+constexpr uint32_t kChecksumSeed = 2166136261u;
+
+// FNV-1a; enough to detect torn writes.
+uint32_t Checksum(const uint8_t* data, size_t size,
+                  uint32_t hash = kChecksumSeed) {
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+template <typename T>
+void Put(std::vector<uint8_t>* out, T value) {
+  uint8_t bytes[sizeof(T)];
+  std::memcpy(bytes, &value, sizeof(T));
+  out->insert(out->end(), bytes, bytes + sizeof(T));
+}
+
+void EncodeAtom(std::vector<uint8_t>* out, const Atom* atom) {
+  if (atom == nullptr) {
+    Put<uint8_t>(out, kNullTag);
+    return;
+  }
+  Put<uint8_t>(out, atom->IsLink() ? kLinkTag : kNodeTag);
+  Put<uint8_t>(out, static_cast<uint8_t>(atom->type()));
+  Put<uint32_t>(out, static_cast<uint32_t>(atom->name().size()));
+  out->insert(out->end(), atom->name().begin(), atom->name().end());
+  if (atom->IsLink()) {
+    const auto& outgoing = static_cast<const Link*>(atom)->outgoing();
+    Put<uint32_t>(out, static_cast<uint32_t>(outgoing.size()));
+    for (const auto& target : outgoing) EncodeAtom(out, target.get());
+  }
+}
+
+void EncodeTruthValue(std::vector<uint8_t>* out, const TruthValue& tv) {
+  Put<double>(out, tv.strength);
+  Put<double>(out, tv.confidence);
+}
+
+// Bounds-checked decoder for one record payload.
+class Reader {
+ public:
+  Reader(const uint8_t* data, size_t size) : data_(data), size_(size) {}
+
+  template <typename T>
+  bool Get(T* value) {
+    if (size_ - position_ < sizeof(T)) return false;
+    std::memcpy(value, data_ + position_, sizeof(T));
+    position_ += sizeof(T);
+    return true;
+  }
+
+  bool GetString(uint32_t length, std::string* value) {
+    if (size_ - position_ < length) return false;
+    value->assign(reinterpret_cast<const char*>(data_ + position_), length);
+    position_ += length;
+    return true;
+  }
+
+ private:
+  const uint8_t* data_;
+  size_t size_;
+  size_t position_ = 0;
+};
+
+// Decodes an atom reference. With |create|, missing atoms are added to
+// |space|; otherwise a missing atom yields nullptr. Sets |*ok| to false on
+// malformed input.
+std::shared_ptr<Atom> DecodeAtom(Reader* reader, AtomSpace* space, bool create,
+                              bool* ok) {
+  uint8_t tag, type;
+  uint32_t name_length;
+  std::string name;
+  if (!reader->Get(&tag)) {
+    *ok = false;
+    return nullptr;
+  }
+  if (tag == kNullTag) return nullptr;
+  if (tag > kLinkTag || !reader->Get(&type) || type >= kAtomTypeCount ||
+      !reader->Get(&name_length) || !reader->GetString(name_length, &name)) {
+    *ok = false;
+    return nullptr;
+  }
+  AtomType atom_type = static_cast<AtomType>(type);
+  if (tag == kNodeTag) {
+    return create ? space->AddNode(atom_type, name)
+                  : space->GetNode(atom_type, name);
+  }
+
+  uint32_t arity;
+  if (!reader->Get(&arity)) {
+    *ok = false;
+    return nullptr;
+  }
+  std::vector<std::shared_ptr<Atom>> outgoing;
+  for (uint32_t i = 0; i < arity && *ok; ++i) {
+    auto target = DecodeAtom(reader, space, create, ok);
+    // Without |create| a missing target means the link cannot exist either.
+    if (!target && !create) return nullptr;
+    outgoing.push_back(std::move(target));
+  }
+  if (!*ok) return nullptr;
+  return create ? space->AddLink(atom_type, name, outgoing)
+                : space->GetLink(atom_type, outgoing);
+}
+
+bool WriteFileDurably(const std::string& path,
+                      const std::vector<uint8_t>& data, bool sync) {
+  std::FILE* file = std::fopen(path.c_str(), "wb");
+  if (file == nullptr) return false;
+  bool ok = std::fwrite(data.data(), 1, data.size(), file) == data.size() &&
+            std::fflush(file) == 0;
+#if V8_OS_POSIX
+  if (ok && sync) ok = fsync(fileno(file)) == 0;
+#endif
+  return std::fclose(file) == 0 && ok;
+}
+
+bool FileExists(const std::string& path) {
+  std::FILE* file = std::fopen(path.c_str(), "rb");
+  if (file == nullptr) return false;
+  std::fclose(file);
+  return true;
+}
+
+}  // namespace
+
+AtomSpaceJournal::AtomSpaceJournal(AtomSpace* space,
+                                   const std::string& directory,
+                                   const Options& options)
+    : space_(space), directory_(directory), options_(options) {}
+
+// static
+std::unique_ptr<AtomSpaceJournal> AtomSpaceJournal::Open(
+    AtomSpace* space, const std::string& directory, const Options& options) {
+  std::unique_ptr<AtomSpaceJournal> journal(
+      new AtomSpaceJournal(space, directory, options));
+
+  if (auto snapshot = AtomSpaceSnapshot::Open(journal->SnapshotPath())) {
+    snapshot->LoadInto(space);
+  }
+  // An interrupted checkpoint leaves the previous log behind; it predates the
+  // current one.
+  bool interrupted_checkpoint = FileExists(journal->OldLogPath());
+  bool clean = true;
+  if (interrupted_checkpoint) clean &= journal->Replay(journal->OldLogPath());
+  clean &= journal->Replay(journal->LogPath());
+
+  if (interrupted_checkpoint || !clean) {
+    // Collapse the recovered state into a fresh snapshot, so that neither the
+    // old log nor a damaged tail has to be dealt with again.
+    if (!journal->WriteSnapshot() || !journal->OpenLog(true)) return nullptr;
+    std::remove(journal->OldLogPath().c_str());
+  } else if (!journal->OpenLog(false)) {
+    return nullptr;
+  }
+
+  space->AddObserver(journal.get());
+  journal->writer_thread_ = std::thread(&AtomSpaceJournal::WriterLoop,
+                                        journal.get());
+  journal->checkpoint_thread_ = std::thread(&AtomSpaceJournal::CheckpointLoop,
+                                            journal.get());
+  return journal;
+}
+
+AtomSpaceJournal::~AtomSpaceJournal() {
+  space_->RemoveObserver(this);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  writer_cv_.notify_all();
+  checkpoint_cv_.notify_all();
+  if (writer_thread_.joinable()) writer_thread_.join();
+  if (checkpoint_thread_.joinable()) checkpoint_thread_.join();
+  if (log_ != nullptr) std::fclose(log_);
+}
+
+bool AtomSpaceJournal::Replay(const std::string& path) {
+  std::FILE* file = std::fopen(path.c_str(), "rb");
+  if (file == nullptr) return true;
+
+  bool clean = true;
+  std::vector<uint8_t> record;
+  while (true) {
+    uint32_t header[2];
+    size_t read = std::fread(header, 1, sizeof(header), file);
+    if (read == 0) break;
+    uint32_t size = header[0];
+    if (read != sizeof(header) || size == 0 || size > kMaxRecordSize) {
+      clean = false;
+      break;
+    }
+    record.resize(size);
+    if (std::fread(record.data(), 1, size, file) != size ||
+        Checksum(record.data(), size) != header[1]) {
+      clean = false;
+      break;
+    }
+
+    Reader reader(record.data() + 1, size - 1);
+    bool ok = true;
+    switch (static_cast<RecordType>(record[0])) {
+      case RecordType::kAddAtom: {
+        auto atom = DecodeAtom(&reader, space_, true, &ok);
+        TruthValue tv;
+        if (ok && atom && reader.Get(&tv.strength) &&
+            reader.Get(&tv.confidence)) {
+          space_->RestoreTruthValue(atom, tv);
+        }
+        break;
+      }
+      case RecordType::kRemoveAtom: {
+        auto atom = DecodeAtom(&reader, space_, false, &ok);
+        if (atom) space_->RemoveAtom(atom->id());
+        break;
+      }
+      case RecordType::kSetTruthValue: {
+        auto atom = DecodeAtom(&reader, space_, false, &ok);
+        TruthValue tv;
+        if (atom && reader.Get(&tv.strength) && reader.Get(&tv.confidence)) {
+          space_->RestoreTruthValue(atom, tv);
+        }
+        break;
+      }
+      case RecordType::kClear:
+        space_->Clear();
+        break;
+      default:
+        ok = false;
+        break;
+    }
+    if (!ok) {
+      clean = false;
+      break;
+    }
+  }
+  std::fclose(file);
+  return clean;
+}
+
+bool AtomSpaceJournal::WriteSnapshot() {
+  std::string temp_path = SnapshotPath() + ".tmp";
+  if (!WriteFileDurably(temp_path, AtomSpaceSnapshot::Serialize(*space_),
+                        options_.sync)) {
+    return false;
+  }
+  return std::rename(temp_path.c_str(), SnapshotPath().c_str()) == 0;
+}
+
+bool AtomSpaceJournal::OpenLog(bool truncate) {
+  std::lock_guard<std::mutex> lock(log_mutex_);
+  if (log_ != nullptr) std::fclose(log_);
+  log_ = std::fopen(LogPath().c_str(), truncate ? "wb" : "ab");
+  if (log_ == nullptr) return false;
+  std::fseek(log_, 0, SEEK_END);
+  log_bytes_ = static_cast<uint64_t>(std::ftell(log_));
+  return true;
+}
+
+void AtomSpaceJournal::Append(RecordType type,
+                              const std::vector<uint8_t>& payload) {
+  uint32_t size = static_cast<uint32_t>(payload.size() + 1);
+  uint8_t type_byte = static_cast<uint8_t>(type);
+  uint32_t checksum =
+      Checksum(payload.data(), payload.size(), Checksum(&type_byte, 1));
+
+  bool wake_writer;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Put<uint32_t>(&buffer_, size);
+    Put<uint32_t>(&buffer_, checksum);
+    buffer_.push_back(type_byte);
+    buffer_.insert(buffer_.end(), payload.begin(), payload.end());
+    ++appended_;
+    wake_writer = buffer_.size() >= options_.group_commit_bytes;
+  }
+  if (wake_writer) writer_cv_.notify_one();
+}
+
+void AtomSpaceJournal::WriteLocked(const std::vector<uint8_t>& buffer) {
+  if (buffer.empty() || log_ == nullptr) return;
+  std::fwrite(buffer.data(), 1, buffer.size(), log_);
+  std::fflush(log_);
+#if V8_OS_POSIX
+  if (options_.sync) fdatasync(fileno(log_));
+#endif
+  log_bytes_ += buffer.size();
+}
+
+void AtomSpaceJournal::WriterLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    writer_cv_.wait_for(lock, options_.group_commit_interval, [this]() {
+      return stopping_ ||
+             (!buffer_.empty() &&
+              (flush_waiters_ > 0 ||
+               buffer_.size() >= options_.group_commit_bytes));
+    });
+    if (buffer_.empty()) {
+      if (stopping_) break;
+      continue;
+    }
+
+    std::vector<uint8_t> batch;
+    batch.swap(buffer_);
+    uint64_t target = appended_;
+    lock.unlock();
+
+    bool needs_checkpoint;
+    {
+      std::lock_guard<std::mutex> log_lock(log_mutex_);
+      WriteLocked(batch);
+      needs_checkpoint = log_bytes_ >= options_.checkpoint_log_bytes;
+    }
+
+    lock.lock();
+    if (target > durable_) durable_ = target;
+    flushed_cv_.notify_all();
+    if (needs_checkpoint && !checkpoint_running_) {
+      checkpoint_requested_ = true;
+      checkpoint_cv_.notify_one();
+    }
+  }
+}
+
+void AtomSpaceJournal::Flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  uint64_t target = appended_;
+  ++flush_waiters_;
+  writer_cv_.notify_one();
+  flushed_cv_.wait(lock, [this, target]() { return durable_ >= target; });
+  --flush_waiters_;
+}
+
+void AtomSpaceJournal::CheckpointLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    checkpoint_cv_.wait(
+        lock, [this]() { return stopping_ || checkpoint_requested_; });
+    if (stopping_) break;
+    checkpoint_requested_ = false;
+    lock.unlock();
+    Checkpoint();
+    lock.lock();
+  }
+}
+
+void AtomSpaceJournal::Checkpoint() {
+  std::lock_guard<std::mutex> checkpoint_lock(checkpoint_mutex_);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    checkpoint_running_ = true;
+  }
+
+  // Rotate the log. Every record in the old log describes a mutation that is
+  // already applied to the AtomSpace, so the snapshot taken below covers it.
+  {
+    std::lock_guard<std::mutex> log_lock(log_mutex_);
+    std::vector<uint8_t> pending;
+    uint64_t target;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      pending.swap(buffer_);
+      target = appended_;
+    }
+    WriteLocked(pending);
+    std::fclose(log_);
+    log_ = nullptr;
+    std::rename(LogPath().c_str(), OldLogPath().c_str());
+    log_ = std::fopen(LogPath().c_str(), "wb");
+    log_bytes_ = 0;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (target > durable_) durable_ = target;
+    flushed_cv_.notify_all();
+  }
+
+  // Mutations racing with serialization land in the new log as well; replay
+  // is idempotent, so it does not matter whether the snapshot has them.
+  if (WriteSnapshot()) std::remove(OldLogPath().c_str());
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  checkpoint_running_ = false;
+  ++checkpoints_;
+}
+
+uint64_t AtomSpaceJournal::log_bytes() const {
+  std::lock_guard<std::mutex> lock(log_mutex_);
+  return log_bytes_;
+}
+
+uint64_t AtomSpaceJournal::checkpoint_count() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return checkpoints_;
+}
+
+void AtomSpaceJournal::OnAtomAdded(const std::shared_ptr<Atom>& atom) {
+  std::vector<uint8_t> payload;
+  EncodeAtom(&payload, atom.get());
+  EncodeTruthValue(&payload, space_->GetTruthValue(*atom));
+  Append(RecordType::kAddAtom, payload);
+}
+
+void AtomSpaceJournal::OnAtomRemoved(const std::shared_ptr<Atom>& atom) {
+  std::vector<uint8_t> payload;
+  EncodeAtom(&payload, atom.get());
+  Append(RecordType::kRemoveAtom, payload);
+}
+
+void AtomSpaceJournal::OnTruthValueChanged(const std::shared_ptr<Atom>& atom) {
+  std::vector<uint8_t> payload;
+  EncodeAtom(&payload, atom.get());
+  EncodeTruthValue(&payload, space_->GetTruthValue(*atom));
+  Append(RecordType::kSetTruthValue, payload);
+}
+
+void AtomSpaceJournal::OnCleared() {
+  Append(RecordType::kClear, std::vector<uint8_t>());
+}
+
+}  // namespace opencog
+}  // namespace v8
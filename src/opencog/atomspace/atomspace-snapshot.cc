@@ -0,0 +1,454 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/atomspace-snapshot.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "include/opencog/atom-batch.h"
+#include "include/opencog/atomspace.h"
+#include "include/v8config.h"
+
+#if V8_OS_POSIX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace v8 {
+namespace opencog {
+
+namespace {
+constexpr char kMagic[8] = {'O', 'C', 'A', 'S', 'N', 'A', 'P', '\0'};
+
+size_t AlignTo8(size_t value) { return (value + 7) & ~size_t{7}; }
+
+// Checks that [offset, offset + size) lies within a buffer of |limit| bytes.
+bool InBounds(uint64_t offset, uint64_t size, uint64_t limit) {
+  return offset <= limit && size <= limit - offset;
+}
+}  // namespace
+
+struct AtomSpaceSnapshot::Header {
+  char magic[8];
+  uint32_t version;
+  uint32_t atom_count;
+  uint64_t atoms_offset;
+  uint64_t outgoing_offset;
+  uint64_t outgoing_count;
+  uint64_t strings_offset;
+  uint64_t strings_size;
+  uint64_t hash_offset;
+  // Power of two. Buckets hold record indexes or kNoAtom.
+  uint64_t hash_bucket_count;
+  TypeSection sections[kAtomTypeCount];
+};
+
+struct AtomSpaceSnapshot::AtomRecord {
+  uint8_t type;
+  uint8_t is_link;
+  uint16_t reserved;
+  uint32_t name_length;
+  uint64_t name_offset;
+  uint64_t outgoing_begin;
+  uint32_t outgoing_count;
+  uint32_t reserved2;
+  double strength;
+  double confidence;
+  uint64_t content_hash;
+};
+
+static_assert(sizeof(AtomSpaceSnapshot::TypeSection) == 8);
+
+AtomSpaceSnapshot::AtomSpaceSnapshot(const uint8_t* data, size_t size)
+    : data_(data), size_(size) {}
+
+AtomSpaceSnapshot::~AtomSpaceSnapshot() {
+#if V8_OS_POSIX
+  if (mapping_ != nullptr) munmap(mapping_, mapping_size_);
+#endif
+}
+
+// static
+std::vector<uint8_t> AtomSpaceSnapshot::Serialize(const AtomSpace& space) {
+  std::vector<std::shared_ptr<Atom>> atoms;
+  atoms.reserve(space.Size());
+  for (size_t type = 0; type < kAtomTypeCount; ++type) {
+    space.ForEachAtomOfType(static_cast<AtomType>(type),
+                            [&atoms](const std::shared_ptr<Atom>& atom) {
+                              atoms.push_back(atom);
+                            });
+  }
+  return SerializeAtoms(space, atoms);
+}
+
+// static
+std::vector<uint8_t> AtomSpaceSnapshot::SerializeLayer(
+    const AtomSpace& space) {
+  if (!space.base()) return Serialize(space);
+
+  std::vector<std::shared_ptr<Atom>> atoms;
+  std::unordered_set<const Atom*> included;
+  auto include = [&atoms, &included](const std::shared_ptr<Atom>& atom) {
+    if (included.insert(atom.get()).second) atoms.push_back(atom);
+  };
+  atoms.reserve(space.DeltaSize());
+  for (size_t type = 0; type < kAtomTypeCount; ++type) {
+    space.ForEachDeltaAtomOfType(static_cast<AtomType>(type), include);
+  }
+  for (const auto& atom : space.GetOverriddenAtoms()) include(atom);
+  // Inherited atoms referenced by the layer, so that loading the image on
+  // its own rebuilds every link.
+  for (size_t i = 0; i < atoms.size(); ++i) {
+    if (!atoms[i]->IsLink()) continue;
+    const Link& link = static_cast<const Link&>(*atoms[i]);
+    for (const auto& target : link.outgoing()) include(target);
+  }
+  std::stable_sort(atoms.begin(), atoms.end(),
+                   [](const std::shared_ptr<Atom>& a,
+                      const std::shared_ptr<Atom>& b) {
+                     return a->type() < b->type();
+                   });
+  return SerializeAtoms(space, atoms);
+}
+
+// static
+std::vector<uint8_t> AtomSpaceSnapshot::SerializeAtoms(
+    const AtomSpace& space, const std::vector<std::shared_ptr<Atom>>& atoms) {
+  static_assert(sizeof(AtomRecord) % 8 == 0);
+  static_assert(sizeof(Header) % 8 == 0);
+
+  Header header = {};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kFormatVersion;
+  header.atom_count = static_cast<uint32_t>(atoms.size());
+  // |atoms| is grouped by type; this is the record order.
+  for (const auto& atom : atoms) {
+    ++header.sections[static_cast<size_t>(atom->type())].count;
+  }
+  uint32_t first = 0;
+  for (TypeSection& section : header.sections) {
+    section.first = first;
+    first += section.count;
+  }
+
+  std::unordered_map<const Atom*, uint32_t> indexes;
+  indexes.reserve(atoms.size());
+  for (uint32_t i = 0; i < atoms.size(); ++i) indexes[atoms[i].get()] = i;
+
+  std::vector<AtomRecord> records(atoms.size());
+  std::vector<uint32_t> outgoing;
+  std::string strings;
+  std::unordered_map<std::string_view, uint64_t> string_offsets;
+  for (uint32_t i = 0; i < atoms.size(); ++i) {
+    const Atom& atom = *atoms[i];
+    AtomRecord& record = records[i];
+    record.type = static_cast<uint8_t>(atom.type());
+    record.is_link = atom.IsLink();
+    TruthValue tv = space.GetTruthValue(atom);
+    record.strength = tv.strength;
+    record.confidence = tv.confidence;
+    record.content_hash = atom.content_hash();
+
+    auto name_it = string_offsets.find(atom.name());
+    if (name_it == string_offsets.end()) {
+      uint64_t offset = strings.size();
+      strings.append(atom.name());
+      // Keys view the atom's own name, which outlives this function's use.
+      name_it = string_offsets.emplace(atom.name(), offset).first;
+    }
+    record.name_offset = name_it->second;
+    record.name_length = static_cast<uint32_t>(atom.name().size());
+
+    if (atom.IsLink()) {
+      const auto& targets = static_cast<const Link&>(atom).outgoing();
+      record.outgoing_begin = outgoing.size();
+      record.outgoing_count = static_cast<uint32_t>(targets.size());
+      for (const auto& target : targets) {
+        auto it = indexes.find(target.get());
+        outgoing.push_back(it != indexes.end() ? it->second : kNoAtom);
+      }
+    }
+  }
+
+  size_t bucket_count = 1;
+  while (bucket_count < 2 * atoms.size()) bucket_count <<= 1;
+  std::vector<uint32_t> buckets(bucket_count, kNoAtom);
+  for (uint32_t i = 0; i < atoms.size(); ++i) {
+    size_t bucket = records[i].content_hash & (bucket_count - 1);
+    while (buckets[bucket] != kNoAtom) {
+      bucket = (bucket + 1) & (bucket_count - 1);
+    }
+    buckets[bucket] = i;
+  }
+
+  header.atoms_offset = sizeof(Header);
+  header.outgoing_offset =
+      header.atoms_offset + records.size() * sizeof(AtomRecord);
+  header.outgoing_count = outgoing.size();
+  header.strings_offset = AlignTo8(header.outgoing_offset +
+                                   outgoing.size() * sizeof(uint32_t));
+  header.strings_size = strings.size();
+  header.hash_offset = AlignTo8(header.strings_offset + strings.size());
+  header.hash_bucket_count = bucket_count;
+
+  std::vector<uint8_t> image(header.hash_offset +
+                             bucket_count * sizeof(uint32_t));
+  auto write = [&image](uint64_t offset, const void* data, size_t size) {
+    if (size > 0) std::memcpy(image.data() + offset, data, size);
+  };
+  write(0, &header, sizeof(header));
+  write(header.atoms_offset, records.data(),
+        records.size() * sizeof(AtomRecord));
+  write(header.outgoing_offset, outgoing.data(),
+        outgoing.size() * sizeof(uint32_t));
+  write(header.strings_offset, strings.data(), strings.size());
+  write(header.hash_offset, buckets.data(), buckets.size() * sizeof(uint32_t));
+  return image;
+}
+
+// static
+bool AtomSpaceSnapshot::WriteToFile(const AtomSpace& space,
+                                    const std::string& path) {
+  std::vector<uint8_t> image = Serialize(space);
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) return false;
+  file.write(reinterpret_cast<const char*>(image.data()), image.size());
+  return static_cast<bool>(file);
+}
+
+// static
+bool AtomSpaceSnapshot::Validate(const uint8_t* data, size_t size) {
+  if (size < sizeof(Header)) return false;
+  const Header& header = *reinterpret_cast<const Header*>(data);
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) return false;
+  if (header.version != kFormatVersion) return false;
+
+  uint64_t atom_count = header.atom_count;
+  if (!InBounds(header.atoms_offset, atom_count * sizeof(AtomRecord), size) ||
+      !InBounds(header.outgoing_offset,
+                header.outgoing_count * sizeof(uint32_t), size) ||
+      !InBounds(header.strings_offset, header.strings_size, size) ||
+      !InBounds(header.hash_offset,
+                header.hash_bucket_count * sizeof(uint32_t), size)) {
+    return false;
+  }
+  if (header.atoms_offset % 8 != 0 || header.outgoing_offset % 4 != 0 ||
+      header.hash_offset % 4 != 0) {
+    return false;
+  }
+  uint64_t buckets = header.hash_bucket_count;
+  if (buckets == 0 || (buckets & (buckets - 1)) != 0 || buckets < atom_count) {
+    return false;
+  }
+
+  uint64_t expected_first = 0;
+  for (const TypeSection& section : header.sections) {
+    if (section.first != expected_first) return false;
+    expected_first += section.count;
+  }
+  if (expected_first != atom_count) return false;
+
+  const AtomRecord* records =
+      reinterpret_cast<const AtomRecord*>(data + header.atoms_offset);
+  const uint32_t* outgoing =
+      reinterpret_cast<const uint32_t*>(data + header.outgoing_offset);
+  for (uint64_t i = 0; i < atom_count; ++i) {
+    const AtomRecord& record = records[i];
+    if (record.type >= kAtomTypeCount) return false;
+    if (!InBounds(record.name_offset, record.name_length,
+                  header.strings_size)) {
+      return false;
+    }
+    if (!InBounds(record.outgoing_begin, record.outgoing_count,
+                  header.outgoing_count)) {
+      return false;
+    }
+    for (uint32_t j = 0; j < record.outgoing_count; ++j) {
+      uint32_t target = outgoing[record.outgoing_begin + j];
+      if (target != kNoAtom && target >= atom_count) return false;
+    }
+  }
+
+  const uint32_t* hash_table =
+      reinterpret_cast<const uint32_t*>(data + header.hash_offset);
+  for (uint64_t i = 0; i < buckets; ++i) {
+    if (hash_table[i] != kNoAtom && hash_table[i] >= atom_count) return false;
+  }
+  return true;
+}
+
+// static
+std::unique_ptr<AtomSpaceSnapshot> AtomSpaceSnapshot::FromBuffer(
+    std::vector<uint8_t> buffer) {
+  if (!Validate(buffer.data(), buffer.size())) return nullptr;
+  std::unique_ptr<AtomSpaceSnapshot> snapshot(
+      new AtomSpaceSnapshot(buffer.data(), buffer.size()));
+  snapshot->buffer_ = std::move(buffer);
+  return snapshot;
+}
+
+// static
+std::unique_ptr<AtomSpaceSnapshot> AtomSpaceSnapshot::Open(
+    const std::string& path) {
+#if V8_OS_POSIX
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) return nullptr;
+  struct stat info;
+  if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+    close(fd);
+    return nullptr;
+  }
+  size_t size = static_cast<size_t>(info.st_size);
+  void* mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (mapping == MAP_FAILED) return nullptr;
+  const uint8_t* data = static_cast<const uint8_t*>(mapping);
+  if (!Validate(data, size)) {
+    munmap(mapping, size);
+    return nullptr;
+  }
+  std::unique_ptr<AtomSpaceSnapshot> snapshot(
+      new AtomSpaceSnapshot(data, size));
+  snapshot->mapping_ = mapping;
+  snapshot->mapping_size_ = size;
+  return snapshot;
+#else
+  std::ifstream file(path, std::ios::binary);
+  if (!file) return nullptr;
+  std::vector<uint8_t> buffer((std::istreambuf_iterator<char>(file)),
+                              std::istreambuf_iterator<char>());
+  return FromBuffer(std::move(buffer));
+#endif
+}
+
+const AtomSpaceSnapshot::Header& AtomSpaceSnapshot::header() const {
+  return *reinterpret_cast<const Header*>(data_);
+}
+
+const AtomSpaceSnapshot::AtomRecord& AtomSpaceSnapshot::record(
+    uint32_t index) const {
+  return reinterpret_cast<const AtomRecord*>(data_ +
+                                             header().atoms_offset)[index];
+}
+
+uint32_t AtomSpaceSnapshot::atom_count() const { return header().atom_count; }
+
+AtomSpaceSnapshot::AtomView AtomSpaceSnapshot::GetAtom(uint32_t index) const {
+  const AtomRecord& atom = record(index);
+  const char* strings =
+      reinterpret_cast<const char*>(data_ + header().strings_offset);
+  const uint32_t* outgoing =
+      reinterpret_cast<const uint32_t*>(data_ + header().outgoing_offset);
+  AtomView view;
+  view.index = index;
+  view.type = static_cast<AtomType>(atom.type);
+  view.is_link = atom.is_link != 0;
+  view.name = std::string_view(strings + atom.name_offset, atom.name_length);
+  view.truth_value = TruthValue(atom.strength, atom.confidence);
+  view.content_hash = static_cast<size_t>(atom.content_hash);
+  view.outgoing = outgoing + atom.outgoing_begin;
+  view.outgoing_count = atom.outgoing_count;
+  return view;
+}
+
+AtomSpaceSnapshot::TypeSection AtomSpaceSnapshot::GetTypeSection(
+    AtomType type) const {
+  return header().sections[static_cast<size_t>(type)];
+}
+
+std::optional<uint32_t> AtomSpaceSnapshot::FindNode(
+    AtomType type, std::string_view name) const {
+  size_t hash = Node::ContentHash(type, std::string(name));
+  const uint32_t* buckets =
+      reinterpret_cast<const uint32_t*>(data_ + header().hash_offset);
+  size_t mask = header().hash_bucket_count - 1;
+  for (size_t bucket = hash & mask; buckets[bucket] != kNoAtom;
+       bucket = (bucket + 1) & mask) {
+    AtomView view = GetAtom(buckets[bucket]);
+    if (view.content_hash == hash && !view.is_link && view.type == type &&
+        view.name == name) {
+      return view.index;
+    }
+  }
+  return std::nullopt;
+}
+
+std::shared_ptr<Atom> AtomSpaceSnapshot::Promote(uint32_t index,
+                                                 AtomSpace* space) const {
+  AtomView view = GetAtom(index);
+  std::string name(view.name);
+  std::shared_ptr<Atom> atom;
+  if (!view.is_link) {
+    // An atom promoted earlier may have been mutated already; keep it.
+    if (auto existing = space->GetNode(view.type, name)) return existing;
+    atom = space->AddNode(view.type, name);
+  } else {
+    std::vector<std::shared_ptr<Atom>> outgoing;
+    outgoing.reserve(view.outgoing_count);
+    for (uint32_t i = 0; i < view.outgoing_count; ++i) {
+      if (view.outgoing[i] == kNoAtom) continue;
+      outgoing.push_back(Promote(view.outgoing[i], space));
+    }
+    if (auto existing = space->GetLink(view.type, outgoing)) return existing;
+    atom = space->AddLink(view.type, name, outgoing);
+  }
+  space->RestoreTruthValue(atom, view.truth_value);
+  return atom;
+}
+
+void AtomSpaceSnapshot::LoadInto(AtomSpace* space) const {
+  uint32_t count = atom_count();
+  AtomBatch batch(count);
+  // Records are ordered by type, but batch entries may only refer to earlier
+  // entries, so emit outgoing atoms first.
+  std::vector<AtomBatch::Ref> refs(count, kNoAtom);
+  std::vector<uint32_t> order;
+  order.reserve(count);
+  std::vector<std::pair<uint32_t, uint32_t>> stack;
+  for (uint32_t root = 0; root < count; ++root) {
+    if (refs[root] != kNoAtom) continue;
+    stack.push_back({root, 0});
+    while (!stack.empty()) {
+      auto& [index, next_child] = stack.back();
+      AtomView view = GetAtom(index);
+      if (next_child < view.outgoing_count) {
+        uint32_t child = view.outgoing[next_child++];
+        if (child != kNoAtom && refs[child] == kNoAtom) {
+          stack.push_back({child, 0});
+        }
+        continue;
+      }
+      if (!view.is_link) {
+        refs[index] = batch.AddNode(view.type, std::string(view.name));
+      } else {
+        std::vector<AtomBatch::Ref> outgoing;
+        outgoing.reserve(view.outgoing_count);
+        for (uint32_t i = 0; i < view.outgoing_count; ++i) {
+          if (view.outgoing[i] != kNoAtom) {
+            outgoing.push_back(refs[view.outgoing[i]]);
+          }
+        }
+        refs[index] = batch.AddLink(view.type, std::string(view.name),
+                                    std::move(outgoing));
+      }
+      order.push_back(index);
+      stack.pop_back();
+    }
+  }
+
+  auto atoms = space->Commit(batch);
+  for (size_t i = 0; i < order.size(); ++i) {
+    space->RestoreTruthValue(atoms[i], GetAtom(order[i]).truth_value);
+  }
+}
+
+}  // namespace opencog
+}  // namespace v8
@@ -5,25 +5,354 @@
 #include "include/opencog/atomspace.h"
 
 #include <algorithm>
+#include <thread>
+#include <utility>
+
+#include "include/opencog/distributed-atomspace.h"
+#include "src/tracing/trace-event.h"
 
 namespace v8 {
 namespace opencog {
 
-AtomSpace::AtomSpace(const std::string& tenant_id) : tenant_id_(tenant_id) {}
+namespace {
+
+// Estimated footprint of a node based hash container: the bucket array, and
+// per element a node holding the value, the next pointer and the hash.
+template <typename Map>
+size_t HashTableBytes(const Map& map) {
+  return map.bucket_count() * sizeof(void*) +
+         map.size() * (sizeof(typename Map::value_type) + 2 * sizeof(void*));
+}
+
+template <typename T>
+size_t VectorBytes(const std::vector<T>& vector) {
+  return vector.capacity() * sizeof(T);
+}
+
+// Shard locks that cost a try-lock while the shard is free, and otherwise
+// trace the wait for it.
+std::unique_lock<std::shared_mutex> LockExclusive(std::shared_mutex& mutex) {
+  std::unique_lock<std::shared_mutex> lock(mutex, std::try_to_lock);
+  if (!lock.owns_lock()) {
+    TRACE_EVENT0("opencog", "AtomSpace::WaitForExclusiveLock");
+    lock.lock();
+  }
+  return lock;
+}
+
+std::shared_lock<std::shared_mutex> LockShared(std::shared_mutex& mutex) {
+  std::shared_lock<std::shared_mutex> lock(mutex, std::try_to_lock);
+  if (!lock.owns_lock()) {
+    TRACE_EVENT0("opencog", "AtomSpace::WaitForSharedLock");
+    lock.lock();
+  }
+  return lock;
+}
+
+}  // namespace
+
+AtomSpace::AtomSpace(const std::string& tenant_id)
+    : tenant_id_(tenant_id), arena_(std::make_shared<AtomArena>()) {}
+
+AtomSpace::AtomSpace(const std::string& tenant_id,
+                     std::shared_ptr<const AtomSpace> base)
+    : tenant_id_(tenant_id),
+      base_(std::move(base)),
+      base_handle_limit_(base_ ? base_->arena_->handle_limit() : 0),
+      base_id_limit_(base_ ? base_->id_allocator().high_water_mark() : 0),
+      arena_(std::make_shared<AtomArena>(base_handle_limit_)),
+      id_allocator_(base_ ? base_id_limit_ : 1) {}
+
+std::shared_ptr<Node> AtomSpace::InheritedNode(AtomType type,
+                                               const std::string& name) const {
+  if (!base_) return nullptr;
+  std::shared_ptr<Node> node = base_->GetNode(type, name);
+  return (node && !IsHidden(node->id())) ? node : nullptr;
+}
+
+std::shared_ptr<Link> AtomSpace::InheritedLink(
+    AtomType type, const std::vector<std::shared_ptr<Atom>>& outgoing) const {
+  if (!base_) return nullptr;
+  std::shared_ptr<Link> link = base_->GetLink(type, outgoing);
+  return (link && !IsHidden(link->id())) ? link : nullptr;
+}
+
+const Atom* AtomSpace::ResolveInherited(AtomHandle handle) const {
+  const Atom* atom = base_->Resolve(handle);
+  return (atom && !IsHidden(atom->id())) ? atom : nullptr;
+}
+
+bool AtomSpace::IsHidden(uint64_t id) const {
+  if (!has_hidden_.load(std::memory_order_acquire)) return false;
+  std::shared_lock<std::shared_mutex> lock(shadow_mutex_);
+  return hidden_.count(id) > 0;
+}
+
+std::unordered_set<uint64_t> AtomSpace::HiddenIds() const {
+  std::shared_lock<std::shared_mutex> lock(shadow_mutex_);
+  return hidden_;
+}
+
+bool AtomSpace::HideInherited(const std::shared_ptr<Atom>& atom) {
+  {
+    // Read views copy the hidden set under the exclusive lock.
+    std::shared_lock<std::shared_mutex> version_lock(version_mutex_);
+    std::unique_lock<std::shared_mutex> lock(shadow_mutex_);
+    if (!hidden_.insert(atom->id()).second) return false;
+    hidden_per_type_[static_cast<size_t>(atom->type())]++;
+    truth_overrides_.erase(atom->id());
+    hidden_count_.fetch_add(1, std::memory_order_relaxed);
+    has_hidden_.store(true, std::memory_order_release);
+  }
+  {
+    // Links of this layer pointing at the atom, as for a removal in the base.
+    IdShard& ids = id_shard(atom->id());
+    std::unique_lock<std::shared_mutex> lock(ids.mutex);
+    ids.incoming.erase(atom->id());
+  }
+  NotifyObservers(
+      [&atom](Observer* observer) { observer->OnAtomRemoved(atom); });
+  return true;
+}
+
+void AtomSpace::InsertLocked(const std::shared_ptr<Atom>& atom) {
+  atom->handle_ = arena_->Register(atom.get());
+  {
+    IdShard& shard = id_shard(atom->id());
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    shard.atoms[atom->id()] = atom;
+  }
+  {
+    TypeBucket& bucket = type_bucket(atom->type());
+    std::unique_lock<std::shared_mutex> lock(bucket.mutex);
+    atom->type_index_slot_ = static_cast<uint32_t>(bucket.atoms.size());
+    bucket.atoms.push_back(atom);
+  }
+  size_.fetch_add(1, std::memory_order_relaxed);
+  PublishAdded(&atom, 1);
+}
+
+void AtomSpace::PublishAdded(const std::shared_ptr<Atom>* atoms,
+                             size_t count) {
+  std::shared_lock<std::shared_mutex> version_lock(version_mutex_);
+  uint64_t version = version_.fetch_add(1, std::memory_order_relaxed) + 1;
+  for (size_t i = 0; i < count; ++i) {
+    atoms[i]->added_version_.store(version, std::memory_order_release);
+  }
+}
+
+void AtomSpace::Retire(std::vector<std::shared_ptr<Atom>> atoms) {
+  uint64_t version = version_.fetch_add(1, std::memory_order_relaxed) + 1;
+  for (const auto& atom : atoms) {
+    atom->removed_version_.store(version, std::memory_order_release);
+  }
+  // Views open under the exclusive lock, so none opens meanwhile and none
+  // can see the atoms if there is none now.
+  if (open_views_.load() == 0) {
+    for (const auto& atom : atoms) arena_->Unregister(atom->handle());
+    return;
+  }
+  std::lock_guard<std::mutex> lock(views_mutex_);
+  for (auto& atom : atoms) retired_.push_back(RetiredAtom{std::move(atom)});
+}
+
+std::unique_ptr<AtomSpace::ReadView> AtomSpace::OpenReadView() const {
+  // The base is immutable, so its view need not be pinned together.
+  std::unique_ptr<ReadView> base_view =
+      base_ ? base_->OpenReadView() : nullptr;
+  std::unique_lock<std::shared_mutex> version_lock(version_mutex_);
+  uint64_t version = version_.load(std::memory_order_relaxed);
+  uint64_t sequence;
+  {
+    std::lock_guard<std::mutex> lock(views_mutex_);
+    sequence = ++view_sequence_;
+    views_.emplace(sequence, version);
+    open_views_.fetch_add(1);
+  }
+  std::unique_ptr<ReadView> view(new ReadView(this, version, sequence));
+  view->first_handle_ = base_handle_limit_;
+  view->handle_limit_ = arena_->handle_limit();
+  if (base_) {
+    view->hidden_ = HiddenIds();
+    view->base_ = std::move(base_view);
+  }
+  return view;
+}
+
+void AtomSpace::CloseReadView(uint64_t sequence) const {
+  std::lock_guard<std::mutex> lock(views_mutex_);
+  views_.erase(sequence);
+  open_views_.fetch_sub(1);
+  ReclaimLocked();
+}
+
+void AtomSpace::ReclaimLocked() const {
+  const bool any_views = !views_.empty();
+  // The oldest view has both the lowest sequence number and version.
+  const uint64_t oldest_version = any_views ? views_.begin()->second : 0;
+  const uint64_t oldest_sequence = any_views ? views_.begin()->first : 0;
+  size_t kept = 0;
+  for (size_t i = 0; i < retired_.size(); ++i) {
+    RetiredAtom& retired = retired_[i];
+    if (!retired.unregistered &&
+        (!any_views ||
+         retired.atom->removed_version_.load(std::memory_order_relaxed) <=
+             oldest_version)) {
+      // No view sees the atom anymore, and views opened from now on cannot
+      // resolve it.
+      arena_->Unregister(retired.atom->handle());
+      retired.unregistered = true;
+      retired.last_sequence = view_sequence_;
+    }
+    if (retired.unregistered &&
+        (!any_views || retired.last_sequence < oldest_sequence)) {
+      continue;
+    }
+    if (kept != i) retired_[kept] = std::move(retired);
+    ++kept;
+  }
+  retired_.resize(kept);
+}
+
+AtomSpace::ReadView::ReadView(const AtomSpace* space, uint64_t version,
+                              uint64_t sequence)
+    : space_(space), version_(version), sequence_(sequence) {}
+
+AtomSpace::ReadView::~ReadView() {
+  // The base view closes itself.
+  space_->CloseReadView(sequence_);
+}
+
+std::vector<const Atom*> AtomSpace::ReadView::Query(
+    const std::function<bool(const Atom&)>& predicate) const {
+  std::vector<const Atom*> result;
+  ForEachAtom([&result, &predicate](const Atom& atom) {
+    if (predicate(atom)) result.push_back(&atom);
+  });
+  return result;
+}
+
+size_t AtomSpace::ReadView::Size() const {
+  size_t size = 0;
+  ForEachAtom([&size](const Atom&) { ++size; });
+  return size;
+}
+
+// static
+template <typename Callback>
+void AtomSpace::ForEachIndexedTarget(const Link& link, Callback&& callback) {
+  const auto& outgoing = link.outgoing();
+  for (auto target_it = outgoing.begin(); target_it != outgoing.end();
+       ++target_it) {
+    // Only atoms of this AtomSpace are indexed, since ids are only unique
+    // within one AtomSpace. Links that mention an atom twice appear once in
+    // its incoming set.
+    if (!link.outgoing_handles_[target_it - outgoing.begin()].is_valid() ||
+        std::find(outgoing.begin(), target_it, *target_it) != target_it) {
+      continue;
+    }
+    callback(**target_it);
+  }
+}
+
+void AtomSpace::AddToIncomingSets(const std::shared_ptr<Link>& link) {
+  ForEachIndexedTarget(*link, [this, &link](const Atom& target) {
+    IdShard& shard = id_shard(target.id());
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    shard.incoming[target.id()].push_back(link);
+  });
+}
+
+void AtomSpace::RemoveFromIncomingSets(const Link& link) {
+  ForEachIndexedTarget(link, [this, &link](const Atom& target) {
+    IdShard& shard = id_shard(target.id());
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto it = shard.incoming.find(target.id());
+    if (it == shard.incoming.end()) return;
+    auto& links = it->second;
+    for (size_t i = 0; i < links.size(); ++i) {
+      if (links[i]->id() == link.id()) {
+        links[i] = std::move(links.back());
+        links.pop_back();
+        break;
+      }
+    }
+    if (links.empty()) shard.incoming.erase(it);
+  });
+}
+
+std::shared_ptr<Node> AtomSpace::NewNode(AtomType type,
+                                         const std::string& name) {
+  return std::allocate_shared<Node>(AtomArenaAllocator<Node>(arena_), type,
+                                    name, id_allocator_.Allocate());
+}
+
+std::shared_ptr<Link> AtomSpace::NewLink(
+    AtomType type, const std::string& name,
+    const std::vector<std::shared_ptr<Atom>>& outgoing) {
+  auto link = std::allocate_shared<Link>(AtomArenaAllocator<Link>(arena_),
+                                         type, name, outgoing,
+                                         id_allocator_.Allocate());
+  link->outgoing_handles_.reserve(outgoing.size());
+  for (const auto& target : outgoing) {
+    // Only record handles that belong to this AtomSpace, including inherited
+    // atoms, whose incoming sets this layer extends.
+    AtomHandle handle = target ? target->handle() : AtomHandle();
+    if (Resolve(handle) != target.get()) handle = AtomHandle();
+    link->outgoing_handles_.push_back(handle);
+  }
+  return link;
+}
+
+std::vector<std::unique_lock<std::shared_mutex>> AtomSpace::LockAllShards()
+    const {
+  std::vector<std::unique_lock<std::shared_mutex>> locks;
+  locks.reserve(3 * kShardCount + kAtomTypeCount);
+  for (LinkShard& shard : link_shards_) locks.push_back(LockExclusive(shard.mutex));
+  for (NameShard& shard : name_shards_) locks.push_back(LockExclusive(shard.mutex));
+  for (IdShard& shard : id_shards_) locks.push_back(LockExclusive(shard.mutex));
+  for (TypeBucket& bucket : type_buckets_) locks.push_back(LockExclusive(bucket.mutex));
+  return locks;
+}
+
+// static
+std::shared_ptr<Node> AtomSpace::FindNodeLocked(const NameShard& shard,
+                                                AtomType type,
+                                                const std::string& name) {
+  auto it = shard.atoms.find(name);
+  if (it == shard.atoms.end()) return nullptr;
+  for (const auto& atom : it->second) {
+    if (atom->IsNode() && atom->type() == type) {
+      return std::static_pointer_cast<Node>(atom);
+    }
+  }
+  return nullptr;
+}
+
+// static
+std::shared_ptr<Link> AtomSpace::FindLinkLocked(
+    const LinkShard& shard, size_t content_hash, AtomType type,
+    const std::vector<std::shared_ptr<Atom>>& outgoing) {
+  auto it = shard.links.find(content_hash);
+  if (it == shard.links.end()) return nullptr;
+  for (const auto& link : it->second) {
+    if (link->type() == type && link->outgoing() == outgoing) return link;
+  }
+  return nullptr;
+}
 
 std::shared_ptr<Node> AtomSpace::AddNode(AtomType type, const std::string& name) {
-  std::lock_guard<std::mutex> lock(mutex_);
+  NameShard& shard = name_shard(name);
+  auto lock = LockExclusive(shard.mutex);
   
   // Check if atom already exists
-  auto it = atoms_by_name_.find(name);
-  if (it != atoms_by_name_.end() && it->second->IsNode()) {
-    return std::static_pointer_cast<Node>(it->second);
-  }
+  if (auto existing = InheritedNode(type, name)) return existing;
+  if (auto existing = FindNodeLocked(shard, type, name)) return existing;
   
-  auto node = std::make_shared<Node>(type, name);
-  atoms_by_id_[node->id()] = node;
-  atoms_by_name_[name] = node;
-  atoms_by_type_.insert({type, node});
+  auto node = NewNode(type, name);
+  InsertLocked(node);
+  shard.atoms[node->name()].push_back(node);
+  NotifyObservers([&node](Observer* observer) { observer->OnAtomAdded(node); });
   
   return node;
 }
@@ -31,135 +360,807 @@ std::shared_ptr<Node> AtomSpace::AddNode(AtomType type, const std::string& name)
 std::shared_ptr<Link> AtomSpace::AddLink(
     AtomType type, const std::string& name,
     const std::vector<std::shared_ptr<Atom>>& outgoing) {
-  std::lock_guard<std::mutex> lock(mutex_);
+  size_t content_hash = Link::ContentHash(type, outgoing);
+  LinkShard& links = link_shard(content_hash);
+  auto link_lock = LockExclusive(links.mutex);
+
+  // Check if atom already exists
+  if (auto existing = InheritedLink(type, outgoing)) return existing;
+  if (auto existing = FindLinkLocked(links, content_hash, type, outgoing)) {
+    return existing;
+  }
+
+  NameShard& shard = name_shard(name);
+  auto lock = LockExclusive(shard.mutex);
   
-  auto link = std::make_shared<Link>(type, name, outgoing);
-  atoms_by_id_[link->id()] = link;
-  atoms_by_name_[name] = link;
-  atoms_by_type_.insert({type, link});
+  auto link = NewLink(type, name, outgoing);
+  InsertLocked(link);
+  AddToIncomingSets(link);
+  shard.atoms[link->name()].push_back(link);
+  links.links[content_hash].push_back(link);
+  NotifyObservers([&link](Observer* observer) { observer->OnAtomAdded(link); });
   
   return link;
 }
 
+std::vector<std::shared_ptr<Atom>> AtomSpace::Commit(const AtomBatch& batch) {
+  TRACE_EVENT1("opencog", "AtomSpace::Commit", "atoms", batch.size());
+  std::vector<std::shared_ptr<Atom>> atoms;
+  atoms.reserve(batch.size());
+
+  // Count new entries per index up front, so that the maps and buckets grow at
+  // most once inside the critical section.
+  std::array<size_t, kShardCount> names_per_shard{};
+  std::array<size_t, kAtomTypeCount> atoms_per_type{};
+  for (const AtomBatch::Entry& entry : batch.entries()) {
+    if (entry.kind == AtomBatch::EntryKind::kExisting) continue;
+    names_per_shard[std::hash<std::string>{}(entry.name) & (kShardCount - 1)]++;
+    atoms_per_type[static_cast<size_t>(entry.type)]++;
+  }
+
+  auto locks = LockAllShards();
+  for (size_t i = 0; i < kShardCount; ++i) {
+    name_shards_[i].atoms.reserve(name_shards_[i].atoms.size() +
+                                  names_per_shard[i]);
+    id_shards_[i].atoms.reserve(id_shards_[i].atoms.size() +
+                                batch.size() / kShardCount + 1);
+  }
+  for (size_t i = 0; i < kAtomTypeCount; ++i) {
+    type_buckets_[i].atoms.reserve(type_buckets_[i].atoms.size() +
+                                   atoms_per_type[i]);
+  }
+
+  std::vector<std::shared_ptr<Atom>> added;
+  auto index = [this, &added](const std::shared_ptr<Atom>& atom) {
+    NotifyObservers(
+        [&atom](Observer* observer) { observer->OnAtomAdded(atom); });
+    atom->handle_ = arena_->Register(atom.get());
+    id_shard(atom->id()).atoms[atom->id()] = atom;
+    TypeBucket& bucket = type_bucket(atom->type());
+    atom->type_index_slot_ = static_cast<uint32_t>(bucket.atoms.size());
+    bucket.atoms.push_back(atom);
+    name_shard(atom->name()).atoms[atom->name()].push_back(atom);
+    added.push_back(atom);
+  };
+
+  for (const AtomBatch::Entry& entry : batch.entries()) {
+    switch (entry.kind) {
+      case AtomBatch::EntryKind::kExisting:
+        atoms.push_back(entry.existing);
+        break;
+      case AtomBatch::EntryKind::kNode: {
+        std::shared_ptr<Node> node = InheritedNode(entry.type, entry.name);
+        if (!node) {
+          node = FindNodeLocked(name_shard(entry.name), entry.type, entry.name);
+        }
+        if (!node) {
+          node = NewNode(entry.type, entry.name);
+          index(node);
+        }
+        atoms.push_back(std::move(node));
+        break;
+      }
+      case AtomBatch::EntryKind::kLink: {
+        std::vector<std::shared_ptr<Atom>> outgoing;
+        outgoing.reserve(entry.outgoing.size());
+        for (AtomBatch::Ref ref : entry.outgoing) {
+          outgoing.push_back(atoms[ref]);
+        }
+
+        size_t content_hash = Link::ContentHash(entry.type, outgoing);
+        LinkShard& links = link_shard(content_hash);
+        std::shared_ptr<Link> link = InheritedLink(entry.type, outgoing);
+        if (!link) {
+          link = FindLinkLocked(links, content_hash, entry.type, outgoing);
+        }
+        if (!link) {
+          link = NewLink(entry.type, entry.name, outgoing);
+          index(link);
+          links.links[content_hash].push_back(link);
+          ForEachIndexedTarget(*link, [this, &link](const Atom& target) {
+            id_shard(target.id()).incoming[target.id()].push_back(link);
+          });
+        }
+        atoms.push_back(std::move(link));
+        break;
+      }
+    }
+  }
+
+  size_.fetch_add(added.size(), std::memory_order_relaxed);
+  // The whole batch becomes visible to read views at once.
+  PublishAdded(added.data(), added.size());
+  return atoms;
+}
+
+std::shared_ptr<Node> AtomSpace::GetNode(AtomType type,
+                                         const std::string& name) const {
+  if (auto inherited = InheritedNode(type, name)) return inherited;
+  const NameShard& shard = name_shard(name);
+  auto lock = LockShared(shard.mutex);
+  return FindNodeLocked(shard, type, name);
+}
+
+std::shared_ptr<Link> AtomSpace::GetLink(
+    AtomType type, const std::vector<std::shared_ptr<Atom>>& outgoing) const {
+  if (auto inherited = InheritedLink(type, outgoing)) return inherited;
+  size_t content_hash = Link::ContentHash(type, outgoing);
+  const LinkShard& shard = link_shard(content_hash);
+  auto lock = LockShared(shard.mutex);
+  return FindLinkLocked(shard, content_hash, type, outgoing);
+}
+
 std::shared_ptr<Atom> AtomSpace::GetAtom(uint64_t id) const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  auto it = atoms_by_id_.find(id);
-  return (it != atoms_by_id_.end()) ? it->second : nullptr;
+  // Ids below the base's high water mark can only be inherited.
+  if (id < base_id_limit_) {
+    std::shared_ptr<Atom> atom = base_->GetAtom(id);
+    return (atom && !IsHidden(id)) ? atom : nullptr;
+  }
+  const IdShard& shard = id_shard(id);
+  auto lock = LockShared(shard.mutex);
+  auto it = shard.atoms.find(id);
+  return (it != shard.atoms.end()) ? it->second : nullptr;
 }
 
 std::shared_ptr<Atom> AtomSpace::GetAtomByName(const std::string& name) const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  auto it = atoms_by_name_.find(name);
-  return (it != atoms_by_name_.end()) ? it->second : nullptr;
+  if (base_ && !has_hidden_.load(std::memory_order_acquire)) {
+    if (auto inherited = base_->GetAtomByName(name)) return inherited;
+  } else if (base_) {
+    for (auto& inherited : base_->GetAtomsByName(name)) {
+      if (!IsHidden(inherited->id())) return inherited;
+    }
+  }
+  const NameShard& shard = name_shard(name);
+  auto lock = LockShared(shard.mutex);
+  auto it = shard.atoms.find(name);
+  return (it != shard.atoms.end()) ? it->second.front() : nullptr;
 }
 
-std::vector<std::shared_ptr<Atom>> AtomSpace::GetAtomsByType(AtomType type) const {
-  std::lock_guard<std::mutex> lock(mutex_);
+std::vector<std::shared_ptr<Atom>> AtomSpace::GetAtomsByName(
+    const std::string& name) const {
   std::vector<std::shared_ptr<Atom>> result;
-  
-  auto range = atoms_by_type_.equal_range(type);
-  for (auto it = range.first; it != range.second; ++it) {
-    result.push_back(it->second);
+  if (base_) {
+    result = base_->GetAtomsByName(name);
+    if (has_hidden_.load(std::memory_order_acquire)) {
+      result.erase(std::remove_if(result.begin(), result.end(),
+                                  [this](const std::shared_ptr<Atom>& atom) {
+                                    return IsHidden(atom->id());
+                                  }),
+                   result.end());
+    }
+  }
+  const NameShard& shard = name_shard(name);
+  auto lock = LockShared(shard.mutex);
+  auto it = shard.atoms.find(name);
+  if (it != shard.atoms.end()) {
+    result.insert(result.end(), it->second.begin(), it->second.end());
   }
-  
   return result;
 }
 
+std::vector<std::shared_ptr<Atom>> AtomSpace::GetAtomsByType(AtomType type) const {
+  if (base_) {
+    std::vector<std::shared_ptr<Atom>> result;
+    result.reserve(CountAtomsByType(type));
+    ForEachAtomOfType(type, [&result](const std::shared_ptr<Atom>& atom) {
+      result.push_back(atom);
+    });
+    return result;
+  }
+  const TypeBucket& bucket = type_bucket(type);
+  auto lock = LockShared(bucket.mutex);
+  return bucket.atoms;
+}
+
+size_t AtomSpace::CountAtomsByType(AtomType type) const {
+  size_t inherited = 0;
+  if (base_) {
+    inherited = base_->CountAtomsByType(type);
+    std::shared_lock<std::shared_mutex> lock(shadow_mutex_);
+    inherited -= hidden_per_type_[static_cast<size_t>(type)];
+  }
+  const TypeBucket& bucket = type_bucket(type);
+  auto lock = LockShared(bucket.mutex);
+  return inherited + bucket.atoms.size();
+}
+
+AtomSpace::MemoryStats AtomSpace::GetMemoryStats() const {
+  MemoryStats stats;
+  stats.atom_bytes = arena_->slab_bytes();
+  for (const IdShard& shard : id_shards_) {
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    stats.id_index_bytes += HashTableBytes(shard.atoms);
+    stats.incoming_index_bytes += HashTableBytes(shard.incoming);
+    for (const auto& pair : shard.incoming) {
+      stats.incoming_index_bytes += VectorBytes(pair.second);
+    }
+  }
+  for (const NameShard& shard : name_shards_) {
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    stats.name_index_bytes += HashTableBytes(shard.atoms);
+    for (const auto& pair : shard.atoms) {
+      stats.name_index_bytes += VectorBytes(pair.second);
+      // Atoms of one name share its pool entry.
+      const AtomName& name = pair.second.front()->pooled_name();
+      if (name.empty()) continue;
+      stats.string_bytes += name.allocated_bytes();
+      ++stats.distinct_names;
+    }
+  }
+  for (const LinkShard& shard : link_shards_) {
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    stats.link_index_bytes += HashTableBytes(shard.links);
+    for (const auto& pair : shard.links) {
+      stats.link_index_bytes += VectorBytes(pair.second);
+    }
+  }
+  for (const TypeBucket& bucket : type_buckets_) {
+    std::shared_lock<std::shared_mutex> lock(bucket.mutex);
+    stats.type_index_bytes += VectorBytes(bucket.atoms);
+    for (const auto& atom : bucket.atoms) {
+      if (!atom->IsLink()) continue;
+      const Link& link = static_cast<const Link&>(*atom);
+      stats.atom_bytes +=
+          VectorBytes(link.outgoing()) + VectorBytes(link.outgoing_handles());
+    }
+  }
+  return stats;
+}
+
 bool AtomSpace::RemoveAtom(uint64_t id) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  
-  auto it = atoms_by_id_.find(id);
-  if (it == atoms_by_id_.end()) return false;
-  
-  auto atom = it->second;
-  atoms_by_name_.erase(atom->name());
+  // Resolve the atom first so that the interning and name shard locks can be
+  // taken before the id shard lock, as required by the lock order.
+  std::shared_ptr<Atom> atom = GetAtom(id);
+  if (!atom) return false;
+  if (IsInherited(*atom)) return HideInherited(atom);
+
+  std::unique_lock<std::shared_mutex> link_lock;
+  LinkShard* links = nullptr;
+  if (atom->IsLink()) {
+    links = &link_shard(atom->content_hash());
+    link_lock = LockExclusive(links->mutex);
+  }
+  NameShard& names = name_shard(atom->name());
+  auto name_lock = LockExclusive(names.mutex);
+  {
+    IdShard& ids = id_shard(id);
+    std::unique_lock<std::shared_mutex> id_lock(ids.mutex);
+    // A concurrent RemoveAtom may have won the race.
+    if (ids.atoms.erase(id) == 0) return false;
+    ids.incoming.erase(id);
+  }
+  {
+    std::shared_lock<std::shared_mutex> version_lock(version_mutex_);
+    Retire({atom});
+  }
+  if (atom->IsLink()) RemoveFromIncomingSets(static_cast<const Link&>(*atom));
+
+  auto erase_from = [](auto& atoms, const Atom* target) {
+    auto it = std::find_if(atoms.begin(), atoms.end(), [target](const auto& a) {
+      return a.get() == target;
+    });
+    if (it != atoms.end()) atoms.erase(it);
+  };
+
+  auto name_it = names.atoms.find(atom->name());
+  if (name_it != names.atoms.end()) {
+    erase_from(name_it->second, atom.get());
+    if (name_it->second.empty()) names.atoms.erase(name_it);
+  }
+  if (links) {
+    auto hash_it = links->links.find(atom->content_hash());
+    if (hash_it != links->links.end()) {
+      erase_from(hash_it->second, atom.get());
+      if (hash_it->second.empty()) links->links.erase(hash_it);
+    }
+  }
   
   // Remove from type index
-  auto range = atoms_by_type_.equal_range(atom->type());
-  for (auto type_it = range.first; type_it != range.second; ++type_it) {
-    if (type_it->second->id() == id) {
-      atoms_by_type_.erase(type_it);
-      break;
+  {
+    TypeBucket& bucket = type_bucket(atom->type());
+    std::unique_lock<std::shared_mutex> type_lock(bucket.mutex);
+    uint32_t slot = atom->type_index_slot_;
+    if (slot + 1 != bucket.atoms.size()) {
+      bucket.atoms[slot] = std::move(bucket.atoms.back());
+      bucket.atoms[slot]->type_index_slot_ = slot;
     }
+    bucket.atoms.pop_back();
   }
   
-  atoms_by_id_.erase(it);
+  size_.fetch_sub(1, std::memory_order_relaxed);
+  NotifyObservers(
+      [&atom](Observer* observer) { observer->OnAtomRemoved(atom); });
   return true;
 }
 
+size_t AtomSpace::RemoveAtoms(const std::vector<uint64_t>& ids,
+                              size_t parallelism) {
+  TRACE_EVENT1("opencog", "AtomSpace::RemoveAtoms", "ids", ids.size());
+  auto locks = LockAllShards();
+
+  // Close |ids| over the incoming sets: atoms of this layer to remove, and
+  // inherited ones to hide.
+  std::vector<std::shared_ptr<Atom>> removed;
+  std::vector<std::shared_ptr<Atom>> hidden;
+  std::unordered_set<uint64_t> seen;
+  std::vector<uint64_t> pending(ids.begin(), ids.end());
+  while (!pending.empty()) {
+    uint64_t id = pending.back();
+    pending.pop_back();
+    if (!seen.insert(id).second) continue;
+    const IdShard& shard = id_shard(id);
+    auto atom_it = shard.atoms.find(id);
+    if (atom_it != shard.atoms.end()) {
+      removed.push_back(atom_it->second);
+    } else {
+      std::shared_ptr<Atom> inherited;
+      if (base_ && !IsHidden(id)) inherited = base_->GetAtom(id);
+      if (!inherited) continue;
+      hidden.push_back(std::move(inherited));
+      for (const auto& link : base_->GetIncomingSet(id)) {
+        pending.push_back(link->id());
+      }
+    }
+    auto incoming_it = shard.incoming.find(id);
+    if (incoming_it == shard.incoming.end()) continue;
+    for (const auto& link : incoming_it->second) {
+      pending.push_back(link->id());
+    }
+  }
+  if (removed.empty() && hidden.empty()) return 0;
+
+  // What each index shard has to purge.
+  std::unordered_set<const Atom*> doomed;
+  std::array<std::vector<uint64_t>, kShardCount> ids_per_shard;
+  // Surviving atoms whose incoming set names a removed link.
+  std::array<std::vector<uint64_t>, kShardCount> unlinked_per_shard;
+  std::array<std::vector<const Atom*>, kShardCount> names_per_shard;
+  std::array<std::vector<size_t>, kShardCount> hashes_per_shard;
+  std::array<bool, kAtomTypeCount> types{};
+  for (const auto& atom : hidden) {
+    ids_per_shard[atom->id() & (kShardCount - 1)].push_back(atom->id());
+  }
+  for (const auto& atom : removed) {
+    doomed.insert(atom.get());
+    ids_per_shard[atom->id() & (kShardCount - 1)].push_back(atom->id());
+    names_per_shard[&name_shard(atom->name()) - name_shards_.data()]
+        .push_back(atom.get());
+    types[static_cast<size_t>(atom->type())] = true;
+    if (!atom->IsLink()) continue;
+    const Link& link = static_cast<const Link&>(*atom);
+    hashes_per_shard[link.content_hash() & (kShardCount - 1)].push_back(
+        link.content_hash());
+    ForEachIndexedTarget(link, [&](const Atom& target) {
+      if (seen.count(target.id()) != 0) return;
+      unlinked_per_shard[target.id() & (kShardCount - 1)].push_back(
+          target.id());
+    });
+  }
+  auto is_doomed = [&doomed](const auto& atom) {
+    return doomed.count(atom.get()) != 0;
+  };
+
+  // Every shard is locked by this thread, so each can be purged by another
+  // one as long as no two touch the same shard.
+  auto purge = [&](size_t unit) {
+    if (unit < kShardCount) {
+      if (ids_per_shard[unit].empty() && unlinked_per_shard[unit].empty()) {
+        return;
+      }
+      IdShard& shard = id_shards_[unit];
+      for (uint64_t id : ids_per_shard[unit]) {
+        shard.atoms.erase(id);
+        shard.incoming.erase(id);
+      }
+      for (uint64_t id : unlinked_per_shard[unit]) {
+        auto it = shard.incoming.find(id);
+        if (it == shard.incoming.end()) continue;
+        auto& links = it->second;
+        links.erase(std::remove_if(links.begin(), links.end(), is_doomed),
+                    links.end());
+        if (links.empty()) {
+          shard.incoming.erase(it);
+        } else {
+          links.shrink_to_fit();
+        }
+      }
+      shard.atoms.rehash(0);
+      shard.incoming.rehash(0);
+    } else if (unit < 2 * kShardCount) {
+      unit -= kShardCount;
+      if (names_per_shard[unit].empty()) return;
+      NameShard& shard = name_shards_[unit];
+      for (const Atom* atom : names_per_shard[unit]) {
+        auto it = shard.atoms.find(atom->name());
+        // Already purged with an earlier atom of the same name.
+        if (it == shard.atoms.end()) continue;
+        auto& atoms = it->second;
+        atoms.erase(std::remove_if(atoms.begin(), atoms.end(), is_doomed),
+                    atoms.end());
+        if (atoms.empty()) {
+          shard.atoms.erase(it);
+        } else {
+          atoms.shrink_to_fit();
+        }
+      }
+      shard.atoms.rehash(0);
+    } else if (unit < 3 * kShardCount) {
+      unit -= 2 * kShardCount;
+      if (hashes_per_shard[unit].empty()) return;
+      LinkShard& shard = link_shards_[unit];
+      for (size_t content_hash : hashes_per_shard[unit]) {
+        auto it = shard.links.find(content_hash);
+        if (it == shard.links.end()) continue;
+        auto& links = it->second;
+        links.erase(std::remove_if(links.begin(), links.end(), is_doomed),
+                    links.end());
+        if (links.empty()) {
+          shard.links.erase(it);
+        } else {
+          links.shrink_to_fit();
+        }
+      }
+      shard.links.rehash(0);
+    } else {
+      unit -= 3 * kShardCount;
+      if (!types[unit]) return;
+      auto& atoms = type_buckets_[unit].atoms;
+      atoms.erase(std::remove_if(atoms.begin(), atoms.end(), is_doomed),
+                  atoms.end());
+      for (size_t slot = 0; slot < atoms.size(); ++slot) {
+        atoms[slot]->type_index_slot_ = static_cast<uint32_t>(slot);
+      }
+      atoms.shrink_to_fit();
+    }
+  };
+  constexpr size_t kUnits = 3 * kShardCount + kAtomTypeCount;
+  std::atomic<size_t> next_unit{0};
+  auto work = [&purge, &next_unit]() {
+    for (size_t unit; (unit = next_unit.fetch_add(1)) < kUnits;) purge(unit);
+  };
+  std::vector<std::thread> helpers;
+  for (size_t i = 1; i < std::min(parallelism, kUnits); ++i) {
+    helpers.emplace_back(work);
+  }
+  work();
+  for (std::thread& helper : helpers) helper.join();
+
+  size_.fetch_sub(removed.size(), std::memory_order_relaxed);
+  {
+    // One step for read views, together with the hidden set.
+    std::shared_lock<std::shared_mutex> version_lock(version_mutex_);
+    Retire(removed);
+    if (!hidden.empty()) {
+      std::unique_lock<std::shared_mutex> lock(shadow_mutex_);
+      for (const auto& atom : hidden) {
+        hidden_.insert(atom->id());
+        hidden_per_type_[static_cast<size_t>(atom->type())]++;
+        truth_overrides_.erase(atom->id());
+      }
+      hidden_count_.fetch_add(hidden.size(), std::memory_order_relaxed);
+      has_hidden_.store(true, std::memory_order_release);
+    }
+  }
+  for (const auto* atoms : {&removed, &hidden}) {
+    for (const auto& atom : *atoms) {
+      NotifyObservers(
+          [&atom](Observer* observer) { observer->OnAtomRemoved(atom); });
+    }
+  }
+  return removed.size() + hidden.size();
+}
+
 void AtomSpace::Clear() {
-  std::lock_guard<std::mutex> lock(mutex_);
-  atoms_by_id_.clear();
-  atoms_by_name_.clear();
-  atoms_by_type_.clear();
+  auto locks = LockAllShards();
+
+  std::vector<std::shared_ptr<Atom>> atoms;
+  atoms.reserve(size_.load(std::memory_order_relaxed));
+  for (LinkShard& shard : link_shards_) shard.links.clear();
+  for (NameShard& shard : name_shards_) shard.atoms.clear();
+  for (IdShard& shard : id_shards_) {
+    for (auto& pair : shard.atoms) atoms.push_back(std::move(pair.second));
+    shard.atoms.clear();
+    shard.incoming.clear();
+  }
+  for (TypeBucket& bucket : type_buckets_) bucket.atoms.clear();
+  size_.store(0, std::memory_order_relaxed);
+  {
+    // One step for read views, together with the hidden set.
+    std::shared_lock<std::shared_mutex> version_lock(version_mutex_);
+    Retire(std::move(atoms));
+    // Clearing a layer drops its delta; the base shows through again.
+    std::unique_lock<std::shared_mutex> lock(shadow_mutex_);
+    hidden_.clear();
+    hidden_per_type_.fill(0);
+    truth_overrides_.clear();
+    hidden_count_.store(0, std::memory_order_relaxed);
+    has_hidden_.store(false, std::memory_order_release);
+  }
+  NotifyObservers([](Observer* observer) { observer->OnCleared(); });
+}
+
+void AtomSpace::SetTruthValue(const std::shared_ptr<Atom>& atom,
+                              const TruthValue& tv) {
+  RestoreTruthValue(atom, tv);
+  NotifyObservers(
+      [&atom](Observer* observer) { observer->OnTruthValueChanged(atom); });
+}
+
+void AtomSpace::RestoreTruthValue(const std::shared_ptr<Atom>& atom,
+                                  const TruthValue& tv) {
+  if (!IsInherited(*atom)) {
+    atom->set_truth_value(tv);
+    return;
+  }
+  std::unique_lock<std::shared_mutex> lock(shadow_mutex_);
+  truth_overrides_[atom->id()] = tv;
+}
+
+std::vector<std::shared_ptr<Atom>> AtomSpace::GetOverriddenAtoms() const {
+  std::vector<uint64_t> ids;
+  {
+    std::shared_lock<std::shared_mutex> lock(shadow_mutex_);
+    ids.reserve(truth_overrides_.size());
+    for (const auto& pair : truth_overrides_) ids.push_back(pair.first);
+  }
+  std::vector<std::shared_ptr<Atom>> atoms;
+  atoms.reserve(ids.size());
+  for (uint64_t id : ids) {
+    if (std::shared_ptr<Atom> atom = base_->GetAtom(id)) {
+      atoms.push_back(std::move(atom));
+    }
+  }
+  return atoms;
+}
+
+TruthValue AtomSpace::GetTruthValue(const Atom& atom) const {
+  if (!IsInherited(atom)) return atom.truth_value();
+  {
+    std::shared_lock<std::shared_mutex> lock(shadow_mutex_);
+    auto it = truth_overrides_.find(atom.id());
+    if (it != truth_overrides_.end()) return it->second;
+  }
+  return base_->GetTruthValue(atom);
+}
+
+void AtomSpace::AddObserver(Observer* observer) {
+  std::unique_lock<std::shared_mutex> lock(observers_mutex_);
+  observers_.push_back(observer);
+  has_observers_.store(true, std::memory_order_release);
+}
+
+void AtomSpace::RemoveObserver(Observer* observer) {
+  std::unique_lock<std::shared_mutex> lock(observers_mutex_);
+  observers_.erase(std::remove(observers_.begin(), observers_.end(), observer),
+                   observers_.end());
+  has_observers_.store(!observers_.empty(), std::memory_order_release);
 }
 
 size_t AtomSpace::Size() const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  return atoms_by_id_.size();
+  size_t inherited = 0;
+  if (base_) {
+    inherited =
+        base_->Size() - hidden_count_.load(std::memory_order_relaxed);
+  }
+  return inherited + DeltaSize();
+}
+
+size_t AtomSpace::DeltaSize() const {
+  return size_.load(std::memory_order_relaxed);
 }
 
 std::vector<std::shared_ptr<Atom>> AtomSpace::Query(
     const std::function<bool(const std::shared_ptr<Atom>&)>& predicate) const {
-  std::lock_guard<std::mutex> lock(mutex_);
   std::vector<std::shared_ptr<Atom>> result;
-  
-  for (const auto& pair : atoms_by_id_) {
-    if (predicate(pair.second)) {
-      result.push_back(pair.second);
+  if (base_) {
+    std::unordered_set<uint64_t> hidden = HiddenIds();
+    result = base_->Query(
+        [&hidden, &predicate](const std::shared_ptr<Atom>& atom) {
+          return hidden.count(atom->id()) == 0 && predicate(atom);
+        });
+  }
+
+  // Shards are visited one at a time so that writers to other shards can make
+  // progress while the predicate runs.
+  for (const IdShard& shard : id_shards_) {
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    for (const auto& pair : shard.atoms) {
+      if (predicate(pair.second)) {
+        result.push_back(pair.second);
+      }
     }
   }
   
   return result;
 }
 
+std::vector<std::shared_ptr<Link>> AtomSpace::GetIncomingSet(
+    uint64_t id) const {
+  std::vector<std::shared_ptr<Link>> result;
+  if (id < base_id_limit_ && !IsHidden(id)) {
+    result = base_->GetIncomingSet(id);
+    if (has_hidden_.load(std::memory_order_acquire)) {
+      result.erase(std::remove_if(result.begin(), result.end(),
+                                  [this](const std::shared_ptr<Link>& link) {
+                                    return IsHidden(link->id());
+                                  }),
+                   result.end());
+    }
+  }
+  const IdShard& shard = id_shard(id);
+  auto lock = LockShared(shard.mutex);
+  auto it = shard.incoming.find(id);
+  if (it == shard.incoming.end()) return result;
+  if (result.empty()) return it->second;
+  result.insert(result.end(), it->second.begin(), it->second.end());
+  return result;
+}
+
+size_t AtomSpace::IncomingSetSize(uint64_t id) const {
+  if (id < base_id_limit_ && has_hidden_.load(std::memory_order_acquire)) {
+    return GetIncomingSet(id).size();
+  }
+  size_t inherited = id < base_id_limit_ ? base_->IncomingSetSize(id) : 0;
+  const IdShard& shard = id_shard(id);
+  auto lock = LockShared(shard.mutex);
+  auto it = shard.incoming.find(id);
+  return inherited + ((it != shard.incoming.end()) ? it->second.size() : 0);
+}
+
+bool AtomPattern::Matches(const std::shared_ptr<Atom>& atom) const {
+  if (type && atom->type() != *type) return false;
+  if (name && atom->name() != *name) return false;
+  if (!outgoing.empty()) {
+    if (!atom->IsLink()) return false;
+    const auto& targets = static_cast<const Link&>(*atom).outgoing();
+    if (targets.size() != outgoing.size()) return false;
+    for (size_t i = 0; i < targets.size(); ++i) {
+      if (outgoing[i] && outgoing[i] != targets[i]) return false;
+    }
+  }
+  return !filter || filter(atom);
+}
+
+QueryPlan AtomSpace::PlanQuery(const AtomPattern& pattern) const {
+  QueryPlan plan;
+  if (pattern.name) {
+    plan.strategy = QueryPlan::Strategy::kNameLookup;
+    plan.estimated_candidates = 1;
+    return plan;
+  }
+
+  plan.strategy = QueryPlan::Strategy::kFullScan;
+  plan.estimated_candidates = Size();
+
+  for (const auto& target : pattern.outgoing) {
+    if (!target) continue;
+    size_t candidates = IncomingSetSize(target->id());
+    if (candidates < plan.estimated_candidates ||
+        plan.strategy != QueryPlan::Strategy::kIncomingSet) {
+      plan.strategy = QueryPlan::Strategy::kIncomingSet;
+      plan.estimated_candidates = candidates;
+      plan.anchor = target;
+    }
+  }
+
+  if (pattern.type) {
+    size_t candidates = CountAtomsByType(*pattern.type);
+    if (plan.strategy == QueryPlan::Strategy::kFullScan ||
+        candidates < plan.estimated_candidates) {
+      plan.strategy = QueryPlan::Strategy::kTypeScan;
+      plan.estimated_candidates = candidates;
+      plan.anchor = nullptr;
+    }
+  }
+
+  return plan;
+}
+
+std::vector<std::shared_ptr<Atom>> AtomSpace::Match(
+    const AtomPattern& pattern) const {
+  std::vector<std::shared_ptr<Atom>> result;
+  QueryPlan plan = PlanQuery(pattern);
+
+  switch (plan.strategy) {
+    case QueryPlan::Strategy::kNameLookup: {
+      auto atom = GetAtomByName(*pattern.name);
+      if (atom && pattern.Matches(atom)) result.push_back(atom);
+      break;
+    }
+    case QueryPlan::Strategy::kIncomingSet:
+      for (auto& link : GetIncomingSet(plan.anchor->id())) {
+        if (pattern.Matches(link)) result.push_back(std::move(link));
+      }
+      break;
+    case QueryPlan::Strategy::kTypeScan:
+      ForEachAtomOfType(*pattern.type,
+                        [&pattern, &result](const std::shared_ptr<Atom>& atom) {
+                          if (pattern.Matches(atom)) {
+                            result.push_back(atom);
+                          }
+                        });
+      break;
+    case QueryPlan::Strategy::kFullScan:
+      result = Query([&pattern](const std::shared_ptr<Atom>& atom) {
+        return pattern.Matches(atom);
+      });
+      break;
+  }
+
+  return result;
+}
+
 // AtomSpaceManager implementation
 AtomSpaceManager* AtomSpaceManager::GetInstance() {
   static AtomSpaceManager instance;
   return &instance;
 }
 
+void AtomSpaceManager::SetSharedBase(std::shared_ptr<const AtomSpace> base) {
+  std::lock_guard<std::mutex> lock(shared_base_mutex_);
+  shared_base_ = std::move(base);
+}
+
+std::shared_ptr<const AtomSpace> AtomSpaceManager::shared_base() const {
+  std::lock_guard<std::mutex> lock(shared_base_mutex_);
+  return shared_base_;
+}
+
 std::shared_ptr<AtomSpace> AtomSpaceManager::GetOrCreateAtomSpace(
     const std::string& tenant_id) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  
-  auto it = atomspaces_.find(tenant_id);
-  if (it != atomspaces_.end()) {
-    return it->second;
-  }
-  
-  auto atomspace = std::make_shared<AtomSpace>(tenant_id);
-  atomspaces_[tenant_id] = atomspace;
-  return atomspace;
+  if (auto atomspace = atomspaces_.Find(tenant_id)) return atomspace;
+  return atomspaces_.FindOrInsert(tenant_id, [this, &tenant_id]() {
+    return std::make_shared<AtomSpace>(tenant_id, shared_base());
+  });
 }
 
 std::shared_ptr<AtomSpace> AtomSpaceManager::GetAtomSpace(
     const std::string& tenant_id) const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  auto it = atomspaces_.find(tenant_id);
-  return (it != atomspaces_.end()) ? it->second : nullptr;
+  return atomspaces_.Find(tenant_id);
 }
 
 bool AtomSpaceManager::RemoveAtomSpace(const std::string& tenant_id) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  return atomspaces_.erase(tenant_id) > 0;
+  if (std::shared_ptr<AtomSpaceNode> distributed = node()) {
+    distributed->Remove(tenant_id);
+  }
+  return atomspaces_.Remove(tenant_id) != nullptr;
 }
 
 std::vector<std::string> AtomSpaceManager::GetTenantIds() const {
-  std::lock_guard<std::mutex> lock(mutex_);
   std::vector<std::string> ids;
-  ids.reserve(atomspaces_.size());
-  
-  for (const auto& pair : atomspaces_) {
-    ids.push_back(pair.first);
-  }
-  
+  atomspaces_.ForEach(
+      [&ids](const std::string& tenant_id, const std::shared_ptr<AtomSpace>&) {
+        ids.push_back(tenant_id);
+      });
   return ids;
 }
 
-size_t AtomSpaceManager::TenantCount() const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  return atomspaces_.size();
+size_t AtomSpaceManager::TenantCount() const { return atomspaces_.size(); }
+
+void AtomSpaceManager::SetTransport(AtomSpaceTransport* transport,
+                                    size_t self) {
+  std::shared_ptr<AtomSpaceNode> node;
+  if (transport != nullptr) {
+    // Partitions go into the tenants' regular AtomSpaces.
+    node = std::make_shared<AtomSpaceNode>(
+        transport, self, [this](const std::string& tenant_id) {
+          return GetOrCreateAtomSpace(tenant_id);
+        });
+  }
+  std::lock_guard<std::mutex> lock(node_mutex_);
+  node_ = std::move(node);
+}
+
+std::shared_ptr<AtomSpaceNode> AtomSpaceManager::node() const {
+  std::lock_guard<std::mutex> lock(node_mutex_);
+  return node_;
+}
+
+std::shared_ptr<DistributedAtomSpace>
+AtomSpaceManager::GetOrCreateDistributedAtomSpace(
+    const std::string& tenant_id) {
+  std::shared_ptr<AtomSpaceNode> distributed = node();
+  return distributed ? distributed->GetOrCreate(tenant_id) : nullptr;
 }
 
 }  // namespace opencog
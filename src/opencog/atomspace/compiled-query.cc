@@ -0,0 +1,362 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/compiled-query.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "include/opencog/atomspace.h"
+
+namespace v8 {
+namespace opencog {
+
+size_t PatternQuery::variable_count() const {
+  size_t count = 0;
+  for (const PatternClause& clause : clauses) {
+    if (clause.variable) count = std::max<size_t>(count, *clause.variable + 1);
+    for (const PatternTerm& term : clause.outgoing) {
+      if (term.kind == PatternTerm::Kind::kVariable) {
+        count = std::max<size_t>(count, term.variable + 1);
+      }
+    }
+  }
+  return count;
+}
+
+// static
+std::string CompiledQuery::ShapeOf(const PatternQuery& query) {
+  std::string shape;
+  for (const PatternClause& clause : query.clauses) {
+    shape += '(';
+    shape += clause.type ? std::to_string(static_cast<int>(*clause.type)) : "*";
+    if (clause.name) shape += 'n';
+    if (clause.variable) shape += '$' + std::to_string(*clause.variable);
+    for (const PatternTerm& term : clause.outgoing) {
+      switch (term.kind) {
+        case PatternTerm::Kind::kAny:
+          shape += " _";
+          break;
+        case PatternTerm::Kind::kAtom:
+          shape += " a";
+          break;
+        case PatternTerm::Kind::kVariable:
+          shape += " $" + std::to_string(term.variable);
+          break;
+      }
+    }
+    shape += ')';
+  }
+  return shape;
+}
+
+// static
+CompiledQuery::Constants CompiledQuery::ConstantsOf(const PatternQuery& query) {
+  Constants constants;
+  for (const PatternClause& clause : query.clauses) {
+    if (clause.name) constants.names.push_back(&*clause.name);
+    for (const PatternTerm& term : clause.outgoing) {
+      if (term.kind == PatternTerm::Kind::kAtom) {
+        constants.atoms.push_back(term.atom);
+      }
+    }
+  }
+  return constants;
+}
+
+// static
+std::unique_ptr<CompiledQuery> CompiledQuery::Compile(
+    const AtomSpace& space, const PatternQuery& query) {
+  std::unique_ptr<CompiledQuery> plan(new CompiledQuery());
+  plan->shape_ = ShapeOf(query);
+  plan->variable_count_ = query.variable_count();
+  plan->compiled_for_size_ = space.Size();
+  const Constants constants = ConstantsOf(query);
+  plan->atom_count_ = constants.atoms.size();
+  plan->name_count_ = constants.names.size();
+
+  // Constant slots of each clause: its name, and the atom of each position.
+  const size_t clause_count = query.clauses.size();
+  std::vector<uint32_t> name_slot(clause_count);
+  std::vector<std::vector<uint32_t>> atom_slot(clause_count);
+  {
+    uint32_t names = 0, atoms = 0;
+    for (size_t c = 0; c < clause_count; ++c) {
+      const PatternClause& clause = query.clauses[c];
+      if (clause.name) name_slot[c] = names++;
+      atom_slot[c].resize(clause.outgoing.size());
+      for (size_t i = 0; i < clause.outgoing.size(); ++i) {
+        if (clause.outgoing[i].kind == PatternTerm::Kind::kAtom) {
+          atom_slot[c][i] = atoms++;
+        }
+      }
+    }
+  }
+
+  const size_t space_size = std::max<size_t>(space.Size(), 1);
+  std::vector<bool> bound(plan->variable_count_, false);
+  std::vector<bool> placed(clause_count, false);
+  for (size_t step_index = 0; step_index < clause_count; ++step_index) {
+    Step best;
+    size_t best_estimate = std::numeric_limits<size_t>::max();
+    for (size_t c = 0; c < clause_count; ++c) {
+      if (placed[c]) continue;
+      const PatternClause& clause = query.clauses[c];
+      Step step;
+      step.clause = c;
+      step.access = Access::kFullScan;
+      size_t estimate = space.Size();
+      auto consider = [&](Access access, uint32_t anchor, bool is_variable,
+                          size_t candidates) {
+        // Any index beats a full scan of the same size; otherwise the first
+        // access path considered wins ties.
+        if (candidates > estimate ||
+            (candidates == estimate && step.access != Access::kFullScan)) {
+          return;
+        }
+        step.access = access;
+        step.anchor = anchor;
+        step.anchor_is_variable = is_variable;
+        estimate = candidates;
+      };
+
+      if (clause.variable && bound[*clause.variable]) {
+        consider(Access::kBound, *clause.variable, true, 1);
+      }
+      if (clause.name) {
+        consider(Access::kNameLookup, name_slot[c], false,
+                 space.GetAtomsByName(*clause.name).size());
+      }
+      for (size_t i = 0; i < clause.outgoing.size(); ++i) {
+        const PatternTerm& term = clause.outgoing[i];
+        if (term.kind == PatternTerm::Kind::kAtom && term.atom) {
+          consider(Access::kIncomingSet, atom_slot[c][i], false,
+                   space.IncomingSetSize(term.atom->id()));
+        } else if (term.kind == PatternTerm::Kind::kVariable &&
+                   bound[term.variable]) {
+          // The binding is unknown until run time; assume the links of the
+          // clause's type spread evenly over the AtomSpace.
+          size_t links =
+              clause.type ? space.CountAtomsByType(*clause.type) : space.Size();
+          consider(Access::kIncomingSet, term.variable, true,
+                   std::max<size_t>(
+                       links * clause.outgoing.size() / space_size, 1));
+        }
+      }
+      if (clause.type) {
+        consider(Access::kTypeScan, static_cast<uint32_t>(*clause.type), false,
+                 space.CountAtomsByType(*clause.type));
+      }
+
+      if (estimate < best_estimate) {
+        best = std::move(step);
+        best_estimate = estimate;
+      }
+    }
+
+    // Lower the checks of the chosen clause, skipping what its access path
+    // already guarantees.
+    const PatternClause& clause = query.clauses[best.clause];
+    std::vector<Instruction>& program = best.program;
+    if (clause.type && best.access != Access::kTypeScan) {
+      program.push_back(
+          {Op::kCheckType, 0, static_cast<uint32_t>(*clause.type)});
+    }
+    if (clause.name && best.access != Access::kNameLookup) {
+      program.push_back({Op::kCheckName, 0, name_slot[best.clause]});
+    }
+    if (!clause.outgoing.empty()) {
+      program.push_back(
+          {Op::kCheckArity, 0, static_cast<uint32_t>(clause.outgoing.size())});
+    }
+    for (uint32_t i = 0; i < clause.outgoing.size(); ++i) {
+      const PatternTerm& term = clause.outgoing[i];
+      if (term.kind == PatternTerm::Kind::kAtom) {
+        program.push_back(
+            {Op::kCheckOutgoingAtom, i, atom_slot[best.clause][i]});
+      } else if (term.kind == PatternTerm::Kind::kVariable) {
+        program.push_back({bound[term.variable] ? Op::kCheckOutgoingVariable
+                                                : Op::kBindOutgoing,
+                           i, term.variable});
+        bound[term.variable] = true;
+      }
+    }
+    if (clause.variable && best.access != Access::kBound) {
+      program.push_back({bound[*clause.variable] ? Op::kCheckSelf
+                                                 : Op::kBindSelf,
+                         0, *clause.variable});
+      bound[*clause.variable] = true;
+    }
+
+    placed[best.clause] = true;
+    plan->steps_.push_back(std::move(best));
+  }
+  return plan;
+}
+
+std::vector<QueryBindings> CompiledQuery::Execute(
+    const AtomSpace& space, const PatternQuery& query) const {
+  std::vector<QueryBindings> results;
+  Constants constants = ConstantsOf(query);
+  if (constants.atoms.size() != atom_count_ ||
+      constants.names.size() != name_count_) {
+    return results;
+  }
+  // A constant that is not an atom matches nothing.
+  for (const auto& atom : constants.atoms) {
+    if (!atom) return results;
+  }
+  QueryBindings bindings(variable_count_);
+  Join(space, 0, constants, &bindings, &results);
+  return results;
+}
+
+std::vector<size_t> CompiledQuery::ClauseOrder() const {
+  std::vector<size_t> order;
+  for (const Step& step : steps_) order.push_back(step.clause);
+  return order;
+}
+
+std::vector<std::shared_ptr<Atom>> CompiledQuery::Candidates(
+    const AtomSpace& space, const Step& step, const Constants& constants,
+    const QueryBindings& bindings) const {
+  switch (step.access) {
+    case Access::kBound:
+      return {bindings[step.anchor]};
+    case Access::kNameLookup:
+      return space.GetAtomsByName(*constants.names[step.anchor]);
+    case Access::kIncomingSet: {
+      const std::shared_ptr<Atom>& anchor = step.anchor_is_variable
+                                                ? bindings[step.anchor]
+                                                : constants.atoms[step.anchor];
+      std::vector<std::shared_ptr<Link>> links =
+          space.GetIncomingSet(anchor->id());
+      return std::vector<std::shared_ptr<Atom>>(links.begin(), links.end());
+    }
+    case Access::kTypeScan:
+      return space.GetAtomsByType(static_cast<AtomType>(step.anchor));
+    case Access::kFullScan:
+      return space.Query([](const std::shared_ptr<Atom>&) { return true; });
+  }
+  return {};
+}
+
+// static
+bool CompiledQuery::Run(const std::vector<Instruction>& program,
+                        const std::shared_ptr<Atom>& atom,
+                        const Constants& constants, QueryBindings* bindings) {
+  const Link* link = nullptr;
+  for (const Instruction& instruction : program) {
+    switch (instruction.op) {
+      case Op::kCheckType:
+        if (atom->type() != static_cast<AtomType>(instruction.operand)) {
+          return false;
+        }
+        break;
+      case Op::kCheckName:
+        if (atom->name() != *constants.names[instruction.operand]) return false;
+        break;
+      case Op::kCheckArity:
+        if (!atom->IsLink()) return false;
+        link = static_cast<const Link*>(atom.get());
+        if (link->outgoing().size() != instruction.operand) return false;
+        break;
+      case Op::kCheckOutgoingAtom:
+        if (link->outgoing()[instruction.index] !=
+            constants.atoms[instruction.operand]) {
+          return false;
+        }
+        break;
+      case Op::kCheckOutgoingVariable:
+        if (link->outgoing()[instruction.index] !=
+            (*bindings)[instruction.operand]) {
+          return false;
+        }
+        break;
+      case Op::kBindOutgoing:
+        (*bindings)[instruction.operand] = link->outgoing()[instruction.index];
+        break;
+      case Op::kCheckSelf:
+        if ((*bindings)[instruction.operand] != atom) return false;
+        break;
+      case Op::kBindSelf:
+        (*bindings)[instruction.operand] = atom;
+        break;
+    }
+  }
+  return true;
+}
+
+void CompiledQuery::Join(const AtomSpace& space, size_t step,
+                         const Constants& constants, QueryBindings* bindings,
+                         std::vector<QueryBindings>* results) const {
+  if (step == steps_.size()) {
+    results->push_back(*bindings);
+    return;
+  }
+  // Variables are bound statically per step, so a candidate that fails
+  // halfway leaves nothing to undo: later candidates rebind the same
+  // variables before anything reads them.
+  for (const auto& candidate :
+       Candidates(space, steps_[step], constants, *bindings)) {
+    if (Run(steps_[step].program, candidate, constants, bindings)) {
+      Join(space, step + 1, constants, bindings, results);
+    }
+  }
+}
+
+QueryCache::QueryCache(const AtomSpace* space) : QueryCache(space, Options()) {}
+
+QueryCache::QueryCache(const AtomSpace* space, const Options& options)
+    : space_(space), options_(options) {}
+
+std::shared_ptr<const CompiledQuery> QueryCache::Get(
+    const PatternQuery& query) {
+  std::string shape = CompiledQuery::ShapeOf(query);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = plans_.find(shape);
+    if (it != plans_.end() && !IsStale(*it->second)) {
+      ++hits_;
+      return it->second;
+    }
+  }
+  // Compile outside the lock; a racing compilation of the same shape just
+  // replaces an equivalent plan.
+  std::shared_ptr<const CompiledQuery> plan =
+      CompiledQuery::Compile(*space_, query);
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++compilations_;
+  if (plans_.size() >= options_.capacity && plans_.count(shape) == 0) {
+    plans_.clear();
+  }
+  plans_[std::move(shape)] = plan;
+  return plan;
+}
+
+size_t QueryCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return plans_.size();
+}
+
+size_t QueryCache::hits() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return hits_;
+}
+
+size_t QueryCache::compilations() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return compilations_;
+}
+
+bool QueryCache::IsStale(const CompiledQuery& plan) const {
+  const size_t then = std::max<size_t>(plan.compiled_for_size(), 1);
+  const size_t now = std::max<size_t>(space_->Size(), 1);
+  return now > then * options_.replan_factor ||
+         then > now * options_.replan_factor;
+}
+
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,662 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/distributed-atomspace.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace v8 {
+namespace opencog {
+
+namespace {
+
+// The atom of |space| with the content of |atom|, which may come from
+// another AtomSpace.
+std::shared_ptr<Atom> FindByContent(const AtomSpace& space,
+                                    const std::shared_ptr<Atom>& atom) {
+  if (space.GetAtom(atom->id()) == atom) return atom;
+  if (!atom->IsLink()) return space.GetNode(atom->type(), atom->name());
+  std::vector<std::shared_ptr<Atom>> outgoing;
+  for (const auto& target : static_cast<const Link&>(*atom).outgoing()) {
+    std::shared_ptr<Atom> found = FindByContent(space, target);
+    if (!found) return nullptr;
+    outgoing.push_back(std::move(found));
+  }
+  return space.GetLink(atom->type(), outgoing);
+}
+
+// Adds the atom with the content of |atom| to |space|, with its outgoing
+// atoms, unless it is there already.
+std::shared_ptr<Atom> CopyInto(AtomSpace* space,
+                               const std::shared_ptr<Atom>& atom) {
+  if (!atom->IsLink()) return space->AddNode(atom->type(), atom->name());
+  std::vector<std::shared_ptr<Atom>> outgoing;
+  for (const auto& target : static_cast<const Link&>(*atom).outgoing()) {
+    outgoing.push_back(CopyInto(space, target));
+  }
+  return space->AddLink(atom->type(), atom->name(), outgoing);
+}
+
+}  // namespace
+
+std::vector<PartitionResponse> AtomSpaceTransport::CallEach(
+    const std::vector<std::pair<size_t, PartitionRequest>>& calls) {
+  std::vector<PartitionResponse> responses;
+  responses.reserve(calls.size());
+  for (const auto& [node, request] : calls) {
+    responses.push_back(Call(node, request));
+  }
+  return responses;
+}
+
+PartitionResponse LoopbackTransport::Call(size_t node,
+                                          const PartitionRequest& request) {
+  call_count_.fetch_add(1, std::memory_order_relaxed);
+  return endpoints_[node]->HandlePartitionRequest(request);
+}
+
+void LoopbackTransport::Broadcast(const PartitionInvalidation& invalidation) {
+  for (size_t node = 0; node < endpoints_.size(); ++node) {
+    if (node != invalidation.from && endpoints_[node] != nullptr) {
+      endpoints_[node]->HandleInvalidation(invalidation);
+    }
+  }
+}
+
+AtomSpacePartition::AtomSpacePartition(std::shared_ptr<AtomSpace> space,
+                                       AtomSpaceTransport* transport,
+                                       size_t self)
+    : space_(std::move(space)),
+      transport_(transport),
+      self_(self),
+      partitioner_(transport->node_count()) {
+  space_->AddObserver(this);
+}
+
+AtomSpacePartition::~AtomSpacePartition() { space_->RemoveObserver(this); }
+
+PartitionResponse AtomSpacePartition::Handle(const PartitionRequest& request) {
+  PartitionResponse response;
+  switch (request.kind) {
+    case PartitionRequest::Kind::kAdd:
+    case PartitionRequest::Kind::kGet:
+      response.atoms = Resolve(request.batch,
+                               request.kind == PartitionRequest::Kind::kAdd);
+      break;
+    case PartitionRequest::Kind::kRemove:
+      for (const auto& atom : Resolve(request.batch, false)) {
+        if (atom && Owns(*atom) && space_->RemoveAtom(atom->id())) {
+          ++response.count;
+        }
+      }
+      break;
+    case PartitionRequest::Kind::kSetTruthValue: {
+      std::vector<std::shared_ptr<Atom>> atoms = Resolve(request.batch, false);
+      for (size_t i = 0; i < atoms.size() && i < request.truth_values.size();
+           ++i) {
+        if (!atoms[i] || !Owns(*atoms[i])) continue;
+        space_->SetTruthValue(atoms[i], request.truth_values[i]);
+        ++response.count;
+      }
+      break;
+    }
+    case PartitionRequest::Kind::kMatch: {
+      AtomPattern pattern = request.pattern;
+      bool bound = true;
+      for (auto& target : pattern.outgoing) {
+        if (target && !(target = Find(target))) bound = false;
+      }
+      // A bound atom missing here is in no link here either.
+      if (!bound) break;
+      // Replicas are matched by their owners.
+      pattern.filter = [this](const std::shared_ptr<Atom>& atom) {
+        return Owns(*atom);
+      };
+      response.atoms = space_->Match(pattern);
+      break;
+    }
+    case PartitionRequest::Kind::kSize:
+      response.count = OwnedCount();
+      break;
+  }
+  response.truth_values.reserve(response.atoms.size());
+  for (const auto& atom : response.atoms) {
+    response.truth_values.push_back(atom ? space_->GetTruthValue(*atom)
+                                         : TruthValue());
+  }
+  FlushInvalidations();
+  return response;
+}
+
+void AtomSpacePartition::FlushInvalidations() {
+  PartitionInvalidation invalidation;
+  {
+    std::lock_guard<std::mutex> lock(pending_mutex_);
+    if (pending_.empty() && !pending_all_) return;
+    invalidation.content_hashes.swap(pending_);
+    invalidation.all = pending_all_;
+    pending_all_ = false;
+  }
+  invalidation.tenant_id = space_->tenant_id();
+  invalidation.from = self_;
+  transport_->Broadcast(invalidation);
+}
+
+std::shared_ptr<Atom> AtomSpacePartition::Find(
+    const std::shared_ptr<Atom>& atom) const {
+  return FindByContent(*space_, atom);
+}
+
+size_t AtomSpacePartition::OwnedCount() const {
+  size_t count = 0;
+  for (size_t type = 0; type < kAtomTypeCount; ++type) {
+    space_->ForEachAtomOfType(
+        static_cast<AtomType>(type),
+        [this, &count](const std::shared_ptr<Atom>& atom) {
+          if (Owns(*atom)) ++count;
+        });
+  }
+  return count;
+}
+
+void AtomSpacePartition::OnAtomRemoved(const std::shared_ptr<Atom>& atom) {
+  if (Owns(*atom)) Invalidate(*atom);
+}
+
+void AtomSpacePartition::OnTruthValueChanged(
+    const std::shared_ptr<Atom>& atom) {
+  if (Owns(*atom)) Invalidate(*atom);
+}
+
+void AtomSpacePartition::OnCleared() {
+  std::lock_guard<std::mutex> lock(pending_mutex_);
+  pending_.clear();
+  pending_all_ = true;
+}
+
+std::vector<std::shared_ptr<Atom>> AtomSpacePartition::Resolve(
+    const AtomBatch& batch, bool create) {
+  const std::vector<AtomBatch::Entry>& entries = batch.entries();
+  std::vector<std::shared_ptr<Atom>> atoms(entries.size());
+  if (!create) {
+    for (size_t i = 0; i < entries.size(); ++i) {
+      const AtomBatch::Entry& entry = entries[i];
+      switch (entry.kind) {
+        case AtomBatch::EntryKind::kNode:
+          atoms[i] = space_->GetNode(entry.type, entry.name);
+          break;
+        case AtomBatch::EntryKind::kLink: {
+          std::vector<std::shared_ptr<Atom>> outgoing;
+          for (AtomBatch::Ref ref : entry.outgoing) {
+            if (!atoms[ref]) break;
+            outgoing.push_back(atoms[ref]);
+          }
+          if (outgoing.size() == entry.outgoing.size()) {
+            atoms[i] = space_->GetLink(entry.type, outgoing);
+          }
+          break;
+        }
+        case AtomBatch::EntryKind::kExisting:
+          atoms[i] = Find(entry.existing);
+          break;
+      }
+    }
+    return atoms;
+  }
+
+  // Atoms of other AtomSpaces are copied by content, in the same batch.
+  AtomBatch local(entries.size());
+  std::vector<AtomBatch::Ref> refs(entries.size());
+  std::unordered_map<const Atom*, AtomBatch::Ref> copied;
+  std::function<AtomBatch::Ref(const std::shared_ptr<Atom>&)> copy =
+      [this, &local, &copied, &copy](const std::shared_ptr<Atom>& atom) {
+        auto it = copied.find(atom.get());
+        if (it != copied.end()) return it->second;
+        AtomBatch::Ref ref;
+        if (space_->GetAtom(atom->id()) == atom) {
+          ref = local.AddExisting(atom);
+        } else if (!atom->IsLink()) {
+          ref = local.AddNode(atom->type(), atom->name());
+        } else {
+          std::vector<AtomBatch::Ref> outgoing;
+          const Link& link = static_cast<const Link&>(*atom);
+          for (const auto& target : link.outgoing()) {
+            outgoing.push_back(copy(target));
+          }
+          ref = local.AddLink(atom->type(), atom->name(), std::move(outgoing));
+        }
+        copied.emplace(atom.get(), ref);
+        return ref;
+      };
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const AtomBatch::Entry& entry = entries[i];
+    switch (entry.kind) {
+      case AtomBatch::EntryKind::kNode:
+        refs[i] = local.AddNode(entry.type, entry.name);
+        break;
+      case AtomBatch::EntryKind::kLink: {
+        std::vector<AtomBatch::Ref> outgoing;
+        for (AtomBatch::Ref ref : entry.outgoing) outgoing.push_back(refs[ref]);
+        refs[i] = local.AddLink(entry.type, entry.name, std::move(outgoing));
+        break;
+      }
+      case AtomBatch::EntryKind::kExisting:
+        refs[i] = copy(entry.existing);
+        break;
+    }
+  }
+  std::vector<std::shared_ptr<Atom>> committed = space_->Commit(local);
+  for (size_t i = 0; i < entries.size(); ++i) atoms[i] = committed[refs[i]];
+  return atoms;
+}
+
+void AtomSpacePartition::Invalidate(const Atom& atom) {
+  std::lock_guard<std::mutex> lock(pending_mutex_);
+  if (!pending_all_) pending_.push_back(atom.content_hash());
+}
+
+DistributedAtomSpace::DistributedAtomSpace(
+    std::shared_ptr<AtomSpacePartition> local, AtomSpaceTransport* transport)
+    : DistributedAtomSpace(std::move(local), transport, Options()) {}
+
+DistributedAtomSpace::DistributedAtomSpace(
+    std::shared_ptr<AtomSpacePartition> local, AtomSpaceTransport* transport,
+    const Options& options)
+    : local_(std::move(local)),
+      transport_(transport),
+      options_(options),
+      cache_(local_->space()->tenant_id() + "/cache") {}
+
+std::shared_ptr<Node> DistributedAtomSpace::AddNode(AtomType type,
+                                                    const std::string& name) {
+  AtomBatch batch(1);
+  batch.AddNode(type, name);
+  return std::static_pointer_cast<Node>(Commit(batch)[0]);
+}
+
+std::shared_ptr<Link> DistributedAtomSpace::AddLink(
+    AtomType type, const std::string& name,
+    const std::vector<std::shared_ptr<Atom>>& outgoing) {
+  AtomBatch batch(outgoing.size() + 1);
+  std::vector<AtomBatch::Ref> refs;
+  for (const auto& target : outgoing) refs.push_back(batch.AddExisting(target));
+  AtomBatch::Ref link = batch.AddLink(type, name, std::move(refs));
+  return std::static_pointer_cast<Link>(Commit(batch)[link]);
+}
+
+std::vector<std::shared_ptr<Atom>> DistributedAtomSpace::Commit(
+    const AtomBatch& batch) {
+  return RouteAndCall(batch, PartitionRequest::Kind::kAdd);
+}
+
+std::shared_ptr<Node> DistributedAtomSpace::GetNode(AtomType type,
+                                                    const std::string& name) {
+  size_t hash = Node::ContentHash(type, name);
+  if (local_->partitioner().OwnerOf(hash) != local_->self()) {
+    if (auto cached = FindCached(hash, cache_.GetNode(type, name))) {
+      return std::static_pointer_cast<Node>(cached);
+    }
+  }
+  AtomBatch batch(1);
+  batch.AddNode(type, name);
+  return std::static_pointer_cast<Node>(Fetch(batch)[0]);
+}
+
+std::shared_ptr<Link> DistributedAtomSpace::GetLink(
+    AtomType type, const std::vector<std::shared_ptr<Atom>>& outgoing) {
+  size_t hash = Link::ContentHash(type, outgoing);
+  if (local_->partitioner().OwnerOf(hash) != local_->self()) {
+    std::vector<std::shared_ptr<Atom>> copies;
+    for (const auto& target : outgoing) {
+      std::shared_ptr<Atom> copy = FindByContent(cache_, target);
+      if (!copy) break;
+      copies.push_back(std::move(copy));
+    }
+    if (copies.size() == outgoing.size()) {
+      if (auto cached = FindCached(hash, cache_.GetLink(type, copies))) {
+        return std::static_pointer_cast<Link>(cached);
+      }
+    }
+  }
+  AtomBatch batch(outgoing.size() + 1);
+  std::vector<AtomBatch::Ref> refs;
+  for (const auto& target : outgoing) refs.push_back(batch.AddExisting(target));
+  AtomBatch::Ref link = batch.AddLink(type, "", std::move(refs));
+  return std::static_pointer_cast<Link>(Fetch(batch)[link]);
+}
+
+std::vector<std::shared_ptr<Atom>> DistributedAtomSpace::Fetch(
+    const AtomBatch& batch) {
+  return RouteAndCall(batch, PartitionRequest::Kind::kGet);
+}
+
+bool DistributedAtomSpace::RemoveAtom(const std::shared_ptr<Atom>& atom) {
+  PartitionRequest request;
+  request.tenant_id = tenant_id();
+  request.kind = PartitionRequest::Kind::kRemove;
+  request.batch.AddExisting(atom);
+  size_t owner = local_->partitioner().OwnerOf(*atom);
+  size_t removed = CallEach({{owner, std::move(request)}})[0].count;
+  Drop(atom->content_hash());
+  return removed > 0;
+}
+
+void DistributedAtomSpace::SetTruthValue(const std::shared_ptr<Atom>& atom,
+                                         const TruthValue& tv) {
+  PartitionRequest request;
+  request.tenant_id = tenant_id();
+  request.kind = PartitionRequest::Kind::kSetTruthValue;
+  request.batch.AddExisting(atom);
+  request.truth_values.push_back(tv);
+  CallEach({{local_->partitioner().OwnerOf(*atom), std::move(request)}});
+  Drop(atom->content_hash());
+}
+
+TruthValue DistributedAtomSpace::GetTruthValue(
+    const std::shared_ptr<Atom>& atom) {
+  size_t owner = local_->partitioner().OwnerOf(*atom);
+  if (owner == local_->self()) {
+    std::shared_ptr<Atom> found = local_->Find(atom);
+    return found ? local_->space()->GetTruthValue(*found) : TruthValue();
+  }
+  std::shared_ptr<Atom> copy = FindByContent(cache_, atom);
+  if (copy && FindCached(atom->content_hash(), copy)) {
+    return cache_.GetTruthValue(*copy);
+  }
+  PartitionRequest request;
+  request.tenant_id = tenant_id();
+  request.kind = PartitionRequest::Kind::kGet;
+  request.batch.AddExisting(atom);
+  uint64_t since = epoch();
+  PartitionResponse response = CallEach({{owner, std::move(request)}})[0];
+  if (!response.atoms[0]) return TruthValue();
+  Receive(owner, response.atoms[0], response.truth_values[0], since);
+  return response.truth_values[0];
+}
+
+std::vector<std::shared_ptr<Atom>> DistributedAtomSpace::Match(
+    const AtomPattern& pattern) {
+  Calls calls;
+  for (size_t node = 0; node < local_->partitioner().node_count(); ++node) {
+    PartitionRequest request;
+    request.tenant_id = tenant_id();
+    request.kind = PartitionRequest::Kind::kMatch;
+    request.pattern.type = pattern.type;
+    request.pattern.name = pattern.name;
+    request.pattern.outgoing = pattern.outgoing;
+    calls.emplace_back(node, std::move(request));
+  }
+  uint64_t since = epoch();
+  std::vector<PartitionResponse> responses = CallEach(calls);
+  std::vector<std::shared_ptr<Atom>> matches;
+  for (size_t i = 0; i < responses.size(); ++i) {
+    const PartitionResponse& response = responses[i];
+    for (size_t j = 0; j < response.atoms.size(); ++j) {
+      std::shared_ptr<Atom> atom = Receive(calls[i].first, response.atoms[j],
+                                           response.truth_values[j], since);
+      if (!pattern.filter || pattern.filter(atom)) {
+        matches.push_back(std::move(atom));
+      }
+    }
+  }
+  return matches;
+}
+
+size_t DistributedAtomSpace::Size() {
+  Calls calls;
+  for (size_t node = 0; node < local_->partitioner().node_count(); ++node) {
+    PartitionRequest request;
+    request.tenant_id = tenant_id();
+    request.kind = PartitionRequest::Kind::kSize;
+    calls.emplace_back(node, std::move(request));
+  }
+  size_t size = 0;
+  for (const PartitionResponse& response : CallEach(calls)) {
+    size += response.count;
+  }
+  return size;
+}
+
+void DistributedAtomSpace::Invalidate(
+    const PartitionInvalidation& invalidation) {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  ++epoch_;
+  const AtomPartitioner& partitioner = local_->partitioner();
+  if (invalidation.all) {
+    std::vector<size_t> stale;
+    for (const auto& pair : cached_) {
+      if (partitioner.OwnerOf(pair.first) == invalidation.from) {
+        stale.push_back(pair.first);
+      }
+    }
+    for (size_t hash : stale) DropLocked(hash);
+    return;
+  }
+  for (size_t hash : invalidation.content_hashes) {
+    // Another node's atom with a colliding hash stays.
+    if (partitioner.OwnerOf(hash) == invalidation.from) DropLocked(hash);
+  }
+}
+
+size_t DistributedAtomSpace::cached_count() const {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  return cached_.size();
+}
+
+std::vector<PartitionResponse> DistributedAtomSpace::CallEach(
+    const Calls& calls) {
+  std::vector<PartitionResponse> responses(calls.size());
+  Calls remote;
+  std::vector<size_t> remote_index;
+  for (size_t i = 0; i < calls.size(); ++i) {
+    if (calls[i].first == local_->self()) {
+      responses[i] = local_->Handle(calls[i].second);
+    } else {
+      remote.push_back(calls[i]);
+      remote_index.push_back(i);
+    }
+  }
+  if (remote.empty()) return responses;
+  std::vector<PartitionResponse> remote_responses =
+      transport_->CallEach(remote);
+  for (size_t i = 0; i < remote_index.size(); ++i) {
+    responses[remote_index[i]] = std::move(remote_responses[i]);
+  }
+  return responses;
+}
+
+std::vector<std::shared_ptr<Atom>> DistributedAtomSpace::RouteAndCall(
+    const AtomBatch& batch, PartitionRequest::Kind kind) {
+  const std::vector<AtomBatch::Entry>& entries = batch.entries();
+  const AtomPartitioner& partitioner = local_->partitioner();
+
+  // Content hashes, and from them owners, follow from the entries alone.
+  std::vector<size_t> hashes(entries.size());
+  for (size_t i = 0; i < entries.size(); ++i) {
+    const AtomBatch::Entry& entry = entries[i];
+    switch (entry.kind) {
+      case AtomBatch::EntryKind::kNode:
+        hashes[i] = Node::ContentHash(entry.type, entry.name);
+        break;
+      case AtomBatch::EntryKind::kLink: {
+        std::vector<size_t> outgoing;
+        for (AtomBatch::Ref ref : entry.outgoing) {
+          outgoing.push_back(hashes[ref]);
+        }
+        hashes[i] = Link::ContentHash(entry.type, outgoing);
+        break;
+      }
+      case AtomBatch::EntryKind::kExisting:
+        hashes[i] = entry.existing->content_hash();
+        break;
+    }
+  }
+
+  // One request per owner, holding its entries and those they refer to.
+  Calls calls;
+  std::unordered_map<size_t, size_t> call_of_node;
+  std::vector<std::unordered_map<AtomBatch::Ref, AtomBatch::Ref>> copied;
+  std::function<AtomBatch::Ref(size_t, AtomBatch::Ref)> copy =
+      [&entries, &calls, &copied, &copy](size_t call, AtomBatch::Ref ref) {
+        auto it = copied[call].find(ref);
+        if (it != copied[call].end()) return it->second;
+        const AtomBatch::Entry& entry = entries[ref];
+        AtomBatch& target = calls[call].second.batch;
+        AtomBatch::Ref copy_ref;
+        switch (entry.kind) {
+          case AtomBatch::EntryKind::kNode:
+            copy_ref = target.AddNode(entry.type, entry.name);
+            break;
+          case AtomBatch::EntryKind::kLink: {
+            std::vector<AtomBatch::Ref> outgoing;
+            for (AtomBatch::Ref out : entry.outgoing) {
+              outgoing.push_back(copy(call, out));
+            }
+            copy_ref = target.AddLink(entry.type, entry.name,
+                                      std::move(outgoing));
+            break;
+          }
+          case AtomBatch::EntryKind::kExisting:
+            copy_ref = target.AddExisting(entry.existing);
+            break;
+        }
+        copied[call].emplace(ref, copy_ref);
+        return copy_ref;
+      };
+  std::vector<std::pair<size_t, AtomBatch::Ref>> routes(entries.size());
+  for (size_t i = 0; i < entries.size(); ++i) {
+    size_t owner = partitioner.OwnerOf(hashes[i]);
+    auto [it, inserted] = call_of_node.emplace(owner, calls.size());
+    if (inserted) {
+      PartitionRequest request;
+      request.tenant_id = tenant_id();
+      request.kind = kind;
+      calls.emplace_back(owner, std::move(request));
+      copied.emplace_back();
+    }
+    routes[i] = {it->second, copy(it->second, i)};
+  }
+
+  uint64_t since = epoch();
+  std::vector<PartitionResponse> responses = CallEach(calls);
+  std::vector<std::shared_ptr<Atom>> atoms(entries.size());
+  for (size_t i = 0; i < entries.size(); ++i) {
+    auto [call, ref] = routes[i];
+    atoms[i] = Receive(calls[call].first, responses[call].atoms[ref],
+                       responses[call].truth_values[ref], since);
+  }
+  return atoms;
+}
+
+std::shared_ptr<Atom> DistributedAtomSpace::Receive(
+    size_t node, const std::shared_ptr<Atom>& atom, const TruthValue& tv,
+    uint64_t epoch) {
+  if (!atom || node == local_->self()) return atom;
+  std::shared_ptr<Atom> copy = CopyInto(&cache_, atom);
+  cache_.RestoreTruthValue(copy, tv);
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  // The response may predate an invalidation that has already arrived.
+  if (epoch != epoch_) return copy;
+  auto [it, inserted] = cached_.emplace(copy->content_hash(), copy);
+  if (!inserted) {
+    it->second = copy;
+    return copy;
+  }
+  cache_order_.push_back(copy->content_hash());
+  EvictLocked();
+  return copy;
+}
+
+std::shared_ptr<Atom> DistributedAtomSpace::FindCached(
+    size_t content_hash, std::shared_ptr<Atom> copy) const {
+  if (!copy) return nullptr;
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  auto it = cached_.find(content_hash);
+  return (it != cached_.end() && it->second == copy) ? copy : nullptr;
+}
+
+uint64_t DistributedAtomSpace::epoch() const {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  return epoch_;
+}
+
+void DistributedAtomSpace::Drop(size_t content_hash) {
+  std::lock_guard<std::mutex> lock(cache_mutex_);
+  ++epoch_;
+  DropLocked(content_hash);
+}
+
+void DistributedAtomSpace::DropLocked(size_t content_hash) {
+  auto it = cached_.find(content_hash);
+  if (it == cached_.end()) return;
+  std::shared_ptr<Atom> copy = std::move(it->second);
+  cached_.erase(it);
+  // Copies that cached links still point to stay for those.
+  if (cache_.IncomingSetSize(copy->id()) == 0) cache_.RemoveAtom(copy->id());
+}
+
+void DistributedAtomSpace::EvictLocked() {
+  const size_t capacity = std::max<size_t>(options_.cache_capacity, 1);
+  while (cached_.size() > capacity && !cache_order_.empty()) {
+    DropLocked(cache_order_.front());
+    cache_order_.pop_front();
+  }
+  // Invalidated entries leave their hash behind; compact once they pile up.
+  if (cache_order_.size() > 2 * capacity) {
+    std::unordered_set<size_t> seen;
+    std::deque<size_t> order;
+    for (size_t hash : cache_order_) {
+      if (cached_.count(hash) > 0 && seen.insert(hash).second) {
+        order.push_back(hash);
+      }
+    }
+    cache_order_.swap(order);
+  }
+}
+
+AtomSpaceNode::AtomSpaceNode(AtomSpaceTransport* transport, size_t self)
+    : AtomSpaceNode(transport, self, nullptr) {}
+
+AtomSpaceNode::AtomSpaceNode(AtomSpaceTransport* transport, size_t self,
+                             AtomSpaceFactory factory)
+    : transport_(transport), self_(self), factory_(std::move(factory)) {}
+
+std::shared_ptr<DistributedAtomSpace> AtomSpaceNode::GetOrCreate(
+    const std::string& tenant_id) {
+  if (auto space = tenants_.Find(tenant_id)) return space;
+  return tenants_.FindOrInsert(tenant_id, [this, &tenant_id]() {
+    std::shared_ptr<AtomSpace> space =
+        factory_ ? factory_(tenant_id) : std::make_shared<AtomSpace>(tenant_id);
+    return std::make_shared<DistributedAtomSpace>(
+        std::make_shared<AtomSpacePartition>(std::move(space), transport_,
+                                             self_),
+        transport_);
+  });
+}
+
+std::shared_ptr<DistributedAtomSpace> AtomSpaceNode::Find(
+    const std::string& tenant_id) const {
+  return tenants_.Find(tenant_id);
+}
+
+bool AtomSpaceNode::Remove(const std::string& tenant_id) {
+  return tenants_.Remove(tenant_id) != nullptr;
+}
+
+PartitionResponse AtomSpaceNode::HandlePartitionRequest(
+    const PartitionRequest& request) {
+  return GetOrCreate(request.tenant_id)->partition()->Handle(request);
+}
+
+void AtomSpaceNode::HandleInvalidation(
+    const PartitionInvalidation& invalidation) {
+  // A tenant that is not open here has nothing cached.
+  if (auto space = Find(invalidation.tenant_id)) {
+    space->Invalidate(invalidation);
+  }
+}
+
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,401 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/embedding-index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <utility>
+
+#include "hwy/highway.h"
+
+namespace v8 {
+namespace opencog {
+
+namespace {
+
+namespace hw = hwy::HWY_NAMESPACE;
+
+float Dot(const float* a, const float* b, size_t count) {
+  const hw::ScalableTag<float> d;
+  const size_t lanes = hw::Lanes(d);
+  auto sum = hw::Zero(d);
+  size_t i = 0;
+  for (; i + lanes <= count; i += lanes) {
+    sum = hw::MulAdd(hw::LoadU(d, a + i), hw::LoadU(d, b + i), sum);
+  }
+  float result = hw::ReduceSum(d, sum);
+  for (; i < count; ++i) result += a[i] * b[i];
+  return result;
+}
+
+float SquaredL2(const float* a, const float* b, size_t count) {
+  const hw::ScalableTag<float> d;
+  const size_t lanes = hw::Lanes(d);
+  auto sum = hw::Zero(d);
+  size_t i = 0;
+  for (; i + lanes <= count; i += lanes) {
+    const auto diff = hw::Sub(hw::LoadU(d, a + i), hw::LoadU(d, b + i));
+    sum = hw::MulAdd(diff, diff, sum);
+  }
+  float result = hw::ReduceSum(d, sum);
+  for (; i < count; ++i) result += (a[i] - b[i]) * (a[i] - b[i]);
+  return result;
+}
+
+}  // namespace
+
+void EmbeddingIndex::VisitedSet::Reset() {
+  if (++epoch_ == 0) {
+    std::fill(marks_.begin(), marks_.end(), 0);
+    epoch_ = 1;
+  }
+}
+
+bool EmbeddingIndex::VisitedSet::Visit(uint32_t node) {
+  if (marks_[node] == epoch_) return false;
+  marks_[node] = epoch_;
+  return true;
+}
+
+EmbeddingIndex::EmbeddingIndex(AtomSpace* space, size_t dimension)
+    : EmbeddingIndex(space, dimension, Options()) {}
+
+EmbeddingIndex::EmbeddingIndex(AtomSpace* space, size_t dimension,
+                               const Options& options)
+    : space_(space),
+      dimension_(dimension),
+      options_(options),
+      level_multiplier_(
+          1.0 / std::log(static_cast<double>(
+                    std::max<size_t>(options.max_neighbors, 2)))),
+      rng_(options.seed) {
+  space_->AddObserver(this);
+}
+
+EmbeddingIndex::~EmbeddingIndex() { space_->RemoveObserver(this); }
+
+bool EmbeddingIndex::Set(AtomHandle handle, const float* vector) {
+  if (!handle.is_valid()) return false;
+  std::vector<float> prepared(dimension_);
+  if (!Prepare(vector, prepared.data())) return false;
+
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  // Checked under the lock, so that a concurrent removal is either seen here
+  // or notified after the insertion.
+  if (space_->Resolve(handle) == nullptr) return false;
+  Mark(handle.value());
+  if (deleted_ > 0 && static_cast<double>(deleted_) >=
+                          options_.max_deleted_fraction * nodes_.size()) {
+    Rebuild();
+  }
+  Insert(handle, prepared.data());
+  return true;
+}
+
+bool EmbeddingIndex::Remove(AtomHandle handle) {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  uint32_t slot = handle.value();
+  if (!handle.is_valid() || slot >= node_of_.size() ||
+      node_of_[slot] == kNoNode) {
+    return false;
+  }
+  Mark(slot);
+  return true;
+}
+
+bool EmbeddingIndex::Contains(AtomHandle handle) const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return handle.is_valid() && handle.value() < node_of_.size() &&
+         node_of_[handle.value()] != kNoNode;
+}
+
+std::vector<float> EmbeddingIndex::Get(AtomHandle handle) const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  if (!handle.is_valid() || handle.value() >= node_of_.size() ||
+      node_of_[handle.value()] == kNoNode) {
+    return {};
+  }
+  const float* vector = vector_of(node_of_[handle.value()]);
+  return std::vector<float>(vector, vector + dimension_);
+}
+
+size_t EmbeddingIndex::size() const {
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  return nodes_.size() - deleted_;
+}
+
+std::vector<EmbeddingIndex::Neighbor> EmbeddingIndex::Search(
+    const float* query, size_t k, size_t ef) const {
+  std::vector<float> prepared(dimension_);
+  if (!Prepare(query, prepared.data())) return {};
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  VisitedSet visited(nodes_.size());
+  return SearchLocked(prepared.data(), k, ef, &visited);
+}
+
+std::vector<std::vector<EmbeddingIndex::Neighbor>> EmbeddingIndex::SearchBatch(
+    const float* queries, size_t count, size_t k, size_t ef) const {
+  std::vector<std::vector<Neighbor>> results(count);
+  std::vector<float> prepared(count * dimension_);
+  std::vector<bool> valid(count);
+  for (size_t i = 0; i < count; ++i) {
+    valid[i] = Prepare(queries + i * dimension_,
+                       prepared.data() + i * dimension_);
+  }
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  VisitedSet visited(nodes_.size());
+  for (size_t i = 0; i < count; ++i) {
+    if (!valid[i]) continue;
+    results[i] =
+        SearchLocked(prepared.data() + i * dimension_, k, ef, &visited);
+  }
+  return results;
+}
+
+std::vector<EmbeddingIndex::Neighbor> EmbeddingIndex::SearchExact(
+    const float* query, size_t k) const {
+  std::vector<float> prepared(dimension_);
+  if (!Prepare(query, prepared.data())) return {};
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  std::vector<Candidate> candidates;
+  candidates.reserve(nodes_.size() - deleted_);
+  for (uint32_t node = 0; node < nodes_.size(); ++node) {
+    if (nodes_[node].deleted) continue;
+    candidates.push_back(
+        Candidate{Distance(prepared.data(), vector_of(node)), node});
+  }
+  k = std::min(k, candidates.size());
+  std::partial_sort(candidates.begin(), candidates.begin() + k,
+                    candidates.end());
+  std::vector<Neighbor> result;
+  result.reserve(k);
+  for (size_t i = 0; i < k; ++i) {
+    result.push_back(
+        Neighbor{nodes_[candidates[i].node].handle, candidates[i].distance});
+  }
+  return result;
+}
+
+void EmbeddingIndex::Compact() {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  if (deleted_ > 0) Rebuild();
+}
+
+void EmbeddingIndex::OnAtomRemoved(const std::shared_ptr<Atom>& atom) {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  Mark(atom->handle().value());
+}
+
+void EmbeddingIndex::OnCleared() {
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  // A layered AtomSpace keeps its inherited atoms, and their embeddings.
+  for (uint32_t slot = 0; slot < node_of_.size(); ++slot) {
+    if (node_of_[slot] != kNoNode &&
+        space_->Resolve(AtomHandle(slot)) == nullptr) {
+      Mark(slot);
+    }
+  }
+  if (deleted_ == nodes_.size()) Reset();
+}
+
+float EmbeddingIndex::Distance(const float* a, const float* b) const {
+  if (options_.metric == Metric::kL2) return SquaredL2(a, b, dimension_);
+  return 1.0f - Dot(a, b, dimension_);
+}
+
+bool EmbeddingIndex::Prepare(const float* vector, float* out) const {
+  std::copy(vector, vector + dimension_, out);
+  if (options_.metric != Metric::kCosine) return true;
+  float norm = std::sqrt(Dot(out, out, dimension_));
+  if (!(norm > 0) || !std::isfinite(norm)) return false;
+  for (size_t i = 0; i < dimension_; ++i) out[i] /= norm;
+  return true;
+}
+
+void EmbeddingIndex::Insert(AtomHandle handle, const float* prepared) {
+  const uint32_t node = static_cast<uint32_t>(nodes_.size());
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  const int level = static_cast<int>(
+      std::floor(-std::log(1.0 - uniform(rng_)) * level_multiplier_));
+
+  vectors_.insert(vectors_.end(), prepared, prepared + dimension_);
+  nodes_.emplace_back();
+  nodes_[node].handle = handle;
+  nodes_[node].links.resize(level + 1);
+  if (handle.value() >= node_of_.size()) {
+    node_of_.resize(std::max<size_t>(handle.value() + 1, node_of_.size() * 2),
+                    kNoNode);
+  }
+  node_of_[handle.value()] = node;
+
+  if (entry_ == kNoNode) {
+    entry_ = node;
+    max_level_ = level;
+    return;
+  }
+
+  const float* vector = vector_of(node);
+  uint32_t entry = GreedyDescend(vector, level);
+  VisitedSet visited(nodes_.size());
+  for (int layer = std::min(level, max_level_); layer >= 0; --layer) {
+    std::vector<Candidate> candidates = SearchLayer(
+        vector, entry, options_.ef_construction, layer, &visited, false);
+    entry = candidates.front().node;
+    std::vector<uint32_t> neighbors =
+        SelectNeighbors(std::move(candidates), options_.max_neighbors);
+    for (uint32_t neighbor : neighbors) {
+      std::vector<uint32_t>& back = nodes_[neighbor].links[layer];
+      back.push_back(node);
+      if (back.size() <= MaxLinks(layer)) continue;
+      std::vector<Candidate> kept;
+      kept.reserve(back.size());
+      for (uint32_t other : back) {
+        kept.push_back(
+            Candidate{Distance(vector_of(neighbor), vector_of(other)), other});
+      }
+      back = SelectNeighbors(std::move(kept), MaxLinks(layer));
+    }
+    nodes_[node].links[layer] = std::move(neighbors);
+  }
+  if (level > max_level_) {
+    entry_ = node;
+    max_level_ = level;
+  }
+}
+
+void EmbeddingIndex::Mark(uint32_t slot) {
+  if (slot >= node_of_.size() || node_of_[slot] == kNoNode) return;
+  nodes_[node_of_[slot]].deleted = true;
+  node_of_[slot] = kNoNode;
+  ++deleted_;
+}
+
+void EmbeddingIndex::Rebuild() {
+  std::vector<float> vectors = std::move(vectors_);
+  std::vector<GraphNode> nodes = std::move(nodes_);
+  Reset();
+  for (uint32_t node = 0; node < nodes.size(); ++node) {
+    if (nodes[node].deleted) continue;
+    Insert(nodes[node].handle,
+           vectors.data() + static_cast<size_t>(node) * dimension_);
+  }
+}
+
+void EmbeddingIndex::Reset() {
+  vectors_.clear();
+  nodes_.clear();
+  std::fill(node_of_.begin(), node_of_.end(), kNoNode);
+  entry_ = kNoNode;
+  max_level_ = -1;
+  deleted_ = 0;
+}
+
+size_t EmbeddingIndex::MaxLinks(int layer) const {
+  return layer == 0 ? 2 * options_.max_neighbors : options_.max_neighbors;
+}
+
+std::vector<uint32_t> EmbeddingIndex::SelectNeighbors(
+    std::vector<Candidate> candidates, size_t max) const {
+  std::sort(candidates.begin(), candidates.end());
+  std::vector<uint32_t> selected;
+  selected.reserve(max);
+  for (const Candidate& candidate : candidates) {
+    if (selected.size() == max) break;
+    const float* vector = vector_of(candidate.node);
+    bool diverse = std::none_of(
+        selected.begin(), selected.end(), [&](uint32_t other) {
+          return Distance(vector, vector_of(other)) < candidate.distance;
+        });
+    if (diverse) selected.push_back(candidate.node);
+  }
+  return selected;
+}
+
+std::vector<EmbeddingIndex::Candidate> EmbeddingIndex::SearchLayer(
+    const float* query, uint32_t entry, size_t ef, int layer,
+    VisitedSet* visited, bool skip_deleted) const {
+  // Nearest candidate on top, and farthest result on top.
+  std::priority_queue<Candidate, std::vector<Candidate>,
+                      std::greater<Candidate>>
+      candidates;
+  std::priority_queue<Candidate> results;
+  auto bound = [&results, ef]() {
+    return results.size() < ef ? std::numeric_limits<float>::infinity()
+                               : results.top().distance;
+  };
+  auto offer = [&](uint32_t node, float distance) {
+    candidates.push(Candidate{distance, node});
+    // Marked nodes route the search but are not answers.
+    if (skip_deleted && nodes_[node].deleted) return;
+    results.push(Candidate{distance, node});
+    if (results.size() > ef) results.pop();
+  };
+
+  visited->Reset();
+  visited->Visit(entry);
+  offer(entry, Distance(query, vector_of(entry)));
+  while (!candidates.empty()) {
+    Candidate nearest = candidates.top();
+    if (nearest.distance > bound()) break;
+    candidates.pop();
+    for (uint32_t neighbor : nodes_[nearest.node].links[layer]) {
+      if (!visited->Visit(neighbor)) continue;
+      float distance = Distance(query, vector_of(neighbor));
+      if (distance < bound()) offer(neighbor, distance);
+    }
+  }
+
+  std::vector<Candidate> sorted(results.size());
+  for (size_t i = sorted.size(); i > 0; --i) {
+    sorted[i - 1] = results.top();
+    results.pop();
+  }
+  return sorted;
+}
+
+uint32_t EmbeddingIndex::GreedyDescend(const float* query,
+                                       int to_layer) const {
+  uint32_t current = entry_;
+  float distance = Distance(query, vector_of(current));
+  for (int layer = max_level_; layer > to_layer; --layer) {
+    bool moved = true;
+    while (moved) {
+      moved = false;
+      for (uint32_t neighbor : nodes_[current].links[layer]) {
+        float d = Distance(query, vector_of(neighbor));
+        if (d < distance) {
+          current = neighbor;
+          distance = d;
+          moved = true;
+        }
+      }
+    }
+  }
+  return current;
+}
+
+std::vector<EmbeddingIndex::Neighbor> EmbeddingIndex::SearchLocked(
+    const float* prepared, size_t k, size_t ef, VisitedSet* visited) const {
+  if (entry_ == kNoNode || k == 0) return {};
+  ef = std::max(ef == 0 ? options_.ef_search : ef, k);
+  uint32_t entry = GreedyDescend(prepared, 0);
+  std::vector<Candidate> candidates =
+      SearchLayer(prepared, entry, ef, 0, visited, true);
+  if (candidates.size() > k) candidates.resize(k);
+  std::vector<Neighbor> result;
+  result.reserve(candidates.size());
+  for (const Candidate& candidate : candidates) {
+    result.push_back(
+        Neighbor{nodes_[candidate.node].handle, candidate.distance});
+  }
+  return result;
+}
+
+}  // namespace opencog
+}  // namespace v8
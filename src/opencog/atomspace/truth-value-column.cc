@@ -0,0 +1,183 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/truth-value-column.h"
+
+#include <algorithm>
+
+#include "hwy/highway.h"
+#include "include/opencog/atomspace.h"
+
+namespace v8 {
+namespace opencog {
+
+namespace {
+
+namespace hw = hwy::HWY_NAMESPACE;
+
+template <typename T>
+void ReviseSlot(T* s1, T* c1, T s2, T c2) {
+  T weight = *c1 + c2;
+  if (weight > 0) *s1 = (*s1 * *c1 + s2 * c2) / weight;
+  *c1 = *c1 + c2 - *c1 * c2;
+}
+
+}  // namespace
+
+template <typename T>
+void BasicTruthValueColumn<T>::Resize(size_t size) {
+  strengths_.resize(size, T(0));
+  confidences_.resize(size, T(0));
+}
+
+template <typename T>
+TruthValue BasicTruthValueColumn<T>::Get(AtomHandle handle) const {
+  if (!handle.is_valid() || handle.value() >= size()) return TruthValue(0, 0);
+  return TruthValue(strengths_[handle.value()], confidences_[handle.value()]);
+}
+
+template <typename T>
+void BasicTruthValueColumn<T>::Set(AtomHandle handle, const TruthValue& tv) {
+  if (!handle.is_valid()) return;
+  if (handle.value() >= size()) {
+    Resize(std::max<size_t>(handle.value() + 1, size() * 2));
+  }
+  strengths_[handle.value()] = static_cast<T>(tv.strength);
+  confidences_[handle.value()] = static_cast<T>(tv.confidence);
+}
+
+template <typename T>
+void BasicTruthValueColumn<T>::Reset(AtomHandle handle) {
+  if (!handle.is_valid() || handle.value() >= size()) return;
+  strengths_[handle.value()] = T(0);
+  confidences_[handle.value()] = T(0);
+}
+
+template <typename T>
+void BasicTruthValueColumn<T>::Load(const AtomSpace& space) {
+  std::fill(strengths_.begin(), strengths_.end(), T(0));
+  std::fill(confidences_.begin(), confidences_.end(), T(0));
+  for (size_t type = 0; type < kAtomTypeCount; ++type) {
+    space.ForEachAtomOfType(static_cast<AtomType>(type),
+                            [this, &space](const std::shared_ptr<Atom>& atom) {
+                              Set(atom->handle(), space.GetTruthValue(*atom));
+                            });
+  }
+}
+
+template <typename T>
+size_t BasicTruthValueColumn<T>::Store(AtomSpace* space) const {
+  size_t updated = 0;
+  for (size_t type = 0; type < kAtomTypeCount; ++type) {
+    space->ForEachAtomOfType(
+        static_cast<AtomType>(type),
+        [this, space, &updated](const std::shared_ptr<Atom>& atom) {
+          if (!Contains(atom->handle())) return;
+          uint32_t slot = atom->handle().value();
+          // Compare at column precision so that a float column does not
+          // rewrite every atom it merely rounded.
+          TruthValue current = space->GetTruthValue(*atom);
+          if (static_cast<T>(current.strength) == strengths_[slot] &&
+              static_cast<T>(current.confidence) == confidences_[slot]) {
+            return;
+          }
+          space->SetTruthValue(
+              atom, TruthValue(strengths_[slot], confidences_[slot]));
+          ++updated;
+        });
+  }
+  return updated;
+}
+
+template <typename T>
+void BasicTruthValueColumn<T>::Revise(const BasicTruthValueColumn& evidence) {
+  const size_t count = std::min(size(), evidence.size());
+  T* s1 = strengths_.data();
+  T* c1 = confidences_.data();
+  const T* s2 = evidence.strengths_.data();
+  const T* c2 = evidence.confidences_.data();
+
+  const hw::ScalableTag<T> d;
+  const size_t lanes = hw::Lanes(d);
+  const auto zero = hw::Zero(d);
+  size_t i = 0;
+  for (; i + lanes <= count; i += lanes) {
+    const auto vs1 = hw::LoadU(d, s1 + i);
+    const auto vc1 = hw::LoadU(d, c1 + i);
+    const auto vs2 = hw::LoadU(d, s2 + i);
+    const auto vc2 = hw::LoadU(d, c2 + i);
+    const auto weight = hw::Add(vc1, vc2);
+    const auto has_weight = hw::Gt(weight, zero);
+    // Lanes without weight divide by one and keep their strength.
+    const auto divisor = hw::IfThenElse(has_weight, weight, hw::Set(d, 1));
+    const auto revised = hw::Div(hw::MulAdd(vs1, vc1, hw::Mul(vs2, vc2)),
+                                 divisor);
+    hw::StoreU(hw::IfThenElse(has_weight, revised, vs1), d, s1 + i);
+    hw::StoreU(hw::NegMulAdd(vc1, vc2, weight), d, c1 + i);
+  }
+  for (; i < count; ++i) ReviseSlot(s1 + i, c1 + i, s2[i], c2[i]);
+}
+
+template <typename T>
+void BasicTruthValueColumn<T>::Decay(double factor) {
+  const T scale = static_cast<T>(factor);
+  T* c = confidences_.data();
+  const size_t count = size();
+
+  const hw::ScalableTag<T> d;
+  const size_t lanes = hw::Lanes(d);
+  const auto vscale = hw::Set(d, scale);
+  size_t i = 0;
+  for (; i + lanes <= count; i += lanes) {
+    hw::StoreU(hw::Mul(hw::LoadU(d, c + i), vscale), d, c + i);
+  }
+  for (; i < count; ++i) c[i] *= scale;
+}
+
+template <typename T>
+std::vector<AtomHandle> BasicTruthValueColumn<T>::Filter(
+    double min_strength, double min_confidence) const {
+  const T strength_floor = static_cast<T>(min_strength);
+  const T confidence_floor = static_cast<T>(min_confidence);
+  const T* s = strengths_.data();
+  const T* c = confidences_.data();
+  const size_t count = size();
+  std::vector<AtomHandle> result;
+
+  auto matches = [=](size_t slot) {
+    return s[slot] >= strength_floor && c[slot] >= confidence_floor &&
+           c[slot] > 0;
+  };
+
+  const hw::ScalableTag<T> d;
+  const size_t lanes = hw::Lanes(d);
+  const auto vstrength = hw::Set(d, strength_floor);
+  const auto vconfidence = hw::Set(d, confidence_floor);
+  const auto zero = hw::Zero(d);
+  size_t i = 0;
+  for (; i + lanes <= count; i += lanes) {
+    const auto vc = hw::LoadU(d, c + i);
+    const auto hit =
+        hw::And(hw::And(hw::Ge(hw::LoadU(d, s + i), vstrength),
+                        hw::Ge(vc, vconfidence)),
+                hw::Gt(vc, zero));
+    // Most slots fail a selective threshold; only rescan blocks with a hit.
+    if (hw::AllFalse(d, hit)) continue;
+    for (size_t lane = 0; lane < lanes; ++lane) {
+      if (matches(i + lane)) {
+        result.emplace_back(static_cast<uint32_t>(i + lane));
+      }
+    }
+  }
+  for (; i < count; ++i) {
+    if (matches(i)) result.emplace_back(static_cast<uint32_t>(i));
+  }
+  return result;
+}
+
+template class BasicTruthValueColumn<float>;
+template class BasicTruthValueColumn<double>;
+
+}  // namespace opencog
+}  // namespace v8
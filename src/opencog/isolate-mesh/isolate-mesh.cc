@@ -4,123 +4,398 @@
 
 #include "include/opencog/isolate-mesh.h"
 
+#include <algorithm>
+#include <utility>
+
+#include "include/opencog/atomspace-snapshot.h"
+#include "include/opencog/opencog-bindings.h"
 #include "include/v8-initialization.h"
 #include "include/v8-local-handle.h"
+#include "include/v8-statistics.h"
 #include "include/v8-template.h"
 
 namespace v8 {
 namespace opencog {
 
+namespace {
+
+std::chrono::steady_clock::rep Now() {
+  return std::chrono::steady_clock::now().time_since_epoch().count();
+}
+
+}  // namespace
+
 v8::Platform* IsolateMesh::platform_ = nullptr;
 
 // TenantIsolate implementation
 TenantIsolate::TenantIsolate(const std::string& tenant_id,
                               v8::Isolate* isolate,
                               const IsolateConfig& config)
-    : tenant_id_(tenant_id), isolate_(isolate), config_(config) {
+    : tenant_id_(tenant_id),
+      isolate_(isolate),
+      config_(config),
+      last_used_(Now()) {
   atomspace_ = AtomSpaceManager::GetInstance()->GetOrCreateAtomSpace(tenant_id);
+  OpenCogBindings::AttachAtomSpace(isolate_, atomspace_.get());
+  ApplyGCConfig();
   SetupContext();
 }
 
+TenantIsolate::TenantIsolate(const std::string& tenant_id,
+                             IsolatePool::WarmIsolate warm,
+                             const IsolateConfig& config)
+    : tenant_id_(tenant_id),
+      isolate_(warm.isolate),
+      config_(config),
+      context_(std::move(warm.context)),
+      snapshot_(std::move(warm.snapshot)),
+      last_used_(Now()) {
+  atomspace_ = AtomSpaceManager::GetInstance()->GetOrCreateAtomSpace(tenant_id);
+  OpenCogBindings::AttachAtomSpace(isolate_, atomspace_.get());
+  ApplyGCConfig();
+}
+
 TenantIsolate::~TenantIsolate() {
-  if (!context_.IsEmpty()) {
-    context_.Reset();
-  }
+  // Handles must go before the isolate they belong to.
+  context_.Reset();
+  isolate_->Dispose();
+}
+
+// static
+v8::Local<v8::Context> TenantIsolate::NewContext(v8::Isolate* isolate) {
+  return OpenCogBindings::NewContext(isolate);
 }
 
 void TenantIsolate::SetupContext() {
   v8::Isolate::Scope isolate_scope(isolate_);
   v8::HandleScope handle_scope(isolate_);
-  
-  // Create global object template
-  v8::Local<v8::ObjectTemplate> global = v8::ObjectTemplate::New(isolate_);
-  
-  // TODO: Add OpenCog API bindings here
-  // This is where we would expose AtomSpace and Agent APIs to JavaScript
-  
-  v8::Local<v8::Context> context = v8::Context::New(isolate_, nullptr, global);
-  context_.Reset(isolate_, context);
+  context_.Reset(isolate_, NewContext(isolate_));
 }
 
 v8::Local<v8::Context> TenantIsolate::GetContext() {
   return context_.Get(isolate_);
 }
 
+TenantMetrics TenantIsolate::CollectMetrics() const {
+  v8::HeapStatistics heap;
+  isolate_->GetHeapStatistics(&heap);
+  TenantMetrics metrics;
+  metrics.heap_used_bytes = heap.used_heap_size();
+  metrics.heap_total_bytes = heap.total_heap_size();
+  metrics.heap_limit_bytes = heap.heap_size_limit();
+  metrics.external_memory_bytes = heap.external_memory();
+  metrics.atomspace_bytes = atomspace_->ArenaBytes();
+  metrics.atom_count = atomspace_->DeltaSize();
+  return metrics;
+}
+
+std::chrono::steady_clock::duration TenantIsolate::idle_time() const {
+  return std::chrono::steady_clock::duration(
+      Now() - last_used_.load(std::memory_order_relaxed));
+}
+
+void TenantIsolate::Touch() {
+  last_used_.store(Now(), std::memory_order_relaxed);
+}
+
+void TenantIsolate::ApplyGCConfig() {
+  isolate_->SetPriority(config_.priority);
+  if (config_.limit_gc_threads) isolate_->SetBatterySaverMode(true);
+}
+
 // IsolateMesh implementation
-IsolateMesh::IsolateMesh() {}
+IsolateMesh::IsolateMesh() : IsolateMesh(Options()) {}
+
+IsolateMesh::IsolateMesh(const Options& options)
+    : options_(options), isolate_pool_(options.isolate_pool) {}
 
 IsolateMesh::~IsolateMesh() {
-  std::lock_guard<std::mutex> lock(mutex_);
-  
-  // Clean up all tenant isolates
-  for (auto& pair : tenant_isolates_) {
-    pair.second->isolate()->Dispose();
-  }
-  tenant_isolates_.clear();
+  // Finish the JavaScript still queued while the isolates are alive.
+  shard_executor_.reset();
+  // Tenant isolates dispose of their isolates once the last reference,
+  // here or elsewhere, is dropped.
+  tenant_isolates_.Clear();
+  hibernated_.Clear();
 }
 
 std::shared_ptr<TenantIsolate> IsolateMesh::CreateTenantIsolate(
     const std::string& tenant_id, const IsolateConfig& config) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  
-  // Check if isolate already exists
-  auto it = tenant_isolates_.find(tenant_id);
-  if (it != tenant_isolates_.end()) {
-    return it->second;
-  }
-  
-  // Create new isolate
-  v8::Isolate::CreateParams create_params;
-  create_params.array_buffer_allocator =
-      v8::ArrayBuffer::Allocator::NewDefaultAllocator();
-  
-  if (config.heap_size_limit > 0) {
-    create_params.constraints.set_max_old_generation_size_in_bytes(
-        config.heap_size_limit);
-  }
-  
-  v8::Isolate* isolate = v8::Isolate::New(create_params);
-  
-  auto tenant_isolate = std::make_shared<TenantIsolate>(
-      tenant_id, isolate, config);
-  tenant_isolates_[tenant_id] = tenant_isolate;
-  
-  return tenant_isolate;
+  if (auto existing = GetTenantIsolate(tenant_id)) return existing;
+
+  // If a concurrent call won the race, its isolate is kept and ours is
+  // disposed after the registry's writer lock is released.
+  return tenant_isolates_.Insert(tenant_id,
+                                 NewTenantIsolate(tenant_id, config));
 }
 
 std::shared_ptr<TenantIsolate> IsolateMesh::GetTenantIsolate(
-    const std::string& tenant_id) const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  auto it = tenant_isolates_.find(tenant_id);
-  return (it != tenant_isolates_.end()) ? it->second : nullptr;
+    const std::string& tenant_id) {
+  if (auto tenant = tenant_isolates_.Find(tenant_id)) {
+    tenant->Touch();
+    return tenant;
+  }
+  // The tenant may be hibernated, or on its way there.
+  std::lock_guard<std::mutex> lock(hibernation_mutex_);
+  return Wake(tenant_id);
 }
 
 bool IsolateMesh::RemoveTenantIsolate(const std::string& tenant_id) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  
-  auto it = tenant_isolates_.find(tenant_id);
-  if (it == tenant_isolates_.end()) return false;
-  
-  it->second->isolate()->Dispose();
-  tenant_isolates_.erase(it);
+  // Disposal, if this was the last reference, happens outside the lock.
+  if (tenant_isolates_.Remove(tenant_id)) return true;
+
+  std::lock_guard<std::mutex> lock(hibernation_mutex_);
+  std::shared_ptr<HibernatedTenant> hibernated =
+      hibernated_.Remove(tenant_id);
+  // Woken up meanwhile.
+  if (!hibernated) return tenant_isolates_.Remove(tenant_id) != nullptr;
+  std::shared_ptr<AtomSpace> space =
+      AtomSpaceManager::GetInstance()->GetOrCreateAtomSpace(tenant_id);
+  if (auto snapshot = AtomSpaceSnapshot::FromBuffer(
+          std::move(hibernated->atomspace_image))) {
+    snapshot->LoadInto(space.get());
+  }
   return true;
 }
 
+bool IsolateMesh::HibernateTenant(const std::string& tenant_id) {
+  return Hibernate(tenant_id, std::chrono::steady_clock::duration::zero());
+}
+
+size_t IsolateMesh::HibernateIdleTenants() {
+  if (options_.hibernate_after <= std::chrono::steady_clock::duration::zero()) {
+    return 0;
+  }
+  std::vector<std::string> idle;
+  tenant_isolates_.ForEach(
+      [this, &idle](const std::string& tenant_id,
+                    const std::shared_ptr<TenantIsolate>& tenant) {
+        if (tenant->idle_time() >= options_.hibernate_after) {
+          idle.push_back(tenant_id);
+        }
+      });
+  size_t hibernated = 0;
+  for (const std::string& tenant_id : idle) {
+    if (Hibernate(tenant_id, options_.hibernate_after)) ++hibernated;
+  }
+  return hibernated;
+}
+
+bool IsolateMesh::IsHibernated(const std::string& tenant_id) const {
+  return hibernated_.Find(tenant_id) != nullptr;
+}
+
+size_t IsolateMesh::ReduceIdleTenantMemory() {
+  if (options_.reduce_memory_after <=
+          std::chrono::steady_clock::duration::zero() ||
+      options_.memory_reductions_per_call == 0) {
+    return 0;
+  }
+  struct Candidate {
+    v8::Isolate::Priority priority;
+    std::chrono::steady_clock::rep last_used;
+    std::shared_ptr<TenantIsolate> tenant;
+  };
+  std::vector<Candidate> idle;
+  tenant_isolates_.ForEach(
+      [this, &idle](const std::string&,
+                    const std::shared_ptr<TenantIsolate>& tenant) {
+        std::chrono::steady_clock::rep last_used =
+            tenant->last_used_.load(std::memory_order_relaxed);
+        if (tenant->idle_time() >= options_.reduce_memory_after &&
+            last_used > tenant->last_memory_reduction_.load(
+                            std::memory_order_relaxed)) {
+          idle.push_back({tenant->config().priority, last_used, tenant});
+        }
+      });
+  const size_t count =
+      std::min(idle.size(), options_.memory_reductions_per_call);
+  // Priorities order from best-effort up.
+  std::partial_sort(idle.begin(), idle.begin() + count, idle.end(),
+                    [](const Candidate& a, const Candidate& b) {
+                      if (a.priority != b.priority) {
+                        return a.priority < b.priority;
+                      }
+                      return a.last_used < b.last_used;
+                    });
+  for (size_t i = 0; i < count; ++i) {
+    TenantIsolate* tenant = idle[i].tenant.get();
+    tenant->last_memory_reduction_.store(Now(), std::memory_order_relaxed);
+    // Off the isolate's thread this only requests the GC, which the isolate
+    // starts at its next interrupt check or task.
+    tenant->isolate()->MemoryPressureNotification(
+        v8::MemoryPressureLevel::kModerate);
+  }
+  return count;
+}
+
 std::vector<std::string> IsolateMesh::GetTenantIds() const {
-  std::lock_guard<std::mutex> lock(mutex_);
   std::vector<std::string> ids;
-  ids.reserve(tenant_isolates_.size());
-  
-  for (const auto& pair : tenant_isolates_) {
-    ids.push_back(pair.first);
-  }
-  
+  auto add = [&ids](const std::string& tenant_id, const auto&) {
+    ids.push_back(tenant_id);
+  };
+  tenant_isolates_.ForEach(add);
+  hibernated_.ForEach(add);
+  // A tenant waking up meanwhile may have been seen twice.
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
   return ids;
 }
 
 size_t IsolateMesh::TenantCount() const {
-  std::lock_guard<std::mutex> lock(mutex_);
-  return tenant_isolates_.size();
+  return tenant_isolates_.size() + hibernated_.size();
+}
+
+std::optional<std::string> IsolateMesh::GetIsolateGroup(
+    const std::string& tenant_id) {
+  if (auto tenant = tenant_isolates_.Find(tenant_id)) {
+    return tenant->config().isolate_group;
+  }
+  if (auto hibernated = hibernated_.Find(tenant_id)) {
+    return hibernated->config.isolate_group;
+  }
+  return std::nullopt;
+}
+
+size_t IsolateMesh::IsolateGroupCount() const {
+  std::lock_guard<std::mutex> lock(isolate_groups_mutex_);
+  return isolate_groups_.size();
+}
+
+std::optional<TenantMetrics> IsolateMesh::GetTenantMetrics(
+    const std::string& tenant_id) const {
+  std::shared_ptr<TenantIsolate> tenant = tenant_isolates_.Find(tenant_id);
+  if (!tenant) return std::nullopt;
+  TenantMetrics metrics = tenant->CollectMetrics();
+  if (orchestrator_) {
+    metrics.agent_run_time = orchestrator_->TenantRunTime(tenant_id);
+  }
+  return metrics;
+}
+
+BudgetState IsolateMesh::EnforceBudget(const std::string& tenant_id) {
+  std::shared_ptr<TenantIsolate> tenant = tenant_isolates_.Find(tenant_id);
+  if (!tenant) return BudgetState::kWithinBudget;
+  TenantMetrics metrics = *GetTenantMetrics(tenant_id);
+
+  const IsolateConfig& config = tenant->config();
+  auto over = [&metrics](size_t budget) {
+    return budget > 0 && metrics.memory_bytes() > budget;
+  };
+  BudgetState state = BudgetState::kWithinBudget;
+  if (over(config.hard_memory_budget)) {
+    state = BudgetState::kOverHardBudget;
+  } else if (over(config.soft_memory_budget)) {
+    state = BudgetState::kOverSoftBudget;
+  }
+
+  const BudgetState previous = tenant->budget_state_;
+  if (state == previous) return state;
+  tenant->budget_state_ = state;
+
+  // React to escalations only, so that a tenant sitting above a budget does
+  // not get a GC forced on every check.
+  if (state > previous) {
+    tenant->isolate()->MemoryPressureNotification(
+        state == BudgetState::kOverHardBudget
+            ? v8::MemoryPressureLevel::kCritical
+            : v8::MemoryPressureLevel::kModerate);
+  }
+  if (orchestrator_ && (state == BudgetState::kOverHardBudget ||
+                        previous == BudgetState::kOverHardBudget)) {
+    orchestrator_->SetTenantThrottle(
+        tenant_id, state == BudgetState::kOverHardBudget
+                       ? options_.hard_budget_throttle
+                       : 1);
+  }
+  if (options_.on_budget_change) {
+    options_.on_budget_change(tenant_id, state, metrics);
+  }
+  return state;
+}
+
+std::shared_ptr<TenantIsolate> IsolateMesh::NewTenantIsolate(
+    const std::string& tenant_id, const IsolateConfig& config) {
+  // The resolved group is kept in the tenant's config, so that waking a
+  // hibernated tenant puts it back into the same group.
+  IsolateConfig tenant_config = config;
+  if (tenant_config.isolate_group.empty() &&
+      options_.isolate_group_for_tenant) {
+    tenant_config.isolate_group = options_.isolate_group_for_tenant(tenant_id);
+  }
+  std::optional<IsolatePool::WarmIsolate> warm;
+  if (tenant_config.isolate_group.empty()) {
+    warm = isolate_pool_.TryAcquire(tenant_config);
+  }
+  if (!warm) {
+    warm = isolate_pool_.CreateIsolate(
+        tenant_config, GetOrCreateIsolateGroup(tenant_config.isolate_group));
+  }
+  return std::make_shared<TenantIsolate>(tenant_id, std::move(*warm),
+                                         tenant_config);
+}
+
+v8::IsolateGroup IsolateMesh::GetOrCreateIsolateGroup(
+    const std::string& name) {
+  if (name.empty() || !v8::IsolateGroup::CanCreateNewGroups()) {
+    return v8::IsolateGroup::GetDefault();
+  }
+  std::lock_guard<std::mutex> lock(isolate_groups_mutex_);
+  auto it = isolate_groups_.find(name);
+  if (it == isolate_groups_.end()) {
+    it = isolate_groups_.emplace(name, v8::IsolateGroup::Create()).first;
+  }
+  return it->second;
+}
+
+bool IsolateMesh::Hibernate(const std::string& tenant_id,
+                            std::chrono::steady_clock::duration min_idle_time) {
+  // Declared first so that the isolate is disposed after unlocking.
+  std::shared_ptr<TenantIsolate> tenant;
+  std::lock_guard<std::mutex> lock(hibernation_mutex_);
+  // Once unregistered, the tenant isolate can no longer be handed out, so
+  // the reference counts below cannot grow anymore.
+  tenant = tenant_isolates_.Remove(tenant_id);
+  if (!tenant) return false;
+  std::shared_ptr<AtomSpace> space = tenant->atomspace();
+  // Held by |tenant|, the AtomSpaceManager and |space|.
+  constexpr long kAtomSpaceOwners = 3;
+  if (tenant.use_count() > 1 || space.use_count() > kAtomSpaceOwners ||
+      space->HiddenCount() > 0 || tenant->idle_time() < min_idle_time) {
+    tenant_isolates_.Insert(tenant_id, tenant);
+    return false;
+  }
+
+  auto hibernated = std::make_shared<HibernatedTenant>();
+  hibernated->config = tenant->config();
+  hibernated->budget_state = tenant->budget_state_;
+  hibernated->atomspace_image = AtomSpaceSnapshot::SerializeLayer(*space);
+  hibernated_.Insert(tenant_id, std::move(hibernated));
+  AtomSpaceManager::GetInstance()->RemoveAtomSpace(tenant_id);
+  return true;
+}
+
+std::shared_ptr<TenantIsolate> IsolateMesh::Wake(
+    const std::string& tenant_id) {
+  std::shared_ptr<HibernatedTenant> hibernated = hibernated_.Find(tenant_id);
+  if (!hibernated) return tenant_isolates_.Find(tenant_id);
+
+  // Loaded before the tenant isolate exists, so that scripts never see the
+  // AtomSpace partially restored.
+  std::shared_ptr<AtomSpace> space =
+      AtomSpaceManager::GetInstance()->GetOrCreateAtomSpace(tenant_id);
+  if (auto snapshot = AtomSpaceSnapshot::FromBuffer(
+          std::move(hibernated->atomspace_image))) {
+    snapshot->LoadInto(space.get());
+  }
+  std::shared_ptr<TenantIsolate> tenant =
+      NewTenantIsolate(tenant_id, hibernated->config);
+  // Keeps the throttle set by EnforceBudget() consistent with the state.
+  tenant->budget_state_ = hibernated->budget_state;
+  // Registered before the hibernated entry goes, so that the tenant is
+  // always listed.
+  tenant_isolates_.Insert(tenant_id, tenant);
+  hibernated_.Remove(tenant_id);
+  return tenant;
 }
 
 void IsolateMesh::SetAgentOrchestrator(
@@ -128,6 +403,14 @@ void IsolateMesh::SetAgentOrchestrator(
   orchestrator_ = orchestrator;
 }
 
+IsolateShardExecutor* IsolateMesh::shard_executor() {
+  std::call_once(shard_executor_created_, [this]() {
+    shard_executor_ =
+        std::make_unique<IsolateShardExecutor>(options_.isolate_shards);
+  });
+  return shard_executor_.get();
+}
+
 void IsolateMesh::InitializePlatform(v8::Platform* platform) {
   platform_ = platform;
 }
@@ -0,0 +1,136 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/isolate-mesh.h"
+
+#include <utility>
+
+#include "include/opencog/opencog-bindings.h"
+#include "include/v8-local-handle.h"
+
+namespace v8 {
+namespace opencog {
+
+namespace {
+
+void DeleteStartupData(const v8::StartupData* blob) {
+  delete[] blob->data;
+  delete blob;
+}
+
+}  // namespace
+
+IsolatePool::IsolatePool() : IsolatePool(Options()) {}
+
+IsolatePool::IsolatePool(const Options& options)
+    : options_(options),
+      allocator_(v8::ArrayBuffer::Allocator::NewDefaultAllocator()) {
+  if (options_.use_startup_snapshot && options_.startup_snapshot) {
+    // Not ours to free.
+    snapshot_ = std::shared_ptr<const v8::StartupData>(
+        options_.startup_snapshot, [](const v8::StartupData*) {});
+  }
+  if (options_.size > 0) {
+    refill_thread_ = std::thread(&IsolatePool::RefillLoop, this);
+  }
+}
+
+IsolatePool::~IsolatePool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  refill_needed_.notify_all();
+  if (refill_thread_.joinable()) refill_thread_.join();
+  for (WarmIsolate& warm : ready_) Dispose(&warm);
+}
+
+std::optional<IsolatePool::WarmIsolate> IsolatePool::TryAcquire(
+    const IsolateConfig& config) {
+  if (config.heap_size_limit != options_.config.heap_size_limit) {
+    return std::nullopt;
+  }
+  std::optional<WarmIsolate> warm;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ready_.empty()) return std::nullopt;
+    warm = std::move(ready_.back());
+    ready_.pop_back();
+  }
+  refill_needed_.notify_one();
+  return warm;
+}
+
+IsolatePool::WarmIsolate IsolatePool::CreateIsolate(
+    const IsolateConfig& config) {
+  return CreateIsolate(config, v8::IsolateGroup::GetDefault());
+}
+
+IsolatePool::WarmIsolate IsolatePool::CreateIsolate(
+    const IsolateConfig& config, const v8::IsolateGroup& group) {
+  WarmIsolate warm;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    warm.snapshot = snapshot_;
+  }
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator_shared = allocator_;
+  create_params.snapshot_blob = warm.snapshot.get();
+  create_params.external_references = OpenCogBindings::ExternalReferences();
+  if (config.heap_size_limit > 0) {
+    create_params.constraints.set_max_old_generation_size_in_bytes(
+        config.heap_size_limit);
+  }
+  warm.isolate = v8::Isolate::New(group, create_params);
+
+  v8::Isolate::Scope isolate_scope(warm.isolate);
+  v8::HandleScope handle_scope(warm.isolate);
+  // The snapshot's default context already is a tenant context.
+  v8::Local<v8::Context> context =
+      warm.snapshot ? v8::Context::New(warm.isolate)
+                    : TenantIsolate::NewContext(warm.isolate);
+  warm.context.Reset(warm.isolate, context);
+  return warm;
+}
+
+size_t IsolatePool::available() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return ready_.size();
+}
+
+void IsolatePool::RefillLoop() {
+  if (options_.use_startup_snapshot && !options_.startup_snapshot) {
+    v8::StartupData blob =
+        OpenCogBindings::CreateStartupSnapshot(allocator_);
+    // Without a blob, isolates fall back to V8's built-in snapshot.
+    if (blob.data != nullptr) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      snapshot_ = std::shared_ptr<const v8::StartupData>(
+          new v8::StartupData(blob), DeleteStartupData);
+    }
+  }
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    refill_needed_.wait(lock, [this]() {
+      return stopping_ || ready_.size() < options_.size;
+    });
+    if (stopping_) return;
+    lock.unlock();
+    WarmIsolate warm = CreateIsolate(options_.config);
+    lock.lock();
+    // Disposed by the destructor if the pool is stopping meanwhile.
+    ready_.push_back(std::move(warm));
+  }
+}
+
+// static
+void IsolatePool::Dispose(WarmIsolate* warm) {
+  warm->context.Reset();
+  warm->isolate->Dispose();
+}
+
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,112 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/isolate-shard-executor.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "include/opencog/isolate-mesh.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-microtask.h"
+
+namespace v8 {
+namespace opencog {
+
+IsolateShardExecutor::IsolateShardExecutor(size_t shard_count) {
+  if (shard_count == 0) {
+    shard_count = std::max(1u, std::thread::hardware_concurrency());
+  }
+  shards_.reserve(shard_count);
+  for (size_t i = 0; i < shard_count; ++i) {
+    shards_.push_back(std::make_unique<Shard>());
+  }
+  for (auto& shard : shards_) {
+    shard->thread = std::thread(&IsolateShardExecutor::Run, this, shard.get());
+  }
+}
+
+IsolateShardExecutor::~IsolateShardExecutor() {
+  for (auto& shard : shards_) {
+    {
+      std::lock_guard<std::mutex> lock(shard->mutex);
+      shard->stopping = true;
+    }
+    shard->work_available.notify_one();
+  }
+  for (auto& shard : shards_) shard->thread.join();
+}
+
+size_t IsolateShardExecutor::ShardOf(const std::string& tenant_id) const {
+  return std::hash<std::string>()(tenant_id) % shards_.size();
+}
+
+void IsolateShardExecutor::Post(std::shared_ptr<TenantIsolate> tenant,
+                                Task task) {
+  Shard* shard = shards_[ShardOf(tenant->tenant_id())].get();
+  {
+    std::lock_guard<std::mutex> lock(shard->mutex);
+    shard->queue.push_back(Work{std::move(tenant), std::move(task)});
+  }
+  shard->work_available.notify_one();
+}
+
+void IsolateShardExecutor::Drain() {
+  for (auto& shard : shards_) {
+    std::unique_lock<std::mutex> lock(shard->mutex);
+    shard->idle.wait(lock, [&shard]() {
+      return shard->queue.empty() && !shard->busy;
+    });
+  }
+}
+
+void IsolateShardExecutor::Run(Shard* shard) {
+  std::vector<Work> batch;
+  std::unique_lock<std::mutex> lock(shard->mutex);
+  while (true) {
+    shard->work_available.wait(lock, [shard]() {
+      return !shard->queue.empty() || shard->stopping;
+    });
+    // Stopping only once the queue is empty runs the tasks posted before.
+    if (shard->queue.empty()) break;
+    batch.swap(shard->queue);
+    shard->busy = true;
+    lock.unlock();
+    RunBatch(&batch);
+    // The last references to tenants may go here, disposing of their
+    // isolates on the thread that used them.
+    batch.clear();
+    lock.lock();
+    shard->busy = false;
+    if (shard->queue.empty()) shard->idle.notify_all();
+  }
+}
+
+// static
+void IsolateShardExecutor::RunBatch(std::vector<Work>* batch) {
+  // Group the tasks by tenant, keeping each tenant's tasks in order.
+  std::stable_sort(batch->begin(), batch->end(),
+                   [](const Work& a, const Work& b) {
+                     return std::less<TenantIsolate*>()(a.tenant.get(),
+                                                        b.tenant.get());
+                   });
+  for (size_t begin = 0; begin < batch->size();) {
+    TenantIsolate* tenant = (*batch)[begin].tenant.get();
+    size_t end = begin + 1;
+    while (end < batch->size() && (*batch)[end].tenant.get() == tenant) ++end;
+
+    v8::Isolate* isolate = tenant->isolate();
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = tenant->GetContext();
+    v8::Context::Scope context_scope(context);
+    isolate->SetMicrotasksPolicy(v8::MicrotasksPolicy::kExplicit);
+    for (size_t i = begin; i < end; ++i) (*batch)[i].task(isolate, context);
+    isolate->PerformMicrotaskCheckpoint();
+    begin = end;
+  }
+}
+
+}  // namespace opencog
+}  // namespace v8
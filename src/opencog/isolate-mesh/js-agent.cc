@@ -0,0 +1,153 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/js-agent.h"
+
+#include <utility>
+
+#include "include/opencog/isolate-mesh.h"
+#include "include/opencog/isolate-shard-executor.h"
+#include "include/opencog/opencog-bindings.h"
+#include "include/v8-exception.h"
+#include "include/v8-function.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-object.h"
+#include "include/v8-primitive.h"
+
+namespace v8 {
+namespace opencog {
+
+namespace {
+
+v8::Local<v8::String> NewString(v8::Isolate* isolate,
+                                const std::string& value) {
+  return v8::String::NewFromUtf8(isolate, value.data(),
+                                 v8::NewStringType::kNormal,
+                                 static_cast<int>(value.size()))
+      .ToLocalChecked();
+}
+
+v8::Local<v8::String> NewInternalizedString(v8::Isolate* isolate,
+                                            const char* value) {
+  return v8::String::NewFromUtf8(isolate, value,
+                                 v8::NewStringType::kInternalized)
+      .ToLocalChecked();
+}
+
+// The global function |name|, or an empty handle.
+v8::Local<v8::Function> GetFunction(v8::Isolate* isolate,
+                                    v8::Local<v8::Context> context,
+                                    const std::string& name) {
+  v8::Local<v8::Value> value;
+  if (!context->Global()->Get(context, NewString(isolate, name))
+           .ToLocal(&value) ||
+      !value->IsFunction()) {
+    return {};
+  }
+  return value.As<v8::Function>();
+}
+
+v8::MaybeLocal<v8::Object> NewMessageObject(v8::Isolate* isolate,
+                                            v8::Local<v8::Context> context,
+                                            const AgentMessage& message) {
+  v8::Local<v8::Value> payload;
+  if (!OpenCogBindings::DeserializePayload(isolate, context, message.payload)
+           .ToLocal(&payload)) {
+    return {};
+  }
+  v8::Local<v8::Object> object = v8::Object::New(isolate);
+  const std::pair<const char*, v8::Local<v8::Value>> fields[] = {
+      {"from", NewString(isolate, message.from_agent_id)},
+      {"to", NewString(isolate, message.to_agent_id)},
+      {"type", NewString(isolate, message.type)},
+      {"topic", NewString(isolate, message.topic)},
+      {"payload", payload},
+  };
+  for (const auto& [key, value] : fields) {
+    if (object->Set(context, NewInternalizedString(isolate, key), value)
+            .IsNothing()) {
+      return {};
+    }
+  }
+  return object;
+}
+
+}  // namespace
+
+JsAgent::JsAgent(const std::string& agent_id,
+                 std::shared_ptr<TenantIsolate> tenant,
+                 IsolateShardExecutor* executor)
+    : JsAgent(agent_id, std::move(tenant), executor, Options()) {}
+
+JsAgent::JsAgent(const std::string& agent_id,
+                 std::shared_ptr<TenantIsolate> tenant,
+                 IsolateShardExecutor* executor, const Options& options)
+    : Agent(agent_id, tenant->tenant_id()),
+      state_(std::make_shared<State>()),
+      executor_(executor) {
+  state_->options = options;
+  state_->tenant = std::move(tenant);
+}
+
+JsAgent::~JsAgent() = default;
+
+void JsAgent::Execute() { Queue(Call{true, AgentMessage()}); }
+
+void JsAgent::OnMessage(const AgentMessage& message) {
+  Queue(Call{false, message});
+}
+
+uint64_t JsAgent::call_count() const {
+  return state_->calls.load(std::memory_order_relaxed);
+}
+
+uint64_t JsAgent::exception_count() const {
+  return state_->exceptions.load(std::memory_order_relaxed);
+}
+
+void JsAgent::Queue(Call call) {
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->pending.push_back(std::move(call));
+    // The posted task has not taken the batch yet and will see this call.
+    if (state_->pending.size() > 1) return;
+  }
+  std::shared_ptr<State> state = state_;
+  executor_->Post(state->tenant, [state](v8::Isolate* isolate,
+                                         v8::Local<v8::Context> context) {
+    std::vector<Call> batch;
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      batch.swap(state->pending);
+    }
+    v8::Local<v8::Function> execute =
+        GetFunction(isolate, context, state->options.execute_function);
+    v8::Local<v8::Function> on_message =
+        GetFunction(isolate, context, state->options.message_function);
+    for (const Call& call : batch) {
+      v8::Local<v8::Function> function = call.execute ? execute : on_message;
+      if (function.IsEmpty()) continue;
+      v8::HandleScope handle_scope(isolate);
+      v8::TryCatch try_catch(isolate);
+      state->calls.fetch_add(1, std::memory_order_relaxed);
+      v8::MaybeLocal<v8::Value> result;
+      if (call.execute) {
+        result = function->Call(context, context->Global(), 0, nullptr);
+      } else {
+        v8::Local<v8::Object> message;
+        if (NewMessageObject(isolate, context, call.message)
+                .ToLocal(&message)) {
+          v8::Local<v8::Value> argv[] = {message};
+          result = function->Call(context, context->Global(), 1, argv);
+        }
+      }
+      if (result.IsEmpty()) {
+        state->exceptions.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+  });
+}
+
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,643 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/opencog-bindings.h"
+
+#include <array>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "include/v8-container.h"
+#include "include/v8-exception.h"
+#include "include/v8-fast-api-calls.h"
+#include "include/v8-function-callback.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "include/v8-template.h"
+#include "include/v8-typed-array.h"
+
+namespace v8 {
+namespace opencog {
+
+namespace {
+
+// Evaluated in every tenant context after the native API is installed.
+// Must stay in sync with AtomType.
+constexpr char kPrelude[] = R"JS(
+(function(opencog) {
+  'use strict';
+  opencog.AtomType = Object.freeze({
+    NODE: 0,
+    LINK: 1,
+    CONCEPT_NODE: 2,
+    PREDICATE_NODE: 3,
+    VARIABLE_NODE: 4,
+    EVALUATION_LINK: 5,
+    INHERITANCE_LINK: 6,
+    SIMILARITY_LINK: 7,
+    EXECUTION_LINK: 8,
+  });
+  opencog.addConcept = (name) =>
+      opencog.addNode(opencog.AtomType.CONCEPT_NODE, name);
+  opencog.addInheritance = (child, parent) =>
+      opencog.addLink(opencog.AtomType.INHERITANCE_LINK, '', [child, parent]);
+  Object.freeze(opencog);
+})(globalThis.opencog);
+)JS";
+
+constexpr char kNoAtomSpace[] = "opencog: no AtomSpace attached";
+constexpr char kInvalidId[] = "opencog: invalid atom id";
+constexpr char kInvalidType[] = "opencog: invalid atom type";
+constexpr char kInvalidTruthValue[] =
+    "opencog: truth value must be two numbers";
+
+// Fast callbacks run without a HandleScope of their own.
+void Throw(v8::Isolate* isolate, const char* message) {
+  v8::HandleScope handle_scope(isolate);
+  isolate->ThrowError(
+      v8::String::NewFromUtf8(isolate, message).ToLocalChecked());
+}
+
+AtomSpace* AttachedAtomSpace(v8::Isolate* isolate) {
+  auto* atomspace = static_cast<AtomSpace*>(
+      isolate->GetData(OpenCogBindings::kAtomSpaceDataSlot));
+  if (atomspace == nullptr) Throw(isolate, kNoAtomSpace);
+  return atomspace;
+}
+
+// Argument checks shared by the slow and fast paths. Fast calls only see
+// numbers, so numeric validation must happen here for both to agree.
+bool CheckAtomType(v8::Isolate* isolate, double value, AtomType* type) {
+  if (!(value >= 0 && value < kAtomTypeCount) ||
+      value != static_cast<uint32_t>(value)) {
+    Throw(isolate, kInvalidType);
+    return false;
+  }
+  *type = static_cast<AtomType>(static_cast<uint32_t>(value));
+  return true;
+}
+
+bool CheckAtomId(v8::Isolate* isolate, double value, uint64_t* id) {
+  // Ids are dense, so doubles represent them exactly.
+  if (!(value >= 0 && value < 9007199254740992.0)) {
+    Throw(isolate, kInvalidId);
+    return false;
+  }
+  *id = static_cast<uint64_t>(value);
+  return true;
+}
+
+bool ToAtomType(v8::Isolate* isolate, v8::Local<v8::Value> value,
+                AtomType* type) {
+  if (!value->IsNumber()) {
+    Throw(isolate, kInvalidType);
+    return false;
+  }
+  return CheckAtomType(isolate, value.As<v8::Number>()->Value(), type);
+}
+
+bool ToAtomId(v8::Isolate* isolate, v8::Local<v8::Value> value,
+              uint64_t* id) {
+  if (!value->IsNumber()) {
+    Throw(isolate, kInvalidId);
+    return false;
+  }
+  return CheckAtomId(isolate, value.As<v8::Number>()->Value(), id);
+}
+
+std::string ToString(v8::Isolate* isolate, v8::Local<v8::Value> value) {
+  v8::String::Utf8Value utf8(isolate, value);
+  return *utf8 ? std::string(*utf8, utf8.length()) : std::string();
+}
+
+void ReturnId(const v8::FunctionCallbackInfo<v8::Value>& info,
+              const std::shared_ptr<Atom>& atom) {
+  info.GetReturnValue().Set(static_cast<double>(atom->id()));
+}
+
+// Hot accessors. Each has a slow callback converting JS values and a fast
+// callback for optimized code, both calling the same implementation, which
+// may throw but never allocates on the JS heap otherwise.
+
+constexpr double kNoAtom = std::numeric_limits<double>::quiet_NaN();
+
+double GetStrengthImpl(v8::Isolate* isolate, double id_value) {
+  AtomSpace* atomspace = AttachedAtomSpace(isolate);
+  uint64_t id;
+  if (atomspace == nullptr || !CheckAtomId(isolate, id_value, &id)) {
+    return kNoAtom;
+  }
+  std::shared_ptr<Atom> atom = atomspace->GetAtom(id);
+  return atom ? atomspace->GetTruthValue(*atom).strength : kNoAtom;
+}
+
+double GetConfidenceImpl(v8::Isolate* isolate, double id_value) {
+  AtomSpace* atomspace = AttachedAtomSpace(isolate);
+  uint64_t id;
+  if (atomspace == nullptr || !CheckAtomId(isolate, id_value, &id)) {
+    return kNoAtom;
+  }
+  std::shared_ptr<Atom> atom = atomspace->GetAtom(id);
+  return atom ? atomspace->GetTruthValue(*atom).confidence : kNoAtom;
+}
+
+int32_t GetTypeImpl(v8::Isolate* isolate, double id_value) {
+  AtomSpace* atomspace = AttachedAtomSpace(isolate);
+  uint64_t id;
+  if (atomspace == nullptr || !CheckAtomId(isolate, id_value, &id)) {
+    return -1;
+  }
+  std::shared_ptr<Atom> atom = atomspace->GetAtom(id);
+  return atom ? static_cast<int32_t>(atom->type()) : -1;
+}
+
+bool SetTruthValueImpl(v8::Isolate* isolate, double id_value,
+                       double strength, double confidence) {
+  AtomSpace* atomspace = AttachedAtomSpace(isolate);
+  uint64_t id;
+  if (atomspace == nullptr || !CheckAtomId(isolate, id_value, &id)) {
+    return false;
+  }
+  std::shared_ptr<Atom> atom = atomspace->GetAtom(id);
+  if (!atom) return false;
+  atomspace->SetTruthValue(atom, TruthValue(strength, confidence));
+  return true;
+}
+
+double CountAtomsByTypeImpl(v8::Isolate* isolate, double type_value) {
+  AtomSpace* atomspace = AttachedAtomSpace(isolate);
+  AtomType type;
+  if (atomspace == nullptr || !CheckAtomType(isolate, type_value, &type)) {
+    return 0;
+  }
+  return static_cast<double>(atomspace->CountAtomsByType(type));
+}
+
+double SizeImpl(v8::Isolate* isolate) {
+  AtomSpace* atomspace = AttachedAtomSpace(isolate);
+  return atomspace ? static_cast<double>(atomspace->Size()) : 0;
+}
+
+// Converts a numeric argument, or throws |what|.
+bool NumberArgument(const v8::FunctionCallbackInfo<v8::Value>& info, int i,
+                    const char* what, double* value) {
+  if (!info[i]->IsNumber()) {
+    Throw(info.GetIsolate(), what);
+    return false;
+  }
+  *value = info[i].As<v8::Number>()->Value();
+  return true;
+}
+
+void GetStrength(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  double id;
+  if (!NumberArgument(info, 0, kInvalidId, &id)) return;
+  info.GetReturnValue().Set(GetStrengthImpl(info.GetIsolate(), id));
+}
+
+double FastGetStrength(v8::Local<v8::Object> receiver, double id,
+                       v8::FastApiCallbackOptions& options) {
+  return GetStrengthImpl(options.isolate, id);
+}
+
+void GetConfidence(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  double id;
+  if (!NumberArgument(info, 0, kInvalidId, &id)) return;
+  info.GetReturnValue().Set(GetConfidenceImpl(info.GetIsolate(), id));
+}
+
+double FastGetConfidence(v8::Local<v8::Object> receiver, double id,
+                         v8::FastApiCallbackOptions& options) {
+  return GetConfidenceImpl(options.isolate, id);
+}
+
+void GetType(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  double id;
+  if (!NumberArgument(info, 0, kInvalidId, &id)) return;
+  info.GetReturnValue().Set(GetTypeImpl(info.GetIsolate(), id));
+}
+
+int32_t FastGetType(v8::Local<v8::Object> receiver, double id,
+                    v8::FastApiCallbackOptions& options) {
+  return GetTypeImpl(options.isolate, id);
+}
+
+void SetTruthValue(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  double id, strength, confidence;
+  if (!NumberArgument(info, 0, kInvalidId, &id) ||
+      !NumberArgument(info, 1, kInvalidTruthValue, &strength) ||
+      !NumberArgument(info, 2, kInvalidTruthValue, &confidence)) {
+    return;
+  }
+  info.GetReturnValue().Set(
+      SetTruthValueImpl(info.GetIsolate(), id, strength, confidence));
+}
+
+bool FastSetTruthValue(v8::Local<v8::Object> receiver, double id,
+                       double strength, double confidence,
+                       v8::FastApiCallbackOptions& options) {
+  return SetTruthValueImpl(options.isolate, id, strength, confidence);
+}
+
+void CountAtomsByType(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  double type;
+  if (!NumberArgument(info, 0, kInvalidType, &type)) return;
+  info.GetReturnValue().Set(CountAtomsByTypeImpl(info.GetIsolate(), type));
+}
+
+double FastCountAtomsByType(v8::Local<v8::Object> receiver, double type,
+                            v8::FastApiCallbackOptions& options) {
+  return CountAtomsByTypeImpl(options.isolate, type);
+}
+
+void Size(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  info.GetReturnValue().Set(SizeImpl(info.GetIsolate()));
+}
+
+double FastSize(v8::Local<v8::Object> receiver,
+                v8::FastApiCallbackOptions& options) {
+  return SizeImpl(options.isolate);
+}
+
+// Allocating entry points; slow callbacks only.
+
+void AddNode(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  v8::Isolate* isolate = info.GetIsolate();
+  AtomSpace* atomspace = AttachedAtomSpace(isolate);
+  if (atomspace == nullptr) return;
+  AtomType type;
+  if (!ToAtomType(isolate, info[0], &type)) return;
+  ReturnId(info, atomspace->AddNode(type, ToString(isolate, info[1])));
+}
+
+void AddLink(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  v8::Isolate* isolate = info.GetIsolate();
+  AtomSpace* atomspace = AttachedAtomSpace(isolate);
+  if (atomspace == nullptr) return;
+  AtomType type;
+  if (!ToAtomType(isolate, info[0], &type)) return;
+  if (!info[2]->IsArray()) {
+    isolate->ThrowError("opencog: outgoing set must be an array");
+    return;
+  }
+
+  v8::Local<v8::Context> context = isolate->GetCurrentContext();
+  v8::Local<v8::Array> ids = info[2].As<v8::Array>();
+  std::vector<std::shared_ptr<Atom>> outgoing;
+  outgoing.reserve(ids->Length());
+  for (uint32_t i = 0; i < ids->Length(); ++i) {
+    v8::Local<v8::Value> element;
+    uint64_t id;
+    if (!ids->Get(context, i).ToLocal(&element)) return;
+    if (!ToAtomId(isolate, element, &id)) return;
+    std::shared_ptr<Atom> atom = atomspace->GetAtom(id);
+    if (!atom) {
+      isolate->ThrowError("opencog: unknown atom in outgoing set");
+      return;
+    }
+    outgoing.push_back(std::move(atom));
+  }
+  ReturnId(info, atomspace->AddLink(type, ToString(isolate, info[1]),
+                                    outgoing));
+}
+
+void GetTruthValue(const v8::FunctionCallbackInfo<v8::Value>& info) {
+  v8::Isolate* isolate = info.GetIsolate();
+  AtomSpace* atomspace = AttachedAtomSpace(isolate);
+  if (atomspace == nullptr) return;
+  uint64_t id;
+  if (!ToAtomId(isolate, info[0], &id)) return;
+  std::shared_ptr<Atom> atom = atomspace->GetAtom(id);
+  if (!atom) return;
+
+  TruthValue tv = atomspace->GetTruthValue(*atom);
+  v8::Local<v8::Value> elements[] = {
+      v8::Number::New(isolate, tv.strength),
+      v8::Number::New(isolate, tv.confidence),
+  };
+  info.GetReturnValue().Set(v8::Array::New(isolate, elements, 2));
+}
+
+struct Binding {
+  const char* name;
+  v8::FunctionCallback callback;
+  int length;
+  v8::SideEffectType side_effect;
+  // Null address if the function has no fast path.
+  v8::CFunction fast;
+};
+
+using BindingTable = std::array<Binding, 9>;
+
+const BindingTable& Bindings() {
+  using v8::CFunction;
+  using v8::SideEffectType;
+  static const BindingTable bindings = {{
+      {"addNode", AddNode, 2, SideEffectType::kHasSideEffect, CFunction()},
+      {"addLink", AddLink, 3, SideEffectType::kHasSideEffect, CFunction()},
+      {"getTruthValue", GetTruthValue, 1, SideEffectType::kHasNoSideEffect,
+       CFunction()},
+      {"getStrength", GetStrength, 1, SideEffectType::kHasNoSideEffect,
+       CFunction::Make(FastGetStrength)},
+      {"getConfidence", GetConfidence, 1, SideEffectType::kHasNoSideEffect,
+       CFunction::Make(FastGetConfidence)},
+      {"getType", GetType, 1, SideEffectType::kHasNoSideEffect,
+       CFunction::Make(FastGetType)},
+      {"setTruthValue", SetTruthValue, 3, SideEffectType::kHasSideEffect,
+       CFunction::Make(FastSetTruthValue)},
+      {"countAtomsByType", CountAtomsByType, 1,
+       SideEffectType::kHasNoSideEffect,
+       CFunction::Make(FastCountAtomsByType)},
+      {"size", Size, 0, SideEffectType::kHasNoSideEffect,
+       CFunction::Make(FastSize)},
+  }};
+  return bindings;
+}
+
+class ArrayBufferResource final : public std::pmr::memory_resource {
+ public:
+  explicit ArrayBufferResource(v8::ArrayBuffer::Allocator* allocator)
+      : allocator_(allocator) {}
+
+ private:
+  void* do_allocate(size_t bytes, size_t alignment) override {
+    // ArrayBuffer allocators align for every fundamental type.
+    void* data = alignment <= alignof(std::max_align_t)
+                     ? allocator_->AllocateUninitialized(bytes)
+                     : nullptr;
+    // As operator new does in builds without exceptions.
+    if (data == nullptr) std::abort();
+    return data;
+  }
+  void do_deallocate(void* data, size_t bytes, size_t) override {
+    allocator_->Free(data, bytes);
+  }
+  bool do_is_equal(const memory_resource& other) const noexcept override {
+    return this == &other;
+  }
+
+  v8::ArrayBuffer::Allocator* const allocator_;
+};
+
+void ReleaseOwner(void* data, size_t length, void* owner) {
+  delete static_cast<std::shared_ptr<void>*>(owner);
+}
+
+template <typename ArrayType, typename T>
+v8::Local<ArrayType> NewView(v8::Isolate* isolate, T* data, size_t length,
+                             const std::shared_ptr<void>& owner) {
+  if (length == 0) {
+    return ArrayType::New(v8::ArrayBuffer::New(isolate, 0), 0, 0);
+  }
+  // The backing store does not free |data|; dropping it releases one
+  // reference to the column that owns |data|.
+  std::unique_ptr<v8::BackingStore> store = v8::ArrayBuffer::NewBackingStore(
+      data, length * sizeof(T), ReleaseOwner,
+      new std::shared_ptr<void>(owner));
+  return ArrayType::New(v8::ArrayBuffer::New(isolate, std::move(store)), 0,
+                        length);
+}
+
+template <typename ArrayType, typename T>
+v8::MaybeLocal<v8::Object> NewViews(
+    v8::Isolate* isolate, v8::Local<v8::Context> context,
+    std::shared_ptr<BasicTruthValueColumn<T>> column) {
+  if (!column || column->memory_resource() !=
+                     OpenCogBindings::ArrayBufferMemoryResource()) {
+    return {};
+  }
+  v8::EscapableHandleScope handle_scope(isolate);
+  size_t size = column->size();
+  v8::Local<v8::Object> views = v8::Object::New(isolate);
+  v8::Local<ArrayType> strengths =
+      NewView<ArrayType>(isolate, column->mutable_strengths(), size, column);
+  v8::Local<ArrayType> confidences =
+      NewView<ArrayType>(isolate, column->mutable_confidences(), size, column);
+  if (views
+          ->Set(context, v8::String::NewFromUtf8Literal(isolate, "strengths"),
+                strengths)
+          .IsNothing() ||
+      views
+          ->Set(context,
+                v8::String::NewFromUtf8Literal(isolate, "confidences"),
+                confidences)
+          .IsNothing()) {
+    return {};
+  }
+  return handle_scope.Escape(views);
+}
+
+class PayloadSerializerDelegate final : public v8::ValueSerializer::Delegate {
+ public:
+  PayloadSerializerDelegate(v8::Isolate* isolate,
+                            SerializedValueTransfers* transfers)
+      : isolate_(isolate), transfers_(transfers) {}
+
+  void ThrowDataCloneError(v8::Local<v8::String> message) override {
+    isolate_->ThrowException(v8::Exception::Error(message));
+  }
+
+  v8::Maybe<uint32_t> GetSharedArrayBufferId(
+      v8::Isolate* isolate,
+      v8::Local<v8::SharedArrayBuffer> shared_array_buffer) override {
+    std::shared_ptr<v8::BackingStore> store =
+        shared_array_buffer->GetBackingStore();
+    std::vector<std::shared_ptr<v8::BackingStore>>& stores =
+        transfers_->shared_array_buffers;
+    for (size_t id = 0; id < stores.size(); ++id) {
+      if (stores[id] == store) return v8::Just(static_cast<uint32_t>(id));
+    }
+    stores.push_back(std::move(store));
+    return v8::Just(static_cast<uint32_t>(stores.size() - 1));
+  }
+
+  bool AdoptSharedValueConveyor(v8::Isolate* isolate,
+                                v8::SharedValueConveyor&& conveyor) override {
+    transfers_->shared_values.emplace(std::move(conveyor));
+    return true;
+  }
+
+ private:
+  v8::Isolate* const isolate_;
+  SerializedValueTransfers* const transfers_;
+};
+
+class PayloadDeserializerDelegate final
+    : public v8::ValueDeserializer::Delegate {
+ public:
+  explicit PayloadDeserializerDelegate(
+      const SerializedValueTransfers* transfers)
+      : transfers_(transfers) {}
+
+  v8::MaybeLocal<v8::SharedArrayBuffer> GetSharedArrayBufferFromId(
+      v8::Isolate* isolate, uint32_t clone_id) override {
+    if (transfers_ == nullptr ||
+        clone_id >= transfers_->shared_array_buffers.size()) {
+      isolate->ThrowError("opencog: payload refers to a missing buffer");
+      return {};
+    }
+    return v8::SharedArrayBuffer::New(
+        isolate, transfers_->shared_array_buffers[clone_id]);
+  }
+
+  const v8::SharedValueConveyor* GetSharedValueConveyor(
+      v8::Isolate* isolate) override {
+    if (transfers_ == nullptr || !transfers_->shared_values) {
+      isolate->ThrowError("opencog: payload has no shared values");
+      return nullptr;
+    }
+    return &*transfers_->shared_values;
+  }
+
+ private:
+  const SerializedValueTransfers* const transfers_;
+};
+
+}  // namespace
+
+// static
+const intptr_t* OpenCogBindings::ExternalReferences() {
+  static const intptr_t* references = []() {
+    // A slow callback, plus address and signature of its fast callback.
+    auto* references = new intptr_t[Bindings().size() * 3 + 1];
+    size_t count = 0;
+    for (const Binding& binding : Bindings()) {
+      references[count++] = reinterpret_cast<intptr_t>(binding.callback);
+      if (binding.fast.GetAddress() == nullptr) continue;
+      references[count++] =
+          reinterpret_cast<intptr_t>(binding.fast.GetAddress());
+      references[count++] =
+          reinterpret_cast<intptr_t>(binding.fast.GetTypeInfo());
+    }
+    references[count] = 0;
+    return references;
+  }();
+  return references;
+}
+
+// static
+v8::Local<v8::Context> OpenCogBindings::NewContext(v8::Isolate* isolate) {
+  v8::EscapableHandleScope handle_scope(isolate);
+
+  v8::Local<v8::ObjectTemplate> api = v8::ObjectTemplate::New(isolate);
+  for (const Binding& binding : Bindings()) {
+    const v8::CFunction* fast =
+        binding.fast.GetAddress() != nullptr ? &binding.fast : nullptr;
+    api->Set(isolate, binding.name,
+             v8::FunctionTemplate::New(
+                 isolate, binding.callback, v8::Local<v8::Value>(),
+                 v8::Local<v8::Signature>(), binding.length,
+                 v8::ConstructorBehavior::kThrow, binding.side_effect, fast));
+  }
+  v8::Local<v8::ObjectTemplate> global = v8::ObjectTemplate::New(isolate);
+  global->Set(isolate, "opencog", api);
+
+  v8::Local<v8::Context> context = v8::Context::New(isolate, nullptr, global);
+  v8::Context::Scope context_scope(context);
+  v8::Local<v8::Script> prelude;
+  if (!v8::Script::Compile(context,
+                           v8::String::NewFromUtf8Literal(isolate, kPrelude))
+           .ToLocal(&prelude) ||
+      prelude->Run(context).IsEmpty()) {
+    return {};
+  }
+  return handle_scope.Escape(context);
+}
+
+// static
+void OpenCogBindings::AttachAtomSpace(v8::Isolate* isolate,
+                                      AtomSpace* atomspace) {
+  isolate->SetData(kAtomSpaceDataSlot, atomspace);
+}
+
+// static
+std::pmr::memory_resource* OpenCogBindings::ArrayBufferMemoryResource() {
+  static auto* resource = new ArrayBufferResource(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  return resource;
+}
+
+// static
+v8::MaybeLocal<v8::Object> OpenCogBindings::NewTruthValueViews(
+    v8::Isolate* isolate, v8::Local<v8::Context> context,
+    std::shared_ptr<TruthValueColumn> column) {
+  return NewViews<v8::Float64Array>(isolate, context, std::move(column));
+}
+
+// static
+v8::MaybeLocal<v8::Object> OpenCogBindings::NewTruthValueViews(
+    v8::Isolate* isolate, v8::Local<v8::Context> context,
+    std::shared_ptr<CompactTruthValueColumn> column) {
+  return NewViews<v8::Float32Array>(isolate, context, std::move(column));
+}
+
+// static
+v8::Maybe<AgentPayload> OpenCogBindings::SerializePayload(
+    v8::Isolate* isolate, v8::Local<v8::Context> context,
+    v8::Local<v8::Value> value) {
+  auto transfers = std::make_shared<SerializedValueTransfers>();
+  PayloadSerializerDelegate delegate(isolate, transfers.get());
+  v8::ValueSerializer serializer(isolate, &delegate);
+  serializer.WriteHeader();
+  if (serializer.WriteValue(context, value).IsNothing()) {
+    return v8::Nothing<AgentPayload>();
+  }
+  std::pair<uint8_t*, size_t> buffer = serializer.Release();
+  std::string data(reinterpret_cast<const char*>(buffer.first), buffer.second);
+  // Released buffers come from the delegate's default, realloc().
+  std::free(buffer.first);
+  if (transfers->shared_array_buffers.empty() && !transfers->shared_values) {
+    transfers.reset();
+  }
+  return v8::Just(
+      AgentPayload::FromSerializedValue(std::move(data), std::move(transfers)));
+}
+
+// static
+v8::MaybeLocal<v8::Value> OpenCogBindings::DeserializePayload(
+    v8::Isolate* isolate, v8::Local<v8::Context> context,
+    const AgentPayload& payload) {
+  const std::string& data = payload.str();
+  if (payload.encoding() == AgentPayload::Encoding::kText) {
+    return v8::String::NewFromUtf8(isolate, data.data(),
+                                   v8::NewStringType::kNormal,
+                                   static_cast<int>(data.size()));
+  }
+  v8::EscapableHandleScope handle_scope(isolate);
+  PayloadDeserializerDelegate delegate(payload.transfers().get());
+  v8::ValueDeserializer deserializer(
+      isolate, reinterpret_cast<const uint8_t*>(data.data()), data.size(),
+      &delegate);
+  v8::Local<v8::Value> value;
+  if (deserializer.ReadHeader(context).IsNothing() ||
+      !deserializer.ReadValue(context).ToLocal(&value)) {
+    return {};
+  }
+  return handle_scope.Escape(value);
+}
+
+// static
+v8::StartupData OpenCogBindings::CreateStartupSnapshot(
+    std::shared_ptr<v8::ArrayBuffer::Allocator> allocator) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator_shared = std::move(allocator);
+  create_params.external_references = ExternalReferences();
+
+  v8::SnapshotCreator creator(create_params);
+  v8::Isolate* isolate = creator.GetIsolate();
+  {
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = NewContext(isolate);
+    if (context.IsEmpty()) return {nullptr, 0};
+    creator.SetDefaultContext(context);
+  }
+  // Keep the compiled prelude so tenants do not compile it again.
+  return creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kKeep);
+}
+
+}  // namespace opencog
+}  // namespace v8
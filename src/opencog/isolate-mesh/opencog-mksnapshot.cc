@@ -0,0 +1,51 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Writes a startup snapshot whose default context has the OpenCog bindings
+// installed, for IsolatePool::Options::startup_snapshot.
+//
+//   opencog_mksnapshot <output file>
+
+#include <cstdio>
+#include <memory>
+
+#include "include/libplatform/libplatform.h"
+#include "include/opencog/opencog-bindings.h"
+#include "include/v8-initialization.h"
+
+int main(int argc, char* argv[]) {
+  if (argc != 2) {
+    std::fprintf(stderr, "Usage: %s <output file>\n", argv[0]);
+    return 1;
+  }
+
+  v8::V8::InitializeICUDefaultLocation(argv[0]);
+  v8::V8::InitializeExternalStartupData(argv[0]);
+  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform.get());
+  v8::V8::Initialize();
+
+  v8::StartupData blob = v8::opencog::OpenCogBindings::CreateStartupSnapshot(
+      std::shared_ptr<v8::ArrayBuffer::Allocator>(
+          v8::ArrayBuffer::Allocator::NewDefaultAllocator()));
+  int result = 0;
+  if (blob.data == nullptr) {
+    std::fprintf(stderr, "Failed to create the OpenCog snapshot\n");
+    result = 1;
+  } else {
+    FILE* file = std::fopen(argv[1], "wb");
+    if (file == nullptr ||
+        std::fwrite(blob.data, 1, blob.raw_size, file) !=
+            static_cast<size_t>(blob.raw_size)) {
+      std::fprintf(stderr, "Failed to write %s\n", argv[1]);
+      result = 1;
+    }
+    if (file != nullptr) std::fclose(file);
+    delete[] blob.data;
+  }
+
+  v8::V8::Dispose();
+  v8::V8::DisposePlatform();
+  return result;
+}
@@ -156,9 +156,12 @@ class ChunkedStream {
   explicit ChunkedStream(ScriptCompiler::ExternalSourceStream* source)
       : source_(source), chunks_(std::make_shared<std::vector<Chunk>>()) {}
 
+  // Clones take a snapshot of the chunks fetched so far, so that the original
+  // can keep fetching while the clone is used on another thread, e.g. by a
+  // parallel compile task posted during streaming.
   ChunkedStream(const ChunkedStream& other) V8_NOEXCEPT
       : source_(nullptr),
-        chunks_(other.chunks_) {}
+        chunks_(std::make_shared<std::vector<Chunk>>(*other.chunks_)) {}
 
   // The no_gc argument is only here because of the templated way this class
   // is used along with other implementations that require V8 heap access.
@@ -177,10 +180,11 @@ class ChunkedStream {
   struct Chunk {
     Chunk(const Char* const data, size_t position, size_t length)
         : data(data), position(position), length(length) {}
-    std::unique_ptr<const Char[]> data;
+    // Shared with the chunk lists of clones.
+    std::shared_ptr<const Char[]> data;
     // The logical position of data.
-    const size_t position;
-    const size_t length;
+    size_t position;
+    size_t length;
     size_t end_position() const { return position + length; }
   };
 
@@ -570,13 +574,16 @@ class Utf8ExternalStreamingStream final : public BufferedUtf16CharacterStream {
   struct Chunk {
     Chunk(const uint8_t* data, size_t length, StreamPosition start)
         : data(data), length(length), start(start) {}
-    std::unique_ptr<const uint8_t[]> data;
+    // Shared with the chunk lists of clones.
+    std::shared_ptr<const uint8_t[]> data;
     size_t length;
     StreamPosition start;
   };
 
+  // Like ChunkedStream, clones take a snapshot of the chunks fetched so far.
   Utf8ExternalStreamingStream(const Utf8ExternalStreamingStream& source_stream)
-      V8_NOEXCEPT : chunks_(source_stream.chunks_),
+      V8_NOEXCEPT
+      : chunks_(std::make_shared<std::vector<Chunk>>(*source_stream.chunks_)),
                     current_({0, {0, 0, 0, unibrow::Utf8::State::kAccept}}),
                     source_stream_(nullptr) {}
 
@@ -743,10 +750,6 @@ bool Utf8ExternalStreamingStream::FetchChunk() {
   // therefore can't fetch any new data.
   DCHECK_NOT_NULL(source_stream_);
 
-  // Utf8ExternalStreamingStreams that have been cloned are not allowed to fetch
-  // any more.
-  DCHECK_EQ(chunks_.use_count(), 1);
-
   const uint8_t* chunk = nullptr;
   size_t length = source_stream_->GetMoreData(&chunk);
   chunks_->emplace_back(chunk, length, current_.pos);
@@ -8,9 +8,11 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <cmath>
 #include <optional>
 
+#include "hwy/highway.h"
 #include "src/ast/ast-value-factory.h"
 #include "src/base/strings.h"
 #include "src/base/vlq-base64.h"
@@ -23,6 +25,39 @@
 
 namespace v8::internal {
 
+namespace {
+
+namespace hw = hwy::HWY_NAMESPACE;
+using CodeUnitTag = hw::ScalableTag<uint16_t>;
+using CodeUnitVector = hw::Vec<CodeUnitTag>;
+
+// Skips whole vectors of code units at the start of [cursor, end) for which
+// {stop} is false in every lane, and returns the first code unit that {stop}
+// holds for, or the start of the remaining tail that is too short for a
+// vector. The caller finishes the search with its scalar check.
+template <typename StopFunction>
+V8_INLINE const uint16_t* SkipCodeUnitVectors(const uint16_t* cursor,
+                                              const uint16_t* end,
+                                              StopFunction stop) {
+  const CodeUnitTag d;
+  const size_t N = hw::Lanes(d);
+  for (; static_cast<size_t>(end - cursor) >= N; cursor += N) {
+    const auto stops = stop(d, hw::LoadU(d, cursor));
+    if (!hw::AllFalse(d, stops)) {
+      return cursor + hw::FindKnownFirstTrue(d, stops);
+    }
+  }
+  return cursor;
+}
+
+// Lanes that hold one of \n, \r, U+2028 and U+2029.
+V8_INLINE auto LineTerminators(CodeUnitTag d, CodeUnitVector v) {
+  return hw::Or(hw::Or(hw::Eq(v, hw::Set(d, '\n')), hw::Eq(v, hw::Set(d, '\r'))),
+                hw::Eq(hw::And(v, hw::Set(d, 0xFFFE)), hw::Set(d, 0x2028)));
+}
+
+}  // namespace
+
 class Scanner::ErrorState {
  public:
   ErrorState(MessageTemplate* message_stack, Scanner::Location* location_stack)
@@ -237,7 +272,12 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](base::uc32 c0) { return unibrow::IsLineTerminator(c0); });
+  AdvanceUntilFound([](const uint16_t* begin, const uint16_t* end) {
+    begin = SkipCodeUnitVectors(begin, end, LineTerminators);
+    return std::find_if(begin, end, [](uint16_t c0) {
+      return unibrow::IsLineTerminator(c0);
+    });
+  });
 
   return Token::kWhitespace;
 }
@@ -376,12 +416,18 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
-      AdvanceUntil([](base::uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          return unibrow::IsLineTerminator(c0);
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        return MultilineCommentCharacterNeedsSlowPath(char_flags);
+      AdvanceUntilFound([](const uint16_t* begin, const uint16_t* end) {
+        begin = SkipCodeUnitVectors(
+            begin, end, [](CodeUnitTag d, CodeUnitVector v) {
+              return hw::Or(LineTerminators(d, v), hw::Eq(v, hw::Set(d, '*')));
+            });
+        return std::find_if(begin, end, [](uint16_t c0) {
+          if (V8_UNLIKELY(c0 > kMaxAscii)) {
+            return unibrow::IsLineTerminator(c0);
+          }
+          uint8_t char_flags = character_scan_flags[c0];
+          return MultilineCommentCharacterNeedsSlowPath(char_flags);
+        });
       });
 
       while (c0_ == '*') {
@@ -401,7 +447,13 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](base::uc32 c0) { return c0 == '*'; });
+    AdvanceUntilFound([](const uint16_t* begin, const uint16_t* end) {
+      begin = SkipCodeUnitVectors(
+          begin, end, [](CodeUnitTag d, CodeUnitVector v) {
+            return hw::Eq(v, hw::Set(d, '*'));
+          });
+      return std::find(begin, end, '*');
+    });
 
     while (c0_ == '*') {
       Advance();
@@ -555,18 +607,35 @@ Token::Value Scanner::ScanString() {
 
   next().literal_chars.Start();
   while (true) {
-    AdvanceUntil([this](base::uc32 c0) {
-      if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-        if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
-          return true;
+    AdvanceUntilFound([this](const uint16_t* begin, const uint16_t* end) {
+      while (true) {
+        // Runs of ASCII characters that cannot end the string are skipped a
+        // vector at a time.
+        const uint16_t* run_end = SkipCodeUnitVectors(
+            begin, end, [](CodeUnitTag d, CodeUnitVector v) {
+              const auto quotes = hw::Or(hw::Eq(v, hw::Set(d, '\'')),
+                                         hw::Eq(v, hw::Set(d, '"')));
+              const auto breaks = hw::Or(hw::Eq(v, hw::Set(d, '\n')),
+                                         hw::Eq(v, hw::Set(d, '\r')));
+              return hw::Or(hw::Or(quotes, breaks),
+                            hw::Or(hw::Eq(v, hw::Set(d, '\\')),
+                                   hw::Gt(v, hw::Set(d, kMaxAscii))));
+            });
+        for (; begin < run_end; begin++) {
+          AddLiteralChar(static_cast<char>(*begin));
+        }
+        if (begin == end) return end;
+        base::uc32 c0 = *begin;
+        if (V8_UNLIKELY(c0 > kMaxAscii)) {
+          if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
+            return begin;
+          }
+        } else if (MayTerminateString(character_scan_flags[c0])) {
+          return begin;
         }
         AddLiteralChar(c0);
-        return false;
+        begin++;
       }
-      uint8_t char_flags = character_scan_flags[c0];
-      if (MayTerminateString(char_flags)) return true;
-      AddLiteralChar(c0);
-      return false;
     });
 
     while (c0_ == '\\') {
@@ -75,12 +75,22 @@ class Utf16CharacterStream {
   // returns kEndOfInput.
   template <typename FunctionType>
   V8_INLINE base::uc32 AdvanceUntil(FunctionType check) {
-    while (true) {
-      auto next_cursor_pos =
-          std::find_if(buffer_cursor_, buffer_end_, [&check](uint16_t raw_c0_) {
+    return AdvanceUntilFound(
+        [&check](const uint16_t* begin, const uint16_t* end) {
+          return std::find_if(begin, end, [&check](uint16_t raw_c0_) {
             base::uc32 c0_ = static_cast<base::uc32>(raw_c0_);
             return check(c0_);
           });
+        });
+  }
+
+  // Like AdvanceUntil, but {find} is handed the remaining buffer as a range
+  // [begin, end) and returns the first code unit to stop at, or {end}. This
+  // lets callers search the buffer several code units at a time.
+  template <typename FindFunction>
+  V8_INLINE base::uc32 AdvanceUntilFound(FindFunction find) {
+    while (true) {
+      const uint16_t* next_cursor_pos = find(buffer_cursor_, buffer_end_);
 
       if (next_cursor_pos == buffer_end_) {
         buffer_cursor_ = buffer_end_;
@@ -563,6 +573,11 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename FindFunction>
+  V8_INLINE void AdvanceUntilFound(FindFunction find) {
+    c0_ = source_->AdvanceUntilFound(find);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
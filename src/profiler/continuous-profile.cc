@@ -0,0 +1,228 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/profiler/continuous-profile.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "src/base/hashing.h"
+#include "src/profiler/pprof-writer.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+constexpr char kDroppedFrameName[] = "(dropped)";
+constexpr char kRootFrameName[] = "(root)";
+
+const char* FunctionName(const CodeEntry* entry) {
+  const char* name = entry->name();
+  return name[0] == '\0' ? "(anonymous)" : name;
+}
+
+void AppendFoldedFrame(std::string* out, const char* name,
+                       const char* resource_name, int line) {
+  size_t start = out->size();
+  out->append(name);
+  if (resource_name[0] != '\0') {
+    out->push_back(' ');
+    out->append(resource_name);
+    if (line != v8::CpuProfileNode::kNoLineNumberInfo) {
+      out->push_back(':');
+      out->append(std::to_string(line));
+    }
+  }
+  // ';' separates frames and '\n' separates stacks.
+  std::replace_if(
+      out->begin() + start, out->end(),
+      [](char c) { return c == ';' || c == '\n' || c == '\r'; }, '_');
+}
+
+}  // namespace
+
+size_t ContinuousProfile::StackHasher::operator()(const Stack& stack) const {
+  return base::hash_range(stack.begin(), stack.end());
+}
+
+ContinuousProfile::ContinuousProfile(
+    CodeEntryStorage* code_entries,
+    std::unique_ptr<v8::ContinuousProfileDelegate> delegate,
+    const v8::ContinuousProfilingOptions& options)
+    : code_entries_(code_entries),
+      delegate_(std::move(delegate)),
+      format_(options.format),
+      sampling_interval_(base::TimeDelta::FromMicroseconds(
+          std::max(options.sampling_interval_us, 1))),
+      flush_interval_(base::TimeDelta::FromMilliseconds(
+          std::max(options.flush_interval_ms, 1))),
+      max_stacks_(options.max_stacks),
+      window_start_(base::TimeTicks::Now()),
+      window_start_wall_time_(base::Time::Now()) {
+  DCHECK_NOT_NULL(delegate_);
+}
+
+ContinuousProfile::~ContinuousProfile() { Clear(); }
+
+void ContinuousProfile::AddSample(const ProfileStackTrace& stack_trace) {
+  scratch_stack_.clear();
+  for (const CodeEntryAndPosition& frame : stack_trace) {
+    if (frame.code_entry) scratch_stack_.push_back(frame.code_entry);
+  }
+
+  auto it = stacks_.find(scratch_stack_);
+  if (it != stacks_.end()) {
+    it->second++;
+    return;
+  }
+  if (stacks_.size() >= max_stacks_) {
+    dropped_samples_++;
+    return;
+  }
+  // Keep the entries alive until the next flush, even if their code is
+  // collected in the meantime.
+  for (CodeEntry* entry : scratch_stack_) code_entries_->AddRef(entry);
+  stacks_.emplace(scratch_stack_, 1);
+}
+
+void ContinuousProfile::MaybeFlush(base::TimeTicks now) {
+  if (now - window_start_ >= flush_interval_) Flush(now);
+}
+
+void ContinuousProfile::Flush(base::TimeTicks now) {
+  if (!stacks_.empty() || dropped_samples_ > 0) {
+    std::string data = format_ == v8::ContinuousProfileFormat::kPprof
+                           ? SerializePprof(now - window_start_)
+                           : SerializeFoldedStacks();
+    delegate_->OnProfileFlush(data.data(), data.size());
+  }
+  Clear();
+  window_start_ = now;
+  window_start_wall_time_ = base::Time::Now();
+}
+
+void ContinuousProfile::Clear() {
+  for (const auto& [stack, count] : stacks_) {
+    for (CodeEntry* entry : stack) code_entries_->DecRef(entry);
+  }
+  stacks_.clear();
+  dropped_samples_ = 0;
+}
+
+std::string ContinuousProfile::SerializeFoldedStacks() const {
+  std::string out;
+  for (const auto& [stack, count] : stacks_) {
+    if (stack.empty()) {
+      out.append(kRootFrameName);
+    } else {
+      for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
+        if (it != stack.rbegin()) out.push_back(';');
+        const CodeEntry* entry = *it;
+        AppendFoldedFrame(&out, FunctionName(entry), entry->resource_name(),
+                          entry->line_and_column().line);
+      }
+    }
+    out.push_back(' ');
+    out.append(std::to_string(count));
+    out.push_back('\n');
+  }
+  if (dropped_samples_ > 0) {
+    out.append(kDroppedFrameName);
+    out.push_back(' ');
+    out.append(std::to_string(dropped_samples_));
+    out.push_back('\n');
+  }
+  return out;
+}
+
+std::string ContinuousProfile::SerializePprof(base::TimeDelta duration) const {
+  ProtoWriter profile;
+  PprofStringTable strings;
+  const uint64_t period_ns = sampling_interval_.InNanoseconds();
+
+  auto write_value_type = [&](int field, const char* type, const char* unit) {
+    ProtoWriter value_type;
+    value_type.Int(pprof::kValueTypeType, strings.Intern(type));
+    value_type.Int(pprof::kValueTypeUnit, strings.Intern(unit));
+    profile.Message(field, value_type);
+  };
+  write_value_type(pprof::kSampleType, "samples", "count");
+  write_value_type(pprof::kSampleType, "cpu", "nanoseconds");
+
+  // Every code entry becomes one function and one location with the same id.
+  std::unordered_map<const CodeEntry*, uint64_t> ids;
+  uint64_t next_id = 1;
+  auto write_location = [&](uint64_t id, const char* name,
+                            const char* resource_name, int line) {
+    uint64_t name_index = strings.Intern(name);
+    ProtoWriter function;
+    function.Int(pprof::kFunctionId, id);
+    function.Int(pprof::kFunctionName, name_index);
+    function.Int(pprof::kFunctionSystemName, name_index);
+    function.Int(pprof::kFunctionFilename, strings.Intern(resource_name));
+    if (line > 0) function.Int(pprof::kFunctionStartLine, line);
+    profile.Message(pprof::kFunction, function);
+
+    ProtoWriter location;
+    location.Int(pprof::kLocationId, id);
+    ProtoWriter location_line;
+    location_line.Int(pprof::kLineFunctionId, id);
+    if (line > 0) location_line.Int(pprof::kLineLine, line);
+    location.Message(pprof::kLocationLine, location_line);
+    profile.Message(pprof::kLocation, location);
+  };
+  auto synthetic_location = [&](const char* name) {
+    uint64_t id = next_id++;
+    write_location(id, name, "", v8::CpuProfileNode::kNoLineNumberInfo);
+    return id;
+  };
+
+  auto write_sample = [&](const std::vector<uint64_t>& location_ids,
+                          uint64_t count) {
+    ProtoWriter sample;
+    sample.PackedInts(pprof::kSampleLocationId, location_ids);
+    sample.PackedInts(pprof::kSampleValue, {count, count * period_ns});
+    profile.Message(pprof::kSample, sample);
+  };
+
+  std::vector<uint64_t> location_ids;
+  uint64_t root_id = 0;
+  for (const auto& [stack, count] : stacks_) {
+    location_ids.clear();
+    // pprof lists the leaf first, like the stack itself.
+    for (const CodeEntry* entry : stack) {
+      auto [it, inserted] = ids.emplace(entry, next_id);
+      if (inserted) {
+        next_id++;
+        write_location(it->second, FunctionName(entry), entry->resource_name(),
+                       entry->line_and_column().line);
+      }
+      location_ids.push_back(it->second);
+    }
+    if (location_ids.empty()) {
+      if (root_id == 0) root_id = synthetic_location(kRootFrameName);
+      location_ids.push_back(root_id);
+    }
+    write_sample(location_ids, count);
+  }
+  if (dropped_samples_ > 0) {
+    write_sample({synthetic_location(kDroppedFrameName)}, dropped_samples_);
+  }
+
+  profile.Int(pprof::kTimeNanos,
+              (window_start_wall_time_ - base::Time::UnixEpoch())
+                  .InNanoseconds());
+  profile.Int(pprof::kDurationNanos, duration.InNanoseconds());
+  write_value_type(pprof::kPeriodType, "cpu", "nanoseconds");
+  profile.Int(pprof::kPeriod, period_ns);
+  // Written last, once all strings have been interned.
+  for (const std::string& string : strings.strings()) {
+    profile.Bytes(pprof::kStringTable, string);
+  }
+  return std::move(profile.data());
+}
+
+}  // namespace internal
+}  // namespace v8
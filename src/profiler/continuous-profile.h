@@ -0,0 +1,77 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PROFILER_CONTINUOUS_PROFILE_H_
+#define V8_PROFILER_CONTINUOUS_PROFILE_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "include/v8-profiler.h"
+#include "src/base/platform/time.h"
+#include "src/profiler/profile-generator.h"
+
+namespace v8 {
+namespace internal {
+
+// Aggregates the samples of a continuous profiling session by stack, instead
+// of building a ProfileTree, and periodically hands them to the embedder's
+// ContinuousProfileDelegate as folded stacks or as a pprof profile. At most
+// |max_stacks| distinct stacks are kept between two flushes, so together with
+// the fixed-size tick sample queue memory stays bounded for however long the
+// session runs.
+//
+// Only used from the profiler thread, except for the final flush, which
+// happens after that thread has been joined.
+class V8_EXPORT_PRIVATE ContinuousProfile {
+ public:
+  ContinuousProfile(CodeEntryStorage* code_entries,
+                    std::unique_ptr<v8::ContinuousProfileDelegate> delegate,
+                    const v8::ContinuousProfilingOptions& options);
+  ~ContinuousProfile();
+  ContinuousProfile(const ContinuousProfile&) = delete;
+  ContinuousProfile& operator=(const ContinuousProfile&) = delete;
+
+  base::TimeDelta sampling_interval() const { return sampling_interval_; }
+
+  void AddSample(const ProfileStackTrace& stack_trace);
+  // Flushes if the flush interval has elapsed since the previous flush.
+  void MaybeFlush(base::TimeTicks now);
+  void Flush(base::TimeTicks now);
+
+  size_t stack_count() const { return stacks_.size(); }
+  uint64_t dropped_samples() const { return dropped_samples_; }
+
+ private:
+  // Code entries of a sample, leaf first.
+  using Stack = std::vector<CodeEntry*>;
+  struct StackHasher {
+    size_t operator()(const Stack& stack) const;
+  };
+
+  std::string SerializeFoldedStacks() const;
+  std::string SerializePprof(base::TimeDelta duration) const;
+  void Clear();
+
+  CodeEntryStorage* const code_entries_;
+  const std::unique_ptr<v8::ContinuousProfileDelegate> delegate_;
+  const v8::ContinuousProfileFormat format_;
+  const base::TimeDelta sampling_interval_;
+  const base::TimeDelta flush_interval_;
+  const size_t max_stacks_;
+
+  std::unordered_map<Stack, uint64_t, StackHasher> stacks_;
+  uint64_t dropped_samples_ = 0;
+  base::TimeTicks window_start_;
+  base::Time window_start_wall_time_;
+  // Reused between samples to avoid an allocation per sample.
+  Stack scratch_stack_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PROFILER_CONTINUOUS_PROFILE_H_
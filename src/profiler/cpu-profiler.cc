@@ -18,6 +18,7 @@
 #include "src/libsampler/sampler.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
+#include "src/profiler/continuous-profile.h"
 #include "src/profiler/cpu-profiler-inl.h"
 #include "src/profiler/profiler-stats.h"
 #include "src/profiler/symbolizer.h"
@@ -244,6 +245,10 @@ void SamplingEventsProcessor::SymbolizeAndAddToProfiles(
   const TickSample& tick_sample = record->sample;
   Symbolizer::SymbolizedSample symbolized =
       symbolizer_->SymbolizeTickSample(tick_sample);
+  if (continuous_profile_) {
+    continuous_profile_->AddSample(symbolized.stack_trace);
+    return;
+  }
   profiles_->AddPathToCurrentProfiles(
       tick_sample.timestamp, symbolized.stack_trace, symbolized.src_pos,
       tick_sample.update_stats_, tick_sample.sampling_interval_,
@@ -297,6 +302,8 @@ void SamplingEventsProcessor::Run() {
       now = base::TimeTicks::Now();
     } while (result != NoSamplesInQueue && now < nextSampleTime);
 
+    if (continuous_profile_) continuous_profile_->MaybeFlush(now);
+
     if (nextSampleTime > now) {
 #if V8_OS_WIN
       if (use_precise_sampling_ &&
@@ -556,6 +563,7 @@ CpuProfiler::CpuProfiler(Isolate* isolate, CpuProfilingNamingMode naming_mode,
 }
 
 CpuProfiler::~CpuProfiler() {
+  StopContinuousProfiling();
   DCHECK(!is_profiling_);
   GetProfilersManager()->RemoveProfiler(isolate_, this);
 
@@ -646,6 +654,9 @@ CpuProfilingResult CpuProfiler::StartProfiling(
 CpuProfilingResult CpuProfiler::StartProfiling(
     const char* title, CpuProfilingOptions options,
     std::unique_ptr<DiscardedSamplesDelegate> delegate) {
+  if (continuous_profile_) {
+    return {0, CpuProfilingStatus::kErrorTooManyProfilers};
+  }
   CpuProfilingResult result =
       profiles_->StartProfiling(title, std::move(options), std::move(delegate));
 
@@ -709,10 +720,14 @@ void CpuProfiler::StartProcessorIfNotStarted() {
         std::make_unique<Symbolizer>(code_observer_->instruction_stream_map());
   }
 
-  base::TimeDelta sampling_interval = ComputeSamplingInterval();
-  processor_.reset(new SamplingEventsProcessor(
+  base::TimeDelta sampling_interval =
+      continuous_profile_ ? continuous_profile_->sampling_interval()
+                          : ComputeSamplingInterval();
+  SamplingEventsProcessor* processor = new SamplingEventsProcessor(
       isolate_, symbolizer_.get(), code_observer_.get(), profiles_.get(),
-      sampling_interval, use_precise_sampling_));
+      sampling_interval, use_precise_sampling_);
+  processor->set_continuous_profile(continuous_profile_.get());
+  processor_.reset(processor);
   is_profiling_ = true;
 
   // Enable stack sampling.
@@ -749,6 +764,30 @@ CpuProfile* CpuProfiler::StopProfiling(Tagged<String> title) {
   return StopProfiling(profiles_->GetName(title));
 }
 
+CpuProfilingStatus CpuProfiler::StartContinuousProfiling(
+    std::unique_ptr<v8::ContinuousProfileDelegate> delegate,
+    const v8::ContinuousProfilingOptions& options) {
+  if (continuous_profile_) return CpuProfilingStatus::kAlreadyStarted;
+  if (is_profiling_ || processor_) {
+    return CpuProfilingStatus::kErrorTooManyProfilers;
+  }
+  TRACE_EVENT0("v8", "CpuProfiler::StartContinuousProfiling");
+  continuous_profile_ = std::make_unique<ContinuousProfile>(
+      &code_entries_, std::move(delegate), options);
+  StartProcessorIfNotStarted();
+  return CpuProfilingStatus::kStarted;
+}
+
+void CpuProfiler::StopContinuousProfiling() {
+  if (!continuous_profile_) return;
+  // Stopping the processor symbolizes the remaining samples, which are then
+  // flushed here before the code map goes away.
+  StopProcessor();
+  continuous_profile_->Flush(base::TimeTicks::Now());
+  continuous_profile_.reset();
+  if (logging_mode_ == kLazyLogging) DisableLogging();
+}
+
 void CpuProfiler::StopProcessor() {
   is_profiling_ = false;
   processor_->StopSynchronously();
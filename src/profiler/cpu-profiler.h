@@ -28,6 +28,7 @@ namespace internal {
 
 // Forward declarations.
 class CodeEntry;
+class ContinuousProfile;
 class InstructionStreamMap;
 class CpuProfilesCollection;
 class Isolate;
@@ -246,6 +247,12 @@ class V8_EXPORT_PRIVATE SamplingEventsProcessor
   sampler::Sampler* sampler() { return sampler_.get(); }
   base::TimeDelta period() const { return period_; }
 
+  // Routes samples to |profile| instead of the profiles collection. Must be
+  // set before the thread is started.
+  void set_continuous_profile(ContinuousProfile* profile) {
+    continuous_profile_ = profile;
+  }
+
  private:
   SampleProcessingResult ProcessOneSample() override;
   void SymbolizeAndAddToProfiles(const TickSampleEventRecord* record);
@@ -259,6 +266,7 @@ class V8_EXPORT_PRIVATE SamplingEventsProcessor
   base::TimeDelta period_;           // Samples & code events processing period.
   const bool use_precise_sampling_;  // Whether or not busy-waiting is used for
                                      // low sampling intervals on Windows.
+  ContinuousProfile* continuous_profile_ = nullptr;
 #if V8_OS_WIN
   base::PreciseSleepTimer precise_sleep_timer_;
 #endif  // V8_OS_WIN
@@ -369,6 +377,16 @@ class V8_EXPORT_PRIVATE CpuProfiler {
   CpuProfile* StopProfiling(Tagged<String> title);
   CpuProfile* StopProfiling(ProfilerId id);
 
+  // Continuous profiling aggregates samples by stack into a ContinuousProfile
+  // that is periodically flushed to |delegate|. It excludes regular profiles.
+  CpuProfilingStatus StartContinuousProfiling(
+      std::unique_ptr<v8::ContinuousProfileDelegate> delegate,
+      const v8::ContinuousProfilingOptions& options);
+  void StopContinuousProfiling();
+  bool is_continuous_profiling() const {
+    return continuous_profile_ != nullptr;
+  }
+
   int GetProfilesCount();
   CpuProfile* GetProfile(int index);
   void DeleteAllProfiles();
@@ -420,6 +438,7 @@ class V8_EXPORT_PRIVATE CpuProfiler {
   std::unique_ptr<ProfilerEventsProcessor> processor_;
   std::unique_ptr<ProfilerListener> profiler_listener_;
   std::unique_ptr<ProfilingScope> profiling_scope_;
+  std::unique_ptr<ContinuousProfile> continuous_profile_;
   bool is_profiling_;
 };
 
@@ -20,6 +20,7 @@
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/profiler/allocation-tracker.h"
 #include "src/profiler/heap-snapshot-generator-inl.h"
+#include "src/profiler/heap-snapshot-streamer.h"
 #include "src/profiler/sampling-heap-profiler.h"
 #include "src/utils/output-stream.h"
 
@@ -171,6 +172,22 @@ HeapSnapshot* HeapProfiler::TakeSnapshot(
   return result;
 }
 
+bool HeapProfiler::StreamSnapshot(
+    const v8::HeapProfiler::HeapSnapshotOptions options,
+    v8::OutputStream* stream) {
+  is_taking_snapshot_ = true;
+  bool result = false;
+  // As in TakeSnapshot(), the garbage collection and the root visit of the
+  // streamer should scan the same part of the stack.
+  heap()->stack().SetMarkerIfNeededAndCallback(
+      [this, &options, stream, &result]() {
+        HeapSnapshotStreamer streamer(heap(), stream, options.stack_state);
+        result = streamer.Stream();
+      });
+  is_taking_snapshot_ = false;
+  return result;
+}
+
 // Precondition: only call this if you have just completed a full GC cycle.
 void HeapProfiler::WriteSnapshotToDiskAfterGC(HeapSnapshotMode snapshot_mode) {
   // We need to set a stack marker for the stack walk performed by the
@@ -250,6 +267,11 @@ v8::AllocationProfile* HeapProfiler::GetAllocationProfile() {
   }
 }
 
+bool HeapProfiler::WriteSamplingHeapProfileDelta(v8::OutputStream* stream) {
+  if (!sampling_heap_profiler_) return false;
+  return sampling_heap_profiler_->WriteLifetimeDelta(stream);
+}
+
 void HeapProfiler::StartHeapObjectsTracking(bool track_allocations) {
   ids_->UpdateHeapObjectsMap();
   if (native_move_listener_) {
@@ -72,12 +72,17 @@ class HeapProfiler : public HeapObjectAllocationTracker {
                           std::string filename);
   V8_EXPORT_PRIVATE std::string TakeSnapshotToString(
       const v8::HeapProfiler::HeapSnapshotOptions options);
+  // Writes a binary snapshot to |stream| with a HeapSnapshotStreamer, without
+  // keeping a HeapSnapshot around. Returns false if the stream aborted.
+  bool StreamSnapshot(const v8::HeapProfiler::HeapSnapshotOptions options,
+                      v8::OutputStream* stream);
 
   bool StartSamplingHeapProfiler(uint64_t sample_interval, int stack_depth,
                                  v8::HeapProfiler::SamplingFlags);
   void StopSamplingHeapProfiler();
   bool is_sampling_allocations() { return !!sampling_heap_profiler_; }
   AllocationProfile* GetAllocationProfile();
+  bool WriteSamplingHeapProfileDelta(v8::OutputStream* stream);
 
   void StartHeapObjectsTracking(bool track_allocations);
   void StopHeapObjectsTracking();
@@ -0,0 +1,426 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/profiler/heap-snapshot-streamer.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "src/base/platform/elapsed-timer.h"
+#include "src/codegen/assembler-inl.h"
+#include "src/common/assert-scope.h"
+#include "src/execution/isolate-inl.h"
+#include "src/heap/heap-inl.h"
+#include "src/heap/large-page-metadata.h"
+#include "src/heap/paged-spaces-inl.h"
+#include "src/heap/safepoint.h"
+#include "src/heap/spaces-inl.h"
+#include "src/heap/visit-object.h"
+#include "src/init/v8.h"
+#include "src/objects/objects-inl.h"
+#include "src/objects/slots-inl.h"
+#include "src/objects/string-inl.h"
+#include "src/objects/visitors.h"
+
+namespace v8::internal {
+
+namespace {
+
+constexpr char kMagic[] = {'V', '8', 'H', 'S'};
+
+// Longer strings are cut, tools only need names.
+constexpr uint32_t kMaxStringCharacters = 1024;
+
+uint64_t IdOf(Address address) { return address >> kTaggedSizeLog2; }
+
+}  // namespace
+
+// Appends records to a chunk.
+class HeapSnapshotStreamer::Encoder final {
+ public:
+  explicit Encoder(Isolate* isolate) : isolate_(isolate) {
+    chunk_.reserve(kChunkSize + KB);
+  }
+
+  Chunk TakeChunk() {
+    Chunk chunk;
+    chunk.reserve(kChunkSize + KB);
+    chunk.swap(chunk_);
+    return chunk;
+  }
+  size_t size() const { return chunk_.size(); }
+
+  void PutTag(RecordTag tag) { chunk_.push_back(static_cast<char>(tag)); }
+  void PutVarint(uint64_t value) {
+    while (value >= 0x80) {
+      chunk_.push_back(static_cast<char>(value | 0x80));
+      value >>= 7;
+    }
+    chunk_.push_back(static_cast<char>(value));
+  }
+  void PutSigned(int64_t value) {
+    PutVarint((static_cast<uint64_t>(value) << 1) ^
+              static_cast<uint64_t>(value >> 63));
+  }
+  void PutBytes(const char* data, size_t size) {
+    chunk_.insert(chunk_.end(), data, data + size);
+  }
+
+  void EncodePage(MutablePageMetadata* page) {
+    if (page->is_large()) {
+      EncodeObject(LargePageMetadata::cast(page)->GetObject());
+      return;
+    }
+    for (Tagged<HeapObject> object :
+         HeapObjectRange(PageMetadata::cast(page))) {
+      EncodeObject(object);
+    }
+  }
+
+  void EncodeObject(Tagged<HeapObject> object);
+
+ private:
+  class EdgeCollector;
+
+  struct Edge {
+    uint64_t field;
+    Address target;
+  };
+
+  Isolate* const isolate_;
+  Chunk chunk_;
+  // Reused between objects.
+  std::vector<Edge> edges_;
+};
+
+// Collects the references of one object, in the same way as
+// IndexedReferencesExtractor but without names.
+class HeapSnapshotStreamer::Encoder::EdgeCollector final
+    : public ObjectVisitorWithCageBases {
+ public:
+  EdgeCollector(Isolate* isolate, Tagged<HeapObject> host,
+                std::vector<Edge>* edges)
+      : ObjectVisitorWithCageBases(isolate),
+        isolate_(isolate),
+        host_start_(host.address()),
+        edges_(edges) {}
+
+  void VisitPointers(Tagged<HeapObject> host, ObjectSlot start,
+                     ObjectSlot end) override {
+    VisitPointers(host, MaybeObjectSlot(start), MaybeObjectSlot(end));
+  }
+  void VisitMapPointer(Tagged<HeapObject> object) override {
+    VisitSlotImpl(cage_base(), object->map_slot());
+  }
+  void VisitPointers(Tagged<HeapObject> host, MaybeObjectSlot start,
+                     MaybeObjectSlot end) override {
+    for (MaybeObjectSlot slot = start; slot < end; ++slot) {
+      VisitSlotImpl(cage_base(), slot);
+    }
+  }
+  void VisitInstructionStreamPointer(Tagged<Code> host,
+                                     InstructionStreamSlot slot) override {
+    VisitSlotImpl(code_cage_base(), slot);
+  }
+  void VisitCodeTarget(Tagged<InstructionStream> host,
+                       RelocInfo* rinfo) override {
+    Tagged<InstructionStream> target =
+        InstructionStream::FromTargetAddress(rinfo->target_address());
+    AddEdge(0, target, false);
+  }
+  void VisitEmbeddedPointer(Tagged<InstructionStream> host,
+                            RelocInfo* rinfo) override {
+    Tagged<HeapObject> object = rinfo->target_object(cage_base());
+    Tagged<Code> code = UncheckedCast<Code>(host->raw_code(kAcquireLoad));
+    AddEdge(0, object, code->IsWeakObject(object));
+  }
+  void VisitIndirectPointer(Tagged<HeapObject> host, IndirectPointerSlot slot,
+                            IndirectPointerMode mode) override {
+    VisitSlotImpl(isolate_, slot);
+  }
+  void VisitProtectedPointer(Tagged<TrustedObject> host,
+                             ProtectedPointerSlot slot) override {
+    // The cage base is not used for protected pointers.
+    const PtrComprCageBase unused_cage_base(kNullAddress);
+    VisitSlotImpl(unused_cage_base, slot);
+  }
+  void VisitProtectedPointer(Tagged<TrustedObject> host,
+                             ProtectedMaybeObjectSlot slot) override {
+    const PtrComprCageBase unused_cage_base(kNullAddress);
+    VisitSlotImpl(unused_cage_base, slot);
+  }
+  void VisitJSDispatchTableEntry(Tagged<HeapObject> host,
+                                 JSDispatchHandle handle) override {
+    // The code behind a dispatch handle is reached through the function's
+    // other fields, as in heap snapshots.
+  }
+
+ private:
+  template <typename TIsolateOrCageBase, typename TSlot>
+  V8_INLINE void VisitSlotImpl(TIsolateOrCageBase isolate_or_cage_base,
+                               TSlot slot) {
+    const uint64_t field =
+        (slot.address() - host_start_) / TSlot::kSlotDataSize + 1;
+    Tagged<HeapObject> heap_object;
+    auto loaded_value = slot.load(isolate_or_cage_base);
+    if (loaded_value.GetHeapObjectIfStrong(&heap_object)) {
+      AddEdge(field, heap_object, false);
+    } else if (loaded_value.GetHeapObjectIfWeak(&heap_object)) {
+      AddEdge(field, heap_object, true);
+    }
+  }
+
+  V8_INLINE void AddEdge(uint64_t field, Tagged<HeapObject> target,
+                         bool weak) {
+    edges_->push_back(Edge{field << 1 | (weak ? 1 : 0), target.address()});
+  }
+
+  Isolate* const isolate_;
+  const Address host_start_;
+  std::vector<Edge>* const edges_;
+};
+
+void HeapSnapshotStreamer::Encoder::EncodeObject(Tagged<HeapObject> object) {
+  PtrComprCageBase cage_base(isolate_);
+  edges_.clear();
+  EdgeCollector collector(isolate_, object, &edges_);
+  VisitObject(isolate_, object, &collector);
+
+  const uint64_t id = IdOf(object.address());
+  PutTag(kObject);
+  PutVarint(id);
+  PutVarint(object->map(cage_base)->instance_type());
+  PutVarint(object->Size(cage_base));
+  PutVarint(edges_.size());
+  for (const Edge& edge : edges_) {
+    PutVarint(edge.field);
+    PutSigned(static_cast<int64_t>(IdOf(edge.target) - id));
+  }
+
+  if (IsInternalizedString(object, cage_base) &&
+      IsSeqOneByteString(object, cage_base)) {
+    Tagged<SeqOneByteString> string = Cast<SeqOneByteString>(object);
+    const uint32_t length = std::min(string->length(), kMaxStringCharacters);
+    PutTag(kString);
+    PutVarint(id);
+    PutVarint(length);
+    // Inside the safepoint no access guard is needed.
+    PutBytes(reinterpret_cast<const char*>(string->GetCharsAddress()),
+             length);
+  }
+}
+
+// Writes the strong and then the weak roots of the heap.
+class HeapSnapshotStreamer::RootsEncoder final : public RootVisitor {
+ public:
+  RootsEncoder(Heap* heap, Encoder* encoder)
+      : heap_(heap), encoder_(encoder) {}
+
+  void SetVisitingWeakRoots() { weak_ = true; }
+
+  void VisitRootPointer(Root root, const char* description,
+                        FullObjectSlot p) override {
+    AddRoot(root, *p);
+  }
+  void VisitRootPointers(Root root, const char* description,
+                         FullObjectSlot start, FullObjectSlot end) override {
+    for (FullObjectSlot p = start; p < end; ++p) AddRoot(root, *p);
+  }
+  void VisitCompressedRootPointers(Root root, const char* description,
+                                   OffHeapObjectSlot start,
+                                   OffHeapObjectSlot end) override {
+    PtrComprCageBase cage_base(heap_->isolate());
+    for (OffHeapObjectSlot p = start; p < end; ++p) {
+      AddRoot(root, p.load(cage_base));
+    }
+  }
+  // Keep this synced with
+  // MarkCompactCollector::RootMarkingVisitor::VisitRunningCode.
+  void VisitRunningCode(FullObjectSlot code_slot,
+                        FullObjectSlot istream_or_smi_zero_slot) final {
+    Tagged<Object> istream_or_smi_zero = *istream_or_smi_zero_slot;
+    if (istream_or_smi_zero != Smi::zero()) {
+      Tagged<Code> code = CheckedCast<Code>(*code_slot);
+      code->IterateDeoptimizationLiterals(this);
+      VisitRootPointer(Root::kStackRoots, nullptr, istream_or_smi_zero_slot);
+    }
+    VisitRootPointer(Root::kStackRoots, nullptr, code_slot);
+  }
+
+ private:
+  void AddRoot(Root root, Tagged<Object> object) {
+    Tagged<HeapObject> heap_object;
+    if (!TryCast(object, &heap_object)) return;
+    encoder_->PutTag(kRoot);
+    encoder_->PutVarint(static_cast<uint64_t>(root));
+    encoder_->PutVarint(weak_ ? 1 : 0);
+    encoder_->PutVarint(IdOf(heap_object.address()));
+  }
+
+  Heap* const heap_;
+  Encoder* const encoder_;
+  bool weak_ = false;
+};
+
+class HeapSnapshotStreamer::Job final : public v8::JobTask {
+ public:
+  explicit Job(HeapSnapshotStreamer* streamer) : streamer_(streamer) {}
+  ~Job() override = default;
+  Job(const Job&) = delete;
+  Job& operator=(const Job&) = delete;
+
+  // v8::JobTask overrides.
+  void Run(JobDelegate* delegate) override {
+    // Set the current isolate such that trusted pointer tables etc are
+    // available and the cage base is set correctly for multi-cage mode.
+    SetCurrentIsolateScope isolate_scope(streamer_->heap_->isolate());
+    streamer_->EncodePages(delegate);
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    return streamer_->GetMaxConcurrency(worker_count);
+  }
+
+ private:
+  HeapSnapshotStreamer* const streamer_;
+};
+
+HeapSnapshotStreamer::HeapSnapshotStreamer(
+    Heap* heap, v8::OutputStream* stream,
+    cppgc::EmbedderStackState stack_state)
+    : heap_(heap),
+      stream_(stream),
+      stack_state_(stack_state),
+      stream_chunk_size_(std::max(stream->GetChunkSize(), 1)) {}
+
+bool HeapSnapshotStreamer::Stream() {
+  base::ElapsedTimer timer;
+  timer.Start();
+
+  Isolate* isolate = heap_->isolate();
+  SafepointScope scope(isolate, kGlobalSafepointForSharedSpaceIsolate);
+  EmbedderStackStateScope stack_scope(
+      heap_, EmbedderStackStateOrigin::kImplicitThroughTask, stack_state_);
+  heap_->CollectAllAvailableGarbage(GarbageCollectionReason::kHeapProfiler);
+  heap_->MakeHeapIterable(CompleteSweepingReason::kHeapSnapshot);
+  DisallowGarbageCollection no_gc;
+
+  // A full GC evacuates the young generation's regular pages, so only their
+  // large objects are left to walk.
+  for (MemoryChunkIterator it(heap_); it.HasNext();) {
+    MutablePageMetadata* page = it.Next();
+    if (page->Chunk()->InNewSpace()) continue;
+    pages_.push_back(page);
+  }
+
+  const bool completed = StreamPages();
+  if (completed) stream_->EndOfStream();
+
+  if (v8_flags.profile_heap_snapshot) {
+    base::OS::PrintError("[Streaming heap snapshot took %0.3f ms]\n",
+                         timer.Elapsed().InMillisecondsF());
+  }
+  return completed;
+}
+
+bool HeapSnapshotStreamer::StreamPages() {
+  Encoder encoder(heap_->isolate());
+  encoder.PutBytes(kMagic, sizeof(kMagic));
+  encoder.PutVarint(kVersion);
+  encoder.PutVarint(kTaggedSize);
+
+  RootsEncoder roots(heap_, &encoder);
+  heap_->IterateRoots(
+      &roots,
+      base::EnumSet<SkipRoot>{SkipRoot::kWeak, SkipRoot::kTracedHandles});
+  roots.SetVisitingWeakRoots();
+  heap_->IterateWeakRoots(&roots, {});
+  heap_->IterateWeakGlobalHandles(&roots);
+
+  std::unique_ptr<JobHandle> job = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserBlocking, std::make_unique<Job>(this));
+
+  // The main thread encodes pages too, and writes out what the workers
+  // submitted in between.
+  while (!aborted_.load(std::memory_order_relaxed)) {
+    if (encoder.size() >= kChunkSize && !Write(encoder.TakeChunk())) break;
+    if (!WritePending()) break;
+    // Workers that paused on a full queue can go on.
+    job->NotifyConcurrencyIncrease();
+    MutablePageMetadata* page = ClaimPage();
+    if (page == nullptr) break;
+    encoder.EncodePage(page);
+  }
+  job->Join();
+  if (aborted_.load(std::memory_order_relaxed)) return false;
+
+  encoder.PutTag(kEnd);
+  return WritePending() && Write(encoder.TakeChunk());
+}
+
+void HeapSnapshotStreamer::EncodePages(JobDelegate* delegate) {
+  Encoder encoder(heap_->isolate());
+  while (!aborted_.load(std::memory_order_relaxed) &&
+         !delegate->ShouldYield()) {
+    {
+      base::MutexGuard guard(&mutex_);
+      if (pending_.size() >= kMaxPendingChunks) break;
+    }
+    MutablePageMetadata* page = ClaimPage();
+    if (page == nullptr) break;
+    encoder.EncodePage(page);
+    if (encoder.size() >= kChunkSize) Submit(encoder.TakeChunk());
+  }
+  if (encoder.size() > 0) Submit(encoder.TakeChunk());
+}
+
+MutablePageMetadata* HeapSnapshotStreamer::ClaimPage() {
+  const size_t index = next_page_.fetch_add(1, std::memory_order_relaxed);
+  return index < pages_.size() ? pages_[index] : nullptr;
+}
+
+size_t HeapSnapshotStreamer::GetMaxConcurrency(size_t worker_count) const {
+  if (aborted_.load(std::memory_order_relaxed)) return 0;
+  const size_t next_page = next_page_.load(std::memory_order_relaxed);
+  if (next_page >= pages_.size()) return 0;
+  {
+    base::MutexGuard guard(&mutex_);
+    if (pending_.size() >= kMaxPendingChunks) return 0;
+  }
+  return pages_.size() - next_page;
+}
+
+void HeapSnapshotStreamer::Submit(Chunk chunk) {
+  base::MutexGuard guard(&mutex_);
+  pending_.push_back(std::move(chunk));
+}
+
+bool HeapSnapshotStreamer::WritePending() {
+  while (true) {
+    Chunk chunk;
+    {
+      base::MutexGuard guard(&mutex_);
+      if (pending_.empty()) return true;
+      chunk = std::move(pending_.front());
+      pending_.pop_front();
+    }
+    if (!Write(chunk)) return false;
+  }
+}
+
+bool HeapSnapshotStreamer::Write(const Chunk& chunk) {
+  for (size_t offset = 0; offset < chunk.size();
+       offset += stream_chunk_size_) {
+    const size_t size = std::min(stream_chunk_size_, chunk.size() - offset);
+    if (stream_->WriteAsciiChunk(const_cast<char*>(chunk.data() + offset),
+                                 static_cast<int>(size)) ==
+        v8::OutputStream::kAbort) {
+      aborted_.store(true, std::memory_order_relaxed);
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace v8::internal
@@ -0,0 +1,103 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PROFILER_HEAP_SNAPSHOT_STREAMER_H_
+#define V8_PROFILER_HEAP_SNAPSHOT_STREAMER_H_
+
+#include <atomic>
+#include <deque>
+#include <vector>
+
+#include "include/cppgc/common.h"
+#include "include/v8-platform.h"
+#include "include/v8-profiler.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+
+namespace v8::internal {
+
+class Heap;
+class MutablePageMetadata;
+
+// Writes the object graph of a heap to an OutputStream while walking it, in
+// a compact binary format, without building a HeapSnapshot. Worker threads
+// walk the pages of the heap in parallel and hand whole chunks of records to
+// the main thread, which writes them out as they come, so memory use stays
+// at a bounded number of chunks instead of growing with the heap.
+//
+// The stream is a header followed by records. Integers are LEB128 varints,
+// signed ones zigzag encoded first:
+//
+//   header:  "V8HS" version tagged_size
+//   kRoot:   tag root weak target_id
+//   kObject: tag id instance_type size edge_count
+//            edge_count * (field target_id_delta)
+//   kString: tag id length characters
+//   kEnd:    tag
+//
+// An object's id is its address divided by tagged_size, and an edge gives
+// its target relative to the id of the object it leaves. |field| is
+// (slot index + 1) << 1 | weak, where slot index + 1 is 0 for references
+// from relocation info. kString records carry the characters of flat
+// one-byte internalized strings, so that tools can name properties and
+// constructors by following maps. Objects in read-only space are not
+// written, though edges to them are.
+//
+// Compared to HeapSnapshotGenerator, there are no synthetic names, no ids
+// that stay stable between snapshots and no embedder graph. Records from
+// different threads interleave, but each record is written whole.
+class HeapSnapshotStreamer final {
+ public:
+  enum RecordTag : uint8_t { kEnd = 0, kRoot = 1, kObject = 2, kString = 3 };
+  static constexpr uint8_t kVersion = 1;
+
+  HeapSnapshotStreamer(Heap* heap, v8::OutputStream* stream,
+                       cppgc::EmbedderStackState stack_state);
+  HeapSnapshotStreamer(const HeapSnapshotStreamer&) = delete;
+  HeapSnapshotStreamer& operator=(const HeapSnapshotStreamer&) = delete;
+
+  // Collects garbage and streams the heap. Returns false if the stream
+  // aborted, in which case EndOfStream() is not called.
+  bool Stream();
+
+ private:
+  class Encoder;
+  class Job;
+  class RootsEncoder;
+
+  using Chunk = std::vector<char>;
+
+  // Chunks are handed over once they reach kChunkSize. Workers pause while
+  // kMaxPendingChunks wait to be written.
+  static constexpr size_t kChunkSize = 64 * KB;
+  static constexpr size_t kMaxPendingChunks = 64;
+
+  bool StreamPages();
+  // Encodes pages until none are left, the stream aborted or, for workers,
+  // too many chunks are pending or |delegate| asks to yield.
+  void EncodePages(JobDelegate* delegate);
+  MutablePageMetadata* ClaimPage();
+  size_t GetMaxConcurrency(size_t worker_count) const;
+
+  void Submit(Chunk chunk);
+  // Writes the submitted chunks on the main thread.
+  bool WritePending();
+  bool Write(const Chunk& chunk);
+
+  Heap* const heap_;
+  v8::OutputStream* const stream_;
+  const cppgc::EmbedderStackState stack_state_;
+  const size_t stream_chunk_size_;
+
+  std::vector<MutablePageMetadata*> pages_;
+  std::atomic<size_t> next_page_{0};
+  std::atomic<bool> aborted_{false};
+
+  mutable base::Mutex mutex_;
+  std::deque<Chunk> pending_;
+};
+
+}  // namespace v8::internal
+
+#endif  // V8_PROFILER_HEAP_SNAPSHOT_STREAMER_H_
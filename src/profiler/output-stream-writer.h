@@ -36,8 +36,9 @@ class OutputStreamWriter {
     chunk_[chunk_pos_++] = c;
     MaybeWriteChunk();
   }
-  void AddString(const char* s) {
-    size_t len = strlen(s);
+  void AddString(const char* s) { AddBytes(s, strlen(s)); }
+  // Unlike AddString, |s| may contain '\0', e.g. for binary formats.
+  void AddBytes(const char* s, size_t len) {
     DCHECK_GE(kMaxInt, len);
     const char* s_end = s + len;
     while (s < s_end) {
@@ -0,0 +1,112 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PROFILER_PPROF_WRITER_H_
+#define V8_PROFILER_PPROF_WRITER_H_
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace v8 {
+namespace internal {
+
+// Just enough of the protocol buffer wire format to write a pprof Profile
+// (https://github.com/google/pprof/blob/main/proto/profile.proto).
+class ProtoWriter {
+ public:
+  void Varint(uint64_t value) {
+    while (value >= 0x80) {
+      data_.push_back(static_cast<char>(value | 0x80));
+      value >>= 7;
+    }
+    data_.push_back(static_cast<char>(value));
+  }
+
+  void Int(int field, uint64_t value) {
+    Tag(field, kVarint);
+    Varint(value);
+  }
+
+  void Bytes(int field, const char* data, size_t size) {
+    Tag(field, kLengthDelimited);
+    Varint(size);
+    data_.append(data, size);
+  }
+  void Bytes(int field, const std::string& data) {
+    Bytes(field, data.data(), data.size());
+  }
+  void Message(int field, const ProtoWriter& message) {
+    Bytes(field, message.data_);
+  }
+  void PackedInts(int field, const std::vector<uint64_t>& values) {
+    ProtoWriter packed;
+    for (uint64_t value : values) packed.Varint(value);
+    Message(field, packed);
+  }
+
+  std::string& data() { return data_; }
+
+ private:
+  static constexpr int kVarint = 0;
+  static constexpr int kLengthDelimited = 2;
+
+  void Tag(int field, int wire_type) { Varint((field << 3) | wire_type); }
+
+  std::string data_;
+};
+
+// Interns the strings of a pprof Profile; index 0 must be "".
+class PprofStringTable {
+ public:
+  PprofStringTable() { Intern(""); }
+
+  uint64_t Intern(const char* string) {
+    auto [it, inserted] = indices_.emplace(string, strings_.size());
+    if (inserted) strings_.push_back(string);
+    return it->second;
+  }
+
+  const std::vector<std::string>& strings() const { return strings_; }
+
+ private:
+  std::unordered_map<std::string, uint64_t> indices_;
+  std::vector<std::string> strings_;
+};
+
+// Field numbers of profile.proto.
+namespace pprof {
+
+enum ProfileField {
+  kSampleType = 1,
+  kSample = 2,
+  kLocation = 4,
+  kFunction = 5,
+  kStringTable = 6,
+  kTimeNanos = 9,
+  kDurationNanos = 10,
+  kPeriodType = 11,
+  kPeriod = 12,
+  kComment = 13,
+};
+enum ValueTypeField { kValueTypeType = 1, kValueTypeUnit = 2 };
+enum SampleField { kSampleLocationId = 1, kSampleValue = 2, kSampleLabel = 3 };
+enum LabelField { kLabelKey = 1, kLabelStr = 2, kLabelNum = 3, kLabelUnit = 4 };
+enum LocationField { kLocationId = 1, kLocationLine = 4 };
+enum LineField { kLineFunctionId = 1, kLineLine = 2 };
+enum FunctionField {
+  kFunctionId = 1,
+  kFunctionName = 2,
+  kFunctionSystemName = 3,
+  kFunctionFilename = 4,
+  kFunctionStartLine = 5,
+};
+
+}  // namespace pprof
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_PROFILER_PPROF_WRITER_H_
@@ -16,6 +16,8 @@
 #include "src/execution/isolate.h"
 #include "src/heap/heap-layout-inl.h"
 #include "src/heap/heap.h"
+#include "src/profiler/output-stream-writer.h"
+#include "src/profiler/pprof-writer.h"
 #include "src/profiler/strings-storage.h"
 
 namespace v8 {
@@ -63,7 +65,9 @@ SamplingHeapProfiler::SamplingHeapProfiler(
                     next_node_id()),
       stack_depth_(stack_depth),
       rate_(rate),
-      flags_(flags) {
+      flags_(flags),
+      lifetime_window_start_(base::TimeTicks::Now()),
+      lifetime_window_start_wall_time_(base::Time::Now()) {
   CHECK_GT(rate_, 0u);
   heap_->AddAllocationObserversToAllSpaces(&allocation_observer_,
                                            &allocation_observer_);
@@ -95,16 +99,52 @@ void SamplingHeapProfiler::SampleObject(Address soon_object, size_t size) {
 
   AllocationNode* node = AddStack();
   node->allocations_[size]++;
-  auto sample =
-      std::make_unique<Sample>(size, node, loc, this, next_sample_id());
+  auto sample = std::make_unique<Sample>(
+      size, node, loc, this, next_sample_id(),
+      isolate_->time_millis_since_init(), heap_->gc_count());
   sample->global.SetWeak(sample.get(), OnWeakCallback,
                          WeakCallbackType::kParameter);
+  if (flags_ & v8::HeapProfiler::kSamplingRecordLifetimes) {
+    RecordLifetimeEvent(*sample, false);
+  }
   samples_.emplace(sample.get(), std::move(sample));
 }
 
+uint32_t SamplingHeapProfiler::SurvivedGCCount(const Sample& sample) const {
+  uint32_t gc_count =
+      heap_->gc_count().value() - sample.allocation_gc_count.value();
+  // A dying object did not survive the GC that is collecting it.
+  if (heap_->gc_state() != Heap::NOT_IN_GC && gc_count > 0) gc_count--;
+  return gc_count;
+}
+
+void SamplingHeapProfiler::RecordLifetimeEvent(const Sample& sample,
+                                               bool is_death) {
+  if (lifetime_events_.size() >= kMaxLifetimeEvents) {
+    dropped_lifetime_events_++;
+    return;
+  }
+  LifetimeEvent& event = lifetime_events_.emplace_back();
+  event.is_death = is_death;
+  event.size = sample.size;
+  for (const AllocationNode* node = sample.owner; node != &profile_root_;
+       node = node->parent_) {
+    event.stack.push_back(
+        {node->name_, node->script_id_, node->script_position_});
+  }
+  if (is_death) {
+    event.lifetime_ms =
+        isolate_->time_millis_since_init() - sample.allocation_time_ms;
+    event.survived_gc_count = SurvivedGCCount(sample);
+  }
+}
+
 void SamplingHeapProfiler::OnWeakCallback(
     const WeakCallbackInfo<Sample>& data) {
   Sample* sample = data.GetParameter();
+  if (sample->profiler->flags_ & v8::HeapProfiler::kSamplingRecordLifetimes) {
+    sample->profiler->RecordLifetimeEvent(*sample, true);
+  }
   Heap* heap = reinterpret_cast<Isolate*>(data.GetIsolate())->heap();
   bool is_minor_gc = Heap::IsYoungGenerationCollector(
       heap->current_or_last_garbage_collector());
@@ -291,14 +331,7 @@ v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile() {
   }
   // To resolve positions to line/column numbers, we will need to look up
   // scripts. Build a map to allow fast mapping from script id to script.
-  std::map<int, Handle<Script>> scripts;
-  {
-    Script::Iterator iterator(isolate_);
-    for (Tagged<Script> script = iterator.Next(); !script.is_null();
-         script = iterator.Next()) {
-      scripts[script->id()] = handle(script, isolate_);
-    }
-  }
+  std::map<int, Handle<Script>> scripts = CollectScripts();
   auto profile = new v8::internal::AllocationProfile();
   TranslateAllocationNode(profile, &profile_root_, scripts);
   profile->samples_ = BuildSamples();
@@ -306,6 +339,137 @@ v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile() {
   return profile;
 }
 
+std::map<int, Handle<Script>> SamplingHeapProfiler::CollectScripts() {
+  std::map<int, Handle<Script>> scripts;
+  Script::Iterator iterator(isolate_);
+  for (Tagged<Script> script = iterator.Next(); !script.is_null();
+       script = iterator.Next()) {
+    scripts[script->id()] = handle(script, isolate_);
+  }
+  return scripts;
+}
+
+bool SamplingHeapProfiler::WriteLifetimeDelta(v8::OutputStream* stream) {
+  if (!(flags_ & v8::HeapProfiler::kSamplingRecordLifetimes)) return false;
+
+  // Take the events first: resolving scripts allocates and may thus sample.
+  std::vector<LifetimeEvent> events = std::move(lifetime_events_);
+  lifetime_events_.clear();
+  size_t dropped_events = dropped_lifetime_events_;
+  dropped_lifetime_events_ = 0;
+  base::TimeTicks now = base::TimeTicks::Now();
+  base::TimeDelta duration = now - lifetime_window_start_;
+  base::Time window_start_wall_time = lifetime_window_start_wall_time_;
+  lifetime_window_start_ = now;
+  lifetime_window_start_wall_time_ = base::Time::Now();
+
+  HandleScope scope(isolate_);
+  std::map<int, Handle<Script>> scripts = CollectScripts();
+
+  ProtoWriter profile;
+  PprofStringTable strings;
+  auto write_value_type = [&](int field, const char* type, const char* unit) {
+    ProtoWriter value_type;
+    value_type.Int(pprof::kValueTypeType, strings.Intern(type));
+    value_type.Int(pprof::kValueTypeUnit, strings.Intern(unit));
+    profile.Message(field, value_type);
+  };
+  write_value_type(pprof::kSampleType, "alloc_objects", "count");
+  write_value_type(pprof::kSampleType, "alloc_space", "bytes");
+  write_value_type(pprof::kSampleType, "free_objects", "count");
+  write_value_type(pprof::kSampleType, "free_space", "bytes");
+
+  // Every function becomes one pprof function and one location with the same
+  // id.
+  std::unordered_map<AllocationNode::FunctionId, uint64_t> ids;
+  auto location_id = [&](const LifetimeEvent::Frame& frame) {
+    AllocationNode::FunctionId function_id = AllocationNode::function_id(
+        frame.script_id, frame.script_position, frame.name);
+    auto [it, inserted] = ids.emplace(function_id, ids.size() + 1);
+    if (!inserted) return it->second;
+
+    const char* script_name = "";
+    int line = 0;
+    auto script_it = scripts.find(frame.script_id);
+    if (script_it != scripts.end()) {
+      DirectHandle<Script> script = script_it->second;
+      if (IsName(script->name())) {
+        script_name = names_->GetName(Cast<Name>(script->name()));
+      }
+      Script::PositionInfo pos_info;
+      Script::GetPositionInfo(script, frame.script_position, &pos_info);
+      line = pos_info.line + 1;
+    }
+    uint64_t name_index = strings.Intern(frame.name);
+    ProtoWriter function;
+    function.Int(pprof::kFunctionId, it->second);
+    function.Int(pprof::kFunctionName, name_index);
+    function.Int(pprof::kFunctionSystemName, name_index);
+    function.Int(pprof::kFunctionFilename, strings.Intern(script_name));
+    if (line > 0) function.Int(pprof::kFunctionStartLine, line);
+    profile.Message(pprof::kFunction, function);
+
+    ProtoWriter location;
+    location.Int(pprof::kLocationId, it->second);
+    ProtoWriter location_line;
+    location_line.Int(pprof::kLineFunctionId, it->second);
+    if (line > 0) location_line.Int(pprof::kLineLine, line);
+    location.Message(pprof::kLocationLine, location_line);
+    profile.Message(pprof::kLocation, location);
+    return it->second;
+  };
+  auto write_label = [&](ProtoWriter* sample, const char* key, uint64_t value,
+                         const char* unit) {
+    ProtoWriter label;
+    label.Int(pprof::kLabelKey, strings.Intern(key));
+    label.Int(pprof::kLabelNum, value);
+    label.Int(pprof::kLabelUnit, strings.Intern(unit));
+    sample->Message(pprof::kSampleLabel, label);
+  };
+
+  std::vector<uint64_t> location_ids;
+  for (const LifetimeEvent& event : events) {
+    location_ids.clear();
+    for (const LifetimeEvent::Frame& frame : event.stack) {
+      location_ids.push_back(location_id(frame));
+    }
+    uint64_t objects = ScaleSample(event.size, 1).count;
+    uint64_t bytes = objects * event.size;
+    ProtoWriter sample;
+    sample.PackedInts(pprof::kSampleLocationId, location_ids);
+    if (event.is_death) {
+      sample.PackedInts(pprof::kSampleValue, {0, 0, objects, bytes});
+      write_label(&sample, "lifetime",
+                  static_cast<uint64_t>(event.lifetime_ms), "milliseconds");
+      write_label(&sample, "survived_gcs", event.survived_gc_count, "count");
+    } else {
+      sample.PackedInts(pprof::kSampleValue, {objects, bytes, 0, 0});
+    }
+    profile.Message(pprof::kSample, sample);
+  }
+
+  profile.Int(pprof::kTimeNanos,
+              (window_start_wall_time - base::Time::UnixEpoch())
+                  .InNanoseconds());
+  profile.Int(pprof::kDurationNanos, duration.InNanoseconds());
+  write_value_type(pprof::kPeriodType, "space", "bytes");
+  profile.Int(pprof::kPeriod, rate_);
+  if (dropped_events > 0) {
+    std::string comment =
+        "dropped " + std::to_string(dropped_events) + " lifetime events";
+    profile.Int(pprof::kComment, strings.Intern(comment.c_str()));
+  }
+  // Written last, once all strings have been interned.
+  for (const std::string& string : strings.strings()) {
+    profile.Bytes(pprof::kStringTable, string);
+  }
+
+  OutputStreamWriter writer(stream);
+  writer.AddBytes(profile.data().data(), profile.data().size());
+  writer.Finalize();
+  return true;
+}
+
 const std::vector<v8::AllocationProfile::Sample>
 SamplingHeapProfiler::BuildSamples() const {
   std::vector<v8::AllocationProfile::Sample> samples;
@@ -314,7 +478,8 @@ SamplingHeapProfiler::BuildSamples() const {
     const Sample* sample = it.second.get();
     samples.emplace_back(v8::AllocationProfile::Sample{
         sample->owner->id_, sample->size, ScaleSample(sample->size, 1).count,
-        sample->sample_id});
+        sample->sample_id, sample->allocation_time_ms,
+        SurvivedGCCount(*sample)});
   }
   return samples;
 }
@@ -9,8 +9,10 @@
 #include <map>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "include/v8-profiler.h"
+#include "src/base/platform/time.h"
 #include "src/heap/heap.h"
 #include "src/profiler/strings-storage.h"
 
@@ -101,12 +103,15 @@ class SamplingHeapProfiler {
 
   struct Sample {
     Sample(size_t size_, AllocationNode* owner_, Local<Value> local_,
-           SamplingHeapProfiler* profiler_, uint64_t sample_id)
+           SamplingHeapProfiler* profiler_, uint64_t sample_id,
+           double allocation_time_ms, GCEpoch allocation_gc_count)
         : size(size_),
           owner(owner_),
           global(reinterpret_cast<v8::Isolate*>(profiler_->isolate_), local_),
           profiler(profiler_),
-          sample_id(sample_id) {}
+          sample_id(sample_id),
+          allocation_time_ms(allocation_time_ms),
+          allocation_gc_count(allocation_gc_count) {}
     Sample(const Sample&) = delete;
     Sample& operator=(const Sample&) = delete;
     const size_t size;
@@ -114,6 +119,8 @@ class SamplingHeapProfiler {
     Global<Value> global;
     SamplingHeapProfiler* const profiler;
     const uint64_t sample_id;
+    const double allocation_time_ms;
+    const GCEpoch allocation_gc_count;
   };
 
   SamplingHeapProfiler(Heap* heap, StringsStorage* names, uint64_t rate,
@@ -123,6 +130,9 @@ class SamplingHeapProfiler {
   SamplingHeapProfiler& operator=(const SamplingHeapProfiler&) = delete;
 
   v8::AllocationProfile* GetAllocationProfile();
+  // Writes the lifetime events recorded since the previous call as a pprof
+  // profile. Requires kSamplingRecordLifetimes.
+  bool WriteLifetimeDelta(v8::OutputStream* stream);
   StringsStorage* names() const { return names_; }
 
  private:
@@ -158,7 +168,29 @@ class SamplingHeapProfiler {
     uint64_t const rate_;
   };
 
+  // An allocation or death of a sampled object, recorded with
+  // kSamplingRecordLifetimes until the next WriteLifetimeDelta.
+  struct LifetimeEvent {
+    struct Frame {
+      const char* name;
+      int script_id;
+      int script_position;
+    };
+    bool is_death;
+    size_t size;
+    // The allocation stack, leaf first. Captured eagerly since nodes are
+    // removed from the tree once their last sample dies.
+    std::vector<Frame> stack;
+    double lifetime_ms = 0;
+    uint32_t survived_gc_count = 0;
+  };
+  // Bounds the memory used by lifetime events if the embedder does not
+  // write deltas often enough; further events are only counted.
+  static constexpr size_t kMaxLifetimeEvents = 64 * 1024;
+
   void SampleObject(Address soon_object, size_t size);
+  void RecordLifetimeEvent(const Sample& sample, bool is_death);
+  uint32_t SurvivedGCCount(const Sample& sample) const;
 
   const std::vector<v8::AllocationProfile::Sample> BuildSamples() const;
 
@@ -182,6 +214,7 @@ class SamplingHeapProfiler {
   v8::AllocationProfile::Allocation ScaleSample(size_t size,
                                                 unsigned int count) const;
   AllocationNode* AddStack();
+  std::map<int, Handle<Script>> CollectScripts();
 
   Isolate* const isolate_;
   Heap* const heap_;
@@ -194,6 +227,10 @@ class SamplingHeapProfiler {
   const int stack_depth_;
   const uint64_t rate_;
   v8::HeapProfiler::SamplingFlags flags_;
+  std::vector<LifetimeEvent> lifetime_events_;
+  size_t dropped_lifetime_events_ = 0;
+  base::TimeTicks lifetime_window_start_;
+  base::Time lifetime_window_start_wall_time_;
 };
 
 }  // namespace internal
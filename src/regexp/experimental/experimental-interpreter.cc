@@ -4,9 +4,12 @@
 
 #include "src/regexp/experimental/experimental-interpreter.h"
 
+#include <algorithm>
+
 #include "src/objects/string-inl.h"
 #include "src/regexp/experimental/experimental.h"
 #include "src/sandbox/check.h"
+#include "src/zone/zone-containers.h"
 
 namespace v8 {
 namespace internal {
@@ -237,6 +240,412 @@ class FilterGroups {
   base::Vector<const RegExpInstruction> bytecode_;
 };
 
+// A lazily built DFA over the experimental bytecode, in the spirit of RE2's
+// DFA.  It is only used for programs without assertions and lookarounds, so
+// that whether a thread survives depends on nothing but the characters it
+// consumes.  Two automata are built on demand:
+//
+// - The forward automaton simulates the priority-ordered thread list of
+//   `NfaInterpreter` without registers.  A state is the list of pcs at which
+//   threads are blocked on input, from high to low priority, and whether a
+//   thread executed ACCEPT at the current position.  As in `NfaInterpreter`,
+//   ACCEPT cuts off all threads of lower priority, so the last position at
+//   which a forward state accepts is the end of the match that
+//   `NfaInterpreter` would report.
+// - The reverse automaton runs from the end of that match towards the start
+//   of the input and tracks the pcs of the pattern body (without the /.*?/
+//   preamble) from which the rest of the match can be consumed.  Matches
+//   that start earlier take priority, so the leftmost position at which it
+//   reaches the start of the body is the start of the match.
+//
+// States and their transitions are cached with a fixed memory budget.  Once
+// the budget is exhausted, the DFA gives up and the caller should continue
+// with NFA simulation.
+class LazyDfa {
+ public:
+  struct State {
+    // Forward states: the pcs of the blocked threads ordered by priority.
+    // Reverse states: the sorted items from which the match can be completed,
+    // see `Item`.
+    base::Vector<const int> items;
+    bool is_match;
+    // The successor state for each character class, or nullptr if it was not
+    // computed yet.
+    State** next;
+  };
+
+  // Returns whether `bytecode` can be executed by a `LazyDfa`.
+  static bool CanBeUsed(base::Vector<const RegExpInstruction> bytecode) {
+    bool has_match_begin = false;
+    // Lookaround automata are emitted after the main expression, but the
+    // main expression reads their results with READ_LOOKAROUND_TABLE, so it
+    // suffices to look at the instructions up to the first ACCEPT.
+    for (const RegExpInstruction& inst : bytecode) {
+      switch (inst.opcode) {
+        case RegExpInstruction::ASSERTION:
+        case RegExpInstruction::START_LOOKAROUND:
+        case RegExpInstruction::END_LOOKAROUND:
+        case RegExpInstruction::WRITE_LOOKAROUND_TABLE:
+        case RegExpInstruction::READ_LOOKAROUND_TABLE:
+          return false;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+          if (inst.payload.register_index == 0) has_match_begin = true;
+          break;
+        case RegExpInstruction::ACCEPT:
+          return has_match_begin;
+        default:
+          break;
+      }
+    }
+    return false;
+  }
+
+  LazyDfa(base::Vector<const RegExpInstruction> bytecode, Zone* zone)
+      : zone_(zone),
+        eps_preds_(zone),
+        consume_preds_(zone),
+        class_starts_(zone),
+        forward_states_(zone),
+        reverse_states_(zone),
+        visited_(zone),
+        listed_(zone),
+        stack_(zone),
+        scratch_(zone) {
+    DCHECK(CanBeUsed(bytecode));
+    int accept_pc = 0;
+    while (bytecode[accept_pc].opcode != RegExpInstruction::ACCEPT) {
+      const RegExpInstruction& inst = bytecode[accept_pc];
+      if (start_pc_ == -1 &&
+          inst.opcode == RegExpInstruction::SET_REGISTER_TO_CP &&
+          inst.payload.register_index == 0) {
+        start_pc_ = accept_pc;
+      }
+      ++accept_pc;
+    }
+    accept_pc_ = accept_pc;
+    code_ = zone->CloneVector(bytecode.SubVector(0, accept_pc_ + 1));
+
+    // Characters that no range distinguishes share a character class, so
+    // that states need one transition per class instead of per character.
+    class_starts_.push_back(0);
+    for (const RegExpInstruction& inst : code_) {
+      if (inst.opcode != RegExpInstruction::CONSUME_RANGE) continue;
+      class_starts_.push_back(inst.payload.consume_range.min);
+      if (inst.payload.consume_range.max < 0xFFFF) {
+        class_starts_.push_back(inst.payload.consume_range.max + 1);
+      }
+    }
+    std::sort(class_starts_.begin(), class_starts_.end());
+    class_starts_.erase(
+        std::unique(class_starts_.begin(), class_starts_.end()),
+        class_starts_.end());
+    for (int c = 0; c < kLatin1ClassCacheSize; ++c) {
+      latin1_classes_[c] = static_cast<uint16_t>(ClassOfSlow(c));
+    }
+
+    // Edges of the pattern body for the reverse automaton.
+    eps_preds_.resize(accept_pc_ + 1, ZoneVector<int>(zone));
+    consume_preds_.resize(accept_pc_ + 1, ZoneVector<int>(zone));
+    for (int pc = start_pc_; pc < accept_pc_; pc = NextPc(pc)) {
+      const RegExpInstruction& inst = code_[pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+        case RegExpInstruction::RANGE_COUNT:
+          SBXCHECK_LE(NextPc(pc), accept_pc_);
+          consume_preds_[NextPc(pc)].push_back(pc);
+          break;
+        case RegExpInstruction::FORK:
+          SBXCHECK_BOUNDS(inst.payload.pc, code_.length());
+          eps_preds_[pc + 1].push_back(pc);
+          eps_preds_[inst.payload.pc].push_back(pc);
+          break;
+        case RegExpInstruction::JMP:
+          SBXCHECK_BOUNDS(inst.payload.pc, code_.length());
+          eps_preds_[inst.payload.pc].push_back(pc);
+          break;
+        default:
+          eps_preds_[pc + 1].push_back(pc);
+          break;
+      }
+    }
+
+    visited_.resize(2 * code_.length(), 0);
+    listed_.resize(code_.length(), 0);
+  }
+
+  bool has_given_up() const { return has_given_up_; }
+
+  // The state before the first character of a forward search, or nullptr if
+  // the DFA gave up.
+  State* ForwardStart() {
+    if (forward_start_ == nullptr) {
+      BeginStep();
+      bool accepted = RunForward(0);
+      forward_start_ = Intern(&forward_states_, accepted);
+    }
+    return forward_start_;
+  }
+
+  // The state at the end of a match for a reverse search, or nullptr if the
+  // DFA gave up.
+  State* ReverseStart() {
+    if (reverse_start_ == nullptr) {
+      BeginStep();
+      AddReverse(accept_pc_, false);
+      reverse_start_ = Intern(&reverse_states_, RunReverse());
+    }
+    return reverse_start_;
+  }
+
+  // The successor of a forward state, or nullptr if the DFA gave up.
+  State* NextForward(State* state, base::uc16 c) {
+    int char_class = ClassOf(c);
+    State* next = state->next[char_class];
+    if (V8_LIKELY(next != nullptr)) return next;
+
+    BeginStep();
+    base::uc16 representative = class_starts_[char_class];
+    bool accepted = false;
+    for (int pc : state->items) {
+      if (Consumes(pc, representative) && RunForward(NextPc(pc))) {
+        // Threads with lower priority are cut off by the ACCEPT.
+        accepted = true;
+        break;
+      }
+    }
+    next = Intern(&forward_states_, accepted);
+    if (next != nullptr) state->next[char_class] = next;
+    return next;
+  }
+
+  // The successor of a reverse state for the character before the current
+  // position, or nullptr if the DFA gave up.
+  State* NextReverse(State* state, base::uc16 c) {
+    int char_class = ClassOf(c);
+    State* next = state->next[char_class];
+    if (V8_LIKELY(next != nullptr)) return next;
+
+    BeginStep();
+    base::uc16 representative = class_starts_[char_class];
+    for (int item : state->items) {
+      for (int pc : consume_preds_[ItemPc(item)]) {
+        if (Consumes(pc, representative)) AddReverse(pc, false);
+      }
+    }
+    next = Intern(&reverse_states_, RunReverse());
+    if (next != nullptr) state->next[char_class] = next;
+    return next;
+  }
+
+ private:
+  using StateMap = ZoneUnorderedMap<base::Vector<const int>, State*,
+                                    base::hash<base::Vector<const int>>>;
+
+  static constexpr int kLatin1ClassCacheSize = 256;
+  // Appended to the key of accepting states.
+  static constexpr int kAcceptMarker = -1;
+
+  // Threads and items of reverse states are encoded as a pc and a flag.  For
+  // threads, the flag tells whether the thread consumed a character since
+  // the last BEGIN_LOOP.  For reverse items, it tells whether a thread at the
+  // pc must have consumed a character since the last BEGIN_LOOP to complete
+  // the match, because it runs into END_LOOP before consuming.
+  static int Item(int pc, bool flag) { return 2 * pc + (flag ? 1 : 0); }
+  static int ItemPc(int item) { return item / 2; }
+  static bool ItemFlag(int item) { return item % 2 == 1; }
+
+  int ClassOf(base::uc16 c) const {
+    if (c < kLatin1ClassCacheSize) return latin1_classes_[c];
+    return ClassOfSlow(c);
+  }
+
+  int ClassOfSlow(int c) const {
+    auto it = std::upper_bound(class_starts_.begin(), class_starts_.end(), c);
+    return static_cast<int>(it - class_starts_.begin()) - 1;
+  }
+
+  // Pc of the instruction after the consuming instruction(s) at `pc`.
+  int NextPc(int pc) const {
+    if (code_[pc].opcode == RegExpInstruction::RANGE_COUNT) {
+      return pc + 1 + code_[pc].payload.num_ranges;
+    }
+    return pc + 1;
+  }
+
+  bool Consumes(int pc, base::uc16 c) const {
+    int begin = pc;
+    int end = pc + 1;
+    if (code_[pc].opcode == RegExpInstruction::RANGE_COUNT) {
+      begin = pc + 1;
+      end = NextPc(pc);
+    }
+    for (int i = begin; i < end; ++i) {
+      DCHECK_EQ(code_[i].opcode, RegExpInstruction::CONSUME_RANGE);
+      RegExpInstruction::Uc16Range range = code_[i].payload.consume_range;
+      if (range.min <= c && c <= range.max) return true;
+    }
+    return false;
+  }
+
+  void BeginStep() {
+    ++generation_;
+    scratch_.clear();
+    stack_.clear();
+  }
+
+  // Runs a thread that starts at `pc` having consumed a character and all of
+  // its forks, in the same order as `NfaInterpreter::RunActiveThread`.  Pcs
+  // at which threads block are appended to `scratch_`.  Returns true if a
+  // thread executes ACCEPT.
+  bool RunForward(int pc) {
+    stack_.push_back(Item(pc, true));
+    while (!stack_.empty()) {
+      int thread = stack_.back();
+      stack_.pop_back();
+      pc = ItemPc(thread);
+      bool consumed = ItemFlag(thread);
+      bool alive = true;
+      while (alive) {
+        SBXCHECK_BOUNDS(pc, code_.length());
+        int key = Item(pc, consumed);
+        if (visited_[key] == generation_) break;
+        visited_[key] = generation_;
+
+        const RegExpInstruction& inst = code_[pc];
+        switch (inst.opcode) {
+          case RegExpInstruction::CONSUME_RANGE:
+          case RegExpInstruction::RANGE_COUNT:
+            if (listed_[pc] != generation_) {
+              listed_[pc] = generation_;
+              scratch_.push_back(pc);
+            }
+            alive = false;
+            break;
+          case RegExpInstruction::FORK:
+            stack_.push_back(Item(inst.payload.pc, consumed));
+            ++pc;
+            break;
+          case RegExpInstruction::JMP:
+            pc = inst.payload.pc;
+            break;
+          case RegExpInstruction::ACCEPT:
+            return true;
+          case RegExpInstruction::BEGIN_LOOP:
+            consumed = false;
+            ++pc;
+            break;
+          case RegExpInstruction::END_LOOP:
+            alive = consumed;
+            ++pc;
+            break;
+          default:
+            ++pc;
+            break;
+        }
+      }
+    }
+    return false;
+  }
+
+  void AddReverse(int pc, bool needs_consumed) {
+    int item = Item(pc, needs_consumed);
+    if (visited_[item] == generation_) return;
+    visited_[item] = generation_;
+    stack_.push_back(item);
+  }
+
+  // Closes the items added with `AddReverse` over epsilon transitions and
+  // collects them in `scratch_`.  Returns true if the start of the pattern
+  // body was reached.
+  bool RunReverse() {
+    bool reached_start = false;
+    while (!stack_.empty()) {
+      int item = stack_.back();
+      stack_.pop_back();
+      scratch_.push_back(item);
+      int pc = ItemPc(item);
+      bool needs_consumed = ItemFlag(item);
+      if (pc == start_pc_) reached_start = true;
+      for (int pred : eps_preds_[pc]) {
+        switch (code_[pred].opcode) {
+          case RegExpInstruction::BEGIN_LOOP:
+            // No character can be consumed between BEGIN_LOOP and `pc`.
+            if (!needs_consumed) AddReverse(pred, false);
+            break;
+          case RegExpInstruction::END_LOOP:
+            AddReverse(pred, true);
+            break;
+          default:
+            AddReverse(pred, needs_consumed);
+            break;
+        }
+      }
+    }
+    std::sort(scratch_.begin(), scratch_.end());
+    return reached_start;
+  }
+
+  // Returns the cached state for the items in `scratch_`, creating it if
+  // necessary.  Returns nullptr and gives up if the cache is full.
+  State* Intern(StateMap* states, bool is_match) {
+    size_t item_count = scratch_.size();
+    if (is_match) scratch_.push_back(kAcceptMarker);
+    base::Vector<const int> key(scratch_.data(), scratch_.size());
+    auto it = states->find(key);
+    if (it != states->end()) return it->second;
+
+    size_t state_size = sizeof(State) + key.size() * sizeof(int) +
+                        class_starts_.size() * sizeof(State*) +
+                        sizeof(StateMap::value_type);
+    if (cache_size_ + state_size >
+        v8_flags.experimental_regexp_engine_lazy_dfa_cache_size) {
+      has_given_up_ = true;
+      return nullptr;
+    }
+    cache_size_ += state_size;
+
+    base::Vector<const int> stored_key = zone_->CloneVector(key);
+    State* state = zone_->New<State>();
+    state->items = stored_key.SubVector(0, item_count);
+    state->is_match = is_match;
+    state->next = zone_->AllocateArray<State*>(class_starts_.size());
+    std::fill_n(state->next, class_starts_.size(), nullptr);
+    states->insert({stored_key, state});
+    return state;
+  }
+
+  Zone* const zone_;
+  base::Vector<const RegExpInstruction> code_;
+  // The SET_REGISTER_TO_CP instruction for the start of the match, i.e. the
+  // first instruction after the /.*?/ preamble.
+  int start_pc_ = -1;
+  int accept_pc_;
+
+  // For each pc of the pattern body, the pcs of the body that reach it
+  // without and with consuming a character, respectively.
+  ZoneVector<ZoneVector<int>> eps_preds_;
+  ZoneVector<ZoneVector<int>> consume_preds_;
+
+  // The smallest character of each character class, in increasing order.
+  ZoneVector<int> class_starts_;
+  uint16_t latin1_classes_[kLatin1ClassCacheSize];
+
+  StateMap forward_states_;
+  StateMap reverse_states_;
+  State* forward_start_ = nullptr;
+  State* reverse_start_ = nullptr;
+  size_t cache_size_ = 0;
+  bool has_given_up_ = false;
+
+  // Scratch space for computing a successor state. `visited_` and `listed_`
+  // hold the generation in which an item was last seen.
+  uint32_t generation_ = 0;
+  ZoneVector<uint32_t> visited_;
+  ZoneVector<uint32_t> listed_;
+  ZoneVector<int> stack_;
+  ZoneVector<int> scratch_;
+};
+
 template <class Character>
 class NfaInterpreter {
   // Executes a bytecode program in breadth-first mode, without backtracking.
@@ -346,6 +755,7 @@ class NfaInterpreter {
         input_object_(input),
         input_(ToCharacterVector<Character>(input, no_gc_)),
         input_index_(input_index),
+        search_end_(input_.length()),
         clock(0),
         pc_last_input_index_(
             zone->AllocateArray<LastInputIndex>(bytecode->length()),
@@ -365,6 +775,7 @@ class NfaInterpreter {
         reverse_(false),
         current_lookaround_(-1),
         filter_groups_pc_(std::nullopt),
+        lazy_dfa_(std::nullopt),
         zone_(zone) {
     DCHECK(!bytecode_.empty());
     DCHECK_GE(input_index_, 0);
@@ -466,6 +877,11 @@ class NfaInterpreter {
 
     std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(),
               LastInputIndex());
+
+    if (v8_flags.experimental_regexp_engine_lazy_dfa &&
+        LazyDfa::CanBeUsed(bytecode_)) {
+      lazy_dfa_.emplace(bytecode_, zone_);
+    }
   }
 
   // Finds matches and writes their concatenated capture registers to
@@ -696,7 +1112,7 @@ class NfaInterpreter {
     //   threads are blocked here, so the latter simply means that
     //   `blocked_threads_` is empty.
     while ((reverse_ ? ((0 < input_index_ && input_index_ <= input_.length()))
-                     : (0 <= input_index_ && input_index_ < input_.length())) &&
+                     : (0 <= input_index_ && input_index_ < search_end_)) &&
            !(FoundMatch() && blocked_threads_.is_empty())) {
       DCHECK(active_threads_.is_empty());
 
@@ -840,6 +1256,30 @@ class NfaInterpreter {
       best_match_thread_ = std::nullopt;
     }
 
+    search_end_ = input_.length();
+    if (lazy_dfa_.has_value() && !lazy_dfa_->has_given_up()) {
+      int match_begin;
+      int match_end;
+      int err_code = FindNextMatchWithDfa(&match_begin, &match_end);
+      if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+
+      if (!lazy_dfa_->has_given_up()) {
+        if (match_end == kUndefinedMatchIndexValue) {
+          return RegExp::kInternalRegExpSuccess;
+        }
+        if (register_count_per_match_ == 2) {
+          best_match_thread_ = NewEmptyThread(0);
+          GetRegisterArray(*best_match_thread_)[0] = match_begin;
+          GetRegisterArray(*best_match_thread_)[1] = match_end;
+          return RegExp::kInternalRegExpSuccess;
+        }
+        // The captures are computed by the NFA, which only has to look at
+        // the match itself.
+        SetInputIndex(match_begin);
+        search_end_ = match_end;
+      }
+    }
+
     active_threads_.Add(NewEmptyThread(0), zone_);
 
     if (only_captureless_lookbehinds_) {
@@ -856,6 +1296,53 @@ class NfaInterpreter {
     return RegExp::kInternalRegExpSuccess;
   }
 
+  // Searches for the next match starting at `input_index_` with `lazy_dfa_`
+  // and sets `match_begin` and `match_end` to its boundaries, or
+  // `match_end` to kUndefinedMatchIndexValue if there is none.  The
+  // boundaries are meaningless if the DFA gave up.  Returns
+  // RegExp::kInternalRegExpSuccess unless interrupted.
+  int FindNextMatchWithDfa(int* match_begin, int* match_end) {
+    static constexpr int kTicksBetweenInterruptHandling = 64;
+    *match_end = kUndefinedMatchIndexValue;
+
+    LazyDfa::State* state = lazy_dfa_->ForwardStart();
+    if (state == nullptr) return RegExp::kInternalRegExpSuccess;
+    int position = input_index_;
+    if (state->is_match) *match_end = position;
+    // As in `RunActiveThreadsToEnd`, stop once no threads are left.
+    while (position < input_.length() && !state->items.empty()) {
+      state = lazy_dfa_->NextForward(state, input_[position]);
+      ++position;
+      if (state == nullptr) return RegExp::kInternalRegExpSuccess;
+      if (state->is_match) *match_end = position;
+      if (position % kTicksBetweenInterruptHandling == 0) {
+        int err_code = HandleInterrupts();
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      }
+    }
+    if (*match_end == kUndefinedMatchIndexValue) {
+      return RegExp::kInternalRegExpSuccess;
+    }
+
+    state = lazy_dfa_->ReverseStart();
+    if (state == nullptr) return RegExp::kInternalRegExpSuccess;
+    position = *match_end;
+    *match_begin = kUndefinedMatchIndexValue;
+    while (true) {
+      if (state->is_match) *match_begin = position;
+      if (position == input_index_ || state->items.empty()) break;
+      --position;
+      state = lazy_dfa_->NextReverse(state, input_[position]);
+      if (state == nullptr) return RegExp::kInternalRegExpSuccess;
+      if (position % kTicksBetweenInterruptHandling == 0) {
+        int err_code = HandleInterrupts();
+        if (err_code != RegExp::kInternalRegExpSuccess) return err_code;
+      }
+    }
+    DCHECK_NE(*match_begin, kUndefinedMatchIndexValue);
+    return RegExp::kInternalRegExpSuccess;
+  }
+
   // Run an active thread `t` until it executes a CONSUME_RANGE or ACCEPT
   // or RANGE_COUNT instruction, or its PC value was already processed.
   // - If processing of `t` can't continue because of CONSUME_RANGE or
@@ -1449,6 +1936,9 @@ class NfaInterpreter {
   Tagged<String> input_object_;
   base::Vector<const Character> input_;
   int input_index_;
+  // Forward searches stop at this index.  Usually the end of `input_`, but
+  // the end of the match if `lazy_dfa_` found it already.
+  int search_end_;
 
   // Global clock counting the total of executed instructions.
   uint64_t clock;
@@ -1540,6 +2030,10 @@ class NfaInterpreter {
   // quantifiers).
   std::optional<int> filter_groups_pc_;
 
+  // Used to find match boundaries without NFA simulation if the bytecode has
+  // no assertions or lookarounds.
+  std::optional<LazyDfa> lazy_dfa_;
+
   uint64_t memory_consumption_per_thread_;
 
   Zone* zone_;
@@ -3107,6 +3107,23 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
     return;
   }
 
+  if (use_simd && max_lookahead > min_lookahead) {
+    // The SIMD skip loop checks a vector of positions at once, but only for
+    // the characters of a single offset. If one offset of the interval allows
+    // only a few characters, e.g. the first characters of /foo|bar|baz/, it is
+    // a better filter than skipping a few positions at a time with the union
+    // of the whole interval.
+    constexpr int kMaxSimdSkipCharacters = 4;
+    int best_offset = min_lookahead;
+    for (int i = min_lookahead + 1; i <= max_lookahead; i++) {
+      if (Count(i) < Count(best_offset)) best_offset = i;
+    }
+    if (Count(best_offset) <= kMaxSimdSkipCharacters) {
+      min_lookahead = best_offset;
+      max_lookahead = best_offset;
+    }
+  }
+
   Factory* factory = masm->isolate()->factory();
   Handle<ByteArray> boolean_skip_table =
       factory->NewByteArray(kSize, AllocationType::kOld);
@@ -2,6 +2,10 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <functional>
+#include <vector>
+
 #include "src/execution/arguments-inl.h"
 #include "src/execution/isolate-inl.h"
 #include "src/execution/protectors-inl.h"
@@ -10,6 +14,7 @@
 #include "src/objects/allocation-site-inl.h"
 #include "src/objects/elements.h"
 #include "src/objects/js-array-inl.h"
+#include "src/objects/js-function-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -198,6 +203,103 @@ RUNTIME_FUNCTION(Runtime_GrowArrayElements) {
   return object->elements();
 }
 
+namespace {
+
+// Sorts the first {length} elements of a packed Smi backing store with
+// {less}. Equal Smis are indistinguishable, so stability doesn't matter.
+template <typename LessThan>
+void SortPackedSmis(Tagged<FixedArray> elements, uint32_t length,
+                    LessThan less) {
+  std::vector<int> values(length);
+  for (uint32_t i = 0; i < length; i++) {
+    values[i] = Smi::ToInt(elements->get(i));
+  }
+  std::sort(values.begin(), values.end(), less);
+  for (uint32_t i = 0; i < length; i++) {
+    elements->set(i, Smi::FromInt(values[i]), SKIP_WRITE_BARRIER);
+  }
+}
+
+// Sorts the first {length} elements of a packed double backing store with
+// {less}, or returns false without touching them if they contain NaN. The
+// numeric comparators treat NaN as equal to everything, which is not a strict
+// weak ordering.
+template <typename LessThan>
+bool SortPackedDoubles(Tagged<FixedDoubleArray> elements, uint32_t length,
+                       LessThan less) {
+  std::vector<double> values(length);
+  for (uint32_t i = 0; i < length; i++) {
+    values[i] = elements->get_scalar(i);
+    if (std::isnan(values[i])) return false;
+  }
+  // -0 and +0 compare equal but are distinguishable, so keep them stable.
+  std::stable_sort(values.begin(), values.end(), less);
+  for (uint32_t i = 0; i < length; i++) elements->set(i, values[i]);
+  return true;
+}
+
+}  // namespace
+
+// Sorts packed Smi and double arrays natively when Array.prototype.sort is
+// called without a comparator (Smis only, as the default order compares
+// strings) or with a trivial numeric one. Returns false if the array has to
+// go through the generic TimSort instead.
+RUNTIME_FUNCTION(Runtime_ArraySortNumericFast) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  DirectHandle<JSArray> array = args.at<JSArray>(0);
+  DirectHandle<Object> comparefn = args.at(1);
+
+  ElementsKind kind = array->GetElementsKind();
+  if (kind != PACKED_SMI_ELEMENTS && kind != PACKED_DOUBLE_ELEMENTS) {
+    return ReadOnlyRoots(isolate).false_value();
+  }
+  JSFunction::NumericComparator comparator =
+      JSFunction::NumericComparator::kNone;
+  if (IsJSFunction(*comparefn)) {
+    comparator = JSFunction::ClassifyNumericComparator(
+        isolate, Cast<JSFunction>(comparefn));
+    if (comparator == JSFunction::NumericComparator::kNone) {
+      return ReadOnlyRoots(isolate).false_value();
+    }
+  } else if (!IsUndefined(*comparefn, isolate) || kind != PACKED_SMI_ELEMENTS) {
+    return ReadOnlyRoots(isolate).false_value();
+  }
+
+  DisallowGarbageCollection no_gc;
+  uint32_t length = static_cast<uint32_t>(Smi::ToInt(array->length()));
+  Tagged<FixedArrayBase> elements = array->elements();
+  DCHECK_LE(length, static_cast<uint32_t>(elements->length()));
+  DCHECK_NE(elements->map(), ReadOnlyRoots(isolate).fixed_cow_array_map());
+  bool sorted = true;
+  if (kind == PACKED_SMI_ELEMENTS) {
+    Tagged<FixedArray> smis = Cast<FixedArray>(elements);
+    switch (comparator) {
+      case JSFunction::NumericComparator::kNone:
+        SortPackedSmis(smis, length, [=](int x, int y) {
+          return Smi::ToInt(Tagged<Smi>(Smi::LexicographicCompare(
+                     isolate, Smi::FromInt(x), Smi::FromInt(y)))) < 0;
+        });
+        break;
+      case JSFunction::NumericComparator::kAscending:
+        SortPackedSmis(smis, length, std::less<int>());
+        break;
+      case JSFunction::NumericComparator::kDescending:
+        SortPackedSmis(smis, length, std::greater<int>());
+        break;
+    }
+  } else {
+    Tagged<FixedDoubleArray> doubles = Cast<FixedDoubleArray>(elements);
+    if (comparator == JSFunction::NumericComparator::kAscending) {
+      sorted = SortPackedDoubles(doubles, length, std::less<double>());
+    } else {
+      DCHECK_EQ(comparator, JSFunction::NumericComparator::kDescending);
+      sorted = SortPackedDoubles(doubles, length, std::greater<double>());
+    }
+  }
+  return isolate->heap()->ToBoolean(sorted);
+}
+
 // ES6 22.1.2.2 Array.isArray
 RUNTIME_FUNCTION(Runtime_ArrayIsArray) {
   HandleScope shs(isolate);
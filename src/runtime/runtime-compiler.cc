@@ -542,6 +542,15 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   DCHECK_EQ(deopt_kind, DeoptimizeKind::kEager);
   DCHECK(!IsDeoptimizationWithoutCodeInvalidation(deopt_reason));
 
+  // The top frame is the innermost (possibly inlined) function that deopted,
+  // resumed at the deopting bytecode.
+  if (top_frame->is_unoptimized()) {
+    UnoptimizedJSFrame* frame = UnoptimizedJSFrame::cast(top_frame);
+    isolate->tiering_manager()->OnEagerDeopt(
+        direct_handle(frame->function(), isolate), frame->GetBytecodeOffset(),
+        deopt_reason);
+  }
+
   // Non-OSR'd code is deoptimized unconditionally. If the deoptimization occurs
   // inside the outermost loop containing a loop that can trigger OSR
   // compilation, we remove the OSR code, it will avoid hit the out of date OSR
@@ -8,6 +8,7 @@
 #include "src/execution/arguments-inl.h"
 #include "src/execution/isolate-inl.h"
 #include "src/handles/maybe-handles.h"
+#include "src/heap/pretenuring-handler.h"
 #include "src/objects/allocation-site-scopes-inl.h"
 #include "src/objects/casting.h"
 #include "src/objects/hash-table-inl.h"
@@ -554,6 +555,8 @@ MaybeDirectHandle<JSObject> CreateLiteral(Isolate* isolate,
     site = creation_context.EnterNewScope();
     RETURN_ON_EXCEPTION(isolate, DeepWalk(boilerplate, &creation_context));
     creation_context.ExitScope(site, boilerplate);
+    isolate->heap()->pretenuring_handler()->SeedAllocationSite(
+        *vector, literals_slot, *site);
 
     vector->SynchronizedSet(literals_slot, *site);
   }
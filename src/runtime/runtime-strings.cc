@@ -135,6 +135,28 @@ RUNTIME_FUNCTION(Runtime_StringReplaceOneCharWithString) {
   return isolate->StackOverflow();
 }
 
+RUNTIME_FUNCTION(Runtime_StringIndexOf) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(3, args.length());
+  DirectHandle<String> receiver = args.at<String>(0);
+  DirectHandle<String> search = args.at<String>(1);
+  int start = args.smi_value_at(2);
+  DCHECK_LE(0, start);
+  DCHECK_LE(start, receiver->length());
+  return Smi::FromInt(String::IndexOf(isolate, receiver, search, start));
+}
+
+RUNTIME_FUNCTION(Runtime_StringIsSubstringAt) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(3, args.length());
+  DirectHandle<String> string = args.at<String>(0);
+  DirectHandle<String> search = args.at<String>(1);
+  int start = args.smi_value_at(2);
+  DCHECK_LE(0, start);
+  return isolate->heap()->ToBoolean(
+      String::IsSubstringAt(isolate, string, search, start));
+}
+
 RUNTIME_FUNCTION(Runtime_StringLastIndexOf) {
   HandleScope handle_scope(isolate);
   return String::LastIndexOf(isolate, args.at(0), args.at(1),
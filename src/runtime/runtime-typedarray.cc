@@ -8,6 +8,7 @@
 #include "src/heap/factory.h"
 #include "src/objects/elements.h"
 #include "src/objects/js-array-buffer-inl.h"
+#include "src/objects/js-function-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/runtime/runtime-utils.h"
 #include "src/runtime/runtime.h"
@@ -101,14 +102,11 @@ bool LessThanFloat16RawBits(uint16_t x, uint16_t y) {
   return CompareNum(fp16_ieee_to_fp32_value(x), fp16_ieee_to_fp32_value(y));
 }
 
-}  // namespace
-
-RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
-  HandleScope scope(isolate);
-  DCHECK_EQ(1, args.length());
-
-  // Validation is handled in the Torque builtin.
-  DirectHandle<JSTypedArray> array = args.at<JSTypedArray>(0);
+// Sorts {array} in ascending numeric order, or in descending order for
+// integer element types if {descending} is set.
+Tagged<Object> SortTypedArray(Isolate* isolate,
+                              DirectHandle<JSTypedArray> array,
+                              bool descending) {
   DCHECK(!array->WasDetached());
   DCHECK(!array->IsOutOfBounds());
 
@@ -181,8 +179,10 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
         /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */       \
         std::sort(UnalignedSlot<ctype>(data),                                \
                   UnalignedSlot<ctype>(data + length));                      \
+        DCHECK(!descending);                                                 \
       } else {                                                               \
         std::sort(data, data + length);                                      \
+        if (descending) std::reverse(data, data + length);                   \
       }                                                                      \
     }                                                                        \
     break;                                                                   \
@@ -202,6 +202,55 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
   return *array;
 }
 
+}  // namespace
+
+RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+
+  // Validation is handled in the Torque builtin.
+  DirectHandle<JSTypedArray> array = args.at<JSTypedArray>(0);
+  return SortTypedArray(isolate, array, false);
+}
+
+// Sorts integer typed arrays natively when the comparator is a trivial
+// numeric one; for them, equal elements are indistinguishable and the result
+// matches calling the comparator. Returns undefined if the generic merge sort
+// has to call the comparator instead.
+RUNTIME_FUNCTION(Runtime_TypedArraySortNumericFast) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+
+  // Validation is handled in the Torque builtin.
+  DirectHandle<JSTypedArray> array = args.at<JSTypedArray>(0);
+  DirectHandle<Object> comparefn = args.at(1);
+  switch (array->type()) {
+    case kExternalInt8Array:
+    case kExternalUint8Array:
+    case kExternalUint8ClampedArray:
+    case kExternalInt16Array:
+    case kExternalUint16Array:
+    case kExternalInt32Array:
+    case kExternalUint32Array:
+      break;
+    default:
+      // BigInts throw when the comparator result is converted to a Number,
+      // and floats differ from the default order for -0 and NaN.
+      return ReadOnlyRoots(isolate).undefined_value();
+  }
+  if (!IsJSFunction(*comparefn)) return ReadOnlyRoots(isolate).undefined_value();
+  switch (JSFunction::ClassifyNumericComparator(isolate,
+                                                Cast<JSFunction>(comparefn))) {
+    case JSFunction::NumericComparator::kNone:
+      return ReadOnlyRoots(isolate).undefined_value();
+    case JSFunction::NumericComparator::kAscending:
+      return SortTypedArray(isolate, array, false);
+    case JSFunction::NumericComparator::kDescending:
+      return SortTypedArray(isolate, array, true);
+  }
+  UNREACHABLE();
+}
+
 RUNTIME_FUNCTION(Runtime_TypedArraySet) {
   HandleScope scope(isolate);
   DCHECK_EQ(4, args.length());
@@ -50,6 +50,7 @@ constexpr bool CanTriggerGC(T... properties) {
   F(ArrayIncludes_Slow, 3, 1)          \
   F(ArrayIndexOf, 3, 1)                \
   F(ArrayIsArray, 1, 1)                \
+  F(ArraySortNumericFast, 2, 1)        \
   F(ArraySpeciesConstructor, 1, 1)     \
   F(GrowArrayElements, 2, 1)           \
   F(IsArray, 1, 1)                     \
@@ -513,6 +514,8 @@ constexpr bool CanTriggerGC(T... properties) {
   F(StringEscapeQuotes, 1, 1)                        \
   F(StringGreaterThan, 2, 1)                         \
   F(StringGreaterThanOrEqual, 2, 1)                  \
+  F(StringIndexOf, 3, 1)                             \
+  F(StringIsSubstringAt, 3, 1)                       \
   F(StringIsWellFormed, 1, 1)                        \
   F(StringLastIndexOf, 2, 1)                         \
   F(StringLessThan, 2, 1)                            \
@@ -688,7 +691,8 @@ constexpr bool CanTriggerGC(T... properties) {
   F(TypedArrayCopyElements, 3, 1)              \
   F(TypedArrayGetBuffer, 1, 1)                 \
   F(TypedArraySet, 2, 1)                       \
-  F(TypedArraySortFast, 1, 1)
+  F(TypedArraySortFast, 1, 1)                  \
+  F(TypedArraySortNumericFast, 2, 1)
 
 #if V8_ENABLE_DRUMBRAKE
 #define FOR_EACH_INTRINSIC_WASM_DRUMBRAKE(F, I) F(WasmRunInterpreter, 3, 1)
@@ -44,6 +44,21 @@ uint32_t CompactibleExternalEntityTable<Entry, size>::AllocateEntry(
   return index;
 }
 
+template <typename Entry, size_t size>
+void CompactibleExternalEntityTable<Entry, size>::AllocateEntries(
+    Space* space, uint32_t* indices, size_t count) {
+  Base::AllocateEntries(space, indices, count);
+
+  // See AllocateEntry(). Checking the largest index is enough.
+  uint32_t start_of_evacuation_area =
+      space->start_of_evacuation_area_.load(std::memory_order_relaxed);
+  if (V8_UNLIKELY(count > 0 &&
+                  *std::max_element(indices, indices + count) >=
+                      start_of_evacuation_area)) {
+    space->AbortCompacting(start_of_evacuation_area);
+  }
+}
+
 template <typename Entry, size_t size>
 typename CompactibleExternalEntityTable<Entry, size>::CompactionResult
 CompactibleExternalEntityTable<Entry, size>::FinishCompaction(
@@ -63,6 +78,7 @@ CompactibleExternalEntityTable<Entry, size>::FinishCompaction(
       // short. In this case, it is not guaranteed that any segments will now be
       // completely free.  Extract the original start_of_evacuation_area value.
       start_of_evacuation_area &= ~Space::kCompactionAbortedMarker;
+      space->compaction_statistics_.aborted++;
     } else {
       // Entry evacuation was successful so all segments inside the evacuation
       // area are now guaranteed to be free and so can be deallocated.
@@ -193,14 +209,19 @@ void CompactibleExternalEntityTable<Entry,
   uint32_t num_total_entries = this->capacity();
 
   // Current (somewhat arbitrary) heuristic: need compacting if the space is
-  // more than 1MB in size, is at least 10% empty, and if at least one segment
-  // can be freed after successful compaction.
+  // large enough (1MB by default), has enough free entries (10% by default),
+  // and if at least one segment can be freed after successful compaction.
   double free_ratio = static_cast<double>(num_free_entries) /
                       static_cast<double>(num_total_entries);
   uint32_t num_segments_to_evacuate =
       (num_free_entries / 2) / Base::kEntriesPerSegment;
-  uint32_t space_size = num_total_entries * Base::kEntrySize;
-  bool should_compact = (space_size >= 1 * MB) && (free_ratio >= 0.10) &&
+  size_t space_size = size_t{num_total_entries} * Base::kEntrySize;
+  size_t min_space_size =
+      static_cast<size_t>(v8_flags.pointer_table_compaction_min_size_kb) * KB;
+  double min_free_ratio =
+      v8_flags.pointer_table_compaction_min_free_percent / 100.0;
+  bool should_compact = (space_size >= min_space_size) &&
+                        (free_ratio >= min_free_ratio) &&
                         (num_segments_to_evacuate >= 1);
 
   // However, if --stress-compaction is enabled, we compact whenever possible:
@@ -218,6 +239,9 @@ void CompactibleExternalEntityTable<Entry,
         *std::prev(this->segments_.end(), num_segments_to_evacuate);
     uint32_t start_of_evacuation_area = first_segment_to_evacuate.first_entry();
     StartCompacting(start_of_evacuation_area);
+    compaction_statistics_.started++;
+    compaction_statistics_.segments_selected_for_evacuation +=
+        num_segments_to_evacuate;
   }
 }
 
@@ -93,6 +93,17 @@ class V8_EXPORT_PRIVATE CompactibleExternalEntityTable
     bool success;
   };
 
+  // Cumulative compaction statistics of a space, to help tuning the
+  // compaction heuristics (see --pointer-table-compaction-min-*).
+  struct CompactionStatistics {
+    // Number of GCs that started compacting the space.
+    size_t started = 0;
+    // Number of those compactions that had to be aborted during marking.
+    size_t aborted = 0;
+    // Number of segments that were selected for evacuation in total.
+    size_t segments_selected_for_evacuation = 0;
+  };
+
   CompactibleExternalEntityTable() = default;
   CompactibleExternalEntityTable(const CompactibleExternalEntityTable&) =
       delete;
@@ -109,6 +120,11 @@ class V8_EXPORT_PRIVATE CompactibleExternalEntityTable
     // This is expected to be called at the start of the GC marking phase.
     void StartCompactingIfNeeded();
 
+    // Not atomic. Must only be called on the main thread outside of a GC.
+    const CompactionStatistics& compaction_statistics() const {
+      return compaction_statistics_;
+    }
+
    private:
     friend class CompactibleExternalEntityTable<Entry, size>;
     friend class ExternalPointerTable;
@@ -161,12 +177,17 @@ class V8_EXPORT_PRIVATE CompactibleExternalEntityTable
 
     // Mutex guarding access to the invalidated_fields_ set.
     base::Mutex invalidated_fields_mutex_;
+
+    // Only updated at the start and the end of a GC.
+    CompactionStatistics compaction_statistics_;
   };
 
   // Allocate an EPT entry from the space's freelist, or add a freshly-allocated
   // segment to the space and allocate there.  If the space is compacting but
   // the new index is above the evacuation threshold, abort compaction.
   inline uint32_t AllocateEntry(Space* space);
+  // Bulk version of the above, see ExternalEntityTable::AllocateEntries().
+  inline void AllocateEntries(Space* space, uint32_t* indices, size_t count);
 
   CompactionResult FinishCompaction(Space* space, Histogram* counter);
 
@@ -8,6 +8,8 @@
 #include "src/sandbox/external-entity-table.h"
 // Include the non-inl header before the rest of the headers.
 
+#include <algorithm>
+
 #include "src/base/atomicops.h"
 #include "src/base/emulated-virtual-address-subspace.h"
 #include "src/base/iterator.h"
@@ -231,6 +233,66 @@ std::optional<uint32_t> ExternalEntityTable<Entry, size>::TryAllocateEntry(
   return allocated_entry;
 }
 
+template <typename Entry, size_t size>
+void ExternalEntityTable<Entry, size>::AllocateEntries(Space* space,
+                                                       uint32_t* indices,
+                                                       size_t count) {
+  DCHECK(this->is_initialized());
+  DCHECK(space->BelongsTo(this));
+  DCHECK(!space->is_internal_read_only_space());
+
+  // See TryAllocateEntry().
+  DisallowGarbageCollection no_gc;
+
+  // Other threads may still allocate from the freelist without taking the
+  // lock, but holding it guarantees that the set of segments does not change,
+  // which is what makes it safe to follow the freelist below.
+  base::MutexGuard guard(&space->mutex_);
+
+  while (count > 0) {
+    FreelistHead freelist =
+        space->freelist_head_.load(std::memory_order_acquire);
+    if (freelist.is_empty()) {
+      std::optional<FreelistHead> maybe_freelist = TryExtend(space);
+      if (!maybe_freelist) {
+        OnCriticalMemoryPressure();
+        maybe_freelist = TryExtend(space);
+        if (!maybe_freelist) {
+          V8::FatalProcessOutOfMemory(nullptr,
+                                      "ExternalEntityTable::AllocateEntries");
+        }
+      }
+      freelist = *maybe_freelist;
+    }
+
+    // Walk the first entries of the freelist. A concurrent allocation may
+    // overwrite an entry while we are reading it, in which case the link we
+    // read is garbage. Links outside of this space are therefore never
+    // followed, and the compare-and-swap below fails in any case since the
+    // freelist head has changed.
+    uint32_t run_length =
+        static_cast<uint32_t>(std::min<size_t>(count, freelist.length()));
+    uint32_t next = freelist.next();
+    uint32_t allocated = 0;
+    for (; allocated < run_length; ++allocated) {
+      if (space->segments_.find(Segment::Containing(next)) ==
+          space->segments_.end()) {
+        break;
+      }
+      indices[allocated] = next;
+      next = this->at(next).GetNextFreelistEntryIndex();
+    }
+    if (allocated < run_length) continue;
+
+    FreelistHead new_freelist(next, freelist.length() - run_length);
+    if (space->freelist_head_.compare_exchange_strong(
+            freelist, new_freelist, std::memory_order_relaxed)) {
+      indices += run_length;
+      count -= run_length;
+    }
+  }
+}
+
 template <typename Entry, size_t size>
 uint32_t ExternalEntityTable<Entry, size>::AllocateEntryBelow(
     Space* space, uint32_t threshold_index) {
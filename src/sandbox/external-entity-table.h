@@ -174,6 +174,16 @@ class V8_EXPORT_PRIVATE ExternalEntityTable
   uint32_t AllocateEntry(Space* space);
   std::optional<uint32_t> TryAllocateEntry(Space* space);
 
+  // Allocates |count| entries in the given space and writes their indices to
+  // |indices|.
+  //
+  // Entries are taken off the freelist in runs, each with a single atomic
+  // operation, and the space is extended by as many segments as needed while
+  // the space's lock is held only once. This is considerably cheaper than
+  // repeated AllocateEntry() calls when many entries are needed at once.
+  // This method is atomic and can be called from background threads.
+  void AllocateEntries(Space* space, uint32_t* indices, size_t count);
+
   // Attempts to allocate an entry in the given space below the specified index.
   //
   // If there are no free entries at a lower index, this method will fail and
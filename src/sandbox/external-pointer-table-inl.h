@@ -226,6 +226,22 @@ ExternalPointerHandle ExternalPointerTable::AllocateAndInitializeEntry(
   return handle;
 }
 
+void ExternalPointerTable::AllocateAndInitializeEntries(
+    Space* space, const Address* initial_values, ExternalPointerTag tag,
+    ExternalPointerHandle* handles, size_t count) {
+  DCHECK(space->BelongsTo(this));
+  // The handles are converted in place from the allocated indices.
+  AllocateEntries(space, handles, count);
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t index = handles[i];
+    at(index).MakeExternalPointerEntry(initial_values[i], tag,
+                                       space->allocate_black());
+    handles[i] = IndexToHandle(index);
+    TakeOwnershipOfManagedResourceIfNecessary(initial_values[i], handles[i],
+                                              tag);
+  }
+}
+
 ExternalPointerHandle ExternalPointerTable::DuplicateEntry(
     Space* space, ExternalPointerHandle handle) {
   DCHECK_NE(handle, kNullExternalPointerHandle);
@@ -313,6 +313,18 @@ class V8_EXPORT_PRIVATE ExternalPointerTable
   inline ExternalPointerHandle AllocateAndInitializeEntry(
       Space* space, Address initial_value, ExternalPointerTag tag);
 
+  // Allocates |count| new entries in the given space, initializing them with
+  // |initial_values| and the given tag, and writes their handles to |handles|.
+  // Meant for embedders that create many objects with external pointers at
+  // once, see ExternalEntityTable::AllocateEntries().
+  //
+  // This method is atomic and can be called from background threads.
+  inline void AllocateAndInitializeEntries(Space* space,
+                                           const Address* initial_values,
+                                           ExternalPointerTag tag,
+                                           ExternalPointerHandle* handles,
+                                           size_t count);
+
   // Duplicates an entry, returning a handle to the new entry.
   inline ExternalPointerHandle DuplicateEntry(Space* space,
                                               ExternalPointerHandle handle);
@@ -5,13 +5,18 @@
 #include "src/snapshot/code-serializer.h"
 
 #include <memory>
+#include <set>
+#include <tuple>
 
 #include "src/base/fpu.h"
+#include "src/base/lazy-instance.h"
 #include "src/base/logging.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
 #include "src/baseline/baseline-batch-compiler.h"
 #include "src/codegen/background-merge-task.h"
+#include "src/codegen/compiler.h"
 #include "src/common/globals.h"
 #include "src/handles/maybe-handles.h"
 #include "src/handles/persistent-handles.h"
@@ -104,6 +109,34 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   return result;
 }
 
+// static
+ScriptCompiler::CachedData* CodeSerializer::SerializeScopeCache(
+    Isolate* isolate, DirectHandle<SharedFunctionInfo> info) {
+  HandleScope scope(isolate);
+  DirectHandle<Script> script(Cast<Script>(info->script()), isolate);
+  // Wrapped functions and modules are compiled through other entry points.
+  if (script->is_wrapped() || script->origin_options().IsModule()) {
+    return nullptr;
+  }
+  ScriptDetails script_details(handle(script->name(), isolate),
+                               script->origin_options());
+  script_details.line_offset = script->line_offset();
+  script_details.column_offset = script->column_offset();
+  script_details.source_map_url = handle(script->source_mapping_url(), isolate);
+  script_details.host_defined_options =
+      handle(script->host_defined_options(), isolate);
+  Handle<String> source(Cast<String>(script->source()), isolate);
+
+  DirectHandle<SharedFunctionInfo> toplevel;
+  if (!Compiler::CompileToplevelUncached(isolate, source, script_details)
+           .ToHandle(&toplevel)) {
+    // The script compiled before, so this can only be a stack overflow.
+    isolate->clear_exception();
+    return nullptr;
+  }
+  return Serialize(isolate, indirect_handle(toplevel, isolate));
+}
+
 AlignedCachedData* CodeSerializer::SerializeSharedFunctionInfo(
     Handle<SharedFunctionInfo> info) {
   DisallowGarbageCollection no_gc;
@@ -781,6 +814,42 @@ SerializedCodeSanityCheckResult SerializedCodeData::SanityCheckJustSource(
   return SerializedCodeSanityCheckResult::kSuccess;
 }
 
+namespace {
+
+// Code caches are frequently memory-mapped once by the embedder and consumed
+// by several isolates (or several times by the same one). Checksumming a large
+// cache dominates the sanity check, so buffers that already passed
+// verification are remembered by address, length and stored checksum and not
+// hashed again.
+class VerifiedCodeCacheRegistry {
+ public:
+  using Key = std::tuple<const uint8_t*, uint32_t, uint32_t>;
+
+  bool Contains(const Key& key) {
+    base::MutexGuard guard(&mutex_);
+    return verified_.count(key) != 0;
+  }
+
+  void Add(const Key& key) {
+    base::MutexGuard guard(&mutex_);
+    // Keep the registry bounded; embedders only hold on to a handful of
+    // caches at any time.
+    if (verified_.size() >= kMaxEntries) verified_.clear();
+    verified_.insert(key);
+  }
+
+ private:
+  static constexpr size_t kMaxEntries = 64;
+
+  base::Mutex mutex_;
+  std::set<Key> verified_;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(VerifiedCodeCacheRegistry,
+                                GetVerifiedCodeCacheRegistry)
+
+}  // namespace
+
 SerializedCodeSanityCheckResult SerializedCodeData::SanityCheckWithoutSource(
     uint32_t expected_ro_snapshot_checksum) const {
   if (size_ < kHeaderSize) {
@@ -810,9 +879,17 @@ SerializedCodeSanityCheckResult SerializedCodeData::SanityCheckWithoutSource(
   }
   if (v8_flags.verify_snapshot_checksum) {
     uint32_t checksum = GetHeaderValue(kChecksumOffset);
+    VerifiedCodeCacheRegistry::Key key(data_, size_, checksum);
+    if (v8_flags.verify_code_cache_checksum_once &&
+        GetVerifiedCodeCacheRegistry()->Contains(key)) {
+      return SerializedCodeSanityCheckResult::kSuccess;
+    }
     if (Checksum(ChecksummedContent()) != checksum) {
       return SerializedCodeSanityCheckResult::kChecksumMismatch;
     }
+    if (v8_flags.verify_code_cache_checksum_once) {
+      GetVerifiedCodeCacheRegistry()->Add(key);
+    }
   }
   return SerializedCodeSanityCheckResult::kSuccess;
 }
@@ -76,6 +76,10 @@ class CodeSerializer : public Serializer {
   CodeSerializer& operator=(const CodeSerializer&) = delete;
   V8_EXPORT_PRIVATE static ScriptCompiler::CachedData* Serialize(
       Isolate* isolate, Handle<SharedFunctionInfo> info);
+  // Serializes a fresh top-level compile of {info}'s script, in which no inner
+  // function has been compiled yet.
+  V8_EXPORT_PRIVATE static ScriptCompiler::CachedData* SerializeScopeCache(
+      Isolate* isolate, DirectHandle<SharedFunctionInfo> info);
 
   AlignedCachedData* SerializeSharedFunctionInfo(
       Handle<SharedFunctionInfo> info);
@@ -4,6 +4,15 @@
 
 #include "src/snapshot/read-only-deserializer.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/base/platform/platform.h"
 #include "src/handles/handles-inl.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/read-only-heap.h"
@@ -13,10 +22,122 @@
 #include "src/snapshot/embedded/embedded-data-inl.h"
 #include "src/snapshot/read-only-serializer-deserializer.h"
 #include "src/snapshot/snapshot-data.h"
+#include "src/snapshot/snapshot-utils.h"
+#include "src/utils/version.h"
 
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// The deserialized (but not yet post-processed) contents of the read-only
+// pages, stored in a file given by --read-only-heap-file. With static roots
+// every process places the read-only pages at the same cage offsets, so the
+// image is identical across processes running the same snapshot. Pages are
+// mapped privately from the file: they stay clean and shared until a process
+// writes to them, e.g. during post-processing or rehashing.
+//
+// Layout: a header padded to the OS allocation page size, followed by one
+// kRegularPageSize slot per read-only page holding the bytes of that page.
+class ReadOnlyHeapImageFile final {
+ public:
+  ReadOnlyHeapImageFile(const char* path, const SnapshotByteSource* source)
+      : path_(path),
+        header_size_(base::OS::AllocatePageSize()),
+        checksum_(Checksum(base::VectorOf(source->data(), source->length()))) {
+    std::unique_ptr<base::OS::MemoryMappedFile> file(
+        base::OS::MemoryMappedFile::open(
+            path, base::OS::MemoryMappedFile::FileMode::kReadOnly));
+    if (!file || file->size() < header_size_) return;
+    const Header* header = static_cast<const Header*>(file->memory());
+    if (header->magic != kMagic || header->version_hash != Version::Hash() ||
+        header->payload_checksum != checksum_ ||
+        file->size() < header_size_ + header->page_count * kRegularPageSize) {
+      return;
+    }
+    file_ = std::move(file);
+  }
+
+  // Whether the file already holds a valid image for this snapshot.
+  bool is_populated() const { return file_ != nullptr; }
+
+  // Maps the part of the page that the image covers on top of the freshly
+  // allocated page. Returns the mapped range, which is empty on failure.
+  std::pair<Address, Address> MapPage(size_t page_index,
+                                      ReadOnlyPageMetadata* page,
+                                      size_t area_size_in_bytes) {
+    DCHECK(is_populated());
+    const size_t os_page_size = base::OS::AllocatePageSize();
+    Address start = RoundUp(page->area_start(), os_page_size);
+    Address end =
+        RoundDown(page->area_start() + area_size_in_bytes, os_page_size);
+    const Header* header = static_cast<const Header*>(file_->memory());
+    if (page_index >= header->page_count || start >= end) return {};
+    const uint8_t* image = static_cast<const uint8_t*>(file_->memory()) +
+                           header_size_ + page_index * kRegularPageSize +
+                           (start - page->ChunkAddress());
+    if constexpr (base::OS::IsRemapPageSupported()) {
+      if (base::OS::RemapPages(image, end - start,
+                               reinterpret_cast<void*>(start),
+                               base::OS::MemoryPermission::kReadWrite)) {
+        return {start, end};
+      }
+    }
+    return {};
+  }
+
+  // Writes the image of the given pages. The file is written under a
+  // temporary name and renamed into place, so that concurrently starting
+  // processes only ever see complete images.
+  void Write(const std::vector<ReadOnlyPageMetadata*>& pages,
+             const std::vector<size_t>& area_sizes_in_bytes) const {
+    DCHECK_EQ(pages.size(), area_sizes_in_bytes.size());
+    std::string temp_path =
+        std::string(path_) + "." +
+        std::to_string(base::OS::GetCurrentProcessId()) + ".tmp";
+    FILE* file = base::OS::FOpen(temp_path.c_str(), "wb");
+    if (file == nullptr) return;
+    Header header{kMagic, Version::Hash(), checksum_,
+                  static_cast<uint32_t>(pages.size())};
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+    for (size_t i = 0; ok && i < pages.size(); i++) {
+      Address chunk = pages[i]->ChunkAddress();
+      size_t size = pages[i]->area_start() - chunk + area_sizes_in_bytes[i];
+      ok = Seek(file, header_size_ + i * kRegularPageSize) &&
+           fwrite(reinterpret_cast<const void*>(chunk), size, 1, file) == 1;
+    }
+    // Extend the file to cover the last page slot.
+    ok = ok && Seek(file, header_size_ + pages.size() * kRegularPageSize - 1) &&
+         fputc(0, file) != EOF;
+    ok = fclose(file) == 0 && ok;
+    if (!ok || std::rename(temp_path.c_str(), path_) != 0) {
+      std::remove(temp_path.c_str());
+    }
+  }
+
+ private:
+  static constexpr uint32_t kMagic = 0x524f4831;  // "ROH1"
+
+  static bool Seek(FILE* file, size_t offset) {
+    return fseek(file, static_cast<long>(offset),  // NOLINT(runtime/int)
+                 SEEK_SET) == 0;
+  }
+
+  struct Header {
+    uint32_t magic;
+    uint32_t version_hash;
+    uint32_t payload_checksum;
+    uint32_t page_count;
+  };
+
+  const char* const path_;
+  const size_t header_size_;
+  const uint32_t checksum_;
+  std::unique_ptr<base::OS::MemoryMappedFile> file_;
+};
+
+}  // namespace
+
 class ReadOnlyHeapImageDeserializer final {
  public:
   static void Deserialize(Isolate* isolate, SnapshotByteSource* source) {
@@ -27,7 +148,11 @@ class ReadOnlyHeapImageDeserializer final {
   using Bytecode = ro::Bytecode;
 
   ReadOnlyHeapImageDeserializer(Isolate* isolate, SnapshotByteSource* source)
-      : source_(source), isolate_(isolate) {}
+      : source_(source), isolate_(isolate) {
+    if (V8_STATIC_ROOTS_BOOL && v8_flags.read_only_heap_file != nullptr) {
+      image_file_.emplace(v8_flags.read_only_heap_file, source);
+    }
+  }
 
   void DeserializeImpl() {
     while (true) {
@@ -49,6 +174,11 @@ class ReadOnlyHeapImageDeserializer final {
           DeserializeReadOnlyRootsTable();
           break;
         case Bytecode::kFinalizeReadOnlySpace:
+          if (image_file_ && !image_file_->is_populated()) {
+            // Store the image before post-processing and finalization write
+            // process-specific data into the pages.
+            image_file_->Write(ro_space()->pages(), area_sizes_in_bytes_);
+          }
           ro_space()->FinalizeSpaceForDeserialization(source_->GetUint30());
           return;
       }
@@ -74,6 +204,15 @@ class ReadOnlyHeapImageDeserializer final {
     CHECK_EQ(actual_page_index, expected_page_index);
     ro_space()->InitializePageForDeserialization(PageAt(actual_page_index),
                                                  area_size_in_bytes);
+    if (image_file_) {
+      area_sizes_in_bytes_.push_back(area_size_in_bytes);
+      mapped_ranges_.push_back(
+          image_file_->is_populated()
+              ? image_file_->MapPage(actual_page_index,
+                                     PageAt(actual_page_index),
+                                     area_size_in_bytes)
+              : std::pair<Address, Address>{});
+    }
   }
 
   void DeserializeSegment() {
@@ -84,7 +223,23 @@ class ReadOnlyHeapImageDeserializer final {
     Address start = page->area_start() + source_->GetUint30();
     int size_in_bytes = source_->GetUint30();
     CHECK_LE(start + size_in_bytes, page->area_end());
-    source_->CopyRaw(reinterpret_cast<void*>(start), size_in_bytes);
+    if (image_file_ && mapped_ranges_[page_index].first <
+                           mapped_ranges_[page_index].second) {
+      // The mapped part of the page already holds these bytes; only copy what
+      // lies outside of it so that the mapped pages stay clean.
+      Address end = start + size_in_bytes;
+      Address skip_start =
+          std::clamp(mapped_ranges_[page_index].first, start, end);
+      Address skip_end =
+          std::clamp(mapped_ranges_[page_index].second, skip_start, end);
+      source_->CopyRaw(reinterpret_cast<void*>(start),
+                       static_cast<int>(skip_start - start));
+      source_->Advance(static_cast<int>(skip_end - skip_start));
+      source_->CopyRaw(reinterpret_cast<void*>(skip_end),
+                       static_cast<int>(end - skip_end));
+    } else {
+      source_->CopyRaw(reinterpret_cast<void*>(start), size_in_bytes);
+    }
 
     if (!V8_STATIC_ROOTS_BOOL) {
       uint8_t relocate_marker_bytecode = source_->Get();
@@ -146,6 +301,11 @@ class ReadOnlyHeapImageDeserializer final {
 
   SnapshotByteSource* const source_;
   Isolate* const isolate_;
+
+  // Only used with --read-only-heap-file.
+  std::optional<ReadOnlyHeapImageFile> image_file_;
+  std::vector<size_t> area_sizes_in_bytes_;
+  std::vector<std::pair<Address, Address>> mapped_ranges_;
 };
 
 ReadOnlyDeserializer::ReadOnlyDeserializer(Isolate* isolate,
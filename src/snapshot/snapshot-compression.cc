@@ -4,7 +4,13 @@
 
 #include "src/snapshot/snapshot-compression.h"
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "include/v8-platform.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/init/v8.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 #include "third_party/zlib/google/compression_utils_portable.h"
@@ -12,12 +18,83 @@
 namespace v8 {
 namespace internal {
 
-uint32_t GetUncompressedSize(const Bytef* compressed_data) {
-  uint32_t size;
-  MemCopy(&size, compressed_data, sizeof(size));
-  return size;
+namespace {
+
+// The payload is compressed in independent chunks, so that they can be
+// decompressed in parallel. The layout is:
+//
+//   uint32_t uncompressed size
+//   uint32_t chunk count
+//   uint32_t compressed size, for each chunk
+//   compressed chunks
+//
+// Every chunk but the last one decompresses to exactly kChunkSize bytes.
+constexpr uint32_t kChunkSize = 256 * KB;
+constexpr uint32_t kUncompressedSizeOffset = 0;
+constexpr uint32_t kChunkCountOffset = kUncompressedSizeOffset + kUInt32Size;
+constexpr uint32_t kChunkSizesOffset = kChunkCountOffset + kUInt32Size;
+
+uint32_t ReadUint32(const uint8_t* data, uint32_t offset) {
+  uint32_t value;
+  MemCopy(&value, data + offset, sizeof(value));
+  return value;
+}
+
+void WriteUint32(uint8_t* data, uint32_t offset, uint32_t value) {
+  MemCopy(data + offset, &value, sizeof(value));
+}
+
+uint32_t ChunkCount(uint32_t uncompressed_size) {
+  // An empty payload still gets one (empty) chunk.
+  if (uncompressed_size == 0) return 1;
+  return (uncompressed_size - 1) / kChunkSize + 1;
+}
+
+uint32_t HeaderSize(uint32_t chunk_count) {
+  return kChunkSizesOffset + chunk_count * kUInt32Size;
 }
 
+struct Chunk {
+  const Bytef* compressed;
+  uLong compressed_size;
+  Bytef* uncompressed;
+  uLongf uncompressed_size;
+};
+
+void DecompressChunk(const Chunk& chunk) {
+  uLongf uncompressed_size = chunk.uncompressed_size;
+  CHECK_EQ(zlib_internal::UncompressHelper(
+               zlib_internal::ZRAW, chunk.uncompressed, &uncompressed_size,
+               chunk.compressed, chunk.compressed_size),
+           Z_OK);
+  CHECK_EQ(uncompressed_size, chunk.uncompressed_size);
+}
+
+class DecompressionJob final : public JobTask {
+ public:
+  explicit DecompressionJob(const std::vector<Chunk>* chunks)
+      : chunks_(chunks) {}
+
+  void Run(JobDelegate* delegate) override {
+    do {
+      size_t index = next_chunk_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= chunks_->size()) return;
+      DecompressChunk((*chunks_)[index]);
+    } while (!delegate->ShouldYield());
+  }
+
+  size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+    size_t next_chunk = next_chunk_.load(std::memory_order_relaxed);
+    return chunks_->size() - std::min(next_chunk, chunks_->size());
+  }
+
+ private:
+  const std::vector<Chunk>* const chunks_;
+  std::atomic<size_t> next_chunk_{0};
+};
+
+}  // namespace
+
 SnapshotData SnapshotCompression::Compress(
     const SnapshotData* uncompressed_data) {
   SnapshotData snapshot_data;
@@ -25,40 +102,53 @@ SnapshotData SnapshotCompression::Compress(
   if (v8_flags.profile_deserialization) timer.Start();
 
   static_assert(sizeof(Bytef) == 1, "");
-  const uLongf input_size =
-      static_cast<uLongf>(uncompressed_data->RawData().size());
-  uint32_t payload_length =
-      static_cast<uint32_t>(uncompressed_data->RawData().size());
-
-  uLongf compressed_data_size = compressBound(input_size);
+  base::Vector<const uint8_t> input = uncompressed_data->RawData();
+  uint32_t payload_length = static_cast<uint32_t>(input.size());
+  uint32_t chunk_count = ChunkCount(payload_length);
+  uint32_t header_size = HeaderSize(chunk_count);
 
   // Allocating >= the final amount we will need.
-  snapshot_data.AllocateData(
-      static_cast<uint32_t>(sizeof(payload_length) + compressed_data_size));
+  size_t max_size = header_size;
+  for (uint32_t i = 0; i < chunk_count; i++) {
+    uint32_t chunk_size = std::min(kChunkSize, payload_length - i * kChunkSize);
+    max_size += compressBound(static_cast<uLong>(chunk_size));
+  }
+  snapshot_data.AllocateData(static_cast<uint32_t>(max_size));
 
   uint8_t* compressed_data =
       const_cast<uint8_t*>(snapshot_data.RawData().begin());
   // Since we are doing raw compression (no zlib or gzip headers), we need to
   // manually store the uncompressed size.
-  MemCopy(compressed_data, &payload_length, sizeof(payload_length));
-
-  CHECK_EQ(
-      zlib_internal::CompressHelper(
-          zlib_internal::ZRAW, compressed_data + sizeof(payload_length),
-          &compressed_data_size,
-          reinterpret_cast<const Bytef*>(uncompressed_data->RawData().begin()),
-          input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
-      Z_OK);
+  WriteUint32(compressed_data, kUncompressedSizeOffset, payload_length);
+  WriteUint32(compressed_data, kChunkCountOffset, chunk_count);
+
+  size_t compressed_size = header_size;
+  for (uint32_t i = 0; i < chunk_count; i++) {
+    uint32_t chunk_start = i * kChunkSize;
+    uint32_t chunk_size = std::min(kChunkSize, payload_length - chunk_start);
+    uLongf compressed_chunk_size =
+        static_cast<uLongf>(max_size - compressed_size);
+    CHECK_EQ(zlib_internal::CompressHelper(
+                 zlib_internal::ZRAW, compressed_data + compressed_size,
+                 &compressed_chunk_size,
+                 reinterpret_cast<const Bytef*>(input.begin() + chunk_start),
+                 static_cast<uLong>(chunk_size), Z_DEFAULT_COMPRESSION, nullptr,
+                 nullptr),
+             Z_OK);
+    WriteUint32(compressed_data, kChunkSizesOffset + i * kUInt32Size,
+                static_cast<uint32_t>(compressed_chunk_size));
+    compressed_size += compressed_chunk_size;
+  }
 
   // Reallocating to exactly the size we need.
-  snapshot_data.Resize(static_cast<uint32_t>(compressed_data_size) +
-                       sizeof(payload_length));
-  DCHECK_EQ(payload_length,
-            GetUncompressedSize(snapshot_data.RawData().begin()));
+  snapshot_data.Resize(static_cast<uint32_t>(compressed_size));
+  DCHECK_EQ(payload_length, ReadUint32(snapshot_data.RawData().begin(),
+                                       kUncompressedSizeOffset));
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Compressing %d bytes took %0.3f ms]\n", payload_length, ms);
+    PrintF("[Compressing %d bytes in %d chunks took %0.3f ms]\n",
+           payload_length, chunk_count, ms);
   }
   return snapshot_data;
 }
@@ -69,29 +159,43 @@ SnapshotData SnapshotCompression::Decompress(
   base::ElapsedTimer timer;
   if (v8_flags.profile_deserialization) timer.Start();
 
-  const Bytef* input_bytef =
-      reinterpret_cast<const Bytef*>(compressed_data.begin());
-
-  // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually retrieve the uncompressed size.
-  uint32_t uncompressed_payload_length = GetUncompressedSize(input_bytef);
-  input_bytef += sizeof(uncompressed_payload_length);
+  const uint8_t* input = compressed_data.begin();
+  uint32_t uncompressed_payload_length =
+      ReadUint32(input, kUncompressedSizeOffset);
+  uint32_t chunk_count = ReadUint32(input, kChunkCountOffset);
+  CHECK_EQ(chunk_count, ChunkCount(uncompressed_payload_length));
 
   snapshot_data.AllocateData(uncompressed_payload_length);
-
-  uLongf uncompressed_size = uncompressed_payload_length;
-  CHECK_EQ(zlib_internal::UncompressHelper(
-               zlib_internal::ZRAW,
-               const_cast<Bytef*>(snapshot_data.RawData().begin()),
-               &uncompressed_size, input_bytef,
-               static_cast<uLong>(compressed_data.size() -
-                                  sizeof(uncompressed_payload_length))),
-           Z_OK);
+  Bytef* output = const_cast<Bytef*>(snapshot_data.RawData().begin());
+
+  std::vector<Chunk> chunks(chunk_count);
+  size_t compressed_offset = HeaderSize(chunk_count);
+  for (uint32_t i = 0; i < chunk_count; i++) {
+    uint32_t chunk_start = i * kChunkSize;
+    uint32_t compressed_chunk_size =
+        ReadUint32(input, kChunkSizesOffset + i * kUInt32Size);
+    CHECK_LE(compressed_offset + compressed_chunk_size, compressed_data.size());
+    chunks[i] = {input + compressed_offset, compressed_chunk_size,
+                 output + chunk_start,
+                 std::min(kChunkSize, uncompressed_payload_length - chunk_start)};
+    compressed_offset += compressed_chunk_size;
+  }
+  CHECK_EQ(compressed_offset, compressed_data.size());
+
+  if (chunk_count > 1 && v8_flags.parallel_snapshot_decompression &&
+      !v8_flags.single_threaded) {
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking,
+                    std::make_unique<DecompressionJob>(&chunks))
+        ->Join();
+  } else {
+    for (const Chunk& chunk : chunks) DecompressChunk(chunk);
+  }
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
-    PrintF("[Decompressing %d bytes took %0.3f ms]\n",
-           uncompressed_payload_length, ms);
+    PrintF("[Decompressing %d bytes in %d chunks took %0.3f ms]\n",
+           uncompressed_payload_length, chunk_count, ms);
   }
   return snapshot_data;
 }
@@ -284,6 +284,13 @@ void Snapshot::ClearReconstructableDataForSerialization(
         continue;  // Don't clear extensions, they cannot be recompiled.
       }
 
+      // Functions that ran while the snapshot was warmed up are remembered as
+      // hot, since their feedback is about to be dropped.
+      if (!clear_recompilable_data && v8_flags.snapshot_hot_functions &&
+          fun->has_feedback_vector()) {
+        shared->set_is_snapshot_hot(true);
+      }
+
       // Also, clear out feedback vectors and recompilable code.
       if (fun->CanDiscardCompiled(isolate)) {
         fun->UpdateCode(isolate, *BUILTIN_CODE(isolate, CompileLazy));
@@ -32,7 +32,7 @@ BuiltinsSorter::~BuiltinsSorter() {
 void Cluster::Merge(Cluster* other) {
   for (Builtin builtin : other->targets_) {
     targets_.push_back(builtin);
-    sorter_->builtin_cluster_map_.emplace(builtin, this);
+    sorter_->builtin_cluster_map_[builtin] = this;
   }
   density_ = static_cast<uint32_t>(
       (time_approximation() + other->time_approximation()) /
@@ -91,34 +91,39 @@ Builtin BuiltinsSorter::FindBestPredecessorOf(Builtin callee) {
         bestProb = incoming_prob;
       }
     }
+  }
 
-    if (bestProb < kMinEdgeProbabilityThreshold ||
-        bestPred == Builtin::kNoBuiltinId)
-      continue;
+  if (bestProb < kMinEdgeProbabilityThreshold ||
+      bestPred == Builtin::kNoBuiltinId) {
+    return Builtin::kNoBuiltinId;
+  }
 
-    Cluster* predCls = builtin_cluster_map_[bestPred];
-    Cluster* succCls = builtin_cluster_map_[callee];
+  Cluster* predCls = builtin_cluster_map_[bestPred];
+  Cluster* succCls = builtin_cluster_map_[callee];
 
-    // Don't merge if the caller and callee are already in same cluster.
-    if (predCls == succCls) continue;
-    // Don't merge clusters if the combined size is too big.
-    if (predCls->size_ + succCls->size_ > kMaxClusterSize) continue;
-    if (predCls->density_ == 0) {
-      // Some density of cluster after normalized may be 0, in that case we dont
-      // merge them.
-      continue;
-    }
-    CHECK(predCls->size_);
+  // Don't merge if the caller and callee are already in same cluster.
+  if (predCls == succCls) return Builtin::kNoBuiltinId;
+  // Don't merge clusters if the combined size is too big.
+  if (predCls->size_ + succCls->size_ > kMaxClusterSize) {
+    return Builtin::kNoBuiltinId;
+  }
+  if (predCls->density_ == 0 || succCls->density_ == 0) {
+    // Some density of cluster after normalized may be 0, in that case we dont
+    // merge them. A cold callee stays out of hot clusters so that it ends up
+    // in the cold part of the embedded blob.
+    return Builtin::kNoBuiltinId;
+  }
+  CHECK(predCls->size_);
 
-    uint32_t new_density = static_cast<uint32_t>(
-        (predCls->time_approximation() + succCls->time_approximation()) /
-        (predCls->size_ + succCls->size_));
+  uint32_t new_density = static_cast<uint32_t>(
+      (predCls->time_approximation() + succCls->time_approximation()) /
+      (predCls->size_ + succCls->size_));
 
-    // Don't merge clusters if the new merged density is lower too many times
-    // than current cluster, to avoid a huge dropping in cluster density, it
-    // will harm locality of builtins.
-    if (predCls->density_ / kMaxDensityDecreaseThreshold > new_density)
-      continue;
+  // Don't merge clusters if the new merged density is lower too many times
+  // than current cluster, to avoid a huge dropping in cluster density, it
+  // will harm locality of builtins.
+  if (predCls->density_ / kMaxDensityDecreaseThreshold > new_density) {
+    return Builtin::kNoBuiltinId;
   }
 
   return bestPred;
@@ -311,9 +316,12 @@ std::vector<Builtin> BuiltinsSorter::SortBuiltins(
   std::unordered_set<Builtin> processed_builtins;
   std::vector<Builtin> builtin_order;
 
-  // For functions in the sorted cluster from step 3.
+  // For functions in the sorted cluster from step 3. Only clusters the profile
+  // saw executing are placed here; they form the hot part of the embedded
+  // blob and are packed as densely as possible.
   for (size_t i = 0; i < clusters_.size(); i++) {
     Cluster* cls = clusters_.at(i);
+    if (cls->density_ == 0) break;
     for (size_t j = 0; j < cls->targets_.size(); j++) {
       Builtin builtin = cls->targets_[j];
 #if V8_ENABLE_GEARBOX
@@ -338,7 +346,9 @@ std::vector<Builtin> BuiltinsSorter::SortBuiltins(
     }
   }
 
-  // For the remaining builtins.
+  // The remaining builtins form the cold part: builtins the profile never saw
+  // executing and builtins it cannot see (ASM and CPP). Keep them in builtin
+  // id order.
   for (Builtin i = Builtins::kFirst; i <= Builtins::kLast; ++i) {
     AddBuiltinIfNotProcessed(i, builtin_order, processed_builtins);
   }
@@ -32,6 +32,10 @@
 // 3. Sorting clusters:
 //  After step 2, we obtain lots of clusters which comprise several functions.
 //  We will finally sort these clusters by their density.
+//
+// Builtins with a density of 0 are never merged into other clusters. They are
+// placed after all hot clusters together with the builtins that cannot be
+// profiled, which splits the embedded blob into a hot and a cold part.
 
 namespace v8 {
 namespace internal {
@@ -305,6 +305,12 @@ MaybeDirectHandle<String> IncrementalStringBuilder::Finish() {
     return factory()->InternalizeString(
         indirect_handle(accumulator(), isolate_));
   }
+  // A builder that outgrew its first part holds a rope of its parts. Flatten
+  // it once here, so that the result is sequential and the rope's ConsStrings
+  // die young instead of being promoted along with it.
+  if (IsConsString(*accumulator())) {
+    return String::Flatten(isolate_, accumulator());
+  }
   return accumulator();
 }
 
@@ -4,6 +4,8 @@
 
 #include "src/strings/unicode-decoder.h"
 
+#include <algorithm>
+
 #include "src/strings/unicode-inl.h"
 #include "src/utils/memcopy.h"
 
@@ -64,6 +66,26 @@ Utf8DecoderBase<Decoder>::Utf8DecoderBase(base::Vector<const uint8_t> data)
   using Traits = DecoderTraits<Decoder>;
   if (non_ascii_start_ == data.length()) return;
 
+  // Well-formed UTF-8 never contains replacement characters or (encoded)
+  // surrogates, so it decodes the same way with every decoder.
+  size_t rest_length = data.length() - non_ascii_start_;
+  const char* rest =
+      reinterpret_cast<const char*>(data.begin() + non_ascii_start_);
+  if (rest_length >= kMinSimdUtf8Length &&
+      simdutf::validate_utf8(rest, rest_length)) {
+    // In well-formed UTF-8, only code points up to U+00FF start with a byte
+    // below 0xC4.
+    uint8_t max_byte = 0;
+    for (size_t i = 0; i < rest_length; i++) {
+      max_byte = std::max(max_byte, static_cast<uint8_t>(rest[i]));
+    }
+    is_well_formed_ = true;
+    encoding_ = max_byte < 0xC4 ? Encoding::kLatin1 : Encoding::kUtf16;
+    utf16_length_ += static_cast<int>(
+        simdutf::utf16_length_from_utf8(rest, rest_length));
+    return;
+  }
+
   bool is_one_byte = true;
   auto state = Traits::DfaDecoder::kAccept;
   uint32_t current = 0;
@@ -135,6 +157,24 @@ void Utf8DecoderBase<Decoder>::Decode(Char* out,
 
   out += non_ascii_start_;
 
+  if (is_well_formed_) {
+    size_t rest_length = data.length() - non_ascii_start_;
+    const char* rest =
+        reinterpret_cast<const char*>(data.begin() + non_ascii_start_);
+    size_t written;
+    if constexpr (sizeof(Char) == 1) {
+      DCHECK(is_one_byte());
+      written = simdutf::convert_valid_utf8_to_latin1(
+          rest, rest_length, reinterpret_cast<char*>(out));
+    } else {
+      written = simdutf::convert_valid_utf8_to_utf16(
+          rest, rest_length, reinterpret_cast<char16_t*>(out));
+    }
+    DCHECK_EQ(written, static_cast<size_t>(utf16_length_ - non_ascii_start_));
+    USE(written);
+    return;
+  }
+
   auto state = Traits::DfaDecoder::kAccept;
   uint32_t current = 0;
   const uint8_t* cursor = data.begin() + non_ascii_start_;
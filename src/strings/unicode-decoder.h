@@ -7,15 +7,26 @@
 
 #include "src/base/vector.h"
 #include "src/strings/unicode.h"
+#include "third_party/simdutf/simdutf.h"
 
 namespace v8 {
 namespace internal {
 
+// Inputs at least this long are scanned with simdutf, which picks a SIMD
+// implementation for the host CPU. Shorter ones aren't worth the dispatch.
+constexpr uint32_t kMinSimdUtf8Length = 64;
+
 // The return value may point to the first aligned word containing the first
 // non-one-byte character, rather than directly to the non-one-byte character.
 // If the return value is >= the passed length, the entire string was
 // one-byte.
 inline uint32_t NonAsciiStart(const uint8_t* chars, uint32_t length) {
+  if (length >= kMinSimdUtf8Length) {
+    simdutf::result result = simdutf::validate_ascii_with_errors(
+        reinterpret_cast<const char*>(chars), length);
+    return static_cast<uint32_t>(result.count);
+  }
+
   const uint8_t* start = chars;
   const uint8_t* limit = chars + length;
 
@@ -75,6 +86,9 @@ class Utf8DecoderBase {
   Encoding encoding_;
   int non_ascii_start_;
   int utf16_length_;
+  // Whether everything after {non_ascii_start_} is well-formed UTF-8, which
+  // Decode can then convert with simdutf.
+  bool is_well_formed_ = false;
 };
 
 class V8_EXPORT_PRIVATE Utf8Decoder final
@@ -22,6 +22,8 @@ PERFETTO_DEFINE_CATEGORIES_IN_NAMESPACE_WITH_ATTRS(
     perfetto::Category("v8.memory")
         .SetDescription("Emits counters related to v8 memory usage."),
     perfetto::Category("v8.wasm"),
+    perfetto::Category("opencog")
+        .SetDescription("AtomSpace and agent orchestration events."),
     perfetto::Category::Group("devtools.timeline,v8"),
     perfetto::Category::Group(
         "devtools.timeline," TRACE_DISABLED_BY_DEFAULT("v8.gc")),
@@ -395,6 +395,9 @@ class VirtualMemoryCage {
     PageAllocator::Permission permissions;
     base::PageInitializationMode page_initialization_mode;
     base::PageFreeingMode page_freeing_mode;
+    // Whether to advise the OS to back the cage with transparent huge pages
+    // once its pages are committed.
+    bool use_huge_pages = false;
 
     static constexpr size_t kAnyBaseAlignment = 1;
   };
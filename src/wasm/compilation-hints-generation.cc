@@ -5,6 +5,7 @@
 #include "src/wasm/compilation-hints-generation.h"
 
 #include "src/base/strings.h"
+#include "src/flags/flags.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-module-builder.h"
 #include "src/wasm/wasm-module.h"
@@ -194,6 +195,58 @@ void EmitCompilationHintsToBuffer(ZoneBuffer& buffer,
   }
 }
 
+void EmitProfiledCompilationHintsToBuffer(ZoneBuffer& buffer,
+                                          NativeModule* native_module) {
+  const WasmModule* module = native_module->module();
+  const std::atomic<uint32_t>* tiering_budgets =
+      native_module->tiering_budget_array();
+  const uint32_t initial_budget = v8_flags.wasm_tiering_budget;
+
+  buffer.write_u8(kUnknownSectionCode);
+  size_t section_size_offset = buffer.reserve_u32v();
+  size_t section_body_begin = buffer.offset();
+  buffer.write_string(base::StaticCharVector(kCompilationPriorityString));
+  uint32_t num_functions = 0;
+  size_t num_functions_offset = buffer.reserve_u32v();
+  for (uint32_t declared_index = 0;
+       declared_index < module->num_declared_functions; declared_index++) {
+    uint32_t func_index = declared_index + module->num_imported_functions;
+    // Count functions that have TurboFan code, and the ones for which tier-up
+    // was triggered but did not finish yet.
+    bool tiered_up =
+        native_module->HasCodeWithTier(func_index, ExecutionTier::kTurbofan);
+    if (!tiered_up) {
+      base::MutexGuard mutex_guard(&module->type_feedback.mutex);
+      auto it = module->type_feedback.feedback_for_function.find(func_index);
+      tiered_up = it != module->type_feedback.feedback_for_function.end() &&
+                  it->second.tierup_priority > 0;
+    }
+    // Liftoff code spends the budget on every return and loop iteration, and
+    // gets it reset when triggering tier-up.
+    bool executed =
+        tiered_up || tiering_budgets[declared_index].load(
+                         std::memory_order_relaxed) != initial_budget;
+    if (!executed) continue;
+
+    num_functions++;
+    buffer.write_u32v(func_index);
+    buffer.write_u8(0);  // Offset 0 for function-level hint.
+    if (tiered_up) {
+      buffer.write_u8(2);    // Hint size.
+      buffer.write_u32v(0);  // Compilation priority.
+      buffer.write_u32v(0);  // Optimization priority.
+    } else {
+      buffer.write_u8(1);    // Hint size.
+      buffer.write_u32v(0);  // Compilation priority.
+    }
+  }
+
+  buffer.patch_u32v(num_functions_offset, num_functions);
+  buffer.patch_u32v(
+      section_size_offset,
+      static_cast<uint32_t>(buffer.offset() - section_body_begin));
+}
+
 void WriteCompilationHintsToFile(ZoneBuffer& buffer,
                                  NativeModule* native_module) {
   // Write compilation hints to file.
@@ -17,6 +17,14 @@ class ZoneBuffer;
 
 V8_EXPORT_PRIVATE void EmitCompilationHintsToBuffer(
     ZoneBuffer& buffer, NativeModule* native_module);
+// Emits a compilation-priority section for the functions of {native_module}
+// that were executed so far, with an optimization priority for the ones that
+// were tiered up. Compiling the same module with this section appended makes
+// those functions compile eagerly, and the hot ones with TurboFan in the
+// background. Unlike {EmitCompilationHintsToBuffer}, this works while the
+// module tiers up normally.
+V8_EXPORT_PRIVATE void EmitProfiledCompilationHintsToBuffer(
+    ZoneBuffer& buffer, NativeModule* native_module);
 void WriteCompilationHintsToFile(ZoneBuffer& buffer,
                                  NativeModule* native_module);
 
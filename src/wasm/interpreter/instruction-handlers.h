@@ -312,6 +312,47 @@
   V(s2s_I64RemS)                                \
   V(s2s_I32RemU)                                \
   V(s2s_I64RemU)                                \
+  /* Binop_LocalSet */                          \
+  V(r2s_I32Add_LocalSet)                        \
+  V(r2s_I32Sub_LocalSet)                        \
+  V(r2s_I32Mul_LocalSet)                        \
+  V(r2s_I32And_LocalSet)                        \
+  V(r2s_I32Ior_LocalSet)                        \
+  V(r2s_I32Xor_LocalSet)                        \
+  V(r2s_I64Add_LocalSet)                        \
+  V(r2s_I64Sub_LocalSet)                        \
+  V(r2s_I64Mul_LocalSet)                        \
+  V(r2s_I64And_LocalSet)                        \
+  V(r2s_I64Ior_LocalSet)                        \
+  V(r2s_I64Xor_LocalSet)                        \
+  V(r2s_F32Add_LocalSet)                        \
+  V(r2s_F32Sub_LocalSet)                        \
+  V(r2s_F32Mul_LocalSet)                        \
+  V(r2s_F32Div_LocalSet)                        \
+  V(r2s_F64Add_LocalSet)                        \
+  V(r2s_F64Sub_LocalSet)                        \
+  V(r2s_F64Mul_LocalSet)                        \
+  V(r2s_F64Div_LocalSet)                        \
+  V(s2s_I32Add_LocalSet)                        \
+  V(s2s_I32Sub_LocalSet)                        \
+  V(s2s_I32Mul_LocalSet)                        \
+  V(s2s_I32And_LocalSet)                        \
+  V(s2s_I32Ior_LocalSet)                        \
+  V(s2s_I32Xor_LocalSet)                        \
+  V(s2s_I64Add_LocalSet)                        \
+  V(s2s_I64Sub_LocalSet)                        \
+  V(s2s_I64Mul_LocalSet)                        \
+  V(s2s_I64And_LocalSet)                        \
+  V(s2s_I64Ior_LocalSet)                        \
+  V(s2s_I64Xor_LocalSet)                        \
+  V(s2s_F32Add_LocalSet)                        \
+  V(s2s_F32Sub_LocalSet)                        \
+  V(s2s_F32Mul_LocalSet)                        \
+  V(s2s_F32Div_LocalSet)                        \
+  V(s2s_F64Add_LocalSet)                        \
+  V(s2s_F64Sub_LocalSet)                        \
+  V(s2s_F64Mul_LocalSet)                        \
+  V(s2s_F64Div_LocalSet)                        \
   /* Comparison operators. */                   \
   V(r2r_I32Eq)                                  \
   V(r2r_I32Ne)                                  \
@@ -2036,6 +2036,29 @@ class Handlers : public HandlersBase {
     ctype lval = pop<ctype>(sp, code, wasm_runtime);                        \
     push<ctype>(sp, code, wasm_runtime, lval op rval);                      \
     NextOp();                                                               \
+  }                                                                         \
+                                                                            \
+  INSTRUCTION_HANDLER_FUNC r2s_##name##_LocalSet(                           \
+      const uint8_t* code, uint32_t* sp,                                    \
+      WasmInterpreterRuntime* wasm_runtime, int64_t r0, double fp0) {       \
+    /* Add volatile to prevent operand reordering in 'lval op rval' . */    \
+    ctype volatile rval = ReadRegister<ctype>(reg);                         \
+    ctype lval = pop<ctype>(sp, code, wasm_runtime);                        \
+    slot_offset_t to = Read<slot_offset_t>(code);                           \
+    base::WriteUnalignedValue<ctype>(reinterpret_cast<Address>(sp + to),    \
+                                     static_cast<ctype>(lval op rval));     \
+    NextOp();                                                               \
+  }                                                                         \
+                                                                            \
+  INSTRUCTION_HANDLER_FUNC s2s_##name##_LocalSet(                           \
+      const uint8_t* code, uint32_t* sp,                                    \
+      WasmInterpreterRuntime* wasm_runtime, int64_t r0, double fp0) {       \
+    ctype rval = pop<ctype>(sp, code, wasm_runtime);                        \
+    ctype lval = pop<ctype>(sp, code, wasm_runtime);                        \
+    slot_offset_t to = Read<slot_offset_t>(code);                           \
+    base::WriteUnalignedValue<ctype>(reinterpret_cast<Address>(sp + to),    \
+                                     static_cast<ctype>(lval op rval));     \
+    NextOp();                                                               \
   }
   FOREACH_ARITHMETIC_BINOP(DEFINE_BINOP)
 #undef DEFINE_BINOP
@@ -7486,14 +7509,17 @@ size_t WasmBytecodeGenerator::Simd128Hash::operator()(
 // Look if the slot that hold the value at {stack_index} is being shared with
 // other slots. This can happen if there are multiple load.get operations that
 // copy from the same local.
-bool WasmBytecodeGenerator::HasSharedSlot(uint32_t stack_index) const {
+bool WasmBytecodeGenerator::HasSharedSlot(uint32_t stack_index,
+                                          uint32_t consumed_count) const {
   // Only consider stack entries added in the current block.
   // We don't need to consider ancestor blocks because if a block has a
   // non-empty signature we always pass arguments and results into separate
   // slots, emitting CopySlot operations.
   uint32_t start_slot_index = blocks_[current_block_index_].stack_size_;
+  DCHECK_LE(consumed_count, stack_.size());
 
-  for (uint32_t i = start_slot_index; i < stack_.size(); i++) {
+  for (uint32_t i = start_slot_index; i < stack_.size() - consumed_count;
+       i++) {
     if (stack_[i] == stack_[stack_index]) {
       return true;
     }
@@ -12994,6 +13020,34 @@ bool WasmBytecodeGenerator::DoEncodeSuperInstruction(
       STORE_CASE(F64StoreMem, Float64, uint64_t, kFloat64, F64);
 #undef STORE_CASE
 
+      default:
+        return false;
+    }
+  } else if (next_instr.orig == kExprLocalSet) {
+    uint32_t to_stack_index = next_instr.optional.index;
+    // The operands are read before the result is stored, so only the stack
+    // entries that survive the binop must not share the local's slot.
+    uint32_t operands_on_stack = reg_mode == RegMode::kNoReg ? 2 : 1;
+    switch (curr_instr.orig) {
+#define BINOP_LOCAL_SET_CASE(name, ctype, reg, op, type)            \
+  case kExpr##name: {                                               \
+    if (HasSharedSlot(to_stack_index, operands_on_stack)) {         \
+      return false;                                                 \
+    }                                                               \
+    if (reg_mode == RegMode::kNoReg) {                              \
+      EMIT_INSTR_HANDLER(s2s_##name##_LocalSet);                    \
+      type##Pop();                                                  \
+    } else {                                                        \
+      EMIT_INSTR_HANDLER(r2s_##name##_LocalSet);                    \
+    }                                                               \
+    type##Pop();                                                    \
+    EmitSlotOffset(slots_[stack_[to_stack_index]].slot_offset);     \
+    reg_mode = RegMode::kNoReg;                                     \
+    return true;                                                    \
+  }
+      FOREACH_ARITHMETIC_BINOP(BINOP_LOCAL_SET_CASE)
+#undef BINOP_LOCAL_SET_CASE
+
       default:
         return false;
     }
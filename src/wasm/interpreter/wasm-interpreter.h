@@ -1752,7 +1752,9 @@ class WasmBytecodeGenerator {
   void PatchLoopBeginInstructions();
   void RestoreIfElseParams(uint32_t if_block_index);
 
-  bool HasSharedSlot(uint32_t stack_index) const;
+  // Whether another stack entry of the current block shares the slot of
+  // {stack_index}, ignoring the {consumed_count} entries at the top.
+  bool HasSharedSlot(uint32_t stack_index, uint32_t consumed_count = 0) const;
   bool FindSharedSlot(uint32_t stack_index, uint32_t* new_slot_index);
 
   inline const FunctionSig* GetFunctionSignature(uint32_t function_index) const;
@@ -1152,6 +1152,24 @@ bool CompileLazy(Isolate* isolate, NativeModule* native_module,
   CompilationStateImpl* compilation_state =
       Impl(native_module->compilation_state());
   DebugState is_in_debug_state = native_module->IsInDebugState();
+
+  // Modules deserialized from incrementally serialized data come with the
+  // TurboFan code of some functions, which is used unless debugging.
+  if (const LazilyDeserializedCode* lazily_deserialized_code =
+          native_module->lazily_deserialized_code();
+      lazily_deserialized_code && !is_in_debug_state) {
+    WasmCodeRefScope code_ref_scope;
+    if (WasmCode* code =
+            lazily_deserialized_code->Deserialize(native_module, func_index)) {
+      TRACE_LAZY("Deserialized wasm-function#%d.\n", func_index);
+      if (V8_UNLIKELY(native_module->log_code())) {
+        GetWasmEngine()->LogCode(base::VectorOf(&code, 1));
+        GetWasmEngine()->LogOutstandingCodesForIsolate(isolate);
+      }
+      return true;
+    }
+  }
+
   ExecutionTierPair tiers =
       GetLazyCompilationTiers(native_module, func_index, is_in_debug_state);
 
@@ -2271,7 +2289,13 @@ std::shared_ptr<NativeModule> GetOrCompileNewNativeModule(
   native_module->SetWireBytes(std::move(wire_bytes));
   native_module->compilation_state()->set_compilation_id(compilation_id);
 
-  if (!v8_flags.wasm_jitless) {
+  // With a code cache directory, another process might have compiled the
+  // module already.
+  const bool use_code_cache_file =
+      V8_UNLIKELY(v8_flags.experimental_wasm_code_cache_dir) &&
+      !v8_flags.wasm_jitless && module->origin == kWasmOrigin &&
+      UseCodeCacheFile(native_module.get());
+  if (!v8_flags.wasm_jitless && !use_code_cache_file) {
     // Compile / validate the new module.
     CompileNativeModule(thrower, native_module, pgo_info);
   }
@@ -2286,7 +2310,7 @@ std::shared_ptr<NativeModule> GetOrCompileNewNativeModule(
       .async = false,
       .streamed = false,
       .cached = false,
-      .deserialized = false,
+      .deserialized = use_code_cache_file,
       .lazy = v8_flags.wasm_lazy_compilation,
       .success = !failed,
       .code_size_in_bytes = native_module->generated_code_size(),
@@ -2473,6 +2497,17 @@ struct ValidateFunctionsStreamingJobData {
     // Use release semantics, so whoever loads this pointer (using acquire
     // semantics) sees all our previous stores.
     end_of_available_units.store(ptr, std::memory_order_release);
+    if (back_pressure_callback) {
+      base::MutexGuard guard(&back_pressure_mutex);
+      pending_bytes += code.size();
+      if (!backed_up && pending_bytes > max_pending_bytes) {
+        backed_up = true;
+        back_pressure_callback(true);
+        // Make sure that as many threads as possible work on the backlog.
+        job_handle->NotifyConcurrencyIncrease();
+        return;
+      }
+    }
     size_t total_units_added = ptr - units.begin();
     // Periodically notify concurrency increase. This has overhead, so avoid
     // calling it too often. As long as threads are still running they will
@@ -2513,6 +2548,28 @@ struct ValidateFunctionsStreamingJobData {
     return {};
   }
 
+  // Called after validating a unit of {size} bytes.
+  void OnUnitValidated(size_t size) {
+    if (!back_pressure_callback) return;
+    base::MutexGuard guard(&back_pressure_mutex);
+    DCHECK_GE(pending_bytes, size);
+    pending_bytes -= size;
+    if (backed_up && pending_bytes <= max_pending_bytes / 2) {
+      backed_up = false;
+      back_pressure_callback(false);
+    }
+  }
+
+  // Called when validation stops early because of an error, so that the
+  // embedder resumes the stream and gets to finish it.
+  void ReleaseBackPressure() {
+    if (!back_pressure_callback) return;
+    base::MutexGuard guard(&back_pressure_mutex);
+    if (!backed_up) return;
+    backed_up = false;
+    back_pressure_callback(false);
+  }
+
   void UpdateDetectedFeatures(WasmDetectedFeatures new_detected_features) {
     WasmDetectedFeatures old_features =
         detected_features.load(std::memory_order_relaxed);
@@ -2528,6 +2585,15 @@ struct ValidateFunctionsStreamingJobData {
   std::atomic<Unit*> end_of_available_units;
   std::atomic<bool> found_error{false};
   std::atomic<WasmDetectedFeatures> detected_features;
+
+  // Back-pressure towards the embedder, based on the size of the units that
+  // are added but not validated yet. Set before the first unit is added.
+  StreamingProcessor::BackPressureCallback back_pressure_callback;
+  size_t max_pending_bytes = 0;
+  base::Mutex back_pressure_mutex;
+  // Protected by {back_pressure_mutex}.
+  size_t pending_bytes = 0;
+  bool backed_up = false;
 };
 
 class ValidateFunctionsStreamingJob final : public JobTask {
@@ -2550,8 +2616,10 @@ class ValidateFunctionsStreamingJob final : public JobTask {
 
       if (result.failed()) {
         data_->found_error.store(true, std::memory_order_relaxed);
+        data_->ReleaseBackPressure();
         break;
       }
+      data_->OnUnitValidated(unit.code.size());
       // After validating one function, check if we should yield.
       if (delegate->ShouldYield()) break;
     }
@@ -2602,6 +2670,13 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
   bool Deserialize(base::Vector<const uint8_t> module_bytes,
                    base::OwnedVector<const uint8_t>& wire_bytes) override;
 
+  void SetBackPressureCallback(size_t max_pending_bytes,
+                               BackPressureCallback callback) override {
+    DCHECK_NULL(validate_functions_job_handle_);
+    validate_functions_job_data_.max_pending_bytes = max_pending_bytes;
+    validate_functions_job_data_.back_pressure_callback = std::move(callback);
+  }
+
  private:
   void CommitCompilationUnits();
 
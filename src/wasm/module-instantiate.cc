@@ -125,8 +125,9 @@ bool CompareWithNormalizedCType(const CTypeInfo& info,
   if (t.semantic() == MachineSemantic::kBool) {
     return expected == kWasmI32;
   }
-  if (info.GetType() == CTypeInfo::Type::kSeqOneByteString) {
-    // WebAssembly does not support one byte strings in fast API calls as
+  if (info.GetType() == CTypeInfo::Type::kSeqOneByteString ||
+      info.GetType() == CTypeInfo::Type::kSeqTwoByteString) {
+    // WebAssembly does not support string views in fast API calls as
     // runtime type checks are not supported so far.
     return false;
   }
@@ -203,13 +203,22 @@ bool StackMemory::IsValidContinuation(Tagged<WasmContinuationObject> cont) {
 }
 
 std::unique_ptr<StackMemory> StackPool::GetOrAllocate() {
-  while (size_ > kMaxSize) {
+  const size_t max_size =
+      static_cast<size_t>(v8_flags.wasm_stack_pool_size) * KB;
+  while (size_ > max_size) {
     size_ -= freelist_.back()->allocated_size();
     freelist_.pop_back();
+    ++stacks_freed_;
   }
+  ++stacks_requested_;
   std::unique_ptr<StackMemory> stack;
   if (freelist_.empty()) {
     stack = StackMemory::New();
+    ++stacks_allocated_;
+    if (v8_flags.trace_wasm_stack_switching) {
+      PrintF("Stack pool: %zu stacks requested, %zu allocated, %zu freed\n",
+             stacks_requested_, stacks_allocated_, stacks_freed_);
+    }
   } else {
     stack = std::move(freelist_.back());
     freelist_.pop_back();
@@ -223,8 +232,8 @@ std::unique_ptr<StackMemory> StackPool::GetOrAllocate() {
 }
 
 void StackPool::Add(std::unique_ptr<StackMemory> stack) {
-  // Add the stack to the pool regardless of kMaxSize, because the stack might
-  // still be in use by the unwinder.
+  // Add the stack to the pool regardless of the size limit, because the stack
+  // might still be in use by the unwinder.
   // Shrink the freelist lazily when we get the next stack instead.
   size_ += stack->allocated_size();
   stack->Reset();
@@ -232,6 +241,7 @@ void StackPool::Add(std::unique_ptr<StackMemory> stack) {
 }
 
 void StackPool::ReleaseFinishedStacks() {
+  stacks_freed_ += freelist_.size();
   size_ = 0;
   freelist_.clear();
 }
@@ -240,4 +250,14 @@ size_t StackPool::Size() const {
   return freelist_.size() * sizeof(decltype(freelist_)::value_type) + size_;
 }
 
+StackPool::Stats StackPool::GetStats() const {
+  Stats stats;
+  stats.stacks_requested = stacks_requested_;
+  stats.stacks_allocated = stacks_allocated_;
+  stats.stacks_freed = stacks_freed_;
+  stats.pooled_stacks = freelist_.size();
+  stats.pooled_bytes = size_;
+  return stats;
+}
+
 }  // namespace v8::internal::wasm
@@ -263,6 +263,17 @@ constexpr int kStackStateOffset =
 // whose memory can be reused for new suspendable computations.
 class StackPool {
  public:
+  struct Stats {
+    // Stacks handed out, and how many of them were newly allocated.
+    size_t stacks_requested = 0;
+    size_t stacks_allocated = 0;
+    // Finished stacks freed because the pool was full or released.
+    size_t stacks_freed = 0;
+    // Current contents of the free list.
+    size_t pooled_stacks = 0;
+    size_t pooled_bytes = 0;
+  };
+
   // Gets a stack from the free list if one exists, else allocates it.
   std::unique_ptr<StackMemory> GetOrAllocate();
   // Adds a finished stack to the free list.
@@ -270,13 +281,17 @@ class StackPool {
   // Decommit the stack memories and empty the freelist.
   void ReleaseFinishedStacks();
   size_t Size() const;
+  Stats GetStats() const;
 
  private:
   std::vector<std::unique_ptr<StackMemory>> freelist_;
+  // Total size of the stacks in the free list. While it is above
+  // --wasm-stack-pool-size, GetOrAllocate() frees stacks instead of reusing
+  // them.
   size_t size_ = 0;
-  // If the next finished stack would move the total size above this limit, the
-  // stack is freed instead of being added to the free list.
-  static constexpr int kMaxSize = 4 * MB;
+  size_t stacks_requested_ = 0;
+  size_t stacks_allocated_ = 0;
+  size_t stacks_freed_ = 0;
 };
 
 }  // namespace v8::internal::wasm
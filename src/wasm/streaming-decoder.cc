@@ -57,6 +57,16 @@ class V8_EXPORT_PRIVATE AsyncStreamingDecoder final : public StreamingDecoder {
   void NotifyNativeModuleCreated(
       const std::shared_ptr<NativeModule>& native_module) override;
 
+  void SetBackPressureCallback(
+      size_t max_pending_bytes,
+      StreamingProcessor::BackPressureCallback callback) override {
+    DCHECK(full_wire_bytes_.size() == 1 && full_wire_bytes_[0].empty());
+    if (ok()) {
+      processor_->SetBackPressureCallback(max_pending_bytes,
+                                          std::move(callback));
+    }
+  }
+
   void SetHasCompiledModuleBytes() override {
     bool has_wire_bytes =
         full_wire_bytes_.size() > 1 ||
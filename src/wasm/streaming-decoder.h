@@ -71,6 +71,13 @@ class V8_EXPORT_PRIVATE StreamingProcessor {
   // empty vector); otherwise ownership stays with the caller.
   virtual bool Deserialize(base::Vector<const uint8_t> module_bytes,
                            base::OwnedVector<const uint8_t>& wire_bytes) = 0;
+
+  // Back-pressure support, see {WasmStreaming::SetBackPressureCallback}.
+  // Processors which do not process function bodies on background threads
+  // never ask to pause the stream.
+  using BackPressureCallback = std::function<void(bool pause)>;
+  virtual void SetBackPressureCallback(size_t max_pending_bytes,
+                                       BackPressureCallback callback) {}
 };
 
 // The StreamingDecoder takes a sequence of byte arrays, each received by a call
@@ -110,6 +117,12 @@ class V8_EXPORT_PRIVATE StreamingDecoder {
 
   virtual void SetHasCompiledModuleBytes() = 0;
 
+  // Sets the callback which tells the embedder to pause or resume passing
+  // bytes. Must be called before {OnBytesReceived}.
+  virtual void SetBackPressureCallback(
+      size_t max_pending_bytes,
+      StreamingProcessor::BackPressureCallback callback) {}
+
   virtual void NotifyNativeModuleCreated(
       const std::shared_ptr<NativeModule>& native_module) = 0;
 
@@ -9,8 +9,11 @@
 #error This header should only be included if WebAssembly is enabled.
 #endif  // !V8_ENABLE_WEBASSEMBLY
 
+#include <algorithm>
+
 #include "src/base/iterator.h"
 #include "src/base/macros.h"
+#include "src/base/small-vector.h"
 #include "src/common/globals.h"
 #include "src/wasm/value-type.h"
 #include "src/zone/zone.h"
@@ -90,39 +93,57 @@ class StructTypeBase : public ZoneObject {
     }
     uint32_t offset = is_descriptor() ? kTaggedSize : 0;
     offset += field(0).value_kind_size();
-    // Optimization: we track the last gap that was introduced by alignment,
-    // and place any sufficiently-small fields in it.
+    // Optimization: we track the gaps that were introduced by alignment, and
+    // place any sufficiently-small fields in them, so that i8 and i16 fields
+    // are packed densely between wider fields regardless of their position in
+    // the declaration.
     // It's important that the algorithm that assigns offsets to fields is
     // subtyping-safe, i.e. two lists of fields with a common prefix must
     // always compute the same offsets for the fields in this common prefix.
-    uint32_t gap_position = 0;
-    uint32_t gap_size = 0;
+    struct Gap {
+      uint32_t position;
+      uint32_t size;
+    };
+    // Gaps are smaller than the maximum alignment, so a few of them are
+    // enough to pack any struct well without making this quadratic.
+    static constexpr size_t kMaxGaps = 8;
+    base::SmallVector<Gap, kMaxGaps> gaps;
+    auto add_gap = [&gaps](uint32_t position, uint32_t size) {
+      if (size == 0) return;
+      if (gaps.size() < kMaxGaps) {
+        gaps.push_back({position, size});
+        return;
+      }
+      Gap* smallest = std::min_element(
+          gaps.begin(), gaps.end(),
+          [](const Gap& a, const Gap& b) { return a.size < b.size; });
+      if (smallest->size < size) *smallest = {position, size};
+    };
     for (uint32_t i = 1; i < field_count(); i++) {
       uint32_t field_size = field(i).value_kind_size();
-      if (field_size <= gap_size) {
-        uint32_t aligned_gap = Align(gap_position, field_size, is_shared());
-        uint32_t gap_before = aligned_gap - gap_position;
-        uint32_t aligned_gap_size = gap_size - gap_before;
-        if (field_size <= aligned_gap_size) {
-          field_offsets_[i - 1] = aligned_gap;
-          uint32_t gap_after = aligned_gap_size - field_size;
-          if (gap_before > gap_after) {
-            // Keep old {gap_position}.
-            gap_size = gap_before;
-          } else {
-            gap_position = aligned_gap + field_size;
-            gap_size = gap_after;
-          }
-          continue;  // Successfully placed the field in the gap.
-        }
+      // Use the smallest gap that fits the field, so that bigger gaps remain
+      // available for bigger fields.
+      Gap* best = nullptr;
+      uint32_t best_offset = 0;
+      for (Gap& gap : gaps) {
+        if (best && best->size <= gap.size) continue;
+        uint32_t aligned_gap = Align(gap.position, field_size, is_shared());
+        if (aligned_gap + field_size > gap.position + gap.size) continue;
+        best = &gap;
+        best_offset = aligned_gap;
+      }
+      if (best) {
+        field_offsets_[i - 1] = best_offset;
+        Gap gap = *best;
+        gaps.erase(best);
+        add_gap(gap.position, best_offset - gap.position);
+        add_gap(best_offset + field_size,
+                gap.position + gap.size - best_offset - field_size);
+        continue;  // Successfully placed the field in a gap.
       }
       uint32_t old_offset = offset;
       offset = Align(offset, field_size, is_shared());
-      uint32_t gap = offset - old_offset;
-      if (gap > gap_size) {
-        gap_size = gap;
-        gap_position = old_offset;
-      }
+      add_gap(old_offset, offset - old_offset);
       field_offsets_[i - 1] = offset;
       offset += field_size;
     }
@@ -374,6 +374,21 @@ class TurboshaftGraphBuildingInterface
       StackCheck(WasmStackCheckOp::Kind::kFunctionEntry, decoder);
     }
 
+    if (mode_ == kRegular && v8_flags.wasm_flush_cold_turbofan_code &&
+        decoder->module_->origin == kWasmOrigin) {
+      // Count the call in the tiering budget, to tell the code flushing that
+      // this code is still in use (see {NativeModule::RemoveColdCode}).
+      V<WordPtr> budget_array = LOAD_IMMUTABLE_INSTANCE_FIELD(
+          trusted_instance_data, TieringBudgetArray,
+          MemoryRepresentation::UintPtr());
+      const int offset =
+          kInt32Size * declared_function_index(decoder->module_, func_index_);
+      V<Word32> budget = __ LoadOffHeap(budget_array, offset,
+                                        MemoryRepresentation::Int32());
+      __ StoreOffHeap(budget_array, __ Word32Sub(budget, 1),
+                      MemoryRepresentation::Int32(), offset);
+    }
+
     if (v8_flags.trace_wasm) {
       __ SetCurrentOrigin(
           WasmPositionToOpIndex(decoder->position(), inlining_id_));
@@ -50,6 +50,7 @@
 #include "src/wasm/wasm-module.h"
 #include "src/wasm/wasm-objects-inl.h"
 #include "src/wasm/wasm-objects.h"
+#include "src/wasm/wasm-serialization.h"
 #include "src/wasm/wasm-stack-wrapper-cache.h"
 #include "src/wasm/well-known-imports.h"
 
@@ -1671,6 +1672,36 @@ NativeModule::SnapshotCodeTable() const {
   return {std::vector<WasmCode*>{start, end}, std::move(import_statuses)};
 }
 
+std::pair<std::vector<WasmCode*>, std::vector<WellKnownImport>>
+NativeModule::SnapshotNewTurbofanCode() {
+  base::RecursiveMutexGuard lock(&allocation_mutex_);
+  uint32_t num_declared_functions = module_->num_declared_functions;
+  if (!incrementally_serialized_) {
+    incrementally_serialized_ =
+        std::make_unique<bool[]>(num_declared_functions);
+  }
+  std::vector<WasmCode*> new_code;
+  for (uint32_t i = 0; i < num_declared_functions; i++) {
+    WasmCode* code = code_table_[i];
+    if (!code || code->tier() != ExecutionTier::kTurbofan) continue;
+    if (incrementally_serialized_[i]) continue;
+    // Code that was deserialized from incrementally serialized data is in
+    // that data already.
+    if (lazily_deserialized_code_ &&
+        lazily_deserialized_code_->Contains(code->index())) {
+      continue;
+    }
+    incrementally_serialized_[i] = true;
+    WasmCodeRefScope::AddRef(code);
+    new_code.push_back(code);
+  }
+  std::vector<WellKnownImport> import_statuses(module_->num_imported_functions);
+  for (uint32_t i = 0; i < module_->num_imported_functions; i++) {
+    import_statuses[i] = module_->type_feedback.well_known_imports.get(i);
+  }
+  return {std::move(new_code), std::move(import_statuses)};
+}
+
 std::vector<WasmCode*> NativeModule::SnapshotAllOwnedCode() const {
   base::RecursiveMutexGuard lock(&allocation_mutex_);
   if (!new_owned_code_.empty()) TransferNewOwnedCodeLocked();
@@ -1970,6 +2001,12 @@ void NativeModule::SetWireBytes(base::OwnedVector<const uint8_t> wire_bytes) {
   }
 }
 
+void NativeModule::SetLazilyDeserializedCode(
+    std::unique_ptr<LazilyDeserializedCode> code) {
+  DCHECK_NULL(lazily_deserialized_code_);
+  lazily_deserialized_code_ = std::move(code);
+}
+
 void NativeModule::AddLazyCompilationTimeSample(int64_t sample_in_micro_sec) {
   num_lazy_compilations_.fetch_add(1, std::memory_order_relaxed);
   sum_lazy_compilation_time_in_micro_sec_.fetch_add(sample_in_micro_sec,
@@ -2847,6 +2884,62 @@ void NativeModule::RemoveCompiledCode(RemoveFilter filter) {
   }
 }
 
+void NativeModule::RemoveColdCode(RemovedColdCode* removed) {
+  // Without dynamic tiering, Liftoff code does not update the budgets.
+  DCHECK(v8_flags.wasm_dynamic_tiering);
+  const uint32_t num_imports = module_->num_imported_functions;
+  const uint32_t num_functions = module_->num_declared_functions;
+  // Only TurboFan code of Wasm modules counts its calls in the budgets.
+  const bool remove_turbofan_code = v8_flags.wasm_flush_cold_turbofan_code &&
+                                    module_->origin == kWasmOrigin;
+  std::vector<uint32_t> removed_turbofan_functions;
+  {
+    base::RecursiveMutexGuard guard(&allocation_mutex_);
+    if (debug_state_ == kDebugging) return;
+    // On the first call, no function is known to be cold yet.
+    const bool first_call = !last_seen_tiering_budgets_;
+    if (first_call) {
+      last_seen_tiering_budgets_ = std::make_unique<uint32_t[]>(num_functions);
+      cold_code_ages_ = std::make_unique<uint8_t[]>(num_functions);
+    }
+    for (uint32_t i = 0; i < num_functions; i++) {
+      uint32_t budget = tiering_budgets_[i].load(std::memory_order_relaxed);
+      const bool ran = first_call || budget != last_seen_tiering_budgets_[i];
+      last_seen_tiering_budgets_[i] = budget;
+      if (ran) {
+        cold_code_ages_[i] = 0;
+        continue;
+      }
+      WasmCode* code = code_table_[i];
+      if (!code || code->for_debugging()) continue;
+      if (code->is_turbofan()) {
+        if (!remove_turbofan_code) continue;
+        if (cold_code_ages_[i] < kMaxUInt8) cold_code_ages_[i]++;
+        if (cold_code_ages_[i] < v8_flags.wasm_cold_turbofan_code_age) continue;
+        removed->turbofan_functions++;
+        removed->turbofan_bytes += code->instructions_size();
+        removed_turbofan_functions.push_back(i + num_imports);
+      } else if (code->is_liftoff()) {
+        removed->liftoff_functions++;
+        removed->liftoff_bytes += code->instructions_size();
+      } else {
+        continue;
+      }
+      cold_code_ages_[i] = 0;
+      code_table_[i] = nullptr;
+      // See {RemoveCompiledCode}.
+      WasmCodeRefScope::AddRef(code);
+      code->DecRefOnLiveCode();
+      UseLazyStubLocked(i + num_imports);
+    }
+  }
+  // Once the function runs again, it gets compiled by Liftoff and can tier up
+  // like before.
+  for (uint32_t func_index : removed_turbofan_functions) {
+    compilation_state_->AllowAnotherTopTierJob(func_index);
+  }
+}
+
 size_t NativeModule::SumLiftoffCodeSizeForTesting() const {
   base::RecursiveMutexGuard guard(&allocation_mutex_);
   const uint32_t num_functions = module_->num_declared_functions;
@@ -2908,7 +3001,7 @@ NamesProvider* NativeModule::GetNamesProvider() {
 }
 
 size_t NativeModule::EstimateCurrentMemoryConsumption() const {
-  UPDATE_WHEN_CLASS_CHANGES(NativeModule, 496);
+  UPDATE_WHEN_CLASS_CHANGES(NativeModule, 528);
   size_t result = sizeof(NativeModule);
   result += module_->EstimateCurrentMemoryConsumption();
 
@@ -2920,6 +3013,9 @@ size_t NativeModule::EstimateCurrentMemoryConsumption() const {
   if (source_map_) {
     result += source_map_->EstimateCurrentMemoryConsumption();
   }
+  if (lazily_deserialized_code_) {
+    result += lazily_deserialized_code_->EstimateCurrentMemoryConsumption();
+  }
   result += compilation_state_->EstimateCurrentMemoryConsumption();
   // For {tiering_budgets_}.
   result += module_->num_declared_functions * sizeof(uint32_t);
@@ -2951,6 +3047,13 @@ size_t NativeModule::EstimateCurrentMemoryConsumption() const {
     }
     // For {code_table_}.
     result += module_->num_declared_functions * sizeof(void*);
+    if (incrementally_serialized_) {
+      result += module_->num_declared_functions * sizeof(bool);
+    }
+    if (last_seen_tiering_budgets_) {
+      result += module_->num_declared_functions *
+                (sizeof(uint32_t) + sizeof(uint8_t));
+    }
     result += ContentSize(code_space_data_);
     debug_info = debug_info_.get();
     if (names_provider_) {
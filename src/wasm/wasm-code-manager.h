@@ -49,6 +49,7 @@ namespace wasm {
 
 class AssumptionsJournal;
 class DebugInfo;
+class LazilyDeserializedCode;
 class NamesProvider;
 class NativeModule;
 struct WasmCompilationResult;
@@ -713,6 +714,11 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // to get a consistent view of the table (e.g. used by the serializer).
   std::pair<std::vector<WasmCode*>, std::vector<WellKnownImport>>
   SnapshotCodeTable() const;
+  // Like {SnapshotCodeTable}, but only contains the TurboFan code of functions
+  // that no previous call returned code for. Used for incremental
+  // serialization, which writes every function at most once.
+  std::pair<std::vector<WasmCode*>, std::vector<WellKnownImport>>
+  SnapshotNewTurbofanCode();
   // Creates a snapshot of all {owned_code_}, will transfer new code (if any) to
   // {owned_code_}.
   std::vector<WasmCode*> SnapshotAllOwnedCode() const;
@@ -818,6 +824,14 @@ class V8_EXPORT_PRIVATE NativeModule final {
   }
   void SetWireBytes(base::OwnedVector<const uint8_t> wire_bytes);
 
+  // Code that is deserialized on the first call of a function, if the module
+  // was deserialized from incrementally serialized data. Must be set before
+  // the module can be executed.
+  const LazilyDeserializedCode* lazily_deserialized_code() const {
+    return lazily_deserialized_code_.get();
+  }
+  void SetLazilyDeserializedCode(std::unique_ptr<LazilyDeserializedCode> code);
+
   void AddLiftoffBailout() {
     liftoff_bailout_count_.fetch_add(1, std::memory_order_relaxed);
   }
@@ -860,6 +874,19 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // replace it with {CompileLazy} builtins.
   void RemoveCompiledCode(RemoveFilter filter);
 
+  struct RemovedColdCode {
+    size_t liftoff_functions = 0;
+    size_t liftoff_bytes = 0;
+    size_t turbofan_functions = 0;
+    size_t turbofan_bytes = 0;
+  };
+  // Remove the code of functions that did not run since the previous call,
+  // judged by their tiering budgets, and replace it with {CompileLazy}
+  // builtins. Liftoff code is removed right away, TurboFan code only after
+  // --wasm-cold-turbofan-code-age calls in a row and only with
+  // --wasm-flush-cold-turbofan-code. Adds the removed code to {removed}.
+  void RemoveColdCode(RemovedColdCode* removed);
+
   // Returns the code size of all Liftoff compiled functions.
   size_t SumLiftoffCodeSizeForTesting() const;
 
@@ -1065,6 +1092,8 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // {WireBytesStorage}, held by background compile tasks.
   std::shared_ptr<base::OwnedVector<const uint8_t>> wire_bytes_;
 
+  std::unique_ptr<LazilyDeserializedCode> lazily_deserialized_code_;
+
   // The first allocated jump table. Always used by external calls (from JS).
   // Wasm calls might use one of the other jump tables stored in
   // {code_space_data_}.
@@ -1140,6 +1169,16 @@ class V8_EXPORT_PRIVATE NativeModule final {
 
   DebugState debug_state_ = kNotDebugging;
 
+  // Whether the TurboFan code of a declared function was returned by
+  // {SnapshotNewTurbofanCode}. Allocated on the first call.
+  std::unique_ptr<bool[]> incrementally_serialized_;
+
+  // The tiering budget of each declared function at the last call of
+  // {RemoveColdCode}, and the number of calls in a row that found it
+  // unchanged. Allocated on the first call.
+  std::unique_ptr<uint32_t[]> last_seen_tiering_budgets_;
+  std::unique_ptr<uint8_t[]> cold_code_ages_;
+
   // End of fields protected by {allocation_mutex_}.
   //////////////////////////////////////////////////////////////////////////////
 
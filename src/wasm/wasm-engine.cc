@@ -38,6 +38,7 @@
 #include "src/wasm/wasm-debug.h"
 #include "src/wasm/wasm-limits.h"
 #include "src/wasm/wasm-objects-inl.h"
+#include "src/wasm/wasm-serialization.h"
 #include "src/wasm/wasm-stack-wrapper-cache.h"
 
 #if V8_ENABLE_DRUMBRAKE
@@ -1099,6 +1100,35 @@ void WasmEngine::FlushLiftoffCode() {
   }
 }
 
+void WasmEngine::FlushColdCode(Isolate* isolate) {
+  DCHECK(v8_flags.wasm_flush_cold_liftoff_code);
+  NativeModule::RemovedColdCode removed;
+  {
+    // See {FlushLiftoffCode}.
+    std::vector<std::shared_ptr<NativeModule>> native_modules;
+    WasmCodeRefScope ref_scope;
+    base::MutexGuard guard(&mutex_);
+    auto isolate_info = isolates_.find(isolate);
+    if (isolate_info == isolates_.end()) return;
+    for (NativeModule* native_module : isolate_info->second->native_modules) {
+      std::shared_ptr<NativeModule> shared =
+          native_modules_[native_module]->weak_ptr.lock();
+      if (!shared) continue;  // The NativeModule is dying anyway.
+      native_module->RemoveColdCode(&removed);
+      native_modules.emplace_back(std::move(shared));
+    }
+  }
+  Counters* counters = isolate->counters();
+  counters->wasm_flushed_cold_liftoff_functions()->Increment(
+      static_cast<int>(removed.liftoff_functions));
+  counters->wasm_flushed_cold_liftoff_code_size()->Increment(
+      static_cast<int>(removed.liftoff_bytes));
+  counters->wasm_flushed_cold_turbofan_functions()->Increment(
+      static_cast<int>(removed.turbofan_functions));
+  counters->wasm_flushed_cold_turbofan_code_size()->Increment(
+      static_cast<int>(removed.turbofan_bytes));
+}
+
 size_t WasmEngine::GetLiftoffCodeSizeForTesting() {
   base::MutexGuard guard(&mutex_);
   size_t codesize_liftoff = 0;
@@ -1649,6 +1679,9 @@ std::shared_ptr<NativeModule> WasmEngine::UpdateNativeModuleCache(
       native_module_cache_.Update(std::move(native_module), has_error);
   if (prev != native_module.get()) {
     UseNativeModuleInIsolate(native_module.get(), isolate);
+  } else if (V8_UNLIKELY(v8_flags.experimental_wasm_code_cache_dir) &&
+             !has_error && native_module->module()->origin == kWasmOrigin) {
+    AppendToCodeCacheFileOnTierUp(native_module);
   }
   return native_module;
 }
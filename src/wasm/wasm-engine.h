@@ -241,6 +241,10 @@ class V8_EXPORT_PRIVATE WasmEngine {
   // Flushes all Liftoff code in all NativeModules.
   void FlushLiftoffCode();
 
+  // Flushes the code of functions that did not run since the last call, in
+  // all NativeModules used by {isolate}.
+  void FlushColdCode(Isolate* isolate);
+
   // Returns the code size of all Liftoff compiled functions in all modules.
   size_t GetLiftoffCodeSizeForTesting();
 
@@ -103,6 +103,12 @@ class WasmStreaming::WasmStreamingImpl {
     streaming_decoder_->SetHasCompiledModuleBytes();
   }
 
+  void SetBackPressureCallback(size_t max_pending_bytes,
+                               std::function<void(bool)> callback) {
+    streaming_decoder_->SetBackPressureCallback(max_pending_bytes,
+                                                std::move(callback));
+  }
+
   void SetUrl(base::Vector<const char> url) { streaming_decoder_->SetUrl(url); }
 
  private:
@@ -150,6 +156,11 @@ void WasmStreaming::SetMoreFunctionsCanBeSerializedCallback(
   impl_->SetMoreFunctionsCanBeSerializedCallback(std::move(callback));
 }
 
+void WasmStreaming::SetBackPressureCallback(
+    size_t max_pending_bytes, std::function<void(bool pause)> callback) {
+  impl_->SetBackPressureCallback(max_pending_bytes, std::move(callback));
+}
+
 void WasmStreaming::SetUrl(const char* url, size_t length) {
   DCHECK_EQ('\0', url[length]);  // {url} is null-terminated.
   TRACE_EVENT1("v8.wasm", "wasm.SetUrl", "url", url);
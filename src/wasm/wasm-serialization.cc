@@ -4,6 +4,10 @@
 
 #include "src/wasm/wasm-serialization.h"
 
+#include <numeric>
+
+#include "src/base/hashing.h"
+#include "src/base/platform/wrappers.h"
 #include "src/codegen/assembler-arch.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/debug/debug.h"
@@ -15,6 +19,7 @@
 #include "src/wasm/function-compiler.h"
 #include "src/wasm/module-compiler.h"
 #include "src/wasm/module-decoder.h"
+#include "src/wasm/std-object-sizes.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-engine.h"
 #include "src/wasm/wasm-module.h"
@@ -30,6 +35,10 @@ constexpr uint8_t kLazyFunction = 2;
 constexpr uint8_t kEagerFunction = 3;
 constexpr uint8_t kTurboFanFunction = 4;
 
+// Replaces the magic number of snapshot data in the header of each chunk of
+// {IncrementalWasmSerializer} data.
+constexpr uint32_t kIncrementalMagicNumber = ~SerializedData::kMagicNumber;
+
 // TODO(bbudge) Try to unify the various implementations of readers and writers
 // in Wasm, e.g. StreamProcessor and ZoneBuffer, with these.
 class Writer {
@@ -151,9 +160,10 @@ size_t MeasureHeader(const CompileTimeImports& compile_imports) {
 }
 
 void WriteHeader(Writer* writer, WasmEnabledFeatures enabled_features,
-                 const CompileTimeImports& compile_imports) {
+                 const CompileTimeImports& compile_imports,
+                 uint32_t magic_number = SerializedData::kMagicNumber) {
   DCHECK_EQ(0, writer->bytes_written());
-  writer->Write(SerializedData::kMagicNumber);
+  writer->Write(magic_number);
   writer->Write(Version::Hash());
   writer->Write(static_cast<uint32_t>(CpuFeatures::SupportedFeatures()));
   writer->Write(FlagList::Hash());
@@ -165,6 +175,23 @@ void WriteHeader(Writer* writer, WasmEnabledFeatures enabled_features,
   DCHECK_EQ(MeasureHeader(compile_imports), writer->bytes_written());
 }
 
+// Following the data header, each chunk of incrementally serialized data
+// consists of (see {NativeModuleSerializer::WriteIncremental}):
+// [0] detected features (WasmDetectedFeatures::StorageType)
+// [1] all functions validated (bool)
+// [2] import statuses (WellKnownImport per imported function)
+// [3] number of function records (uint32_t)
+// followed by the function records.
+size_t MeasureChunkHeader(uint32_t num_imported_functions) {
+  return sizeof(WasmDetectedFeatures::StorageType) + sizeof(bool) +
+         num_imported_functions * sizeof(WellKnownImport) + sizeof(uint32_t);
+}
+
+// Each function record starts with its function index, the size of the rest
+// of the record, and the code size of the function (uint32_t each), followed
+// by the code as written by {NativeModuleSerializer::WriteCode}.
+constexpr size_t kFunctionRecordHeaderSize = 3 * sizeof(uint32_t);
+
 // On Intel, call sites are encoded as a displacement. For linking and for
 // serialization/deserialization, we want to store/retrieve a tag (the function
 // index). On Intel, that means accessing the raw displacement.
@@ -345,6 +372,12 @@ class V8_EXPORT_PRIVATE NativeModuleSerializer {
   size_t Measure() const;
   bool Write(Writer* writer);
 
+  // Same as above, but for a chunk of incrementally serialized data, which
+  // contains a record for each code object (all TurboFan code) instead of
+  // the full code table.
+  size_t MeasureIncremental() const;
+  bool WriteIncremental(Writer* writer);
+
  private:
   size_t MeasureCode(const WasmCode*) const;
   void WriteHeader(Writer*, size_t total_code_size);
@@ -410,6 +443,15 @@ size_t NativeModuleSerializer::Measure() const {
   return size;
 }
 
+size_t NativeModuleSerializer::MeasureIncremental() const {
+  size_t size = MeasureHeader(native_module_->compile_imports()) +
+                MeasureChunkHeader(native_module_->num_imported_functions());
+  for (WasmCode* code : code_table_) {
+    size += kFunctionRecordHeaderSize + MeasureCode(code);
+  }
+  return size;
+}
+
 void NativeModuleSerializer::WriteHeader(Writer* writer,
                                          size_t total_code_size) {
   // TODO(eholk): We need to properly preserve the flag whether the trap
@@ -657,6 +699,28 @@ bool NativeModuleSerializer::Write(Writer* writer) {
   return true;
 }
 
+bool NativeModuleSerializer::WriteIncremental(Writer* writer) {
+  DCHECK(!write_called_);
+  write_called_ = true;
+
+  writer->Write(
+      native_module_->compilation_state()->detected_features().ToIntegral());
+  writer->Write(!v8_flags.wasm_lazy_validation);
+  writer->WriteVector(base::VectorOf(import_statuses_));
+  writer->Write(static_cast<uint32_t>(code_table_.size()));
+
+  NativeModule::CallIndirectTargetMap function_index_map =
+      native_module_->CreateIndirectCallTargetToFunctionIndexMap();
+  for (WasmCode* code : code_table_) {
+    DCHECK_EQ(ExecutionTier::kTurbofan, code->tier());
+    writer->Write(static_cast<uint32_t>(code->index()));
+    writer->Write(static_cast<uint32_t>(MeasureCode(code)));
+    writer->Write(static_cast<uint32_t>(code->instructions().size()));
+    WriteCode(code, writer, function_index_map);
+  }
+  return num_turbofan_functions_ > 0;
+}
+
 WasmSerializer::WasmSerializer(NativeModule* native_module)
     : native_module_(native_module) {
   std::tie(code_table_, import_statuses_) = native_module->SnapshotCodeTable();
@@ -683,6 +747,36 @@ bool WasmSerializer::SerializeNativeModule(base::Vector<uint8_t> buffer) const {
   return true;
 }
 
+IncrementalWasmSerializer::IncrementalWasmSerializer(
+    NativeModule* native_module)
+    : native_module_(native_module) {
+  std::tie(new_code_, import_statuses_) =
+      native_module->SnapshotNewTurbofanCode();
+}
+
+size_t IncrementalWasmSerializer::GetSerializedSize() const {
+  if (new_code_.empty()) return 0;
+  NativeModuleSerializer serializer(native_module_, base::VectorOf(new_code_),
+                                    base::VectorOf(import_statuses_));
+  return serializer.MeasureIncremental();
+}
+
+bool IncrementalWasmSerializer::Serialize(base::Vector<uint8_t> buffer) const {
+  if (new_code_.empty()) return false;
+  NativeModuleSerializer serializer(native_module_, base::VectorOf(new_code_),
+                                    base::VectorOf(import_statuses_));
+  size_t measured_size = serializer.MeasureIncremental();
+  if (buffer.size() < measured_size) return false;
+
+  Writer writer(buffer);
+  WriteHeader(&writer, native_module_->enabled_features(),
+              native_module_->compile_imports(), kIncrementalMagicNumber);
+
+  if (!serializer.WriteIncremental(&writer)) return false;
+  DCHECK_EQ(measured_size, writer.bytes_written());
+  return true;
+}
+
 struct DeserializationUnit {
   base::Vector<const uint8_t> src_code_buffer;
   std::unique_ptr<WasmCode> code;
@@ -736,6 +830,10 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
 
   void Read(Reader* reader);
 
+  // Deserializes and publishes the code of a single function record of
+  // incrementally serialized data.
+  WasmCode* ReadSingleFunction(int fn_index, size_t code_size, Reader* reader);
+
   base::Vector<const int> lazy_functions() {
     return base::VectorOf(lazy_functions_);
   }
@@ -751,7 +849,7 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
   DeserializationUnit ReadCode(int fn_index, Reader* reader);
   void ReadTieringBudget(Reader* reader);
   void CopyAndRelocate(const DeserializationUnit& unit);
-  void Publish(std::vector<DeserializationUnit> batch);
+  std::vector<WasmCode*> Publish(std::vector<DeserializationUnit> batch);
 
   NativeModule* const native_module_;
 #ifdef DEBUG
@@ -897,6 +995,21 @@ void NativeModuleDeserializer::Read(Reader* reader) {
   CHECK_EQ(0, reader->current_size());
 }
 
+WasmCode* NativeModuleDeserializer::ReadSingleFunction(int fn_index,
+                                                      size_t code_size,
+                                                      Reader* reader) {
+  remaining_code_size_ = code_size;
+  DeserializationUnit unit = ReadCode(fn_index, reader);
+  // Only TurboFan code is written to incrementally serialized data.
+  CHECK_NOT_NULL(unit.code);
+  CHECK_EQ(0, reader->current_size());
+  DCHECK_EQ(0, remaining_code_size_);
+  CopyAndRelocate(unit);
+  std::vector<DeserializationUnit> batch;
+  batch.emplace_back(std::move(unit));
+  return Publish(std::move(batch))[0];
+}
+
 void NativeModuleDeserializer::ReadHeader(Reader* reader) {
   WasmDetectedFeatures detected_features = WasmDetectedFeatures::FromIntegral(
       reader->Read<WasmDetectedFeatures::StorageType>());
@@ -1091,7 +1204,8 @@ void NativeModuleDeserializer::ReadTieringBudget(Reader* reader) {
          size_of_tiering_budget);
 }
 
-void NativeModuleDeserializer::Publish(std::vector<DeserializationUnit> batch) {
+std::vector<WasmCode*> NativeModuleDeserializer::Publish(
+    std::vector<DeserializationUnit> batch) {
   DCHECK(!batch.empty());
   std::vector<UnpublishedWasmCode> codes;
   codes.reserve(batch.size());
@@ -1108,20 +1222,227 @@ void NativeModuleDeserializer::Publish(std::vector<DeserializationUnit> batch) {
     wasm_code->MaybePrint();
     wasm_code->Validate();
   }
+  return published_codes;
 }
 
 bool HeaderMatches(base::Vector<const uint8_t> data,
                    WasmEnabledFeatures enabled_features,
-                   const CompileTimeImports& compile_imports) {
+                   const CompileTimeImports& compile_imports,
+                   uint32_t magic_number = SerializedData::kMagicNumber) {
   size_t header_size = MeasureHeader(compile_imports);
   if (data.size() < header_size) return false;
   base::SmallVector<uint8_t, 32> current_header(header_size);
   Writer writer(base::VectorOf(current_header));
-  WriteHeader(&writer, enabled_features, compile_imports);
+  WriteHeader(&writer, enabled_features, compile_imports, magic_number);
   DCHECK_EQ(header_size, writer.bytes_written());
   return base::VectorOf(current_header) == data.SubVector(0, header_size);
 }
 
+LazilyDeserializedCode::LazilyDeserializedCode(
+    base::OwnedVector<const uint8_t> owned_data,
+    std::unique_ptr<base::OS::MemoryMappedFile> file)
+    : owned_data_(std::move(owned_data)), file_(std::move(file)) {
+  data_ = file_ ? base::Vector<const uint8_t>(
+                      static_cast<const uint8_t*>(file_->memory()),
+                      file_->size())
+                : owned_data_.as_vector();
+}
+
+// static
+std::unique_ptr<LazilyDeserializedCode> LazilyDeserializedCode::New(
+    NativeModule* native_module, base::Vector<const uint8_t> data) {
+  std::unique_ptr<LazilyDeserializedCode> result(
+      new LazilyDeserializedCode(base::OwnedCopyOf(data), nullptr));
+  result->IndexFunctionRecords(native_module);
+  return result;
+}
+
+// static
+std::unique_ptr<LazilyDeserializedCode> LazilyDeserializedCode::NewFromFile(
+    NativeModule* native_module,
+    std::unique_ptr<base::OS::MemoryMappedFile> file) {
+  std::unique_ptr<LazilyDeserializedCode> result(
+      new LazilyDeserializedCode({}, std::move(file)));
+  result->IndexFunctionRecords(native_module);
+  return result;
+}
+
+void LazilyDeserializedCode::IndexFunctionRecords(
+    NativeModule* native_module) {
+  const WasmModule* module = native_module->module();
+  const uint32_t num_imported = module->num_imported_functions;
+  const size_t header_size = MeasureHeader(native_module->compile_imports());
+  base::Vector<const WellKnownImport> import_statuses;
+  bool first_chunk = true;
+  bool all_functions_validated = true;
+  Reader reader(data_);
+  while (reader.current_size() > 0) {
+    if (!HeaderMatches(reader.current_buffer(),
+                       native_module->enabled_features(),
+                       native_module->compile_imports(),
+                       kIncrementalMagicNumber)) {
+      break;
+    }
+    reader.Skip(header_size);
+    if (reader.current_size() < MeasureChunkHeader(num_imported)) break;
+    WasmDetectedFeatures detected_features = WasmDetectedFeatures::FromIntegral(
+        reader.Read<WasmDetectedFeatures::StorageType>());
+    bool chunk_validated = reader.Read<bool>();
+    base::Vector<const WellKnownImport> chunk_import_statuses =
+        reader.ReadVector<WellKnownImport>(num_imported);
+    uint32_t num_functions = reader.Read<uint32_t>();
+
+    // Only add the records of a chunk once it turned out to be complete, as
+    // the data might have been cut off while appending a chunk.
+    std::vector<std::pair<int, FunctionRecord>> records;
+    for (uint32_t i = 0; i < num_functions; ++i) {
+      if (reader.current_size() < kFunctionRecordHeaderSize) break;
+      uint32_t func_index = reader.Read<uint32_t>();
+      uint32_t size = reader.Read<uint32_t>();
+      uint32_t code_size = reader.Read<uint32_t>();
+      if (reader.current_size() < size) break;
+      CHECK_LE(num_imported, func_index);
+      CHECK_LT(func_index, native_module->num_functions());
+      FunctionRecord record{reader.bytes_read(), size, code_size};
+      records.emplace_back(func_index, record);
+      reader.Skip(size);
+    }
+    if (records.size() != num_functions) break;
+
+    // The code of a chunk may depend on import statuses that the code of the
+    // first chunk does not hold for, e.g. if it was written by another
+    // process that instantiated the module with other imports.
+    if (!first_chunk && !(chunk_import_statuses == import_statuses)) continue;
+    if (first_chunk && num_imported > 0) {
+      module->type_feedback.well_known_imports.Initialize(
+          chunk_import_statuses);
+    }
+    import_statuses = chunk_import_statuses;
+    first_chunk = false;
+    all_functions_validated &= chunk_validated;
+    // Ignore the return value of UpdateDetectedFeatures; all features will be
+    // published after deserialization anyway.
+    USE(native_module->compilation_state()->UpdateDetectedFeatures(
+        detected_features));
+    functions_.insert(records.begin(), records.end());
+  }
+  if (!first_chunk && all_functions_validated) {
+    module->set_all_functions_validated();
+  }
+}
+
+WasmCode* LazilyDeserializedCode::Deserialize(NativeModule* native_module,
+                                              int func_index) const {
+  auto it = functions_.find(func_index);
+  if (it == functions_.end()) return nullptr;
+  const FunctionRecord& record = it->second;
+  NativeModuleDeserializer deserializer(native_module);
+  Reader reader(data_.as_vector().SubVector(record.offset,
+                                            record.offset + record.size));
+  return deserializer.ReadSingleFunction(func_index, record.code_size,
+                                         &reader);
+}
+
+size_t LazilyDeserializedCode::EstimateCurrentMemoryConsumption() const {
+  UPDATE_WHEN_CLASS_CHANGES(LazilyDeserializedCode, 80);
+  // Mapped data is not accounted for, as it is shared with other processes.
+  return sizeof(LazilyDeserializedCode) + ContentSize(owned_data_) +
+         ContentSize(functions_);
+}
+
+namespace {
+
+void InitializeForLazyDeserialization(
+    NativeModule* native_module, std::unique_ptr<LazilyDeserializedCode> code) {
+  native_module->SetLazilyDeserializedCode(std::move(code));
+  // All functions start out lazy; those with a function record are
+  // deserialized instead of compiled on their first call.
+  std::vector<int> lazy_functions(native_module->num_declared_functions());
+  std::iota(lazy_functions.begin(), lazy_functions.end(),
+            native_module->num_imported_functions());
+  native_module->compilation_state()->InitializeAfterDeserialization(
+      base::VectorOf(lazy_functions), {});
+}
+
+class AppendToCodeCacheFileCallback : public CompilationEventCallback {
+ public:
+  explicit AppendToCodeCacheFileCallback(
+      std::weak_ptr<NativeModule> native_module)
+      : native_module_(std::move(native_module)) {}
+
+  void call(CompilationEvent event) override {
+    if (event != CompilationEvent::kFinishedCompilationChunk) return;
+    if (std::shared_ptr<NativeModule> native_module = native_module_.lock()) {
+      AppendToCodeCacheFile(native_module.get());
+    }
+  }
+
+  ReleaseAfterFinalEvent release_after_final_event() override {
+    return kKeepAfterFinalEvent;
+  }
+
+ private:
+  const std::weak_ptr<NativeModule> native_module_;
+};
+
+}  // namespace
+
+std::string CodeCacheFilePath(const NativeModule* native_module) {
+  DCHECK_NOT_NULL(v8_flags.experimental_wasm_code_cache_dir.value());
+  // A chunk with a mismatching data header ends the data of a file, so
+  // processes with a different configuration use different files.
+  const CompileTimeImports& compile_imports = native_module->compile_imports();
+  size_t configuration_hash =
+      base::Hasher{}
+          .Add(Version::Hash())
+          .Add(FlagList::Hash())
+          .Add(compile_imports.flags().ToIntegral())
+          .AddRange(compile_imports.constants_module())
+          .hash();
+  base::EmbeddedVector<char, 64> filename;
+  SNPrintF(filename, "wasm-code-%zx-%zx",
+           GetWireBytesHash(native_module->wire_bytes()), configuration_hash);
+  return std::string(v8_flags.experimental_wasm_code_cache_dir) + "/" +
+         filename.begin();
+}
+
+bool UseCodeCacheFile(NativeModule* native_module) {
+  std::string path = CodeCacheFilePath(native_module);
+  std::unique_ptr<base::OS::MemoryMappedFile> file(
+      base::OS::MemoryMappedFile::open(
+          path.c_str(), base::OS::MemoryMappedFile::FileMode::kReadOnly));
+  if (!file) return false;
+  std::unique_ptr<LazilyDeserializedCode> code =
+      LazilyDeserializedCode::NewFromFile(native_module, std::move(file));
+  if (code->empty()) return false;
+  InitializeForLazyDeserialization(native_module, std::move(code));
+  return true;
+}
+
+void AppendToCodeCacheFile(NativeModule* native_module) {
+  IncrementalWasmSerializer serializer(native_module);
+  size_t size = serializer.GetSerializedSize();
+  if (size == 0) return;
+  base::OwnedVector<uint8_t> buffer =
+      base::OwnedVector<uint8_t>::NewForOverwrite(size);
+  if (!serializer.Serialize(buffer.as_vector())) return;
+
+  std::string path = CodeCacheFilePath(native_module);
+  FILE* file = base::OS::FOpen(path.c_str(), "ab");
+  if (!file) return;
+  // Append the chunk with a single unbuffered write, so that it does not
+  // interleave with chunks that other processes append at the same time.
+  setvbuf(file, nullptr, _IONBF, 0);
+  USE(fwrite(buffer.begin(), 1, buffer.size(), file));
+  base::Fclose(file);
+}
+
+void AppendToCodeCacheFileOnTierUp(
+    const std::shared_ptr<NativeModule>& native_module) {
+  native_module->compilation_state()->AddCallback(
+      std::make_unique<AppendToCodeCacheFileCallback>(native_module));
+}
+
 MaybeDirectHandle<WasmModuleObject> DeserializeNativeModule(
     Isolate* isolate, WasmEnabledFeatures enabled_features,
     base::Vector<const uint8_t> data,
@@ -1129,7 +1450,12 @@ MaybeDirectHandle<WasmModuleObject> DeserializeNativeModule(
     const CompileTimeImports& compile_imports,
     base::Vector<const char> source_url) {
   if (!IsWasmCodegenAllowed(isolate, isolate->native_context())) return {};
-  if (!HeaderMatches(data, enabled_features, compile_imports)) return {};
+  const bool incremental = HeaderMatches(data, enabled_features,
+                                         compile_imports,
+                                         kIncrementalMagicNumber);
+  if (!incremental && !HeaderMatches(data, enabled_features, compile_imports)) {
+    return {};
+  }
 
   WasmDetectedFeatures detected_features;
   ModuleResult decode_result = DecodeWasmModule(
@@ -1163,11 +1489,18 @@ MaybeDirectHandle<WasmModuleObject> DeserializeNativeModule(
     shared_native_module->compilation_state()->set_compilation_id(-2);
     shared_native_module->SetWireBytes(std::move(wire_bytes_vec));
 
-    NativeModuleDeserializer deserializer(shared_native_module.get());
-    Reader reader(data + MeasureHeader(compile_imports));
-    deserializer.Read(&reader);
-    shared_native_module->compilation_state()->InitializeAfterDeserialization(
-        deserializer.lazy_functions(), deserializer.eager_functions());
+    if (incremental) {
+      InitializeForLazyDeserialization(
+          shared_native_module.get(),
+          LazilyDeserializedCode::New(shared_native_module.get(), data));
+    } else {
+      NativeModuleDeserializer deserializer(shared_native_module.get());
+      Reader reader(data + MeasureHeader(compile_imports));
+      deserializer.Read(&reader);
+      shared_native_module->compilation_state()
+          ->InitializeAfterDeserialization(deserializer.lazy_functions(),
+                                           deserializer.eager_functions());
+    }
     wasm_engine->UpdateNativeModuleCache(false /* error */,
                                          shared_native_module, isolate);
     // Now publish the full set of detected features (read during
@@ -9,6 +9,10 @@
 #error This header should only be included if WebAssembly is enabled.
 #endif  // !V8_ENABLE_WEBASSEMBLY
 
+#include <string>
+#include <unordered_map>
+
+#include "src/base/platform/platform.h"
 #include "src/wasm/wasm-code-manager.h"
 
 namespace v8::internal::wasm {
@@ -44,7 +48,109 @@ class V8_EXPORT_PRIVATE WasmSerializer {
   std::vector<WellKnownImport> import_statuses_;
 };
 
+// Support for serializing the TurboFan code of a {NativeModule} as it becomes
+// available. Each instance takes the code of all functions that reached
+// TurboFan and were not taken by an earlier instance for the same module, so
+// the results of consecutive instances can be appended to each other. Each
+// result is a chunk that starts with the same data header as {WasmSerializer}
+// data (but a different magic number), followed by one record per function.
+// Such data is deserialized lazily: the code of a function is only
+// deserialized when the function is called first.
+class V8_EXPORT_PRIVATE IncrementalWasmSerializer {
+ public:
+  explicit IncrementalWasmSerializer(NativeModule* native_module);
+
+  // Measure the required buffer size needed for serialization. Returns 0 if
+  // there is no new code to serialize.
+  size_t GetSerializedSize() const;
+
+  // Serialize the new code into the provided {buffer}. Returns true on
+  // success and false if there is no new code or the given buffer is too
+  // small. The code is not handed out to later instances either way.
+  bool Serialize(base::Vector<uint8_t> buffer) const;
+
+ private:
+  NativeModule* native_module_;
+  // The {WasmCodeRefScope} keeps the pointers in {new_code_} alive.
+  WasmCodeRefScope code_ref_scope_;
+  std::vector<WasmCode*> new_code_;
+  std::vector<WellKnownImport> import_statuses_;
+};
+
+// The function records of {IncrementalWasmSerializer} data that a module was
+// deserialized from. Owned by the {NativeModule}, which deserializes the code
+// of a function from here on its first call instead of compiling it.
+class LazilyDeserializedCode {
+ public:
+  // Indexes the function records of all chunks in a copy of {data}. Chunks
+  // with import statuses that differ from those of the first chunk are
+  // skipped. A chunk that was written with a different configuration ends
+  // the data, as does a truncated chunk.
+  static std::unique_ptr<LazilyDeserializedCode> New(
+      NativeModule* native_module, base::Vector<const uint8_t> data);
+
+  // Same as above, but for the data of {file}, which is used in place instead
+  // of copied.
+  static std::unique_ptr<LazilyDeserializedCode> NewFromFile(
+      NativeModule* native_module,
+      std::unique_ptr<base::OS::MemoryMappedFile> file);
+
+  bool empty() const { return functions_.empty(); }
+  bool Contains(int func_index) const {
+    return functions_.contains(func_index);
+  }
+
+  // Deserializes and publishes the code of {func_index}. Returns nullptr if
+  // there is no record for the function.
+  WasmCode* Deserialize(NativeModule* native_module, int func_index) const;
+
+  size_t EstimateCurrentMemoryConsumption() const;
+
+ private:
+  struct FunctionRecord {
+    size_t offset;
+    uint32_t size;
+    uint32_t code_size;
+  };
+
+  LazilyDeserializedCode(base::OwnedVector<const uint8_t> owned_data,
+                         std::unique_ptr<base::OS::MemoryMappedFile> file);
+
+  void IndexFunctionRecords(NativeModule* native_module);
+
+  // The data is either owned or mapped from a file.
+  base::OwnedVector<const uint8_t> owned_data_;
+  std::unique_ptr<base::OS::MemoryMappedFile> file_;
+  base::Vector<const uint8_t> data_;
+  std::unordered_map<int, FunctionRecord> functions_;
+};
+
+// With --experimental-wasm-code-cache-dir, processes share the TurboFan code
+// of a module through one file per module in that directory. As functions
+// tier up, every process appends {IncrementalWasmSerializer} chunks to the
+// file. A process that compiles the module later maps the file read-only and
+// deserializes functions from it lazily, so all processes on a host read the
+// same physical copy of the data.
+V8_EXPORT_PRIVATE std::string CodeCacheFilePath(
+    const NativeModule* native_module);
+
+// Makes {native_module} deserialize its functions lazily from its code cache
+// file. Returns false if the file does not exist or contains no usable code;
+// the module has to be compiled then.
+bool UseCodeCacheFile(NativeModule* native_module);
+
+// Appends the TurboFan code of {native_module} that is not in its code cache
+// file yet to the file.
+V8_EXPORT_PRIVATE void AppendToCodeCacheFile(NativeModule* native_module);
+
+// Makes {native_module} append to its code cache file whenever more of its
+// functions can be serialized.
+void AppendToCodeCacheFileOnTierUp(
+    const std::shared_ptr<NativeModule>& native_module);
+
 // Deserializes the given data to create a Wasm module object.
+// The data can be the result of a {WasmSerializer}, or the concatenated results
+// of {IncrementalWasmSerializer}s.
 // On successful deserialization, ownership of the `wire_bytes` vector is taken
 // over by the deserialized module (the parameter will be reset to an empty
 // vector); otherwise ownership stays with the caller.
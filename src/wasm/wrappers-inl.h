@@ -332,8 +332,11 @@ auto WasmWrapperTSGraphBuilder<Assembler>::BuildJSToWasmWrapperImpl(
   base::SmallVector<OpIndex, 16> args(args_count);
   args[0] = instance_data;
   for (int i = 0; i < wasm_param_count; ++i) {
-    args[i + 1] = FromJS(params[i], js_context, sig_->GetParam(i), frame_state,
-                         lazy_deopt_on_throw);
+    OpIndex untagged = TryFromUntaggedJS(params[i], sig_->GetParam(i));
+    args[i + 1] = untagged.valid()
+                      ? untagged
+                      : FromJS(params[i], js_context, sig_->GetParam(i),
+                               frame_state, lazy_deopt_on_throw);
   }
 
   // Inline the wasm function, if possible.
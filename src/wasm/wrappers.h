@@ -52,6 +52,9 @@ class WasmWrapperTSGraphBuilder : public WasmGraphBuilderBase<Assembler> {
   using typename WasmGraphBuilderBase<Assembler>::Any;
 
   using CallDescriptor = compiler::CallDescriptor;
+  using CheckForMinusZeroMode = compiler::CheckForMinusZeroMode;
+  using ConvertUntaggedToJSPrimitiveOp =
+      compiler::turboshaft::ConvertUntaggedToJSPrimitiveOp;
   using Operator = compiler::Operator;
   using Float32 = compiler::turboshaft::Float32;
   using Float64 = compiler::turboshaft::Float64;
@@ -397,6 +400,73 @@ class WasmWrapperTSGraphBuilder : public WasmGraphBuilderBase<Assembler> {
   }
 #endif
 
+  // When the wrapper is inlined into JS, numbers are often only boxed for the
+  // call, e.g. the elements loaded from a typed array. Returns the untagged
+  // Wasm value of such an {input} without boxing and unboxing it, or an
+  // invalid index if the generic conversion of {FromJS} is needed.
+  OpIndex TryFromUntaggedJS(V<Object> input, CanonicalValueType type) {
+    using Kind = ConvertUntaggedToJSPrimitiveOp::JSPrimitiveKind;
+    using Interpretation = ConvertUntaggedToJSPrimitiveOp::InputInterpretation;
+    if (!is_inlining_into_js_ || !type.is_numeric()) return OpIndex::Invalid();
+    const ConvertUntaggedToJSPrimitiveOp* convert =
+        __ output_graph()
+            .Get(input)
+            .template TryCast<ConvertUntaggedToJSPrimitiveOp>();
+    if (!convert) return OpIndex::Invalid();
+    NumericKind kind = type.numeric_kind();
+    if (convert->input_rep == RegisterRepresentation::Word32()) {
+      if (convert->kind != Kind::kNumber && convert->kind != Kind::kSmi &&
+          convert->kind != Kind::kHeapNumber) {
+        return OpIndex::Invalid();
+      }
+      V<Word32> value = convert->input<Word32>();
+      V<Float64> as_float64;
+      switch (convert->input_interpretation) {
+        case Interpretation::kSigned:
+          if (kind == NumericKind::kI32) return value;
+          as_float64 = __ ChangeInt32ToFloat64(value);
+          break;
+        case Interpretation::kUnsigned:
+          // ToInt32 of a uint32 number has the same bit pattern.
+          if (kind == NumericKind::kI32) return value;
+          as_float64 = __ ChangeUint32ToFloat64(value);
+          break;
+        default:
+          return OpIndex::Invalid();
+      }
+      if (kind == NumericKind::kF64) return as_float64;
+      if (kind == NumericKind::kF32) {
+        return __ TruncateFloat64ToFloat32(as_float64);
+      }
+      return OpIndex::Invalid();
+    }
+    if (convert->input_rep == RegisterRepresentation::Float64()) {
+      // A number conversion that does not check for -0 turns it into the Smi
+      // 0, which Wasm has to see as +0.
+      bool preserves_value =
+          convert->kind == Kind::kHeapNumber ||
+          (convert->kind == Kind::kNumber &&
+           convert->minus_zero_mode ==
+               CheckForMinusZeroMode::kCheckForMinusZero);
+      if (!preserves_value ||
+          convert->input_interpretation != Interpretation::kDouble) {
+        return OpIndex::Invalid();
+      }
+      V<Float64> value = convert->input<Float64>();
+      switch (kind) {
+        case NumericKind::kI32:
+          return __ JSTruncateFloat64ToWord32(value);
+        case NumericKind::kF32:
+          return __ TruncateFloat64ToFloat32(value);
+        case NumericKind::kF64:
+          return value;
+        default:
+          return OpIndex::Invalid();
+      }
+    }
+    return OpIndex::Invalid();
+  }
+
   OpIndex FromJS(V<Object> input, OpIndex context, CanonicalValueType type,
                  OptionalOpIndex frame_state = {},
                  compiler::LazyDeoptOnThrow lazy_deopt_on_throw =
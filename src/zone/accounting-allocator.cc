@@ -4,11 +4,15 @@
 
 #include "src/zone/accounting-allocator.h"
 
+#include <algorithm>
+#include <array>
 #include <memory>
 
+#include "src/base/bits.h"
 #include "src/base/bounded-page-allocator.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
 #include "src/heap/memory-pool.h"
@@ -86,10 +90,134 @@ class ManagedZones final {
 
 }  // namespace
 
+// Caches returned malloc()ed segments by size class, so that the zones of the
+// next compilation jobs do not have to go through malloc() and fresh pages
+// again. Size classes are the powers of two between the minimum zone segment
+// size and kMaxPooledSegmentSize, which also covers the large segments of
+// zones that outgrow the regular segment sizes.
+//
+// The pool holds at most --zone-segment-pool-max-size-kb bytes. Memory that
+// has stayed in the pool since the previous trim was not needed to serve any
+// allocation in between and is released on the next trim.
+class AccountingAllocator::SegmentPool final {
+ public:
+  static constexpr size_t kMinPooledSegmentSize = 8 * KB;
+  static constexpr size_t kMaxPooledSegmentSize = 1 * MB;
+
+  explicit SegmentPool(size_t max_pooled_bytes)
+      : max_pooled_bytes_(max_pooled_bytes) {}
+  SegmentPool(const SegmentPool&) = delete;
+  SegmentPool& operator=(const SegmentPool&) = delete;
+  ~SegmentPool() { ReleaseAll(); }
+
+  // Returns the size to request from malloc() for |bytes|, or 0 if segments
+  // of that size are not pooled.
+  static size_t PooledSize(size_t bytes) {
+    if (bytes > kMaxPooledSegmentSize) return 0;
+    return std::max(kMinPooledSegmentSize,
+                    base::bits::RoundUpToPowerOfTwo(bytes));
+  }
+
+  // Returns a pooled segment of at least |bytes|, which must be a size class.
+  base::AllocationResult<void*> Get(size_t bytes) {
+    base::MutexGuard guard(&mutex_);
+    FreeSegment*& head = free_lists_[SizeClass(bytes)];
+    if (head == nullptr) return {nullptr, 0};
+    FreeSegment* segment = head;
+    head = segment->next;
+    pooled_bytes_ -= segment->size;
+    low_water_mark_ = std::min(low_water_mark_, pooled_bytes_);
+    return {segment, segment->size};
+  }
+
+  // Takes |memory| of |bytes| into the pool. Returns false if the pool is
+  // full, in which case the caller has to free it.
+  bool Put(void* memory, size_t bytes) {
+    if (bytes < kMinPooledSegmentSize || bytes > kMaxPooledSegmentSize) {
+      return false;
+    }
+    base::MutexGuard guard(&mutex_);
+    if (pooled_bytes_ + bytes > max_pooled_bytes_) return false;
+    // Segments larger than their size class, e.g. because malloc() handed
+    // out more than requested, are filed under the class they fully cover.
+    FreeSegment*& head =
+        free_lists_[SizeClass(base::bits::RoundDownToPowerOfTwo32(
+            static_cast<uint32_t>(bytes)))];
+    head = new (memory) FreeSegment{head, bytes};
+    pooled_bytes_ += bytes;
+    return true;
+  }
+
+  void Trim() {
+    base::MutexGuard guard(&mutex_);
+    size_t bytes_to_release = low_water_mark_;
+    // Release the largest segments first; they are the rarest to be reused.
+    for (size_t i = kNumSizeClasses; i > 0 && bytes_to_release > 0; i--) {
+      FreeSegment*& head = free_lists_[i - 1];
+      while (head != nullptr && bytes_to_release > 0) {
+        FreeSegment* segment = head;
+        head = segment->next;
+        bytes_to_release -= std::min(bytes_to_release, segment->size);
+        pooled_bytes_ -= segment->size;
+        free(segment);
+      }
+    }
+    low_water_mark_ = pooled_bytes_;
+  }
+
+  void ReleaseAll() {
+    base::MutexGuard guard(&mutex_);
+    for (FreeSegment*& head : free_lists_) {
+      while (head != nullptr) {
+        FreeSegment* segment = head;
+        head = segment->next;
+        free(segment);
+      }
+    }
+    pooled_bytes_ = 0;
+    low_water_mark_ = 0;
+  }
+
+  size_t pooled_bytes() const {
+    base::MutexGuard guard(&mutex_);
+    return pooled_bytes_;
+  }
+
+ private:
+  static constexpr size_t kNumSizeClasses =
+      base::bits::WhichPowerOfTwo(kMaxPooledSegmentSize) -
+      base::bits::WhichPowerOfTwo(kMinPooledSegmentSize) + 1;
+
+  struct FreeSegment {
+    FreeSegment* next;
+    size_t size;
+  };
+
+  static size_t SizeClass(size_t size) {
+    DCHECK(base::bits::IsPowerOfTwo(size));
+    DCHECK_LE(kMinPooledSegmentSize, size);
+    DCHECK_LE(size, kMaxPooledSegmentSize);
+    return base::bits::WhichPowerOfTwo(size) -
+           base::bits::WhichPowerOfTwo(kMinPooledSegmentSize);
+  }
+
+  const size_t max_pooled_bytes_;
+  mutable base::Mutex mutex_;
+  std::array<FreeSegment*, kNumSizeClasses> free_lists_{};
+  size_t pooled_bytes_ = 0;
+  // Lowest value of |pooled_bytes_| since the previous trim.
+  size_t low_water_mark_ = 0;
+};
+
 AccountingAllocator::AccountingAllocator() : AccountingAllocator(nullptr) {}
 
 AccountingAllocator::AccountingAllocator(Isolate* isolate)
-    : isolate_(isolate) {}
+    : isolate_(isolate) {
+  if (v8_flags.zone_segment_pool) {
+    segment_pool_ = std::make_unique<SegmentPool>(
+        v8_flags.zone_segment_pool_max_size_kb * KB);
+  }
+}
 
 AccountingAllocator::~AccountingAllocator() = default;
 
@@ -97,6 +225,10 @@ Segment* AccountingAllocator::AllocateSegment(size_t requested_bytes) {
   base::AllocationResult<void*> memory;
   if (v8_flags.managed_zone_memory && isolate_) {
     memory = ManagedZones::AllocateSegment(isolate_, requested_bytes);
+  } else if (segment_pool_ && SegmentPool::PooledSize(requested_bytes) != 0) {
+    const size_t pooled_size = SegmentPool::PooledSize(requested_bytes);
+    memory = segment_pool_->Get(pooled_size);
+    if (memory.ptr == nullptr) memory = AllocAtLeastWithRetry(pooled_size);
   } else {
     memory = AllocAtLeastWithRetry(requested_bytes);
   }
@@ -123,10 +255,22 @@ void AccountingAllocator::ReturnSegment(Segment* segment) {
   segment->ZapHeader();
   if (isolate_ && v8_flags.managed_zone_memory) {
     ManagedZones::ReturnSegment(isolate_, segment, segment_size);
-  } else {
+  } else if (!segment_pool_ || !segment_pool_->Put(segment, segment_size)) {
     free(segment);
   }
 }
 
+size_t AccountingAllocator::GetPooledMemory() const {
+  return segment_pool_ ? segment_pool_->pooled_bytes() : 0;
+}
+
+void AccountingAllocator::TrimSegmentPool() {
+  if (segment_pool_) segment_pool_->Trim();
+}
+
+void AccountingAllocator::ReleaseSegmentPool() {
+  if (segment_pool_) segment_pool_->ReleaseAll();
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -48,6 +48,17 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  // Bytes held by the segment pool, see --zone-segment-pool. Not included in
+  // the current memory usage.
+  size_t GetPooledMemory() const;
+
+  // Releases the pooled segments that have not been reused since the previous
+  // call.
+  void TrimSegmentPool();
+
+  // Releases all pooled segments.
+  void ReleaseSegmentPool();
+
   void TraceZoneCreation(const Zone* zone) {
     if (V8_LIKELY(!TracingFlags::is_zone_stats_enabled())) return;
     TraceZoneCreationImpl(zone);
@@ -71,7 +82,10 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   Isolate* isolate() const { return isolate_; }
 
  private:
+  class SegmentPool;
+
   Isolate* const isolate_ = nullptr;
+  std::unique_ptr<SegmentPool> segment_pool_;
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
 };
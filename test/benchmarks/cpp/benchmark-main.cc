@@ -10,6 +10,8 @@
 int main(int argc, char** argv) {
   v8::V8::InitializeICUDefaultLocation(argv[0]);
   v8::V8::InitializeExternalStartupData(argv[0]);
+  // V8 flags are taken out, the rest is left for the benchmark library.
+  v8::V8::SetFlagsFromCommandLine(&argc, argv, true);
 
   v8::benchmarking::BenchmarkWithIsolate::InitializeProcess();
   // Contents of BENCHMARK_MAIN().
@@ -0,0 +1,253 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Allocation and garbage collection paths of the V8 heap, one at a time:
+// young generation allocation, the write barrier, minor GC pauses, external
+// pointer table entries and the string table.
+//
+// V8 flags given on the command line apply, e.g. --minor-ms to measure the
+// minor mark-sweeper instead of the scavenger, or --shared-string-table to
+// make the string table threads contend on one table. Results are reported
+// as JSON with --benchmark_format=json or --benchmark_out=<file>.
+
+#include <cstdio>
+#include <memory>
+
+#include "include/v8-array-buffer.h"
+#include "include/v8-context.h"
+#include "include/v8-external.h"
+#include "include/v8-function.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-persistent-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "src/base/macros.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+// Elements stored or objects allocated per call into JavaScript.
+constexpr int kBatchSize = 1000;
+
+constexpr char kHeapHelpers[] = R"(
+  function allocate(n) {
+    let o;
+    for (let i = 0; i < n; i++) o = {value: i};
+    return o;
+  }
+  function makeArray(n) {
+    const array = new Array(n);
+    for (let i = 0; i < n; i++) array[i] = {value: i};
+    return array;
+  }
+  function churn(n, window) {
+    const retained = new Array(window);
+    for (let i = 0; i < n; i++) retained[i % window] = {value: i};
+    return retained;
+  }
+  function storeInto(array) {
+    for (let i = 0; i < array.length; i++) array[i] = {value: i};
+    return array;
+  }
+)";
+
+v8::Local<v8::String> v8_str(v8::Isolate* isolate, const char* x) {
+  return v8::String::NewFromUtf8(isolate, x).ToLocalChecked();
+}
+
+class HeapBenchmark : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    v8::Isolate* isolate = v8_isolate();
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    context->Enter();
+    v8::Script::Compile(context, v8_str(isolate, kHeapHelpers))
+        .ToLocalChecked()
+        ->Run(context)
+        .ToLocalChecked();
+    context_.Reset(isolate, context);
+  }
+
+  void TearDown(::benchmark::State& state) override {
+    v8::HandleScope handle_scope(v8_isolate());
+    context_.Get(v8_isolate())->Exit();
+    context_.Reset();
+  }
+
+ protected:
+  v8::Local<v8::Context> v8_context() { return context_.Get(v8_isolate()); }
+
+  // Calls the global helper |name| with |argument|.
+  v8::Local<v8::Value> CallHelper(const char* name,
+                                  v8::Local<v8::Value> argument) {
+    v8::Local<v8::Context> context = v8_context();
+    v8::Local<v8::Function> function =
+        context->Global()
+            ->Get(context, v8_str(v8_isolate(), name))
+            .ToLocalChecked()
+            .As<v8::Function>();
+    return function->Call(context, context->Global(), 1, &argument)
+        .ToLocalChecked();
+  }
+
+  v8::Local<v8::Value> Int(int value) {
+    return v8::Integer::New(v8_isolate(), value);
+  }
+
+  v8::Global<v8::Context> context_;
+};
+
+// Young generation allocation of small objects, including the minor GCs the
+// allocation triggers.
+BENCHMARK_F(HeapBenchmark, YoungAllocation)(benchmark::State& st) {
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope handle_scope(v8_isolate());
+    benchmark::DoNotOptimize(CallHelper("allocate", Int(kBatchSize)));
+  }
+  st.SetItemsProcessed(st.iterations() * kBatchSize);
+}
+
+// Stores of young objects into an array, with range(0) selecting whether
+// the array is itself young or was promoted to the old generation. Only
+// stores into the old array take the slow path of the write barrier, so the
+// difference between the two is its cost.
+BENCHMARK_DEFINE_F(HeapBenchmark, WriteBarrier)(benchmark::State& st) {
+  const bool old_host = st.range(0) != 0;
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Value> array = CallHelper("makeArray", Int(kBatchSize));
+  if (old_host) {
+    for (int i = 0; i < 2; ++i) {
+      v8_isolate()->RequestGarbageCollectionForTesting(
+          v8::Isolate::kFullGarbageCollection);
+    }
+  }
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    benchmark::DoNotOptimize(
+        old_host ? CallHelper("storeInto", array)
+                 : CallHelper("makeArray", Int(kBatchSize)));
+  }
+  st.SetItemsProcessed(st.iterations() * kBatchSize);
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, WriteBarrier)
+    ->ArgName("old_host")
+    ->Arg(0)
+    ->Arg(1);
+
+// Pause of a minor GC with range(0) live young objects. The live objects
+// are allocated afresh before each GC, since the GC promotes survivors.
+BENCHMARK_DEFINE_F(HeapBenchmark, MinorGCPause)(benchmark::State& st) {
+  const int live_objects = static_cast<int>(st.range(0));
+  v8::Global<v8::Value> live;
+  for (auto _ : st) {
+    USE(_);
+    st.PauseTiming();
+    {
+      v8::HandleScope handle_scope(v8_isolate());
+      live.Reset(v8_isolate(), CallHelper("makeArray", Int(live_objects)));
+    }
+    st.ResumeTiming();
+    v8_isolate()->RequestGarbageCollectionForTesting(
+        v8::Isolate::kMinorGarbageCollection);
+  }
+  live.Reset();
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, MinorGCPause)
+    ->ArgName("live_objects")
+    ->Arg(0)
+    ->Arg(1 << 10)
+    ->Arg(1 << 14)
+    ->Arg(1 << 17)
+    ->Unit(benchmark::kMicrosecond);
+
+// Allocation with range(0) objects kept alive at any time, each replaced by
+// a newer one as allocation goes on, so that minor GCs keep finding a share
+// of recent objects live. Run with and without --minor-ms, and with larger
+// young generations through --max-semi-space-size, to compare the minor
+// collectors where copying survivors gets expensive.
+BENCHMARK_DEFINE_F(HeapBenchmark, YoungSurvivors)(benchmark::State& st) {
+  constexpr int kObjectsPerCall = 1 << 16;
+  v8::HandleScope handle_scope(v8_isolate());
+  v8::Local<v8::Value> argv[] = {
+      Int(kObjectsPerCall), Int(static_cast<int>(st.range(0)))};
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope iteration_scope(v8_isolate());
+    v8::Local<v8::Context> context = v8_context();
+    v8::Local<v8::Function> churn =
+        context->Global()
+            ->Get(context, v8_str(v8_isolate(), "churn"))
+            .ToLocalChecked()
+            .As<v8::Function>();
+    benchmark::DoNotOptimize(
+        churn->Call(context, context->Global(), 2, argv).ToLocalChecked());
+  }
+  st.SetItemsProcessed(st.iterations() * kObjectsPerCall);
+}
+BENCHMARK_REGISTER_F(HeapBenchmark, YoungSurvivors)
+    ->ArgName("retained")
+    ->Arg(1 << 10)
+    ->Arg(1 << 14)
+    ->Arg(1 << 16)
+    ->Unit(benchmark::kMicrosecond);
+
+// v8::External values, each of which takes an external pointer table entry
+// when the sandbox is enabled.
+BENCHMARK_F(HeapBenchmark, ExternalPointerTableAllocation)
+(benchmark::State& st) {
+  static int target;
+  for (auto _ : st) {
+    USE(_);
+    v8::HandleScope handle_scope(v8_isolate());
+    for (int i = 0; i < kBatchSize; ++i) {
+      benchmark::DoNotOptimize(v8::External::New(v8_isolate(), &target));
+    }
+  }
+  st.SetItemsProcessed(st.iterations() * kBatchSize);
+}
+
+// Internalization of strings on st.threads() threads, each with an isolate
+// of its own. range(0) selects between inserting new strings and looking up
+// the same ones repeatedly.
+void BM_StringTable(benchmark::State& st) {
+  const bool insert = st.range(0) != 0;
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator(
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = allocator.get();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    char name[32];
+    int next = 0;
+    for (auto _ : st) {
+      USE(_);
+      v8::HandleScope handle_scope(isolate);
+      for (int i = 0; i < kBatchSize; ++i) {
+        // Thread indexes keep inserted strings apart between threads.
+        snprintf(name, sizeof(name), "s%d_%d", st.thread_index(),
+                 insert ? next++ : i);
+        benchmark::DoNotOptimize(
+            v8::String::NewFromUtf8(isolate, name,
+                                    v8::NewStringType::kInternalized)
+                .ToLocalChecked());
+      }
+    }
+  }
+  isolate->Dispose();
+  st.SetItemsProcessed(st.iterations() * kBatchSize);
+}
+BENCHMARK(BM_StringTable)
+    ->ArgName("insert")
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, 8)
+    ->UseRealTime();
+
+}  // namespace
@@ -0,0 +1,91 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Time to bring up a tenant isolate with the OpenCog bindings: from scratch,
+// from the OpenCog startup snapshot, and through the IsolateMesh with its
+// pool of warm isolates.
+
+#include <memory>
+#include <string>
+
+#include "include/opencog/atomspace.h"
+#include "include/opencog/isolate-mesh.h"
+#include "include/opencog/opencog-bindings.h"
+#include "include/v8-array-buffer.h"
+#include "include/v8-snapshot.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+using v8::opencog::AtomSpaceManager;
+using v8::opencog::IsolateConfig;
+using v8::opencog::IsolateMesh;
+using v8::opencog::IsolatePool;
+using v8::opencog::OpenCogBindings;
+using v8::opencog::TenantIsolate;
+
+constexpr char kTenant[] = "bench";
+
+// Creates and disposes of isolates on the benchmark thread, with range(0)
+// selecting whether they are deserialized from the OpenCog snapshot or run
+// the bindings setup themselves.
+void BM_OpenCogIsolateCreation(benchmark::State& state) {
+  const bool use_snapshot = state.range(0) != 0;
+  v8::StartupData blob{nullptr, 0};
+  if (use_snapshot) {
+    blob = OpenCogBindings::CreateStartupSnapshot(
+        std::shared_ptr<v8::ArrayBuffer::Allocator>(
+            v8::ArrayBuffer::Allocator::NewDefaultAllocator()));
+    if (blob.data == nullptr) {
+      state.SkipWithError("could not create the startup snapshot");
+      return;
+    }
+  }
+  {
+    IsolatePool::Options options;
+    options.size = 0;
+    options.use_startup_snapshot = use_snapshot;
+    options.startup_snapshot = use_snapshot ? &blob : nullptr;
+    IsolatePool pool(options);
+    IsolateConfig config;
+    for (auto _ : state) {
+      TenantIsolate tenant(kTenant, pool.CreateIsolate(config), config);
+      benchmark::DoNotOptimize(tenant.isolate());
+    }
+  }
+  delete[] blob.data;
+  AtomSpaceManager::GetInstance()->RemoveAtomSpace(kTenant);
+}
+BENCHMARK(BM_OpenCogIsolateCreation)
+    ->ArgName("snapshot")
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMillisecond);
+
+// IsolateMesh::CreateTenantIsolate() with range(0) warm isolates kept by the
+// pool; removing the tenant again is not timed. Tenants arriving faster than
+// the pool refills in the background get a freshly created isolate, so this
+// also shows how far the pool carries a burst of arrivals.
+void BM_OpenCogMeshTenantCreation(benchmark::State& state) {
+  IsolateMesh::Options options;
+  options.isolate_pool.size = state.range(0);
+  IsolateMesh mesh(options);
+  IsolateConfig config;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(mesh.CreateTenantIsolate(kTenant, config));
+    state.PauseTiming();
+    mesh.RemoveTenantIsolate(kTenant);
+    state.ResumeTiming();
+  }
+  AtomSpaceManager::GetInstance()->RemoveAtomSpace(kTenant);
+}
+BENCHMARK(BM_OpenCogMeshTenantCreation)
+    ->ArgName("pool")
+    ->Arg(0)
+    ->Arg(2)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
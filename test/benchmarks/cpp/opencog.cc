@@ -0,0 +1,323 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Baselines for the OpenCog AtomSpace and agent orchestrator. None of these
+// need an isolate; see opencog-isolate.cc for isolate creation.
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/opencog/agent-orchestrator.h"
+#include "include/opencog/agent.h"
+#include "include/opencog/atomspace.h"
+#include "include/opencog/pattern.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+using v8::opencog::Agent;
+using v8::opencog::AgentMessage;
+using v8::opencog::AgentOrchestrator;
+using v8::opencog::Atom;
+using v8::opencog::AtomPattern;
+using v8::opencog::AtomSpace;
+using v8::opencog::AtomType;
+using v8::opencog::Node;
+using v8::opencog::TruthValue;
+
+std::vector<std::string> MakeNames(size_t count) {
+  std::vector<std::string> names;
+  names.reserve(count);
+  for (size_t i = 0; i < count; ++i) names.push_back("n" + std::to_string(i));
+  return names;
+}
+
+// |count| concept nodes and one inheritance link from each to the next.
+std::vector<std::shared_ptr<Node>> Populate(AtomSpace* space, size_t count) {
+  std::vector<std::shared_ptr<Node>> nodes;
+  nodes.reserve(count);
+  for (const std::string& name : MakeNames(count)) {
+    nodes.push_back(space->AddNode(AtomType::CONCEPT_NODE, name));
+  }
+  for (size_t i = 0; i + 1 < count; ++i) {
+    space->AddLink(AtomType::INHERITANCE_LINK, "", {nodes[i], nodes[i + 1]});
+  }
+  return nodes;
+}
+
+void BM_AtomSpaceAddNode(benchmark::State& state) {
+  const std::vector<std::string> names = MakeNames(state.range(0));
+  for (auto _ : state) {
+    AtomSpace space("bench");
+    for (const std::string& name : names) {
+      benchmark::DoNotOptimize(space.AddNode(AtomType::CONCEPT_NODE, name));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * names.size());
+}
+BENCHMARK(BM_AtomSpaceAddNode)->Arg(1 << 10)->Arg(1 << 16);
+
+// Adding atoms that are already there, which is a lookup.
+void BM_AtomSpaceAddExistingNode(benchmark::State& state) {
+  const std::vector<std::string> names = MakeNames(state.range(0));
+  AtomSpace space("bench");
+  for (const std::string& name : names) {
+    space.AddNode(AtomType::CONCEPT_NODE, name);
+  }
+  for (auto _ : state) {
+    for (const std::string& name : names) {
+      benchmark::DoNotOptimize(space.AddNode(AtomType::CONCEPT_NODE, name));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * names.size());
+}
+BENCHMARK(BM_AtomSpaceAddExistingNode)->Arg(1 << 16);
+
+void BM_AtomSpaceAddLink(benchmark::State& state) {
+  const size_t count = state.range(0);
+  const std::vector<std::string> names = MakeNames(count);
+  for (auto _ : state) {
+    state.PauseTiming();
+    AtomSpace space("bench");
+    std::vector<std::shared_ptr<Node>> nodes;
+    nodes.reserve(count);
+    for (const std::string& name : names) {
+      nodes.push_back(space.AddNode(AtomType::CONCEPT_NODE, name));
+    }
+    state.ResumeTiming();
+    for (size_t i = 0; i + 1 < count; ++i) {
+      benchmark::DoNotOptimize(space.AddLink(AtomType::INHERITANCE_LINK, "",
+                                             {nodes[i], nodes[i + 1]}));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (count - 1));
+}
+BENCHMARK(BM_AtomSpaceAddLink)->Arg(1 << 10)->Arg(1 << 16);
+
+void BM_AtomSpaceGetAtomsByType(benchmark::State& state) {
+  AtomSpace space("bench");
+  Populate(&space, state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(space.GetAtomsByType(AtomType::CONCEPT_NODE));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AtomSpaceGetAtomsByType)->Arg(1 << 10)->Arg(1 << 16);
+
+// Query() and Match() keeping range(1) percent of the atoms. Query() scans
+// everything, Match() only the type's atoms.
+void BM_AtomSpaceQuery(benchmark::State& state) {
+  AtomSpace space("bench");
+  Populate(&space, state.range(0));
+  const uint64_t percent = state.range(1);
+  auto predicate = [percent](const std::shared_ptr<Atom>& atom) {
+    return atom->id() % 100 < percent;
+  };
+  size_t results = 0;
+  for (auto _ : state) {
+    results = space.Query(predicate).size();
+    benchmark::DoNotOptimize(results);
+  }
+  state.counters["results"] = results;
+}
+BENCHMARK(BM_AtomSpaceQuery)->ArgsProduct({{1 << 16}, {1, 10, 100}});
+
+void BM_AtomSpaceMatchByType(benchmark::State& state) {
+  AtomSpace space("bench");
+  Populate(&space, state.range(0));
+  const uint64_t percent = state.range(1);
+  AtomPattern pattern;
+  pattern.type = AtomType::INHERITANCE_LINK;
+  pattern.filter = [percent](const std::shared_ptr<Atom>& atom) {
+    return atom->id() % 100 < percent;
+  };
+  size_t results = 0;
+  for (auto _ : state) {
+    results = space.Match(pattern).size();
+    benchmark::DoNotOptimize(results);
+  }
+  state.counters["results"] = results;
+}
+BENCHMARK(BM_AtomSpaceMatchByType)->ArgsProduct({{1 << 16}, {1, 10, 100}});
+
+void BM_AtomSpaceMatchByName(benchmark::State& state) {
+  AtomSpace space("bench");
+  Populate(&space, state.range(0));
+  AtomPattern pattern;
+  pattern.type = AtomType::CONCEPT_NODE;
+  pattern.name = "n42";
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(space.Match(pattern));
+  }
+}
+BENCHMARK(BM_AtomSpaceMatchByName)->Arg(1 << 16);
+
+void BM_AtomSpaceMatchIncomingSet(benchmark::State& state) {
+  AtomSpace space("bench");
+  std::vector<std::shared_ptr<Node>> nodes = Populate(&space, state.range(0));
+  AtomPattern pattern;
+  pattern.type = AtomType::INHERITANCE_LINK;
+  pattern.outgoing = {nodes[42], nullptr};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(space.Match(pattern));
+  }
+}
+BENCHMARK(BM_AtomSpaceMatchIncomingSet)->Arg(1 << 16);
+
+// One AtomSpace shared by all threads, which look up nodes and set the truth
+// value of range(0) percent of them.
+void BM_AtomSpaceReadWriteMix(benchmark::State& state) {
+  static constexpr size_t kAtoms = 1 << 14;
+  static AtomSpace* space = nullptr;
+  static std::vector<std::string>* names = nullptr;
+  if (state.thread_index() == 0) {
+    space = new AtomSpace("bench");
+    Populate(space, kAtoms);
+    names = new std::vector<std::string>(MakeNames(kAtoms));
+  }
+  const uint64_t write_percent = state.range(0);
+  // Threads start apart and stride differently to spread over the shards.
+  size_t index = state.thread_index() * 7919;
+  const size_t stride = 2 * state.thread_index() + 1;
+  uint64_t ops = 0;
+  for (auto _ : state) {
+    index = (index + stride) % kAtoms;
+    std::shared_ptr<Node> node =
+        space->GetNode(AtomType::CONCEPT_NODE, (*names)[index]);
+    if (ops++ % 100 < write_percent) {
+      space->SetTruthValue(node, TruthValue(0.5, 0.5));
+    } else {
+      benchmark::DoNotOptimize(space->GetTruthValue(*node));
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) {
+    delete names;
+    delete space;
+  }
+}
+BENCHMARK(BM_AtomSpaceReadWriteMix)
+    ->Arg(0)
+    ->Arg(10)
+    ->Arg(50)
+    ->ThreadRange(1, 64)
+    ->UseRealTime();
+
+// Structural writes: even threads add links between existing nodes while odd
+// ones read incoming sets.
+void BM_AtomSpaceAddLinkMatchMix(benchmark::State& state) {
+  static constexpr size_t kAtoms = 1 << 12;
+  static AtomSpace* space = nullptr;
+  static std::vector<std::shared_ptr<Node>>* nodes = nullptr;
+  if (state.thread_index() == 0) {
+    space = new AtomSpace("bench");
+    nodes = new std::vector<std::shared_ptr<Node>>(Populate(space, kAtoms));
+  }
+  const bool writer = state.thread_index() % 2 == 0;
+  size_t index = state.thread_index() * 7919;
+  for (auto _ : state) {
+    index = (index + 1) % kAtoms;
+    const std::shared_ptr<Node>& source = (*nodes)[index];
+    if (writer) {
+      const std::shared_ptr<Node>& target = (*nodes)[(index * 31) % kAtoms];
+      benchmark::DoNotOptimize(
+          space->AddLink(AtomType::SIMILARITY_LINK, "", {source, target}));
+    } else {
+      benchmark::DoNotOptimize(space->GetIncomingSet(source->id()));
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+  if (state.thread_index() == 0) {
+    delete nodes;
+    delete space;
+  }
+}
+BENCHMARK(BM_AtomSpaceAddLinkMatchMix)->ThreadRange(1, 64)->UseRealTime();
+
+// Counts the messages it gets.
+class SinkAgent : public Agent {
+ public:
+  explicit SinkAgent(const std::string& agent_id) : Agent(agent_id, "bench") {}
+
+  void Execute() override {}
+  void OnMessage(const AgentMessage& message) override {
+    received_.fetch_add(1, std::memory_order_release);
+  }
+
+  uint64_t received() const {
+    return received_.load(std::memory_order_acquire);
+  }
+
+ private:
+  std::atomic<uint64_t> received_{0};
+};
+
+// Time from RouteMessage() to the recipient's OnMessage(), one message in
+// flight at a time, on range(0) worker threads (0 for the orchestrator
+// thread).
+void BM_AgentMessageLatency(benchmark::State& state) {
+  AgentOrchestrator::Options options;
+  options.worker_threads = state.range(0);
+  AgentOrchestrator orchestrator(options);
+  auto sink = std::make_shared<SinkAgent>("sink");
+  orchestrator.RegisterAgent(sink);
+  orchestrator.Start();
+
+  AgentMessage message;
+  message.from_agent_id = "bench";
+  message.to_agent_id = "sink";
+  message.type = "ping";
+  message.payload = "payload";
+  uint64_t sent = 0;
+  for (auto _ : state) {
+    orchestrator.RouteMessage(message);
+    ++sent;
+    while (sink->received() < sent) {
+    }
+  }
+  orchestrator.Stop();
+}
+BENCHMARK(BM_AgentMessageLatency)->Arg(0)->Arg(4)->UseRealTime();
+
+// Messages routed to range(1) recipients in bursts of 1024, until all have
+// been delivered.
+void BM_AgentMessageThroughput(benchmark::State& state) {
+  static constexpr size_t kBurst = 1024;
+  AgentOrchestrator::Options options;
+  options.worker_threads = state.range(0);
+  AgentOrchestrator orchestrator(options);
+  std::vector<std::shared_ptr<SinkAgent>> sinks;
+  for (int64_t i = 0; i < state.range(1); ++i) {
+    sinks.push_back(std::make_shared<SinkAgent>("sink" + std::to_string(i)));
+    orchestrator.RegisterAgent(sinks.back());
+  }
+  orchestrator.Start();
+
+  AgentMessage message;
+  message.from_agent_id = "bench";
+  message.type = "ping";
+  message.payload = "payload";
+  uint64_t sent = 0;
+  for (auto _ : state) {
+    for (size_t i = 0; i < kBurst; ++i) {
+      message.to_agent_id = sinks[i % sinks.size()]->agent_name();
+      orchestrator.RouteMessage(message);
+    }
+    sent += kBurst;
+    while (true) {
+      uint64_t received = 0;
+      for (const auto& sink : sinks) received += sink->received();
+      if (received >= sent) break;
+    }
+  }
+  orchestrator.Stop();
+  state.SetItemsProcessed(state.iterations() * kBurst);
+}
+BENCHMARK(BM_AgentMessageThroughput)
+    ->ArgsProduct({{0, 4}, {1, 64}})
+    ->UseRealTime();
+
+}  // namespace
@@ -2,10 +2,13 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <atomic>
 #include <cerrno>
 #include <cmath>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "src/bigint/bigint-internal.h"
 #include "src/bigint/util.h"
@@ -37,6 +40,7 @@ int PrintHelp(char** argv) {
   V(kFromString, "fromstring")       \
   V(kFromStringBase2, "fromstring2") \
   V(kKaratsuba, "karatsuba")         \
+  V(kParallel, "parallel")           \
   V(kToom, "toom")                   \
   V(kToString, "tostring")
 
@@ -124,6 +128,27 @@ std::string FormatHex(Digits X) {
   return std::string(result.get(), chars);
 }
 
+// Runs parallel tasks on a few plain threads, including the calling one.
+class ThreadPlatform : public Platform {
+ public:
+  static constexpr uint32_t kThreads = 4;
+
+  uint32_t MaxConcurrency() override { return kThreads; }
+
+  void RunInParallel(ParallelTask* task, uint32_t count) override {
+    std::atomic<uint32_t> next_index{0};
+    auto work = [&]() {
+      for (uint32_t i = next_index++; i < count; i = next_index++) {
+        task->Run(i);
+      }
+    };
+    std::vector<std::thread> threads;
+    for (uint32_t i = 1; i < kThreads; i++) threads.emplace_back(work);
+    work();
+    for (std::thread& thread : threads) thread.join();
+  }
+};
+
 class Runner {
  public:
   Runner() = default;
@@ -131,12 +156,17 @@ class Runner {
   void Initialize() {
     rng_.Initialize(random_seed_);
     processor_.reset(Processor::New(new Platform()));
+    parallel_processor_.reset(Processor::New(new ThreadPlatform()));
   }
 
   ProcessorImpl* processor() {
     return static_cast<ProcessorImpl*>(processor_.get());
   }
 
+  ProcessorImpl* parallel_processor() {
+    return static_cast<ProcessorImpl*>(parallel_processor_.get());
+  }
+
   int Run() {
     if (op_ == kList) {
       ListTests();
@@ -207,6 +237,10 @@ class Runner {
       for (int i = 0; i < runs_; i++) {
         TestKaratsuba(&count);
       }
+    } else if (test_ == kParallel) {
+      for (int i = 0; i < runs_; i++) {
+        TestParallel(&count);
+      }
     } else if (test_ == kToom) {
       for (int i = 0; i < runs_; i++) {
         TestToom(&count);
@@ -315,6 +349,63 @@ class Runner {
 #endif  // V8_ADVANCED_BIGINT_ALGORITHMS
   }
 
+  void TestParallel(int* count) {
+#if V8_ADVANCED_BIGINT_ALGORITHMS
+    // Random sizes just above the threshold for splitting work, once for
+    // FFT multiplication, and once for Toom-Cook with a short right side.
+    uint64_t random_bits = rng_.NextUint64();
+    uint32_t fft_size =
+        kParallelMultiplyThreshold + static_cast<uint32_t>(random_bits & 4095);
+    random_bits >>= 12;
+    uint32_t toom_left_size =
+        kParallelMultiplyThreshold + static_cast<uint32_t>(random_bits & 4095);
+    random_bits >>= 12;
+    uint32_t toom_right_size =
+        kToomThreshold + static_cast<uint32_t>(random_bits & 511);
+    random_bits >>= 9;
+    uint32_t fft_right_size = fft_size - static_cast<uint32_t>(random_bits & 15);
+    std::cout << "fft " << fft_size << " toom " << toom_left_size << "x"
+              << toom_right_size << "\n";
+    {
+      ScratchDigits A(fft_size);
+      ScratchDigits B(fft_right_size);
+      uint32_t result_len = MultiplyResultLength(A, B);
+      ScratchDigits result(result_len);
+      ScratchDigits result_serial(result_len);
+      GenerateRandom(A);
+      GenerateRandom(B);
+      parallel_processor()->MultiplyFFT(result, A, B);
+      processor()->MultiplyFFT(result_serial, A, B);
+      AssertEquals(A, B, result_serial, result);
+      if (error_) return;
+      (*count)++;
+      // Squaring takes a different path for the forward transform.
+      uint32_t square_len = MultiplyResultLength(A, A);
+      ScratchDigits square(square_len);
+      ScratchDigits square_serial(square_len);
+      parallel_processor()->MultiplyFFT(square, A, A);
+      processor()->MultiplyFFT(square_serial, A, A);
+      AssertEquals(A, A, square_serial, square);
+      if (error_) return;
+      (*count)++;
+    }
+    {
+      ScratchDigits A(toom_left_size);
+      ScratchDigits B(toom_right_size);
+      uint32_t result_len = MultiplyResultLength(A, B);
+      ScratchDigits result(result_len);
+      ScratchDigits result_serial(result_len);
+      GenerateRandom(A);
+      GenerateRandom(B);
+      parallel_processor()->MultiplyToomCook(result, A, B);
+      processor()->MultiplyToomCook(result_serial, A, B);
+      AssertEquals(A, B, result_serial, result);
+      if (error_) return;
+      (*count)++;
+    }
+#endif  // V8_ADVANCED_BIGINT_ALGORITHMS
+  }
+
   void TestBurnikel(int* count) {
     // Start small to save test execution time.
     constexpr uint32_t kMin = kBurnikelThreshold / 2;
@@ -624,6 +715,7 @@ class Runner {
   int64_t random_seed_{314159265359};
   RNG rng_;
   std::unique_ptr<Processor, Processor::Destroyer> processor_;
+  std::unique_ptr<Processor, Processor::Destroyer> parallel_processor_;
 };
 
 }  // namespace test
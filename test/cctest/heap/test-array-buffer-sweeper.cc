@@ -385,6 +385,33 @@ TEST(ArrayBuffer_ExternalBackingStoreSizeDecreases) {
   CHECK_EQ(0, backing_store_after - backing_store_before);
 }
 
+TEST(ArrayBuffer_ExternalMemoryIsBatched) {
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  LocalContext env;
+  v8::Isolate* isolate = env.isolate();
+  v8::HandleScope handle_scope(isolate);
+
+  // A large buffer is reported right away and leaves nothing batched.
+  const int64_t external_before = v8::ExternalMemoryAccounter::
+      GetTotalAmountOfExternalAllocatedMemoryForTesting(isolate);
+  Local<v8::ArrayBuffer> large = v8::ArrayBuffer::New(isolate, 1 * MB);
+  const int64_t external_after_large = v8::ExternalMemoryAccounter::
+      GetTotalAmountOfExternalAllocatedMemoryForTesting(isolate);
+  CHECK_LT(external_before, external_after_large);
+
+  // A small one is only counted by the sweeper until the batch fills up.
+  ArrayBufferSweeper* sweeper = CcTest::heap()->array_buffer_sweeper();
+  const uint64_t bytes_before = sweeper->GetBytes();
+  Local<v8::ArrayBuffer> small = v8::ArrayBuffer::New(isolate, 117);
+  CHECK_EQ(bytes_before + 117, sweeper->GetBytes());
+  CHECK_EQ(external_after_large,
+           v8::ExternalMemoryAccounter::
+               GetTotalAmountOfExternalAllocatedMemoryForTesting(isolate));
+  USE(large);
+  USE(small);
+}
+
 TEST(ArrayBuffer_ExternalBackingStoreSizeIncreasesMarkCompact) {
   if (!v8_flags.compact) return;
   ManualGCScope manual_gc_scope;
@@ -28,18 +28,19 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
   const int kNumParams = 2;
   CodeAssemblerTester data(isolate, JSParameterCount(kNumParams));
   AccessorAssembler m(data.state());
+  StubCache* stub_cache = isolate->load_stub_cache();
 
   {
     auto name = m.Parameter<Name>(1);
     auto map = m.Parameter<Map>(2);
     TNode<IntPtrT> primary_offset =
-        m.StubCachePrimaryOffsetForTesting(name, map);
+        m.StubCachePrimaryOffsetForTesting(stub_cache, name, map);
     TNode<IntPtrT> result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
     } else {
       CHECK_EQ(StubCache::kSecondary, table);
-      result = m.StubCacheSecondaryOffsetForTesting(name, map);
+      result = m.StubCacheSecondaryOffsetForTesting(stub_cache, name, map);
     }
     m.Return(m.SmiTag(result));
   }
@@ -76,11 +77,11 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 
       int expected_result;
       {
-        int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
+        int primary_offset = stub_cache->PrimaryOffsetForTesting(*name, *map);
         if (table == StubCache::kPrimary) {
           expected_result = primary_offset;
         } else {
-          expected_result = StubCache::SecondaryOffsetForTesting(*name, *map);
+          expected_result = stub_cache->SecondaryOffsetForTesting(*name, *map);
         }
       }
       DirectHandle<Object> result = ft.Call(name, map).ToHandleChecked();
@@ -137,6 +138,41 @@ TEST(BasicStubCache) {
   CHECK_EQ((*handler).ptr(), result.ptr());
 }
 
+TEST(StubCacheGrowsWhenMissing) {
+  if (v8_flags.stub_cache_max_primary_table_bits <=
+      StubCache::kPrimaryTableBits) {
+    return;
+  }
+  Isolate* isolate(CcTest::InitIsolateOnce());
+  HandleScope scope(isolate);
+  StubCache stub_cache(isolate);
+  stub_cache.Clear();
+  CHECK_EQ(StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+  CHECK_EQ(StubCache::kSecondaryTableSize, stub_cache.secondary_table_size());
+
+  DirectHandle<Name> name = isolate->factory()->InternalizeUtf8String("x");
+  DirectHandle<DataHandler> handler = CreateDummyHandler();
+  for (int i = 0; i <= StubCache::kPrimaryTableSize; i++) {
+    DirectHandle<Map> map = Map::Create(isolate, 0);
+    stub_cache.Set(*name, *map, *handler);
+  }
+
+  // More misses than entries since the last clear double the tables.
+  stub_cache.Clear();
+  CHECK_EQ(2 * StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+  CHECK_EQ(2 * StubCache::kSecondaryTableSize,
+           stub_cache.secondary_table_size());
+
+  // Without further misses they keep their size.
+  stub_cache.Clear();
+  CHECK_EQ(2 * StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+
+  DirectHandle<Map> map = Map::Create(isolate, 0);
+  DisallowGarbageCollection no_gc;
+  stub_cache.Set(*name, *map, *handler);
+  CHECK_EQ((*handler).ptr(), stub_cache.Get(*name, *map).ptr());
+}
+
 TEST(TryProbeStubCache) {
   using Label = CodeStubAssembler::Label;
   Isolate* isolate(CcTest::InitIsolateOnce());
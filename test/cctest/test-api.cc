@@ -85,6 +85,7 @@
 #include "src/utils/utils.h"
 #include "test/cctest/heap/heap-tester.h"
 #include "test/cctest/heap/heap-utils.h"
+#include "test/cctest/jsonstream-helper.h"
 #include "test/common/flag-utils.h"
 #include "test/common/streaming-helper.h"
 
@@ -21862,6 +21863,63 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+static void CheckJSONStringifyToStream(LocalContext& context,
+                                       const char* gap) {
+  Local<Value> obj = CompileRun("obj");
+  i::TestJSONStream stream;
+  CHECK(v8::JSON::StringifyToStream(context.local(), obj, &stream, v8_str(gap))
+            .FromJust());
+  CHECK_EQ(1, stream.eos_signaled());
+  v8::base::ScopedVector<char> json(stream.size() + 1);
+  stream.WriteTo(json);
+  json[stream.size()] = '\0';
+  v8::base::ScopedVector<char> source(64);
+  v8::base::SNPrintF(source, "JSON.stringify(obj, null, '%s')", gap);
+  ExpectString(source.begin(), json.begin());
+}
+
+THREADED_TEST(JSONStringifyToStream) {
+  LocalContext context;
+  HandleScope scope(context.isolate());
+  // Enough output for many chunks and parts, with surrogate pairs at every
+  // offset modulo 16.
+  CompileRun(
+      "var obj = [];"
+      "for (var i = 0; i < 5000; i++) {"
+      "  obj.push({a: i, b: 'x'.repeat(i % 16) + '\\u00e9\\ud83d\\ude00',"
+      "            c: [i / 3, 'y' + i, null], d: '\\u0100' + i});"
+      "}"
+      "obj.push('\\ud800', 'x'.repeat(100000));");
+  CheckJSONStringifyToStream(context, "");
+  CheckJSONStringifyToStream(context, "  ");
+
+  // Values without a JSON representation write nothing.
+  i::TestJSONStream undefined_stream;
+  CHECK(!v8::JSON::StringifyToStream(context.local(),
+                                    v8::Undefined(context.isolate()),
+                                    &undefined_stream)
+             .FromJust());
+  CHECK_EQ(0, undefined_stream.eos_signaled());
+  CHECK_EQ(0, undefined_stream.size());
+
+  // An aborted stream doesn't get EndOfStream.
+  i::TestJSONStream aborted_stream(2);
+  CHECK(!v8::JSON::StringifyToStream(context.local(), CompileRun("obj"),
+                                    &aborted_stream)
+             .FromJust());
+  CHECK_EQ(0, aborted_stream.eos_signaled());
+
+  // Exceptions are thrown as with JSON.stringify.
+  v8::TryCatch try_catch(context.isolate());
+  i::TestJSONStream circular_stream;
+  CHECK(v8::JSON::StringifyToStream(context.local(),
+                                    CompileRun("var a = []; a.push(a); a"),
+                                    &circular_stream)
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+  CHECK_EQ(0, circular_stream.eos_signaled());
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
@@ -24809,6 +24867,55 @@ TEST(StreamingWithIsolateScriptCacheClearingRootSFI) {
   StreamingWithIsolateScriptCache(true);
 }
 
+// Streams a complete source string, and checks that a second request for the
+// same source is served from the Isolate script cache without a task.
+TEST(StreamingFromStringWithIsolateScriptCache) {
+  const char* full_source =
+      "(function test(\u00e9) { return 13; })  // two byte: \u2603";
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  v8::ScriptOrigin origin(v8_str("http://foo.com"));
+  i::DirectHandle<i::JSFunction> first_function;
+
+  {
+    LocalContext env;
+    v8::ScriptCompiler::StreamedSource source(isolate, v8_str(full_source));
+    v8::ScriptCompiler::ScriptStreamingTask* task =
+        v8::ScriptCompiler::StartStreaming(isolate, &source,
+                                           v8_str(full_source), origin);
+    CHECK_NOT_NULL(task);
+    StreamerThread::StartThreadForTaskAndJoin(task);
+    delete task;
+    v8::Local<v8::UnboundScript> unbound =
+        v8::ScriptCompiler::CompileUnboundScript(isolate, &source,
+                                                 v8_str(full_source), origin)
+            .ToLocalChecked();
+    CHECK_EQ(source.compilation_details().in_memory_cache_result,
+             v8::ScriptCompiler::InMemoryCacheResult::kMiss);
+    v8::Local<Value> result =
+        unbound->BindToCurrentContext()->Run(env.local()).ToLocalChecked();
+    first_function =
+        i::Cast<i::JSFunction>(v8::Utils::OpenDirectHandle(*result));
+  }
+
+  {
+    LocalContext env;
+    v8::ScriptCompiler::StreamedSource source(isolate, v8_str(full_source));
+    CHECK_NULL(v8::ScriptCompiler::StartStreaming(
+        isolate, &source, v8_str(full_source), origin));
+    v8::Local<Script> script =
+        v8::ScriptCompiler::Compile(env.local(), &source, v8_str(full_source),
+                                    origin)
+            .ToLocalChecked();
+    CHECK_EQ(source.compilation_details().in_memory_cache_result,
+             v8::ScriptCompiler::InMemoryCacheResult::kHit);
+    v8::Local<Value> result = script->Run(env.local()).ToLocalChecked();
+    i::DirectHandle<i::JSFunction> second_function =
+        i::Cast<i::JSFunction>(v8::Utils::OpenDirectHandle(*result));
+    CHECK_EQ(first_function->shared(), second_function->shared());
+  }
+}
+
 TEST(CodeCache) {
   v8::Isolate::CreateParams create_params = CreateTestParams();
 
@@ -30469,6 +30576,64 @@ TEST(TriggerThreadSafeMetricsEvent) {
   CHECK_EQ(recorder->module_count_, 42);
 }
 
+namespace {
+
+class ContextCostRecorder : public v8::metrics::Recorder {
+ public:
+  void AddMainThreadEvent(
+      const v8::metrics::GarbageCollectionFullCycleContextCost& event,
+      v8::metrics::Recorder::ContextId id) override {
+    events_.emplace_back(event, id);
+  }
+
+  std::vector<std::pair<v8::metrics::GarbageCollectionFullCycleContextCost,
+                        v8::metrics::Recorder::ContextId>>
+      events_;
+};
+
+}  // namespace
+
+TEST(ReportGCCostPerContext) {
+  i::v8_flags.gc_per_context_cost = true;
+  v8::Isolate* iso = CcTest::isolate();
+  i::Heap* heap = CcTest::heap();
+  std::shared_ptr<ContextCostRecorder> recorder =
+      std::make_shared<ContextCostRecorder>();
+  iso->SetMetricsRecorder(recorder);
+
+  v8::HandleScope scope(iso);
+  Local<Context> context = Context::New(iso);
+  v8::metrics::Recorder::ContextId context_id =
+      v8::metrics::Recorder::GetContextId(context);
+  {
+    Context::Scope context_scope(context);
+    CompileRun("var data = new Array(10000).fill({});");
+  }
+  recorder->events_.clear();
+  {
+    i::DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+    i::heap::InvokeAtomicMajorGC(heap);
+    if (heap->sweeping_in_progress()) {
+      heap->EnsureSweepingCompleted(
+          i::Heap::SweepingForcedFinalizationMode::kV8Only,
+          i::CompleteSweepingReason::kTesting);
+    }
+  }
+
+  bool found = false;
+  double total_share = 0;
+  for (const auto& [event, id] : recorder->events_) {
+    CHECK_LE(0, event.marked_bytes);
+    CHECK_LE(0, event.total_mark_wall_clock_duration_in_us);
+    total_share += event.marked_bytes_share;
+    if (id != context_id) continue;
+    found = true;
+    CHECK_LT(10000 * i::kTaggedSize, event.marked_bytes);
+  }
+  CHECK(found);
+  CHECK_LT(std::abs(total_share - 1.0), 0.01);
+}
+
 void SetupCodeLike(LocalContext* env, const char* name,
                    v8::Local<v8::FunctionTemplate> to_string,
                    bool is_code_like) {
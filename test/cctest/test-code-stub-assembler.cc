@@ -3102,6 +3102,12 @@ TEST(NewElementsCapacity) {
   CHECK_EQ(
       result_obj.value(),
       static_cast<int>(JSObject::NewElementsCapacity((*test_value).value())));
+  test_value = Handle<Smi>(
+      Smi::FromInt(JSObject::kLargeElementsCapacity + 1), isolate);
+  result_obj = *ft.CallChecked<Smi>(test_value);
+  CHECK_EQ(
+      result_obj.value(),
+      static_cast<int>(JSObject::NewElementsCapacity((*test_value).value())));
 }
 
 TEST(NewElementsCapacitySmi) {
@@ -3132,6 +3138,12 @@ TEST(NewElementsCapacitySmi) {
   CHECK_EQ(
       result_obj.value(),
       static_cast<int>(JSObject::NewElementsCapacity((*test_value).value())));
+  test_value = Handle<Smi>(
+      Smi::FromInt(JSObject::kLargeElementsCapacity + 1), isolate);
+  result_obj = *ft.CallChecked<Smi>(test_value);
+  CHECK_EQ(
+      result_obj.value(),
+      static_cast<int>(JSObject::NewElementsCapacity((*test_value).value())));
 }
 
 TEST(AllocateRootFunctionWithContext) {
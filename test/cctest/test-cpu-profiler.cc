@@ -29,6 +29,8 @@
 
 #include <limits>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "include/libplatform/v8-tracing.h"
 #include "include/v8-fast-api-calls.h"
@@ -5020,6 +5022,117 @@ TEST(CpuProfileJSONSerialization) {
             ->Value() > 0);
 }
 
+namespace {
+
+class CollectingContinuousProfileDelegate
+    : public v8::ContinuousProfileDelegate {
+ public:
+  explicit CollectingContinuousProfileDelegate(
+      std::vector<std::string>* flushes)
+      : flushes_(flushes) {}
+
+  void OnProfileFlush(const char* data, size_t size) override {
+    flushes_->emplace_back(data, size);
+  }
+
+ private:
+  std::vector<std::string>* flushes_;
+};
+
+// Runs cpu_profiler_test_source under continuous profiling and returns the
+// flushed data.
+std::vector<std::string> RunContinuousProfiling(
+    v8::ContinuousProfileFormat format) {
+  v8_flags.allow_natives_syntax = true;
+  LocalContext env;
+  v8::HandleScope scope(env.isolate());
+
+  CompileRun(cpu_profiler_test_source);
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+
+  std::vector<std::string> flushes;
+  v8::CpuProfiler* profiler = v8::CpuProfiler::New(env.isolate());
+  v8::ContinuousProfilingOptions options;
+  options.format = format;
+  options.sampling_interval_us = 100;
+  options.flush_interval_ms = 20;
+  CHECK_EQ(v8::CpuProfilingStatus::kStarted,
+           profiler->StartContinuousProfiling(
+               std::make_unique<CollectingContinuousProfileDelegate>(&flushes),
+               options));
+  CHECK_EQ(v8::CpuProfilingStatus::kAlreadyStarted,
+           profiler->StartContinuousProfiling(
+               std::make_unique<CollectingContinuousProfileDelegate>(&flushes),
+               options));
+  // Regular profiles cannot be combined with continuous profiling.
+  CHECK_EQ(v8::CpuProfilingStatus::kErrorTooManyProfilers,
+           profiler->Start(v8::CpuProfilingOptions()).status);
+
+  v8::Local<v8::Value> args[] = {v8::Integer::New(env.isolate(), 200)};
+  function->Call(env.local(), env->Global(), arraysize(args), args)
+      .ToLocalChecked();
+
+  profiler->StopContinuousProfiling();
+  // Nothing is flushed after stopping.
+  size_t flush_count = flushes.size();
+  profiler->StopContinuousProfiling();
+  CHECK_EQ(flush_count, flushes.size());
+  profiler->Dispose();
+  return flushes;
+}
+
+}  // namespace
+
+TEST(ContinuousProfilingFoldedStacks) {
+  // Skip test if concurrent sparkplug is enabled. The test becomes flaky,
+  // since it requires a precise trace.
+  if (v8_flags.concurrent_sparkplug) return;
+
+  std::vector<std::string> flushes =
+      RunContinuousProfiling(v8::ContinuousProfileFormat::kFoldedStacks);
+  // 200ms of samples with a 20ms flush interval.
+  CHECK_GT(flushes.size(), 1u);
+
+  bool found_bar_branch = false;
+  for (const std::string& flush : flushes) {
+    CHECK(!flush.empty());
+    CHECK_EQ('\n', flush.back());
+    size_t line_start = 0;
+    while (line_start < flush.size()) {
+      size_t line_end = flush.find('\n', line_start);
+      std::string line = flush.substr(line_start, line_end - line_start);
+      // Every line ends in a positive sample count.
+      size_t count_start = line.rfind(' ');
+      CHECK_NE(std::string::npos, count_start);
+      CHECK_LT(0, std::stoi(line.substr(count_start + 1)));
+      if (line.find("foo;bar;delay;loop ") != std::string::npos) {
+        found_bar_branch = true;
+      }
+      line_start = line_end + 1;
+    }
+  }
+  CHECK(found_bar_branch);
+}
+
+TEST(ContinuousProfilingPprof) {
+  if (v8_flags.concurrent_sparkplug) return;
+
+  std::vector<std::string> flushes =
+      RunContinuousProfiling(v8::ContinuousProfileFormat::kPprof);
+  CHECK_GT(flushes.size(), 1u);
+
+  for (const std::string& flush : flushes) {
+    // The first field is sample_type (field 1, length delimited).
+    CHECK_EQ(0x0A, flush[0]);
+    CHECK_NE(std::string::npos, flush.find("nanoseconds"));
+  }
+  bool found_loop = false;
+  for (const std::string& flush : flushes) {
+    if (flush.find("loop") != std::string::npos) found_loop = true;
+  }
+  CHECK(found_loop);
+}
+
 }  // namespace test_cpu_profiler
 }  // namespace internal
 }  // namespace v8
@@ -4748,6 +4748,41 @@ TEST(DebugCoverageWithScriptDataOutOfScope) {
   CHECK_EQ(26, function_data.EndOffset());
 }
 
+TEST(DebugCoverageSampled) {
+  LocalContext env;
+  v8::Isolate* isolate = env.isolate();
+  v8::HandleScope scope(isolate);
+  const char* source =
+      "(function() {\n"
+      "  var g = function() {};\n"
+      "  g();\n"
+      "})();";
+  CompileRun(source);
+  const int g_start =
+      static_cast<int>(strstr(source, "function() {}") - source);
+
+  // Sample while the closure of g is still in the heap, then let it die.
+  v8::debug::Coverage::SampleFunctions(isolate);
+  {
+    i::DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+        CcTest::heap());
+    i::heap::InvokeMajorGC(CcTest::heap());
+  }
+
+  v8::debug::Coverage coverage = v8::debug::Coverage::CollectSampled(isolate);
+  CHECK_EQ(1u, coverage.ScriptCount());
+  v8::debug::Coverage::ScriptData script_data = coverage.GetScriptData(0);
+  bool found_g = false;
+  for (size_t i = 0; i < script_data.FunctionCount(); i++) {
+    v8::debug::Coverage::FunctionData function_data =
+        script_data.GetFunctionData(i);
+    if (function_data.StartOffset() != g_start) continue;
+    CHECK_EQ(1, function_data.Count());
+    found_g = true;
+  }
+  CHECK(found_g);
+}
+
 TEST(DebugGetPossibleBreakpointsReturnLocations) {
   LocalContext env;
   v8::Isolate* isolate = env.isolate();
@@ -31,6 +31,7 @@
 
 #include <memory>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include "include/v8-function.h"
@@ -50,6 +51,7 @@
 #include "src/profiler/allocation-tracker.h"
 #include "src/profiler/heap-profiler.h"
 #include "src/profiler/heap-snapshot-generator-inl.h"
+#include "src/profiler/heap-snapshot-streamer.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/collector.h"
 #include "test/cctest/heap/heap-utils.h"
@@ -1447,6 +1449,35 @@ TEST(HeapSnapshotJSONSerializationAborting) {
   CHECK_EQ(0, stream.eos_signaled());
 }
 
+TEST(StreamHeapSnapshot) {
+  LocalContext env;
+  v8::HandleScope scope(env.isolate());
+  v8::HeapProfiler* heap_profiler = env.isolate()->GetHeapProfiler();
+  CompileRun("var a = [{ name: 'streamed' }, 'x'.repeat(100)];");
+  v8::internal::TestJSONStream stream;
+  CHECK(heap_profiler->StreamHeapSnapshot(&stream));
+  CHECK_EQ(1, stream.eos_signaled());
+  CHECK_GT(stream.size(), 6);
+  v8::base::ScopedVector<char> bytes(stream.size());
+  stream.WriteTo(bytes);
+  CHECK_EQ(0, memcmp(bytes.begin(), "V8HS", 4));
+  CHECK_EQ(i::HeapSnapshotStreamer::kVersion,
+           static_cast<uint8_t>(bytes[4]));
+  CHECK_EQ(i::kTaggedSize, bytes[5]);
+  CHECK_EQ(i::HeapSnapshotStreamer::kEnd,
+           static_cast<uint8_t>(bytes[stream.size() - 1]));
+}
+
+TEST(StreamHeapSnapshotAborting) {
+  LocalContext env;
+  v8::HandleScope scope(env.isolate());
+  v8::HeapProfiler* heap_profiler = env.isolate()->GetHeapProfiler();
+  v8::internal::TestJSONStream stream(5);
+  CHECK(!heap_profiler->StreamHeapSnapshot(&stream));
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(0, stream.eos_signaled());
+}
+
 namespace {
 
 class TestStatsStream : public v8::OutputStream {
@@ -4315,6 +4346,73 @@ TEST(SamplingHeapProfilerApiSamples) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+TEST(SamplingHeapProfilerLifetimes) {
+  v8::HandleScope scope(CcTest::isolate());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env.isolate()->GetHeapProfiler();
+
+  // Suppress randomness to avoid flakiness in tests.
+  i::v8_flags.sampling_heap_profiler_suppress_randomness = true;
+
+  // Deltas are only recorded with kSamplingRecordLifetimes.
+  heap_profiler->StartSamplingHeapProfiler(64);
+  v8::internal::TestJSONStream unused_stream;
+  CHECK(!heap_profiler->WriteSamplingHeapProfileDelta(&unused_stream));
+  heap_profiler->StopSamplingHeapProfiler();
+
+  heap_profiler->StartSamplingHeapProfiler(
+      64, 16, v8::HeapProfiler::kSamplingRecordLifetimes);
+  CompileRun(
+      "var retained = [];\n"
+      "function churn() {\n"
+      "  for (var i = 0; i < 1000; ++i) ({i});\n"
+      "}\n"
+      "function retain() {\n"
+      "  for (var i = 0; i < 1000; ++i) retained.push({i});\n"
+      "}\n"
+      "churn();\n"
+      "retain();\n");
+  i::heap::InvokeMajorGC(CcTest::heap());
+  i::heap::InvokeMajorGC(CcTest::heap());
+
+  // The retained objects survived both GCs.
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  CHECK(profile);
+  bool found_survivor = false;
+  for (auto& sample : profile->GetSamples()) {
+    CHECK_LE(0, sample.allocation_time_ms);
+    if (sample.survived_gc_count >= 2) found_survivor = true;
+  }
+  CHECK(found_survivor);
+
+  v8::internal::TestJSONStream stream;
+  CHECK(heap_profiler->WriteSamplingHeapProfileDelta(&stream));
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(1, stream.eos_signaled());
+  v8::base::ScopedVector<char> data(stream.size());
+  stream.WriteTo(data);
+  std::string pprof(data.begin(), data.size());
+  // The first field is sample_type (field 1, length delimited).
+  CHECK_EQ(0x0A, pprof[0]);
+  CHECK_NE(std::string::npos, pprof.find("alloc_space"));
+  CHECK_NE(std::string::npos, pprof.find("free_space"));
+  CHECK_NE(std::string::npos, pprof.find("retain"));
+  // Deaths of the churned objects carry their lifetime.
+  CHECK_NE(std::string::npos, pprof.find("churn"));
+  CHECK_NE(std::string::npos, pprof.find("survived_gcs"));
+
+  // Events are only written once.
+  v8::internal::TestJSONStream next_stream;
+  CHECK(heap_profiler->WriteSamplingHeapProfileDelta(&next_stream));
+  v8::base::ScopedVector<char> next_data(next_stream.size());
+  next_stream.WriteTo(next_data);
+  std::string next_pprof(next_data.begin(), next_data.size());
+  CHECK_EQ(std::string::npos, next_pprof.find("churn"));
+
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(SamplingHeapProfilerLeftTrimming) {
   v8::HandleScope scope(CcTest::isolate());
   LocalContext env;
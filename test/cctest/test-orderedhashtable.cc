@@ -788,6 +788,41 @@ TEST(OrderedHashMapDeletion) {
   CHECK(!OrderedHashMap::HasKey(isolate, *map, *key3));
 }
 
+TEST(OrderedHashMapCompactsDeletedEntries) {
+  LocalContext context;
+  Isolate* isolate = context.i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+  DirectHandle<String> value = factory->NewStringFromAsciiChecked("bar");
+
+  Handle<OrderedHashMap> map = factory->NewOrderedHashMap();
+  for (int i = 0; i < 8; i++) {
+    DirectHandle<Smi> key(Smi::FromInt(i), isolate);
+    map = OrderedHashMap::Add(isolate, map, key, value).ToHandleChecked();
+  }
+  CHECK_EQ(4, map->NumberOfBuckets());
+  CHECK_EQ(8, map->NumberOfElements());
+
+  // Deleting a quarter of the entries of a full table is enough to make
+  // room for the next insertion without growing the table.
+  CHECK(OrderedHashMap::Delete(isolate, *map, Smi::FromInt(0)));
+  CHECK(OrderedHashMap::Delete(isolate, *map, Smi::FromInt(3)));
+  DirectHandle<Smi> key8(Smi::FromInt(8), isolate);
+  map = OrderedHashMap::Add(isolate, map, key8, value).ToHandleChecked();
+  Verify(isolate, map);
+  CHECK_EQ(4, map->NumberOfBuckets());
+  CHECK_EQ(7, map->NumberOfElements());
+  CHECK_EQ(0, map->NumberOfDeletedElements());
+
+  // Insertion order survives the compaction.
+  const int expected[] = {1, 2, 4, 5, 6, 7, 8};
+  int i = 0;
+  for (InternalIndex entry : map->IterateEntries()) {
+    CHECK_EQ(expected[i++], Smi::ToInt(map->KeyAt(entry)));
+  }
+  CHECK_EQ(7, i);
+}
+
 TEST(SmallOrderedHashMapDeletion) {
   LocalContext context;
   Isolate* isolate = context.i_isolate();
@@ -483,6 +483,33 @@ UNINITIALIZED_TEST(SnapshotCompression) {
   shared_space_blob.Dispose();
   context_blob.Dispose();
 }
+
+TEST(SnapshotCompressionChunks) {
+  // Spans several compression chunks, the last one of them partially filled.
+  constexpr size_t kPayloadSize = 1 * MB + 1234;
+  std::vector<uint8_t> payload(kPayloadSize);
+  for (size_t i = 0; i < kPayloadSize; i++) {
+    payload[i] = static_cast<uint8_t>((i * 7) ^ (i >> 9));
+  }
+  base::Vector<const uint8_t> payload_vector = base::VectorOf(payload);
+  SnapshotData original_snapshot_data(payload_vector);
+  SnapshotData compressed =
+      i::SnapshotCompression::Compress(&original_snapshot_data);
+  for (bool parallel : {false, true}) {
+    FlagScope<bool> parallel_scope(&v8_flags.parallel_snapshot_decompression,
+                                   parallel);
+    SnapshotData decompressed =
+        i::SnapshotCompression::Decompress(compressed.RawData());
+    CHECK_EQ(payload_vector, decompressed.RawData());
+  }
+
+  SnapshotData empty_snapshot_data(base::Vector<const uint8_t>{});
+  SnapshotData empty_compressed =
+      i::SnapshotCompression::Compress(&empty_snapshot_data);
+  SnapshotData empty_decompressed =
+      i::SnapshotCompression::Decompress(empty_compressed.RawData());
+  CHECK(empty_decompressed.RawData().empty());
+}
 #endif  // SNAPSHOT_COMPRESSION
 
 UNINITIALIZED_TEST(ContextSerializerContext) {
@@ -3119,6 +3146,68 @@ TEST(CodeSerializerAfterExecute) {
   isolate2->Dispose();
 }
 
+TEST(CodeSerializerScopeCache) {
+  const char* js_source =
+      "function f() {"
+      "  var s = '';"
+      "  for (var i = 0; i < 3; i++) s += 'abc'[i];"
+      "  return s;"
+      "};"
+      "f() + 'def'";
+  v8::ScriptCompiler::CachedData* code_cache;
+  v8::ScriptCompiler::CachedData* scope_cache;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+
+    // The scope cache leaves out the bytecode of f, which has run by now.
+    code_cache = v8::ScriptCompiler::CreateCodeCache(script);
+    scope_cache = v8::ScriptCompiler::CreateScopeCache(script);
+    CHECK_NOT_NULL(code_cache);
+    CHECK_NOT_NULL(scope_cache);
+    CHECK_LT(scope_cache->length, code_cache->length);
+  }
+  isolate1->Dispose();
+  delete code_cache;
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(v8_str(js_source), origin, scope_cache);
+    v8::Local<v8::UnboundScript> script;
+    {
+      DisallowCompilation no_compile_expected(
+          reinterpret_cast<Isolate*>(isolate2));
+      script = v8::ScriptCompiler::CompileUnboundScript(
+                   isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+                   .ToLocalChecked();
+    }
+    CHECK(!scope_cache->rejected);
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->Equals(context, v8_str("abcdef")).FromJust());
+  }
+  isolate2->Dispose();
+}
+
 TEST(CodeSerializerEmptyContextDependency) {
   bool prev_allow_natives_syntax = v8_flags.allow_natives_syntax;
   v8_flags.allow_natives_syntax = true;
@@ -3314,6 +3403,50 @@ TEST(CodeSerializerBitFlip) {
   isolate2->Dispose();
 }
 
+TEST(CodeSerializerChecksumVerifiedOnce) {
+  i::v8_flags.verify_snapshot_checksum = true;
+  i::v8_flags.verify_code_cache_checksum_once = true;
+  const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
+
+  // A flipped copy at a different address must still be rejected, no matter
+  // how often the original buffer has been consumed.
+  uint8_t* flipped_data = new uint8_t[cache->length];
+  MemCopy(flipped_data, cache->data, cache->length);
+  int arbitrary_spot = 237;
+  CHECK_LT(arbitrary_spot, cache->length);
+  flipped_data[arbitrary_spot] ^= 0x40;
+  v8::ScriptCompiler::CachedData* flipped =
+      new v8::ScriptCompiler::CachedData(
+          flipped_data, cache->length,
+          v8::ScriptCompiler::CachedData::BufferOwned);
+
+  for (int i = 0; i < 3; i++) {
+    v8::ScriptCompiler::CachedData* data = i < 2 ? cache : flipped;
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope iscope(isolate);
+      v8::HandleScope scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+
+      v8::ScriptOrigin origin(v8_str("test"));
+      v8::ScriptCompiler::Source source(v8_str(js_source), origin,
+                                        new v8::ScriptCompiler::CachedData(
+                                            data->data, data->length));
+      v8::ScriptCompiler::CompileUnboundScript(
+          isolate, &source, v8::ScriptCompiler::kConsumeCodeCache)
+          .ToLocalChecked();
+      CHECK_EQ(data == flipped, source.GetCachedData()->rejected);
+    }
+    isolate->Dispose();
+  }
+  delete flipped;
+  delete cache;
+}
+
 TEST(CodeSerializerWithHarmonyScoping) {
   const char* source1 = "'use strict'; let x = 'X'";
   const char* source2 = "'use strict'; let y = 'Y'";
@@ -4008,6 +4141,54 @@ UNINITIALIZED_TEST(SnapshotCreatorDuplicateFunctions) {
   FreeCurrentEmbeddedBlob();
 }
 
+UNINITIALIZED_TEST(SnapshotCreatorHotFunctionsWithKeep) {
+  DisableEmbeddedBlobRefcounting();
+  v8_flags.lazy_feedback_allocation = false;
+  v8_flags.snapshot_hot_functions = true;
+  v8::StartupData blob;
+  {
+    SnapshotCreatorParams testing_params;
+    v8::SnapshotCreator creator(testing_params.create_params);
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      CompileRun(
+          "function hot() { return 1; }\n"
+          "function cold() { return 2; }\n"
+          "hot();\n");
+      creator.SetDefaultContext(context);
+    }
+    blob =
+        creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kKeep);
+  }
+
+  {
+    v8::Isolate::CreateParams params;
+    params.snapshot_blob = &blob;
+    params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    // Test-appropriate equivalent of v8::Isolate::New.
+    v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      DirectHandle<JSFunction> hot =
+          Cast<JSFunction>(Utils::OpenDirectHandle(*CompileRun("hot")));
+      DirectHandle<JSFunction> cold =
+          Cast<JSFunction>(Utils::OpenDirectHandle(*CompileRun("cold")));
+      CHECK(hot->shared()->is_snapshot_hot());
+      CHECK(!cold->shared()->is_snapshot_hot());
+      ExpectInt32("hot()", 1);
+    }
+    isolate->Dispose();
+  }
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
 #ifndef V8_SHARED_RO_HEAP
 // We do not support building multiple snapshots when read-only heap is shared.
 
@@ -1970,6 +1970,54 @@ TEST(InternalizeExternalStringTwoByte) {
   CHECK(string.equals(internal));
 }
 
+TEST(ExternalStringSlices) {
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  static const char kBuffer[] =
+      "content-type: text/html; charset=utf-8\nx-id: 7\n";
+  bool released = false;
+  {
+    v8::HandleScope scope(isolate);
+    std::shared_ptr<void> owner(const_cast<char*>(kBuffer),
+                                [&released](void*) { released = true; });
+    const v8::String::ExternalSlice slices[] = {
+        {0, 12}, {14, 24}, {39, 4}, {45, 1}};
+    v8::Local<v8::String> strings[arraysize(slices)];
+    CHECK(v8::String::NewExternalOneByteSlices(isolate, owner, kBuffer, slices,
+                                               arraysize(slices), strings));
+    const char* expected[] = {"content-type", "text/html; charset=utf-8",
+                              "x-id", "7"};
+    for (size_t i = 0; i < arraysize(slices); i++) {
+      CHECK(strings[i]->StringEquals(v8_str(expected[i])));
+    }
+    // Long slices point into the buffer, short ones are copied.
+    CHECK(strings[1]->IsExternalOneByte());
+    CHECK_EQ(kBuffer + 14,
+             strings[1]->GetExternalOneByteStringResource()->data());
+    CHECK(!IsInternalizedString(*v8::Utils::OpenDirectHandle(*strings[1])));
+    CHECK(!strings[0]->IsExternal());
+    CHECK(!strings[3]->IsExternal());
+
+    v8::Local<v8::String> internalized;
+    CHECK(v8::String::NewExternalOneByteSlices(
+        isolate, owner, kBuffer, &slices[1], 1, &internalized,
+        v8::NewStringType::kInternalized));
+    CHECK(IsInternalizedString(*v8::Utils::OpenDirectHandle(*internalized)));
+
+    // The strings keep the buffer alive.
+    owner.reset();
+    CHECK(!released);
+  }
+  {
+    // We need to invoke GC without stack, otherwise the strings may not be
+    // reclaimed because of conservative stack scanning.
+    i::DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+        CcTest::heap());
+    i::heap::InvokeMemoryReducingMajorGCs(CcTest::heap());
+  }
+  CHECK(released);
+}
+
 class UncachedExternalOneByteResource
     : public v8::String::ExternalOneByteStringResource {
  public:
@@ -17,6 +17,7 @@
 #include "src/objects/objects-inl.h"
 #include "src/objects/transitions-inl.h"
 #include "test/cctest/cctest.h"
+#include "test/cctest/heap/heap-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -464,5 +465,34 @@ UNINITIALIZED_TEST(TransitionArray_InsertToBinarySearchSizeAfterRehashing) {
   FreeCurrentEmbeddedBlob();
 }
 
+TEST(TransitionArray_PruneDeprecatedTransitions) {
+  v8_flags.prune_deprecated_transitions = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+
+  CompileRun(
+      "var keep = {x: 1};"
+      "var a = {x: 1}; a.foo = 1;"
+      "var b = {x: 1}; b.bar = 1;");
+  DirectHandle<JSObject> keep =
+      Cast<JSObject>(v8::Utils::OpenDirectHandle(*CompileRun("keep")));
+  DirectHandle<Map> map(keep->map(), isolate);
+  CHECK_EQ(2, TestTransitionsAccessor(isolate, map).NumberOfTransitions());
+
+  // Generalizing x from Smi to Double deprecates the whole tree below it.
+  CompileRun("var c = {x: 1}; c.x = 0.5;");
+  CHECK(map->is_deprecated());
+
+  heap::InvokeMajorGC(CcTest::heap());
+
+  // The targets are still alive, but the deprecated map no longer refers to
+  // them, and the objects using them still work.
+  CHECK_EQ(0, TestTransitionsAccessor(isolate, map).NumberOfTransitions());
+  CHECK_EQ(2, CompileRun("a.x + b.bar")
+                  ->Int32Value(CcTest::isolate()->GetCurrentContext())
+                  .FromJust());
+}
+
 }  // namespace internal
 }  // namespace v8
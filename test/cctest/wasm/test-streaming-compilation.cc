@@ -1429,6 +1429,30 @@ STREAM_TEST(TestFunctionSectionWithoutCodeSection) {
   CHECK(tester.IsPromiseRejected());
 }
 
+STREAM_TEST(TestBackPressure) {
+  FlagScope<bool> lazy_compilation(&v8_flags.wasm_lazy_compilation, true);
+  FlagScope<bool> eager_validation(&v8_flags.wasm_lazy_validation, false);
+  StreamTester tester(isolate);
+  std::vector<bool> signals;
+  // Ask to pause as soon as any function body is not validated yet.
+  tester.stream()->SetBackPressureCallback(
+      0, [&signals](bool pause) { signals.push_back(pause); });
+
+  ZoneBuffer buffer = GetValidModuleBytes(tester.zone());
+  tester.OnBytesReceived(buffer.begin(), buffer.size());
+  CHECK_EQ(1, signals.size());
+  CHECK(signals[0]);
+
+  // Validating the function bodies lets the stream continue.
+  tester.RunCompilerTasks();
+  CHECK_EQ(2, signals.size());
+  CHECK(!signals[1]);
+
+  tester.FinishStream();
+  tester.RunCompilerTasks();
+  CHECK(tester.IsPromiseFulfilled());
+}
+
 STREAM_TEST(TestMoreFunctionsCanBeSerializedCallback) {
   // The "more functions can be serialized" callback will only be triggered with
   // dynamic tiering, so skip this test if dynamic tiering is disabled.
@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -104,6 +105,21 @@ class WasmSerializationTest {
     CHECK_EQ(42, result);
   }
 
+  // Runs the exported function of a module object that is not instantiated
+  // yet.
+  static void InstantiateAndRun(DirectHandle<WasmModuleObject> module_object) {
+    Isolate* isolate = CcTest::i_isolate();
+    ErrorThrower thrower(isolate, "");
+    DirectHandle<WasmInstanceObject> instance =
+        GetWasmEngine()
+            ->SyncInstantiate(isolate, &thrower, module_object, {}, {})
+            .ToHandleChecked();
+    DirectHandle<Object> params[] = {direct_handle(Smi::FromInt(41), isolate)};
+    int32_t result = testing::CallWasmFunctionForTesting(
+        isolate, instance, kFunctionName, base::ArrayVector(params));
+    CHECK_EQ(42, result);
+  }
+
   void CollectGarbage() {
     // Try hard to collect all garbage and will therefore also invoke all weak
     // callbacks of actually unreachable persistent handles.
@@ -433,6 +449,96 @@ TEST(SerializeTieringBudget) {
   }
 }
 
+TEST(IncrementalSerializationDeserializesLazily) {
+  WasmSerializationTest test;
+
+  Isolate* isolate = CcTest::i_isolate();
+  v8::OwnedBuffer serialized_bytes;
+  {
+    HandleScope scope(isolate);
+    DirectHandle<WasmModuleObject> module_object;
+    CHECK(test.Deserialize().ToHandle(&module_object));
+
+    v8::Local<v8::Object> v8_module_obj =
+        v8::Utils::ToLocal(Cast<JSObject>(module_object));
+    v8::CompiledWasmModule compiled_module =
+        v8_module_obj.As<v8::WasmModuleObject>()->GetCompiledModule();
+    serialized_bytes = compiled_module.SerializeNewFunctions();
+    CHECK_LT(0, serialized_bytes.size);
+    // The TurboFan code was serialized already, so there is nothing new.
+    CHECK_EQ(0, compiled_module.SerializeNewFunctions().size);
+  }
+  // We need to invoke GC without stack, otherwise some objects may survive.
+  DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      isolate->heap());
+  test.CollectGarbage();
+  HandleScope scope(isolate);
+  DirectHandle<WasmModuleObject> module_object;
+  CompileTimeImports compile_imports = test.MakeCompileTimeImports();
+  base::OwnedVector<const uint8_t> wire_bytes_copy =
+      base::OwnedCopyOf(test.wire_bytes());
+  CHECK(
+      DeserializeNativeModule(
+          isolate, WasmEnabledFeatures::FromIsolate(isolate),
+          base::VectorOf(serialized_bytes.buffer.get(), serialized_bytes.size),
+          wire_bytes_copy, compile_imports, {})
+          .ToHandle(&module_object));
+
+  auto* native_module = module_object->native_module();
+  WasmCodeRefScope code_ref_scope;
+  // The TurboFan code is only deserialized on the first call.
+  CHECK_NULL(native_module->GetCode(2));
+
+  WasmSerializationTest::InstantiateAndRun(module_object);
+  WasmCode* turbofan_code = native_module->GetCode(2);
+  CHECK_NOT_NULL(turbofan_code);
+  CHECK_EQ(ExecutionTier::kTurbofan, turbofan_code->tier());
+  // Functions without serialized code are compiled lazily as usual.
+  CHECK_NULL(native_module->GetCode(0));
+}
+
+TEST(CompileFromCodeCacheFile) {
+  WasmSerializationTest test;
+  FlagScope<const char*> code_cache_dir(
+      &v8_flags.experimental_wasm_code_cache_dir, ".");
+
+  Isolate* isolate = CcTest::i_isolate();
+  std::string path;
+  {
+    HandleScope scope(isolate);
+    DirectHandle<WasmModuleObject> module_object;
+    CHECK(test.Deserialize().ToHandle(&module_object));
+    NativeModule* native_module = module_object->native_module();
+    path = CodeCacheFilePath(native_module);
+    remove(path.c_str());
+    AppendToCodeCacheFile(native_module);
+  }
+  // We need to invoke GC without stack, otherwise some objects may survive.
+  DisableConservativeStackScanningScopeForTesting no_stack_scanning(
+      isolate->heap());
+  test.CollectGarbage();
+
+  // Compiling the module again uses the code of the file instead.
+  HandleScope scope(isolate);
+  ErrorThrower thrower(isolate, "");
+  DirectHandle<WasmModuleObject> module_object =
+      GetWasmEngine()
+          ->SyncCompile(isolate, WasmEnabledFeatures::FromIsolate(isolate),
+                        test.MakeCompileTimeImports(), &thrower,
+                        base::OwnedCopyOf(test.wire_bytes()))
+          .ToHandleChecked();
+  NativeModule* native_module = module_object->native_module();
+  CHECK_NOT_NULL(native_module->lazily_deserialized_code());
+  WasmCodeRefScope code_ref_scope;
+  CHECK_NULL(native_module->GetCode(2));
+
+  WasmSerializationTest::InstantiateAndRun(module_object);
+  WasmCode* turbofan_code = native_module->GetCode(2);
+  CHECK_NOT_NULL(turbofan_code);
+  CHECK_EQ(ExecutionTier::kTurbofan, turbofan_code->tier());
+  remove(path.c_str());
+}
+
 TEST(SerializationFailsOnChangedFlags) {
   WasmSerializationTest test;
   {
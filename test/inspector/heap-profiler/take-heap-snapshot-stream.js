@@ -0,0 +1,70 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+let {session, contextGroup, Protocol} = InspectorTest.start(
+    'Checks that heap snapshots can be read as a stream.');
+
+async function readAll(handle, size) {
+  let data = '';
+  let reads = 0;
+  while (true) {
+    const {result} =
+        await Protocol.HeapProfiler.readHeapSnapshotStream({handle, size});
+    data += result.data;
+    reads++;
+    if (result.eof) return {data, reads};
+  }
+}
+
+InspectorTest.runAsyncTestSuite([
+  async function testJSON() {
+    let chunks = 0;
+    Protocol.HeapProfiler.onAddHeapSnapshotChunk(() => chunks++);
+    await Protocol.HeapProfiler.enable();
+    const {result} =
+        await Protocol.HeapProfiler.takeHeapSnapshot({returnAsStream: true});
+    const {data, reads} = await readAll(result.stream, 4096);
+    const snapshot = JSON.parse(data);
+    InspectorTest.log('has nodes: ' + (snapshot.nodes.length > 0));
+    InspectorTest.log('several reads: ' + (reads > 1));
+    InspectorTest.log('chunk events: ' + chunks);
+    const eofRead = await Protocol.HeapProfiler.readHeapSnapshotStream(
+        {handle: result.stream});
+    InspectorTest.log('read after end: ' + JSON.stringify(eofRead.result));
+    await Protocol.HeapProfiler.closeHeapSnapshotStream(
+        {handle: result.stream});
+    await Protocol.HeapProfiler.disable();
+  },
+
+  async function testBinary() {
+    await Protocol.HeapProfiler.enable();
+    const {result} = await Protocol.HeapProfiler.takeHeapSnapshot(
+        {returnAsStream: true, binaryFormat: true});
+    const header = await Protocol.HeapProfiler.readHeapSnapshotStream(
+        {handle: result.stream, size: 4});
+    InspectorTest.log('magic: ' + JSON.stringify(header.result));
+    const {reads} = await readAll(result.stream, 64 * 1024);
+    InspectorTest.log('read to the end: ' + (reads > 0));
+    await Protocol.HeapProfiler.closeHeapSnapshotStream(
+        {handle: result.stream});
+    await Protocol.HeapProfiler.disable();
+  },
+
+  async function testErrors() {
+    await Protocol.HeapProfiler.enable();
+    InspectorTest.logMessage(await Protocol.HeapProfiler.takeHeapSnapshot(
+        {binaryFormat: true}));
+    InspectorTest.logMessage(await Protocol.HeapProfiler.readHeapSnapshotStream(
+        {handle: 'heap-snapshot-0'}));
+    const {result} =
+        await Protocol.HeapProfiler.takeHeapSnapshot({returnAsStream: true});
+    InspectorTest.logMessage(await Protocol.HeapProfiler.readHeapSnapshotStream(
+        {handle: result.stream, size: 0}));
+    await Protocol.HeapProfiler.closeHeapSnapshotStream(
+        {handle: result.stream});
+    InspectorTest.logMessage(await Protocol.HeapProfiler.closeHeapSnapshotStream(
+        {handle: result.stream}));
+    await Protocol.HeapProfiler.disable();
+  }
+]);
@@ -0,0 +1,47 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+let {session, contextGroup, Protocol} = InspectorTest.start(
+    'Checks that console messages can be reported without previews.');
+
+async function logObject() {
+  const wait = Protocol.Runtime.onceConsoleAPICalled();
+  Protocol.Runtime.evaluate({expression: 'console.log({a: 1}, 42)'});
+  const {params} = await wait;
+  const [object, number] = params.args;
+  InspectorTest.log(
+      'preview: ' + ('preview' in object) + ', objectId: ' +
+      ('objectId' in object) + ', number: ' + number.value);
+  return object;
+}
+
+InspectorTest.runAsyncTestSuite([
+  async function testNotEnabled() {
+    InspectorTest.logMessage(
+        await Protocol.Runtime.setConsolePreviewsEnabled({enabled: false}));
+  },
+
+  async function testDisabledAndEnabled() {
+    await Protocol.Runtime.enable();
+    await Protocol.Runtime.setConsolePreviewsEnabled({enabled: false});
+    const object = await logObject();
+    const {result} = await Protocol.Runtime.getProperties(
+        {objectId: object.objectId, ownProperties: true, generatePreview: true});
+    InspectorTest.log(
+        'has property a: ' + result.result.some(p => p.name === 'a'));
+    await Protocol.Runtime.setConsolePreviewsEnabled({enabled: true});
+    await logObject();
+    await Protocol.Runtime.disable();
+  },
+
+  async function testResetOnDisable() {
+    await Protocol.Runtime.enable();
+    await Protocol.Runtime.setConsolePreviewsEnabled({enabled: false});
+    await Protocol.Runtime.disable();
+    await Protocol.Runtime.discardConsoleEntries();
+    await Protocol.Runtime.enable();
+    await logObject();
+    await Protocol.Runtime.disable();
+  }
+]);
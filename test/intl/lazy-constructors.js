@@ -0,0 +1,44 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Intl.DisplayNames and Intl.Segmenter are created on first access, but must
+// look like ordinary data properties of Intl.
+
+for (const name of ["DisplayNames", "Segmenter"]) {
+  assertTrue(Object.getOwnPropertyNames(Intl).includes(name));
+  assertFalse(Object.keys(Intl).includes(name));
+
+  const descriptor = Object.getOwnPropertyDescriptor(Intl, name);
+  assertEquals("function", typeof descriptor.value);
+  assertTrue(descriptor.writable);
+  assertFalse(descriptor.enumerable);
+  assertTrue(descriptor.configurable);
+  assertSame(descriptor.value, Intl[name]);
+  assertEquals(name, Intl[name].name);
+  assertEquals(`Intl.${name}`,
+               Intl[name].prototype[Symbol.toStringTag]);
+}
+
+assertEquals(2, Intl.DisplayNames.length);
+assertEquals("English",
+             new Intl.DisplayNames(["en"], {type: "language"}).of("en"));
+
+const segments = [...new Intl.Segmenter("en", {granularity: "word"})
+                      .segment("lazy fox")];
+assertEquals(["lazy", " ", "fox"], segments.map(s => s.segment));
+assertTrue(segments[0].isWordLike);
+
+// Every realm gets its own constructors.
+const realm = Realm.create();
+const other_segmenter = Realm.eval(realm, "Intl.Segmenter");
+assertNotSame(Intl.Segmenter, other_segmenter);
+assertSame(other_segmenter, Realm.eval(realm, "Intl.Segmenter"));
+assertInstanceof(Realm.eval(realm, "new Intl.Segmenter()"), other_segmenter);
+
+// Overwriting before the first access must not bring the constructor back.
+const realm2 = Realm.create();
+Realm.eval(realm2, "Intl.DisplayNames = 42");
+assertEquals(42, Realm.eval(realm2, "Intl.DisplayNames"));
+assertTrue(Realm.eval(realm2, "delete Intl.Segmenter"));
+assertEquals(undefined, Realm.eval(realm2, "Intl.Segmenter"));
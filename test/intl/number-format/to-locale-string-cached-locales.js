@@ -0,0 +1,24 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// toLocaleString caches the formatters of recently used locales; alternating
+// between more locales than fit in the cache must keep every result correct.
+
+const locales = ['en', 'de', 'fr', 'ar', 'hi', 'ja', 'ru', 'es', 'it', 'ko'];
+const expected = locales.map(
+    locale => new Intl.NumberFormat(locale).format(1234567.891));
+const expected_dates = locales.map(
+    locale => new Intl.DateTimeFormat(locale).format(new Date(0)));
+
+for (let round = 0; round < 3; round++) {
+  for (let i = 0; i < locales.length; i++) {
+    assertEquals(expected[i], (1234567.891).toLocaleString(locales[i]));
+    assertEquals(expected_dates[i],
+                 new Date(0).toLocaleDateString(locales[i]));
+  }
+  // Hit the most recently used entries again.
+  for (let i = locales.length - 1; i >= 0; i--) {
+    assertEquals(expected[i], (1234567.891).toLocaleString(locales[i]));
+  }
+}
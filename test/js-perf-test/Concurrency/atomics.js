@@ -0,0 +1,53 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A single-producer single-consumer queue on a SharedArrayBuffer, as used to
+// coordinate workers. The producer notifies after each push and the consumer
+// checks with Atomics.waitAsync() before each pop. Both run on this thread,
+// so the notifications find no waiters and the checks find the queue
+// non-empty: this measures the cost of the protocol, not of waking up.
+
+new BenchmarkSuite('Atomics', [1000], [
+  new Benchmark('Queue', false, false, 0, AtomicsQueue, AtomicsSetup),
+  new Benchmark('WaitAsyncNotEqual', false, false, 0, AtomicsWaitAsyncNotEqual,
+                AtomicsSetup),
+]);
+
+var kQueueCapacity = 64;
+// [head, tail, ...slots]
+var queue;
+
+function AtomicsSetup() {
+  var bytes = (2 + kQueueCapacity) * Int32Array.BYTES_PER_ELEMENT;
+  queue = new Int32Array(new SharedArrayBuffer(bytes));
+}
+
+function Push(value) {
+  var tail = Atomics.load(queue, 1);
+  Atomics.store(queue, 2 + tail % kQueueCapacity, value);
+  Atomics.store(queue, 1, tail + 1);
+  Atomics.notify(queue, 1);
+}
+
+function Pop() {
+  var head = Atomics.load(queue, 0);
+  // Returns synchronously with "not-equal" while the queue is non-empty.
+  Atomics.waitAsync(queue, 1, head);
+  var value = Atomics.load(queue, 2 + head % kQueueCapacity);
+  Atomics.store(queue, 0, head + 1);
+  return value;
+}
+
+function AtomicsQueue() {
+  var sum = 0;
+  for (var i = 0; i < kQueueCapacity; i++) Push(i);
+  for (var i = 0; i < kQueueCapacity; i++) sum += Pop();
+  return sum;
+}
+
+function AtomicsWaitAsyncNotEqual() {
+  var result;
+  for (var i = 0; i < 100; i++) result = Atomics.waitAsync(queue, 0, -1);
+  return result;
+}
@@ -0,0 +1,37 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Several contexts in one isolate, as embedders hosting many tenants use
+// them.
+
+new BenchmarkSuite('Realms', [1000], [
+  new Benchmark('CreateDispose', false, false, 0, RealmCreateDispose),
+  new Benchmark('CrossRealmCall', false, false, 0, CrossRealmCall,
+                CrossRealmSetup, CrossRealmTearDown),
+]);
+
+function RealmCreateDispose() {
+  var realm = Realm.create();
+  Realm.dispose(realm);
+}
+
+var otherRealm;
+var otherRealmAdd;
+
+function CrossRealmSetup() {
+  otherRealm = Realm.createAllowCrossRealmAccess();
+  otherRealmAdd = Realm.eval(otherRealm, '(function(a, b) { return a + b; })');
+}
+
+function CrossRealmCall() {
+  var sum = 0;
+  for (var i = 0; i < 100; i++) sum = otherRealmAdd(sum, i);
+  return sum;
+}
+
+function CrossRealmTearDown() {
+  Realm.dispose(otherRealm);
+  otherRealm = undefined;
+  otherRealmAdd = undefined;
+}
@@ -0,0 +1,29 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+
+d8.file.execute('../base.js');
+d8.file.execute('serializer.js');
+d8.file.execute('realms.js');
+d8.file.execute('atomics.js');
+d8.file.execute('shared-struct.js');
+
+var success = true;
+
+function PrintResult(name, result) {
+  print(name + '-Concurrency(Score): ' + result);
+}
+
+
+function PrintError(name, error) {
+  PrintResult(name, error);
+  success = false;
+}
+
+
+BenchmarkSuite.config.doWarmup = undefined;
+BenchmarkSuite.config.doDeterministic = undefined;
+
+BenchmarkSuite.RunSuites({ NotifyResult: PrintResult,
+                           NotifyError: PrintError });
@@ -0,0 +1,56 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// ValueSerializer throughput, the structured clone behind postMessage().
+
+new BenchmarkSuite('Serializer', [1000], [
+  new Benchmark('SerializeObjects', false, false, 0, SerializeObjects,
+                SerializerSetup),
+  new Benchmark('DeserializeObjects', false, false, 0, DeserializeObjects,
+                SerializerSetup),
+  new Benchmark('SerializeTypedArray', false, false, 0, SerializeTypedArray,
+                SerializerSetup),
+  new Benchmark('DeserializeTypedArray', false, false, 0,
+                DeserializeTypedArray, SerializerSetup),
+]);
+
+var messageObjects;
+var messageTypedArray;
+var serializedObjects;
+var serializedTypedArray;
+
+function SerializerSetup() {
+  messageObjects = [];
+  for (var i = 0; i < 100; i++) {
+    messageObjects.push({
+      id: i,
+      name: 'item' + i,
+      price: i * 1.5,
+      tags: ['a', 'b', 'c'],
+      nested: {flag: i % 2 == 0, when: new Date(i)},
+    });
+  }
+  messageTypedArray = new Float64Array(1024);
+  for (var i = 0; i < messageTypedArray.length; i++) {
+    messageTypedArray[i] = i / 3;
+  }
+  serializedObjects = d8.serializer.serialize(messageObjects);
+  serializedTypedArray = d8.serializer.serialize(messageTypedArray);
+}
+
+function SerializeObjects() {
+  return d8.serializer.serialize(messageObjects);
+}
+
+function DeserializeObjects() {
+  return d8.serializer.deserialize(serializedObjects);
+}
+
+function SerializeTypedArray() {
+  return d8.serializer.serialize(messageTypedArray);
+}
+
+function DeserializeTypedArray() {
+  return d8.serializer.deserialize(serializedTypedArray);
+}
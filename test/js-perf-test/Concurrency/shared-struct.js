@@ -0,0 +1,57 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Shared structs and shared arrays, which live in the shared heap.
+
+new BenchmarkSuite('SharedStruct', [1000], [
+  new Benchmark('Construct', false, false, 0, SharedStructConstruct,
+                SharedStructSetup),
+  new Benchmark('FieldAccess', false, false, 0, SharedStructFieldAccess,
+                SharedStructSetup),
+  new Benchmark('AtomicFieldAccess', false, false, 0,
+                SharedStructAtomicFieldAccess, SharedStructSetup),
+  new Benchmark('SharedArrayAccess', false, false, 0, SharedArrayAccess,
+                SharedStructSetup),
+]);
+
+var Point;
+var point;
+var sharedArray;
+
+function SharedStructSetup() {
+  Point = new SharedStructType(['x', 'y']);
+  point = new Point();
+  point.x = 0;
+  point.y = 0;
+  sharedArray = new SharedArray(100);
+  for (var i = 0; i < sharedArray.length; i++) sharedArray[i] = i;
+}
+
+function SharedStructConstruct() {
+  var p;
+  for (var i = 0; i < 100; i++) p = new Point();
+  return p;
+}
+
+function SharedStructFieldAccess() {
+  for (var i = 0; i < 100; i++) {
+    point.x = i;
+    point.y = point.x + 1;
+  }
+  return point.y;
+}
+
+function SharedStructAtomicFieldAccess() {
+  for (var i = 0; i < 100; i++) {
+    Atomics.store(point, 'x', i);
+    Atomics.store(point, 'y', Atomics.load(point, 'x') + 1);
+  }
+  return Atomics.load(point, 'y');
+}
+
+function SharedArrayAccess() {
+  var sum = 0;
+  for (var i = 0; i < sharedArray.length; i++) sum += sharedArray[i];
+  return sum;
+}
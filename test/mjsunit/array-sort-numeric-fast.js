@@ -0,0 +1,87 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Packed numeric arrays sorted without a comparator or with a trivial
+// numeric one are sorted natively. Compare against a reference sort that
+// always calls the comparator.
+
+function ReferenceSort(array, comparefn) {
+  const result = Array.from(array);
+  for (let i = 1; i < result.length; i++) {
+    const value = result[i];
+    let j = i - 1;
+    while (j >= 0 && comparefn(result[j], value) > 0) {
+      result[j + 1] = result[j];
+      j--;
+    }
+    result[j + 1] = value;
+  }
+  return result;
+}
+
+function RandomSmis(length) {
+  return Array.from({length}, (_, i) => ((i * 7919) % 401) - 200);
+}
+
+const ascending = (a, b) => a - b;
+const descending = (a, b) => b - a;
+function ascendingFunction(a, b) { return a - b; }
+const notTrivial = (a, b) => (a % 10) - (b % 10);
+
+(function TestSmis() {
+  const smis = RandomSmis(100);
+  const lexicographic = (a, b) => String(a) < String(b) ? -1 :
+                                  String(a) > String(b) ? 1 : 0;
+  assertEquals(ReferenceSort(smis, lexicographic), [...smis].sort());
+  for (const comparefn of
+       [ascending, descending, ascendingFunction, notTrivial]) {
+    assertEquals(ReferenceSort(smis, comparefn), [...smis].sort(comparefn));
+  }
+})();
+
+(function TestDoubles() {
+  const doubles = RandomSmis(100).map(x => x / 4);
+  doubles.push(0, -0, Infinity, -Infinity, 0, -0);
+  for (const comparefn of [ascending, descending, notTrivial]) {
+    const expected = ReferenceSort(doubles, comparefn);
+    const actual = [...doubles].sort(comparefn);
+    assertEquals(expected.length, actual.length);
+    // assertEquals distinguishes -0 from +0, so this also checks stability.
+    for (let i = 0; i < expected.length; i++) {
+      assertEquals(expected[i], actual[i]);
+    }
+  }
+
+  // NaN makes the comparators inconsistent; just check nothing gets lost.
+  const withNaN = [...doubles, NaN, NaN];
+  const sorted = withNaN.sort(ascending);
+  assertEquals(doubles.length + 2, sorted.length);
+  assertEquals(2, sorted.filter(x => Number.isNaN(x)).length);
+})();
+
+(function TestInPlace() {
+  const smis = RandomSmis(64);
+  assertSame(smis, smis.sort(descending));
+  assertEquals(200, smis[0]);
+  // Copy-on-write literals must not be sorted in place.
+  function Literal() { return [5, 4, 3, 2, 1, 0, 5, 4, 3, 2, 1, 0, 5, 4, 3, 2,
+                               1, 0, 5, 4, 3, 2, 1, 0, 5, 4, 3, 2, 1, 0, 5, 4]; }
+  Literal().sort(ascending);
+  assertEquals(5, Literal()[0]);
+})();
+
+(function TestTypedArrays() {
+  const smis = RandomSmis(100);
+  for (const ctor of [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array,
+                      Uint16Array, Int32Array, Uint32Array, Float32Array,
+                      Float64Array]) {
+    const array = new ctor(smis);
+    for (const comparefn of [ascending, descending, notTrivial]) {
+      assertEquals(ReferenceSort(array, comparefn),
+                   Array.from(new ctor(array).sort(comparefn)));
+    }
+  }
+  // BigInt results can't be converted to Numbers.
+  assertThrows(() => new BigInt64Array([1n, 2n]).sort(ascending), TypeError);
+})();
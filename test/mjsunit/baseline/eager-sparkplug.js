@@ -0,0 +1,34 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --eager-sparkplug --concurrent-sparkplug --baseline-batch-compilation
+// Flags: --allow-natives-syntax
+
+function sum(n) {
+  let s = 0;
+  for (let i = 0; i < n; i++) s += i;
+  return s;
+}
+
+function nested(n) {
+  let s = 0;
+  for (let i = 0; i < n; i++) {
+    for (let j = 0; j < i; j++) s += j;
+  }
+  return s;
+}
+
+function noLoop(a, b) {
+  return a * b + 1;
+}
+
+for (let i = 0; i < 100; i++) {
+  assertEquals(4950, sum(100));
+  assertEquals(161700, nested(100));
+  assertEquals(43, noLoop(6, 7));
+}
+// Whenever the concurrently compiled code gets installed, it has to behave
+// like the bytecode.
+%CompileBaseline(sum);
+assertEquals(4950, sum(100));
@@ -0,0 +1,48 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --sparkplug --no-always-sparkplug
+// Flags: --shared-baseline-code-cache
+
+// Workers run in their own isolates, so compiling the same function in a
+// worker instantiates the code recorded by the main isolate.
+
+function work(n) {
+  let o = {name: 'x', values: []};
+  for (let i = 0; i < n; i++) {
+    switch (i % 3) {
+      case 0: o.values.push(i); break;
+      case 1: o.values.push(o.name + i); break;
+      default: o.values.push(1.5 * i);
+    }
+  }
+  try {
+    o.missing.property;
+  } catch (e) {
+    o.values.push(e instanceof TypeError);
+  }
+  return JSON.stringify(o);
+}
+
+%NeverOptimizeFunction(work);
+const expected = work(10);
+%CompileBaseline(work);
+assertTrue(isBaseline(work));
+assertEquals(expected, work(10));
+
+function workerMain() {
+  onmessage = function({data: source}) {
+    const work = eval('(' + source + ')');
+    %NeverOptimizeFunction(work);
+    %CompileBaseline(work);
+    postMessage(work(10));
+  };
+}
+
+for (let i = 0; i < 2; i++) {
+  const worker = new Worker(workerMain, {type: 'function'});
+  worker.postMessage(work.toString());
+  assertEquals(expected, worker.getMessage());
+  worker.terminate();
+}
@@ -0,0 +1,70 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// This file excercises two byte string support for fast API calls.
+
+// Flags: --turbo-fast-api-calls --expose-fast-api --allow-natives-syntax --turbofan
+// The test relies on optimizing/deoptimizing at predictable moments, so
+// it's not suitable for deoptimization fuzzing.
+// Flags: --deopt-every-n-times=0
+// Flags: --fast-api-allow-float-in-sim
+
+const fast_c_api = new d8.test.FastCAPI();
+
+function assertSlowCall(input) {
+  assertEquals(new Uint16Array(input.length), copy_string(input));
+}
+
+function assertFastCall(input) {
+  const chars = Uint16Array.from(input, c => c.charCodeAt(0));
+  assertEquals(chars, copy_string(input));
+}
+
+function copy_string(input) {
+  const buffer = new Uint16Array(input.length);
+  fast_c_api.copy_two_byte_string(input, buffer);
+  return buffer;
+}
+
+%PrepareFunctionForOptimization(copy_string);
+assertSlowCall('नमस्ते');
+%OptimizeFunctionOnNextCall(copy_string);
+
+fast_c_api.reset_counts();
+assertFastCall('नमस्ते');
+assertFastCall('ሴt');
+assertFastCall(['नमस्ते', 'World'].join(''));
+assertOptimized(copy_string);
+assertEquals(3, fast_c_api.fast_call_count());
+assertEquals(0, fast_c_api.slow_call_count());
+
+// Fall back for one byte strings.
+fast_c_api.reset_counts();
+assertSlowCall('Hello');
+assertSlowCall(['Hello', 'World'].join(''));
+assertOptimized(copy_string);
+assertEquals(0, fast_c_api.fast_call_count());
+assertEquals(2, fast_c_api.slow_call_count());
+
+// Fall back for cons and sliced strings.
+function getTwoByteString() {
+  return 'ሴt';
+}
+function getCons() {
+  return 'hello' + getTwoByteString();
+}
+
+fast_c_api.reset_counts();
+assertSlowCall(getCons());
+assertSlowCall(getCons().slice(1));
+assertOptimized(copy_string);
+assertEquals(0, fast_c_api.fast_call_count());
+assertEquals(2, fast_c_api.slow_call_count());
+
+// Fall back for SMI and non-string inputs.
+fast_c_api.reset_counts();
+assertSlowCall(1);
+assertSlowCall({});
+assertEquals(0, fast_c_api.fast_call_count());
+assertEquals(2, fast_c_api.slow_call_count());
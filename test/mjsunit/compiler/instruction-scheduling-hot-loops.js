@@ -0,0 +1,46 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan
+// Flags: --turbo-instruction-scheduling-hot-loops
+
+// Only the blocks of the loop are scheduled, the code around it is emitted in
+// selection order.
+
+function checksum(bytes) {
+  let a = 1;
+  let b = 0;
+  for (let i = 0; i < bytes.length; i++) {
+    a = (a + bytes[i]) % 65521;
+    b = (b + a) % 65521;
+    if (bytes[i] === 0xFF) {
+      // Deferred, since this branch is never taken during warm-up.
+      b = Math.imul(b, 31) >>> 0;
+    }
+  }
+  return ((b << 16) | a) >>> 0;
+}
+
+function reference(bytes) {
+  let a = 1;
+  let b = 0;
+  for (let x of bytes) {
+    a = (a + x) % 65521;
+    b = (b + a) % 65521;
+    if (x === 0xFF) b = Math.imul(b, 31) >>> 0;
+  }
+  return ((b << 16) | a) >>> 0;
+}
+
+const input = new Uint8Array(1000);
+for (let i = 0; i < input.length; i++) input[i] = (i * 37) % 255;
+
+%PrepareFunctionForOptimization(checksum);
+assertEquals(reference(input), checksum(input));
+%OptimizeFunctionOnNextCall(checksum);
+assertEquals(reference(input), checksum(input));
+assertOptimized(checksum);
+
+input[500] = 0xFF;
+assertEquals(reference(input), checksum(input));
@@ -0,0 +1,43 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan
+// Flags: --turbo-regalloc-live-range-budget=1
+
+// Every function is over budget, so registers are allocated without live
+// range bundles, predecessor state heuristics and move optimization.
+
+function mix(values, selector) {
+  let a = 0, b = 1, c = 2, d = 3;
+  for (let i = 0; i < values.length; i++) {
+    let v = values[i];
+    switch ((v + selector) & 3) {
+      case 0: a += v; b ^= a; break;
+      case 1: b += v * 3; c -= b; break;
+      case 2: c += v >> 1; d = d * 31 + c | 0; break;
+      default: d -= v; a = a + d | 0;
+    }
+    if (v > 1000) {
+      // Deferred, never taken during warm-up.
+      a = b + c + d + 0.5;
+    }
+  }
+  return [a, b, c, d];
+}
+
+const values = [];
+for (let i = 0; i < 200; i++) values.push((i * 7919) % 97);
+
+%PrepareFunctionForOptimization(mix);
+const expected0 = mix(values, 0);
+const expected1 = mix(values, 1);
+%OptimizeFunctionOnNextCall(mix);
+assertEquals(expected0, mix(values, 0));
+assertEquals(expected1, mix(values, 1));
+
+values[100] = 5000;
+const deopted = mix(values, 2);
+%PrepareFunctionForOptimization(mix);
+%OptimizeFunctionOnNextCall(mix);
+assertEquals(deopted, mix(values, 2));
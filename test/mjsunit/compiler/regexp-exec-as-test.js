@@ -0,0 +1,102 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Calls to RegExp.prototype.exec whose result is only checked against null
+// don't need to build the result array. The match itself still has to update
+// lastIndex and the legacy RegExp statics.
+
+(function TestTruthiness() {
+  const re = /a(b+)c/;
+  function f(s) {
+    if (re.exec(s)) return 1;
+    return 0;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals(1, f('xabbc'));
+  assertEquals(0, f('xac'));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(1, f('zabbbc'));
+  assertEquals('bbb', RegExp.$1);
+  assertEquals('abbbc', RegExp.lastMatch);
+  assertEquals(0, f('zac'));
+  assertEquals('bbb', RegExp.$1);
+  assertOptimized(f);
+})();
+
+(function TestNullComparisons() {
+  const re = /(\d+)/;
+  function not_null(s) {
+    return re.exec(s) !== null;
+  }
+  function is_null(s) {
+    return re.exec(s) == null;
+  }
+  function negated(s) {
+    return !re.exec(s);
+  }
+  for (const f of [not_null, is_null, negated]) {
+    const matches = f === not_null;
+    %PrepareFunctionForOptimization(f);
+    assertEquals(matches, f('a12'));
+    assertEquals(!matches, f('abc'));
+    %OptimizeFunctionOnNextCall(f);
+    assertEquals(matches, f('b345'));
+    assertEquals('345', RegExp.$1);
+    assertEquals(!matches, f('xyz'));
+    assertOptimized(f);
+  }
+})();
+
+(function TestGlobalLoop() {
+  const re = /[a-z]+/g;
+  function count(s) {
+    let n = 0;
+    re.lastIndex = 0;
+    while (re.exec(s)) n++;
+    return n;
+  }
+  %PrepareFunctionForOptimization(count);
+  assertEquals(3, count('ab cd ef'));
+  %OptimizeFunctionOnNextCall(count);
+  assertEquals(4, count('one two three four'));
+  assertEquals(0, re.lastIndex);
+  assertEquals('four', RegExp.lastMatch);
+  assertOptimized(count);
+})();
+
+(function TestResultUsed() {
+  const re = /(x)(y)?/;
+  function f(s) {
+    const m = re.exec(s);
+    return m === null ? 'none' : m[1] + m.index;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertEquals('x1', f('ax'));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals('x2', f('aax'));
+  assertEquals('none', f('abc'));
+})();
+
+(function TestDeoptAfterMatch() {
+  const re = /(o+)/;
+  let deopt = false;
+  function g() {
+    if (deopt) %DeoptimizeFunction(f);
+  }
+  function f(s) {
+    const matched = re.exec(s) !== null;
+    g();
+    return matched;
+  }
+  %PrepareFunctionForOptimization(f);
+  assertTrue(f('foo'));
+  %OptimizeFunctionOnNextCall(f);
+  assertTrue(f('foo'));
+  deopt = true;
+  assertTrue(f('fooo'));
+  assertEquals('ooo', RegExp.$1);
+  assertFalse(f('bar'));
+})();
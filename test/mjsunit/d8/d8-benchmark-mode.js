@@ -0,0 +1,15 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --bench-iterations=3 --bench-warmup=1 --bench-isolates=3 --bench-threads=2
+
+// Every benchmark iteration runs this script in a fresh context of one of the
+// benchmark isolates, so a failing assertion fails the whole d8 run.
+
+assertEquals(undefined, globalThis.alreadyRan);
+globalThis.alreadyRan = true;
+
+let sum = 0;
+for (let i = 0; i < 1000; i++) sum += i;
+assertEquals(499500, sum);
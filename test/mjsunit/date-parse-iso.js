@@ -0,0 +1,46 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The common ISO forms are parsed without the general tokenizer; check them
+// against the equivalent component-wise constructions.
+
+assertEquals(Date.UTC(2015, 1, 28), Date.parse('2015-02-28'));
+assertEquals(Date.UTC(2015, 1, 28, 11, 22), Date.parse('2015-02-28T11:22Z'));
+assertEquals(Date.UTC(2015, 1, 28, 11, 22, 33),
+             Date.parse('2015-02-28T11:22:33Z'));
+assertEquals(Date.UTC(2015, 1, 28, 11, 22, 33, 444),
+             Date.parse('2015-02-28T11:22:33.444Z'));
+assertEquals(Date.UTC(2015, 1, 28, 10, 22, 33, 444),
+             Date.parse('2015-02-28T11:22:33.444+01:00'));
+assertEquals(Date.UTC(2015, 1, 28, 13, 52, 33, 444),
+             Date.parse('2015-02-28T11:22:33.444-02:30'));
+assertEquals(Date.UTC(2015, 1, 29), Date.parse('2015-02-28T24:00:00.000Z'));
+
+// Forms without an offset are local time.
+assertEquals(new Date(2015, 1, 28, 11, 22, 33, 444).getTime(),
+             Date.parse('2015-02-28T11:22:33.444'));
+assertEquals(new Date(2015, 6, 1, 0, 0).getTime(),
+             Date.parse('2015-07-01T00:00'));
+
+// Round trip through toISOString.
+for (let t = -1e12; t < 4e12; t += 123456789012) {
+  assertEquals(t, Date.parse(new Date(t).toISOString()));
+}
+
+// Variations that are handled by the general parser.
+assertEquals(Date.UTC(2015, 1, 28, 11, 22, 33, 400),
+             Date.parse('2015-02-28T11:22:33.4Z'));
+assertEquals(Date.UTC(2015, 1, 28, 11, 22, 33, 444),
+             Date.parse('2015-02-28T11:22:33.4449Z'));
+assertEquals(Date.UTC(2015, 1, 28, 10, 22), Date.parse('2015-02-28T11:22+0100'));
+assertEquals(Date.UTC(12345, 1, 28), Date.parse('+012345-02-28'));
+
+// Invalid inputs.
+assertEquals(NaN, Date.parse('2015-13-01'));
+assertEquals(NaN, Date.parse('2015-02-32'));
+assertEquals(NaN, Date.parse('2015-02-28T25:00Z'));
+assertEquals(NaN, Date.parse('2015-02-28T24:00:01Z'));
+assertEquals(NaN, Date.parse('2015-02-28T11:60Z'));
+assertEquals(NaN, Date.parse('2015-02-28T11:22:33.444+24:00'));
+assertEquals(NaN, Date.parse('2015-02-28T11:22:33.444Zjunk'));
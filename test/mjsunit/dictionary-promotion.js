@@ -0,0 +1,36 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-lazy-feedback-allocation
+// Flags: --dictionary-promotion-lookups=8
+
+// Every function has its own load IC, so each of them misses once.
+function LoadFromNewSite(object) {
+  return new Function('o', 'return o.a;')(object);
+}
+
+(function TestStableObjectBecomesFast() {
+  const config = {a: 1, b: 2, c: 3};
+  delete config.b;
+  assertFalse(%HasFastProperties(config));
+  for (let i = 0; i < 10; i++) {
+    assertEquals(1, LoadFromNewSite(config));
+  }
+  assertTrue(%HasFastProperties(config));
+  assertEquals(['a', 'c'], Object.keys(config));
+  assertEquals(3, config.c);
+})();
+
+(function TestChangingObjectStaysSlow() {
+  const object = {a: 1, b: 2};
+  delete object.b;
+  assertFalse(%HasFastProperties(object));
+  for (let i = 0; i < 20; i++) {
+    assertEquals(1, LoadFromNewSite(object));
+    object['x' + i] = i;
+    delete object['x' + i];
+  }
+  assertFalse(%HasFastProperties(object));
+})();
+
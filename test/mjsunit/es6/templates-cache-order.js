@@ -0,0 +1,51 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Template objects are cached per script in sorted order; sites that are
+// first evaluated out of source order must still get their own object.
+
+function tag(strings) { return strings; }
+
+function a() { return tag`a${1}`; }
+function b() { return tag`b${1}`; }
+function c() { return [tag`c0`, tag`c1`, tag`c2`]; }
+
+(function TestOutOfOrderEvaluation() {
+  const cs = c();
+  const bs = b();
+  const as = a();
+  assertEquals(['a', ''], [...as]);
+  assertEquals(['b', ''], [...bs]);
+  assertEquals(['c0'], [...cs[0]]);
+  assertEquals(['c2'], [...cs[2]]);
+  assertSame(as, a());
+  assertSame(bs, b());
+  const cs2 = c();
+  for (let i = 0; i < cs.length; i++) assertSame(cs[i], cs2[i]);
+  assertNotSame(cs[0], cs[1]);
+})();
+
+(function TestManySites() {
+  const sites = [];
+  for (let i = 0; i < 100; i++) {
+    sites.push(new Function('tag', `return tag\`site${i}\`;`));
+  }
+  const first = [];
+  for (let i = sites.length - 1; i >= 0; i--) first[i] = sites[i](tag);
+  for (let i = 0; i < sites.length; i++) {
+    assertEquals(`site${i}`, first[i][0]);
+    assertSame(first[i], sites[i](tag));
+  }
+})();
+
+(function TestOtherRealm() {
+  const realm = Realm.create();
+  const f = Realm.eval(realm, 'function t(s) { return s; } ' +
+                              '(function() { return [t`x`, t`y`]; })');
+  const r1 = f();
+  const r2 = f();
+  assertSame(r1[0], r2[0]);
+  assertSame(r1[1], r2[1]);
+  assertNotSame(r1[0], r1[1]);
+})();
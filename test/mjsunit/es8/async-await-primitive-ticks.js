@@ -0,0 +1,49 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Awaiting a primitive skips the wrapper promise. It must still take exactly
+// one microtask tick, just like awaiting an already fulfilled promise.
+
+const log = [];
+
+async function AwaitValue(name, value) {
+  log.push(name + ':' + (await value));
+  log.push(name + ':' + (await value));
+}
+
+function Run() {
+  log.length = 0;
+  AwaitValue('smi', 1);
+  AwaitValue('string', 'str');
+  AwaitValue('undefined', undefined);
+  AwaitValue('null', null);
+  AwaitValue('promise', Promise.resolve(2));
+  Promise.resolve().then(() => log.push('then'));
+  %PerformMicrotaskCheckpoint();
+  assertEquals([
+    'smi:1', 'string:str', 'undefined:undefined',
+    'null:null', 'promise:2', 'then',
+    'smi:1', 'string:str', 'undefined:undefined',
+    'null:null', 'promise:2'
+  ], log);
+}
+
+%PrepareFunctionForOptimization(AwaitValue);
+Run();
+Run();
+%OptimizeFunctionOnNextCall(AwaitValue);
+Run();
+
+// Thenables are still resolved through the generic path.
+(function TestThenable() {
+  const order = [];
+  async function AwaitThenable() {
+    order.push(await {then(resolve) { order.push('then'); resolve(3); }});
+  }
+  AwaitThenable();
+  %PerformMicrotaskCheckpoint();
+  assertEquals(['then', 3], order);
+})();
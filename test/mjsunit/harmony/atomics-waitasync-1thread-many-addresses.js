@@ -0,0 +1,50 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+(function test() {
+  // More addresses than there are wait lists, so that several addresses share
+  // a wait list.
+  const N = 256;
+  const sab = new SharedArrayBuffer(N * 4);
+  const i32a = new Int32Array(sab);
+
+  let log = [];
+
+  for (let i = 0; i < N; ++i) {
+    const result = Atomics.waitAsync(i32a, i, 0);
+    assertEquals(true, result.async);
+    result.value.then(
+      (value) => { assertEquals("ok", value); log.push(i); },
+      () => { assertUnreachable(); });
+  }
+  for (let i = 0; i < N; ++i) {
+    assertEquals(1, %AtomicsNumWaitersForTesting(i32a, i));
+  }
+
+  // Waking the odd addresses leaves the waiters on the even ones alone.
+  for (let i = 1; i < N; i += 2) {
+    assertEquals(1, Atomics.notify(i32a, i));
+  }
+  for (let i = 0; i < N; ++i) {
+    assertEquals(i % 2 == 0 ? 1 : 0, %AtomicsNumWaitersForTesting(i32a, i));
+    assertEquals(i % 2 == 0 ? 0 : 1,
+                 %AtomicsNumUnresolvedAsyncPromisesForTesting(i32a, i));
+  }
+  for (let i = 0; i < N; i += 2) {
+    assertEquals(1, Atomics.notify(i32a, i));
+  }
+
+  function continuation() {
+    assertEquals(N, log.length);
+    // Promises are resolved in notification order.
+    for (let i = 0; i < N / 2; ++i) {
+      assertEquals(2 * i + 1, log[i]);
+      assertEquals(2 * i, log[N / 2 + i]);
+    }
+  }
+
+  setTimeout(continuation, 0);
+})();
@@ -0,0 +1,83 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --js-iterator-sequencing
+
+// Helpers that step other helpers directly must behave exactly like helpers
+// that go through the underlying `next` method.
+
+function* range(n) {
+  for (let i = 0; i < n; i++) yield i;
+}
+
+(function TestChains() {
+  assertEquals(
+      [0, 4, 8],
+      [...range(10).map(x => x * 2).filter(x => x % 4 == 0).take(3)]);
+  assertEquals(
+      [6, 8],
+      [...range(5).map(x => x * 2).drop(3)]);
+  assertEquals(
+      [1, 1, 2, 2],
+      [...range(3).drop(1).flatMap(x => [x, x]).map(x => x)]);
+  assertEquals(
+      [],
+      [...range(3).filter(x => x > 5).map(x => x).take(2)]);
+  assertEquals(
+      [0, 1],
+      [...Iterator.concat(range(2)).map(x => x)]);
+})();
+
+(function TestCallbackOrder() {
+  const log = [];
+  const it = range(4)
+                 .map(x => (log.push(`map ${x}`), x))
+                 .filter(x => (log.push(`filter ${x}`), x % 2 == 1))
+                 .take(1);
+  assertEquals({value: 1, done: false}, it.next());
+  assertEquals(['map 0', 'filter 0', 'map 1', 'filter 1'], log);
+  assertEquals({value: undefined, done: true}, it.next());
+})();
+
+(function TestOverriddenNext() {
+  const inner = range(3).map(x => x);
+  let calls = 0;
+  const originalNext = inner.next;
+  inner.next = function() {
+    calls++;
+    return originalNext.call(this);
+  };
+  assertEquals([0, 1, 2], [...inner.map(x => x)]);
+  assertEquals(4, calls);
+})();
+
+(function TestReentrancy() {
+  let outer;
+  const inner = range(3).map(x => {
+    outer.next();
+  });
+  outer = inner.map(x => x);
+  assertThrows(() => outer.next(), TypeError);
+})();
+
+(function TestExceptionsClose() {
+  let closed = 0;
+  const source = {
+    next() { return {value: 1, done: false}; },
+    return() { closed++; return {}; },
+    __proto__: Iterator.prototype
+  };
+  const it = source.map(x => x).filter(x => { throw new Error('boom'); });
+  assertThrows(() => it.next(), Error, 'boom');
+  assertEquals(1, closed);
+  assertEquals({value: undefined, done: true}, it.next());
+})();
+
+(function TestCrossRealm() {
+  const otherRealm = Realm.create();
+  const inner = Realm.eval(otherRealm, `
+    (function*() { yield 1; yield 2; })().map(x => x * 10)
+  `);
+  assertEquals([10, 20], [...Iterator.prototype.map.call(inner, x => x)]);
+})();
@@ -0,0 +1,51 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --jitless
+
+// Test bytecodes inline a following JumpIfTrue/JumpIfFalse; check both
+// directions of every fused comparison as well as exceptions thrown by the
+// comparison itself.
+
+function count(n) {
+  let taken = 0;
+  for (let i = 0; i < n; i++) {
+    if (i < 5) taken++;
+    if (i > 5) taken += 10;
+    if (i <= 5) taken += 100;
+    if (i >= 5) taken += 1000;
+    if (i == 5) taken += 10000;
+    if (i === 5) taken += 100000;
+  }
+  return taken;
+}
+assertEquals(5 + 40 + 600 + 5000 + 10000 + 100000, count(10));
+
+function kinds(o) {
+  let result = '';
+  if (o === null) result += 'n';
+  if (o === undefined) result += 'u';
+  if (o == null) result += 'N';
+  if (typeof o === 'number') result += '#';
+  if (o instanceof Array) result += 'a';
+  if (o !== null && typeof o === 'object' && 'x' in o) result += 'x';
+  return result;
+}
+assertEquals('nN', kinds(null));
+assertEquals('uN', kinds(undefined));
+assertEquals('#', kinds(1));
+assertEquals('a', kinds([]));
+assertEquals('x', kinds({x: 1}));
+
+function throwing(o) {
+  try {
+    if (1 < o) return 'taken';
+    return 'not taken';
+  } catch (e) {
+    return e;
+  }
+}
+assertEquals('taken', throwing(2));
+assertEquals('not taken', throwing(0));
+assertEquals('boom', throwing({valueOf() { throw 'boom'; }}));
@@ -0,0 +1,40 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Long strings are scanned many characters at a time. Put escapes, quotes,
+// control and two-byte characters at every position around the vector
+// boundaries.
+
+function check(prefix_length, special) {
+  const prefix = 'a'.repeat(prefix_length);
+  const suffix = 'b'.repeat(prefix_length % 7);
+  for (const value of [prefix + special + suffix, special + prefix]) {
+    assertEquals(value, JSON.parse(JSON.stringify(value)));
+    assertEquals({[value]: value},
+                 JSON.parse(JSON.stringify({[value]: value})));
+  }
+}
+
+for (let i = 0; i < 140; i++) {
+  check(i, '');
+  check(i, '"');
+  check(i, '\\');
+  check(i, '\n');
+  check(i, '\u0001');
+  check(i, 'ÿ');
+  check(i, 'Ā');
+  check(i, '😀');
+  check(i, ' x"y');
+}
+
+for (const length of [31, 32, 33, 63, 64, 65, 127, 128, 129]) {
+  const padding = 'c'.repeat(length);
+  assertThrows(() => JSON.parse('"' + padding), SyntaxError);
+  assertThrows(() => JSON.parse('"' + padding + '\u0001"'), SyntaxError);
+  assertThrows(() => JSON.parse('"' + padding + ' \u0001"'),
+               SyntaxError);
+  assertThrows(() => JSON.parse('"' + padding + '\\x"'), SyntaxError);
+  // A two-byte source with only one-byte characters in the string.
+  assertEquals(['Ā', padding], JSON.parse('["Ā", "' + padding + '"]'));
+}
@@ -0,0 +1,44 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --json-parse-parallel-numbers
+// Flags: --json-parse-parallel-numbers-threshold=1000
+
+// Numbers are converted on worker threads before parsing. Number-like text
+// in strings and chunk boundaries in the middle of numbers must not change
+// the result.
+
+const values = [
+  1.5, 0, -1, 1e21, 123456789, 1234567890, -9876543210, 0.1, 2e-7,
+  1.7976931348623157e308, 5e-324, '1.5', ',2.25', ', -0', '[3e4]', 'x:0.5',
+  true, null, {a: 0.25, b: [-1.125, '7.5 8.5']}, [[4.75], {'1.5': 2.5}],
+];
+
+function Source(count) {
+  const parts = [];
+  for (let i = 0; i < count; i++) {
+    parts.push(values[i % values.length]);
+    parts.push(i + i / 1024);
+  }
+  return parts;
+}
+
+for (const count of [10, 1000, 30000]) {
+  const expected = Source(count);
+  const json = JSON.stringify(expected);
+  assertEquals(expected, JSON.parse(json));
+  // Other spacing and exponent spellings.
+  assertEquals(expected, JSON.parse(JSON.stringify(expected, null, 1)));
+  assertEquals(eval(json.replace(/e\+/g, 'E')),
+               JSON.parse(json.replace(/e\+/g, 'E')));
+  // A two-byte source.
+  assertEquals(['Ā', ...expected], JSON.parse('["Ā",' + json.slice(1)));
+}
+
+const padding = ' '.repeat(2000);
+assertEquals([0.5, -0], JSON.parse(padding + '[0.5, -0]' + padding));
+assertThrows(() => JSON.parse(padding + '[1.5, 01.5]'), SyntaxError);
+assertThrows(() => JSON.parse(padding + '[1.5, 1.]'), SyntaxError);
+assertThrows(() => JSON.parse(padding + '[1.5, 1e]'), SyntaxError);
+assertThrows(() => JSON.parse(padding + '[1.5, -]'), SyntaxError);
@@ -0,0 +1,57 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Arrays of objects with the same map are serialized with a cached plan of
+// their fields. The replacer forces the generic stringifier, which is used as
+// the reference.
+
+function check(value) {
+  assertEquals(JSON.stringify(value, (k, v) => v), JSON.stringify(value));
+}
+
+function record(i) {
+  return {id: i, name: 'n' + i, score: i / 7, ok: i % 2 == 0, tag: null};
+}
+
+const records = [];
+for (let i = 0; i < 100; i++) records.push(record(i));
+check(records);
+
+// Skipped fields, also as the first field.
+const sparse = [];
+for (let i = 0; i < 50; i++) {
+  sparse.push({a: i % 3 ? i : undefined, b: i % 5 ? undefined : 'b',
+               c: Symbol(), d: i});
+}
+check(sparse);
+
+// Nested records, with and without their own repeated shape.
+const nested = [];
+for (let i = 0; i < 50; i++) {
+  nested.push({x: i, inner: {y: i, z: [i, {w: i}]}, after: 'a' + i});
+}
+check(nested);
+
+// Out-of-object properties.
+const wide = [];
+for (let i = 0; i < 20; i++) {
+  const o = {};
+  for (let j = 0; j < 40; j++) o['p' + j] = i * j;
+  wide.push(o);
+}
+check(wide);
+
+// A two-byte value in the middle of a record switches the encoding.
+const two_byte = [];
+for (let i = 0; i < 20; i++) {
+  two_byte.push({a: i, b: i == 10 ? '☃' : 'x', c: i});
+}
+check(two_byte);
+
+// Alternating shapes.
+const mixed = [];
+for (let i = 0; i < 60; i++) {
+  mixed.push(i % 3 == 0 ? {p: i} : i % 3 == 1 ? {q: i, r: 'r'} : {s: [i]});
+}
+check(mixed);
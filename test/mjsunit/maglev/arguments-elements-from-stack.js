@@ -0,0 +1,102 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+
+function optimize(f, ...args) {
+  %PrepareFunctionForOptimization(f);
+  f(...args);
+  f(...args);
+  %OptimizeMaglevOnNextCall(f);
+  return f(...args);
+}
+%NeverOptimizeFunction(optimize);
+
+// Default parameters as compiled to ES5.
+(function() {
+  function foo() {
+    var x = arguments.length > 0 && arguments[0] !== undefined ?
+        arguments[0] : 1;
+    var y = arguments.length > 1 && arguments[1] !== undefined ?
+        arguments[1] : 2;
+    return x + y;
+  }
+  assertEquals(7, optimize(foo, 3, 4));
+  assertEquals(5, foo(3));
+  assertEquals(3, foo());
+  assertEquals(21, foo(10, 11, 12));
+})();
+
+// Strict arguments with a variable index.
+(function() {
+  "use strict";
+  function foo(a, i) {
+    return arguments[i];
+  }
+  assertEquals(1, optimize(foo, 0, 1, 2));
+  assertEquals(0, foo(0, 0));
+  assertEquals("x", foo(0, 2, "x"));
+  assertEquals(undefined, foo(0, 3));
+  assertEquals(undefined, foo(0, -1));
+})();
+
+// Rest parameters.
+(function() {
+  function foo(a, ...rest) {
+    return rest.length + rest[0] + rest[rest.length - 1];
+  }
+  assertEquals(2 + 2 + 3, optimize(foo, 1, 2, 3));
+  assertEquals(1 + 5 + 5, foo(1, 5));
+  assertTrue(isNaN(foo(1)));
+})();
+
+// Writes before and after a load must be observed.
+(function() {
+  "use strict";
+  function foo(a, b) {
+    const before = arguments[1];
+    arguments[1] = 42;
+    return before + arguments[1];
+  }
+  assertEquals(44, optimize(foo, 1, 2));
+  assertEquals(45, foo(1, 3));
+})();
+
+// Writes inside a loop after the load.
+(function() {
+  "use strict";
+  function foo(a, b) {
+    let sum = 0;
+    for (let i = 0; i < 3; i++) {
+      sum += arguments[0];
+      arguments[0] = 10;
+    }
+    return sum;
+  }
+  assertEquals(21, optimize(foo, 1, 2));
+  assertEquals(22, foo(2, 2));
+})();
+
+// Parameter assignment does not affect strict arguments.
+(function() {
+  "use strict";
+  function foo(a) {
+    a = 5;
+    return arguments[0] + a;
+  }
+  assertEquals(6, optimize(foo, 1));
+})();
+
+// Arguments passed to a callee that modifies them.
+(function() {
+  function modify(args) { args[0] = 100; }
+  %NeverOptimizeFunction(modify);
+  function foo(a) {
+    "use strict";
+    const before = arguments[0];
+    modify(arguments);
+    return before + arguments[0];
+  }
+  assertEquals(101, optimize(foo, 1));
+})();
@@ -0,0 +1,73 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+
+function sum(a) {
+  return a.reduce((acc, v) => acc + v, 0);
+}
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(6, sum([1, 2, 3]));
+assertEquals(0, sum([]));
+%OptimizeMaglevOnNextCall(sum);
+assertEquals(6, sum([1, 2, 3]));
+assertEquals(0, sum([]));
+assertTrue(isMaglevved(sum));
+
+// Holes are skipped and keep the accumulator.
+function count(a) {
+  return a.reduce((acc) => acc + 1, 0);
+}
+
+%PrepareFunctionForOptimization(count);
+assertEquals(2, count([1, , 3]));
+%OptimizeMaglevOnNextCall(count);
+assertEquals(2, count([1, , 3]));
+assertEquals(3, count([1.5, , 2.5, , 3.5]));
+
+// The accumulator and index are passed to the callback in that order.
+function indices(a) {
+  return a.reduce((acc, v, i, array) => {
+    assertSame(a, array);
+    return acc + i + ':' + v + ',';
+  }, '');
+}
+
+%PrepareFunctionForOptimization(indices);
+assertEquals('0:a,1:b,', indices(['a', 'b']));
+%OptimizeMaglevOnNextCall(indices);
+assertEquals('0:a,1:b,', indices(['a', 'b']));
+
+// A deopt in the callback continues the loop in the builtin.
+let deopt = false;
+function add(acc, v) {
+  if (deopt) %DeoptimizeFunction(withDeopt);
+  return acc + v;
+}
+function withDeopt(a) {
+  return a.reduce(add, 10);
+}
+
+%PrepareFunctionForOptimization(add);
+%PrepareFunctionForOptimization(withDeopt);
+assertEquals(16, withDeopt([1, 2, 3]));
+%OptimizeMaglevOnNextCall(withDeopt);
+assertEquals(16, withDeopt([1, 2, 3]));
+deopt = true;
+assertEquals(16, withDeopt([1, 2, 3]));
+
+// Changing the length in the callback deopts.
+function shrink(a) {
+  return a.reduce((acc, v) => {
+    if (v === 2) a.length = 2;
+    return acc + v;
+  }, 0);
+}
+
+%PrepareFunctionForOptimization(shrink);
+assertEquals(6, shrink([1, 4, 1]));
+%OptimizeMaglevOnNextCall(shrink);
+assertEquals(6, shrink([1, 4, 1]));
+assertEquals(3, shrink([1, 2, 3, 4]));
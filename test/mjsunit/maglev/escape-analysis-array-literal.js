@@ -0,0 +1,47 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-escape-analysis
+// Flags: --maglev-object-tracking
+
+// The elements of `[a, b]` are stored after the array is allocated. Those
+// stores are tracked, so the array does not escape and is materialized on
+// deoptimization.
+
+function sum(a, b) {
+  let pair = [a, b];
+  return pair[0] + pair[1];
+}
+
+%PrepareFunctionForOptimization(sum);
+assertEquals(3, sum(1, 2));
+%OptimizeMaglevOnNextCall(sum);
+assertEquals(7, sum(3, 4));
+assertTrue(isMaglevved(sum));
+
+function swap(a, b, deopt) {
+  let pair = [b, a];
+  if (deopt) %DeoptimizeNow();
+  return pair;
+}
+
+%PrepareFunctionForOptimization(swap);
+assertEquals([2, 1], swap(1, 2, false));
+%OptimizeMaglevOnNextCall(swap);
+assertEquals([4, 3], swap(3, 4, false));
+
+function materialize(a, b, deopt) {
+  let pair = [a, b];
+  if (deopt) {
+    // Deopts, since this branch has no feedback.
+    return pair[0] * pair[1] + deopt.x;
+  }
+  return pair[1] - pair[0];
+}
+
+%PrepareFunctionForOptimization(materialize);
+assertEquals(1, materialize(1, 2, undefined));
+%OptimizeMaglevOnNextCall(materialize);
+assertEquals(1, materialize(3, 4, undefined));
+assertEquals(17, materialize(3, 4, {x: 5}));
@@ -0,0 +1,59 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --default-to-experimental-regexp-engine
+// Flags: --experimental-regexp-engine-lazy-dfa-cache-size=4096
+
+// Regexps without assertions and lookarounds are searched with a lazily
+// built DFA.  It has to find the same matches as the NFA simulation, also
+// when its small state cache runs full and it falls back to the NFA.
+
+function Test(regexp, subject, expected_exec, expected_match) {
+  assertEquals('EXPERIMENTAL', %RegexpTypeTag(regexp));
+  assertEquals(expected_exec, regexp.exec(subject));
+  const global = new RegExp(regexp.source, 'g');
+  assertEquals('EXPERIMENTAL', %RegexpTypeTag(global));
+  assertEquals(expected_match, subject.match(global));
+  assertEquals(expected_exec !== null, regexp.test(subject));
+}
+
+// Leftmost-first priority: the first alternative that matches wins, not the
+// longest one.
+Test(/abc|..|[a-c]{10,}/, 'xxabcccccccccccccc', ['xx'],
+     ['xx', 'abc', 'cc', 'cc', 'cc', 'cc', 'cc', 'cc']);
+Test(/a+?b|a+c/, 'zzzaaaac', ['aaaac'], ['aaaac']);
+Test(/(?:a|ab)(?:c|bcd)d*/, 'xabcdd', ['abcdd'], ['abcdd']);
+Test(/foo(?:bar)+?/, 'foo foobarbarbar', ['foobar'], ['foobar']);
+Test(/[0-9]+\.[0-9]*/, 'version 12.345 and 6.7', ['12.345'],
+     ['12.345', '6.7']);
+
+// Empty matches and empty loop iterations.
+Test(/x*/, 'asdfxk', [''], ['', '', '', '', 'x', '', '']);
+Test(/(?:a*)*b/, 'aaaaac', null, null);
+Test(/(?:a*)*b/, 'caaaab', ['aaaab'], ['aaaab']);
+
+// Captures are computed by the NFA within the boundaries the DFA found.
+Test(/(\w+)@(\w+)\.com/, 'mail: someone@example.com!',
+     ['someone@example.com', 'someone', 'example'], ['someone@example.com']);
+
+// Two-byte subjects.
+Test(/ሴ+|x/, 'yyሴሴx', ['ሴሴ'], ['ሴሴ', 'x']);
+
+// Sticky regexps have no /.*?/ preamble.
+const sticky = /ab|a/y;
+sticky.lastIndex = 2;
+assertEquals(['ab'], sticky.exec('xxabab'));
+assertEquals(4, sticky.lastIndex);
+assertEquals(['ab'], sticky.exec('xxabab!'));
+assertEquals(null, sticky.exec('xxabab!'));
+assertEquals(0, sticky.lastIndex);
+
+// The DFA for this regexp has too many states for the cache, so the search
+// continues with NFA simulation.
+const many_states = /(?:a|b)*a(?:a|b){8}c/;
+let subject = '';
+for (let i = 0; i < 2000; i++) subject += (i * 7919) % 3 ? 'a' : 'b';
+subject += 'aabbabbbac';
+Test(many_states, subject, [subject], [subject]);
+Test(many_states, subject.slice(0, -1), null, null);
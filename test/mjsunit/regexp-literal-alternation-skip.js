@@ -0,0 +1,62 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-regexp-tier-up
+
+// Alternations of literals skip ahead to candidates for the rarest offset of
+// the Boyer-Moore interval. Check the matches against a naive search, with
+// candidates at all positions around the vector boundaries.
+
+function naiveMatches(subject, literals, ignore_case) {
+  const haystack = ignore_case ? subject.toLowerCase() : subject;
+  const result = [];
+  for (let i = 0; i < haystack.length;) {
+    const literal = literals.find(l => haystack.startsWith(l, i));
+    if (literal === undefined) {
+      i++;
+      continue;
+    }
+    result.push(i + ':' + subject.substr(i, literal.length));
+    i += literal.length;
+  }
+  return result;
+}
+
+function regexpMatches(subject, re) {
+  return [...subject.matchAll(re)].map(m => m.index + ':' + m[0]);
+}
+
+let seed = 17;
+function random(n) {
+  seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+  return seed % n;
+}
+
+const cases = [
+  [/foo|bar|baz/g, ['foo', 'bar', 'baz'], false],
+  [/error|warn|fatal/g, ['error', 'warn', 'fatal'], false],
+  [/xyzzy|plugh|quux/g, ['xyzzy', 'plugh', 'quux'], false],
+  [/abc|abd|bcd/gi, ['abc', 'abd', 'bcd'], true],
+];
+const alphabet = 'abcdefghijklmnopqrstuvwxyz     ';
+
+for (const [re, literals, ignore_case] of cases) {
+  for (let length = 1; length < 80; length++) {
+    for (let n = 0; n < 4; n++) {
+      let subject = '';
+      while (subject.length < length) {
+        subject += random(6) == 0 ?
+            literals[random(literals.length)] :
+            alphabet[random(alphabet.length)];
+      }
+      if (ignore_case && random(2)) subject = subject.toUpperCase();
+      assertEquals(naiveMatches(subject, literals, ignore_case),
+                   regexpMatches(subject, re));
+    }
+  }
+  // A long subject with a single match at the end.
+  const long_subject = 'x'.repeat(10000) + literals[1];
+  assertEquals([10000 + ':' + literals[1]],
+               regexpMatches(long_subject, re));
+}
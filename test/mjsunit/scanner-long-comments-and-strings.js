@@ -0,0 +1,47 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Comments and string literals are skipped many code units at a time. Put
+// the characters that end them at every position around the vector
+// boundaries.
+
+for (let i = 0; i < 70; i++) {
+  const filler = 'x'.repeat(i);
+
+  // Single-line comments end at any line terminator.
+  for (const terminator of ['\n', '\r', '\u2028', '\u2029']) {
+    assertEquals(i, eval(`// ${filler}${terminator}${i}`));
+    assertEquals(1, eval(`// ${filler}ä${filler}${terminator}1`));
+  }
+
+  // Multi-line comments, with and without line terminators and stray '*'s.
+  assertEquals(i, eval(`/* ${filler} */${i}`));
+  assertEquals(i, eval(`/* ${filler}*${filler}** ${filler} */${i}`));
+  assertEquals(i, eval(`/* ${filler}\n${filler}*${filler}*/${i}`));
+  assertEquals(i, eval(`/* ${filler}\u2028${filler}*/${i}`));
+  assertEquals(i, eval(`/* ${filler}ä中${filler}*/${i}`));
+  // A multi-line comment containing a line terminator acts as one for ASI.
+  assertEquals(undefined,
+               eval(`(function() { return /* ${filler}\n */ 1; })()`));
+  assertEquals(1, eval(`(function() { return /* ${filler} */ 1; })()`));
+
+  // String literals.
+  for (const quote of ["'", '"']) {
+    const other = quote == "'" ? '"' : "'";
+    assertEquals(filler, eval(`${quote}${filler}${quote}`));
+    assertEquals(filler + other + filler,
+                 eval(`${quote}${filler}${other}${filler}${quote}`));
+    assertEquals(filler + quote + filler,
+                 eval(`${quote}${filler}\\${quote}${filler}${quote}`));
+    assertEquals(filler + 'ä' + filler,
+                 eval(`${quote}${filler}ä${filler}${quote}`));
+    assertEquals(filler + '中\t' + filler,
+                 eval(`${quote}${filler}中\t${filler}${quote}`));
+    assertEquals(filler + '\u2028' + filler,
+                 eval(`${quote}${filler}\u2028${filler}${quote}`));
+    assertThrows(() => eval(`${quote}${filler}\n${filler}${quote}`),
+                 SyntaxError);
+    assertThrows(() => eval(`${quote}${filler}`), SyntaxError);
+  }
+}
@@ -0,0 +1,47 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --harmony-struct --allow-natives-syntax --shared-string-table
+
+// Stores of values that are already shared are inlined into optimized code;
+// all other values still go through the shared value barrier.
+
+const Node = new SharedStructType(['value', 'next']);
+
+function StoreShared(node, next) {
+  node.value = 42;
+  node.next = next;
+  node.value = undefined;
+  node.value = 'internalized';
+  node.value = 1;
+}
+
+function StoreLocal(node, value) {
+  node.value = value;
+}
+
+const head = new Node();
+const tail = new Node();
+
+%PrepareFunctionForOptimization(StoreShared);
+StoreShared(head, tail);
+StoreShared(head, tail);
+%OptimizeFunctionOnNextCall(StoreShared);
+StoreShared(head, tail);
+assertEquals(1, head.value);
+assertSame(tail, head.next);
+StoreShared(tail, head);
+assertSame(head, tail.next);
+
+%PrepareFunctionForOptimization(StoreLocal);
+StoreLocal(head, 1);
+StoreLocal(head, 1.5);
+%OptimizeFunctionOnNextCall(StoreLocal);
+StoreLocal(head, 2000000000);
+assertEquals(2000000000, head.value);
+StoreLocal(head, 'x'.repeat(20) + Math.random());
+assertThrows(() => StoreLocal(head, {}), TypeError);
+
+// SharedGC verifies there are no shared->local edges.
+%SharedGC();
@@ -0,0 +1,99 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Long ropes are searched and compared segment by segment instead of being
+// flattened. Matches may span any number of segments.
+
+function makeRope(pieces) {
+  let s = '';
+  for (const piece of pieces) s += piece;
+  return s;
+}
+
+function makePieces(count, piece) {
+  const pieces = [];
+  for (let i = 0; i < count; i++) pieces.push(%FlattenString(piece(i)));
+  return pieces;
+}
+
+const pieces = makePieces(
+    1000, i => '<div class="item-' + (i % 97) + '">' + i + '</div>' +
+        ' '.repeat(i % 80) + '\n');
+const expected = pieces.join('');
+
+function check(needle, position) {
+  const rope = makeRope(pieces);
+  assertFalse(%StringIsFlat(rope));
+  assertEquals(expected.indexOf(needle, position),
+               rope.indexOf(needle, position));
+  assertEquals(expected.includes(needle, position),
+               rope.includes(needle, position));
+  assertEquals(expected.startsWith(needle, position),
+               rope.startsWith(needle, position));
+  assertEquals(expected.endsWith(needle, position),
+               rope.endsWith(needle, position));
+  assertFalse(%StringIsFlat(rope));
+}
+
+check('item-42');
+check('999</div>');
+check('</div>\n<div class="item-');
+check('">17</div>' + ' '.repeat(17) + '\n<div class="item-18">18</div>');
+check('not there');
+check('item-96">96', 1000);
+check('<div class="item-0">0', 0);
+check('<div class="item-5">5', 100);
+check('\n', expected.length - 1);
+check('<div', expected.length);
+check(' '.repeat(79) + '\n<div');
+check(' '.repeat(200));
+check('ā');
+check('\n<div', 0);
+check('\n<div', expected.lastIndexOf('\n<div'));
+for (let i = 0; i < 40; i++) {
+  const start = (i * 7919) % (expected.length - 300);
+  check(expected.substr(start, 1 + i * 7), start);
+  check(expected.substr(start, 1 + i * 7), start + 1);
+}
+
+(function TestTwoByte() {
+  const pieces = makePieces(
+      1000, i => (i % 3 ? 'ab' : 'ĀĂ') + i + '.'.repeat(70));
+  const rope = makeRope(pieces);
+  const flattened = pieces.join('');
+  for (const needle of ['ĀĂ999', '.ab998', 'ab997....', 'ĂĀ', '4', 'ab5']) {
+    assertEquals(flattened.indexOf(needle), rope.indexOf(needle));
+    assertEquals(flattened.includes(needle), rope.includes(needle));
+  }
+  assertTrue(rope.startsWith('.ab10', flattened.indexOf('.ab10')));
+  assertTrue(rope.endsWith('ĀĂ999' + '.'.repeat(70)));
+  assertFalse(%StringIsFlat(rope));
+})();
+
+// Ropes with too many segments are still flattened, but have to give the same
+// results.
+(function TestShortSegments() {
+  let rope = 'abcabcabcabcab';
+  for (let i = 0; i < 70000; i++) rope += i % 5 == 0 ? 'x' : 'y';
+  rope += 'xyz';
+  const flattened = rope.split('').join('');
+  for (const needle of ['xyyyyx', 'yyyyxyz', 'xyz', 'bcabcabcabx',
+                        'yyyyyy', 'cab']) {
+    assertEquals(flattened.indexOf(needle), rope.indexOf(needle));
+    assertEquals(flattened.indexOf(needle, 5), rope.indexOf(needle, 5));
+  }
+})();
+
+(function TestEquality() {
+  const changed = pieces.slice();
+  changed[700] = changed[700].replace('700', '701');
+  const a = makeRope(pieces);
+  assertTrue(a == expected);
+  assertFalse(a === changed.join(''));
+  assertTrue(a === makeRope(pieces));
+  assertFalse(a === makeRope(changed));
+  assertFalse(%StringIsFlat(a));
+})();
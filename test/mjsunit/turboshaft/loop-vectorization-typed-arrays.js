@@ -0,0 +1,98 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --turboshaft-loop-vectorization
+
+function add(dst, a, b, n) {
+  for (let i = 0; i < n; i++) {
+    dst[i] = a[i] + b[i];
+  }
+}
+
+function scale(dst, a, k, n) {
+  for (let i = 0; i < n; i++) {
+    dst[i] = a[i] * k;
+  }
+}
+
+function expected(op, a, b, n) {
+  let result = [];
+  for (let i = 0; i < n; i++) result.push(op(a[i], b[i]));
+  return result;
+}
+
+function fill(array, seed) {
+  for (let i = 0; i < array.length; i++) array[i] = (i * 7 + seed) % 13 - 5.5;
+  return array;
+}
+
+function check(fn, Type, op, extra) {
+  for (let n of [0, 1, 3, 4, 7, 8, 17]) {
+    let a = fill(new Type(n), 1);
+    let b = fill(new Type(n), 2);
+    let dst = new Type(n);
+    let want = new Type(expected(op, a, b, n));
+    %PrepareFunctionForOptimization(fn);
+    fn(dst, a, extra(b), n);
+    %OptimizeFunctionOnNextCall(fn);
+    dst.fill(0);
+    fn(dst, a, extra(b), n);
+    assertEquals(want, dst);
+  }
+}
+
+for (let Type of [Float64Array, Float32Array, Int32Array, Uint32Array]) {
+  check(add, Type, (x, y) => x + y, b => b);
+}
+for (let Type of [Float64Array, Int32Array]) {
+  check(scale, Type, (x) => x * 3, b => 3);
+}
+
+// The elements written by a store may be the ones loaded, but must not
+// partially overlap with them.
+(function TestAliasing() {
+  let buffer = new ArrayBuffer(8 * 20);
+  let a = new Float64Array(buffer, 0, 16);
+  let shifted = new Float64Array(buffer, 8, 16);
+  %PrepareFunctionForOptimization(add);
+  add(a, a, a, 16);
+  %OptimizeFunctionOnNextCall(add);
+
+  fill(a, 1);
+  let want = Array.from(a, x => 2 * x);
+  add(a, a, a, 16);
+  assertEquals(want, Array.from(a));
+
+  let memory = new Float64Array(buffer);
+  fill(memory, 3);
+  let copy = Array.from(memory);
+  for (let i = 0; i < 16; i++) copy[i + 1] = copy[i] + copy[i];
+  add(shifted, a, a, 16);
+  assertEquals(copy, Array.from(memory));
+})();
+
+// Out of bounds accesses deopt instead of being performed by the vector loop.
+(function TestBounds() {
+  let a = fill(new Float64Array(8), 1);
+  let dst = new Float64Array(6);
+  %PrepareFunctionForOptimization(add);
+  add(dst, a, a, 6);
+  %OptimizeFunctionOnNextCall(add);
+  add(dst, a, a, 6);
+  dst.fill(0);
+  add(dst, a, a, 8);
+  assertEquals(Array.from(a.subarray(0, 6), x => 2 * x), Array.from(dst));
+})();
+
+(function TestDetached() {
+  let a = fill(new Float64Array(16), 1);
+  let dst = new Float64Array(16);
+  %PrepareFunctionForOptimization(add);
+  add(dst, a, a, 16);
+  %OptimizeFunctionOnNextCall(add);
+  add(dst, a, a, 16);
+  %ArrayBufferDetach(dst.buffer);
+  add(dst, a, a, 16);
+  assertEquals(0, dst.length);
+})();
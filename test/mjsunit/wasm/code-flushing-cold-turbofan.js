@@ -0,0 +1,39 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc --wasm-lazy-compilation
+// Flags: --liftoff --turbofan --wasm-dynamic-tiering
+// Flags: --wasm-flush-cold-turbofan-code --wasm-cold-turbofan-code-age=2
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+builder.addFunction('hot', kSig_i_i).addBody([kExprLocalGet, 0]).exportFunc();
+builder.addFunction('cold', kSig_i_i).addBody([kExprLocalGet, 0]).exportFunc();
+
+const exports = builder.instantiate().exports;
+
+exports.hot(1);
+exports.cold(2);
+%WasmTierUpFunction(exports.hot);
+%WasmTierUpFunction(exports.cold);
+assertTrue(%IsTurboFanFunction(exports.hot));
+assertTrue(%IsTurboFanFunction(exports.cold));
+
+// The first full GC only records which functions ran since.
+gc();
+for (let i = 0; i < 2; i++) {
+  exports.hot(1);
+  gc();
+  assertTrue(%IsTurboFanFunction(exports.hot));
+  // TurboFan code is only flushed once it was unused for two GCs.
+  assertEquals(i == 0, %IsTurboFanFunction(exports.cold));
+}
+assertTrue(%IsUncompiledWasmFunction(exports.cold));
+
+// The function starts over in Liftoff and can tier up again.
+assertEquals(2, exports.cold(2));
+assertTrue(%IsLiftoffFunction(exports.cold));
+%WasmTierUpFunction(exports.cold);
+assertTrue(%IsTurboFanFunction(exports.cold));
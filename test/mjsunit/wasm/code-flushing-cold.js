@@ -0,0 +1,33 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc --wasm-lazy-compilation
+// Flags: --liftoff --wasm-dynamic-tiering --wasm-flush-cold-liftoff-code
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+const builder = new WasmModuleBuilder();
+builder.addFunction('hot', kSig_i_i).addBody([kExprLocalGet, 0]).exportFunc();
+builder.addFunction('cold', kSig_i_i).addBody([kExprLocalGet, 0]).exportFunc();
+
+const exports = builder.instantiate().exports;
+
+exports.hot(1);
+exports.cold(2);
+assertTrue(%IsLiftoffFunction(exports.hot));
+assertTrue(%IsLiftoffFunction(exports.cold));
+
+// The first full GC only records which functions ran since.
+gc();
+assertTrue(%IsLiftoffFunction(exports.hot));
+assertTrue(%IsLiftoffFunction(exports.cold));
+
+exports.hot(1);
+gc();
+assertTrue(%IsLiftoffFunction(exports.hot));
+assertTrue(%IsUncompiledWasmFunction(exports.cold));
+
+// Cold functions are compiled again on their next call.
+assertEquals(2, exports.cold(2));
+assertTrue(%IsLiftoffFunction(exports.cold));
@@ -0,0 +1,62 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-liftoff
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Swizzles with constant in-range indices are compiled as shuffles. Indices
+// out of range have to keep producing zero.
+
+function Test(name, indices) {
+  print(name);
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, 1, false);
+  builder.exportMemoryAs('memory');
+  for (const [export_name, opcode] of [['swizzle', [kExprI8x16Swizzle]],
+                                       ['relaxed', kExprI8x16RelaxedSwizzle]]) {
+    builder.addFunction(export_name, makeSig([kWasmI32, kWasmI32], []))
+        .addBody([
+          kExprLocalGet, 1,
+          kExprLocalGet, 0,
+          kSimdPrefix, kExprS128LoadMem, 0, 0,
+          ...wasmS128Const(indices),
+          kSimdPrefix, ...opcode,
+          kSimdPrefix, kExprS128StoreMem, 0, 0,
+        ])
+        .exportFunc();
+  }
+  const module = builder.instantiate();
+  const memory = new Uint8Array(module.exports.memory.buffer);
+  for (let i = 0; i < 16; ++i) {
+    memory[i] = 0x80 + i;
+  }
+
+  module.exports.swizzle(0, 16);
+  for (let i = 0; i < 16; ++i) {
+    const expected = indices[i] < 16 ? memory[indices[i]] : 0;
+    assertEquals(expected, memory[16 + i]);
+  }
+  // The relaxed swizzle is only defined for in-range indices.
+  if (indices.some(index => index >= 16)) return;
+  module.exports.relaxed(0, 32);
+  for (let i = 0; i < 16; ++i) {
+    assertEquals(memory[indices[i]], memory[32 + i]);
+  }
+}
+
+Test('Identity',
+     [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15]);
+Test('Reverse',
+     [15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0]);
+Test('32x4Rotate',
+     [4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3]);
+Test('16x8Broadcast',
+     [2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3]);
+Test('64x2Swap',
+     [8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7]);
+Test('Arbitrary',
+     [3, 9, 0, 15, 7, 7, 1, 12, 5, 2, 14, 8, 6, 11, 4, 10]);
+Test('OutOfRange',
+     [0, 16, 1, 255, 2, 128, 3, 17, 4, 5, 6, 7, 8, 9, 10, 200]);
@@ -0,0 +1,79 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --wasm-bounds-check-hoisting
+
+d8.file.execute('test/mjsunit/wasm/wasm-module-builder.js');
+
+// The bounds checks of the loop in `fill` are hoisted into a guard in front of
+// it. Iterations that are in bounds have to run before the one that traps.
+
+const kPages = 1;
+const kElements = kPages * kPageSize / 4;
+
+let builder = new WasmModuleBuilder();
+builder.addMemory64(kPages, kPages);
+builder.exportMemoryAs('memory');
+// Stores `i` to the i32 element `i` for `i` in [start, end).
+builder.addFunction('fill', makeSig([kWasmI64, kWasmI64], []))
+    .addBody([
+      kExprBlock, kWasmVoid,
+        kExprLocalGet, 0, kExprLocalGet, 1, kExprI64GeU,
+        kExprBrIf, 0,
+        kExprLoop, kWasmVoid,
+          kExprLocalGet, 0, ...wasmI64Const(2), kExprI64Shl,
+          kExprLocalGet, 0, kExprI32ConvertI64,
+          kExprI32StoreMem, 2, 0,
+          kExprLocalGet, 0, ...wasmI64Const(1), kExprI64Add,
+          kExprLocalTee, 0,
+          kExprLocalGet, 1, kExprI64LtU,
+          kExprBrIf, 0,
+        kExprEnd,
+      kExprEnd,
+    ])
+    .exportFunc();
+
+let instance = builder.instantiate();
+let fill = instance.exports.fill;
+let elements = new Int32Array(instance.exports.memory.buffer);
+
+function reset() {
+  elements.fill(-1);
+}
+
+function test() {
+  reset();
+  fill(0n, BigInt(kElements));
+  for (let i = 0; i < kElements; i++) assertEquals(i, elements[i]);
+
+  reset();
+  fill(10n, 20n);
+  assertEquals(-1, elements[9]);
+  assertEquals(10, elements[10]);
+  assertEquals(19, elements[19]);
+  assertEquals(-1, elements[20]);
+
+  // Nothing is stored if the loop doesn't run.
+  reset();
+  fill(20n, 10n);
+  assertEquals(-1, elements[20]);
+
+  // The loop stores up to the end of the memory before trapping.
+  reset();
+  assertTraps(kTrapMemOutOfBounds, () => fill(BigInt(kElements - 4),
+                                              BigInt(kElements + 4)));
+  for (let i = kElements - 4; i < kElements; i++) {
+    assertEquals(i, elements[i]);
+  }
+  assertEquals(-1, elements[kElements - 5]);
+
+  // Indices too large for the guard fall back to the checked loop.
+  reset();
+  assertTraps(kTrapMemOutOfBounds, () => fill(1n << 41n, (1n << 41n) + 4n));
+  assertTraps(kTrapMemOutOfBounds, () => fill(-4n, -1n));
+}
+
+test();
+%WasmTierUpFunction(fill);
+test();
@@ -3375,3 +3375,63 @@ d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
   const ArithmeticNaNBitMask = 0x7fc00000;
   assertTrue((result & ArithmeticNaNBitMask) === ArithmeticNaNBitMask);
 })();
+
+(function TestBinopLocalSet() {
+  print(arguments.callee.name);
+
+  const builder = new WasmModuleBuilder();
+
+  // a = a - b; return a
+  builder.addFunction("sub", kSig_i_ii)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 1,
+      kExprI32Sub,
+      kExprLocalSet, 0,
+      kExprLocalGet, 0,
+    ])
+    .exportFunc();
+
+  // a = a - b * 2; return a, with the right operand in a register.
+  builder.addFunction("sub_mul", kSig_i_ii)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 1,
+      kExprI32Const, 2,
+      kExprI32Mul,
+      kExprI32Sub,
+      kExprLocalSet, 0,
+      kExprLocalGet, 0,
+    ])
+    .exportFunc();
+
+  // The first copy of a outlives the store into a: old_a - (a + b) == -b.
+  builder.addFunction("shared", kSig_i_ii)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 0,
+      kExprLocalGet, 1,
+      kExprI32Add,
+      kExprLocalSet, 0,
+      kExprLocalGet, 0,
+      kExprI32Sub,
+    ])
+    .exportFunc();
+
+  builder.addFunction("f64_div", kSig_d_dd)
+    .addLocals(kWasmF64, 1)
+    .addBody([
+      kExprLocalGet, 0,
+      kExprLocalGet, 1,
+      kExprF64Div,
+      kExprLocalSet, 2,
+      kExprLocalGet, 2,
+    ])
+    .exportFunc();
+
+  const instance = builder.instantiate();
+  assertEquals(7, instance.exports.sub(10, 3));
+  assertEquals(4, instance.exports.sub_mul(10, 3));
+  assertEquals(-3, instance.exports.shared(10, 3));
+  assertEquals(2.5, instance.exports.f64_div(5, 2));
+})();
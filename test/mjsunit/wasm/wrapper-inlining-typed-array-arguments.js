@@ -0,0 +1,72 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbolev --turbolev-inline-js-wasm-wrappers
+
+// Typed array elements are passed to inlined Wasm functions without being
+// boxed. The Wasm function still has to see the JS conversion of each value.
+
+d8.file.execute("test/mjsunit/wasm/wasm-module-builder.js");
+
+let builder = new WasmModuleBuilder();
+builder.addFunction('f64', makeSig([kWasmF64], [kWasmF64]))
+  .addBody([kExprLocalGet, 0])
+  .exportFunc();
+builder.addFunction('f32', makeSig([kWasmF32], [kWasmF32]))
+  .addBody([kExprLocalGet, 0])
+  .exportFunc();
+builder.addFunction('i32', makeSig([kWasmI32], [kWasmI32]))
+  .addBody([kExprLocalGet, 0])
+  .exportFunc();
+let {f64, f32, i32} = builder.instantiate().exports;
+
+function test(fn, array, expected) {
+  function call(i) {
+    return fn(array[i]);
+  }
+  function check() {
+    for (let i = 0; i < array.length; i++) {
+      assertEquals(expected[i], call(i));
+    }
+  }
+  %PrepareFunctionForOptimization(call);
+  check();
+  %OptimizeFunctionOnNextCall(call);
+  check();
+  assertOptimized(call);
+}
+
+(function TestFloat64ToF64() {
+  print(arguments.callee.name);
+  test(f64, new Float64Array([1.5, -0, NaN, 2 ** 53, -Infinity]),
+       [1.5, -0, NaN, 2 ** 53, -Infinity]);
+})();
+
+(function TestFloat64ToF32() {
+  print(arguments.callee.name);
+  test(f32, new Float64Array([0.1, -0, 2 ** 128, 3]),
+       [Math.fround(0.1), -0, Infinity, 3]);
+})();
+
+(function TestFloat64ToI32() {
+  print(arguments.callee.name);
+  test(i32, new Float64Array([-1.5, 2 ** 32 + 5, NaN, -(2 ** 31) - 1]),
+       [-1, 5, 0, 2 ** 31 - 1]);
+})();
+
+(function TestInt32ToF64() {
+  print(arguments.callee.name);
+  test(f64, new Int32Array([-1, 2 ** 31 - 1, 0]), [-1, 2 ** 31 - 1, 0]);
+})();
+
+(function TestUint32ToI32() {
+  print(arguments.callee.name);
+  test(i32, new Uint32Array([2 ** 32 - 1, 2 ** 31, 7]), [-1, -(2 ** 31), 7]);
+})();
+
+(function TestUint32ToF32() {
+  print(arguments.callee.name);
+  test(f32, new Uint32Array([2 ** 32 - 1, 16777217]),
+       [Math.fround(2 ** 32 - 1), Math.fround(16777217)]);
+})();
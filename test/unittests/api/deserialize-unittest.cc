@@ -240,6 +240,56 @@ TEST_F(DeserializeTest, OffThreadDeserializeRejectsDifferentSource) {
   }
 }
 
+// Check that a batch of code caches can be deserialized on worker threads.
+TEST_F(DeserializeTest, OffThreadDeserializeBatch) {
+  constexpr int kScripts = 4;
+  const char* sources[kScripts] = {
+      "function foo0() { return 40; }", "function foo1() { return 41; }",
+      "function foo2() { return 42; }", "function foo3() { return 43; }"};
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cached_data[kScripts];
+
+  {
+    IsolateAndContextScope scope(this);
+
+    for (int i = 0; i < kScripts; i++) {
+      Local<Script> script =
+          Script::Compile(context(), NewString(sources[i])).ToLocalChecked();
+      CHECK(!script->Run(context()).IsEmpty());
+      cached_data[i].reset(
+          ScriptCompiler::CreateCodeCache(script->GetUnboundScript()));
+    }
+  }
+
+  {
+    IsolateAndContextScope scope(this);
+
+    ScriptCompiler::ConsumeCodeCacheTask* tasks[kScripts];
+    for (int i = 0; i < kScripts; i++) {
+      tasks[i] = ScriptCompiler::StartConsumingCodeCache(
+          isolate(), std::make_unique<ScriptCompiler::CachedData>(
+                         cached_data[i]->data, cached_data[i]->length,
+                         ScriptCompiler::CachedData::BufferNotOwned));
+    }
+    ScriptCompiler::RunConsumeCodeCacheTasks(
+        isolate(), MemorySpan<ScriptCompiler::ConsumeCodeCacheTask* const>(
+                       tasks, kScripts));
+
+    for (int i = 0; i < kScripts; i++) {
+      ScriptCompiler::Source source(NewString(sources[i]),
+                                    cached_data[i].release(), tasks[i]);
+      Local<Script> script =
+          ScriptCompiler::Compile(context(), &source,
+                                  ScriptCompiler::kConsumeCodeCache)
+              .ToLocalChecked();
+
+      CHECK(!source.GetCachedData()->rejected);
+      CHECK(!script->Run(context()).IsEmpty());
+      std::string name = "foo" + std::to_string(i);
+      CHECK_EQ(RunGlobalFunc(name.c_str()), Integer::New(isolate(), 40 + i));
+    }
+  }
+}
+
 class DeserializeStarterThread : public base::Thread {
  public:
   explicit DeserializeStarterThread(Isolate* isolate,
@@ -11,6 +11,7 @@
 #include "include/v8-local-handle.h"
 #include "include/v8-primitive.h"
 #include "include/v8-template.h"
+#include "src/base/platform/platform.h"
 #include "src/objects/objects-inl.h"
 #include "test/common/flag-utils.h"
 #include "test/common/streaming-helper.h"
@@ -527,6 +528,62 @@ TEST_F(CompileHintsTest, StreamingCompileHints) {
   EXPECT_FALSE(FunctionIsCompiled("func2"));
 }
 
+TEST_F(CompileHintsTest, StreamingCompileHintFromPositions) {
+  const char* url = "http://www.foo.com/foo.js";
+  v8::ScriptOrigin origin(NewString(url), 13, 0);
+
+  // Compile the functions in the opposite order of their positions, so that
+  // the hints need sorting.
+  std::vector<int> compile_hints = ProduceCompileHintsHelper(
+      {"function lazy1() {} function lazy2() {} function lazy3() {}",
+       "lazy3(); lazy1()"});
+  EXPECT_EQ(2u, compile_hints.size());
+  std::sort(compile_hints.begin(), compile_hints.end());
+
+  const char* chunks[] = {
+      "function func1() {} function func2() {} function func3() {}", nullptr};
+
+  v8::ScriptCompiler::StreamedSource source(
+      std::make_unique<i::TestSourceStream>(chunks),
+      v8::ScriptCompiler::StreamedSource::ONE_BYTE);
+  std::unique_ptr<v8::ScriptCompiler::ScriptStreamingTask> task(
+      v8::ScriptCompiler::StartStreaming(
+          isolate(), &source, v8::ScriptType::kClassic,
+          ScriptCompiler::kConsumeCompileHints,
+          ScriptCompiler::CompileHintFromPositions, &compile_hints));
+
+  // TestSourceStream::GetMoreData won't block, so it's OK to just join the
+  // background task.
+  StreamerThread::StartThreadForTaskAndJoin(task.get());
+  task.reset();
+
+  std::unique_ptr<char[]> full_source(
+      i::TestSourceStream::FullSourceString(chunks));
+
+  v8::Local<Script> script =
+      v8::ScriptCompiler::Compile(v8_context(), &source,
+                                  NewString(full_source.get()), origin)
+          .ToLocalChecked();
+
+  v8::MaybeLocal<v8::Value> result = script->Run(v8_context());
+  EXPECT_FALSE(result.IsEmpty());
+
+  EXPECT_TRUE(FunctionIsCompiled("func1"));
+  EXPECT_FALSE(FunctionIsCompiled("func2"));
+  EXPECT_TRUE(FunctionIsCompiled("func3"));
+}
+
+TEST_F(CompileHintsTest, ProduceCompileHintsTimeLimit) {
+  i::FlagScope<unsigned int> time_limit(
+      &i::v8_flags.produce_compile_hints_time_limit, 1);
+  // Make sure that the time limit has passed.
+  base::OS::Sleep(base::TimeDelta::FromMilliseconds(2));
+
+  std::vector<int> compile_hints = ProduceCompileHintsHelper(
+      {"function lazy1() {} function lazy2() {}", "lazy1()"});
+  EXPECT_TRUE(compile_hints.empty());
+}
+
 TEST_F(CompileHintsTest, CompileHintsMagicCommentBasic) {
   const char* url = "http://www.foo.com/foo.js";
   v8::ScriptOrigin origin(NewString(url), 13, 0);
@@ -356,14 +356,14 @@ TEST_P(LoopUnrollingAnalyzerLargeLoopTest, LargeLoopIterCount) {
   const Block& loop = GetFirstLoop(test.graph());
 
   if (params.expected_iter_count <=
-      LoopUnrollingAnalyzer::kMaxIterForStackCheckRemoval) {
+      v8_flags.turboshaft_loop_stack_check_max_iterations) {
     EXPECT_EQ(1u, stack_checks_to_remove.size());
     EXPECT_TRUE(stack_checks_to_remove.contains(loop.index().id()));
 
     IterationCount iter_count = analyzer.GetIterationCount(&loop);
     ASSERT_TRUE(iter_count.IsApprox());
     EXPECT_TRUE(iter_count.IsSmallerThan(
-        LoopUnrollingAnalyzer::kMaxIterForStackCheckRemoval));
+        v8_flags.turboshaft_loop_stack_check_max_iterations));
   } else {
     EXPECT_EQ(0u, stack_checks_to_remove.size());
     EXPECT_FALSE(stack_checks_to_remove.contains(loop.index().id()));
@@ -371,7 +371,7 @@ TEST_P(LoopUnrollingAnalyzerLargeLoopTest, LargeLoopIterCount) {
     IterationCount iter_count = analyzer.GetIterationCount(&loop);
     ASSERT_TRUE(iter_count.IsApprox());
     EXPECT_FALSE(iter_count.IsSmallerThan(
-        LoopUnrollingAnalyzer::kMaxIterForStackCheckRemoval));
+        v8_flags.turboshaft_loop_stack_check_max_iterations));
   }
 }
 
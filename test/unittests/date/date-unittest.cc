@@ -22,6 +22,13 @@ class DateTest : public TestWithContext {
     int64_t expected = time + date_cache->GetLocalOffsetFromOS(time, true);
     CHECK_EQ(actual, expected);
   }
+
+  void CheckLocalToUTC(int64_t time) {
+    DateCache* date_cache = i_isolate()->date_cache();
+    int64_t actual = date_cache->ToUTC(time);
+    int64_t expected = time - date_cache->GetLocalOffsetFromOS(time, false);
+    CHECK_EQ(actual, expected);
+  }
 };
 
 class DateCacheMock : public DateCache {
@@ -141,6 +148,39 @@ TEST_F(DateTest, DaylightSavingsTime) {
   CheckDST(august_20);
 }
 
+TEST_F(DateTest, LocalTimeToUTC) {
+  v8::HandleScope scope(isolate());
+  DateCacheMock::Rule rules[] = {
+      {0, 2, 0, 10, 0, 3600},  // DST from March to November in any year.
+  };
+
+  int local_offset_ms = -36000000;  // -10 hours.
+
+  DateCacheMock* date_cache =
+      new DateCacheMock(local_offset_ms, rules, arraysize(rules));
+
+  reinterpret_cast<Isolate*>(isolate())->set_date_cache(date_cache);
+
+  int64_t start_of_2010 = TimeFromYearMonthDay(date_cache, 2010, 0, 1);
+  int64_t start_of_2011 = TimeFromYearMonthDay(date_cache, 2011, 0, 1);
+  // Walk forwards and backwards through 2010 with small steps, so that most
+  // conversions are answered by the cache, and across the DST transitions.
+  for (int64_t time = start_of_2010; time <= start_of_2011;
+       time += 3 * 3600 * 1000 + 1000) {
+    CheckLocalToUTC(time);
+  }
+  for (int64_t time = start_of_2011; time >= start_of_2010;
+       time -= DateCache::kMsPerDay) {
+    CheckLocalToUTC(time + 2 * 3600);
+    CheckLocalToUTC(time + 2 * 3600 - 1000);
+  }
+  // Jump between years.
+  for (int year = 2100; year >= 2010; year -= 7) {
+    CheckLocalToUTC(TimeFromYearMonthDay(date_cache, year, 5, 5));
+    CheckLocalToUTC(TimeFromYearMonthDay(date_cache, year, 0, 5));
+  }
+}
+
 namespace {
 int legacy_parse_count = 0;
 void DateParseLegacyCounterCallback(v8::Isolate* isolate,
@@ -163,6 +203,8 @@ TEST_F(DateTest, DateParseLegacyUseCounter) {
   CHECK_EQ(1, legacy_parse_count);
   RunJS("Date.parse('2015-02-31T11:22:33.444     ')");
   CHECK_EQ(1, legacy_parse_count);
+  RunJS("Date.parse('2015-02-28T11:22:33.444+01:00')");
+  CHECK_EQ(1, legacy_parse_count);
 }
 
 }  // namespace internal
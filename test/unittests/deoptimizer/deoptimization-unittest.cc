@@ -27,7 +27,10 @@
 
 #include <stdlib.h>
 
+#include <memory>
+
 #include "include/v8-function.h"
+#include "include/v8-metrics.h"
 #include "src/api/api-inl.h"
 #include "src/base/platform/platform.h"
 #include "src/base/strings.h"
@@ -37,6 +40,7 @@
 #include "src/execution/isolate.h"
 #include "src/init/v8.h"
 #include "src/objects/objects-inl.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/heap/heap-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -754,5 +758,60 @@ TEST_F(DeoptimizationDisableConcurrentRecompilationTest,
   CheckJsInt32(13, "result", context());
 }
 
+namespace {
+
+class DeoptLoopRecorder : public v8::metrics::Recorder {
+ public:
+  void AddMainThreadEvent(const v8::metrics::DeoptimizationLoop& event,
+                          ContextId context_id) override {
+    count_++;
+    deopt_count_ = event.deopt_count;
+    feedback_generalized_ = event.feedback_generalized;
+  }
+
+  int count_ = 0;
+  int deopt_count_ = 0;
+  bool feedback_generalized_ = false;
+};
+
+}  // namespace
+
+TEST_F(DeoptimizationTest, DeoptLoopGeneralizesFeedback) {
+  if (!i_isolate()->use_optimizer() || !v8_flags.turbofan) return;
+  FlagScope<int> deopt_loop_threshold(&v8_flags.deopt_loop_threshold, 2);
+  v8::HandleScope scope(isolate());
+  auto recorder = std::make_shared<DeoptLoopRecorder>();
+  isolate()->SetMetricsRecorder(recorder);
+
+  AllowNativesSyntaxNoInlining options;
+  // Every new receiver map deopts the load of o.x for a wrong map.
+  RunJS(
+      "function f(o) { return o.x; }"
+      "%PrepareFunctionForOptimization(f);"
+      "f({x: 1});"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f({x: 1});"
+      "f({a: 1, x: 2});"
+      "%PrepareFunctionForOptimization(f);"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f({x: 1});"
+      "f({b: 1, x: 3});");
+  CHECK_EQ(1, recorder->count_);
+  CHECK_EQ(2, recorder->deopt_count_);
+  CHECK(recorder->feedback_generalized_);
+
+  DirectHandle<JSFunction> f = GetJSFunction("f");
+  FeedbackNexus nexus(i_isolate(), f->feedback_vector(), FeedbackSlot(0));
+  CHECK_EQ(InlineCacheState::MEGAMORPHIC, nexus.ic_state());
+
+  // Code optimized with the generalized feedback handles new maps.
+  RunJS(
+      "%PrepareFunctionForOptimization(f);"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f({x: 1});"
+      "f({c: 1, x: 4});");
+  CHECK(f->HasAttachedOptimizedCode(i_isolate()));
+}
+
 }  // namespace internal
 }  // namespace v8
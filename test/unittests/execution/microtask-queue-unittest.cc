@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "include/v8-function.h"
+#include "src/api/api.h"
 #include "src/heap/factory.h"
 #include "src/objects/foreign.h"
 #include "src/objects/js-array-inl.h"
@@ -193,6 +194,62 @@ TEST_P(MicrotaskQueueTest, BufferGrowth) {
   EXPECT_EQ(MicrotaskQueue::kMinimumCapacity + 2, count);
 }
 
+TEST_P(MicrotaskQueueTest, Statistics) {
+  v8::MicrotaskQueue::Statistics statistics = microtask_queue()->GetStatistics();
+  EXPECT_EQ(0u, statistics.pending_microtask_count);
+  EXPECT_EQ(0u, statistics.checkpoint_count);
+
+  int count = 0;
+  for (int i = 0; i < 3; ++i) {
+    microtask_queue()->EnqueueMicrotask(*NewMicrotask([this, &count] {
+      if (count++ == 0) {
+        microtask_queue()->EnqueueMicrotask(*NewMicrotask([&count] {
+          count++;
+        }));
+      }
+    }));
+  }
+  statistics = microtask_queue()->GetStatistics();
+  EXPECT_EQ(3u, statistics.pending_microtask_count);
+  EXPECT_EQ(4, microtask_queue()->RunMicrotasks(isolate()));
+  EXPECT_EQ(4, count);
+
+  microtask_queue()->EnqueueMicrotask(*NewMicrotask([] {}));
+  EXPECT_EQ(1, microtask_queue()->RunMicrotasks(isolate()));
+
+  statistics = microtask_queue()->GetStatistics();
+  EXPECT_EQ(0u, statistics.pending_microtask_count);
+  EXPECT_EQ(3u, statistics.max_pending_microtask_count);
+  EXPECT_EQ(5u, statistics.finished_microtask_count);
+  EXPECT_EQ(2u, statistics.checkpoint_count);
+  EXPECT_EQ(4u, statistics.max_microtasks_per_checkpoint);
+}
+
+// Consecutive microtasks of one native context share its entered context, but
+// callbacks still run without any context entered.
+TEST_P(MicrotaskQueueTest, BatchedContextEntering) {
+  microtask_queue()->set_microtasks_policy(MicrotasksPolicy::kExplicit);
+  HandleScopeImplementer* hsi = isolate()->handle_scope_implementer();
+  size_t base_count = hsi->EnteredContextCount();
+
+  RunJS(
+      "var log = [];"
+      "Promise.resolve().then(() => log.push(1));"
+      "Promise.resolve().then(() => log.push(2));");
+  bool ran = false;
+  microtask_queue()->EnqueueMicrotask(*NewMicrotask([&] {
+    EXPECT_EQ(base_count, hsi->EnteredContextCount());
+    ran = true;
+  }));
+  RunJS("Promise.resolve().then(() => log.push(3));");
+
+  EXPECT_EQ(4, microtask_queue()->RunMicrotasks(isolate()));
+  EXPECT_TRUE(ran);
+  EXPECT_EQ(base_count, hsi->EnteredContextCount());
+  DirectHandle<JSArray> log = RunJS<JSArray>("log");
+  EXPECT_EQ(3u, Object::NumberValue(log->length()));
+}
+
 // MicrotaskQueue instances form a doubly linked list.
 TEST_P(MicrotaskQueueTest, InstanceChain) {
   ClearTestMicrotaskQueue();
@@ -3,10 +3,12 @@
 // found in the LICENSE file.
 
 #include <algorithm>
+#include <atomic>
 #include <set>
 #include <vector>
 
 #include "include/cppgc/allocation.h"
+#include "include/cppgc/macros.h"
 #include "include/cppgc/platform.h"
 #include "include/v8-platform.h"
 #include "src/heap/cppgc/globals.h"
@@ -62,11 +64,36 @@ class NonFinalizable : public GarbageCollected<NonFinalizable<Size>> {
 using NormalNonFinalizable = NonFinalizable<32>;
 using LargeNonFinalizable = NonFinalizable<kLargeObjectSizeThreshold * 2>;
 
+std::atomic<size_t> g_concurrent_destructor_callcount;
+
+template <size_t Size>
+class ConcurrentlyFinalizable
+    : public GarbageCollected<ConcurrentlyFinalizable<Size>> {
+  CPPGC_FINALIZE_CONCURRENTLY();
+
+ public:
+  ~ConcurrentlyFinalizable() {
+    g_concurrent_destructor_callcount.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void Trace(cppgc::Visitor*) const {}
+
+ private:
+  char array_[Size];
+};
+
+using NormalConcurrentlyFinalizable = ConcurrentlyFinalizable<32>;
+using LargeConcurrentlyFinalizable =
+    ConcurrentlyFinalizable<kLargeObjectSizeThreshold * 2>;
+
 }  // namespace
 
 class ConcurrentSweeperTest : public testing::TestWithHeap {
  public:
-  ConcurrentSweeperTest() { g_destructor_callcount = 0; }
+  ConcurrentSweeperTest() {
+    g_destructor_callcount = 0;
+    g_concurrent_destructor_callcount = 0;
+  }
 
   void StartSweeping() {
     Heap* heap = Heap::From(GetHeap());
@@ -272,6 +299,56 @@ TEST_F(ConcurrentSweeperTest, DeferredFinalizationOfNormalPage) {
   EXPECT_EQ(kNumberOfObjects, g_destructor_callcount);
 }
 
+TEST_F(ConcurrentSweeperTest, ConcurrentFinalizationOfNormalPage) {
+  static constexpr size_t kNumberOfObjects = 10;
+  using GCedType = NormalConcurrentlyFinalizable;
+  static_assert(FinalizerTrait<GCedType>::kFinalizeConcurrently);
+
+  std::vector<void*> objects;
+  BaseSpace* space = nullptr;
+  for (size_t i = 0; i < kNumberOfObjects; ++i) {
+    auto* object = MakeGarbageCollected<GCedType>(GetAllocationHandle());
+    objects.push_back(object);
+    if (!space) space = &BasePage::FromPayload(object)->space();
+  }
+
+  StartSweeping();
+
+  // Wait for concurrent sweeping to finish.
+  WaitForConcurrentSweeping();
+
+  // Check that finalizers have been executed by the concurrent sweeper.
+  EXPECT_EQ(kNumberOfObjects, g_concurrent_destructor_callcount.load());
+
+  FinishSweeping();
+
+  // Check that objects are swept and turned into freelist entries.
+  CheckFreeListEntries(objects);
+  EXPECT_TRUE(FreeListContains(*space, objects));
+  EXPECT_EQ(kNumberOfObjects, g_concurrent_destructor_callcount.load());
+}
+
+TEST_F(ConcurrentSweeperTest, ConcurrentFinalizationOfLargePage) {
+  using GCedType = LargeConcurrentlyFinalizable;
+
+  auto* object = MakeGarbageCollected<GCedType>(GetAllocationHandle());
+  auto* page = BasePage::FromPayload(object);
+
+  StartSweeping();
+
+  // Wait for concurrent sweeping to finish.
+  WaitForConcurrentSweeping();
+
+  // Check that the destructor was executed by the concurrent sweeper.
+  EXPECT_EQ(1u, g_concurrent_destructor_callcount.load());
+
+  FinishSweeping();
+
+  // Check that the destructor did not run again and the page was unmapped.
+  EXPECT_EQ(1u, g_concurrent_destructor_callcount.load());
+  EXPECT_FALSE(PageInBackend(page));
+}
+
 TEST_F(ConcurrentSweeperTest, DeferredFinalizationOfLargePage) {
   using GCedType = LargeFinalizable;
 
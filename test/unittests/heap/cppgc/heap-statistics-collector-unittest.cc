@@ -98,6 +98,11 @@ TEST_F(HeapStatisticsCollectorTest, NonEmptyNormalPage) {
     EXPECT_EQ(kPageSize, space_stats.page_stats.back().committed_size_bytes);
     EXPECT_EQ(kPageSize, space_stats.page_stats.back().resident_size_bytes);
     EXPECT_EQ(used_size, space_stats.page_stats.back().used_size_bytes);
+    // The object was bump-allocated from a buffer spanning the new page.
+    EXPECT_EQ(0u, space_stats.linear_allocation_stats.refills_from_free_list);
+    EXPECT_EQ(1u, space_stats.linear_allocation_stats.refills_from_new_pages);
+    EXPECT_EQ(NormalPage::PayloadSize(),
+              space_stats.linear_allocation_stats.refilled_bytes);
   }
   EXPECT_TRUE(found_non_empty_space);
 }
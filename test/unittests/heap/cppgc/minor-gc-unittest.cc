@@ -4,6 +4,7 @@
 
 #if defined(CPPGC_YOUNG_GENERATION)
 
+#include <algorithm>
 #include <initializer_list>
 #include <vector>
 
@@ -15,6 +16,7 @@
 #include "src/heap/cppgc/heap-object-header.h"
 #include "src/heap/cppgc/heap-visitor.h"
 #include "src/heap/cppgc/heap.h"
+#include "src/heap/cppgc/remembered-set.h"
 #include "test/unittests/heap/cppgc/tests.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -878,6 +880,30 @@ TEST_F(MinorGCTest, RevisitNestedInConstructionObjects) {
   EXPECT_EQ(0u, RememberedInConstructionObjects().size());
 }
 
+TEST(RememberedEntriesTest, DeduplicatesInBatches) {
+  int slots[1024];
+  RememberedEntries<void*> entries;
+  // Repeated writes to the same slots are only remembered once.
+  for (int round = 0; round < 100; ++round) {
+    for (int& slot : slots) entries.Add(&slot);
+  }
+  EXPECT_EQ(arraysize(slots), entries.size());
+  EXPECT_EQ(1u, entries.count(&slots[42]));
+
+  entries.EraseRange(&slots[0], &slots[512]);
+  EXPECT_EQ(arraysize(slots) - 512, entries.size());
+  EXPECT_EQ(0u, entries.count(&slots[42]));
+  EXPECT_EQ(1u, entries.count(&slots[512]));
+
+  entries.Erase(&slots[512]);
+  EXPECT_EQ(0u, entries.count(&slots[512]));
+  EXPECT_TRUE(std::is_sorted(entries.entries().begin(),
+                             entries.entries().end()));
+
+  entries.Clear();
+  EXPECT_TRUE(entries.empty());
+}
+
 }  // namespace internal
 }  // namespace cppgc
 
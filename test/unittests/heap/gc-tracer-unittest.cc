@@ -545,4 +545,46 @@ TEST_F(GCTracerTest, CyclePriorities) {
   EXPECT_FALSE(tracer->current_.priority.has_value());
 }
 
+TEST(LatencyHistogramTest, Buckets) {
+  using Histogram = v8::metrics::LatencyHistogram;
+  // Small values are exact.
+  for (int64_t value = 0; value < 2 * Histogram::kSubBucketCount; value++) {
+    EXPECT_EQ(value, Histogram::BucketUpperBound(value));
+  }
+  // Larger ones are off by at most 1 / kSubBucketCount, and the buckets are
+  // contiguous.
+  for (size_t i = 2 * Histogram::kSubBucketCount; i < Histogram::kBucketCount;
+       i++) {
+    const int64_t lower = Histogram::BucketUpperBound(i - 1) + 1;
+    const int64_t upper = Histogram::BucketUpperBound(i);
+    EXPECT_LE(lower, upper);
+    EXPECT_LE(upper - lower, lower / Histogram::kSubBucketCount);
+  }
+  EXPECT_EQ(Histogram::kMaxValue,
+            Histogram::BucketUpperBound(Histogram::kBucketCount - 1));
+}
+
+TEST(LatencyHistogramTest, Percentiles) {
+  v8::metrics::LatencyHistogram histogram;
+  EXPECT_EQ(0, histogram.ValueAtPercentile(50));
+  for (int64_t value = 1; value <= 1000; value++) histogram.Record(value);
+  EXPECT_EQ(1000u, histogram.count());
+  EXPECT_EQ(1000, histogram.max());
+  EXPECT_EQ(500500, histogram.sum());
+  const int64_t median = histogram.ValueAtPercentile(50);
+  EXPECT_LE(500, median);
+  EXPECT_GE(500 + 500 / 16, median);
+  const int64_t p99 = histogram.ValueAtPercentile(99);
+  EXPECT_LE(990, p99);
+  EXPECT_GE(1000, p99);
+  EXPECT_EQ(1000, histogram.ValueAtPercentile(100));
+
+  v8::metrics::LatencyHistogram other;
+  other.Record(int64_t{1} << 40);
+  histogram.Merge(other);
+  EXPECT_EQ(1001u, histogram.count());
+  EXPECT_EQ(v8::metrics::LatencyHistogram::kMaxValue,
+            histogram.ValueAtPercentile(100));
+}
+
 }  // namespace v8::internal
@@ -13,6 +13,7 @@
 #include "src/handles/handles.h"
 
 #include "src/heap/heap-controller.h"
+#include "src/heap/page-metadata.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -116,5 +117,39 @@ TEST_F(MemoryControllerTest, OldGenerationAllocationLimit) {
                 new_space_capacity, Heap::HeapGrowingMode::kMinimal));
 }
 
+TEST_F(MemoryControllerTest, NewSpaceTargetCapacity) {
+  Heap* heap = i_isolate()->heap();
+  const size_t min_capacity = 1 * MB;
+  const size_t max_capacity = 16 * MB;
+  const double pause_ms = 1;
+  const double speed = 1 * MB;
+
+  EXPECT_FALSE(NewSpaceController::TargetCapacity(heap, pause_ms, std::nullopt,
+                                                  10, 0, min_capacity,
+                                                  max_capacity)
+                   .has_value());
+  // 10% of 10 MB survive and are copied in 1 ms.
+  EXPECT_EQ(10 * MB,
+            NewSpaceController::TargetCapacity(heap, pause_ms, speed, 10, 0,
+                                               min_capacity, max_capacity));
+  // Objects mostly survive, so new space stays at its minimum.
+  EXPECT_EQ(min_capacity,
+            NewSpaceController::TargetCapacity(heap, pause_ms, speed, 100, 0,
+                                               min_capacity, max_capacity));
+  // Objects all die, so new space grows to its maximum.
+  EXPECT_EQ(max_capacity,
+            NewSpaceController::TargetCapacity(heap, pause_ms, speed, 0, 0,
+                                               min_capacity, max_capacity));
+  // Little is allocated, so the capacity is bounded by what is allocated in
+  // the allocation window.
+  const double throughput = 4 * MB / NewSpaceController::kMaxAllocationWindowMs;
+  const size_t capacity =
+      NewSpaceController::TargetCapacity(heap, pause_ms, speed, 10, throughput,
+                                         min_capacity, max_capacity)
+          .value();
+  EXPECT_LE(capacity, 4 * MB);
+  EXPECT_GT(capacity, 4 * MB - PageMetadata::kPageSize);
+}
+
 }  // namespace internal
 }  // namespace v8
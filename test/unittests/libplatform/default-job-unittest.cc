@@ -294,6 +294,83 @@ TEST(DefaultJobTest, AcquireTaskId) {
   EXPECT_EQ(5U, state->AcquireTaskId());
 }
 
+// Verify that the worker limits of tenants follow their weights and which
+// tenants are busy.
+TEST(DefaultJobTest, TenantFairShare) {
+  auto group = std::make_shared<DefaultJobTenantGroup>(4);
+  auto tenant_a = std::make_shared<DefaultJobTenant>(group, 3, 0);
+  auto tenant_b = std::make_shared<DefaultJobTenant>(group, 1, 0);
+
+  // Without competition, a tenant may use all workers.
+  EXPECT_EQ(4U, tenant_a->limit());
+  EXPECT_EQ(4U, tenant_b->limit());
+  for (int i = 0; i < 4; i++) EXPECT_TRUE(tenant_a->TryAcquireWorker({}));
+  EXPECT_FALSE(tenant_a->TryAcquireWorker({}));
+  EXPECT_EQ(1U, tenant_b->limit());
+
+  // Once |tenant_b| is busy, |tenant_a| gets three quarters of the workers and
+  // has to give one back.
+  EXPECT_TRUE(tenant_b->TryAcquireWorker({}));
+  EXPECT_FALSE(tenant_b->TryAcquireWorker({}));
+  EXPECT_EQ(3U, tenant_a->limit());
+  EXPECT_TRUE(tenant_a->IsOverLimit());
+  tenant_a->ReleaseWorker();
+  EXPECT_FALSE(tenant_a->IsOverLimit());
+  EXPECT_FALSE(tenant_a->TryAcquireWorker({}));
+
+  tenant_b->ReleaseWorker();
+  EXPECT_EQ(4U, tenant_a->limit());
+  for (int i = 0; i < 3; i++) tenant_a->ReleaseWorker();
+}
+
+// Verify that the jobs of a tenant don't run on more worker threads than the
+// tenant's cap.
+TEST(DefaultJobTest, TenantMaxWorkers) {
+  static constexpr size_t kMaxTask = 4;
+  static constexpr size_t kWorkItems = 1000;
+  DefaultPlatform platform(kMaxTask);
+  auto group = std::make_shared<DefaultJobTenantGroup>(kMaxTask);
+  auto tenant = std::make_shared<DefaultJobTenant>(group, 1, 1);
+
+  class JobTest : public JobTask {
+   public:
+    ~JobTest() override = default;
+
+    void Run(JobDelegate* delegate) override {
+      size_t running = ++running_workers;
+      size_t peak = peak_workers.load();
+      while (running > peak &&
+             !peak_workers.compare_exchange_weak(peak, running)) {
+      }
+      while (!delegate->ShouldYield()) {
+        size_t remaining = remaining_work.load();
+        if (remaining == 0) break;
+        remaining_work.compare_exchange_weak(remaining, remaining - 1);
+      }
+      --running_workers;
+    }
+
+    size_t GetMaxConcurrency(size_t /* worker_count */) const override {
+      return remaining_work.load() == 0 ? 0 : kMaxTask;
+    }
+
+    std::atomic_size_t remaining_work{kWorkItems};
+    std::atomic_size_t running_workers{0};
+    std::atomic_size_t peak_workers{0};
+  };
+
+  auto job = std::make_unique<JobTest>();
+  JobTest* job_raw = job.get();
+  auto state = std::make_shared<DefaultJobState>(
+      &platform, std::move(job), TaskPriority::kUserVisible, kMaxTask, tenant);
+  state->NotifyConcurrencyIncrease();
+
+  while (job_raw->remaining_work != 0) {
+  }
+  state->CancelAndWait();
+  EXPECT_EQ(1U, job_raw->peak_workers);
+}
+
 }  // namespace default_job_unittest
 }  // namespace platform
 }  // namespace v8
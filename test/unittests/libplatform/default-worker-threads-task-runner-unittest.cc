@@ -268,6 +268,88 @@ TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostAfterTerminate) {
   ASSERT_EQ(1, order[0]);
 }
 
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, WorkStealingPostTaskOrder) {
+  DefaultWorkerThreadsTaskRunner runner(1, RealTime,
+                                        base::Thread::Priority::kDefault,
+                                        WorkerScheduling::kWorkStealing);
+
+  std::vector<int> order;
+  base::Semaphore semaphore(0);
+
+  for (int i = 1; i <= 3; i++) {
+    runner.PostTask(std::make_unique<TestTask>([&, i] {
+      order.push_back(i);
+      if (i == 3) semaphore.Signal();
+    }));
+  }
+
+  semaphore.Wait();
+
+  runner.Terminate();
+  ASSERT_EQ(3UL, order.size());
+  ASSERT_EQ(1, order[0]);
+  ASSERT_EQ(2, order[1]);
+  ASSERT_EQ(3, order[2]);
+}
+
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, WorkStealingNestedTasks) {
+  DefaultWorkerThreadsTaskRunner runner(4, RealTime,
+                                        base::Thread::Priority::kDefault,
+                                        WorkerScheduling::kWorkStealing);
+
+  // Every task posts two more tasks from its worker thread, which puts them
+  // into that worker's own queue. Other workers have to steal them.
+  constexpr int kDepth = 8;
+  constexpr int kTotalTasks = (1 << (kDepth + 1)) - 1;
+  std::atomic_int count{0};
+  base::Semaphore semaphore(0);
+  std::function<void(int)> post = [&](int depth) {
+    runner.PostTask(std::make_unique<TestTask>([&, depth] {
+      if (depth < kDepth) {
+        post(depth + 1);
+        post(depth + 1);
+      }
+      if (++count == kTotalTasks) semaphore.Signal();
+    }));
+  };
+  post(0);
+
+  semaphore.Wait();
+
+  runner.Terminate();
+  ASSERT_EQ(kTotalTasks, count);
+}
+
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, WorkStealingPostDelayedTask) {
+  FakeClock::set_time(0.0);
+  DefaultWorkerThreadsTaskRunner runner(2, FakeClock::time,
+                                        base::Thread::Priority::kDefault,
+                                        WorkerScheduling::kWorkStealing);
+
+  std::vector<int> order;
+  base::Semaphore task1_semaphore(0);
+  base::Semaphore task2_semaphore(0);
+
+  runner.PostDelayedTask(std::make_unique<TestTask>([&] {
+                           order.push_back(1);
+                           task1_semaphore.Signal();
+                         }),
+                         100);
+  runner.PostTask(std::make_unique<TestTask>([&] {
+    order.push_back(2);
+    task2_semaphore.Signal();
+  }));
+
+  task2_semaphore.Wait();
+  FakeClock::set_time_and_wake_up_runner(101, &runner);
+  task1_semaphore.Wait();
+
+  runner.Terminate();
+  ASSERT_EQ(2UL, order.size());
+  ASSERT_EQ(2, order[0]);
+  ASSERT_EQ(1, order[1]);
+}
+
 TEST(DefaultWorkerThreadsTaskRunnerUnittest, NoIdleTasks) {
   DefaultWorkerThreadsTaskRunner runner(1, FakeClock::time);
 
@@ -640,6 +640,29 @@ TEST_F(RuntimeCallStatsTest, ApiGetter) {
   EXPECT_EQ(kCustomCallbackTime * 4013, counter2()->time().InMicroseconds());
 }
 
+TEST_F(RuntimeCallStatsTest, Sampler) {
+  TracingFlags::runtime_stats.store(
+      v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING,
+      std::memory_order_relaxed);
+  RuntimeCallStatsSampler sampler(stats());
+  const int id = static_cast<int>(counter_id());
+  {
+    RCS_SCOPE(stats(), counter_id());
+    Sleep(50);
+    while (sampler.samples(id) == 0) {
+      base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+    }
+  }
+  // Timers are not started while sampling.
+  EXPECT_EQ(0, counter()->count());
+  EXPECT_EQ(0, counter()->time().InMicroseconds());
+  EXPECT_GE(sampler.total_samples(), sampler.samples(id));
+  EXPECT_EQ(0u, sampler.samples(static_cast<int>(counter_id2())));
+  // No counter is active any more, so none gets new samples.
+  sampler.Reset();
+  EXPECT_EQ(0u, sampler.samples(id));
+}
+
 TEST_F(RuntimeCallStatsTest, GarbageCollection) {
   if (v8_flags.stress_incremental_marking) return;
   v8_flags.expose_gc = true;
@@ -2082,6 +2082,102 @@ TEST_F(ValueSerializerTestWithArrayBufferTransfer,
   ExpectScriptTrue("new Uint8Array(result.a).toString() === '0,1,128,255'");
 }
 
+class ValueSerializerTestWithBackingStoreReference
+    : public ValueSerializerTest {
+ protected:
+  static const size_t kThreshold = 64;
+
+  class SerializerDelegate : public ValueSerializer::Delegate {
+   public:
+    explicit SerializerDelegate(
+        ValueSerializerTestWithBackingStoreReference* test)
+        : test_(test) {}
+    Maybe<uint32_t> GetBackingStoreId(
+        Isolate* isolate,
+        std::shared_ptr<BackingStore> backing_store) override {
+      test_->backing_stores_.push_back(std::move(backing_store));
+      return Just(static_cast<uint32_t>(test_->backing_stores_.size() - 1));
+    }
+    void ThrowDataCloneError(Local<String> message) override {
+      test_->isolate()->ThrowException(Exception::Error(message));
+    }
+
+   private:
+    ValueSerializerTestWithBackingStoreReference* test_;
+  };
+
+  class DeserializerDelegate : public ValueDeserializer::Delegate {
+   public:
+    explicit DeserializerDelegate(
+        ValueSerializerTestWithBackingStoreReference* test)
+        : test_(test) {}
+    std::shared_ptr<BackingStore> GetBackingStoreFromId(Isolate* isolate,
+                                                        uint32_t id) override {
+      if (id >= test_->backing_stores_.size()) return nullptr;
+      return test_->backing_stores_[id];
+    }
+
+   private:
+    ValueSerializerTestWithBackingStoreReference* test_;
+  };
+
+  ValueSerializerTestWithBackingStoreReference()
+      : serializer_delegate_(this), deserializer_delegate_(this) {}
+
+  ValueSerializer::Delegate* GetSerializerDelegate() override {
+    return &serializer_delegate_;
+  }
+  void BeforeEncode(ValueSerializer* serializer) override {
+    serializer->SetBackingStoreReferenceThreshold(kThreshold);
+  }
+  ValueDeserializer::Delegate* GetDeserializerDelegate() override {
+    return &deserializer_delegate_;
+  }
+
+  SerializerDelegate serializer_delegate_;
+  DeserializerDelegate deserializer_delegate_;
+  std::vector<std::shared_ptr<BackingStore>> backing_stores_;
+};
+
+TEST_F(ValueSerializerTestWithBackingStoreReference,
+       RoundTripArrayBufferReference) {
+  Local<Value> input = EvaluateScriptForInput(
+      "var buffer = new ArrayBuffer(128);"
+      "new Uint8Array(buffer).fill(7);"
+      "({ a: buffer, b: new Uint8Array(buffer, 8, 16),"
+      "   c: new ArrayBuffer(4) })");
+  Local<Value> value = RoundTripTest(input);
+  ASSERT_TRUE(value->IsObject());
+  // Only the large buffer is passed by reference, and only once.
+  ASSERT_EQ(1u, backing_stores_.size());
+  ExpectScriptTrue("result.a.byteLength === 128");
+  ExpectScriptTrue("new Uint8Array(result.a).every(x => x === 7)");
+  ExpectScriptTrue("result.b.buffer === result.a");
+  ExpectScriptTrue("result.b.byteOffset === 8 && result.b.length === 16");
+  ExpectScriptTrue("result.c.byteLength === 4");
+
+  // The deserialized buffer adopted the backing store instead of copying it.
+  Local<Value> a;
+  {
+    Context::Scope scope(deserialization_context());
+    a = value.As<Object>()
+            ->Get(deserialization_context(), StringFromUtf8("a"))
+            .ToLocalChecked();
+  }
+  ASSERT_TRUE(a->IsArrayBuffer());
+  EXPECT_EQ(backing_stores_[0]->Data(),
+            a.As<ArrayBuffer>()->GetBackingStore()->Data());
+}
+
+TEST_F(ValueSerializerTestWithBackingStoreReference,
+       DecodeArrayBufferReferenceLengthMismatch) {
+  backing_stores_.push_back(ArrayBuffer::NewBackingStore(isolate(), 8));
+  // Tag '&', backing store 0, byte length 4.
+  InvalidDecodeTest({0xFF, 0x0F, 0x26, 0x00, 0x04});
+  // Unknown backing store.
+  InvalidDecodeTest({0xFF, 0x0F, 0x26, 0x01, 0x08});
+}
+
 TEST_F(ValueSerializerTest, RoundTripTypedArray) {
   FLAG_SCOPE(js_float16array);
   // Check that the right type comes out the other side for every kind of typed
@@ -0,0 +1,105 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/agent-mailbox.h"
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace opencog {
+namespace {
+
+AgentMessage MakeMessage(const std::string& payload) {
+  AgentMessage message;
+  message.from_agent_id = "sender";
+  message.to_agent_id = "receiver";
+  message.type = "test";
+  message.payload = payload;
+  return message;
+}
+
+TEST(AgentMailboxTest, CapacityIsRoundedToPowerOfTwo) {
+  AgentMailbox mailbox(5, AgentMailbox::OverflowPolicy::kReject);
+  EXPECT_EQ(mailbox.capacity(), 8u);
+  EXPECT_TRUE(mailbox.IsEmpty());
+}
+
+TEST(AgentMailboxTest, RejectKeepsExistingMessages) {
+  AgentMailbox mailbox(4, AgentMailbox::OverflowPolicy::kReject);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(mailbox.Push(MakeMessage(std::to_string(i)), true),
+              AgentMailbox::PushResult::kDelivered);
+  }
+  EXPECT_EQ(mailbox.Push(MakeMessage("overflow"), true),
+            AgentMailbox::PushResult::kRejected);
+
+  AgentMessage message;
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_TRUE(mailbox.TryPop(&message));
+    EXPECT_EQ(message.payload, std::to_string(i));
+  }
+  EXPECT_FALSE(mailbox.TryPop(&message));
+}
+
+TEST(AgentMailboxTest, DropOldestEvictsHead) {
+  AgentMailbox mailbox(4, AgentMailbox::OverflowPolicy::kDropOldest);
+  for (int i = 0; i < 6; ++i) {
+    mailbox.Push(MakeMessage(std::to_string(i)), true);
+  }
+
+  AgentMessage message;
+  for (int i = 2; i < 6; ++i) {
+    ASSERT_TRUE(mailbox.TryPop(&message));
+    EXPECT_EQ(message.payload, std::to_string(i));
+  }
+  EXPECT_TRUE(mailbox.IsEmpty());
+}
+
+TEST(AgentMailboxTest, BlockRejectsWhenBlockingIsNotAllowed) {
+  AgentMailbox mailbox(2, AgentMailbox::OverflowPolicy::kBlock);
+  mailbox.Push(MakeMessage("a"), true);
+  mailbox.Push(MakeMessage("b"), true);
+  EXPECT_EQ(mailbox.Push(MakeMessage("c"), false),
+            AgentMailbox::PushResult::kRejected);
+}
+
+TEST(AgentMailboxTest, BlockedProducersMakeProgress) {
+  constexpr int kProducers = 4;
+  constexpr int kMessagesPerProducer = 2000;
+  AgentMailbox mailbox(16, AgentMailbox::OverflowPolicy::kBlock);
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&mailbox, p]() {
+      for (int i = 0; i < kMessagesPerProducer; ++i) {
+        mailbox.Push(MakeMessage(std::to_string(p)), true);
+      }
+    });
+  }
+
+  int received[kProducers] = {};
+  AgentMessage message;
+  for (int n = 0; n < kProducers * kMessagesPerProducer;) {
+    if (mailbox.TryPop(&message)) {
+      ++received[std::stoi(message.payload)];
+      ++n;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  for (auto& producer : producers) producer.join();
+  for (int p = 0; p < kProducers; ++p) {
+    EXPECT_EQ(received[p], kMessagesPerProducer);
+  }
+  EXPECT_TRUE(mailbox.IsEmpty());
+}
+
+}  // namespace
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,137 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/agent-scheduler.h"
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <thread>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace opencog {
+namespace {
+
+class IdleAgent : public Agent {
+ public:
+  IdleAgent(const std::string& agent_id, const std::string& tenant_id,
+            AgentPriority priority = AgentPriority::kBatch)
+      : Agent(agent_id, tenant_id) {
+    set_priority(priority);
+  }
+  void Execute() override {}
+};
+
+constexpr auto kNoStarvation = std::chrono::hours(1);
+
+TEST(AgentSchedulerTest, InteractiveGoesFirst) {
+  AgentScheduler scheduler(kNoStarvation);
+  scheduler.Push(std::make_shared<IdleAgent>("batch1", "t"));
+  scheduler.Push(std::make_shared<IdleAgent>("batch2", "t"));
+  scheduler.Push(std::make_shared<IdleAgent>("interactive", "t",
+                                             AgentPriority::kInteractive));
+  EXPECT_EQ(scheduler.size(), 3u);
+  EXPECT_EQ(scheduler.Pop()->agent_id(), "interactive");
+  EXPECT_EQ(scheduler.Pop()->agent_id(), "batch1");
+  EXPECT_EQ(scheduler.Pop()->agent_id(), "batch2");
+  EXPECT_EQ(scheduler.Pop(), nullptr);
+  EXPECT_EQ(scheduler.stats().dispatched, 3u);
+}
+
+TEST(AgentSchedulerTest, EarliestDeadlineFirstWithinTenant) {
+  AgentScheduler scheduler(kNoStarvation);
+  auto relaxed = std::make_shared<IdleAgent>("relaxed", "t");
+  relaxed->set_relative_deadline(std::chrono::seconds(10));
+  auto urgent = std::make_shared<IdleAgent>("urgent", "t");
+  urgent->set_relative_deadline(std::chrono::milliseconds(10));
+  auto whenever = std::make_shared<IdleAgent>("whenever", "t");
+
+  scheduler.Push(whenever);
+  scheduler.Push(relaxed);
+  scheduler.Push(urgent);
+  EXPECT_EQ(scheduler.Pop(), urgent);
+  EXPECT_EQ(scheduler.Pop(), relaxed);
+  EXPECT_EQ(scheduler.Pop(), whenever);
+}
+
+TEST(AgentSchedulerTest, TenantsShareByWeight) {
+  AgentScheduler scheduler(kNoStarvation);
+  scheduler.SetTenantWeight("heavy", 3);
+  // The noisy tenant queues far more work than the others.
+  for (int i = 0; i < 1000; ++i) {
+    scheduler.Push(std::make_shared<IdleAgent>("n" + std::to_string(i),
+                                               "noisy"));
+  }
+  for (int i = 0; i < 100; ++i) {
+    scheduler.Push(std::make_shared<IdleAgent>("h" + std::to_string(i),
+                                               "heavy"));
+    scheduler.Push(std::make_shared<IdleAgent>("q" + std::to_string(i),
+                                               "quiet"));
+  }
+
+  std::map<std::string, int> dispatched;
+  for (int i = 0; i < 100; ++i) ++dispatched[scheduler.Pop()->tenant_id()];
+  EXPECT_EQ(dispatched["heavy"], 60);
+  EXPECT_EQ(dispatched["noisy"], 20);
+  EXPECT_EQ(dispatched["quiet"], 20);
+}
+
+TEST(AgentSchedulerTest, StarvedBatchWorkIsPromoted) {
+  AgentScheduler scheduler(std::chrono::milliseconds(1));
+  auto batch = std::make_shared<IdleAgent>("batch", "t");
+  scheduler.Push(batch);
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  scheduler.Push(std::make_shared<IdleAgent>("interactive", "t",
+                                             AgentPriority::kInteractive));
+
+  EXPECT_EQ(scheduler.Pop(), batch);
+  EXPECT_EQ(scheduler.stats().starvation_promotions, 1u);
+  EXPECT_GE(scheduler.stats().max_wait, std::chrono::milliseconds(5));
+  EXPECT_EQ(scheduler.Pop()->agent_id(), "interactive");
+}
+
+TEST(AgentSchedulerTest, IdleTenantsDoNotBankCredit) {
+  AgentScheduler scheduler(kNoStarvation);
+  for (int i = 0; i < 50; ++i) {
+    scheduler.Push(std::make_shared<IdleAgent>("a" + std::to_string(i), "a"));
+  }
+  for (int i = 0; i < 50; ++i) scheduler.Pop();
+
+  // Tenant b was idle while a ran; it gets its fair share from now on, not
+  // fifty dispatches in a row. Ties between tenants go either way.
+  for (int i = 0; i < 10; ++i) {
+    scheduler.Push(std::make_shared<IdleAgent>("a" + std::to_string(i), "a"));
+    scheduler.Push(std::make_shared<IdleAgent>("b" + std::to_string(i), "b"));
+  }
+  std::map<std::string, int> dispatched;
+  for (int i = 0; i < 10; ++i) ++dispatched[scheduler.Pop()->tenant_id()];
+  EXPECT_GE(dispatched["b"], 4);
+  EXPECT_LE(dispatched["b"], 6);
+}
+
+TEST(AgentSchedulerTest, ThrottledTenantsYield) {
+  AgentScheduler scheduler(kNoStarvation);
+  scheduler.SetTenantThrottle("hog", 4);
+  for (int i = 0; i < 100; ++i) {
+    scheduler.Push(std::make_shared<IdleAgent>("h" + std::to_string(i), "hog"));
+    scheduler.Push(std::make_shared<IdleAgent>("o" + std::to_string(i), "ok"));
+  }
+  std::map<std::string, int> dispatched;
+  for (int i = 0; i < 50; ++i) ++dispatched[scheduler.Pop()->tenant_id()];
+  EXPECT_EQ(dispatched["hog"], 10);
+  EXPECT_EQ(dispatched["ok"], 40);
+
+  // Lifting the throttle restores the even split.
+  scheduler.SetTenantThrottle("hog", 1);
+  dispatched.clear();
+  for (int i = 0; i < 20; ++i) ++dispatched[scheduler.Pop()->tenant_id()];
+  EXPECT_GE(dispatched["hog"], 9);
+  EXPECT_LE(dispatched["hog"], 11);
+}
+
+}  // namespace
+}  // namespace opencog
+}  // namespace v8
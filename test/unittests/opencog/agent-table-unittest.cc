@@ -0,0 +1,130 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/agent-table.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace opencog {
+namespace {
+
+class IdleAgent : public Agent {
+ public:
+  IdleAgent(const std::string& agent_id, const std::string& tenant_id)
+      : Agent(agent_id, tenant_id) {}
+  void Execute() override {}
+};
+
+std::shared_ptr<Agent> MakeAgent(const std::string& agent_id,
+                                 const std::string& tenant_id = "tenant1") {
+  return std::make_shared<IdleAgent>(agent_id, tenant_id);
+}
+
+TEST(AgentTableTest, FindsAgentsByNameAndTenant) {
+  AgentTable table;
+  constexpr int kAgents = 1000;
+  std::vector<std::shared_ptr<Agent>> agents;
+  for (int i = 0; i < kAgents; ++i) {
+    agents.push_back(MakeAgent("table-agent" + std::to_string(i),
+                               i % 10 == 0 ? "small" : "large"));
+    ASSERT_TRUE(table.Insert(agents.back()));
+  }
+  EXPECT_FALSE(table.Insert(MakeAgent("table-agent7")));
+  EXPECT_EQ(table.size(), size_t{kAgents});
+
+  for (const auto& agent : agents) {
+    EXPECT_EQ(table.Find(agent->agent_name()), agent);
+    EXPECT_EQ(table.Get(table.FindHandle(agent->agent_name())), agent);
+  }
+  EXPECT_EQ(table.Find("table-stranger"), nullptr);
+  EXPECT_EQ(table.FindHandle("table-stranger"), AgentTable::kNoHandle);
+  EXPECT_EQ(table.GetByTenant("small").size(), size_t{kAgents / 10});
+  EXPECT_TRUE(table.GetByTenant("none").empty());
+
+  // Removal frees the name and the slot for reuse.
+  AgentTable::Handle handle = table.FindHandle("table-agent10");
+  EXPECT_EQ(table.Remove("table-agent10"), agents[10]);
+  EXPECT_EQ(table.Remove("table-agent10"), nullptr);
+  EXPECT_EQ(table.Find("table-agent10"), nullptr);
+  EXPECT_EQ(table.Get(handle), nullptr);
+  EXPECT_EQ(table.GetByTenant("small").size(), size_t{kAgents / 10 - 1});
+  auto replacement = MakeAgent("table-agent10");
+  EXPECT_TRUE(table.Insert(replacement));
+  EXPECT_EQ(table.FindHandle("table-agent10"), handle);
+  EXPECT_EQ(table.GetByTenant("tenant1"),
+            std::vector<std::shared_ptr<Agent>>{replacement});
+
+  size_t visited = 0;
+  table.ForEach([&visited](const std::shared_ptr<Agent>&) { ++visited; });
+  EXPECT_EQ(visited, size_t{kAgents});
+}
+
+TEST(AgentTableTest, PrepareRunsBeforeAgentsAreVisible) {
+  AgentTable table;
+  auto agent = MakeAgent("prepared");
+  bool prepared = false;
+  EXPECT_TRUE(table.Insert(agent, [&](Agent* prepared_agent) {
+    EXPECT_EQ(prepared_agent, agent.get());
+    EXPECT_EQ(table.FindHandle("prepared"), AgentTable::kNoHandle);
+    prepared = true;
+  }));
+  EXPECT_TRUE(prepared);
+  prepared = false;
+  EXPECT_FALSE(table.Insert(MakeAgent("prepared"),
+                            [&](Agent*) { prepared = true; }));
+  EXPECT_FALSE(prepared);
+}
+
+TEST(AgentTableTest, LookupsRaceWithChurn) {
+  AgentTable table;
+  constexpr int kStable = 64;
+  std::vector<std::shared_ptr<Agent>> stable;
+  for (int i = 0; i < kStable; ++i) {
+    stable.push_back(MakeAgent("stable" + std::to_string(i)));
+    table.Insert(stable.back());
+  }
+  std::vector<InternedName> churn_names;
+  for (int i = 0; i < 256; ++i) {
+    churn_names.emplace_back("churn" + std::to_string(i));
+  }
+
+  std::atomic<bool> done{false};
+  std::atomic<int> misses{0};
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 4; ++r) {
+    readers.emplace_back([&]() {
+      while (!done.load()) {
+        for (const auto& agent : stable) {
+          if (table.Find(agent->agent_name()) != agent) misses++;
+        }
+        for (const InternedName& name : churn_names) {
+          auto agent = table.Find(name);
+          if (agent && agent->agent_name() != name) misses++;
+        }
+      }
+    });
+  }
+  // Grows the index and recycles slots while the readers run.
+  for (int round = 0; round < 20; ++round) {
+    for (const InternedName& name : churn_names) {
+      table.Insert(MakeAgent(name.str()));
+    }
+    for (const InternedName& name : churn_names) table.Remove(name);
+  }
+  done.store(true);
+  for (auto& reader : readers) reader.join();
+  EXPECT_EQ(misses.load(), 0);
+  EXPECT_EQ(table.size(), size_t{kStable});
+}
+
+}  // namespace
+}  // namespace opencog
+}  // namespace v8
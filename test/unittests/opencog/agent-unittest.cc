@@ -6,7 +6,9 @@
 #include "include/opencog/agent-orchestrator.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
+#include <atomic>
 #include <chrono>
+#include <string>
 #include <thread>
 
 namespace v8 {
@@ -122,6 +124,35 @@ TEST(AgentOrchestratorTest, ScheduleAndExecute) {
   orchestrator.Stop();
 }
 
+class SlowAgent : public Agent {
+ public:
+  explicit SlowAgent(const std::string& agent_id)
+      : Agent(agent_id, "metered") {}
+  void Execute() override {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    done.store(true);
+  }
+  std::atomic<bool> done{false};
+};
+
+TEST(AgentOrchestratorTest, AccountsRunTimePerTenant) {
+  AgentOrchestrator orchestrator;
+  auto slow = std::make_shared<SlowAgent>("slow");
+  auto other = std::make_shared<TestAgent>("other", "tenant1");
+  orchestrator.RegisterAgent(slow);
+  orchestrator.RegisterAgent(other);
+  orchestrator.Start();
+  orchestrator.ScheduleAgent("slow");
+  while (!slow->done.load()) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  orchestrator.Stop();
+
+  EXPECT_GE(slow->run_time(), std::chrono::milliseconds(5));
+  EXPECT_EQ(orchestrator.TenantRunTime("metered"), slow->run_time());
+  EXPECT_EQ(orchestrator.TenantRunTime("tenant1").count(), 0);
+}
+
 TEST(AgentOrchestratorTest, MessageRouting) {
   AgentOrchestrator orchestrator;
   auto agent1 = std::make_shared<TestAgent>("agent1", "tenant1");
@@ -174,6 +205,312 @@ TEST(AgentOrchestratorTest, BroadcastMessage) {
   orchestrator.Stop();
 }
 
+TEST(AgentOrchestratorTest, RunsAllScheduledAgentsPerWakeup) {
+  AgentOrchestrator orchestrator;
+  std::vector<std::shared_ptr<TestAgent>> agents;
+  for (int i = 0; i < 50; ++i) {
+    agents.push_back(
+        std::make_shared<TestAgent>("agent" + std::to_string(i), "tenant1"));
+    orchestrator.RegisterAgent(agents.back());
+  }
+  orchestrator.Start();
+
+  for (const auto& agent : agents) {
+    orchestrator.ScheduleAgent(agent->agent_id());
+  }
+
+  // A loop that ran one agent per fixed-length tick would need far longer.
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  orchestrator.Stop();
+  for (const auto& agent : agents) EXPECT_EQ(agent->execute_count(), 1);
+}
+
+class PingPongAgent : public Agent {
+ public:
+  PingPongAgent(const std::string& agent_id, const std::string& peer_id,
+                int rounds)
+      : Agent(agent_id, "tenant1"), peer_id_(peer_id), rounds_(rounds) {}
+
+  void Execute() override {}
+  void OnMessage(const AgentMessage& message) override {
+    if (++received_ < rounds_) SendMessage(peer_id_, "ping", "");
+  }
+
+  int received() const { return received_.load(); }
+
+ private:
+  std::string peer_id_;
+  int rounds_;
+  std::atomic<int> received_{0};
+};
+
+TEST(AgentOrchestratorTest, MessageChainsAreNotTickBound) {
+  constexpr int kRounds = 500;
+  AgentOrchestrator orchestrator;
+  auto ping = std::make_shared<PingPongAgent>("ping", "pong", kRounds);
+  auto pong = std::make_shared<PingPongAgent>("pong", "ping", kRounds);
+  orchestrator.RegisterAgent(ping);
+  orchestrator.RegisterAgent(pong);
+  orchestrator.Start();
+
+  ping->SendMessage("pong", "ping", "");
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (pong->received() < kRounds &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  orchestrator.Stop();
+  EXPECT_EQ(pong->received(), kRounds);
+  EXPECT_EQ(ping->received(), kRounds - 1);
+}
+
+// Records whether Execute() or OnMessage() ever overlapped for this agent.
+class ExclusiveAgent : public Agent {
+ public:
+  explicit ExclusiveAgent(const std::string& agent_id)
+      : Agent(agent_id, "tenant1") {}
+
+  void Execute() override {
+    Enter();
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    runs_.fetch_add(1);
+    Leave();
+  }
+  void OnMessage(const AgentMessage& message) override {
+    Enter();
+    messages_.fetch_add(1);
+    Leave();
+  }
+
+  int runs() const { return runs_.load(); }
+  int messages() const { return messages_.load(); }
+  bool overlapped() const { return overlapped_.load(); }
+
+ private:
+  void Enter() {
+    if (active_.fetch_add(1) != 0) overlapped_.store(true);
+  }
+  void Leave() { active_.fetch_sub(1); }
+
+  std::atomic<int> active_{0};
+  std::atomic<int> runs_{0};
+  std::atomic<int> messages_{0};
+  std::atomic<bool> overlapped_{false};
+};
+
+TEST(AgentOrchestratorTest, WorkerThreadsKeepAgentsExclusive) {
+  constexpr int kAgents = 8;
+  constexpr int kRunsPerThread = 25;
+  constexpr int kThreads = 4;
+  AgentOrchestrator::Options options;
+  options.worker_threads = 4;
+  AgentOrchestrator orchestrator(options);
+  std::vector<std::shared_ptr<ExclusiveAgent>> agents;
+  for (int i = 0; i < kAgents; ++i) {
+    agents.push_back(
+        std::make_shared<ExclusiveAgent>("agent" + std::to_string(i)));
+    orchestrator.RegisterAgent(agents.back());
+  }
+  // Work queued before Start() is handed over when the workers come up.
+  orchestrator.ScheduleAgent("agent0");
+  orchestrator.Start();
+
+  std::vector<std::thread> producers;
+  for (int t = 0; t < kThreads; ++t) {
+    producers.emplace_back([&orchestrator, &agents]() {
+      for (int r = 0; r < kRunsPerThread; ++r) {
+        for (const auto& agent : agents) {
+          orchestrator.ScheduleAgent(agent->agent_id());
+          agent->SendMessage(agent->agent_id(), "self", "");
+        }
+      }
+    });
+  }
+  for (auto& producer : producers) producer.join();
+  orchestrator.Stop();
+
+  for (int i = 0; i < kAgents; ++i) {
+    const auto& agent = agents[i];
+    EXPECT_FALSE(agent->overlapped()) << agent->agent_id();
+    EXPECT_EQ(agent->runs(), kThreads * kRunsPerThread + (i == 0 ? 1 : 0));
+    EXPECT_EQ(agent->messages(), kThreads * kRunsPerThread);
+  }
+}
+
+TEST(AgentOrchestratorTest, FullMailboxRejectsMessages) {
+  AgentOrchestrator::Options options;
+  options.mailbox_capacity = 4;
+  options.overflow_policy = AgentMailbox::OverflowPolicy::kReject;
+  AgentOrchestrator orchestrator(options);
+  auto sender = std::make_shared<TestAgent>("sender", "tenant1");
+  auto receiver = std::make_shared<TestAgent>("receiver", "tenant1");
+  orchestrator.RegisterAgent(sender);
+  orchestrator.RegisterAgent(receiver);
+
+  // Nothing drains the mailbox before Start().
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(sender->SendMessage("receiver", "test", std::to_string(i)));
+  }
+  EXPECT_FALSE(sender->SendMessage("receiver", "test", "overflow"));
+  EXPECT_FALSE(sender->SendMessage("nobody", "test", ""));
+  EXPECT_EQ(orchestrator.rejected_message_count(), 1u);
+
+  orchestrator.Start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  orchestrator.Stop();
+  ASSERT_EQ(receiver->received_messages().size(), 4u);
+  EXPECT_EQ(receiver->received_messages()[3].payload, "3");
+}
+
+TEST(AgentOrchestratorTest, DeliverMessageSkipsLookup) {
+  AgentOrchestrator::Options options;
+  options.mailbox_capacity = 2;
+  options.overflow_policy = AgentMailbox::OverflowPolicy::kDropOldest;
+  AgentOrchestrator orchestrator(options);
+  auto receiver = std::make_shared<TestAgent>("receiver", "tenant1");
+  orchestrator.RegisterAgent(receiver);
+
+  AgentMessage message;
+  message.from_agent_id = "external";
+  message.to_agent_id = "receiver";
+  message.type = "test";
+  for (const char* payload : {"a", "b", "c"}) {
+    message.payload = payload;
+    EXPECT_TRUE(orchestrator.DeliverMessage(receiver, message));
+  }
+  EXPECT_EQ(orchestrator.dropped_message_count(), 1u);
+
+  orchestrator.Start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  orchestrator.Stop();
+  ASSERT_EQ(receiver->received_messages().size(), 2u);
+  EXPECT_EQ(receiver->received_messages()[0].payload, "b");
+}
+
+TEST(AgentOrchestratorTest, MessagesCarryInternedNames) {
+  EXPECT_EQ(InternedName("agent1"), InternedName(std::string("agent1")));
+  EXPECT_EQ(InternedName(""), InternedName());
+  EXPECT_TRUE(InternedName().empty());
+
+  AgentOrchestrator orchestrator;
+  auto sender = std::make_shared<TestAgent>("sender", "tenant1");
+  auto receiver = std::make_shared<TestAgent>("receiver", "tenant1");
+  orchestrator.RegisterAgent(sender);
+  orchestrator.RegisterAgent(receiver);
+  // Looking up an unknown id does not intern it.
+  InternedName name;
+  EXPECT_EQ(orchestrator.GetAgent("stranger"), nullptr);
+  EXPECT_FALSE(orchestrator.UnregisterAgent("stranger"));
+  EXPECT_FALSE(InternedName::Find("stranger", &name));
+  ASSERT_TRUE(InternedName::Find("receiver", &name));
+  EXPECT_EQ(name, receiver->agent_name());
+
+  auto before = std::chrono::steady_clock::now();
+  EXPECT_TRUE(sender->SendMessage("receiver", "ping", "x"));
+  EXPECT_FALSE(sender->SendMessage("stranger", "ping", "x"));
+  EXPECT_FALSE(InternedName::Find("stranger", &name));
+  orchestrator.Start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  orchestrator.Stop();
+
+  ASSERT_EQ(receiver->received_messages().size(), 1u);
+  const AgentMessage& message = receiver->received_messages()[0];
+  EXPECT_EQ(message.from_agent_id, sender->agent_name());
+  EXPECT_EQ(message.to_agent_id, receiver->agent_name());
+  EXPECT_EQ(message.type, "ping");
+  EXPECT_GE(message.timestamp, before);
+}
+
+TEST(AgentOrchestratorTest, PublishReachesOnlySubscribers) {
+  AgentOrchestrator orchestrator;
+  auto publisher = std::make_shared<TestAgent>("publisher", "tenant1");
+  auto subscriber1 = std::make_shared<TestAgent>("subscriber1", "tenant1");
+  auto subscriber2 = std::make_shared<TestAgent>("subscriber2", "tenant1");
+  auto bystander = std::make_shared<TestAgent>("bystander", "tenant1");
+  for (const auto& agent : {publisher, subscriber1, subscriber2, bystander}) {
+    orchestrator.RegisterAgent(agent);
+  }
+  EXPECT_TRUE(orchestrator.Subscribe("subscriber1", "news"));
+  EXPECT_TRUE(orchestrator.Subscribe("subscriber2", "news"));
+  EXPECT_TRUE(orchestrator.Subscribe("publisher", "news"));
+  EXPECT_FALSE(orchestrator.Subscribe("subscriber1", "news"));
+  EXPECT_FALSE(orchestrator.Subscribe("nobody", "news"));
+
+  AgentPayload payload(std::string(1 << 20, 'x'));
+  EXPECT_EQ(orchestrator.Publish("publisher", "news", "update", payload), 2u);
+  EXPECT_EQ(orchestrator.Publish("publisher", "weather", "update", payload),
+            0u);
+
+  orchestrator.Start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  orchestrator.Stop();
+
+  EXPECT_TRUE(publisher->received_messages().empty());
+  EXPECT_TRUE(bystander->received_messages().empty());
+  for (const auto& agent : {subscriber1, subscriber2}) {
+    ASSERT_EQ(agent->received_messages().size(), 1u);
+    const AgentMessage& message = agent->received_messages()[0];
+    EXPECT_EQ(message.topic, "news");
+    EXPECT_EQ(message.to_agent_id, agent->agent_id());
+    // Every recipient sees the publisher's buffer, not a copy.
+    EXPECT_TRUE(message.payload.SharesBufferWith(payload));
+  }
+
+  EXPECT_TRUE(orchestrator.Unsubscribe("subscriber1", "news"));
+  EXPECT_FALSE(orchestrator.Unsubscribe("subscriber1", "news"));
+  orchestrator.UnregisterAgent("subscriber2");
+  EXPECT_EQ(orchestrator.Publish("publisher", "news", "update", payload), 0u);
+}
+
+TEST(AgentOrchestratorTest, BroadcastSharesPayload) {
+  AgentOrchestrator orchestrator;
+  auto agent1 = std::make_shared<TestAgent>("agent1", "tenant1");
+  auto agent2 = std::make_shared<TestAgent>("agent2", "tenant1");
+  auto agent3 = std::make_shared<TestAgent>("agent3", "tenant1");
+  orchestrator.RegisterAgent(agent1);
+  orchestrator.RegisterAgent(agent2);
+  orchestrator.RegisterAgent(agent3);
+
+  orchestrator.BroadcastMessage("agent1", "broadcast", "shared");
+  orchestrator.Start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  orchestrator.Stop();
+
+  ASSERT_EQ(agent2->received_messages().size(), 1u);
+  ASSERT_EQ(agent3->received_messages().size(), 1u);
+  EXPECT_EQ(agent2->received_messages()[0].payload, "shared");
+  EXPECT_TRUE(agent2->received_messages()[0].payload.SharesBufferWith(
+      agent3->received_messages()[0].payload));
+}
+
+TEST(AgentOrchestratorTest, SerializedPayloadsKeepTheirEncoding) {
+  AgentOrchestrator orchestrator;
+  auto agent1 = std::make_shared<TestAgent>("agent1", "tenant1");
+  auto agent2 = std::make_shared<TestAgent>("agent2", "tenant1");
+  auto agent3 = std::make_shared<TestAgent>("agent3", "tenant1");
+  orchestrator.RegisterAgent(agent1);
+  orchestrator.RegisterAgent(agent2);
+  orchestrator.RegisterAgent(agent3);
+
+  AgentPayload payload =
+      AgentPayload::FromSerializedValue(std::string("\xff\x0f\x54", 3),
+                                        nullptr);
+  EXPECT_NE(payload, AgentPayload(payload.str()));
+  orchestrator.BroadcastMessage("agent1", "value", payload);
+  orchestrator.Start();
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  orchestrator.Stop();
+
+  ASSERT_EQ(agent2->received_messages().size(), 1u);
+  ASSERT_EQ(agent3->received_messages().size(), 1u);
+  const AgentPayload& received = agent2->received_messages()[0].payload;
+  EXPECT_EQ(received.encoding(), AgentPayload::Encoding::kSerializedValue);
+  EXPECT_EQ(received, payload);
+  EXPECT_TRUE(received.SharesBufferWith(payload));
+  EXPECT_TRUE(
+      received.SharesBufferWith(agent3->received_messages()[0].payload));
+}
+
 TEST(AgentFactoryTest, RegisterAndCreate) {
   auto factory = AgentFactory::GetInstance();
   
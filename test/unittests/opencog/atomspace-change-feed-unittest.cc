@@ -0,0 +1,140 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/atomspace-change-feed.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "include/opencog/agent-orchestrator.h"
+#include "include/opencog/agent.h"
+#include "include/opencog/atomspace.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace opencog {
+namespace {
+
+using Kind = AtomChange::Kind;
+
+std::vector<Kind> Kinds(const std::vector<AtomChange>& changes) {
+  std::vector<Kind> kinds;
+  for (const AtomChange& change : changes) kinds.push_back(change.kind);
+  return kinds;
+}
+
+TEST(AtomSpaceChangeFeedTest, CollectsMatchingChangesInOrder) {
+  AtomSpace space("tenant1");
+  AtomSpaceChangeFeed feed(&space, nullptr);
+  auto links = feed.SubscribeToType("agent1", AtomType::INHERITANCE_LINK);
+  AtomPattern named;
+  named.name = "Cat";
+  auto cats = feed.Subscribe("agent2", named, AtomSpaceChangeFeed::kAdded);
+
+  auto cat = space.AddNode(AtomType::CONCEPT_NODE, "Cat");
+  auto animal = space.AddNode(AtomType::CONCEPT_NODE, "Animal");
+  auto link = space.AddLink(AtomType::INHERITANCE_LINK, "", {cat, animal});
+  space.SetTruthValue(link, TruthValue(0.5, 0.5));
+  space.RemoveAtom(link->id());
+
+  auto changes = feed.TakeChanges(links);
+  EXPECT_EQ(Kinds(changes), (std::vector<Kind>{Kind::kAdded,
+                                               Kind::kTruthValueChanged,
+                                               Kind::kRemoved}));
+  for (const AtomChange& change : changes) EXPECT_EQ(change.atom, link);
+  EXPECT_TRUE(feed.TakeChanges(links).empty());
+
+  changes = feed.TakeChanges(cats);
+  ASSERT_EQ(changes.size(), 1u);
+  EXPECT_EQ(changes[0].atom, cat);
+
+  // Clearing supersedes whatever is pending.
+  space.AddNode(AtomType::CONCEPT_NODE, "Cat2");
+  space.Clear();
+  const std::vector<Kind> cleared = {Kind::kCleared};
+  EXPECT_EQ(Kinds(feed.TakeChanges(links)), cleared);
+  EXPECT_EQ(Kinds(feed.TakeChanges(cats)), cleared);
+
+  EXPECT_TRUE(feed.Unsubscribe(cats));
+  EXPECT_FALSE(feed.Unsubscribe(cats));
+  EXPECT_EQ(feed.subscription_count(), 1u);
+}
+
+TEST(AtomSpaceChangeFeedTest, OverflowCollapsesTheBatch) {
+  AtomSpace space("tenant1");
+  AtomSpaceChangeFeed::Options options;
+  options.max_pending = 3;
+  AtomSpaceChangeFeed feed(&space, nullptr, options);
+  auto id = feed.SubscribeToType("agent1", AtomType::CONCEPT_NODE);
+  for (int i = 0; i < 10; ++i) {
+    space.AddNode(AtomType::CONCEPT_NODE, "n" + std::to_string(i));
+  }
+  EXPECT_EQ(Kinds(feed.TakeChanges(id)),
+            (std::vector<Kind>{Kind::kOverflowed}));
+  space.AddNode(AtomType::CONCEPT_NODE, "after");
+  EXPECT_EQ(Kinds(feed.TakeChanges(id)), (std::vector<Kind>{Kind::kAdded}));
+}
+
+// Keeps a running count of the concept nodes from its change batches.
+class CountingAgent : public Agent {
+ public:
+  explicit CountingAgent(AtomSpaceChangeFeed* feed)
+      : Agent("counter", "tenant1"), feed_(feed) {
+    subscription_ =
+        feed_->SubscribeToType(agent_id(), AtomType::CONCEPT_NODE);
+  }
+
+  void Execute() override {
+    executions_++;
+    for (const AtomChange& change : feed_->TakeChanges(subscription_)) {
+      if (change.kind == Kind::kAdded) count_++;
+      if (change.kind == Kind::kRemoved) count_--;
+    }
+  }
+
+  int count() const { return count_; }
+  int executions() const { return executions_; }
+
+ private:
+  AtomSpaceChangeFeed* const feed_;
+  AtomSpaceChangeFeed::SubscriptionId subscription_;
+  std::atomic<int> count_{0};
+  std::atomic<int> executions_{0};
+};
+
+TEST(AtomSpaceChangeFeedTest, SchedulesSubscribedAgents) {
+  AtomSpace space("tenant1");
+  AgentOrchestrator orchestrator;
+  AtomSpaceChangeFeed feed(&space, &orchestrator);
+  auto agent = std::make_shared<CountingAgent>(&feed);
+  orchestrator.RegisterAgent(agent);
+
+  // A batch schedules the agent once.
+  std::vector<std::shared_ptr<Node>> nodes;
+  for (int i = 0; i < 100; ++i) {
+    nodes.push_back(
+        space.AddNode(AtomType::CONCEPT_NODE, "n" + std::to_string(i)));
+  }
+  orchestrator.Start();
+  for (int i = 0; i < 100 && agent->count() != 100; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(agent->count(), 100);
+  EXPECT_EQ(agent->executions(), 1);
+
+  space.RemoveAtom(nodes[0]->id());
+  for (int i = 0; i < 100 && agent->count() != 99; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(agent->count(), 99);
+  orchestrator.Stop();
+}
+
+}  // namespace
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,181 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/atomspace-snapshot.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "include/opencog/atomspace.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace opencog {
+namespace {
+
+void PopulateAtomSpace(AtomSpace* atomspace) {
+  auto cat = atomspace->AddNode(AtomType::CONCEPT_NODE, "Cat");
+  auto animal = atomspace->AddNode(AtomType::CONCEPT_NODE, "Animal");
+  auto is_a = atomspace->AddNode(AtomType::PREDICATE_NODE, "IsA");
+  cat->set_truth_value(TruthValue(0.9, 0.8));
+  // LINK sorts before CONCEPT_NODE, so this exercises forward references.
+  auto generic = atomspace->AddLink(AtomType::LINK, "Generic", {cat, is_a});
+  auto inheritance = atomspace->AddLink(AtomType::INHERITANCE_LINK,
+                                        "CatAnimal", {cat, animal});
+  inheritance->set_truth_value(TruthValue(0.7, 0.6));
+  atomspace->AddLink(AtomType::EXECUTION_LINK, "Nested",
+                     {generic, inheritance});
+}
+
+TEST(AtomSpaceSnapshotTest, QueryInPlace) {
+  AtomSpace atomspace("test-tenant");
+  PopulateAtomSpace(&atomspace);
+
+  auto snapshot =
+      AtomSpaceSnapshot::FromBuffer(AtomSpaceSnapshot::Serialize(atomspace));
+  ASSERT_NE(snapshot, nullptr);
+  EXPECT_EQ(snapshot->atom_count(), 6u);
+
+  AtomSpaceSnapshot::TypeSection concepts =
+      snapshot->GetTypeSection(AtomType::CONCEPT_NODE);
+  EXPECT_EQ(concepts.count, 2u);
+
+  auto cat = snapshot->FindNode(AtomType::CONCEPT_NODE, "Cat");
+  ASSERT_TRUE(cat.has_value());
+  EXPECT_GE(*cat, concepts.first);
+  EXPECT_LT(*cat, concepts.first + concepts.count);
+  AtomSpaceSnapshot::AtomView view = snapshot->GetAtom(*cat);
+  EXPECT_EQ(view.name, "Cat");
+  EXPECT_FALSE(view.is_link);
+  EXPECT_DOUBLE_EQ(view.truth_value.strength, 0.9);
+  EXPECT_FALSE(snapshot->FindNode(AtomType::PREDICATE_NODE, "Cat").has_value());
+
+  AtomSpaceSnapshot::TypeSection links =
+      snapshot->GetTypeSection(AtomType::INHERITANCE_LINK);
+  ASSERT_EQ(links.count, 1u);
+  AtomSpaceSnapshot::AtomView link = snapshot->GetAtom(links.first);
+  ASSERT_EQ(link.outgoing_count, 2u);
+  EXPECT_EQ(link.outgoing[0], *cat);
+  EXPECT_EQ(snapshot->GetAtom(link.outgoing[1]).name, "Animal");
+}
+
+TEST(AtomSpaceSnapshotTest, LoadIntoRestoresAtoms) {
+  AtomSpace original("test-tenant");
+  PopulateAtomSpace(&original);
+  auto snapshot =
+      AtomSpaceSnapshot::FromBuffer(AtomSpaceSnapshot::Serialize(original));
+  ASSERT_NE(snapshot, nullptr);
+
+  AtomSpace restored("restored");
+  snapshot->LoadInto(&restored);
+  EXPECT_EQ(restored.Size(), original.Size());
+
+  auto cat = restored.GetNode(AtomType::CONCEPT_NODE, "Cat");
+  auto animal = restored.GetNode(AtomType::CONCEPT_NODE, "Animal");
+  ASSERT_NE(cat, nullptr);
+  ASSERT_NE(animal, nullptr);
+  EXPECT_DOUBLE_EQ(cat->truth_value().confidence, 0.8);
+  auto link = restored.GetLink(AtomType::INHERITANCE_LINK, {cat, animal});
+  ASSERT_NE(link, nullptr);
+  EXPECT_DOUBLE_EQ(link->truth_value().strength, 0.7);
+  EXPECT_EQ(restored.CountAtomsByType(AtomType::EXECUTION_LINK), 1u);
+}
+
+TEST(AtomSpaceSnapshotTest, SerializeLayerKeepsTheDelta) {
+  auto base = std::make_shared<AtomSpace>("base");
+  PopulateAtomSpace(base.get());
+  AtomSpace layer("tenant", base);
+  auto cat = layer.GetNode(AtomType::CONCEPT_NODE, "Cat");
+  auto animal = layer.GetNode(AtomType::CONCEPT_NODE, "Animal");
+  auto tom = layer.AddNode(AtomType::CONCEPT_NODE, "Tom");
+  layer.AddLink(AtomType::INHERITANCE_LINK, "", {tom, cat});
+  layer.SetTruthValue(animal, TruthValue(0.5, 0.5));
+
+  // Tom, his link, the Cat it points at and the updated Animal.
+  auto snapshot =
+      AtomSpaceSnapshot::FromBuffer(AtomSpaceSnapshot::SerializeLayer(layer));
+  ASSERT_NE(snapshot, nullptr);
+  EXPECT_EQ(snapshot->atom_count(), 4u);
+
+  AtomSpace restored("tenant", base);
+  snapshot->LoadInto(&restored);
+  EXPECT_EQ(restored.Size(), layer.Size());
+  EXPECT_EQ(restored.DeltaSize(), 2u);
+  auto restored_tom = restored.GetNode(AtomType::CONCEPT_NODE, "Tom");
+  ASSERT_NE(restored_tom, nullptr);
+  EXPECT_NE(restored.GetLink(AtomType::INHERITANCE_LINK, {restored_tom, cat}),
+            nullptr);
+  EXPECT_DOUBLE_EQ(restored.GetTruthValue(*animal).strength, 0.5);
+  EXPECT_DOUBLE_EQ(base->GetTruthValue(*animal).strength,
+                   animal->truth_value().strength);
+  EXPECT_NE(animal->truth_value().strength, 0.5);
+}
+
+TEST(AtomSpaceSnapshotTest, PromoteCopiesOnWrite) {
+  AtomSpace original("test-tenant");
+  PopulateAtomSpace(&original);
+  auto snapshot =
+      AtomSpaceSnapshot::FromBuffer(AtomSpaceSnapshot::Serialize(original));
+  ASSERT_NE(snapshot, nullptr);
+
+  AtomSpace live("live");
+  AtomSpaceSnapshot::TypeSection links =
+      snapshot->GetTypeSection(AtomType::INHERITANCE_LINK);
+  auto link = snapshot->Promote(links.first, &live);
+  ASSERT_NE(link, nullptr);
+  // The link and its two outgoing nodes were promoted.
+  EXPECT_EQ(live.Size(), 3u);
+
+  link->set_truth_value(TruthValue(0.1, 0.1));
+  EXPECT_DOUBLE_EQ(snapshot->GetAtom(links.first).truth_value.strength, 0.7);
+  // Promoting again returns the mutated copy.
+  EXPECT_EQ(snapshot->Promote(links.first, &live), link);
+  EXPECT_DOUBLE_EQ(link->truth_value().strength, 0.1);
+}
+
+TEST(AtomSpaceSnapshotTest, OpenMapsFile) {
+  AtomSpace atomspace("test-tenant");
+  PopulateAtomSpace(&atomspace);
+
+  std::string path = testing::TempDir() + "atomspace-snapshot-unittest.bin";
+  ASSERT_TRUE(AtomSpaceSnapshot::WriteToFile(atomspace, path));
+  auto snapshot = AtomSpaceSnapshot::Open(path);
+  ASSERT_NE(snapshot, nullptr);
+  EXPECT_EQ(snapshot->atom_count(), 6u);
+  EXPECT_TRUE(snapshot->FindNode(AtomType::CONCEPT_NODE, "Animal").has_value());
+  snapshot.reset();
+  std::remove(path.c_str());
+}
+
+TEST(AtomSpaceSnapshotTest, RejectsMalformedImages) {
+  AtomSpace atomspace("test-tenant");
+  PopulateAtomSpace(&atomspace);
+  std::vector<uint8_t> image = AtomSpaceSnapshot::Serialize(atomspace);
+
+  EXPECT_EQ(AtomSpaceSnapshot::FromBuffer({}), nullptr);
+
+  std::vector<uint8_t> bad_magic = image;
+  bad_magic[0] ^= 0xFF;
+  EXPECT_EQ(AtomSpaceSnapshot::FromBuffer(bad_magic), nullptr);
+
+  std::vector<uint8_t> truncated(image.begin(),
+                                 image.begin() + image.size() / 2);
+  EXPECT_EQ(AtomSpaceSnapshot::FromBuffer(truncated), nullptr);
+
+  EXPECT_NE(AtomSpaceSnapshot::FromBuffer(image), nullptr);
+}
+
+TEST(AtomSpaceSnapshotTest, EmptyAtomSpace) {
+  AtomSpace atomspace("test-tenant");
+  auto snapshot =
+      AtomSpaceSnapshot::FromBuffer(AtomSpaceSnapshot::Serialize(atomspace));
+  ASSERT_NE(snapshot, nullptr);
+  EXPECT_EQ(snapshot->atom_count(), 0u);
+  EXPECT_FALSE(snapshot->FindNode(AtomType::CONCEPT_NODE, "Cat").has_value());
+}
+
+}  // namespace
+}  // namespace opencog
+}  // namespace v8
@@ -5,6 +5,13 @@
 #include "include/opencog/atomspace.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
 namespace v8 {
 namespace opencog {
 namespace {
@@ -45,6 +52,89 @@ TEST(AtomSpaceTest, CreateLink) {
   EXPECT_EQ(link->outgoing()[1]->name(), "Concept2");
 }
 
+TEST(AtomSpaceTest, NodesAreInternedByTypeAndName) {
+  AtomSpace atomspace("test-tenant");
+
+  auto concept1 = atomspace.AddNode(AtomType::CONCEPT_NODE, "Dog");
+  auto concept2 = atomspace.AddNode(AtomType::CONCEPT_NODE, "Dog");
+  EXPECT_EQ(concept1, concept2);
+  EXPECT_EQ(atomspace.Size(), 1u);
+
+  // Same name, different type is a different node.
+  auto predicate = atomspace.AddNode(AtomType::PREDICATE_NODE, "Dog");
+  EXPECT_NE(predicate, concept1);
+  EXPECT_EQ(atomspace.Size(), 2u);
+  EXPECT_EQ(atomspace.GetNode(AtomType::PREDICATE_NODE, "Dog"), predicate);
+  EXPECT_EQ(atomspace.GetNode(AtomType::VARIABLE_NODE, "Dog"), nullptr);
+
+  // The oldest atom keeps the name binding until it is removed.
+  EXPECT_EQ(atomspace.GetAtomByName("Dog"), concept1);
+  EXPECT_TRUE(atomspace.RemoveAtom(concept1->id()));
+  EXPECT_EQ(atomspace.GetAtomByName("Dog"), predicate);
+}
+
+TEST(AtomSpaceTest, LinksAreInternedByTypeAndOutgoing) {
+  AtomSpace atomspace("test-tenant");
+
+  auto a = atomspace.AddNode(AtomType::CONCEPT_NODE, "A");
+  auto b = atomspace.AddNode(AtomType::CONCEPT_NODE, "B");
+  auto link1 = atomspace.AddLink(AtomType::INHERITANCE_LINK, "AB", {a, b});
+  auto link2 = atomspace.AddLink(AtomType::INHERITANCE_LINK, "AB2", {a, b});
+  EXPECT_EQ(link1, link2);
+  EXPECT_EQ(link1->content_hash(),
+            Link::ContentHash(AtomType::INHERITANCE_LINK, {a, b}));
+
+  auto reversed = atomspace.AddLink(AtomType::INHERITANCE_LINK, "BA", {b, a});
+  auto similar = atomspace.AddLink(AtomType::SIMILARITY_LINK, "AB", {a, b});
+  EXPECT_NE(reversed, link1);
+  EXPECT_NE(similar, link1);
+  EXPECT_EQ(atomspace.Size(), 5u);
+  EXPECT_EQ(atomspace.GetLink(AtomType::INHERITANCE_LINK, {b, a}), reversed);
+
+  EXPECT_TRUE(atomspace.RemoveAtom(link1->id()));
+  EXPECT_EQ(atomspace.GetLink(AtomType::INHERITANCE_LINK, {a, b}), nullptr);
+  auto readded = atomspace.AddLink(AtomType::INHERITANCE_LINK, "AB", {a, b});
+  EXPECT_NE(readded, link1);
+}
+
+TEST(AtomSpaceTest, BatchCommit) {
+  AtomSpace atomspace("test-tenant");
+  auto existing = atomspace.AddNode(AtomType::CONCEPT_NODE, "Mammal");
+
+  AtomBatch batch;
+  AtomBatch::Ref cat = batch.AddNode(AtomType::CONCEPT_NODE, "Cat");
+  AtomBatch::Ref dog = batch.AddNode(AtomType::CONCEPT_NODE, "Dog");
+  AtomBatch::Ref mammal = batch.AddExisting(existing);
+  AtomBatch::Ref cat_mammal =
+      batch.AddLink(AtomType::INHERITANCE_LINK, "CatMammal", {cat, mammal});
+  batch.AddLink(AtomType::INHERITANCE_LINK, "DogMammal", {dog, mammal});
+  // Duplicates inside the batch are interned as well.
+  AtomBatch::Ref cat_again = batch.AddNode(AtomType::CONCEPT_NODE, "Cat");
+  AtomBatch::Ref cat_mammal_again =
+      batch.AddLink(AtomType::INHERITANCE_LINK, "Again", {cat_again, mammal});
+
+  auto atoms = atomspace.Commit(batch);
+  ASSERT_EQ(atoms.size(), batch.size());
+  EXPECT_EQ(atomspace.Size(), 5u);
+  EXPECT_EQ(atoms[mammal], existing);
+  EXPECT_EQ(atoms[cat_again], atoms[cat]);
+  EXPECT_EQ(atoms[cat_mammal_again], atoms[cat_mammal]);
+
+  EXPECT_EQ(atomspace.GetAtomByName("Dog"), atoms[dog]);
+  EXPECT_EQ(atomspace.GetAtom(atoms[cat]->id()), atoms[cat]);
+  EXPECT_EQ(atomspace.Resolve(atoms[cat]->handle()), atoms[cat].get());
+  EXPECT_EQ(atomspace.CountAtomsByType(AtomType::INHERITANCE_LINK), 2u);
+  EXPECT_EQ(atomspace.IncomingSetSize(existing->id()), 2u);
+
+  // Committing the same batch again adds nothing.
+  auto again = atomspace.Commit(batch);
+  EXPECT_EQ(atomspace.Size(), 5u);
+  EXPECT_EQ(again[cat_mammal], atoms[cat_mammal]);
+
+  EXPECT_TRUE(atomspace.RemoveAtom(atoms[cat_mammal]->id()));
+  EXPECT_EQ(atomspace.IncomingSetSize(existing->id()), 1u);
+}
+
 TEST(AtomSpaceTest, TruthValues) {
   AtomSpace atomspace("test-tenant");
   
@@ -72,6 +162,36 @@ TEST(AtomSpaceTest, GetAtomsByType) {
   EXPECT_EQ(predicates.size(), 1u);
 }
 
+TEST(AtomSpaceTest, TypeIndexSurvivesRemoval) {
+  AtomSpace atomspace("test-tenant");
+
+  std::vector<std::shared_ptr<Node>> nodes;
+  for (int i = 0; i < 5; ++i) {
+    nodes.push_back(
+        atomspace.AddNode(AtomType::CONCEPT_NODE, "C" + std::to_string(i)));
+  }
+  atomspace.AddNode(AtomType::PREDICATE_NODE, "P");
+
+  // Remove from the middle and the end of the bucket.
+  EXPECT_TRUE(atomspace.RemoveAtom(nodes[1]->id()));
+  EXPECT_TRUE(atomspace.RemoveAtom(nodes[4]->id()));
+  EXPECT_TRUE(atomspace.RemoveAtom(nodes[0]->id()));
+  EXPECT_EQ(atomspace.CountAtomsByType(AtomType::CONCEPT_NODE), 2u);
+  EXPECT_EQ(atomspace.CountAtomsByType(AtomType::PREDICATE_NODE), 1u);
+
+  std::vector<std::string> names;
+  atomspace.ForEachAtomOfType(AtomType::CONCEPT_NODE,
+                              [&names](const std::shared_ptr<Atom>& atom) {
+                                names.push_back(atom->name());
+                              });
+  std::sort(names.begin(), names.end());
+  EXPECT_EQ(names, (std::vector<std::string>{"C2", "C3"}));
+
+  EXPECT_TRUE(atomspace.RemoveAtom(nodes[3]->id()));
+  EXPECT_TRUE(atomspace.RemoveAtom(nodes[2]->id()));
+  EXPECT_EQ(atomspace.CountAtomsByType(AtomType::CONCEPT_NODE), 0u);
+}
+
 TEST(AtomSpaceTest, RemoveAtom) {
   AtomSpace atomspace("test-tenant");
   
@@ -106,6 +226,500 @@ TEST(AtomSpaceTest, Query) {
   EXPECT_EQ(results[0]->name(), "Concept1");
 }
 
+TEST(AtomSpaceTest, ConcurrentReadersAndWriters) {
+  AtomSpace atomspace("test-tenant");
+  constexpr int kWriters = 4;
+  constexpr int kReaders = 4;
+  constexpr int kAtomsPerWriter = 500;
+
+  std::vector<std::thread> threads;
+  for (int w = 0; w < kWriters; ++w) {
+    threads.emplace_back([&atomspace, w]() {
+      for (int i = 0; i < kAtomsPerWriter; ++i) {
+        atomspace.AddNode(AtomType::CONCEPT_NODE,
+                          "W" + std::to_string(w) + "_" + std::to_string(i));
+      }
+    });
+  }
+  for (int r = 0; r < kReaders; ++r) {
+    threads.emplace_back([&atomspace]() {
+      for (int i = 0; i < kAtomsPerWriter; ++i) {
+        auto atom = atomspace.GetAtomByName("W0_" + std::to_string(i));
+        if (atom) {
+          EXPECT_EQ(atomspace.GetAtom(atom->id()), atom);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(atomspace.Size(),
+            static_cast<size_t>(kWriters * kAtomsPerWriter));
+  EXPECT_EQ(atomspace.GetAtomsByType(AtomType::CONCEPT_NODE).size(),
+            static_cast<size_t>(kWriters * kAtomsPerWriter));
+
+  atomspace.Clear();
+  EXPECT_EQ(atomspace.Size(), 0u);
+  EXPECT_EQ(atomspace.GetAtomByName("W1_1"), nullptr);
+}
+
+TEST(AtomSpaceTest, HandlesResolveToAtoms) {
+  AtomSpace atomspace("test-tenant");
+
+  auto node1 = atomspace.AddNode(AtomType::CONCEPT_NODE, "Concept1");
+  auto node2 = atomspace.AddNode(AtomType::CONCEPT_NODE, "Concept2");
+  ASSERT_TRUE(node1->handle().is_valid());
+  ASSERT_TRUE(node2->handle().is_valid());
+  EXPECT_NE(node1->handle(), node2->handle());
+  EXPECT_EQ(atomspace.Resolve(node1->handle()), node1.get());
+
+  auto link = atomspace.AddLink(AtomType::INHERITANCE_LINK, "Link",
+                                {node1, node2});
+  ASSERT_EQ(link->outgoing_handles().size(), 2u);
+  EXPECT_EQ(link->outgoing_handles()[0], node1->handle());
+  EXPECT_EQ(link->outgoing_handles()[1], node2->handle());
+
+  AtomHandle handle = node1->handle();
+  EXPECT_TRUE(atomspace.RemoveAtom(node1->id()));
+  EXPECT_EQ(atomspace.Resolve(handle), nullptr);
+}
+
+TEST(AtomSpaceTest, ForeignOutgoingAtomsHaveNoHandle) {
+  AtomSpace atomspace1("tenant1");
+  AtomSpace atomspace2("tenant2");
+
+  auto local = atomspace1.AddNode(AtomType::CONCEPT_NODE, "Local");
+  auto foreign = atomspace2.AddNode(AtomType::CONCEPT_NODE, "Foreign");
+  auto link = atomspace1.AddLink(AtomType::SIMILARITY_LINK, "Link",
+                                 {local, foreign});
+  EXPECT_TRUE(link->outgoing_handles()[0].is_valid());
+  EXPECT_FALSE(link->outgoing_handles()[1].is_valid());
+}
+
+TEST(AtomSpaceTest, IdSpacesArePerAtomSpace) {
+  AtomSpace atomspace1("tenant1");
+  AtomSpace atomspace2("tenant2");
+
+  auto node1 = atomspace1.AddNode(AtomType::CONCEPT_NODE, "First");
+  auto node2 = atomspace2.AddNode(AtomType::CONCEPT_NODE, "First");
+  EXPECT_NE(node1->id(), AtomIdAllocator::kInvalidId);
+  EXPECT_EQ(node1->id(), node2->id());
+  EXPECT_EQ(atomspace1.GetAtom(node1->id()), node1);
+  EXPECT_EQ(atomspace2.GetAtom(node2->id()), node2);
+  EXPECT_GT(atomspace1.id_allocator().high_water_mark(), node1->id());
+}
+
+TEST(AtomSpaceTest, ConcurrentIdAllocationIsUnique) {
+  AtomIdAllocator allocator;
+  constexpr int kThreads = 4;
+  constexpr int kIdsPerThread = 3 * AtomIdAllocator::kBlockSize;
+
+  std::vector<std::vector<uint64_t>> ids(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&allocator, &ids, t]() {
+      for (int i = 0; i < kIdsPerThread; ++i) {
+        ids[t].push_back(allocator.Allocate());
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  std::vector<uint64_t> all;
+  for (const auto& thread_ids : ids) {
+    all.insert(all.end(), thread_ids.begin(), thread_ids.end());
+  }
+  std::sort(all.begin(), all.end());
+  EXPECT_EQ(std::adjacent_find(all.begin(), all.end()), all.end());
+  EXPECT_NE(all.front(), AtomIdAllocator::kInvalidId);
+}
+
+TEST(AtomSpaceTest, AtomsOutliveAtomSpace) {
+  std::shared_ptr<Node> node;
+  {
+    AtomSpace atomspace("test-tenant");
+    node = atomspace.AddNode(AtomType::CONCEPT_NODE, "Survivor");
+  }
+  EXPECT_EQ(node->name(), "Survivor");
+}
+
+TEST(AtomSpaceTest, IncomingSet) {
+  AtomSpace atomspace("test-tenant");
+
+  auto cat = atomspace.AddNode(AtomType::CONCEPT_NODE, "Cat");
+  auto animal = atomspace.AddNode(AtomType::CONCEPT_NODE, "Animal");
+  auto pet = atomspace.AddNode(AtomType::CONCEPT_NODE, "Pet");
+  auto link1 = atomspace.AddLink(AtomType::INHERITANCE_LINK, "CatAnimal",
+                                 {cat, animal});
+  auto link2 = atomspace.AddLink(AtomType::INHERITANCE_LINK, "CatPet",
+                                 {cat, pet});
+  atomspace.AddLink(AtomType::SIMILARITY_LINK, "CatCat", {cat, cat});
+
+  EXPECT_EQ(atomspace.IncomingSetSize(cat->id()), 3u);
+  EXPECT_EQ(atomspace.IncomingSetSize(animal->id()), 1u);
+  EXPECT_EQ(atomspace.GetIncomingSet(pet->id())[0], link2);
+
+  EXPECT_TRUE(atomspace.RemoveAtom(link1->id()));
+  EXPECT_EQ(atomspace.IncomingSetSize(cat->id()), 2u);
+  EXPECT_EQ(atomspace.IncomingSetSize(animal->id()), 0u);
+}
+
+TEST(AtomSpaceTest, NamesAreStoredOnce) {
+  const std::string long_name = "an-ontology-term-too-long-to-fit-inline";
+  AtomName::PoolStats before = AtomName::GetPoolStats();
+  {
+    AtomSpace first("test-tenant");
+    AtomSpace second("other-tenant");
+    auto node = first.AddNode(AtomType::CONCEPT_NODE, long_name);
+    auto predicate = first.AddNode(AtomType::PREDICATE_NODE, long_name);
+    auto copy = second.AddNode(AtomType::CONCEPT_NODE, long_name);
+    EXPECT_EQ(&node->name(), &predicate->name());
+    EXPECT_EQ(&node->name(), &copy->name());
+    EXPECT_EQ(AtomName::GetPoolStats().names, before.names + 1);
+
+    AtomSpace::MemoryStats stats = first.GetMemoryStats();
+    EXPECT_EQ(stats.distinct_names, 1u);
+    EXPECT_GT(stats.string_bytes, long_name.size());
+    EXPECT_GT(stats.name_index_bytes, 0u);
+    EXPECT_GT(stats.type_index_bytes, 0u);
+    EXPECT_EQ(stats.total_bytes(),
+              stats.atom_bytes + stats.index_bytes() + stats.string_bytes);
+
+    // The name stays pooled while any atom carries it.
+    EXPECT_TRUE(first.RemoveAtom(node->id()));
+    node.reset();
+    EXPECT_EQ(predicate->name(), long_name);
+    EXPECT_EQ(first.GetAtomsByName(long_name).size(), 1u);
+  }
+  EXPECT_EQ(AtomName::GetPoolStats().names, before.names);
+}
+
+TEST(AtomSpaceTest, RemoveAtomsCascadesThroughIncomingSets) {
+  AtomSpace atomspace("test-tenant");
+  auto cat = atomspace.AddNode(AtomType::CONCEPT_NODE, "Cat");
+  auto animal = atomspace.AddNode(AtomType::CONCEPT_NODE, "Animal");
+  auto pet = atomspace.AddNode(AtomType::CONCEPT_NODE, "Pet");
+  auto cat_animal =
+      atomspace.AddLink(AtomType::INHERITANCE_LINK, "", {cat, animal});
+  auto nested =
+      atomspace.AddLink(AtomType::EVALUATION_LINK, "", {cat_animal, pet});
+  auto animal_pet =
+      atomspace.AddLink(AtomType::INHERITANCE_LINK, "", {animal, pet});
+
+  EXPECT_EQ(atomspace.RemoveAtoms({cat->id()}), 3u);
+  EXPECT_EQ(atomspace.GetAtom(cat->id()), nullptr);
+  EXPECT_EQ(atomspace.GetAtom(cat_animal->id()), nullptr);
+  EXPECT_EQ(atomspace.GetAtom(nested->id()), nullptr);
+  EXPECT_EQ(atomspace.GetAtomByName("Cat"), nullptr);
+  EXPECT_EQ(atomspace.Size(), 3u);
+  EXPECT_EQ(atomspace.GetIncomingSet(animal->id()),
+            std::vector<std::shared_ptr<Link>>{animal_pet});
+  EXPECT_EQ(atomspace.IncomingSetSize(pet->id()), 1u);
+  EXPECT_EQ(atomspace.GetAtomsByType(AtomType::INHERITANCE_LINK).size(), 1u);
+  EXPECT_EQ(atomspace.RemoveAtoms({cat->id()}), 0u);
+
+  // The type index stays consistent for later single removals.
+  EXPECT_TRUE(atomspace.RemoveAtom(animal_pet->id()));
+  EXPECT_TRUE(atomspace.RemoveAtom(pet->id()));
+  EXPECT_EQ(atomspace.GetAtomsByType(AtomType::CONCEPT_NODE),
+            std::vector<std::shared_ptr<Atom>>{animal});
+}
+
+TEST(AtomSpaceTest, RemoveAtomsInParallel) {
+  AtomSpace atomspace("test-tenant");
+  std::vector<uint64_t> forgotten;
+  auto hub = atomspace.AddNode(AtomType::CONCEPT_NODE, "Hub");
+  for (int i = 0; i < 1000; ++i) {
+    auto node =
+        atomspace.AddNode(AtomType::CONCEPT_NODE, "Node" + std::to_string(i));
+    atomspace.AddLink(AtomType::SIMILARITY_LINK, "", {hub, node});
+    if (i % 2 == 0) forgotten.push_back(node->id());
+  }
+  size_t before = atomspace.GetMemoryStats().index_bytes();
+
+  EXPECT_EQ(atomspace.RemoveAtoms(forgotten, 4), 1000u);
+  EXPECT_EQ(atomspace.Size(), 1001u);
+  EXPECT_EQ(atomspace.IncomingSetSize(hub->id()), 500u);
+  EXPECT_EQ(atomspace.GetAtomByName("Node2"), nullptr);
+  EXPECT_NE(atomspace.GetAtomByName("Node3"), nullptr);
+  EXPECT_LT(atomspace.GetMemoryStats().index_bytes(), before);
+
+  EXPECT_EQ(atomspace.RemoveAtoms({hub->id()}, 4), 501u);
+  EXPECT_EQ(atomspace.Size(), 500u);
+  EXPECT_EQ(atomspace.CountAtomsByType(AtomType::SIMILARITY_LINK), 0u);
+}
+
+TEST(AtomSpaceTest, MatchUsesMostSelectiveIndex) {
+  AtomSpace atomspace("test-tenant");
+
+  auto cat = atomspace.AddNode(AtomType::CONCEPT_NODE, "Cat");
+  auto animal = atomspace.AddNode(AtomType::CONCEPT_NODE, "Animal");
+  for (int i = 0; i < 10; ++i) {
+    auto other = atomspace.AddNode(AtomType::CONCEPT_NODE,
+                                   "Other" + std::to_string(i));
+    atomspace.AddLink(AtomType::INHERITANCE_LINK,
+                      "OtherAnimal" + std::to_string(i), {other, animal});
+  }
+  auto cat_animal = atomspace.AddLink(AtomType::INHERITANCE_LINK,
+                                      "CatAnimal", {cat, animal});
+  atomspace.AddLink(AtomType::SIMILARITY_LINK, "CatLikeAnimal", {cat, animal});
+
+  AtomPattern pattern;
+  pattern.type = AtomType::INHERITANCE_LINK;
+  pattern.outgoing = {cat, nullptr};
+
+  QueryPlan plan = atomspace.PlanQuery(pattern);
+  EXPECT_EQ(plan.strategy, QueryPlan::Strategy::kIncomingSet);
+  EXPECT_EQ(plan.anchor, cat);
+  EXPECT_EQ(plan.estimated_candidates, 2u);
+
+  auto results = atomspace.Match(pattern);
+  ASSERT_EQ(results.size(), 1u);
+  EXPECT_EQ(results[0], cat_animal);
+
+  AtomPattern by_type;
+  by_type.type = AtomType::INHERITANCE_LINK;
+  by_type.outgoing = {nullptr, animal};
+  EXPECT_EQ(atomspace.PlanQuery(by_type).strategy,
+            QueryPlan::Strategy::kTypeScan);
+  EXPECT_EQ(atomspace.Match(by_type).size(), 11u);
+
+  AtomPattern by_name;
+  by_name.name = "Cat";
+  EXPECT_EQ(atomspace.PlanQuery(by_name).strategy,
+            QueryPlan::Strategy::kNameLookup);
+  EXPECT_EQ(atomspace.Match(by_name).size(), 1u);
+
+  AtomPattern filtered;
+  filtered.filter = [](const std::shared_ptr<Atom>& atom) {
+    return atom->name() == "Animal";
+  };
+  EXPECT_EQ(atomspace.PlanQuery(filtered).strategy,
+            QueryPlan::Strategy::kFullScan);
+  EXPECT_EQ(atomspace.Match(filtered).size(), 1u);
+}
+
+std::shared_ptr<const AtomSpace> NewOntology() {
+  auto base = std::make_shared<AtomSpace>("shared");
+  auto cat = base->AddNode(AtomType::CONCEPT_NODE, "Cat");
+  auto animal = base->AddNode(AtomType::CONCEPT_NODE, "Animal");
+  base->AddLink(AtomType::INHERITANCE_LINK, "", {cat, animal});
+  return base;
+}
+
+TEST(LayeredAtomSpaceTest, LookupsSeeTheBase) {
+  auto base = NewOntology();
+  AtomSpace layer("tenant", base);
+  EXPECT_EQ(layer.Size(), 3u);
+  EXPECT_EQ(layer.DeltaSize(), 0u);
+
+  auto cat = layer.GetNode(AtomType::CONCEPT_NODE, "Cat");
+  ASSERT_NE(cat, nullptr);
+  EXPECT_TRUE(layer.IsInherited(*cat));
+  EXPECT_EQ(layer.GetAtom(cat->id()), cat);
+  EXPECT_EQ(layer.Resolve(cat->handle()), cat.get());
+  EXPECT_EQ(layer.CountAtomsByType(AtomType::CONCEPT_NODE), 2u);
+  EXPECT_EQ(layer.IncomingSetSize(cat->id()), 1u);
+
+  // Interning resolves against the base as well.
+  EXPECT_EQ(layer.AddNode(AtomType::CONCEPT_NODE, "Cat"), cat);
+  EXPECT_EQ(layer.DeltaSize(), 0u);
+}
+
+TEST(LayeredAtomSpaceTest, AdditionsStayInTheLayer) {
+  auto base = NewOntology();
+  AtomSpace layer("tenant", base);
+  auto cat = layer.GetNode(AtomType::CONCEPT_NODE, "Cat");
+  auto tom = layer.AddNode(AtomType::CONCEPT_NODE, "Tom");
+  auto link = layer.AddLink(AtomType::INHERITANCE_LINK, "", {tom, cat});
+
+  EXPECT_FALSE(layer.IsInherited(*tom));
+  EXPECT_EQ(layer.DeltaSize(), 2u);
+  EXPECT_EQ(layer.Size(), 5u);
+  EXPECT_EQ(base->Size(), 3u);
+  EXPECT_EQ(base->GetAtomByName("Tom"), nullptr);
+
+  // Ids and handles continue past the base's.
+  EXPECT_GE(tom->id(), base->id_allocator().high_water_mark());
+  EXPECT_EQ(layer.Resolve(tom->handle()), tom.get());
+  EXPECT_EQ(base->Resolve(tom->handle()), nullptr);
+
+  // Inherited atoms gain incoming links in the layer only.
+  EXPECT_EQ(layer.IncomingSetSize(cat->id()), 2u);
+  EXPECT_EQ(base->IncomingSetSize(cat->id()), 1u);
+  EXPECT_EQ(link->outgoing_handles()[1], cat->handle());
+}
+
+TEST(LayeredAtomSpaceTest, LayersShadowTheBase) {
+  auto base = NewOntology();
+  AtomSpace layer("tenant", base);
+  AtomSpace other("other", base);
+  auto cat = layer.GetNode(AtomType::CONCEPT_NODE, "Cat");
+  auto animal = layer.GetNode(AtomType::CONCEPT_NODE, "Animal");
+
+  layer.SetTruthValue(cat, TruthValue(0.5, 0.25));
+  EXPECT_DOUBLE_EQ(layer.GetTruthValue(*cat).strength, 0.5);
+  EXPECT_DOUBLE_EQ(other.GetTruthValue(*cat).strength, 1.0);
+  EXPECT_DOUBLE_EQ(cat->truth_value().strength, 1.0);
+
+  EXPECT_TRUE(layer.RemoveAtom(animal->id()));
+  EXPECT_FALSE(layer.RemoveAtom(animal->id()));
+  EXPECT_EQ(layer.GetAtom(animal->id()), nullptr);
+  EXPECT_EQ(layer.GetAtomByName("Animal"), nullptr);
+  EXPECT_EQ(layer.Resolve(animal->handle()), nullptr);
+  EXPECT_EQ(layer.CountAtomsByType(AtomType::CONCEPT_NODE), 1u);
+  EXPECT_EQ(layer.GetAtomsByType(AtomType::CONCEPT_NODE).size(), 1u);
+  EXPECT_EQ(layer.Size(), 2u);
+  EXPECT_EQ(other.GetAtom(animal->id()), animal);
+  EXPECT_EQ(base->Size(), 3u);
+
+  // Re-adding a hidden atom creates a fresh one in the layer.
+  auto again = layer.AddNode(AtomType::CONCEPT_NODE, "Animal");
+  EXPECT_NE(again, animal);
+  EXPECT_FALSE(layer.IsInherited(*again));
+
+  // Clearing drops the delta and the base shows through again.
+  layer.Clear();
+  EXPECT_EQ(layer.Size(), 3u);
+  EXPECT_EQ(layer.GetAtomByName("Animal"), animal);
+  EXPECT_DOUBLE_EQ(layer.GetTruthValue(*cat).strength, 1.0);
+}
+
+TEST(LayeredAtomSpaceTest, RemoveAtomsHidesInheritedLinks) {
+  auto base = NewOntology();
+  AtomSpace layer("tenant", base);
+  auto cat = layer.GetNode(AtomType::CONCEPT_NODE, "Cat");
+  auto pet = layer.AddNode(AtomType::CONCEPT_NODE, "Pet");
+  auto cat_pet = layer.AddLink(AtomType::INHERITANCE_LINK, "", {cat, pet});
+
+  // The inherited link to Animal is hidden, the layer's link removed.
+  EXPECT_EQ(layer.RemoveAtoms({cat->id()}), 3u);
+  EXPECT_EQ(layer.Size(), 2u);
+  EXPECT_EQ(layer.HiddenCount(), 2u);
+  EXPECT_EQ(layer.GetAtom(cat_pet->id()), nullptr);
+  EXPECT_EQ(layer.CountAtomsByType(AtomType::INHERITANCE_LINK), 0u);
+  EXPECT_EQ(layer.IncomingSetSize(pet->id()), 0u);
+  EXPECT_EQ(base->Size(), 3u);
+}
+
+TEST(LayeredAtomSpaceTest, MatchCoversBothLayers) {
+  auto base = NewOntology();
+  AtomSpace layer("tenant", base);
+  auto cat = layer.GetNode(AtomType::CONCEPT_NODE, "Cat");
+  layer.AddLink(AtomType::INHERITANCE_LINK, "",
+                {cat, layer.AddNode(AtomType::CONCEPT_NODE, "Pet")});
+
+  AtomPattern parents;
+  parents.type = AtomType::INHERITANCE_LINK;
+  parents.outgoing = {cat, nullptr};
+  EXPECT_EQ(layer.Match(parents).size(), 2u);
+
+  AtomBatch batch;
+  AtomBatch::Ref animal = batch.AddNode(AtomType::CONCEPT_NODE, "Animal");
+  AtomBatch::Ref dog = batch.AddNode(AtomType::CONCEPT_NODE, "Dog");
+  batch.AddLink(AtomType::INHERITANCE_LINK, "", {dog, animal});
+  auto atoms = layer.Commit(batch);
+  EXPECT_TRUE(layer.IsInherited(*atoms[0]));
+  EXPECT_EQ(layer.DeltaSize(), 4u);
+}
+
+TEST(ReadViewTest, ViewsKeepTheirVersion) {
+  AtomSpace space("tenant1");
+  auto cat = space.AddNode(AtomType::CONCEPT_NODE, "Cat");
+  auto dog = space.AddNode(AtomType::CONCEPT_NODE, "Dog");
+  const Atom* dog_in_view = dog.get();
+
+  std::unique_ptr<AtomSpace::ReadView> view = space.OpenReadView();
+  space.AddNode(AtomType::CONCEPT_NODE, "Fish");
+  EXPECT_TRUE(space.RemoveAtom(dog->id()));
+  AtomHandle dog_handle = dog->handle();
+  dog.reset();
+
+  // The view neither sees the addition nor misses the removed atom.
+  EXPECT_EQ(view->Size(), 2u);
+  std::vector<const Atom*> dogs =
+      view->Query([](const Atom& atom) { return atom.name() == "Dog"; });
+  ASSERT_EQ(dogs.size(), 1u);
+  EXPECT_EQ(dogs[0], dog_in_view);
+  EXPECT_EQ(space.Resolve(dog_handle), nullptr);
+  EXPECT_EQ(space.Size(), 2u);
+
+  std::unique_ptr<AtomSpace::ReadView> later = space.OpenReadView();
+  EXPECT_GT(later->version(), view->version());
+  EXPECT_EQ(later->Size(), 2u);
+  size_t concepts = 0;
+  later->ForEachAtomOfType(AtomType::CONCEPT_NODE,
+                           [&concepts](const Atom&) { ++concepts; });
+  EXPECT_EQ(concepts, 2u);
+
+  // Once both are closed the handle can be reused.
+  view.reset();
+  later.reset();
+  space.Clear();
+  EXPECT_EQ(space.Resolve(cat->handle()), nullptr);
+  EXPECT_EQ(space.OpenReadView()->Size(), 0u);
+}
+
+TEST(ReadViewTest, LayeredViewsHideTheShadowedBase) {
+  auto base = NewOntology();
+  AtomSpace layer("tenant", base);
+  auto animal = layer.GetNode(AtomType::CONCEPT_NODE, "Animal");
+  layer.AddNode(AtomType::CONCEPT_NODE, "Pet");
+
+  std::unique_ptr<AtomSpace::ReadView> view = layer.OpenReadView();
+  EXPECT_TRUE(layer.RemoveAtom(animal->id()));
+  EXPECT_EQ(view->Size(), 4u);
+  EXPECT_EQ(layer.OpenReadView()->Size(), 3u);
+  layer.Clear();
+  EXPECT_EQ(view->Size(), 4u);
+  EXPECT_EQ(layer.OpenReadView()->Size(), 3u);
+}
+
+TEST(ReadViewTest, ScansSeeWholeBatches) {
+  AtomSpace space("tenant1");
+  std::atomic<bool> done{false};
+  std::thread writer([&space, &done] {
+    for (int i = 0; i < 200; ++i) {
+      AtomBatch batch;
+      for (int j = 0; j < 10; ++j) {
+        batch.AddNode(AtomType::CONCEPT_NODE,
+                      "n" + std::to_string(i * 10 + j));
+      }
+      space.Commit(batch);
+      if (i % 3 == 0) {
+        space.RemoveAtom(
+            space.GetNode(AtomType::CONCEPT_NODE, "n" + std::to_string(i))
+                ->id());
+      }
+    }
+    done = true;
+  });
+  while (!done) {
+    std::unique_ptr<AtomSpace::ReadView> view = space.OpenReadView();
+    size_t size = view->Size();
+    for (int i = 0; i < 3; ++i) EXPECT_EQ(view->Size(), size);
+  }
+  writer.join();
+  EXPECT_EQ(space.OpenReadView()->Size(), space.Size());
+}
+
+TEST(AtomSpaceManagerTest, TenantsShareTheBase) {
+  auto manager = AtomSpaceManager::GetInstance();
+  auto base = NewOntology();
+  manager->SetSharedBase(base);
+  auto atomspace1 = manager->GetOrCreateAtomSpace("layered1");
+  auto atomspace2 = manager->GetOrCreateAtomSpace("layered2");
+  manager->SetSharedBase(nullptr);
+
+  EXPECT_EQ(atomspace1->base(), base);
+  EXPECT_EQ(atomspace1->GetAtomByName("Cat"), atomspace2->GetAtomByName("Cat"));
+  atomspace1->AddNode(AtomType::CONCEPT_NODE, "Tom");
+  EXPECT_EQ(atomspace2->GetAtomByName("Tom"), nullptr);
+
+  manager->RemoveAtomSpace("layered1");
+  manager->RemoveAtomSpace("layered2");
+}
+
 TEST(AtomSpaceManagerTest, MultiTenant) {
   auto manager = AtomSpaceManager::GetInstance();
   
@@ -0,0 +1,115 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/attention-bank.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/opencog/atomspace.h"
+#include "include/opencog/work-stealing-executor.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace opencog {
+namespace {
+
+TEST(AttentionBankTest, FocusHoldsTheMostImportantAtoms) {
+  AtomSpace space("tenant1");
+  AttentionBank::Options options;
+  options.max_sti = 100;
+  options.bucket_count = 8;
+  AttentionBank bank(&space, options);
+  std::vector<std::shared_ptr<Node>> nodes;
+  for (int i = 0; i < 100; ++i) {
+    nodes.push_back(
+        space.AddNode(AtomType::CONCEPT_NODE, "n" + std::to_string(i)));
+    bank.Set(nodes.back()->handle(), AttentionValue{float(i), 0});
+  }
+  EXPECT_EQ(bank.size(), 100u);
+
+  // The focus ends inside a bucket of 12 or 13 atoms.
+  std::vector<AtomHandle> focus = bank.GetAttentionalFocus(10);
+  ASSERT_EQ(focus.size(), 10u);
+  std::vector<float> stis;
+  for (AtomHandle handle : focus) stis.push_back(bank.Get(handle).sti);
+  std::sort(stis.begin(), stis.end());
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(stis[i], float(90 + i));
+
+  bank.Stimulate(nodes[0]->handle(), 1000);
+  EXPECT_EQ(bank.Get(nodes[0]->handle()).sti, 100);
+  EXPECT_EQ(bank.GetAttentionalFocus(1)[0], nodes[0]->handle());
+
+  space.RemoveAtom(nodes[0]->id());
+  EXPECT_EQ(bank.size(), 99u);
+  EXPECT_EQ(bank.GetAttentionalFocus(1)[0], nodes[99]->handle());
+  EXPECT_EQ(bank.GetAttentionalFocus(1000).size(), 99u);
+}
+
+TEST(AttentionBankTest, DiffusionSpreadsAlongLinks) {
+  AtomSpace space("tenant1");
+  AttentionBank bank(&space);
+  auto cat = space.AddNode(AtomType::CONCEPT_NODE, "Cat");
+  auto animal = space.AddNode(AtomType::CONCEPT_NODE, "Animal");
+  auto link = space.AddLink(AtomType::INHERITANCE_LINK, "", {cat, animal});
+  bank.Set(cat->handle(), AttentionValue{100, 0});
+
+  // The cat hands 20 to its only neighbour, the link.
+  EXPECT_DOUBLE_EQ(bank.Diffuse(), 20);
+  EXPECT_FLOAT_EQ(bank.Get(cat->handle()).sti, 80);
+  EXPECT_FLOAT_EQ(bank.Get(link->handle()).sti, 20);
+  EXPECT_FLOAT_EQ(bank.Get(animal->handle()).sti, 0);
+
+  // Now the link spreads too, to both ends.
+  bank.Diffuse();
+  EXPECT_FLOAT_EQ(bank.Get(cat->handle()).sti, 64 + 2);
+  EXPECT_FLOAT_EQ(bank.Get(link->handle()).sti, 16 + 16);
+  EXPECT_FLOAT_EQ(bank.Get(animal->handle()).sti, 2);
+
+  bank.UpdateLongTermImportance(0.5f);
+  EXPECT_FLOAT_EQ(bank.Get(cat->handle()).lti, 33);
+  bank.DecayShortTermImportance(0.5f);
+  EXPECT_FLOAT_EQ(bank.Get(cat->handle()).sti, 33);
+  EXPECT_EQ(bank.GetAttentionalFocus(1)[0], cat->handle());
+}
+
+TEST(AttentionBankTest, ParallelDiffusionIsDeterministic) {
+  AtomSpace space("tenant1");
+  std::vector<std::shared_ptr<Atom>> nodes;
+  for (int i = 0; i < 500; ++i) {
+    nodes.push_back(
+        space.AddNode(AtomType::CONCEPT_NODE, "n" + std::to_string(i)));
+  }
+  for (int i = 0; i < 500; ++i) {
+    space.AddLink(AtomType::SIMILARITY_LINK, "",
+                  {nodes[i], nodes[(i * 7 + 1) % 500]});
+  }
+
+  AttentionBank::Options options;
+  options.diffusion_batch_size = 16;
+  AttentionBank sequential(&space, options);
+  AttentionBank parallel(&space, options);
+  for (int i = 0; i < 500; i += 3) {
+    sequential.Set(nodes[i]->handle(), AttentionValue{float(i % 50), 0});
+    parallel.Set(nodes[i]->handle(), AttentionValue{float(i % 50), 0});
+  }
+
+  WorkStealingExecutor executor(4);
+  for (int round = 0; round < 5; ++round) {
+    sequential.Diffuse();
+    parallel.Diffuse(&executor);
+  }
+  EXPECT_EQ(parallel.size(), sequential.size());
+  space.ForEachAtomOfType(
+      AtomType::SIMILARITY_LINK, [&](const std::shared_ptr<Atom>& atom) {
+        EXPECT_EQ(parallel.Get(atom->handle()).sti,
+                  sequential.Get(atom->handle()).sti);
+      });
+}
+
+}  // namespace
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,156 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/compiled-query.h"
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "include/opencog/atomspace.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace opencog {
+namespace {
+
+// Cat -> Mammal -> Animal, Dog -> Mammal, Fish -> Animal, and ten unrelated
+// Thing_i -> Object links.
+class CompiledQueryTest : public ::testing::Test {
+ protected:
+  CompiledQueryTest() : space_("tenant1") {
+    for (const char* name : {"Cat", "Dog", "Fish", "Mammal", "Animal"}) {
+      nodes_[name] = space_.AddNode(AtomType::CONCEPT_NODE, name);
+    }
+    Inherit("Cat", "Mammal");
+    Inherit("Dog", "Mammal");
+    Inherit("Mammal", "Animal");
+    Inherit("Fish", "Animal");
+    auto object = space_.AddNode(AtomType::CONCEPT_NODE, "Object");
+    for (int i = 0; i < 10; ++i) {
+      auto thing = space_.AddNode(AtomType::CONCEPT_NODE,
+                                  "Thing" + std::to_string(i));
+      space_.AddLink(AtomType::INHERITANCE_LINK, "", {thing, object});
+    }
+  }
+
+  void Inherit(const std::string& from, const std::string& to) {
+    space_.AddLink(AtomType::INHERITANCE_LINK, "", {nodes_[from], nodes_[to]});
+  }
+
+  // ?0 inherits from ?1, which inherits from |top|.
+  PatternQuery Chain(const std::string& top) {
+    PatternClause lower;
+    lower.type = AtomType::INHERITANCE_LINK;
+    lower.outgoing = {PatternTerm::Variable(0), PatternTerm::Variable(1)};
+    PatternClause upper;
+    upper.type = AtomType::INHERITANCE_LINK;
+    upper.outgoing = {PatternTerm::Variable(1), PatternTerm::Of(nodes_[top])};
+    PatternQuery query;
+    query.clauses = {lower, upper};
+    return query;
+  }
+
+  std::set<std::pair<std::string, std::string>> Names(
+      const std::vector<QueryBindings>& results) {
+    std::set<std::pair<std::string, std::string>> names;
+    for (const QueryBindings& bindings : results) {
+      names.emplace(bindings[0]->name(), bindings[1]->name());
+    }
+    return names;
+  }
+
+  AtomSpace space_;
+  std::map<std::string, std::shared_ptr<Node>> nodes_;
+};
+
+TEST_F(CompiledQueryTest, JoinsFromTheMostSelectiveClause) {
+  PatternQuery query = Chain("Animal");
+  auto plan = CompiledQuery::Compile(space_, query);
+  ASSERT_EQ(plan->variable_count(), 2u);
+  // The constant anchors the upper clause, whose binding then anchors the
+  // lower one.
+  EXPECT_EQ(plan->ClauseOrder(), (std::vector<size_t>{1, 0}));
+  EXPECT_EQ(plan->AccessAt(0), CompiledQuery::Access::kIncomingSet);
+  EXPECT_EQ(plan->AccessAt(1), CompiledQuery::Access::kIncomingSet);
+
+  auto results = plan->Execute(space_, query);
+  EXPECT_EQ(Names(results),
+            (std::set<std::pair<std::string, std::string>>{
+                {"Cat", "Mammal"}, {"Dog", "Mammal"}}));
+}
+
+TEST_F(CompiledQueryTest, PlansRunEveryQueryOfTheirShape) {
+  PatternQuery animals = Chain("Animal");
+  PatternQuery mammals = Chain("Mammal");
+  EXPECT_EQ(CompiledQuery::ShapeOf(animals), CompiledQuery::ShapeOf(mammals));
+
+  QueryCache cache(&space_);
+  EXPECT_EQ(cache.Execute(animals).size(), 2u);
+  EXPECT_TRUE(cache.Execute(mammals).empty());
+  EXPECT_EQ(cache.compilations(), 1u);
+  EXPECT_EQ(cache.hits(), 1u);
+  EXPECT_EQ(cache.size(), 1u);
+
+  // A different shape gets its own plan.
+  PatternQuery reversed = animals;
+  reversed.clauses[0].outgoing[0] = PatternTerm::Any();
+  EXPECT_NE(CompiledQuery::ShapeOf(reversed), CompiledQuery::ShapeOf(animals));
+  cache.Execute(reversed);
+  EXPECT_EQ(cache.compilations(), 2u);
+  EXPECT_EQ(cache.size(), 2u);
+}
+
+TEST_F(CompiledQueryTest, BindsAndComparesVariables) {
+  // Links whose outgoing atoms are the same: none.
+  PatternClause loop;
+  loop.type = AtomType::INHERITANCE_LINK;
+  loop.outgoing = {PatternTerm::Variable(0), PatternTerm::Variable(0)};
+  PatternQuery loops;
+  loops.clauses = {loop};
+  auto loop_plan = CompiledQuery::Compile(space_, loops);
+  EXPECT_TRUE(loop_plan->Execute(space_, loops).empty());
+  Inherit("Cat", "Cat");
+  EXPECT_EQ(loop_plan->Execute(space_, loops).size(), 1u);
+
+  // The link variable binds the link itself, and names restrict nodes.
+  PatternClause link;
+  link.type = AtomType::INHERITANCE_LINK;
+  link.variable = 1;
+  link.outgoing = {PatternTerm::Variable(0), PatternTerm::Any()};
+  PatternClause fish;
+  fish.name = "Fish";
+  fish.variable = 0;
+  PatternQuery query;
+  query.clauses = {link, fish};
+  auto plan = CompiledQuery::Compile(space_, query);
+  EXPECT_EQ(plan->ClauseOrder(), (std::vector<size_t>{1, 0}));
+  EXPECT_EQ(plan->AccessAt(0), CompiledQuery::Access::kNameLookup);
+  auto results = plan->Execute(space_, query);
+  ASSERT_EQ(results.size(), 1u);
+  EXPECT_EQ(results[0][0], nodes_["Fish"]);
+  ASSERT_TRUE(results[0][1]->IsLink());
+  EXPECT_EQ(static_cast<const Link&>(*results[0][1]).outgoing()[1],
+            nodes_["Animal"]);
+}
+
+TEST_F(CompiledQueryTest, ReplansWhenTheAtomSpaceChangesSize) {
+  QueryCache cache(&space_);
+  PatternQuery query = Chain("Animal");
+  cache.Execute(query);
+  for (int i = 0; i < 100; ++i) {
+    space_.AddNode(AtomType::CONCEPT_NODE, "Filler" + std::to_string(i));
+  }
+  EXPECT_EQ(cache.Execute(query).size(), 2u);
+  EXPECT_EQ(cache.compilations(), 2u);
+  EXPECT_EQ(cache.Execute(query).size(), 2u);
+  EXPECT_EQ(cache.compilations(), 2u);
+}
+
+}  // namespace
+}  // namespace opencog
+}  // namespace v8
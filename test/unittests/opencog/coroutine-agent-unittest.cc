@@ -0,0 +1,226 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/coroutine-agent.h"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "include/opencog/agent-orchestrator.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace opencog {
+namespace {
+
+template <typename Predicate>
+bool WaitFor(Predicate predicate) {
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while (!predicate()) {
+    if (std::chrono::steady_clock::now() > deadline) return false;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return true;
+}
+
+// Echoes |count| messages back to their sender, then finishes.
+class EchoAgent : public CoroutineAgent {
+ public:
+  EchoAgent(const std::string& agent_id, int count)
+      : CoroutineAgent(agent_id, "tenant1"), count_(count) {}
+
+  std::atomic<int> echoed{0};
+
+ protected:
+  AgentTask Run() override {
+    for (int i = 0; i < count_; ++i) {
+      AgentMessage message = co_await ReceiveMessage();
+      SendMessage(message.from_agent_id, "echo", message.payload);
+      echoed.fetch_add(1);
+    }
+  }
+
+ private:
+  int count_;
+};
+
+class CollectorAgent : public Agent {
+ public:
+  explicit CollectorAgent(const std::string& agent_id)
+      : Agent(agent_id, "tenant1") {}
+  void Execute() override {}
+  void OnMessage(const AgentMessage& message) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    payloads_.push_back(message.payload);
+  }
+  std::vector<std::string> payloads() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return payloads_;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::vector<std::string> payloads_;
+};
+
+TEST(CoroutineAgentTest, ReceivesMessagesInOrder) {
+  AgentOrchestrator orchestrator;
+  auto echo = std::make_shared<EchoAgent>("echo", 3);
+  auto collector = std::make_shared<CollectorAgent>("collector");
+  orchestrator.RegisterAgent(echo);
+  orchestrator.RegisterAgent(collector);
+  orchestrator.Start();
+
+  // Sent before Run() starts; buffered until it asks.
+  collector->SendMessage("echo", "ping", "a");
+  orchestrator.ScheduleAgent("echo");
+  collector->SendMessage("echo", "ping", "b");
+  collector->SendMessage("echo", "ping", "c");
+
+  ASSERT_TRUE(WaitFor([&]() { return collector->payloads().size() == 3; }));
+  orchestrator.Stop();
+  EXPECT_TRUE(echo->finished());
+  EXPECT_EQ(collector->payloads(), (std::vector<std::string>{"a", "b", "c"}));
+  EXPECT_EQ(echo->state(), AgentState::IDLE);
+}
+
+class SleepyAgent : public CoroutineAgent {
+ public:
+  SleepyAgent() : CoroutineAgent("sleepy", "tenant1") {}
+
+  std::atomic<bool> woke{false};
+  std::chrono::steady_clock::duration slept{};
+
+ protected:
+  AgentTask Run() override {
+    auto start = Clock::now();
+    co_await SleepFor(std::chrono::milliseconds(20));
+    slept = Clock::now() - start;
+    woke.store(true);
+  }
+};
+
+TEST(CoroutineAgentTest, SleepForReleasesTheThread) {
+  AgentOrchestrator orchestrator;
+  auto sleepy = std::make_shared<SleepyAgent>();
+  auto collector = std::make_shared<CollectorAgent>("collector");
+  orchestrator.RegisterAgent(sleepy);
+  orchestrator.RegisterAgent(collector);
+  orchestrator.Start();
+  orchestrator.ScheduleAgent("sleepy");
+
+  // The single orchestrator thread keeps serving other agents meanwhile.
+  sleepy->SendMessage("collector", "note", "while asleep");
+  ASSERT_TRUE(WaitFor([&]() { return collector->payloads().size() == 1; }));
+  // Runs scheduled by others do not end the sleep early.
+  orchestrator.ScheduleAgent("sleepy");
+
+  ASSERT_TRUE(WaitFor([&]() { return sleepy->woke.load(); }));
+  orchestrator.Stop();
+  EXPECT_GE(sleepy->slept, std::chrono::milliseconds(20));
+}
+
+class TurnTakingAgent : public CoroutineAgent {
+ public:
+  TurnTakingAgent(const std::string& agent_id, std::vector<std::string>* log)
+      : CoroutineAgent(agent_id, "tenant1"), log_(log) {}
+
+  std::atomic<bool> done{false};
+
+ protected:
+  AgentTask Run() override {
+    for (int i = 0; i < 3; ++i) {
+      log_->push_back(agent_id());
+      co_await Yield();
+    }
+    done.store(true);
+  }
+
+ private:
+  std::vector<std::string>* log_;
+};
+
+TEST(CoroutineAgentTest, YieldLetsOtherAgentsRun) {
+  std::vector<std::string> log;
+  AgentOrchestrator orchestrator;
+  auto a = std::make_shared<TurnTakingAgent>("a", &log);
+  auto b = std::make_shared<TurnTakingAgent>("b", &log);
+  orchestrator.RegisterAgent(a);
+  orchestrator.RegisterAgent(b);
+  orchestrator.ScheduleAgent("a");
+  orchestrator.ScheduleAgent("b");
+  orchestrator.Start();
+
+  ASSERT_TRUE(WaitFor([&]() { return a->done.load() && b->done.load(); }));
+  orchestrator.Stop();
+  EXPECT_TRUE(a->finished());
+  EXPECT_EQ(log, (std::vector<std::string>{"a", "b", "a", "b", "a", "b"}));
+}
+
+class FailingAgent : public CoroutineAgent {
+ public:
+  FailingAgent() : CoroutineAgent("failing", "tenant1") {}
+
+  std::atomic<bool> throwing{false};
+
+ protected:
+  AgentTask Run() override {
+    co_await ReceiveMessage();
+    throwing.store(true);
+    throw std::runtime_error("failed");
+  }
+};
+
+TEST(CoroutineAgentTest, ExceptionFailsTheAgent) {
+  AgentOrchestrator orchestrator;
+  auto failing = std::make_shared<FailingAgent>();
+  orchestrator.RegisterAgent(failing);
+  orchestrator.Start();
+  orchestrator.ScheduleAgent("failing");
+
+  AgentMessage message;
+  message.to_agent_id = "failing";
+  orchestrator.RouteMessage(message);
+
+  ASSERT_TRUE(WaitFor([&]() { return failing->throwing.load(); }));
+  orchestrator.Stop();
+  EXPECT_EQ(failing->state(), AgentState::FAILED);
+  EXPECT_TRUE(failing->finished());
+}
+
+TEST(CoroutineAgentTest, ManyWaitingAgentsShareFewThreads) {
+  constexpr int kAgents = 1000;
+  AgentOrchestrator::Options options;
+  options.worker_threads = 2;
+  AgentOrchestrator orchestrator(options);
+  std::vector<std::shared_ptr<EchoAgent>> agents;
+  for (int i = 0; i < kAgents; ++i) {
+    agents.push_back(
+        std::make_shared<EchoAgent>("echo" + std::to_string(i), 1));
+    orchestrator.RegisterAgent(agents.back());
+  }
+  auto collector = std::make_shared<CollectorAgent>("collector");
+  orchestrator.RegisterAgent(collector);
+  orchestrator.Start();
+  for (int i = 0; i < kAgents; ++i) {
+    orchestrator.ScheduleAgent("echo" + std::to_string(i));
+  }
+
+  // Every agent is now suspended waiting for mail, holding no thread.
+  orchestrator.BroadcastMessage("collector", "ping", "x");
+  ASSERT_TRUE(
+      WaitFor([&]() { return collector->payloads().size() == kAgents; }));
+  orchestrator.Stop();
+  for (const auto& agent : agents) EXPECT_TRUE(agent->finished());
+}
+
+}  // namespace
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,178 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/distributed-atomspace.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/opencog/atomspace.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace opencog {
+namespace {
+
+// Three nodes in one process.
+class DistributedAtomSpaceTest : public ::testing::Test {
+ protected:
+  static constexpr size_t kNodes = 3;
+
+  DistributedAtomSpaceTest() : transport_(kNodes) {
+    for (size_t i = 0; i < kNodes; ++i) {
+      nodes_.push_back(std::make_unique<AtomSpaceNode>(&transport_, i));
+      transport_.Attach(i, nodes_.back().get());
+    }
+  }
+
+  std::shared_ptr<DistributedAtomSpace> Open(size_t node) {
+    return nodes_[node]->GetOrCreate("tenant1");
+  }
+
+  LoopbackTransport transport_;
+  std::vector<std::unique_ptr<AtomSpaceNode>> nodes_;
+};
+
+TEST_F(DistributedAtomSpaceTest, AtomsLiveWithTheirOwner) {
+  auto space = Open(0);
+  AtomBatch batch;
+  for (int i = 0; i < 90; ++i) {
+    batch.AddNode(AtomType::CONCEPT_NODE, "n" + std::to_string(i));
+  }
+  std::vector<std::shared_ptr<Atom>> atoms = space->Commit(batch);
+  // This node plus one request to each other node.
+  EXPECT_EQ(transport_.call_count(), kNodes - 1);
+  EXPECT_EQ(space->Size(), 90u);
+
+  size_t owned = 0;
+  for (size_t i = 0; i < kNodes; ++i) {
+    size_t count = Open(i)->partition()->OwnedCount();
+    EXPECT_GT(count, 0u);
+    owned += count;
+  }
+  EXPECT_EQ(owned, 90u);
+
+  auto other = Open(2);
+  for (const auto& atom : atoms) {
+    auto found = other->GetNode(AtomType::CONCEPT_NODE, atom->name());
+    ASSERT_NE(found, nullptr);
+    EXPECT_EQ(found->name(), atom->name());
+    const AtomSpacePartition& partition = *other->partition();
+    EXPECT_EQ(partition.Owns(*found),
+              partition.space()->GetAtom(found->id()) == found);
+  }
+  EXPECT_EQ(other->GetNode(AtomType::CONCEPT_NODE, "missing"), nullptr);
+
+  // Remote atoms are served from the cache the second time.
+  size_t calls = transport_.call_count();
+  for (const auto& atom : atoms) {
+    other->GetNode(AtomType::CONCEPT_NODE, atom->name());
+  }
+  EXPECT_EQ(transport_.call_count(), calls);
+  EXPECT_EQ(other->cached_count(),
+            90u - other->partition()->OwnedCount());
+}
+
+TEST_F(DistributedAtomSpaceTest, LinksAndMatchSpanNodes) {
+  auto space = Open(0);
+  auto cat = space->AddNode(AtomType::CONCEPT_NODE, "Cat");
+  std::vector<std::string> parents = {"Animal", "Pet", "Mammal", "Predator"};
+  for (const std::string& name : parents) {
+    space->AddLink(AtomType::INHERITANCE_LINK, "",
+                   {cat, space->AddNode(AtomType::CONCEPT_NODE, name)});
+  }
+  EXPECT_EQ(space->Size(), 9u);
+
+  auto other = Open(1);
+  AtomPattern pattern;
+  pattern.type = AtomType::INHERITANCE_LINK;
+  pattern.outgoing = {other->GetNode(AtomType::CONCEPT_NODE, "Cat"), nullptr};
+  size_t calls = transport_.call_count();
+  std::vector<std::shared_ptr<Atom>> matches = other->Match(pattern);
+  EXPECT_EQ(matches.size(), parents.size());
+  // One request to every other node.
+  EXPECT_EQ(transport_.call_count(), calls + kNodes - 1);
+
+  pattern.filter = [](const std::shared_ptr<Atom>& atom) {
+    return static_cast<const Link&>(*atom).outgoing()[1]->name() == "Pet";
+  };
+  ASSERT_EQ(other->Match(pattern).size(), 1u);
+
+  auto pet = other->GetNode(AtomType::CONCEPT_NODE, "Pet");
+  auto link = other->GetLink(AtomType::INHERITANCE_LINK, {cat, pet});
+  ASSERT_NE(link, nullptr);
+  EXPECT_TRUE(other->RemoveAtom(link));
+  EXPECT_EQ(other->GetLink(AtomType::INHERITANCE_LINK, {cat, pet}), nullptr);
+  EXPECT_EQ(space->Match(pattern).size(), 0u);
+  EXPECT_EQ(space->Size(), 8u);
+}
+
+TEST_F(DistributedAtomSpaceTest, OwnersInvalidateCachedCopies) {
+  auto writer = Open(0);
+  auto reader = Open(1);
+  // Enough nodes that some are owned by the third node.
+  std::vector<std::shared_ptr<Node>> nodes;
+  for (int i = 0; i < 30; ++i) {
+    nodes.push_back(
+        writer->AddNode(AtomType::CONCEPT_NODE, "n" + std::to_string(i)));
+  }
+  std::shared_ptr<Node> remote;
+  for (const auto& node : nodes) {
+    if (reader->partition()->partitioner().OwnerOf(*node) == 2) remote = node;
+  }
+  ASSERT_NE(remote, nullptr);
+
+  EXPECT_DOUBLE_EQ(reader->GetTruthValue(remote).strength, 1.0);
+  size_t calls = transport_.call_count();
+  EXPECT_DOUBLE_EQ(reader->GetTruthValue(remote).strength, 1.0);
+  EXPECT_EQ(transport_.call_count(), calls);
+
+  writer->SetTruthValue(remote, TruthValue(0.25, 0.5));
+  EXPECT_DOUBLE_EQ(reader->GetTruthValue(remote).strength, 0.25);
+
+  // Changes made on the owner directly are published on flush.
+  std::shared_ptr<AtomSpacePartition> owner = Open(2)->partition();
+  owner->space()->SetTruthValue(owner->Find(remote), TruthValue(0.75, 0.5));
+  owner->FlushInvalidations();
+  EXPECT_DOUBLE_EQ(reader->GetTruthValue(remote).strength, 0.75);
+
+  EXPECT_TRUE(writer->RemoveAtom(remote));
+  EXPECT_EQ(reader->GetNode(AtomType::CONCEPT_NODE, remote->name()), nullptr);
+
+  owner->space()->Clear();
+  owner->FlushInvalidations();
+  for (const auto& node : nodes) {
+    if (owner->Owns(*node)) {
+      EXPECT_EQ(reader->GetNode(AtomType::CONCEPT_NODE, node->name()),
+                nullptr);
+    }
+  }
+}
+
+TEST(AtomSpaceManagerTest, DistributedTenants) {
+  auto manager = AtomSpaceManager::GetInstance();
+  EXPECT_EQ(manager->GetOrCreateDistributedAtomSpace("dtenant"), nullptr);
+
+  LoopbackTransport transport(1);
+  manager->SetTransport(&transport, 0);
+  transport.Attach(0, manager->node().get());
+  auto space = manager->GetOrCreateDistributedAtomSpace("dtenant");
+  ASSERT_NE(space, nullptr);
+  auto cat = space->AddNode(AtomType::CONCEPT_NODE, "Cat");
+
+  // A single node owns everything, in the tenant's regular AtomSpace.
+  auto local = manager->GetAtomSpace("dtenant");
+  ASSERT_NE(local, nullptr);
+  EXPECT_EQ(local->GetNode(AtomType::CONCEPT_NODE, "Cat"), cat);
+  EXPECT_EQ(space->Size(), 1u);
+
+  EXPECT_TRUE(manager->RemoveAtomSpace("dtenant"));
+  manager->SetTransport(nullptr, 0);
+  EXPECT_EQ(manager->node(), nullptr);
+}
+
+}  // namespace
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,151 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/embedding-index.h"
+
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "include/opencog/atomspace.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace opencog {
+namespace {
+
+// Odd, so that the kernels run both their vector body and scalar tail.
+constexpr size_t kDimension = 19;
+
+std::vector<float> RandomVector(std::mt19937* rng) {
+  std::normal_distribution<float> normal;
+  std::vector<float> vector(kDimension);
+  for (float& x : vector) x = normal(*rng);
+  return vector;
+}
+
+std::vector<std::shared_ptr<Node>> AddNodes(AtomSpace* space, int count) {
+  std::vector<std::shared_ptr<Node>> nodes;
+  for (int i = 0; i < count; ++i) {
+    nodes.push_back(
+        space->AddNode(AtomType::CONCEPT_NODE, "n" + std::to_string(i)));
+  }
+  return nodes;
+}
+
+TEST(EmbeddingIndexTest, FindsNearestAtoms) {
+  AtomSpace space("tenant1");
+  EmbeddingIndex::Options options;
+  options.metric = EmbeddingIndex::Metric::kL2;
+  EmbeddingIndex index(&space, 2, options);
+  auto nodes = AddNodes(&space, 4);
+  EXPECT_TRUE(index.Set(nodes[0]->handle(), {0, 0}));
+  EXPECT_TRUE(index.Set(nodes[1]->handle(), {1, 0}));
+  EXPECT_TRUE(index.Set(nodes[2]->handle(), {5, 5}));
+  EXPECT_FALSE(index.Set(nodes[3]->handle(), {1, 2, 3}));
+  EXPECT_FALSE(index.Set(AtomHandle(1000), {1, 1}));
+  EXPECT_EQ(index.size(), 3u);
+
+  const float query[] = {0.9f, 0.1f};
+  auto result = index.Search(query, 2);
+  ASSERT_EQ(result.size(), 2u);
+  EXPECT_EQ(result[0].handle, nodes[1]->handle());
+  EXPECT_NEAR(result[0].distance, 0.02, 1e-6);
+  EXPECT_EQ(result[1].handle, nodes[0]->handle());
+
+  // Replacing an embedding moves the atom.
+  EXPECT_TRUE(index.Set(nodes[2]->handle(), {1, 0.1f}));
+  EXPECT_EQ(index.size(), 3u);
+  EXPECT_EQ(index.Search(query, 1)[0].handle, nodes[2]->handle());
+  EXPECT_EQ(index.Get(nodes[2]->handle()), (std::vector<float>{1, 0.1f}));
+}
+
+TEST(EmbeddingIndexTest, FollowsRemovalAndClear) {
+  AtomSpace space("tenant1");
+  EmbeddingIndex index(&space, 2);
+  auto nodes = AddNodes(&space, 3);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(index.Set(nodes[i]->handle(), {1, float(i)}));
+  }
+  // Cosine embeddings are stored normalized, and zero ones are rejected.
+  EXPECT_NEAR(index.Get(nodes[1]->handle())[0], 0.70710678, 1e-6);
+  EXPECT_FALSE(index.Set(nodes[0]->handle(), {0, 0}));
+
+  const float query[] = {1, 1};
+  EXPECT_EQ(index.Search(query, 1)[0].handle, nodes[1]->handle());
+  space.RemoveAtom(nodes[1]->id());
+  EXPECT_FALSE(index.Contains(nodes[1]->handle()));
+  EXPECT_EQ(index.size(), 2u);
+  for (const auto& neighbor : index.Search(query, 3)) {
+    EXPECT_NE(neighbor.handle, nodes[1]->handle());
+  }
+
+  EXPECT_TRUE(index.Remove(nodes[2]->handle()));
+  EXPECT_FALSE(index.Remove(nodes[2]->handle()));
+  EXPECT_EQ(index.Search(query, 3).size(), 1u);
+
+  space.Clear();
+  EXPECT_EQ(index.size(), 0u);
+  EXPECT_TRUE(index.Search(query, 3).empty());
+  auto node = space.AddNode(AtomType::CONCEPT_NODE, "again");
+  EXPECT_TRUE(index.Set(node->handle(), {1, 1}));
+  EXPECT_EQ(index.Search(query, 3).size(), 1u);
+}
+
+TEST(EmbeddingIndexTest, RecallMatchesExactSearch) {
+  AtomSpace space("tenant1");
+  EmbeddingIndex index(&space, kDimension);
+  std::mt19937 rng(7);
+  auto nodes = AddNodes(&space, 2000);
+  for (const auto& node : nodes) {
+    ASSERT_TRUE(index.Set(node->handle(), RandomVector(&rng)));
+  }
+  // Remove a quarter, which leaves marked nodes in the graph.
+  std::unordered_set<uint32_t> removed;
+  for (size_t i = 0; i < nodes.size(); i += 4) {
+    removed.insert(nodes[i]->handle().value());
+    space.RemoveAtom(nodes[i]->id());
+  }
+  ASSERT_EQ(index.size(), 1500u);
+
+  constexpr size_t kQueries = 50;
+  constexpr size_t kK = 10;
+  std::vector<float> queries;
+  for (size_t i = 0; i < kQueries; ++i) {
+    std::vector<float> query = RandomVector(&rng);
+    queries.insert(queries.end(), query.begin(), query.end());
+  }
+  auto batch = index.SearchBatch(queries.data(), kQueries, kK, 100);
+  ASSERT_EQ(batch.size(), kQueries);
+
+  size_t hits = 0;
+  for (size_t i = 0; i < kQueries; ++i) {
+    const float* query = queries.data() + i * kDimension;
+    auto exact = index.SearchExact(query, kK);
+    ASSERT_EQ(exact.size(), kK);
+    ASSERT_EQ(batch[i].size(), kK);
+    std::unordered_set<uint32_t> expected;
+    for (const auto& neighbor : exact) expected.insert(neighbor.handle.value());
+    for (const auto& neighbor : batch[i]) {
+      EXPECT_EQ(removed.count(neighbor.handle.value()), 0u);
+      hits += expected.count(neighbor.handle.value());
+    }
+    // A batch answers like the individual query.
+    auto single = index.Search(query, kK, 100);
+    ASSERT_EQ(single.size(), kK);
+    EXPECT_EQ(single[0].handle, batch[i][0].handle);
+  }
+  EXPECT_GE(hits, kQueries * kK * 9 / 10);
+
+  // Compacting drops the marked nodes and keeps every live embedding.
+  index.Compact();
+  EXPECT_EQ(index.size(), 1500u);
+  EXPECT_EQ(index.Search(queries.data(), kK, 100).size(), kK);
+}
+
+}  // namespace
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,137 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/forward-chainer.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/opencog/atomspace.h"
+#include "include/opencog/work-stealing-executor.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace opencog {
+namespace {
+
+// PLN-style deduction: (A -> B) and (B -> C) give (A -> C) with the product
+// of the strengths. Looks both ways so that a new link finds older partners.
+InferenceRule DeductionRule() {
+  InferenceRule rule;
+  rule.name = "deduction";
+  rule.premise.type = AtomType::INHERITANCE_LINK;
+  rule.rewrite = [](const std::shared_ptr<Atom>& premise,
+                    const AtomSpace& space, RuleConclusions* conclusions) {
+    const auto& ab = static_cast<const Link&>(*premise).outgoing();
+    auto conclude = [&](const std::shared_ptr<Atom>& from,
+                        const std::shared_ptr<Atom>& to,
+                        const std::shared_ptr<Atom>& other) {
+      if (from == to) return;
+      AtomBatch& batch = conclusions->batch;
+      AtomBatch::Ref link = batch.AddLink(
+          AtomType::INHERITANCE_LINK, "",
+          {batch.AddExisting(from), batch.AddExisting(to)});
+      double strength = space.GetTruthValue(*premise).strength *
+                        space.GetTruthValue(*other).strength;
+      conclusions->truth_values.emplace_back(link,
+                                             TruthValue(strength, 0.9));
+    };
+    for (const auto& bc : space.GetIncomingSet(ab[1]->id())) {
+      const auto& targets = bc->outgoing();
+      if (bc->type() == AtomType::INHERITANCE_LINK && targets[0] == ab[1]) {
+        conclude(ab[0], targets[1], bc);
+      }
+    }
+    for (const auto& za : space.GetIncomingSet(ab[0]->id())) {
+      const auto& targets = za->outgoing();
+      if (za->type() == AtomType::INHERITANCE_LINK && targets[1] == ab[0]) {
+        conclude(targets[0], ab[1], za);
+      }
+    }
+  };
+  return rule;
+}
+
+// A chain of |length| concepts, each inheriting from the next.
+std::vector<std::shared_ptr<Node>> AddChain(AtomSpace* space, int length) {
+  std::vector<std::shared_ptr<Node>> nodes;
+  for (int i = 0; i < length; ++i) {
+    nodes.push_back(
+        space->AddNode(AtomType::CONCEPT_NODE, "c" + std::to_string(i)));
+    if (i > 0) {
+      auto link = space->AddLink(AtomType::INHERITANCE_LINK, "",
+                                 {nodes[i - 1], nodes[i]});
+      space->SetTruthValue(link, TruthValue(0.5, 0.9));
+    }
+  }
+  return nodes;
+}
+
+TEST(ForwardChainerTest, DerivesTheTransitiveClosure) {
+  AtomSpace space("tenant1");
+  auto nodes = AddChain(&space, 4);
+  ForwardChainer chainer(&space, nullptr);
+  chainer.AddRule(DeductionRule());
+
+  ForwardChainer::Result result = chainer.Run();
+  EXPECT_TRUE(result.saturated);
+  // c0->c2, c1->c3, then c0->c3.
+  EXPECT_EQ(result.atoms_added, 3u);
+  EXPECT_EQ(space.CountAtomsByType(AtomType::INHERITANCE_LINK), 6u);
+  auto c0_c3 =
+      space.GetLink(AtomType::INHERITANCE_LINK, {nodes[0], nodes[3]});
+  ASSERT_NE(c0_c3, nullptr);
+  EXPECT_DOUBLE_EQ(space.GetTruthValue(*c0_c3).strength, 0.125);
+
+  // Saturated: another run finds nothing new.
+  result = chainer.Run();
+  EXPECT_EQ(result.steps, 1u);
+  EXPECT_EQ(result.atoms_added, 0u);
+}
+
+TEST(ForwardChainerTest, ParallelRunMatchesSequentialRun) {
+  constexpr int kLength = 24;
+  ForwardChainer::Options options;
+  options.batch_size = 8;
+  options.max_steps = 64;
+
+  AtomSpace sequential_space("sequential");
+  AddChain(&sequential_space, kLength);
+  ForwardChainer sequential(&sequential_space, nullptr, options);
+  sequential.AddRule(DeductionRule());
+  ForwardChainer::Result expected = sequential.Run();
+
+  AtomSpace parallel_space("parallel");
+  AddChain(&parallel_space, kLength);
+  WorkStealingExecutor executor(4);
+  ForwardChainer parallel(&parallel_space, &executor, options);
+  parallel.AddRule(DeductionRule());
+  ForwardChainer::Result actual = parallel.Run();
+
+  EXPECT_TRUE(actual.saturated);
+  EXPECT_EQ(actual.steps, expected.steps);
+  EXPECT_EQ(actual.atoms_added, expected.atoms_added);
+  EXPECT_EQ(parallel_space.CountAtomsByType(AtomType::INHERITANCE_LINK),
+            static_cast<size_t>(kLength * (kLength - 1) / 2));
+}
+
+TEST(ForwardChainerTest, StopsAfterMaxSteps) {
+  AtomSpace space("tenant1");
+  AddChain(&space, 10);
+  ForwardChainer::Options options;
+  options.max_steps = 1;
+  ForwardChainer chainer(&space, nullptr, options);
+  chainer.AddRule(DeductionRule());
+
+  ForwardChainer::Result result = chainer.Run();
+  EXPECT_FALSE(result.saturated);
+  EXPECT_EQ(result.steps, 1u);
+  // Every two-step shortcut of the chain.
+  EXPECT_EQ(result.atoms_added, 8u);
+}
+
+}  // namespace
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,102 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/tenant-registry.h"
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace opencog {
+namespace {
+
+struct Tenant {
+  explicit Tenant(int value) : value(value) {}
+  int value;
+};
+
+TEST(TenantRegistryTest, InsertFindRemove) {
+  TenantRegistry<Tenant> registry;
+  EXPECT_EQ(registry.Find("a"), nullptr);
+
+  auto a = std::make_shared<Tenant>(1);
+  EXPECT_EQ(registry.Insert("a", a), a);
+  // The first registration wins.
+  EXPECT_EQ(registry.Insert("a", std::make_shared<Tenant>(2)), a);
+  EXPECT_EQ(registry.Find("a"), a);
+  EXPECT_EQ(registry.size(), 1u);
+
+  int created = 0;
+  auto factory = [&created]() {
+    ++created;
+    return std::make_shared<Tenant>(3);
+  };
+  EXPECT_EQ(registry.FindOrInsert("b", factory)->value, 3);
+  EXPECT_EQ(registry.FindOrInsert("b", factory)->value, 3);
+  EXPECT_EQ(created, 1);
+
+  std::vector<std::string> ids;
+  registry.ForEach(
+      [&ids](const std::string& id, const std::shared_ptr<Tenant>&) {
+        ids.push_back(id);
+      });
+  EXPECT_EQ(ids.size(), 2u);
+
+  EXPECT_EQ(registry.Remove("a"), a);
+  EXPECT_EQ(registry.Remove("a"), nullptr);
+  EXPECT_EQ(registry.Find("a"), nullptr);
+  registry.Clear();
+  EXPECT_EQ(registry.size(), 0u);
+}
+
+TEST(TenantRegistryTest, RemovedTenantsAreReleased) {
+  TenantRegistry<Tenant> registry;
+  std::weak_ptr<Tenant> weak;
+  {
+    auto tenant = std::make_shared<Tenant>(1);
+    weak = tenant;
+    registry.Insert("a", tenant);
+  }
+  EXPECT_FALSE(weak.expired());
+  registry.Remove("a");
+  EXPECT_TRUE(weak.expired());
+}
+
+TEST(TenantRegistryTest, ReadersSeeConsistentMapsDuringChurn) {
+  constexpr int kReaders = 4;
+  TenantRegistry<Tenant> registry;
+  auto stable = std::make_shared<Tenant>(42);
+  registry.Insert("stable", stable);
+
+  std::atomic<bool> stop{false};
+  std::atomic<int> failures{0};
+  std::vector<std::thread> readers;
+  for (int i = 0; i < kReaders; ++i) {
+    readers.emplace_back([&]() {
+      while (!stop.load()) {
+        auto tenant = registry.Find("stable");
+        if (!tenant || tenant->value != 42) failures.fetch_add(1);
+        if (auto churn = registry.Find("churn")) {
+          if (churn->value < 0) failures.fetch_add(1);
+        }
+      }
+    });
+  }
+  for (int i = 0; i < 500; ++i) {
+    registry.Insert("churn", std::make_shared<Tenant>(i));
+    registry.Remove("churn");
+  }
+  stop.store(true);
+  for (auto& reader : readers) reader.join();
+  EXPECT_EQ(failures.load(), 0);
+}
+
+}  // namespace
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,118 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/truth-value-column.h"
+
+#include <memory_resource>
+#include <string>
+
+#include "include/opencog/atomspace.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace opencog {
+namespace {
+
+template <typename Column>
+class TruthValueColumnTest : public ::testing::Test {};
+
+using ColumnTypes =
+    ::testing::Types<TruthValueColumn, CompactTruthValueColumn>;
+TYPED_TEST_SUITE(TruthValueColumnTest, ColumnTypes);
+
+// Odd sizes exercise both the vector body and the scalar tail of each kernel.
+constexpr uint32_t kSlots = 37;
+
+TYPED_TEST(TruthValueColumnTest, EmptySlotsAreNeutral) {
+  TypeParam column(kSlots);
+  column.Set(AtomHandle(3), TruthValue(0.8, 0.5));
+
+  TypeParam evidence(kSlots);
+  column.Revise(evidence);
+  column.Decay(0.5);
+
+  EXPECT_TRUE(column.Contains(AtomHandle(3)));
+  EXPECT_FALSE(column.Contains(AtomHandle(4)));
+  EXPECT_FALSE(column.Contains(AtomHandle(kSlots + 10)));
+  EXPECT_NEAR(column.Get(AtomHandle(3)).strength, 0.8, 1e-6);
+  EXPECT_NEAR(column.Get(AtomHandle(3)).confidence, 0.25, 1e-6);
+  EXPECT_DOUBLE_EQ(column.Get(AtomHandle(4)).confidence, 0.0);
+
+  auto all = column.Filter(0.0, 0.0);
+  ASSERT_EQ(all.size(), 1u);
+  EXPECT_EQ(all[0], AtomHandle(3));
+}
+
+TYPED_TEST(TruthValueColumnTest, ReviseMatchesScalarRule) {
+  TypeParam column(kSlots);
+  TypeParam evidence(kSlots);
+  for (uint32_t i = 0; i < kSlots; ++i) {
+    column.Set(AtomHandle(i), TruthValue(0.2 + 0.01 * i, 0.5));
+    evidence.Set(AtomHandle(i), TruthValue(0.9, 0.1 + 0.02 * i));
+  }
+  column.Revise(evidence);
+
+  for (uint32_t i = 0; i < kSlots; ++i) {
+    double s1 = 0.2 + 0.01 * i, c1 = 0.5;
+    double s2 = 0.9, c2 = 0.1 + 0.02 * i;
+    TruthValue tv = column.Get(AtomHandle(i));
+    EXPECT_NEAR(tv.strength, (s1 * c1 + s2 * c2) / (c1 + c2), 1e-5) << i;
+    EXPECT_NEAR(tv.confidence, c1 + c2 - c1 * c2, 1e-5) << i;
+  }
+}
+
+TYPED_TEST(TruthValueColumnTest, FilterReturnsHandlesInOrder) {
+  TypeParam column(kSlots);
+  for (uint32_t i = 0; i < kSlots; ++i) {
+    column.Set(AtomHandle(i), TruthValue(i % 3 == 0 ? 0.9 : 0.1, 0.8));
+  }
+  auto strong = column.Filter(0.5, 0.5);
+  ASSERT_EQ(strong.size(), (kSlots + 2) / 3);
+  for (size_t i = 0; i < strong.size(); ++i) {
+    EXPECT_EQ(strong[i], AtomHandle(static_cast<uint32_t>(3 * i)));
+  }
+  EXPECT_TRUE(column.Filter(0.5, 0.9).empty());
+}
+
+TYPED_TEST(TruthValueColumnTest, LoadAndStoreRoundTrip) {
+  AtomSpace atomspace("test-tenant");
+  for (int i = 0; i < 20; ++i) {
+    auto node =
+        atomspace.AddNode(AtomType::CONCEPT_NODE, "C" + std::to_string(i));
+    node->set_truth_value(TruthValue(0.5, i % 2 == 0 ? 0.8 : 0.2));
+  }
+
+  TypeParam column;
+  column.Load(atomspace);
+  // Nothing changed, so nothing is written back.
+  EXPECT_EQ(column.Store(&atomspace), 0u);
+
+  column.Decay(0.5);
+  EXPECT_EQ(column.Store(&atomspace), 20u);
+  auto node = atomspace.GetNode(AtomType::CONCEPT_NODE, "C0");
+  EXPECT_NEAR(node->truth_value().confidence, 0.4, 1e-6);
+
+  auto confident = column.Filter(0.0, 0.3);
+  EXPECT_EQ(confident.size(), 10u);
+  for (AtomHandle handle : confident) {
+    EXPECT_GE(atomspace.Resolve(handle)->truth_value().confidence, 0.3);
+  }
+}
+
+TYPED_TEST(TruthValueColumnTest, AllocatesFromGivenResource) {
+  std::pmr::monotonic_buffer_resource buffer;
+  TypeParam column(&buffer);
+  EXPECT_EQ(column.memory_resource(), &buffer);
+  column.Set(AtomHandle(kSlots - 1), TruthValue(0.7, 0.5));
+
+  // Writes through the raw columns are what the kernels see.
+  column.mutable_confidences()[kSlots - 1] = 1.0;
+  column.Decay(0.5);
+  EXPECT_NEAR(column.Get(AtomHandle(kSlots - 1)).confidence, 0.5, 1e-6);
+  EXPECT_EQ(column.strengths(), column.mutable_strengths());
+}
+
+}  // namespace
+}  // namespace opencog
+}  // namespace v8
@@ -0,0 +1,81 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "include/opencog/work-stealing-executor.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace opencog {
+namespace {
+
+TEST(WorkStealingExecutorTest, RunsEveryTask) {
+  std::atomic<int> count{0};
+  {
+    WorkStealingExecutor executor(4);
+    for (int i = 0; i < 1000; ++i) {
+      executor.Submit([&count]() { count.fetch_add(1); });
+    }
+  }
+  EXPECT_EQ(count.load(), 1000);
+}
+
+TEST(WorkStealingExecutorTest, ShutdownDrainsNestedSubmissions) {
+  std::atomic<int> count{0};
+  WorkStealingExecutor executor(2);
+  for (int i = 0; i < 10; ++i) {
+    executor.Submit([&executor, &count]() {
+      for (int j = 0; j < 10; ++j) {
+        executor.Submit([&count]() { count.fetch_add(1); });
+      }
+    });
+  }
+  executor.Shutdown();
+  EXPECT_EQ(count.load(), 100);
+}
+
+TEST(WorkStealingExecutorTest, IdleWorkersStealFromBusyOnes) {
+  std::atomic<int> count{0};
+  WorkStealingExecutor executor(4);
+  // A single producer task fans out onto its own deque; the other workers
+  // only get to run these by stealing.
+  executor.Submit([&executor, &count]() {
+    for (int i = 0; i < 64; ++i) {
+      executor.Submit([&count]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        count.fetch_add(1);
+      });
+    }
+  });
+  executor.Shutdown();
+  EXPECT_EQ(count.load(), 64);
+  EXPECT_GT(executor.steal_count(), 0u);
+}
+
+TEST(WorkStealingExecutorTest, ParallelForVisitsEveryIndexOnce) {
+  WorkStealingExecutor executor(4);
+  std::vector<std::atomic<int>> hits(1000);
+  executor.ParallelFor(hits.size(),
+                       [&hits](size_t index) { hits[index].fetch_add(1); });
+  for (const auto& hit : hits) EXPECT_EQ(hit.load(), 1);
+
+  // Nested in tasks occupying every worker, the callers do the work.
+  std::atomic<int> count{0};
+  for (int i = 0; i < 4; ++i) {
+    executor.Submit([&executor, &count]() {
+      executor.ParallelFor(100, [&count](size_t) { count.fetch_add(1); });
+    });
+  }
+  executor.Shutdown();
+  EXPECT_EQ(count.load(), 400);
+}
+
+}  // namespace
+}  // namespace opencog
+}  // namespace v8
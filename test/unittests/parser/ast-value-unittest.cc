@@ -48,5 +48,32 @@ TEST_F(AstValueTest, BigIntToBooleanIsTrue) {
   EXPECT_TRUE(NewBigInt("0x0000D00C0")->ToBooleanIsTrue());
 }
 
+TEST_F(AstValueTest, InternalizeInBatches) {
+  Factory* factory = i_isolate()->factory();
+  DirectHandle<String> existing = factory->InternalizeUtf8String("existing");
+
+  const AstRawString* existing_raw =
+      ast_value_factory_.GetOneByteString("existing");
+  const AstRawString* new_raw =
+      ast_value_factory_.GetOneByteString("not-yet-internalized");
+  const uint16_t two_byte_chars[] = {0x41, 0x2603, 0x42};
+  const AstRawString* two_byte_raw =
+      ast_value_factory_.GetTwoByteString(base::VectorOf(two_byte_chars));
+  const AstRawString* empty_raw = ast_value_factory_.GetOneByteString("");
+
+  ast_value_factory_.Internalize(i_isolate());
+
+  EXPECT_EQ(*existing, *existing_raw->string());
+  EXPECT_TRUE(IsInternalizedString(*new_raw->string()));
+  EXPECT_TRUE(new_raw->string()->IsOneByteEqualTo(
+      base::StaticCharVector("not-yet-internalized")));
+  EXPECT_EQ(*new_raw->string(),
+            *factory->InternalizeUtf8String("not-yet-internalized"));
+  EXPECT_TRUE(IsInternalizedString(*two_byte_raw->string()));
+  EXPECT_EQ(3u, two_byte_raw->string()->length());
+  EXPECT_EQ(0x2603, two_byte_raw->string()->Get(1));
+  EXPECT_EQ(*factory->empty_string(), *empty_raw->string());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -986,3 +986,43 @@ TEST_F(ScannerStreamsTest, CloneCharacterStreams) {
     TestCloneCharacterStream("12345678", two_byte_streaming_stream.get(), 8);
   }
 }
+
+// Streaming streams can be cloned before all data has arrived, e.g. to post
+// parallel compile tasks, and the original keeps fetching afterwards.
+TEST_F(ScannerStreamsTest, CloneStreamingStreamsWhileStreaming) {
+  auto check = [](i::Utf16CharacterStream* stream) {
+    for (const char* c = "1234"; *c; c++) {
+      CHECK_EQ(static_cast<v8::base::uc32>(*c), stream->Advance());
+    }
+    std::unique_ptr<i::Utf16CharacterStream> clone = stream->Clone();
+    for (const char* c = "5678"; *c; c++) {
+      CHECK_EQ(static_cast<v8::base::uc32>(*c), stream->Advance());
+    }
+    CHECK_EQ(i::Utf16CharacterStream::kEndOfInput, stream->Advance());
+    clone->Seek(0);
+    for (const char* c = "1234"; *c; c++) {
+      CHECK_EQ(static_cast<v8::base::uc32>(*c), clone->Advance());
+    }
+  };
+  {
+    const char* chunks[] = {"1234", "5678", ""};
+    ChunkSource chunk_source(chunks);
+    std::unique_ptr<i::Utf16CharacterStream> stream(i::ScannerStream::For(
+        &chunk_source, v8::ScriptCompiler::StreamedSource::ONE_BYTE));
+    check(stream.get());
+  }
+  {
+    const char* chunks[] = {"1234", "5678", ""};
+    ChunkSource chunk_source(chunks);
+    std::unique_ptr<i::Utf16CharacterStream> stream(i::ScannerStream::For(
+        &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8));
+    check(stream.get());
+  }
+  {
+    const char16_t* chunks[] = {u"1234", u"5678", u""};
+    ChunkSource chunk_source(chunks);
+    std::unique_ptr<i::Utf16CharacterStream> stream(i::ScannerStream::For(
+        &chunk_source, v8::ScriptCompiler::StreamedSource::TWO_BYTE));
+    check(stream.get());
+  }
+}
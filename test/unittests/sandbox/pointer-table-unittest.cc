@@ -2,11 +2,14 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <set>
+#include <vector>
+
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/handles/handles-inl.h"
 #include "src/objects/js-objects.h"
-#include "src/sandbox/external-pointer-table.h"
+#include "src/sandbox/external-pointer-table-inl.h"
 #include "test/unittests/heap/heap-utils.h"  // For ManualGCScope
 #include "test/unittests/test-utils.h"
 
@@ -94,6 +97,37 @@ TEST_F(PointerTableTest, ExternalPointerTableCompaction) {
   delete external_2;
 }
 
+TEST_F(PointerTableTest, ExternalPointerTableBulkAllocation) {
+  auto* iso = i_isolate();
+  auto* space = iso->heap()->old_external_pointer_space();
+  ExternalPointerTable& table = iso->external_pointer_table();
+
+  ManualGCScope manual_gc_scope(iso);
+
+  // Request more entries than the freelist holds, so that the space has to be
+  // extended in the middle of the batch.
+  uint32_t num_segments = space->NumSegmentsForTesting();
+  size_t count = space->freelist_length() + 16;
+  std::vector<int> externals(count);
+  std::vector<Address> values(count);
+  for (size_t i = 0; i < count; i++) {
+    values[i] = reinterpret_cast<Address>(&externals[i]);
+  }
+  std::vector<ExternalPointerHandle> handles(count);
+  table.AllocateAndInitializeEntries(space, values.data(),
+                                     kLastExternalTypeTag, handles.data(),
+                                     count);
+
+  CHECK_LT(num_segments, space->NumSegmentsForTesting());
+  std::set<ExternalPointerHandle> distinct_handles(handles.begin(),
+                                                   handles.end());
+  CHECK_EQ(count, distinct_handles.size());
+  for (size_t i = 0; i < count; i++) {
+    CHECK_NE(kNullExternalPointerHandle, handles[i]);
+    CHECK_EQ(values[i], table.Get(handles[i], kLastExternalTypeTag));
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
 
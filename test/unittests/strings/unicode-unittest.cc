@@ -2,6 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -495,6 +496,54 @@ TEST(UnicodeTest, IncrementalUTF8DecodingVsNonIncrementalUtf8Decoding) {
   }
 }
 
+TEST(UnicodeTest, LongUtf8Decoding) {
+  // Long inputs are validated and converted with simdutf. They have to decode
+  // the same way as short ones, including invalid sequences anywhere.
+  const std::vector<std::vector<uint8_t>> pieces = {
+      {'a', 'b', 'c'},
+      {0xC3, 0xA9},              // U+00E9
+      {0xC2, 0x80},              // U+0080
+      {0xC4, 0x80},              // U+0100
+      {0xE2, 0x82, 0xAC},        // U+20AC
+      {0xF0, 0x9F, 0x98, 0x8D},  // U+1F60D
+      {0xED, 0xA0, 0x80},        // Encoded surrogate.
+      {0xC0, 0xAF},              // Overlong.
+      {0xE2, 0x82},              // Truncated.
+      {0xFF},
+  };
+  for (size_t first = 0; first < pieces.size(); first++) {
+    for (size_t second = 0; second < pieces.size(); second++) {
+      for (int ascii_prefix : {0, 1, 70}) {
+        std::vector<uint8_t> bytes(ascii_prefix, 'x');
+        for (int i = 0; i < 40; i++) {
+          const std::vector<uint8_t>& piece =
+              pieces[i % 3 == 2 ? second : first];
+          bytes.insert(bytes.end(), piece.begin(), piece.end());
+        }
+
+        std::vector<unibrow::uchar> expected;
+        DecodeNormally(bytes, &expected);
+        std::vector<unibrow::uchar> output;
+        DecodeUtf16(bytes, &output);
+        CHECK(expected == output);
+
+        auto utf8_data = base::VectorOf(bytes);
+        Utf8Decoder decoder(utf8_data);
+        bool is_one_byte = std::all_of(expected.begin(), expected.end(),
+                                       [](unibrow::uchar c) {
+                                         return c <= unibrow::Latin1::kMaxChar;
+                                       });
+        CHECK_EQ(is_one_byte, decoder.is_one_byte());
+        if (!is_one_byte) continue;
+        std::vector<uint8_t> latin1(decoder.utf16_length());
+        decoder.Decode(latin1.data(), utf8_data);
+        CHECK(std::equal(latin1.begin(), latin1.end(), expected.begin(),
+                         expected.end()));
+      }
+    }
+  }
+}
+
 class UnicodeWithGCTest : public TestWithHeapInternals {};
 
 #define GC_INSIDE_NEW_STRING_FROM_UTF8_SUB_STRING(NAME, STRING)               \
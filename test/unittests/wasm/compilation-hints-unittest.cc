@@ -240,5 +240,64 @@ TEST_F(WasmCompilationHintsUnittest, RecoverCompilationHints) {
   EXPECT_EQ(uint32_t{33}, call_targets_at_offset[1].call_frequency_percent);
 }
 
+TEST_F(WasmCompilationHintsUnittest, ProfiledCompilationHints) {
+  const FlagScope<bool> compilation_hints_scope(
+      &v8_flags.experimental_wasm_compilation_hints, true);
+  const FlagScope<bool> dynamic_tiering_scope(&v8_flags.wasm_dynamic_tiering,
+                                              true);
+  // A single check uses at most a quarter of the budget, so functions that
+  // only run once do not tier up.
+  const FlagScope<int> wasm_tiering_budget_scope(&v8_flags.wasm_tiering_budget,
+                                                 1000);
+  v8::Context::New(reinterpret_cast<v8::Isolate*>(isolate()))->Enter();
+  WasmCompilationHintsBuilder builder(isolate(), zone());
+  uint8_t count_down = builder.DefineFunction(
+      builder.sigs.i_ii(), {},
+      // clang-format off
+      {kExprLoop, kVoidCode,
+         kExprLocalGet, 0, kExprI32Const, 1, kExprI32Sub, kExprLocalTee, 0,
+         kExprBrIf, 0,
+       kExprEnd,
+       kExprLocalGet, 1,
+       kExprEnd});
+  // clang-format on
+  uint8_t once = builder.DefineFunction(
+      builder.sigs.i_ii(), {},
+      {WASM_I32_SUB(WASM_LOCAL_GET(0), WASM_LOCAL_GET(1)), WASM_END});
+  uint8_t unused = builder.DefineFunction(
+      builder.sigs.i_ii(), {},
+      {WASM_I32_MUL(WASM_LOCAL_GET(0), WASM_LOCAL_GET(1)), WASM_END});
+  builder.AddExport("count_down", count_down);
+  builder.AddExport("once", once);
+  builder.AddExport("unused", unused);
+
+  builder.CompileModule();
+
+  builder.CheckResult(count_down, 7, 1000, 7);
+  builder.CheckResult(once, 3, 10, 7);
+
+  ZoneBuffer buffer(zone());
+  buffer.write_u32(kWasmMagic);
+  buffer.write_u32(kWasmVersion);
+  EmitProfiledCompilationHintsToBuffer(
+      buffer, builder.trusted_instance_data()->native_module());
+
+  ErrorThrower thrower(isolate(), "test wasm compilation hints");
+  MaybeDirectHandle<WasmInstanceObject> maybe_instance =
+      testing::CompileAndInstantiateForTesting(isolate(), &thrower,
+                                               base::VectorOf(buffer));
+  EXPECT_FALSE(thrower.error());
+  const WasmModule* module = maybe_instance.ToHandleChecked()->module();
+
+  EXPECT_EQ(size_t{2}, module->compilation_priorities.size());
+  EXPECT_EQ(0, module->compilation_priorities.find(count_down)
+                   ->second.optimization_priority);
+  EXPECT_EQ(
+      kOptimizationPriorityNotSpecifiedSentinel,
+      module->compilation_priorities.find(once)->second.optimization_priority);
+  EXPECT_EQ(module->compilation_priorities.end(),
+            module->compilation_priorities.find(unused));
+}
+
 }  // namespace wasm
 }  // namespace v8::internal
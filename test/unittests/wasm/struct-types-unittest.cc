@@ -58,6 +58,50 @@ TEST_F(StructTypesTest, Packing) {
   EXPECT_EQ(9u, type->field_offset(4));
 }
 
+TEST_F(StructTypesTest, PackingIntoSeveralGaps) {
+  StructType::Builder builder(this->zone(), 8, false, false);
+  builder.AddField(kWasmI8, true);
+  builder.AddField(kWasmI32, true);
+  builder.AddField(kWasmI16, true);
+  builder.AddField(kWasmI16, true);
+  builder.AddField(kWasmI32, true);
+  builder.AddField(kWasmI8, true);
+  builder.AddField(kWasmI8, true);
+  builder.AddField(kWasmI8, true);
+  StructType* type = builder.Build();
+  EXPECT_EQ(16u, type->total_fields_size());
+  EXPECT_EQ(0u, type->field_offset(0));
+  EXPECT_EQ(4u, type->field_offset(1));
+  EXPECT_EQ(2u, type->field_offset(2));
+  EXPECT_EQ(8u, type->field_offset(3));
+  EXPECT_EQ(12u, type->field_offset(4));
+  // The i8 fields fill the gap left in front of the first i16 as well as the
+  // one in front of the second i32.
+  EXPECT_EQ(1u, type->field_offset(5));
+  EXPECT_EQ(10u, type->field_offset(6));
+  EXPECT_EQ(11u, type->field_offset(7));
+}
+
+TEST_F(StructTypesTest, PackingIsSubtypingSafe) {
+  const ValueType fields[] = {kWasmI8,  kWasmI64, kWasmI16, kWasmI8,
+                              kWasmI32, kWasmI8,  kWasmF64, kWasmI16,
+                              kWasmI8,  kWasmI32, kWasmI8,  kWasmI16};
+  const uint32_t count = static_cast<uint32_t>(arraysize(fields));
+  StructType::Builder builder(this->zone(), count, false, false);
+  for (ValueType field : fields) builder.AddField(field, true);
+  StructType* type = builder.Build();
+  for (uint32_t prefix = 1; prefix < count; prefix++) {
+    StructType::Builder prefix_builder(this->zone(), prefix, false, false);
+    for (uint32_t i = 0; i < prefix; i++) {
+      prefix_builder.AddField(fields[i], true);
+    }
+    StructType* prefix_type = prefix_builder.Build();
+    for (uint32_t i = 0; i < prefix; i++) {
+      EXPECT_EQ(prefix_type->field_offset(i), type->field_offset(i));
+    }
+  }
+}
+
 TEST_F(StructTypesTest, CopyingOffsets) {
   StructType::Builder builder(this->zone(), 5, false, false);
   builder.AddField(kWasmI64, true);
@@ -5,6 +5,7 @@
 #include "src/zone/zone.h"
 
 #include "src/zone/accounting-allocator.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -25,5 +26,45 @@ TEST_F(ZoneTest, 8ByteAlignment) {
   }
 }
 
+TEST_F(ZoneTest, SegmentPoolReusesSegments) {
+  FlagScope<bool> segment_pool(&v8_flags.zone_segment_pool, true);
+  AccountingAllocator allocator;
+  void* first_allocation;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    first_allocation = zone.Allocate<ZoneTestTag>(64);
+    EXPECT_EQ(0u, allocator.GetPooledMemory());
+  }
+  const size_t pooled = allocator.GetPooledMemory();
+  EXPECT_LT(0u, pooled);
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    EXPECT_EQ(first_allocation, zone.Allocate<ZoneTestTag>(64));
+    EXPECT_EQ(0u, allocator.GetPooledMemory());
+  }
+  EXPECT_EQ(pooled, allocator.GetPooledMemory());
+
+  // The segment has been reused since the last trim, so it is kept for one
+  // more trim interval.
+  allocator.TrimSegmentPool();
+  EXPECT_EQ(pooled, allocator.GetPooledMemory());
+  allocator.TrimSegmentPool();
+  EXPECT_EQ(0u, allocator.GetPooledMemory());
+}
+
+TEST_F(ZoneTest, SegmentPoolRelease) {
+  FlagScope<bool> segment_pool(&v8_flags.zone_segment_pool, true);
+  AccountingAllocator allocator;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    // Grows the zone into a large segment.
+    zone.Allocate<ZoneTestTag>(256 * KB);
+  }
+  EXPECT_LT(256 * KB, allocator.GetPooledMemory());
+  allocator.ReleaseSegmentPool();
+  EXPECT_EQ(0u, allocator.GetPooledMemory());
+}
+
 }  // namespace internal
 }  // namespace v8
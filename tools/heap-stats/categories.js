@@ -10,6 +10,7 @@ export const CATEGORIES = new Map([
       'CONS_TWO_BYTE_STRING_TYPE',
       'DESCRIPTOR_ARRAY_TYPE',
       'DEPRECATED_DESCRIPTOR_ARRAY_TYPE',
+      'DEPRECATED_MAP_TRANSITION_ARRAY_TYPE',
       'ELEMENTS_TYPE',
       'EXTERNAL_INTERNALIZED_TWO_BYTE_STRING_TYPE',
       'EXTERNAL_INTERNALIZED_ONE_BYTE_STRING_TYPE',
@@ -155,6 +156,7 @@ export const CATEGORIES = new Map([
       'SINGLE_CHARACTER_STRING_CACHE_TYPE',
       'STRING_SPLIT_CACHE_TYPE',
       'STRING_TABLE_TYPE',
+      'LARGE_TRANSITION_ARRAY_TYPE',
       'TRANSITION_ARRAY_TYPE',
       'WEAK_NEW_SPACE_OBJECT_TO_CODE_TYPE',
     ])